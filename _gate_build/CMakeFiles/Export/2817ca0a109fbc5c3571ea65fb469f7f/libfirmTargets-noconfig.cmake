@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "libfirm::firm" for configuration ""
+set_property(TARGET libfirm::firm APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(libfirm::firm PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libfirm.a"
+  )
+
+list(APPEND _cmake_import_check_targets libfirm::firm )
+list(APPEND _cmake_import_check_files_for_libfirm::firm "${_IMPORT_PREFIX}/lib/libfirm.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
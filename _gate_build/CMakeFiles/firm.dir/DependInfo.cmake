@@ -0,0 +1,329 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_build/gen/ir/be/TEMPLATE/gen_TEMPLATE_emitter.c" "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_emitter.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_emitter.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/TEMPLATE/gen_TEMPLATE_new_nodes.c" "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_new_nodes.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/TEMPLATE/gen_TEMPLATE_regalloc_if.c" "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_regalloc_if.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_regalloc_if.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/amd64/gen_amd64_emitter.c" "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_emitter.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_emitter.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/amd64/gen_amd64_new_nodes.c" "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_new_nodes.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/amd64/gen_amd64_regalloc_if.c" "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_regalloc_if.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_regalloc_if.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/arm/gen_arm_emitter.c" "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_emitter.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_emitter.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/arm/gen_arm_new_nodes.c" "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_new_nodes.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/arm/gen_arm_regalloc_if.c" "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_regalloc_if.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_regalloc_if.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/ia32/gen_ia32_emitter.c" "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_emitter.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_emitter.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/ia32/gen_ia32_new_nodes.c" "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_new_nodes.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/ia32/gen_ia32_regalloc_if.c" "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_regalloc_if.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_regalloc_if.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/mips/gen_mips_emitter.c" "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_emitter.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_emitter.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/mips/gen_mips_new_nodes.c" "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_new_nodes.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/mips/gen_mips_regalloc_if.c" "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_regalloc_if.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_regalloc_if.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/riscv/gen_riscv_emitter.c" "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_emitter.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_emitter.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/riscv/gen_riscv_new_nodes.c" "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_new_nodes.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/riscv/gen_riscv_regalloc_if.c" "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_regalloc_if.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_regalloc_if.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/sparc/gen_sparc_emitter.c" "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_emitter.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_emitter.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/sparc/gen_sparc_new_nodes.c" "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_new_nodes.c.o.d"
+  "/root/repo/_gate_build/gen/ir/be/sparc/gen_sparc_regalloc_if.c" "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_regalloc_if.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_regalloc_if.c.o.d"
+  "/root/repo/_gate_build/gen/ir/ir/gen_irio.c" "CMakeFiles/firm.dir/gen/ir/ir/gen_irio.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/ir/gen_irio.c.o.d"
+  "/root/repo/_gate_build/gen/ir/ir/gen_irnode.c" "CMakeFiles/firm.dir/gen/ir/ir/gen_irnode.c.o" "gcc" "CMakeFiles/firm.dir/gen/ir/ir/gen_irnode.c.o.d"
+  "/root/repo/ir/adt/array.c" "CMakeFiles/firm.dir/ir/adt/array.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/array.c.o.d"
+  "/root/repo/ir/adt/bipartite.c" "CMakeFiles/firm.dir/ir/adt/bipartite.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/bipartite.c.o.d"
+  "/root/repo/ir/adt/bitset.c" "CMakeFiles/firm.dir/ir/adt/bitset.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/bitset.c.o.d"
+  "/root/repo/ir/adt/cpset.c" "CMakeFiles/firm.dir/ir/adt/cpset.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/cpset.c.o.d"
+  "/root/repo/ir/adt/deq.c" "CMakeFiles/firm.dir/ir/adt/deq.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/deq.c.o.d"
+  "/root/repo/ir/adt/gaussjordan.c" "CMakeFiles/firm.dir/ir/adt/gaussjordan.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/gaussjordan.c.o.d"
+  "/root/repo/ir/adt/gaussseidel.c" "CMakeFiles/firm.dir/ir/adt/gaussseidel.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/gaussseidel.c.o.d"
+  "/root/repo/ir/adt/hungarian.c" "CMakeFiles/firm.dir/ir/adt/hungarian.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/hungarian.c.o.d"
+  "/root/repo/ir/adt/pmap.c" "CMakeFiles/firm.dir/ir/adt/pmap.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/pmap.c.o.d"
+  "/root/repo/ir/adt/pmap_new.c" "CMakeFiles/firm.dir/ir/adt/pmap_new.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/pmap_new.c.o.d"
+  "/root/repo/ir/adt/pqueue.c" "CMakeFiles/firm.dir/ir/adt/pqueue.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/pqueue.c.o.d"
+  "/root/repo/ir/adt/pset.c" "CMakeFiles/firm.dir/ir/adt/pset.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/pset.c.o.d"
+  "/root/repo/ir/adt/pset_new.c" "CMakeFiles/firm.dir/ir/adt/pset_new.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/pset_new.c.o.d"
+  "/root/repo/ir/adt/set.c" "CMakeFiles/firm.dir/ir/adt/set.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/set.c.o.d"
+  "/root/repo/ir/adt/xmalloc.c" "CMakeFiles/firm.dir/ir/adt/xmalloc.c.o" "gcc" "CMakeFiles/firm.dir/ir/adt/xmalloc.c.o.d"
+  "/root/repo/ir/ana/analyze_irg_args.c" "CMakeFiles/firm.dir/ir/ana/analyze_irg_args.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/analyze_irg_args.c.o.d"
+  "/root/repo/ir/ana/callgraph.c" "CMakeFiles/firm.dir/ir/ana/callgraph.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/callgraph.c.o.d"
+  "/root/repo/ir/ana/cdep.c" "CMakeFiles/firm.dir/ir/ana/cdep.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/cdep.c.o.d"
+  "/root/repo/ir/ana/cgana.c" "CMakeFiles/firm.dir/ir/ana/cgana.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/cgana.c.o.d"
+  "/root/repo/ir/ana/constbits.c" "CMakeFiles/firm.dir/ir/ana/constbits.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/constbits.c.o.d"
+  "/root/repo/ir/ana/dca.c" "CMakeFiles/firm.dir/ir/ana/dca.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/dca.c.o.d"
+  "/root/repo/ir/ana/dfs.c" "CMakeFiles/firm.dir/ir/ana/dfs.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/dfs.c.o.d"
+  "/root/repo/ir/ana/domfront.c" "CMakeFiles/firm.dir/ir/ana/domfront.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/domfront.c.o.d"
+  "/root/repo/ir/ana/execfreq.c" "CMakeFiles/firm.dir/ir/ana/execfreq.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/execfreq.c.o.d"
+  "/root/repo/ir/ana/heights.c" "CMakeFiles/firm.dir/ir/ana/heights.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/heights.c.o.d"
+  "/root/repo/ir/ana/irbackedge.c" "CMakeFiles/firm.dir/ir/ana/irbackedge.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/irbackedge.c.o.d"
+  "/root/repo/ir/ana/ircfscc.c" "CMakeFiles/firm.dir/ir/ana/ircfscc.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/ircfscc.c.o.d"
+  "/root/repo/ir/ana/irconsconfirm.c" "CMakeFiles/firm.dir/ir/ana/irconsconfirm.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/irconsconfirm.c.o.d"
+  "/root/repo/ir/ana/irdom.c" "CMakeFiles/firm.dir/ir/ana/irdom.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/irdom.c.o.d"
+  "/root/repo/ir/ana/irlivechk.c" "CMakeFiles/firm.dir/ir/ana/irlivechk.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/irlivechk.c.o.d"
+  "/root/repo/ir/ana/irloop.c" "CMakeFiles/firm.dir/ir/ana/irloop.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/irloop.c.o.d"
+  "/root/repo/ir/ana/irmemory.c" "CMakeFiles/firm.dir/ir/ana/irmemory.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/irmemory.c.o.d"
+  "/root/repo/ir/ana/irouts.c" "CMakeFiles/firm.dir/ir/ana/irouts.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/irouts.c.o.d"
+  "/root/repo/ir/ana/scalar_evolution.c" "CMakeFiles/firm.dir/ir/ana/scalar_evolution.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/scalar_evolution.c.o.d"
+  "/root/repo/ir/ana/vrp.c" "CMakeFiles/firm.dir/ir/ana/vrp.c.o" "gcc" "CMakeFiles/firm.dir/ir/ana/vrp.c.o.d"
+  "/root/repo/ir/be/TEMPLATE/TEMPLATE_bearch.c" "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_bearch.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_bearch.c.o.d"
+  "/root/repo/ir/be/TEMPLATE/TEMPLATE_emitter.c" "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_emitter.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_emitter.c.o.d"
+  "/root/repo/ir/be/TEMPLATE/TEMPLATE_new_nodes.c" "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_new_nodes.c.o.d"
+  "/root/repo/ir/be/TEMPLATE/TEMPLATE_transform.c" "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_transform.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_transform.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_abi.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_abi.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_abi.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_bearch.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_bearch.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_bearch.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_cconv.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_cconv.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_cconv.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_emitter.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_emitter.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_emitter.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_finish.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_finish.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_finish.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_lower128.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_lower128.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_lower128.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_new_nodes.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_new_nodes.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_optimize.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_optimize.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_optimize.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_pic.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_pic.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_pic.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_transform.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_transform.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_transform.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_varargs.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_varargs.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_varargs.c.o.d"
+  "/root/repo/ir/be/amd64/amd64_x87.c" "CMakeFiles/firm.dir/ir/be/amd64/amd64_x87.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/amd64/amd64_x87.c.o.d"
+  "/root/repo/ir/be/arm/arm_bearch.c" "CMakeFiles/firm.dir/ir/be/arm/arm_bearch.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/arm/arm_bearch.c.o.d"
+  "/root/repo/ir/be/arm/arm_cconv.c" "CMakeFiles/firm.dir/ir/be/arm/arm_cconv.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/arm/arm_cconv.c.o.d"
+  "/root/repo/ir/be/arm/arm_emitter.c" "CMakeFiles/firm.dir/ir/be/arm/arm_emitter.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/arm/arm_emitter.c.o.d"
+  "/root/repo/ir/be/arm/arm_finish.c" "CMakeFiles/firm.dir/ir/be/arm/arm_finish.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/arm/arm_finish.c.o.d"
+  "/root/repo/ir/be/arm/arm_lower64.c" "CMakeFiles/firm.dir/ir/be/arm/arm_lower64.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/arm/arm_lower64.c.o.d"
+  "/root/repo/ir/be/arm/arm_new_nodes.c" "CMakeFiles/firm.dir/ir/be/arm/arm_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/arm/arm_new_nodes.c.o.d"
+  "/root/repo/ir/be/arm/arm_optimize.c" "CMakeFiles/firm.dir/ir/be/arm/arm_optimize.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/arm/arm_optimize.c.o.d"
+  "/root/repo/ir/be/arm/arm_transform.c" "CMakeFiles/firm.dir/ir/be/arm/arm_transform.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/arm/arm_transform.c.o.d"
+  "/root/repo/ir/be/be2addr.c" "CMakeFiles/firm.dir/ir/be/be2addr.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/be2addr.c.o.d"
+  "/root/repo/ir/be/bearch.c" "CMakeFiles/firm.dir/ir/be/bearch.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bearch.c.o.d"
+  "/root/repo/ir/be/beasm.c" "CMakeFiles/firm.dir/ir/be/beasm.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beasm.c.o.d"
+  "/root/repo/ir/be/beblocksched.c" "CMakeFiles/firm.dir/ir/be/beblocksched.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beblocksched.c.o.d"
+  "/root/repo/ir/be/bechordal.c" "CMakeFiles/firm.dir/ir/be/bechordal.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bechordal.c.o.d"
+  "/root/repo/ir/be/bechordal_common.c" "CMakeFiles/firm.dir/ir/be/bechordal_common.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bechordal_common.c.o.d"
+  "/root/repo/ir/be/bechordal_main.c" "CMakeFiles/firm.dir/ir/be/bechordal_main.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bechordal_main.c.o.d"
+  "/root/repo/ir/be/becopyheur4.c" "CMakeFiles/firm.dir/ir/be/becopyheur4.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/becopyheur4.c.o.d"
+  "/root/repo/ir/be/becopyheur5.c" "CMakeFiles/firm.dir/ir/be/becopyheur5.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/becopyheur5.c.o.d"
+  "/root/repo/ir/be/becopyilp.c" "CMakeFiles/firm.dir/ir/be/becopyilp.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/becopyilp.c.o.d"
+  "/root/repo/ir/be/becopyilp2.c" "CMakeFiles/firm.dir/ir/be/becopyilp2.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/becopyilp2.c.o.d"
+  "/root/repo/ir/be/becopyopt.c" "CMakeFiles/firm.dir/ir/be/becopyopt.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/becopyopt.c.o.d"
+  "/root/repo/ir/be/becse.c" "CMakeFiles/firm.dir/ir/be/becse.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/becse.c.o.d"
+  "/root/repo/ir/be/bediagnostic.c" "CMakeFiles/firm.dir/ir/be/bediagnostic.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bediagnostic.c.o.d"
+  "/root/repo/ir/be/bedump.c" "CMakeFiles/firm.dir/ir/be/bedump.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bedump.c.o.d"
+  "/root/repo/ir/be/bedwarf.c" "CMakeFiles/firm.dir/ir/be/bedwarf.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bedwarf.c.o.d"
+  "/root/repo/ir/be/beemithlp.c" "CMakeFiles/firm.dir/ir/be/beemithlp.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beemithlp.c.o.d"
+  "/root/repo/ir/be/beemitter.c" "CMakeFiles/firm.dir/ir/be/beemitter.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beemitter.c.o.d"
+  "/root/repo/ir/be/beflags.c" "CMakeFiles/firm.dir/ir/be/beflags.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beflags.c.o.d"
+  "/root/repo/ir/be/begnuas.c" "CMakeFiles/firm.dir/ir/be/begnuas.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/begnuas.c.o.d"
+  "/root/repo/ir/be/beifg.c" "CMakeFiles/firm.dir/ir/be/beifg.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beifg.c.o.d"
+  "/root/repo/ir/be/beinfo.c" "CMakeFiles/firm.dir/ir/be/beinfo.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beinfo.c.o.d"
+  "/root/repo/ir/be/beinsn.c" "CMakeFiles/firm.dir/ir/be/beinsn.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beinsn.c.o.d"
+  "/root/repo/ir/be/beirg.c" "CMakeFiles/firm.dir/ir/be/beirg.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beirg.c.o.d"
+  "/root/repo/ir/be/bejit.c" "CMakeFiles/firm.dir/ir/be/bejit.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bejit.c.o.d"
+  "/root/repo/ir/be/belistsched.c" "CMakeFiles/firm.dir/ir/be/belistsched.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/belistsched.c.o.d"
+  "/root/repo/ir/be/belive.c" "CMakeFiles/firm.dir/ir/be/belive.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/belive.c.o.d"
+  "/root/repo/ir/be/beloopana.c" "CMakeFiles/firm.dir/ir/be/beloopana.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beloopana.c.o.d"
+  "/root/repo/ir/be/belower.c" "CMakeFiles/firm.dir/ir/be/belower.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/belower.c.o.d"
+  "/root/repo/ir/be/bemain.c" "CMakeFiles/firm.dir/ir/be/bemain.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bemain.c.o.d"
+  "/root/repo/ir/be/bememfold.c" "CMakeFiles/firm.dir/ir/be/bememfold.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bememfold.c.o.d"
+  "/root/repo/ir/be/bemodule.c" "CMakeFiles/firm.dir/ir/be/bemodule.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bemodule.c.o.d"
+  "/root/repo/ir/be/benode.c" "CMakeFiles/firm.dir/ir/be/benode.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/benode.c.o.d"
+  "/root/repo/ir/be/bepbqpcoloring.c" "CMakeFiles/firm.dir/ir/be/bepbqpcoloring.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bepbqpcoloring.c.o.d"
+  "/root/repo/ir/be/bepeephole.c" "CMakeFiles/firm.dir/ir/be/bepeephole.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bepeephole.c.o.d"
+  "/root/repo/ir/be/beprefalloc.c" "CMakeFiles/firm.dir/ir/be/beprefalloc.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beprefalloc.c.o.d"
+  "/root/repo/ir/be/bera.c" "CMakeFiles/firm.dir/ir/be/bera.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bera.c.o.d"
+  "/root/repo/ir/be/besched.c" "CMakeFiles/firm.dir/ir/be/besched.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/besched.c.o.d"
+  "/root/repo/ir/be/beschedcp.c" "CMakeFiles/firm.dir/ir/be/beschedcp.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beschedcp.c.o.d"
+  "/root/repo/ir/be/beschednormal.c" "CMakeFiles/firm.dir/ir/be/beschednormal.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beschednormal.c.o.d"
+  "/root/repo/ir/be/beschedrand.c" "CMakeFiles/firm.dir/ir/be/beschedrand.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beschedrand.c.o.d"
+  "/root/repo/ir/be/beschedregpress.c" "CMakeFiles/firm.dir/ir/be/beschedregpress.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beschedregpress.c.o.d"
+  "/root/repo/ir/be/beschedtrivial.c" "CMakeFiles/firm.dir/ir/be/beschedtrivial.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beschedtrivial.c.o.d"
+  "/root/repo/ir/be/bespill.c" "CMakeFiles/firm.dir/ir/be/bespill.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bespill.c.o.d"
+  "/root/repo/ir/be/bespillbelady.c" "CMakeFiles/firm.dir/ir/be/bespillbelady.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bespillbelady.c.o.d"
+  "/root/repo/ir/be/bespilldaemel.c" "CMakeFiles/firm.dir/ir/be/bespilldaemel.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bespilldaemel.c.o.d"
+  "/root/repo/ir/be/bespillslots.c" "CMakeFiles/firm.dir/ir/be/bespillslots.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bespillslots.c.o.d"
+  "/root/repo/ir/be/bespillutil.c" "CMakeFiles/firm.dir/ir/be/bespillutil.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bespillutil.c.o.d"
+  "/root/repo/ir/be/bessaconstr.c" "CMakeFiles/firm.dir/ir/be/bessaconstr.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bessaconstr.c.o.d"
+  "/root/repo/ir/be/bessadestr.c" "CMakeFiles/firm.dir/ir/be/bessadestr.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bessadestr.c.o.d"
+  "/root/repo/ir/be/bestack.c" "CMakeFiles/firm.dir/ir/be/bestack.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bestack.c.o.d"
+  "/root/repo/ir/be/bestat.c" "CMakeFiles/firm.dir/ir/be/bestat.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bestat.c.o.d"
+  "/root/repo/ir/be/bestate.c" "CMakeFiles/firm.dir/ir/be/bestate.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bestate.c.o.d"
+  "/root/repo/ir/be/betranshlp.c" "CMakeFiles/firm.dir/ir/be/betranshlp.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/betranshlp.c.o.d"
+  "/root/repo/ir/be/beuses.c" "CMakeFiles/firm.dir/ir/be/beuses.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beuses.c.o.d"
+  "/root/repo/ir/be/beutil.c" "CMakeFiles/firm.dir/ir/be/beutil.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beutil.c.o.d"
+  "/root/repo/ir/be/bevarargs.c" "CMakeFiles/firm.dir/ir/be/bevarargs.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/bevarargs.c.o.d"
+  "/root/repo/ir/be/beverify.c" "CMakeFiles/firm.dir/ir/be/beverify.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/beverify.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_architecture.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_architecture.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_architecture.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_bearch.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_bearch.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_bearch.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_cconv.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_cconv.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_cconv.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_emitter.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_emitter.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_emitter.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_encode.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_encode.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_encode.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_finish.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_finish.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_finish.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_fpu.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_fpu.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_fpu.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_intrinsics.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_intrinsics.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_intrinsics.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_new_nodes.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_new_nodes.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_optimize.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_optimize.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_optimize.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_pic.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_pic.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_pic.c.o.d"
+  "/root/repo/ir/be/ia32/ia32_transform.c" "CMakeFiles/firm.dir/ir/be/ia32/ia32_transform.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/ia32_transform.c.o.d"
+  "/root/repo/ir/be/ia32/x86_address_mode.c" "CMakeFiles/firm.dir/ir/be/ia32/x86_address_mode.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/x86_address_mode.c.o.d"
+  "/root/repo/ir/be/ia32/x86_asm.c" "CMakeFiles/firm.dir/ir/be/ia32/x86_asm.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/x86_asm.c.o.d"
+  "/root/repo/ir/be/ia32/x86_cconv.c" "CMakeFiles/firm.dir/ir/be/ia32/x86_cconv.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/x86_cconv.c.o.d"
+  "/root/repo/ir/be/ia32/x86_node.c" "CMakeFiles/firm.dir/ir/be/ia32/x86_node.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/x86_node.c.o.d"
+  "/root/repo/ir/be/ia32/x86_x87.c" "CMakeFiles/firm.dir/ir/be/ia32/x86_x87.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/ia32/x86_x87.c.o.d"
+  "/root/repo/ir/be/machine_triple.c" "CMakeFiles/firm.dir/ir/be/machine_triple.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/machine_triple.c.o.d"
+  "/root/repo/ir/be/mips/mips_bearch.c" "CMakeFiles/firm.dir/ir/be/mips/mips_bearch.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/mips/mips_bearch.c.o.d"
+  "/root/repo/ir/be/mips/mips_cconv.c" "CMakeFiles/firm.dir/ir/be/mips/mips_cconv.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/mips/mips_cconv.c.o.d"
+  "/root/repo/ir/be/mips/mips_emitter.c" "CMakeFiles/firm.dir/ir/be/mips/mips_emitter.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/mips/mips_emitter.c.o.d"
+  "/root/repo/ir/be/mips/mips_lower64.c" "CMakeFiles/firm.dir/ir/be/mips/mips_lower64.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/mips/mips_lower64.c.o.d"
+  "/root/repo/ir/be/mips/mips_new_nodes.c" "CMakeFiles/firm.dir/ir/be/mips/mips_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/mips/mips_new_nodes.c.o.d"
+  "/root/repo/ir/be/mips/mips_nodes_attr.c" "CMakeFiles/firm.dir/ir/be/mips/mips_nodes_attr.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/mips/mips_nodes_attr.c.o.d"
+  "/root/repo/ir/be/mips/mips_transform.c" "CMakeFiles/firm.dir/ir/be/mips/mips_transform.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/mips/mips_transform.c.o.d"
+  "/root/repo/ir/be/platform.c" "CMakeFiles/firm.dir/ir/be/platform.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/platform.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_abi.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_abi.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_abi.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_bearch.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_bearch.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_bearch.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_cconv.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_cconv.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_cconv.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_emitter.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_emitter.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_emitter.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_finish.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_finish.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_finish.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_lower64.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_lower64.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_lower64.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_new_nodes.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_new_nodes.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_nodes_attr.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_nodes_attr.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_nodes_attr.c.o.d"
+  "/root/repo/ir/be/riscv/riscv_transform.c" "CMakeFiles/firm.dir/ir/be/riscv/riscv_transform.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/riscv/riscv_transform.c.o.d"
+  "/root/repo/ir/be/sparc/sparc_bearch.c" "CMakeFiles/firm.dir/ir/be/sparc/sparc_bearch.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/sparc/sparc_bearch.c.o.d"
+  "/root/repo/ir/be/sparc/sparc_cconv.c" "CMakeFiles/firm.dir/ir/be/sparc/sparc_cconv.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/sparc/sparc_cconv.c.o.d"
+  "/root/repo/ir/be/sparc/sparc_emitter.c" "CMakeFiles/firm.dir/ir/be/sparc/sparc_emitter.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/sparc/sparc_emitter.c.o.d"
+  "/root/repo/ir/be/sparc/sparc_finish.c" "CMakeFiles/firm.dir/ir/be/sparc/sparc_finish.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/sparc/sparc_finish.c.o.d"
+  "/root/repo/ir/be/sparc/sparc_lower64.c" "CMakeFiles/firm.dir/ir/be/sparc/sparc_lower64.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/sparc/sparc_lower64.c.o.d"
+  "/root/repo/ir/be/sparc/sparc_new_nodes.c" "CMakeFiles/firm.dir/ir/be/sparc/sparc_new_nodes.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/sparc/sparc_new_nodes.c.o.d"
+  "/root/repo/ir/be/sparc/sparc_stackframe.c" "CMakeFiles/firm.dir/ir/be/sparc/sparc_stackframe.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/sparc/sparc_stackframe.c.o.d"
+  "/root/repo/ir/be/sparc/sparc_transform.c" "CMakeFiles/firm.dir/ir/be/sparc/sparc_transform.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/sparc/sparc_transform.c.o.d"
+  "/root/repo/ir/be/target.c" "CMakeFiles/firm.dir/ir/be/target.c.o" "gcc" "CMakeFiles/firm.dir/ir/be/target.c.o.d"
+  "/root/repo/ir/common/debug.c" "CMakeFiles/firm.dir/ir/common/debug.c.o" "gcc" "CMakeFiles/firm.dir/ir/common/debug.c.o.d"
+  "/root/repo/ir/common/debugger.c" "CMakeFiles/firm.dir/ir/common/debugger.c.o" "gcc" "CMakeFiles/firm.dir/ir/common/debugger.c.o.d"
+  "/root/repo/ir/common/firm.c" "CMakeFiles/firm.dir/ir/common/firm.c.o" "gcc" "CMakeFiles/firm.dir/ir/common/firm.c.o.d"
+  "/root/repo/ir/common/firm_common.c" "CMakeFiles/firm.dir/ir/common/firm_common.c.o" "gcc" "CMakeFiles/firm.dir/ir/common/firm_common.c.o.d"
+  "/root/repo/ir/common/memstat.c" "CMakeFiles/firm.dir/ir/common/memstat.c.o" "gcc" "CMakeFiles/firm.dir/ir/common/memstat.c.o.d"
+  "/root/repo/ir/common/panic.c" "CMakeFiles/firm.dir/ir/common/panic.c.o" "gcc" "CMakeFiles/firm.dir/ir/common/panic.c.o.d"
+  "/root/repo/ir/common/timing.c" "CMakeFiles/firm.dir/ir/common/timing.c.o" "gcc" "CMakeFiles/firm.dir/ir/common/timing.c.o.d"
+  "/root/repo/ir/ident/ident.c" "CMakeFiles/firm.dir/ir/ident/ident.c.o" "gcc" "CMakeFiles/firm.dir/ir/ident/ident.c.o.d"
+  "/root/repo/ir/ir/dbginfo.c" "CMakeFiles/firm.dir/ir/ir/dbginfo.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/dbginfo.c.o.d"
+  "/root/repo/ir/ir/irarch.c" "CMakeFiles/firm.dir/ir/ir/irarch.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irarch.c.o.d"
+  "/root/repo/ir/ir/irargs.c" "CMakeFiles/firm.dir/ir/ir/irargs.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irargs.c.o.d"
+  "/root/repo/ir/ir/ircache.c" "CMakeFiles/firm.dir/ir/ir/ircache.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/ircache.c.o.d"
+  "/root/repo/ir/ir/ircons.c" "CMakeFiles/firm.dir/ir/ir/ircons.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/ircons.c.o.d"
+  "/root/repo/ir/ir/irdump.c" "CMakeFiles/firm.dir/ir/ir/irdump.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irdump.c.o.d"
+  "/root/repo/ir/ir/irdumptxt.c" "CMakeFiles/firm.dir/ir/ir/irdumptxt.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irdumptxt.c.o.d"
+  "/root/repo/ir/ir/iredges.c" "CMakeFiles/firm.dir/ir/ir/iredges.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/iredges.c.o.d"
+  "/root/repo/ir/ir/irflag.c" "CMakeFiles/firm.dir/ir/ir/irflag.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irflag.c.o.d"
+  "/root/repo/ir/ir/irgmod.c" "CMakeFiles/firm.dir/ir/ir/irgmod.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irgmod.c.o.d"
+  "/root/repo/ir/ir/irgraph.c" "CMakeFiles/firm.dir/ir/ir/irgraph.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irgraph.c.o.d"
+  "/root/repo/ir/ir/irgwalk.c" "CMakeFiles/firm.dir/ir/ir/irgwalk.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irgwalk.c.o.d"
+  "/root/repo/ir/ir/irgwalk_blk.c" "CMakeFiles/firm.dir/ir/ir/irgwalk_blk.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irgwalk_blk.c.o.d"
+  "/root/repo/ir/ir/irhooks.c" "CMakeFiles/firm.dir/ir/ir/irhooks.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irhooks.c.o.d"
+  "/root/repo/ir/ir/iridentityset.c" "CMakeFiles/firm.dir/ir/ir/iridentityset.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/iridentityset.c.o.d"
+  "/root/repo/ir/ir/irio.c" "CMakeFiles/firm.dir/ir/ir/irio.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irio.c.o.d"
+  "/root/repo/ir/ir/irmode.c" "CMakeFiles/firm.dir/ir/ir/irmode.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irmode.c.o.d"
+  "/root/repo/ir/ir/irnode.c" "CMakeFiles/firm.dir/ir/ir/irnode.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irnode.c.o.d"
+  "/root/repo/ir/ir/irnodehashmap.c" "CMakeFiles/firm.dir/ir/ir/irnodehashmap.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irnodehashmap.c.o.d"
+  "/root/repo/ir/ir/irnodeset.c" "CMakeFiles/firm.dir/ir/ir/irnodeset.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irnodeset.c.o.d"
+  "/root/repo/ir/ir/irop.c" "CMakeFiles/firm.dir/ir/ir/irop.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irop.c.o.d"
+  "/root/repo/ir/ir/irprintf.c" "CMakeFiles/firm.dir/ir/ir/irprintf.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irprintf.c.o.d"
+  "/root/repo/ir/ir/irprofile.c" "CMakeFiles/firm.dir/ir/ir/irprofile.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irprofile.c.o.d"
+  "/root/repo/ir/ir/irprog.c" "CMakeFiles/firm.dir/ir/ir/irprog.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irprog.c.o.d"
+  "/root/repo/ir/ir/irssacons.c" "CMakeFiles/firm.dir/ir/ir/irssacons.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irssacons.c.o.d"
+  "/root/repo/ir/ir/irtools.c" "CMakeFiles/firm.dir/ir/ir/irtools.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irtools.c.o.d"
+  "/root/repo/ir/ir/irverify.c" "CMakeFiles/firm.dir/ir/ir/irverify.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/irverify.c.o.d"
+  "/root/repo/ir/ir/valueset.c" "CMakeFiles/firm.dir/ir/ir/valueset.c.o" "gcc" "CMakeFiles/firm.dir/ir/ir/valueset.c.o.d"
+  "/root/repo/ir/kaps/brute_force.c" "CMakeFiles/firm.dir/ir/kaps/brute_force.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/brute_force.c.o.d"
+  "/root/repo/ir/kaps/bucket.c" "CMakeFiles/firm.dir/ir/kaps/bucket.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/bucket.c.o.d"
+  "/root/repo/ir/kaps/heuristical.c" "CMakeFiles/firm.dir/ir/kaps/heuristical.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/heuristical.c.o.d"
+  "/root/repo/ir/kaps/heuristical_co.c" "CMakeFiles/firm.dir/ir/kaps/heuristical_co.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/heuristical_co.c.o.d"
+  "/root/repo/ir/kaps/heuristical_co_ld.c" "CMakeFiles/firm.dir/ir/kaps/heuristical_co_ld.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/heuristical_co_ld.c.o.d"
+  "/root/repo/ir/kaps/html_dumper.c" "CMakeFiles/firm.dir/ir/kaps/html_dumper.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/html_dumper.c.o.d"
+  "/root/repo/ir/kaps/kaps.c" "CMakeFiles/firm.dir/ir/kaps/kaps.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/kaps.c.o.d"
+  "/root/repo/ir/kaps/matrix.c" "CMakeFiles/firm.dir/ir/kaps/matrix.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/matrix.c.o.d"
+  "/root/repo/ir/kaps/optimal.c" "CMakeFiles/firm.dir/ir/kaps/optimal.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/optimal.c.o.d"
+  "/root/repo/ir/kaps/pbqp_edge.c" "CMakeFiles/firm.dir/ir/kaps/pbqp_edge.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/pbqp_edge.c.o.d"
+  "/root/repo/ir/kaps/pbqp_node.c" "CMakeFiles/firm.dir/ir/kaps/pbqp_node.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/pbqp_node.c.o.d"
+  "/root/repo/ir/kaps/vector.c" "CMakeFiles/firm.dir/ir/kaps/vector.c.o" "gcc" "CMakeFiles/firm.dir/ir/kaps/vector.c.o.d"
+  "/root/repo/ir/libcore/lc_appendable.c" "CMakeFiles/firm.dir/ir/libcore/lc_appendable.c.o" "gcc" "CMakeFiles/firm.dir/ir/libcore/lc_appendable.c.o.d"
+  "/root/repo/ir/libcore/lc_opts.c" "CMakeFiles/firm.dir/ir/libcore/lc_opts.c.o" "gcc" "CMakeFiles/firm.dir/ir/libcore/lc_opts.c.o.d"
+  "/root/repo/ir/libcore/lc_opts_enum.c" "CMakeFiles/firm.dir/ir/libcore/lc_opts_enum.c.o" "gcc" "CMakeFiles/firm.dir/ir/libcore/lc_opts_enum.c.o.d"
+  "/root/repo/ir/libcore/lc_printf.c" "CMakeFiles/firm.dir/ir/libcore/lc_printf.c.o" "gcc" "CMakeFiles/firm.dir/ir/libcore/lc_printf.c.o.d"
+  "/root/repo/ir/lower/lower_alloc.c" "CMakeFiles/firm.dir/ir/lower/lower_alloc.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_alloc.c.o.d"
+  "/root/repo/ir/lower/lower_builtins.c" "CMakeFiles/firm.dir/ir/lower/lower_builtins.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_builtins.c.o.d"
+  "/root/repo/ir/lower/lower_calls.c" "CMakeFiles/firm.dir/ir/lower/lower_calls.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_calls.c.o.d"
+  "/root/repo/ir/lower/lower_copyb.c" "CMakeFiles/firm.dir/ir/lower/lower_copyb.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_copyb.c.o.d"
+  "/root/repo/ir/lower/lower_dw.c" "CMakeFiles/firm.dir/ir/lower/lower_dw.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_dw.c.o.d"
+  "/root/repo/ir/lower/lower_hl.c" "CMakeFiles/firm.dir/ir/lower/lower_hl.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_hl.c.o.d"
+  "/root/repo/ir/lower/lower_intrinsics.c" "CMakeFiles/firm.dir/ir/lower/lower_intrinsics.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_intrinsics.c.o.d"
+  "/root/repo/ir/lower/lower_mode_b.c" "CMakeFiles/firm.dir/ir/lower/lower_mode_b.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_mode_b.c.o.d"
+  "/root/repo/ir/lower/lower_mux.c" "CMakeFiles/firm.dir/ir/lower/lower_mux.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_mux.c.o.d"
+  "/root/repo/ir/lower/lower_softfloat.c" "CMakeFiles/firm.dir/ir/lower/lower_softfloat.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_softfloat.c.o.d"
+  "/root/repo/ir/lower/lower_switch.c" "CMakeFiles/firm.dir/ir/lower/lower_switch.c.o" "gcc" "CMakeFiles/firm.dir/ir/lower/lower_switch.c.o.d"
+  "/root/repo/ir/lpp/lpp.c" "CMakeFiles/firm.dir/ir/lpp/lpp.c.o" "gcc" "CMakeFiles/firm.dir/ir/lpp/lpp.c.o.d"
+  "/root/repo/ir/lpp/lpp_cplex.c" "CMakeFiles/firm.dir/ir/lpp/lpp_cplex.c.o" "gcc" "CMakeFiles/firm.dir/ir/lpp/lpp_cplex.c.o.d"
+  "/root/repo/ir/lpp/lpp_gurobi.c" "CMakeFiles/firm.dir/ir/lpp/lpp_gurobi.c.o" "gcc" "CMakeFiles/firm.dir/ir/lpp/lpp_gurobi.c.o.d"
+  "/root/repo/ir/lpp/lpp_solvers.c" "CMakeFiles/firm.dir/ir/lpp/lpp_solvers.c.o" "gcc" "CMakeFiles/firm.dir/ir/lpp/lpp_solvers.c.o.d"
+  "/root/repo/ir/lpp/mps.c" "CMakeFiles/firm.dir/ir/lpp/mps.c.o" "gcc" "CMakeFiles/firm.dir/ir/lpp/mps.c.o.d"
+  "/root/repo/ir/lpp/sp_matrix.c" "CMakeFiles/firm.dir/ir/lpp/sp_matrix.c.o" "gcc" "CMakeFiles/firm.dir/ir/lpp/sp_matrix.c.o.d"
+  "/root/repo/ir/obstack/obstack.c" "CMakeFiles/firm.dir/ir/obstack/obstack.c.o" "gcc" "CMakeFiles/firm.dir/ir/obstack/obstack.c.o.d"
+  "/root/repo/ir/obstack/obstack_printf.c" "CMakeFiles/firm.dir/ir/obstack/obstack_printf.c.o" "gcc" "CMakeFiles/firm.dir/ir/obstack/obstack_printf.c.o.d"
+  "/root/repo/ir/opt/boolopt.c" "CMakeFiles/firm.dir/ir/opt/boolopt.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/boolopt.c.o.d"
+  "/root/repo/ir/opt/boundscheck.c" "CMakeFiles/firm.dir/ir/opt/boundscheck.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/boundscheck.c.o.d"
+  "/root/repo/ir/opt/cfopt.c" "CMakeFiles/firm.dir/ir/opt/cfopt.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/cfopt.c.o.d"
+  "/root/repo/ir/opt/cleanup.c" "CMakeFiles/firm.dir/ir/opt/cleanup.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/cleanup.c.o.d"
+  "/root/repo/ir/opt/code_placement.c" "CMakeFiles/firm.dir/ir/opt/code_placement.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/code_placement.c.o.d"
+  "/root/repo/ir/opt/combo.c" "CMakeFiles/firm.dir/ir/opt/combo.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/combo.c.o.d"
+  "/root/repo/ir/opt/convopt.c" "CMakeFiles/firm.dir/ir/opt/convopt.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/convopt.c.o.d"
+  "/root/repo/ir/opt/critical_edges.c" "CMakeFiles/firm.dir/ir/opt/critical_edges.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/critical_edges.c.o.d"
+  "/root/repo/ir/opt/dead_code_elimination.c" "CMakeFiles/firm.dir/ir/opt/dead_code_elimination.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/dead_code_elimination.c.o.d"
+  "/root/repo/ir/opt/devirt.c" "CMakeFiles/firm.dir/ir/opt/devirt.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/devirt.c.o.d"
+  "/root/repo/ir/opt/escape_ana.c" "CMakeFiles/firm.dir/ir/opt/escape_ana.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/escape_ana.c.o.d"
+  "/root/repo/ir/opt/funccall.c" "CMakeFiles/firm.dir/ir/opt/funccall.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/funccall.c.o.d"
+  "/root/repo/ir/opt/garbage_collect.c" "CMakeFiles/firm.dir/ir/opt/garbage_collect.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/garbage_collect.c.o.d"
+  "/root/repo/ir/opt/gvn_pre.c" "CMakeFiles/firm.dir/ir/opt/gvn_pre.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/gvn_pre.c.o.d"
+  "/root/repo/ir/opt/icf.c" "CMakeFiles/firm.dir/ir/opt/icf.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/icf.c.o.d"
+  "/root/repo/ir/opt/ifconv.c" "CMakeFiles/firm.dir/ir/opt/ifconv.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/ifconv.c.o.d"
+  "/root/repo/ir/opt/instrument.c" "CMakeFiles/firm.dir/ir/opt/instrument.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/instrument.c.o.d"
+  "/root/repo/ir/opt/ipcp.c" "CMakeFiles/firm.dir/ir/opt/ipcp.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/ipcp.c.o.d"
+  "/root/repo/ir/opt/ircgopt.c" "CMakeFiles/firm.dir/ir/opt/ircgopt.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/ircgopt.c.o.d"
+  "/root/repo/ir/opt/ircomplib.c" "CMakeFiles/firm.dir/ir/opt/ircomplib.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/ircomplib.c.o.d"
+  "/root/repo/ir/opt/irgopt.c" "CMakeFiles/firm.dir/ir/opt/irgopt.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/irgopt.c.o.d"
+  "/root/repo/ir/opt/iropt.c" "CMakeFiles/firm.dir/ir/opt/iropt.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/iropt.c.o.d"
+  "/root/repo/ir/opt/jumpthreading.c" "CMakeFiles/firm.dir/ir/opt/jumpthreading.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/jumpthreading.c.o.d"
+  "/root/repo/ir/opt/lcssa.c" "CMakeFiles/firm.dir/ir/opt/lcssa.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/lcssa.c.o.d"
+  "/root/repo/ir/opt/ldstopt.c" "CMakeFiles/firm.dir/ir/opt/ldstopt.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/ldstopt.c.o.d"
+  "/root/repo/ir/opt/licm.c" "CMakeFiles/firm.dir/ir/opt/licm.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/licm.c.o.d"
+  "/root/repo/ir/opt/loop.c" "CMakeFiles/firm.dir/ir/opt/loop.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/loop.c.o.d"
+  "/root/repo/ir/opt/loop_unrolling.c" "CMakeFiles/firm.dir/ir/opt/loop_unrolling.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/loop_unrolling.c.o.d"
+  "/root/repo/ir/opt/loopidiom.c" "CMakeFiles/firm.dir/ir/opt/loopidiom.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/loopidiom.c.o.d"
+  "/root/repo/ir/opt/merge_mem.c" "CMakeFiles/firm.dir/ir/opt/merge_mem.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/merge_mem.c.o.d"
+  "/root/repo/ir/opt/occult_const.c" "CMakeFiles/firm.dir/ir/opt/occult_const.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/occult_const.c.o.d"
+  "/root/repo/ir/opt/opt_blocks.c" "CMakeFiles/firm.dir/ir/opt/opt_blocks.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/opt_blocks.c.o.d"
+  "/root/repo/ir/opt/opt_confirms.c" "CMakeFiles/firm.dir/ir/opt/opt_confirms.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/opt_confirms.c.o.d"
+  "/root/repo/ir/opt/opt_frame.c" "CMakeFiles/firm.dir/ir/opt/opt_frame.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/opt_frame.c.o.d"
+  "/root/repo/ir/opt/opt_inline.c" "CMakeFiles/firm.dir/ir/opt/opt_inline.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/opt_inline.c.o.d"
+  "/root/repo/ir/opt/opt_ldst.c" "CMakeFiles/firm.dir/ir/opt/opt_ldst.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/opt_ldst.c.o.d"
+  "/root/repo/ir/opt/opt_osr.c" "CMakeFiles/firm.dir/ir/opt/opt_osr.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/opt_osr.c.o.d"
+  "/root/repo/ir/opt/parallelize_mem.c" "CMakeFiles/firm.dir/ir/opt/parallelize_mem.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/parallelize_mem.c.o.d"
+  "/root/repo/ir/opt/proc_cloning.c" "CMakeFiles/firm.dir/ir/opt/proc_cloning.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/proc_cloning.c.o.d"
+  "/root/repo/ir/opt/purecallcse.c" "CMakeFiles/firm.dir/ir/opt/purecallcse.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/purecallcse.c.o.d"
+  "/root/repo/ir/opt/reassoc.c" "CMakeFiles/firm.dir/ir/opt/reassoc.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/reassoc.c.o.d"
+  "/root/repo/ir/opt/return.c" "CMakeFiles/firm.dir/ir/opt/return.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/return.c.o.d"
+  "/root/repo/ir/opt/scalar_replace.c" "CMakeFiles/firm.dir/ir/opt/scalar_replace.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/scalar_replace.c.o.d"
+  "/root/repo/ir/opt/tail_duplication.c" "CMakeFiles/firm.dir/ir/opt/tail_duplication.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/tail_duplication.c.o.d"
+  "/root/repo/ir/opt/tailrec.c" "CMakeFiles/firm.dir/ir/opt/tailrec.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/tailrec.c.o.d"
+  "/root/repo/ir/opt/write_only.c" "CMakeFiles/firm.dir/ir/opt/write_only.c.o" "gcc" "CMakeFiles/firm.dir/ir/opt/write_only.c.o.d"
+  "/root/repo/ir/stat/stat_timing.c" "CMakeFiles/firm.dir/ir/stat/stat_timing.c.o" "gcc" "CMakeFiles/firm.dir/ir/stat/stat_timing.c.o.d"
+  "/root/repo/ir/stat/statev.c" "CMakeFiles/firm.dir/ir/stat/statev.c.o" "gcc" "CMakeFiles/firm.dir/ir/stat/statev.c.o.d"
+  "/root/repo/ir/tr/entity.c" "CMakeFiles/firm.dir/ir/tr/entity.c.o" "gcc" "CMakeFiles/firm.dir/ir/tr/entity.c.o.d"
+  "/root/repo/ir/tr/tr_inheritance.c" "CMakeFiles/firm.dir/ir/tr/tr_inheritance.c.o" "gcc" "CMakeFiles/firm.dir/ir/tr/tr_inheritance.c.o.d"
+  "/root/repo/ir/tr/trverify.c" "CMakeFiles/firm.dir/ir/tr/trverify.c.o" "gcc" "CMakeFiles/firm.dir/ir/tr/trverify.c.o.d"
+  "/root/repo/ir/tr/type.c" "CMakeFiles/firm.dir/ir/tr/type.c.o" "gcc" "CMakeFiles/firm.dir/ir/tr/type.c.o.d"
+  "/root/repo/ir/tr/typewalk.c" "CMakeFiles/firm.dir/ir/tr/typewalk.c.o" "gcc" "CMakeFiles/firm.dir/ir/tr/typewalk.c.o.d"
+  "/root/repo/ir/tv/fltcalc.c" "CMakeFiles/firm.dir/ir/tv/fltcalc.c.o" "gcc" "CMakeFiles/firm.dir/ir/tv/fltcalc.c.o.d"
+  "/root/repo/ir/tv/strcalc.c" "CMakeFiles/firm.dir/ir/tv/strcalc.c.o" "gcc" "CMakeFiles/firm.dir/ir/tv/strcalc.c.o.d"
+  "/root/repo/ir/tv/tv.c" "CMakeFiles/firm.dir/ir/tv/tv.c.o" "gcc" "CMakeFiles/firm.dir/ir/tv/tv.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,658 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_emitter.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_emitter.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_new_nodes.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_regalloc_if.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/TEMPLATE/gen_TEMPLATE_regalloc_if.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_emitter.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_emitter.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_new_nodes.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_regalloc_if.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/amd64/gen_amd64_regalloc_if.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_emitter.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_emitter.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_new_nodes.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_regalloc_if.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/arm/gen_arm_regalloc_if.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_emitter.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_emitter.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_new_nodes.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_regalloc_if.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/ia32/gen_ia32_regalloc_if.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_emitter.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_emitter.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_new_nodes.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_regalloc_if.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/mips/gen_mips_regalloc_if.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_emitter.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_emitter.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_new_nodes.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_regalloc_if.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/riscv/gen_riscv_regalloc_if.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_emitter.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_emitter.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_new_nodes.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_regalloc_if.c.o"
+  "CMakeFiles/firm.dir/gen/ir/be/sparc/gen_sparc_regalloc_if.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/ir/gen_irio.c.o"
+  "CMakeFiles/firm.dir/gen/ir/ir/gen_irio.c.o.d"
+  "CMakeFiles/firm.dir/gen/ir/ir/gen_irnode.c.o"
+  "CMakeFiles/firm.dir/gen/ir/ir/gen_irnode.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/array.c.o"
+  "CMakeFiles/firm.dir/ir/adt/array.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/bipartite.c.o"
+  "CMakeFiles/firm.dir/ir/adt/bipartite.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/bitset.c.o"
+  "CMakeFiles/firm.dir/ir/adt/bitset.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/cpset.c.o"
+  "CMakeFiles/firm.dir/ir/adt/cpset.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/deq.c.o"
+  "CMakeFiles/firm.dir/ir/adt/deq.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/gaussjordan.c.o"
+  "CMakeFiles/firm.dir/ir/adt/gaussjordan.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/gaussseidel.c.o"
+  "CMakeFiles/firm.dir/ir/adt/gaussseidel.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/hungarian.c.o"
+  "CMakeFiles/firm.dir/ir/adt/hungarian.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/pmap.c.o"
+  "CMakeFiles/firm.dir/ir/adt/pmap.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/pmap_new.c.o"
+  "CMakeFiles/firm.dir/ir/adt/pmap_new.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/pqueue.c.o"
+  "CMakeFiles/firm.dir/ir/adt/pqueue.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/pset.c.o"
+  "CMakeFiles/firm.dir/ir/adt/pset.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/pset_new.c.o"
+  "CMakeFiles/firm.dir/ir/adt/pset_new.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/set.c.o"
+  "CMakeFiles/firm.dir/ir/adt/set.c.o.d"
+  "CMakeFiles/firm.dir/ir/adt/xmalloc.c.o"
+  "CMakeFiles/firm.dir/ir/adt/xmalloc.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/analyze_irg_args.c.o"
+  "CMakeFiles/firm.dir/ir/ana/analyze_irg_args.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/callgraph.c.o"
+  "CMakeFiles/firm.dir/ir/ana/callgraph.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/cdep.c.o"
+  "CMakeFiles/firm.dir/ir/ana/cdep.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/cgana.c.o"
+  "CMakeFiles/firm.dir/ir/ana/cgana.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/constbits.c.o"
+  "CMakeFiles/firm.dir/ir/ana/constbits.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/dca.c.o"
+  "CMakeFiles/firm.dir/ir/ana/dca.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/dfs.c.o"
+  "CMakeFiles/firm.dir/ir/ana/dfs.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/domfront.c.o"
+  "CMakeFiles/firm.dir/ir/ana/domfront.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/execfreq.c.o"
+  "CMakeFiles/firm.dir/ir/ana/execfreq.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/heights.c.o"
+  "CMakeFiles/firm.dir/ir/ana/heights.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/irbackedge.c.o"
+  "CMakeFiles/firm.dir/ir/ana/irbackedge.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/ircfscc.c.o"
+  "CMakeFiles/firm.dir/ir/ana/ircfscc.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/irconsconfirm.c.o"
+  "CMakeFiles/firm.dir/ir/ana/irconsconfirm.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/irdom.c.o"
+  "CMakeFiles/firm.dir/ir/ana/irdom.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/irlivechk.c.o"
+  "CMakeFiles/firm.dir/ir/ana/irlivechk.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/irloop.c.o"
+  "CMakeFiles/firm.dir/ir/ana/irloop.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/irmemory.c.o"
+  "CMakeFiles/firm.dir/ir/ana/irmemory.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/irouts.c.o"
+  "CMakeFiles/firm.dir/ir/ana/irouts.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/scalar_evolution.c.o"
+  "CMakeFiles/firm.dir/ir/ana/scalar_evolution.c.o.d"
+  "CMakeFiles/firm.dir/ir/ana/vrp.c.o"
+  "CMakeFiles/firm.dir/ir/ana/vrp.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_bearch.c.o"
+  "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_bearch.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_emitter.c.o"
+  "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_emitter.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_new_nodes.c.o"
+  "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_transform.c.o"
+  "CMakeFiles/firm.dir/ir/be/TEMPLATE/TEMPLATE_transform.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_abi.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_abi.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_bearch.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_bearch.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_cconv.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_cconv.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_emitter.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_emitter.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_finish.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_finish.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_lower128.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_lower128.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_new_nodes.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_optimize.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_optimize.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_pic.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_pic.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_transform.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_transform.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_varargs.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_varargs.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_x87.c.o"
+  "CMakeFiles/firm.dir/ir/be/amd64/amd64_x87.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_bearch.c.o"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_bearch.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_cconv.c.o"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_cconv.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_emitter.c.o"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_emitter.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_finish.c.o"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_finish.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_lower64.c.o"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_lower64.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_new_nodes.c.o"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_optimize.c.o"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_optimize.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_transform.c.o"
+  "CMakeFiles/firm.dir/ir/be/arm/arm_transform.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/be2addr.c.o"
+  "CMakeFiles/firm.dir/ir/be/be2addr.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bearch.c.o"
+  "CMakeFiles/firm.dir/ir/be/bearch.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beasm.c.o"
+  "CMakeFiles/firm.dir/ir/be/beasm.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beblocksched.c.o"
+  "CMakeFiles/firm.dir/ir/be/beblocksched.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bechordal.c.o"
+  "CMakeFiles/firm.dir/ir/be/bechordal.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bechordal_common.c.o"
+  "CMakeFiles/firm.dir/ir/be/bechordal_common.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bechordal_main.c.o"
+  "CMakeFiles/firm.dir/ir/be/bechordal_main.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/becopyheur4.c.o"
+  "CMakeFiles/firm.dir/ir/be/becopyheur4.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/becopyheur5.c.o"
+  "CMakeFiles/firm.dir/ir/be/becopyheur5.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/becopyilp.c.o"
+  "CMakeFiles/firm.dir/ir/be/becopyilp.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/becopyilp2.c.o"
+  "CMakeFiles/firm.dir/ir/be/becopyilp2.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/becopyopt.c.o"
+  "CMakeFiles/firm.dir/ir/be/becopyopt.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/becse.c.o"
+  "CMakeFiles/firm.dir/ir/be/becse.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bediagnostic.c.o"
+  "CMakeFiles/firm.dir/ir/be/bediagnostic.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bedump.c.o"
+  "CMakeFiles/firm.dir/ir/be/bedump.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bedwarf.c.o"
+  "CMakeFiles/firm.dir/ir/be/bedwarf.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beemithlp.c.o"
+  "CMakeFiles/firm.dir/ir/be/beemithlp.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beemitter.c.o"
+  "CMakeFiles/firm.dir/ir/be/beemitter.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beflags.c.o"
+  "CMakeFiles/firm.dir/ir/be/beflags.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/begnuas.c.o"
+  "CMakeFiles/firm.dir/ir/be/begnuas.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beifg.c.o"
+  "CMakeFiles/firm.dir/ir/be/beifg.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beinfo.c.o"
+  "CMakeFiles/firm.dir/ir/be/beinfo.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beinsn.c.o"
+  "CMakeFiles/firm.dir/ir/be/beinsn.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beirg.c.o"
+  "CMakeFiles/firm.dir/ir/be/beirg.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bejit.c.o"
+  "CMakeFiles/firm.dir/ir/be/bejit.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/belistsched.c.o"
+  "CMakeFiles/firm.dir/ir/be/belistsched.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/belive.c.o"
+  "CMakeFiles/firm.dir/ir/be/belive.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beloopana.c.o"
+  "CMakeFiles/firm.dir/ir/be/beloopana.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/belower.c.o"
+  "CMakeFiles/firm.dir/ir/be/belower.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bemain.c.o"
+  "CMakeFiles/firm.dir/ir/be/bemain.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bememfold.c.o"
+  "CMakeFiles/firm.dir/ir/be/bememfold.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bemodule.c.o"
+  "CMakeFiles/firm.dir/ir/be/bemodule.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/benode.c.o"
+  "CMakeFiles/firm.dir/ir/be/benode.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bepbqpcoloring.c.o"
+  "CMakeFiles/firm.dir/ir/be/bepbqpcoloring.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bepeephole.c.o"
+  "CMakeFiles/firm.dir/ir/be/bepeephole.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beprefalloc.c.o"
+  "CMakeFiles/firm.dir/ir/be/beprefalloc.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bera.c.o"
+  "CMakeFiles/firm.dir/ir/be/bera.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/besched.c.o"
+  "CMakeFiles/firm.dir/ir/be/besched.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beschedcp.c.o"
+  "CMakeFiles/firm.dir/ir/be/beschedcp.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beschednormal.c.o"
+  "CMakeFiles/firm.dir/ir/be/beschednormal.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beschedrand.c.o"
+  "CMakeFiles/firm.dir/ir/be/beschedrand.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beschedregpress.c.o"
+  "CMakeFiles/firm.dir/ir/be/beschedregpress.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beschedtrivial.c.o"
+  "CMakeFiles/firm.dir/ir/be/beschedtrivial.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bespill.c.o"
+  "CMakeFiles/firm.dir/ir/be/bespill.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bespillbelady.c.o"
+  "CMakeFiles/firm.dir/ir/be/bespillbelady.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bespilldaemel.c.o"
+  "CMakeFiles/firm.dir/ir/be/bespilldaemel.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bespillslots.c.o"
+  "CMakeFiles/firm.dir/ir/be/bespillslots.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bespillutil.c.o"
+  "CMakeFiles/firm.dir/ir/be/bespillutil.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bessaconstr.c.o"
+  "CMakeFiles/firm.dir/ir/be/bessaconstr.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bessadestr.c.o"
+  "CMakeFiles/firm.dir/ir/be/bessadestr.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bestack.c.o"
+  "CMakeFiles/firm.dir/ir/be/bestack.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bestat.c.o"
+  "CMakeFiles/firm.dir/ir/be/bestat.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bestate.c.o"
+  "CMakeFiles/firm.dir/ir/be/bestate.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/betranshlp.c.o"
+  "CMakeFiles/firm.dir/ir/be/betranshlp.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beuses.c.o"
+  "CMakeFiles/firm.dir/ir/be/beuses.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beutil.c.o"
+  "CMakeFiles/firm.dir/ir/be/beutil.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/bevarargs.c.o"
+  "CMakeFiles/firm.dir/ir/be/bevarargs.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/beverify.c.o"
+  "CMakeFiles/firm.dir/ir/be/beverify.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_architecture.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_architecture.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_bearch.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_bearch.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_cconv.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_cconv.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_emitter.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_emitter.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_encode.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_encode.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_finish.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_finish.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_fpu.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_fpu.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_intrinsics.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_intrinsics.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_new_nodes.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_optimize.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_optimize.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_pic.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_pic.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_transform.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/ia32_transform.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_address_mode.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_address_mode.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_asm.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_asm.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_cconv.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_cconv.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_node.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_node.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_x87.c.o"
+  "CMakeFiles/firm.dir/ir/be/ia32/x86_x87.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/machine_triple.c.o"
+  "CMakeFiles/firm.dir/ir/be/machine_triple.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_bearch.c.o"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_bearch.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_cconv.c.o"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_cconv.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_emitter.c.o"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_emitter.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_lower64.c.o"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_lower64.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_new_nodes.c.o"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_nodes_attr.c.o"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_nodes_attr.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_transform.c.o"
+  "CMakeFiles/firm.dir/ir/be/mips/mips_transform.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/platform.c.o"
+  "CMakeFiles/firm.dir/ir/be/platform.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_abi.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_abi.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_bearch.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_bearch.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_cconv.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_cconv.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_emitter.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_emitter.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_finish.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_finish.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_lower64.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_lower64.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_new_nodes.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_nodes_attr.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_nodes_attr.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_transform.c.o"
+  "CMakeFiles/firm.dir/ir/be/riscv/riscv_transform.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_bearch.c.o"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_bearch.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_cconv.c.o"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_cconv.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_emitter.c.o"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_emitter.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_finish.c.o"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_finish.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_lower64.c.o"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_lower64.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_new_nodes.c.o"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_new_nodes.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_stackframe.c.o"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_stackframe.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_transform.c.o"
+  "CMakeFiles/firm.dir/ir/be/sparc/sparc_transform.c.o.d"
+  "CMakeFiles/firm.dir/ir/be/target.c.o"
+  "CMakeFiles/firm.dir/ir/be/target.c.o.d"
+  "CMakeFiles/firm.dir/ir/common/debug.c.o"
+  "CMakeFiles/firm.dir/ir/common/debug.c.o.d"
+  "CMakeFiles/firm.dir/ir/common/debugger.c.o"
+  "CMakeFiles/firm.dir/ir/common/debugger.c.o.d"
+  "CMakeFiles/firm.dir/ir/common/firm.c.o"
+  "CMakeFiles/firm.dir/ir/common/firm.c.o.d"
+  "CMakeFiles/firm.dir/ir/common/firm_common.c.o"
+  "CMakeFiles/firm.dir/ir/common/firm_common.c.o.d"
+  "CMakeFiles/firm.dir/ir/common/memstat.c.o"
+  "CMakeFiles/firm.dir/ir/common/memstat.c.o.d"
+  "CMakeFiles/firm.dir/ir/common/panic.c.o"
+  "CMakeFiles/firm.dir/ir/common/panic.c.o.d"
+  "CMakeFiles/firm.dir/ir/common/timing.c.o"
+  "CMakeFiles/firm.dir/ir/common/timing.c.o.d"
+  "CMakeFiles/firm.dir/ir/ident/ident.c.o"
+  "CMakeFiles/firm.dir/ir/ident/ident.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/dbginfo.c.o"
+  "CMakeFiles/firm.dir/ir/ir/dbginfo.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irarch.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irarch.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irargs.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irargs.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/ircache.c.o"
+  "CMakeFiles/firm.dir/ir/ir/ircache.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/ircons.c.o"
+  "CMakeFiles/firm.dir/ir/ir/ircons.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irdump.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irdump.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irdumptxt.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irdumptxt.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/iredges.c.o"
+  "CMakeFiles/firm.dir/ir/ir/iredges.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irflag.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irflag.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irgmod.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irgmod.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irgraph.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irgraph.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irgwalk.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irgwalk.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irgwalk_blk.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irgwalk_blk.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irhooks.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irhooks.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/iridentityset.c.o"
+  "CMakeFiles/firm.dir/ir/ir/iridentityset.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irio.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irio.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irmode.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irmode.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irnode.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irnode.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irnodehashmap.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irnodehashmap.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irnodeset.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irnodeset.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irop.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irop.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irprintf.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irprintf.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irprofile.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irprofile.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irprog.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irprog.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irssacons.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irssacons.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irtools.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irtools.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/irverify.c.o"
+  "CMakeFiles/firm.dir/ir/ir/irverify.c.o.d"
+  "CMakeFiles/firm.dir/ir/ir/valueset.c.o"
+  "CMakeFiles/firm.dir/ir/ir/valueset.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/brute_force.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/brute_force.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/bucket.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/bucket.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/heuristical.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/heuristical.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/heuristical_co.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/heuristical_co.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/heuristical_co_ld.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/heuristical_co_ld.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/html_dumper.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/html_dumper.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/kaps.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/kaps.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/matrix.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/matrix.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/optimal.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/optimal.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/pbqp_edge.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/pbqp_edge.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/pbqp_node.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/pbqp_node.c.o.d"
+  "CMakeFiles/firm.dir/ir/kaps/vector.c.o"
+  "CMakeFiles/firm.dir/ir/kaps/vector.c.o.d"
+  "CMakeFiles/firm.dir/ir/libcore/lc_appendable.c.o"
+  "CMakeFiles/firm.dir/ir/libcore/lc_appendable.c.o.d"
+  "CMakeFiles/firm.dir/ir/libcore/lc_opts.c.o"
+  "CMakeFiles/firm.dir/ir/libcore/lc_opts.c.o.d"
+  "CMakeFiles/firm.dir/ir/libcore/lc_opts_enum.c.o"
+  "CMakeFiles/firm.dir/ir/libcore/lc_opts_enum.c.o.d"
+  "CMakeFiles/firm.dir/ir/libcore/lc_printf.c.o"
+  "CMakeFiles/firm.dir/ir/libcore/lc_printf.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_alloc.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_alloc.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_builtins.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_builtins.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_calls.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_calls.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_copyb.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_copyb.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_dw.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_dw.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_hl.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_hl.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_intrinsics.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_intrinsics.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_mode_b.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_mode_b.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_mux.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_mux.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_softfloat.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_softfloat.c.o.d"
+  "CMakeFiles/firm.dir/ir/lower/lower_switch.c.o"
+  "CMakeFiles/firm.dir/ir/lower/lower_switch.c.o.d"
+  "CMakeFiles/firm.dir/ir/lpp/lpp.c.o"
+  "CMakeFiles/firm.dir/ir/lpp/lpp.c.o.d"
+  "CMakeFiles/firm.dir/ir/lpp/lpp_cplex.c.o"
+  "CMakeFiles/firm.dir/ir/lpp/lpp_cplex.c.o.d"
+  "CMakeFiles/firm.dir/ir/lpp/lpp_gurobi.c.o"
+  "CMakeFiles/firm.dir/ir/lpp/lpp_gurobi.c.o.d"
+  "CMakeFiles/firm.dir/ir/lpp/lpp_solvers.c.o"
+  "CMakeFiles/firm.dir/ir/lpp/lpp_solvers.c.o.d"
+  "CMakeFiles/firm.dir/ir/lpp/mps.c.o"
+  "CMakeFiles/firm.dir/ir/lpp/mps.c.o.d"
+  "CMakeFiles/firm.dir/ir/lpp/sp_matrix.c.o"
+  "CMakeFiles/firm.dir/ir/lpp/sp_matrix.c.o.d"
+  "CMakeFiles/firm.dir/ir/obstack/obstack.c.o"
+  "CMakeFiles/firm.dir/ir/obstack/obstack.c.o.d"
+  "CMakeFiles/firm.dir/ir/obstack/obstack_printf.c.o"
+  "CMakeFiles/firm.dir/ir/obstack/obstack_printf.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/boolopt.c.o"
+  "CMakeFiles/firm.dir/ir/opt/boolopt.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/boundscheck.c.o"
+  "CMakeFiles/firm.dir/ir/opt/boundscheck.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/cfopt.c.o"
+  "CMakeFiles/firm.dir/ir/opt/cfopt.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/cleanup.c.o"
+  "CMakeFiles/firm.dir/ir/opt/cleanup.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/code_placement.c.o"
+  "CMakeFiles/firm.dir/ir/opt/code_placement.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/combo.c.o"
+  "CMakeFiles/firm.dir/ir/opt/combo.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/convopt.c.o"
+  "CMakeFiles/firm.dir/ir/opt/convopt.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/critical_edges.c.o"
+  "CMakeFiles/firm.dir/ir/opt/critical_edges.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/dead_code_elimination.c.o"
+  "CMakeFiles/firm.dir/ir/opt/dead_code_elimination.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/devirt.c.o"
+  "CMakeFiles/firm.dir/ir/opt/devirt.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/escape_ana.c.o"
+  "CMakeFiles/firm.dir/ir/opt/escape_ana.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/funccall.c.o"
+  "CMakeFiles/firm.dir/ir/opt/funccall.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/garbage_collect.c.o"
+  "CMakeFiles/firm.dir/ir/opt/garbage_collect.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/gvn_pre.c.o"
+  "CMakeFiles/firm.dir/ir/opt/gvn_pre.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/icf.c.o"
+  "CMakeFiles/firm.dir/ir/opt/icf.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/ifconv.c.o"
+  "CMakeFiles/firm.dir/ir/opt/ifconv.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/instrument.c.o"
+  "CMakeFiles/firm.dir/ir/opt/instrument.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/ipcp.c.o"
+  "CMakeFiles/firm.dir/ir/opt/ipcp.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/ircgopt.c.o"
+  "CMakeFiles/firm.dir/ir/opt/ircgopt.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/ircomplib.c.o"
+  "CMakeFiles/firm.dir/ir/opt/ircomplib.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/irgopt.c.o"
+  "CMakeFiles/firm.dir/ir/opt/irgopt.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/iropt.c.o"
+  "CMakeFiles/firm.dir/ir/opt/iropt.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/jumpthreading.c.o"
+  "CMakeFiles/firm.dir/ir/opt/jumpthreading.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/lcssa.c.o"
+  "CMakeFiles/firm.dir/ir/opt/lcssa.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/ldstopt.c.o"
+  "CMakeFiles/firm.dir/ir/opt/ldstopt.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/licm.c.o"
+  "CMakeFiles/firm.dir/ir/opt/licm.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/loop.c.o"
+  "CMakeFiles/firm.dir/ir/opt/loop.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/loop_unrolling.c.o"
+  "CMakeFiles/firm.dir/ir/opt/loop_unrolling.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/loopidiom.c.o"
+  "CMakeFiles/firm.dir/ir/opt/loopidiom.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/merge_mem.c.o"
+  "CMakeFiles/firm.dir/ir/opt/merge_mem.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/occult_const.c.o"
+  "CMakeFiles/firm.dir/ir/opt/occult_const.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/opt_blocks.c.o"
+  "CMakeFiles/firm.dir/ir/opt/opt_blocks.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/opt_confirms.c.o"
+  "CMakeFiles/firm.dir/ir/opt/opt_confirms.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/opt_frame.c.o"
+  "CMakeFiles/firm.dir/ir/opt/opt_frame.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/opt_inline.c.o"
+  "CMakeFiles/firm.dir/ir/opt/opt_inline.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/opt_ldst.c.o"
+  "CMakeFiles/firm.dir/ir/opt/opt_ldst.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/opt_osr.c.o"
+  "CMakeFiles/firm.dir/ir/opt/opt_osr.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/parallelize_mem.c.o"
+  "CMakeFiles/firm.dir/ir/opt/parallelize_mem.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/proc_cloning.c.o"
+  "CMakeFiles/firm.dir/ir/opt/proc_cloning.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/purecallcse.c.o"
+  "CMakeFiles/firm.dir/ir/opt/purecallcse.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/reassoc.c.o"
+  "CMakeFiles/firm.dir/ir/opt/reassoc.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/return.c.o"
+  "CMakeFiles/firm.dir/ir/opt/return.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/scalar_replace.c.o"
+  "CMakeFiles/firm.dir/ir/opt/scalar_replace.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/tail_duplication.c.o"
+  "CMakeFiles/firm.dir/ir/opt/tail_duplication.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/tailrec.c.o"
+  "CMakeFiles/firm.dir/ir/opt/tailrec.c.o.d"
+  "CMakeFiles/firm.dir/ir/opt/write_only.c.o"
+  "CMakeFiles/firm.dir/ir/opt/write_only.c.o.d"
+  "CMakeFiles/firm.dir/ir/stat/stat_timing.c.o"
+  "CMakeFiles/firm.dir/ir/stat/stat_timing.c.o.d"
+  "CMakeFiles/firm.dir/ir/stat/statev.c.o"
+  "CMakeFiles/firm.dir/ir/stat/statev.c.o.d"
+  "CMakeFiles/firm.dir/ir/tr/entity.c.o"
+  "CMakeFiles/firm.dir/ir/tr/entity.c.o.d"
+  "CMakeFiles/firm.dir/ir/tr/tr_inheritance.c.o"
+  "CMakeFiles/firm.dir/ir/tr/tr_inheritance.c.o.d"
+  "CMakeFiles/firm.dir/ir/tr/trverify.c.o"
+  "CMakeFiles/firm.dir/ir/tr/trverify.c.o.d"
+  "CMakeFiles/firm.dir/ir/tr/type.c.o"
+  "CMakeFiles/firm.dir/ir/tr/type.c.o.d"
+  "CMakeFiles/firm.dir/ir/tr/typewalk.c.o"
+  "CMakeFiles/firm.dir/ir/tr/typewalk.c.o.d"
+  "CMakeFiles/firm.dir/ir/tv/fltcalc.c.o"
+  "CMakeFiles/firm.dir/ir/tv/fltcalc.c.o.d"
+  "CMakeFiles/firm.dir/ir/tv/strcalc.c.o"
+  "CMakeFiles/firm.dir/ir/tv/strcalc.c.o.d"
+  "CMakeFiles/firm.dir/ir/tv/tv.c.o"
+  "CMakeFiles/firm.dir/ir/tv/tv.c.o.d"
+  "firm_revision.h"
+  "gen/include/libfirm/nodes.h"
+  "gen/ir/be/TEMPLATE/gen_TEMPLATE_emitter.c"
+  "gen/ir/be/TEMPLATE/gen_TEMPLATE_new_nodes.c"
+  "gen/ir/be/TEMPLATE/gen_TEMPLATE_regalloc_if.c"
+  "gen/ir/be/amd64/gen_amd64_emitter.c"
+  "gen/ir/be/amd64/gen_amd64_new_nodes.c"
+  "gen/ir/be/amd64/gen_amd64_regalloc_if.c"
+  "gen/ir/be/arm/gen_arm_emitter.c"
+  "gen/ir/be/arm/gen_arm_new_nodes.c"
+  "gen/ir/be/arm/gen_arm_regalloc_if.c"
+  "gen/ir/be/ia32/gen_ia32_emitter.c"
+  "gen/ir/be/ia32/gen_ia32_new_nodes.c"
+  "gen/ir/be/ia32/gen_ia32_regalloc_if.c"
+  "gen/ir/be/mips/gen_mips_emitter.c"
+  "gen/ir/be/mips/gen_mips_new_nodes.c"
+  "gen/ir/be/mips/gen_mips_regalloc_if.c"
+  "gen/ir/be/riscv/gen_riscv_emitter.c"
+  "gen/ir/be/riscv/gen_riscv_new_nodes.c"
+  "gen/ir/be/riscv/gen_riscv_regalloc_if.c"
+  "gen/ir/be/sparc/gen_sparc_emitter.c"
+  "gen/ir/be/sparc/gen_sparc_new_nodes.c"
+  "gen/ir/be/sparc/gen_sparc_regalloc_if.c"
+  "gen/ir/ir/gen_irio.c"
+  "gen/ir/ir/gen_irnode.c"
+  "gen/ir/ir/gen_irnode.h"
+  "gen/ir/ir/gen_proj_names.h"
+  "libfirm.a"
+  "libfirm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/firm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
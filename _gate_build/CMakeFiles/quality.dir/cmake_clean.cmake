@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/quality.dir/bench/quality.c.o"
+  "CMakeFiles/quality.dir/bench/quality.c.o.d"
+  "quality"
+  "quality.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/quality.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
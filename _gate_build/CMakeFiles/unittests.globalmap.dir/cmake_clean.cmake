@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.globalmap.dir/unittests/globalmap.c.o"
+  "CMakeFiles/unittests.globalmap.dir/unittests/globalmap.c.o.d"
+  "unittests.globalmap"
+  "unittests.globalmap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.globalmap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
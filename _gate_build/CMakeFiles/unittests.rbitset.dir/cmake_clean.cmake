@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.rbitset.dir/unittests/rbitset.c.o"
+  "CMakeFiles/unittests.rbitset.dir/unittests/rbitset.c.o.d"
+  "unittests.rbitset"
+  "unittests.rbitset.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.rbitset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
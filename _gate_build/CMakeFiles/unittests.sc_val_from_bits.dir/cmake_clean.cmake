@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.sc_val_from_bits.dir/unittests/sc_val_from_bits.c.o"
+  "CMakeFiles/unittests.sc_val_from_bits.dir/unittests/sc_val_from_bits.c.o.d"
+  "unittests.sc_val_from_bits"
+  "unittests.sc_val_from_bits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.sc_val_from_bits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.tarval_is_long.dir/unittests/tarval_is_long.c.o"
+  "CMakeFiles/unittests.tarval_is_long.dir/unittests/tarval_is_long.c.o.d"
+  "unittests.tarval_is_long"
+  "unittests.tarval_is_long.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.tarval_is_long.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test-unittests.deq "unittests.deq")
+set_tests_properties(test-unittests.deq PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.globalmap "unittests.globalmap")
+set_tests_properties(test-unittests.globalmap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.nan_payload "unittests.nan_payload")
+set_tests_properties(test-unittests.nan_payload PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.rbitset "unittests.rbitset")
+set_tests_properties(test-unittests.rbitset PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.sc_val_from_bits "unittests.sc_val_from_bits")
+set_tests_properties(test-unittests.sc_val_from_bits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.snprintf "unittests.snprintf")
+set_tests_properties(test-unittests.snprintf PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.strcalc "unittests.strcalc")
+set_tests_properties(test-unittests.strcalc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_calc "unittests.tarval_calc")
+set_tests_properties(test-unittests.tarval_calc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_float "unittests.tarval_float")
+set_tests_properties(test-unittests.tarval_float PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_floatops "unittests.tarval_floatops")
+set_tests_properties(test-unittests.tarval_floatops PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_from_to "unittests.tarval_from_to")
+set_tests_properties(test-unittests.tarval_from_to PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_is_long "unittests.tarval_is_long")
+set_tests_properties(test-unittests.tarval_is_long PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;495;add_test;/root/repo/CMakeLists.txt;0;")
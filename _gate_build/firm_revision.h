@@ -0,0 +1 @@
+#define libfirm_VERSION_REVISION "b68e4c05de60a263db0206061c816626c1205284"
@@ -0,0 +1,15 @@
+/**
+ * @file
+ * @brief Function prototypes for the emitter functions.
+ * @note  DO NOT EDIT THIS FILE, your changes will be lost.
+ *         Edit /root/repo/ir/be/amd64/amd64_spec.pl instead.
+ *         created by: /root/repo/ir/be/scripts/generate_emitter.pl /root/repo/ir/be/amd64/amd64_spec.pl /root/repo/_gate_build/gen/ir/be/amd64
+ * @date  Tue Sep  1 11:15:19 2026
+ */
+#ifndef FIRM_BE_AMD64_GEN_AMD64_EMITTER_H
+#define FIRM_BE_AMD64_GEN_AMD64_EMITTER_H
+
+void amd64_register_spec_emitters(void);
+void amd64_register_spec_binary_emitters(void);
+
+#endif
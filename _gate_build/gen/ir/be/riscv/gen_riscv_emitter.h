@@ -0,0 +1,15 @@
+/**
+ * @file
+ * @brief Function prototypes for the emitter functions.
+ * @note  DO NOT EDIT THIS FILE, your changes will be lost.
+ *         Edit /root/repo/ir/be/riscv/riscv_spec.pl instead.
+ *         created by: /root/repo/ir/be/scripts/generate_emitter.pl /root/repo/ir/be/riscv/riscv_spec.pl /root/repo/_gate_build/gen/ir/be/riscv
+ * @date  Tue Sep  1 02:13:18 2026
+ */
+#ifndef FIRM_BE_RISCV_GEN_RISCV_EMITTER_H
+#define FIRM_BE_RISCV_GEN_RISCV_EMITTER_H
+
+void riscv_register_spec_emitters(void);
+void riscv_register_spec_binary_emitters(void);
+
+#endif
@@ -0,0 +1,15 @@
+/**
+ * @file
+ * @brief Function prototypes for the emitter functions.
+ * @note  DO NOT EDIT THIS FILE, your changes will be lost.
+ *         Edit /root/repo/ir/be/sparc/sparc_spec.pl instead.
+ *         created by: /root/repo/ir/be/scripts/generate_emitter.pl /root/repo/ir/be/sparc/sparc_spec.pl /root/repo/_gate_build/gen/ir/be/sparc
+ * @date  Tue Sep  1 02:13:18 2026
+ */
+#ifndef FIRM_BE_SPARC_GEN_SPARC_EMITTER_H
+#define FIRM_BE_SPARC_GEN_SPARC_EMITTER_H
+
+void sparc_register_spec_emitters(void);
+void sparc_register_spec_binary_emitters(void);
+
+#endif
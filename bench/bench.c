@@ -0,0 +1,242 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief  Compile-time benchmark driver.
+ *
+ * Imports a corpus of .ir files, runs a configurable list of middle-end
+ * passes over every graph and reports per-pass wall-clock times through
+ * the statev framework.  Intended to catch compile-time regressions:
+ *
+ *   bench -p localopt,controlflow,loadstore corpus/
+ *
+ * produces bench.ev with one timing event per (file, pass) pair plus
+ * per-pass totals over the whole corpus.
+ */
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <firm.h>
+#include <statev.h>
+
+#include "util.h"
+
+typedef void (*pass_func)(ir_graph *irg);
+
+typedef struct pass_t {
+	const char *name;
+	pass_func   func;
+} pass_t;
+
+static void run_local_opts(ir_graph *irg)
+{
+	local_optimize_graph(irg);
+}
+
+static const pass_t passes[] = {
+	{ "localopt",       run_local_opts          },
+	{ "controlflow",    optimize_cf             },
+	{ "jumpthreading",  opt_jumpthreading       },
+	{ "tailduplication",opt_tail_duplication    },
+	{ "loadstore",      optimize_load_store     },
+	{ "memcombine",     combine_memops          },
+	{ "parallelizemem", opt_parallelize_mem     },
+	{ "mergemem",       opt_merge_mem           },
+	{ "gvnpre",         do_gvn_pre              },
+	{ "scalarreplace",  scalar_replacement_opt  },
+	{ "escape",         opt_escape_analysis     },
+	{ "reassociation",  optimize_reassociation  },
+	{ "bool",           opt_bool                },
+	{ "convopt",        conv_opt                },
+	{ "ifconv",         opt_if_conv             },
+	{ "licm",           opt_licm                },
+	{ "loopinversion",  do_loop_inversion       },
+	{ "loopunrolling",  do_loop_unrolling       },
+	{ "deconv",         remove_phi_cycles       },
+	{ "occultconsts",   occult_consts           },
+	{ "combo",          combo                   },
+	{ "frame",          opt_frame_irg           },
+	{ "tailrec",        opt_tail_rec_irg        },
+	{ "shapeblocks",    shape_blocks            },
+	{ "deadcode",       dead_node_elimination   },
+	{ "placecode",      place_code              },
+};
+
+/** The default list roughly mirrors the -O2 middle-end pipeline. */
+static const char *default_pass_list
+	= "localopt,controlflow,loadstore,gvnpre,localopt,controlflow";
+
+static const pass_t *find_pass(const char *name, size_t len)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(passes); ++i) {
+		if (strncmp(passes[i].name, name, len) == 0
+		    && passes[i].name[len] == '\0')
+			return &passes[i];
+	}
+	return NULL;
+}
+
+/** The selected schedule: pointers into the passes table. */
+static const pass_t **schedule;
+static size_t         n_schedule;
+/** One accumulating timer per schedule entry, over the whole corpus. */
+static ir_timer_t   **total_timers;
+
+static bool parse_pass_list(const char *list)
+{
+	size_t n = 1;
+	for (const char *c = list; *c != '\0'; ++c) {
+		if (*c == ',')
+			++n;
+	}
+	schedule     = calloc(n, sizeof(schedule[0]));
+	total_timers = calloc(n, sizeof(total_timers[0]));
+	n_schedule   = 0;
+
+	for (const char *c = list; *c != '\0';) {
+		size_t len = strcspn(c, ",");
+		const pass_t *pass = find_pass(c, len);
+		if (pass == NULL) {
+			fprintf(stderr, "bench: unknown pass '%.*s'\n", (int)len, c);
+			return false;
+		}
+		total_timers[n_schedule] = ir_timer_new();
+		schedule[n_schedule++]   = pass;
+		c += len;
+		if (*c == ',')
+			++c;
+	}
+	return true;
+}
+
+static void list_passes(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(passes); ++i) {
+		printf("%s\n", passes[i].name);
+	}
+}
+
+static bool bench_file(const char *filename)
+{
+	size_t first_irg = get_irp_n_irgs();
+	if (ir_import(filename) != 0) {
+		fprintf(stderr, "bench: could not import '%s'\n", filename);
+		return false;
+	}
+	size_t n_irgs = get_irp_n_irgs();
+
+	stat_ev_ctx_push_str("bench_file", filename);
+	stat_ev_int("bench_irgs", (int)(n_irgs - first_irg));
+
+	for (size_t p = 0; p < n_schedule; ++p) {
+		ir_timer_t *timer = ir_timer_new();
+		for (size_t i = first_irg; i < n_irgs; ++i) {
+			ir_graph *irg = get_irp_irg(i);
+			ir_timer_start(timer);
+			ir_timer_start(total_timers[p]);
+			schedule[p]->func(irg);
+			ir_timer_stop(total_timers[p]);
+			ir_timer_stop(timer);
+		}
+		stat_ev_ctx_push_fmt("bench_pass", "%u_%s", (unsigned)p,
+		                     schedule[p]->name);
+		stat_ev_ull("bench_usec", ir_timer_elapsed_usec(timer));
+		stat_ev_ctx_pop("bench_pass");
+		ir_timer_free(timer);
+	}
+
+	stat_ev_ctx_pop("bench_file");
+	return true;
+}
+
+static bool bench_path(const char *path)
+{
+	struct stat st;
+	if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+		DIR *dir = opendir(path);
+		if (dir == NULL) {
+			fprintf(stderr, "bench: could not open directory '%s'\n", path);
+			return false;
+		}
+		bool ok = true;
+		for (struct dirent *entry; (entry = readdir(dir)) != NULL;) {
+			const char *dot = strrchr(entry->d_name, '.');
+			if (dot == NULL || strcmp(dot, ".ir") != 0)
+				continue;
+			char buf[4096];
+			snprintf(buf, sizeof(buf), "%s/%s", path, entry->d_name);
+			ok &= bench_file(buf);
+		}
+		closedir(dir);
+		return ok;
+	}
+	return bench_file(path);
+}
+
+static void usage(const char *progname)
+{
+	fprintf(stderr,
+	        "usage: %s [-p pass,pass,...] [-s statev-prefix] [-l] "
+	        "<file.ir|directory>...\n", progname);
+}
+
+int main(int argc, char **argv)
+{
+	const char *pass_list     = default_pass_list;
+	const char *statev_prefix = "bench";
+	int         first_input   = argc;
+
+	int i = 1;
+	for (; i < argc; ++i) {
+		if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+			pass_list = argv[++i];
+		} else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+			statev_prefix = argv[++i];
+		} else if (strcmp(argv[i], "-l") == 0) {
+			list_passes();
+			return EXIT_SUCCESS;
+		} else if (strcmp(argv[i], "--help") == 0) {
+			usage(argv[0]);
+			return EXIT_SUCCESS;
+		} else {
+			break;
+		}
+	}
+	first_input = i;
+	if (first_input >= argc) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	ir_init();
+	if (!parse_pass_list(pass_list))
+		return EXIT_FAILURE;
+
+	stat_ev_begin(statev_prefix, NULL);
+
+	bool ok = true;
+	for (i = first_input; i < argc; ++i) {
+		ok &= bench_path(argv[i]);
+	}
+
+	/* per-pass totals over the whole corpus */
+	stat_ev_ctx_push_str("bench_file", "<total>");
+	for (size_t p = 0; p < n_schedule; ++p) {
+		stat_ev_ctx_push_fmt("bench_pass", "%u_%s", (unsigned)p,
+		                     schedule[p]->name);
+		stat_ev_ull("bench_usec", ir_timer_elapsed_usec(total_timers[p]));
+		stat_ev_ctx_pop("bench_pass");
+	}
+	stat_ev_ctx_pop("bench_file");
+
+	stat_ev_end();
+	ir_finish();
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,238 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief  Microbenchmarks for ADT and tarval kernels.
+ *
+ * Times small lookup-insert mixes and folding kernels with the cycle
+ * counter from stat_timing.h (rdtsc on x86, microseconds elsewhere).
+ * Every benchmark runs a few warmup rounds, then a series of samples;
+ * the slowest and fastest quarter of the samples are rejected and the
+ * middle half averaged, so scheduling noise does not end up in the
+ * numbers. The results are emitted as JSON on stdout for tracking
+ * over time:
+ *
+ *   microbench > adt-timings.json
+ */
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <firm.h>
+
+#include "fltcalc.h"
+#include "obst.h"
+#include "pmap.h"
+#include "pset.h"
+#include "pset_new.h"
+#include "raw_bitset.h"
+#include "stat_timing.h"
+#include "strcalc.h"
+#include "util.h"
+#include "xmalloc.h"
+
+#define N_WARMUP   3
+#define N_SAMPLES  16
+#define N_KEYS     4096
+
+/** Global sink defeating dead code elimination of the kernels. */
+static volatile uint64_t bench_sink;
+
+static char keys[N_KEYS];
+
+static void bench_pset(size_t n)
+{
+	pset *set = pset_new_ptr(64);
+	uint64_t sink = 0;
+	for (size_t i = 0; i < n; ++i) {
+		pset_insert_ptr(set, &keys[i % N_KEYS]);
+		sink += (uintptr_t)pset_find_ptr(set, &keys[(i * 7) % N_KEYS]);
+	}
+	del_pset(set);
+	bench_sink += sink;
+}
+
+static void bench_pset_new(size_t n)
+{
+	pset_new_t set;
+	pset_new_init(&set);
+	uint64_t sink = 0;
+	for (size_t i = 0; i < n; ++i) {
+		pset_new_insert(&set, &keys[i % N_KEYS]);
+		sink += pset_new_contains(&set, &keys[(i * 7) % N_KEYS]);
+	}
+	pset_new_destroy(&set);
+	bench_sink += sink;
+}
+
+static void bench_pmap(size_t n)
+{
+	pmap *map = pmap_create();
+	uint64_t sink = 0;
+	for (size_t i = 0; i < n; ++i) {
+		pmap_insert(map, &keys[i % N_KEYS], &keys[0]);
+		sink += (uintptr_t)pmap_get(char, map, &keys[(i * 7) % N_KEYS]);
+	}
+	pmap_destroy(map);
+	bench_sink += sink;
+}
+
+static void bench_rbitset(size_t n)
+{
+	unsigned *bitset = rbitset_malloc(N_KEYS);
+	uint64_t  sink   = 0;
+	for (size_t i = 0; i < n; ++i) {
+		rbitset_set(bitset, i % N_KEYS);
+		sink += rbitset_is_set(bitset, (i * 13) % N_KEYS);
+		if ((i & 255) == 255)
+			sink += rbitset_popcount(bitset, N_KEYS);
+	}
+	free(bitset);
+	bench_sink += sink;
+}
+
+static void bench_sc_add(size_t n)
+{
+	unsigned const buflen = sc_get_value_length();
+	sc_word *vals[3] = {
+		XMALLOCN(sc_word, buflen),
+		XMALLOCN(sc_word, buflen),
+		XMALLOCN(sc_word, buflen),
+	};
+	sc_val_from_long(0x0f0f0f0f, vals[0]);
+	sc_val_from_long(0x12345678, vals[1]);
+	for (size_t i = 0; i < n; ++i) {
+		sc_add(vals[0], vals[1], vals[2]);
+		sc_word *tmp = vals[0];
+		vals[0] = vals[1];
+		vals[1] = vals[2];
+		vals[2] = tmp;
+	}
+	bench_sink += (uint64_t)sc_val_to_long(vals[1]);
+	for (int i = 0; i < 3; ++i)
+		free(vals[i]);
+}
+
+static void bench_fc_mul(size_t n)
+{
+	size_t const size = fc_get_value_size();
+	fp_value *vals[3] = {
+		(fp_value*)xmalloc(size),
+		(fp_value*)xmalloc(size),
+		(fp_value*)xmalloc(size),
+	};
+	/* values close to one keep the product finite over many rounds */
+	fc_val_from_ieee754(1.0000001L, vals[0]);
+	fc_val_from_ieee754(0.9999999L, vals[1]);
+	for (size_t i = 0; i < n; ++i) {
+		fc_mul(vals[0], vals[1], vals[2]);
+		fp_value *tmp = vals[0];
+		vals[0] = vals[1];
+		vals[1] = vals[2];
+		vals[2] = tmp;
+	}
+	bench_sink += (uint64_t)fc_get_exponent(vals[1]);
+	for (int i = 0; i < 3; ++i)
+		free(vals[i]);
+}
+
+static void bench_ident(size_t n)
+{
+	static char names[1024][16];
+	if (names[0][0] == '\0') {
+		for (unsigned i = 0; i < 1024; ++i)
+			snprintf(names[i], sizeof(names[i]), "bench_id%u", i);
+	}
+	uint64_t sink = 0;
+	for (size_t i = 0; i < n; ++i)
+		sink += (uintptr_t)new_id_from_str(names[i % 1024]);
+	bench_sink += sink;
+}
+
+static void bench_obstack(size_t n)
+{
+	struct obstack obst;
+	obstack_init(&obst);
+	uint64_t sink = 0;
+	for (size_t i = 0; i < n; ++i) {
+		sink += (uintptr_t)obstack_alloc(&obst, 16 + (i & 63));
+		if ((i & 1023) == 1023) {
+			obstack_free(&obst, NULL);
+			obstack_init(&obst);
+		}
+	}
+	obstack_free(&obst, NULL);
+	bench_sink += sink;
+}
+
+typedef struct benchmark_t {
+	const char *name;
+	void      (*func)(size_t n);
+	size_t      n_ops;
+} benchmark_t;
+
+static const benchmark_t benchmarks[] = {
+	{ "pset_mixed",     bench_pset,     200000 },
+	{ "pset_new_mixed", bench_pset_new, 200000 },
+	{ "pmap_mixed",     bench_pmap,     200000 },
+	{ "rbitset_kernel", bench_rbitset,  500000 },
+	{ "sc_add",         bench_sc_add,   500000 },
+	{ "fc_mul",         bench_fc_mul,   200000 },
+	{ "ident_intern",   bench_ident,    200000 },
+	{ "obstack_churn",  bench_obstack,  500000 },
+};
+
+static int cmp_ticks(const void *p1, const void *p2)
+{
+	timing_ticks_t const t1 = *(const timing_ticks_t*)p1;
+	timing_ticks_t const t2 = *(const timing_ticks_t*)p2;
+	return t1 < t2 ? -1 : t1 > t2 ? 1 : 0;
+}
+
+static void run_benchmark(const benchmark_t *bench, bool last)
+{
+	for (unsigned i = 0; i < N_WARMUP; ++i)
+		bench->func(bench->n_ops);
+
+	timing_ticks_t samples[N_SAMPLES];
+	for (unsigned i = 0; i < N_SAMPLES; ++i) {
+		timing_ticks_t const start = timing_ticks();
+		bench->func(bench->n_ops);
+		samples[i] = timing_ticks() - start;
+	}
+
+	/* reject the fastest and slowest quarter, average the middle half */
+	QSORT(samples, N_SAMPLES, cmp_ticks);
+	timing_ticks_t sum = 0;
+	for (unsigned i = N_SAMPLES / 4; i < 3 * N_SAMPLES / 4; ++i)
+		sum += samples[i];
+	double const kept        = N_SAMPLES / 2;
+	double const ticks_avg   = (double)sum / kept;
+	double const per_op      = ticks_avg / (double)bench->n_ops;
+	double const min_per_op  = (double)samples[0] / (double)bench->n_ops;
+
+	printf("    { \"name\": \"%s\", \"ops\": %zu, \"samples\": %u, "
+	       "\"ticks_per_op\": %.3f, \"min_ticks_per_op\": %.3f }%s\n",
+	       bench->name, bench->n_ops, (unsigned)kept, per_op, min_per_op,
+	       last ? "" : ",");
+}
+
+int main(void)
+{
+	/* the ident and tarval kernels need the library initialized */
+	ir_init_library();
+
+	timing_enter_max_prio();
+	printf("{\n  \"benchmarks\": [\n");
+	for (size_t i = 0; i < ARRAY_SIZE(benchmarks); ++i)
+		run_benchmark(&benchmarks[i], i + 1 == ARRAY_SIZE(benchmarks));
+	printf("  ]\n}\n");
+	timing_leave_max_prio();
+	return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief  Code quality benchmark driver.
+ *
+ * Imports a corpus of .ir files and compiles it through be_main for a
+ * selectable target, with the statev framework recording the quality
+ * events the backend already emits per function: instruction and block
+ * counts at emission (bemain_insns_finish), spill, reload and remat
+ * counts (bespillutil), copy minimization costs (becopyopt) and
+ * constraint copies (bessadestr). The resulting .ev file is the input
+ * for scripts/quality_diff.py, which diffs the reports of two libfirm
+ * builds:
+ *
+ *   quality -s before corpus/ && <build new libfirm>
+ *   quality -s after corpus/
+ *   quality_diff.py before.ev after.ev
+ */
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <firm.h>
+#include <statev.h>
+
+static bool import_file(const char *filename)
+{
+	if (ir_import(filename) != 0) {
+		fprintf(stderr, "quality: could not import '%s'\n", filename);
+		return false;
+	}
+	return true;
+}
+
+static bool import_path(const char *path)
+{
+	struct stat st;
+	if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+		DIR *dir = opendir(path);
+		if (dir == NULL) {
+			fprintf(stderr, "quality: could not open directory '%s'\n", path);
+			return false;
+		}
+		bool ok = true;
+		for (struct dirent *entry; (entry = readdir(dir)) != NULL;) {
+			const char *dot = strrchr(entry->d_name, '.');
+			if (dot == NULL || strcmp(dot, ".ir") != 0)
+				continue;
+			char buf[4096];
+			snprintf(buf, sizeof(buf), "%s/%s", path, entry->d_name);
+			ok &= import_file(buf);
+		}
+		closedir(dir);
+		return ok;
+	}
+	return import_file(path);
+}
+
+static void usage(const char *progname)
+{
+	fprintf(stderr,
+	        "usage: %s [-t target-triple] [-s statev-prefix] "
+	        "<file.ir|directory>...\n", progname);
+}
+
+int main(int argc, char **argv)
+{
+	const char *triple        = "x86_64-unknown-linux-gnu";
+	const char *statev_prefix = "quality";
+
+	int i = 1;
+	for (; i < argc; ++i) {
+		if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			triple = argv[++i];
+		} else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+			statev_prefix = argv[++i];
+		} else if (strcmp(argv[i], "--help") == 0) {
+			usage(argv[0]);
+			return EXIT_SUCCESS;
+		} else {
+			break;
+		}
+	}
+	if (i >= argc) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	ir_init();
+	if (!ir_target_set(triple)) {
+		fprintf(stderr, "quality: unknown target '%s'\n", triple);
+		return EXIT_FAILURE;
+	}
+	ir_target_init();
+
+	bool ok = true;
+	for (; i < argc; ++i) {
+		ok &= import_path(argv[i]);
+	}
+	if (!ok)
+		return EXIT_FAILURE;
+
+	/* record the backend's per-function quality events; the assembly
+	 * itself is not the artifact of interest here */
+	stat_ev_begin(statev_prefix, NULL);
+	FILE *out = fopen("/dev/null", "w");
+	if (out == NULL) {
+		perror("quality: could not open output");
+		return EXIT_FAILURE;
+	}
+	be_lower_for_target();
+	be_main(out, "quality");
+	fclose(out);
+	stat_ev_end();
+
+	ir_finish();
+	return EXIT_SUCCESS;
+}
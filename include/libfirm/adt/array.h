@@ -72,6 +72,20 @@ FIRM_API void *ir_new_arr_f(size_t nelts, size_t elts_size);
  */
 FIRM_API void *ir_new_arr_d(struct obstack *obstack, size_t nelts, size_t elts_size);
 
+/**
+ * Initializes a dynamic array in caller-provided memory.
+ *
+ * @param space  Memory for the array descriptor and the elements; must be
+ *               at least ARR_ELTS_OFFS plus the element data in size and
+ *               suitably aligned.
+ * @param nelts  The number of elements.
+ *
+ * @return A pointer to the first element of the array.
+ *
+ * @remark Allows embedding a dynamic array into a larger allocation.
+ */
+FIRM_API void *ir_init_arr_d(void *space, size_t nelts);
+
 /**
  * Resize a flexible array, allocate more data if needed but do NOT
  * reduce.
@@ -101,6 +115,44 @@ FIRM_API void *ir_arr_resize(void *elts, size_t nelts, size_t elts_size);
  */
 FIRM_API void *ir_arr_setlen(void *elts, size_t nelts, size_t elts_size);
 
+/**
+ * Creates a flexible array with extra capacity reserved up front.
+ *
+ * @param nelts    The number of elements.
+ * @param reserve  The number of elements to allocate space for.
+ * @param eltsize  The size of one array element.
+ *
+ * @remark Helper function, use NEW_ARR_F_RESERVE() instead.
+ */
+FIRM_API void *ir_new_arr_f_reserve(size_t nelts, size_t reserve,
+                                    size_t eltsize);
+
+/**
+ * Ensure capacity for at least @p capacity elements in a flexible array
+ * without changing its length.
+ *
+ * @param elts      The flexible array (pointer to the first element).
+ * @param capacity  The number of elements to allocate space for.
+ * @param eltsize   The size of one array element.
+ *
+ * @return The flexible array, possibly at another address than elts.
+ *
+ * @remark Helper function, use ARR_RESERVE() instead.
+ */
+FIRM_API void *ir_arr_reserve(void *elts, size_t capacity, size_t eltsize);
+
+/**
+ * Give up excess capacity of a flexible array.
+ *
+ * @param elts     The flexible array (pointer to the first element).
+ * @param eltsize  The size of one array element.
+ *
+ * @return The flexible array, possibly at another address than elts.
+ *
+ * @remark Helper function, use ARR_SHRINK_TO_FIT() instead.
+ */
+FIRM_API void *ir_arr_shrink_to_fit(void *elts, size_t eltsize);
+
 FIRM_API void ir_verify_arr(const void *elts);
 
 #define ARR_ELTS_OFFS offsetof(ir_arr_descr, elts)
@@ -140,6 +192,20 @@ static inline void ARR_SHRINKLEN(void *arr, size_t new_len)
 #define NEW_ARR_FZ(type, nelts) \
 	((type*)memset(NEW_ARR_F(type, (nelts)), 0, sizeof(type) * (nelts)))
 
+/**
+ * Creates a flexible array with extra capacity reserved up front.
+ *
+ * @param type     The element type of the new array.
+ * @param nelts    a size_t expression evaluating to the number of elements
+ * @param reserve  a size_t expression evaluating to the capacity to reserve
+ *
+ * Like NEW_ARR_F(), but allocates space for @p reserve elements right away,
+ * so callers which know (an estimate of) the final size avoid the
+ * repeated growth reallocations.
+ */
+#define NEW_ARR_F_RESERVE(type, nelts, reserve) \
+  ((type *)ir_new_arr_f_reserve((nelts), (reserve), sizeof(type)))
+
 /**
  * Duplicates an array and returns the new flexible one.
  *
@@ -239,6 +305,32 @@ static inline size_t ARR_LEN(void const *const arr)
 #define ARR_SETLEN(type, arr, n) \
   ((arr) = (type*) ir_arr_setlen((void *)(arr), (n), sizeof(type) * (n)))
 
+/**
+ * Ensure capacity for at least n elements in a flexible array without
+ * changing its length. Appending up to the reserved capacity afterwards
+ * will not reallocate.
+ *
+ * @param type     The element type of the array.
+ * @param arr      The array, which must be an lvalue.
+ * @param n        The number of elements to make room for.
+ *
+ * @remark  This macro may change arr, so update all references!
+ */
+#define ARR_RESERVE(type, arr, n) \
+  ((arr) = (type*) ir_arr_reserve((void *)(arr), (n), sizeof(type)))
+
+/**
+ * Give up excess capacity of a flexible array, e.g. after the final size
+ * of a long-lived array is reached.
+ *
+ * @param type     The element type of the array.
+ * @param arr      The array, which must be an lvalue.
+ *
+ * @remark  This macro may change arr, so update all references!
+ */
+#define ARR_SHRINK_TO_FIT(type, arr) \
+  ((arr) = (type*) ir_arr_shrink_to_fit((void *)(arr), sizeof(type)))
+
 /**
  * Resize a flexible array by growing it by delta elements.
  *
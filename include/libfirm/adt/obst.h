@@ -11,12 +11,24 @@
 #ifndef FIRM_ADT_OBST_H
 #define FIRM_ADT_OBST_H
 
+#include <stddef.h>
+
 #include "obstack.h"
 #include "xmalloc.h"
 
+#include "../begin.h"
+
+/** Chunk allocator of all libFirm obstacks: allocates like xmalloc()
+ * and accounts the chunk, see ir_memory_stats(). */
+FIRM_API void *ir_obstack_chunk_alloc(size_t size);
+/** Chunk deallocator matching ir_obstack_chunk_alloc(). */
+FIRM_API void ir_obstack_chunk_free(void *chunk);
+
+#include "../end.h"
+
 /** @cond PRIVATE */
-#define obstack_chunk_alloc xmalloc
-#define obstack_chunk_free  free
+#define obstack_chunk_alloc ir_obstack_chunk_alloc
+#define obstack_chunk_free  ir_obstack_chunk_free
 /** @endcond */
 
 #endif
@@ -191,6 +191,7 @@ FIRM_API int _obstack_begin_1 (struct obstack *, int, int,
                                void *(*) (void *, ptrdiff_t),
                                void (*) (void *, void *), void *);
 FIRM_API ptrdiff_t _obstack_memory_used (struct obstack *);
+FIRM_API void _obstack_trim (struct obstack *);
 
 FIRM_API void obstack_free (struct obstack *obstack, void *block);
 
@@ -254,6 +255,10 @@ FIRM_API int obstack_exit_failure;
 
 #define obstack_memory_used(h) _obstack_memory_used (h)
 
+/* Return unused pages at the top of the current chunk to the operating
+   system.  Useful on long-lived obstacks after a peak in allocation.  */
+#define obstack_trim(h) _obstack_trim (h)
+
 #if defined __GNUC__ && defined __STDC__ && __STDC__
 /* NextStep 2.0 cc is really gcc 1.93 but it defines __GNUC__ = 2 and
    does not implement __extension__.  But that compiler doesn't define
@@ -55,6 +55,38 @@ FIRM_API void *xrealloc(void *ptr, size_t size);
  */
 FIRM_API char *xstrdup(const char *str);
 
+/**
+ * Releases memory allocated by xmalloc(), xrealloc() or xstrdup()
+ * through the installed allocator, see ir_set_allocator().
+ */
+FIRM_API void xfree(void *ptr);
+
+/**
+ * Function table of a custom memory allocator, see ir_set_allocator().
+ * The functions must behave like their malloc() counterparts; returning
+ * NULL on failure is permitted and aborts the program like malloc()
+ * failure would.
+ */
+typedef struct ir_allocator_t {
+	void *(*alloc)(size_t size);              /**< behaves like malloc() */
+	void *(*realloc)(void *ptr, size_t size); /**< behaves like realloc() */
+	void  (*free)(void *ptr);                 /**< behaves like free() */
+} ir_allocator_t;
+
+/**
+ * Installs a custom allocator behind xmalloc() and friends, and with
+ * them behind the obstack chunk allocation and the ARR_* arrays. Call
+ * this before ir_init_library() and before creating any libFirm
+ * objects; the table is not copied deeply, only read.
+ *
+ * Some analysis results are still released with plain free(), and
+ * buffers returned to the caller (\see cgana()) may be as well, so the
+ * installed allocator must hand out pointers the C library free() also
+ * accepts. Allocators that replace or wrap the malloc family - such as
+ * jemalloc with per-session arenas - satisfy this.
+ */
+FIRM_API void ir_set_allocator(const ir_allocator_t *allocator);
+
 /**
  * Allocate n objects of a certain type
  */
@@ -116,6 +116,30 @@ typedef void callgraph_walk_func(ir_graph *g, void *env);
 FIRM_API void callgraph_walk(callgraph_walk_func *pre,
                              callgraph_walk_func *post, void *env);
 
+/**
+ * Walks over the callgraph bottom-up in units of strongly connected
+ * components.
+ *
+ * The callgraph is condensed into its components (mutually recursive
+ * functions form one component); @p func is called for every graph of a
+ * component only after all graphs it calls outside the component have
+ * been processed. Visits ALL graphs in the irp. Requires a consistent
+ * callgraph, see compute_callgraph().
+ *
+ * When @p n_threads is greater than 1 and the platform provides threads,
+ * independent components are processed concurrently by a pool of
+ * workers; the graphs of one component are always processed by the same
+ * worker, one after another. A concurrent @p func must restrict itself
+ * to its own graph and results of its callees and synchronize any
+ * updates to shared program state.
+ *
+ * @param func      called for every graph, in bottom-up component order
+ * @param env       environment, passed to func
+ * @param n_threads maximum number of worker threads (1 = serial)
+ */
+FIRM_API void callgraph_scc_walk(callgraph_walk_func *func, void *env,
+                                 unsigned n_threads);
+
 /**
  * Compute the backedges that represent recursions and a looptree.
  */
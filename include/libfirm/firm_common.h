@@ -11,6 +11,8 @@
 #ifndef FIRM_COMMON_FIRM_COMMON_H
 #define FIRM_COMMON_FIRM_COMMON_H
 
+#include <stddef.h>
+
 #include "firm_types.h"
 
 #include "begin.h"
@@ -58,6 +60,39 @@ FIRM_API const char *ir_get_version_revision(void);
 /** returns string describing libFirm build */
 FIRM_API const char *ir_get_version_build(void);
 
+/**
+ * @defgroup memory_statistics  Memory Statistics
+ * Almost all long-lived libFirm data is allocated on obstacks, and all
+ * obstacks draw their chunks from one accounted allocator. These
+ * counters attribute memory peaks to subsystems and expose leaks of
+ * graph-lifetime data into program-lifetime obstacks: bytes that stay
+ * in @p obstack_live after the graphs are freed belong to the latter.
+ * @{
+ */
+
+/** A snapshot of the obstack memory counters, see ir_memory_stats(). */
+typedef struct ir_memory_stats_t {
+	size_t obstack_live;        /**< bytes currently held by obstack chunks */
+	size_t obstack_peak;        /**< highest value of obstack_live so far */
+	size_t obstack_chunks;      /**< number of chunks currently allocated */
+	size_t obstack_chunks_peak; /**< highest value of obstack_chunks so far */
+	size_t irg_live;            /**< bytes in the node obstacks of all
+	                                 graphs, including recycled chunks */
+	size_t be_live;             /**< bytes in the backend obstacks of graphs
+	                                 currently being code generated */
+} ir_memory_stats_t;
+
+/**
+ * Fills @p stats with the current memory counters. When statistics
+ * recording is active (\see stat_ev_begin()) the numbers are also
+ * emitted as statev events (mem_obstack_live, mem_obstack_peak,
+ * mem_obstack_chunks, mem_obstack_chunks_peak, mem_irg_live,
+ * mem_be_live), so a driver can sample memory at pass boundaries.
+ */
+FIRM_API void ir_memory_stats(ir_memory_stats_t *stats);
+
+/** @} */
+
 /**
  * A list of firm kinds.
  * Most important data structures in firm contain a firm_kind field at the
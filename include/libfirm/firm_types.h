@@ -301,7 +301,19 @@ typedef enum ir_builtin_kind {
 	                                 1 otherwise */
 	ir_bk_va_start,             /**< va_start from <stdarg.h> */
 	ir_bk_va_arg,               /**< va_arg from <stdarg.h> */
-	ir_bk_last = ir_bk_va_arg,
+	ir_bk_add_overflow,         /**< GCC __builtin_add_overflow(): addition
+	                                 with overflow check */
+	ir_bk_sub_overflow,         /**< GCC __builtin_sub_overflow(): subtraction
+	                                 with overflow check */
+	ir_bk_mul_overflow,         /**< GCC __builtin_mul_overflow():
+	                                 multiplication with overflow check */
+	ir_bk_atomic_exchange,      /**< atomically store a new value and return
+	                                 the previous one (sequentially
+	                                 consistent) */
+	ir_bk_atomic_fetch_add,     /**< atomically add to a memory location and
+	                                 return the previous value (sequentially
+	                                 consistent) */
+	ir_bk_last = ir_bk_atomic_fetch_add,
 } ir_builtin_kind;
 
 /**
@@ -35,7 +35,7 @@
  * @param irn  The node.
  * @return     The height of the node.
  */
-FIRM_API unsigned get_irn_height(const ir_heights_t *h, const ir_node *irn);
+FIRM_API unsigned get_irn_height(ir_heights_t *h, const ir_node *irn);
 
 /**
  * Checks if the node @p tgt is reachable according to data dependence edges
@@ -48,6 +48,16 @@ FIRM_API unsigned get_irn_height(const ir_heights_t *h, const ir_node *irn);
 FIRM_API int heights_reachable_in_block(ir_heights_t *h, const ir_node *src,
                                         const ir_node *tgt);
 
+/**
+ * Marks the height information of a certain block as stale, for example
+ * because an instruction was moved, added or replaced.  The block is
+ * recomputed in bulk on the next query concerning one of its nodes, so
+ * several edits to one block cost only one recomputation.
+ * @param h     The heights object.
+ * @param block The block.
+ */
+FIRM_API void heights_invalidate_block(ir_heights_t *h, ir_node *block);
+
 /**
  * Recomputes the height information for a certain block.
  * This can be used to recompute the height information of a block.
@@ -45,6 +45,20 @@ FIRM_API ident *new_id_from_str(const char *str);
  */
 FIRM_API ident *new_id_from_chars(const char *str, size_t len);
 
+/**
+ * Store a batch of strings and create their idents.
+ *
+ * Behaves like calling new_id_from_str() for every string, but touches
+ * every internal table shard at most once, so it is the preferred way to
+ * intern many names at once from parallel code.
+ *
+ * @param strs    the zero terminated strings which shall be stored
+ * @param idents  array receiving the ident for each string
+ * @param n       the number of strings
+ */
+FIRM_API void new_ids_from_strs(const char *const *strs, ident **idents,
+                                size_t n);
+
 /**
  * Create an ident from a format string.
  *
@@ -493,6 +493,18 @@ FIRM_API void add_immBlock_pred(ir_node *immblock, ir_node *jmp);
 /** Finalize a Block node, when all control flows are known. */
 FIRM_API void mature_immBlock(ir_node *block);
 
+/** Defer block maturation until irg_finalize_cons().
+ *
+ * After this call mature_immBlock() only records its block;
+ * irg_finalize_cons() then matures all recorded blocks in one batch,
+ * predecessors first.  Maturing a block whose predecessors are already
+ * matured resolves its Phi operands to real values directly, so frontends
+ * that create many blocks before the control flow between them is final
+ * avoid most of the placeholder Phi nodes an eager maturation order would
+ * allocate and prune again.
+ */
+FIRM_API void ir_defer_block_maturation(ir_graph *irg);
+
 /**
  * Sets the current block in which the following constructors place the
  * nodes they construct.
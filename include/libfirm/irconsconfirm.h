@@ -69,6 +69,44 @@ FIRM_API void construct_confirms_only(ir_graph *irg);
  */
 FIRM_API void remove_confirms(ir_graph *irg);
 
+/**
+ * Compute the same facts construct_confirms_only() would materialize as
+ * Confirm nodes, but record them in a dominance-scoped side-table of the
+ * graph instead of the graph itself.
+ *
+ * This avoids the node-count inflation and the skip-Confirm branches
+ * that graph-resident Confirms cost: the graph stays untouched and
+ * interested optimizations query the table with ir_get_value_fact().
+ *
+ * The table is invalidated when the dominance information of the graph
+ * is lost and freed when the graph is compacted or dies.
+ *
+ * @param irg  the graph
+ */
+FIRM_API void construct_value_facts(ir_graph *irg);
+
+/**
+ * Query the value fact table of a graph, see construct_value_facts().
+ *
+ * Looks up a relation @p value <relation> bound that is known to hold in
+ * @p block. Returns ir_relation_true and leaves @p bound untouched if
+ * nothing is known (or no valid table exists); otherwise returns the
+ * relation and sets @p bound to the node the value is related to.
+ *
+ * @param value  the value the fact is about
+ * @param block  the block in which the fact must be valid
+ * @param bound  output: the bound of the returned relation
+ */
+FIRM_API ir_relation ir_get_value_fact(const ir_node *value,
+                                       const ir_node *block, ir_node **bound);
+
+/**
+ * Free the value fact table of a graph, see construct_value_facts().
+ *
+ * @param irg  the graph
+ */
+FIRM_API void free_value_facts(ir_graph *irg);
+
 #include "end.h"
 
 #endif
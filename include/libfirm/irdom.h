@@ -13,6 +13,8 @@
 #ifndef FIRM_ANA_IRDOM_H
 #define FIRM_ANA_IRDOM_H
 
+#include <stddef.h>
+
 #include "firm_types.h"
 
 #include "begin.h"
@@ -175,6 +177,41 @@ FIRM_API void postdom_tree_walk_irg(ir_graph *irg, irg_walk_func *pre,
  */
 FIRM_API void compute_doms(ir_graph *irg);
 
+/** Patches the dominator tree after a new control flow edge was added.
+ *
+ * To be called after an edge from @p pred_block to @p block was inserted
+ * into the graph. Edits whose effect on the tree is cheap to determine are
+ * applied in place and the dominance information stays consistent;
+ * otherwise the consistent-dominance property is cleared so the next
+ * assure_irg_properties() recomputes it. Post dominance information is
+ * always invalidated. Does nothing if dominance information is not
+ * currently consistent.
+ */
+FIRM_API void dom_tree_update_insert_edge(ir_node *pred_block,
+                                          ir_node *block);
+
+/** Patches the dominator tree after a control flow edge was removed.
+ *
+ * To be called after the edge from @p pred_block to @p block was deleted
+ * from the graph. Behaves like dom_tree_update_insert_edge() with respect
+ * to consistency: cheap edits (for example @p block becoming unreachable)
+ * are applied in place, everything else clears the consistent-dominance
+ * property.
+ */
+FIRM_API void dom_tree_update_delete_edge(ir_node *pred_block,
+                                          ir_node *block);
+
+/** Patches the dominator tree after an edge was split by a new block.
+ *
+ * To be called after the edge from @p pred_block to @p succ_block was
+ * replaced by edges through the freshly created @p new_block (as done by
+ * remove_critical_cf_edges() and jump threading). This edit is always
+ * applied in place, keeping the dominance information consistent.
+ */
+FIRM_API void dom_tree_update_split_edge(ir_node *pred_block,
+                                         ir_node *new_block,
+                                         ir_node *succ_block);
+
 /** Computes the post dominance relation for all basic blocks of a given graph.
  *
  * Sets a flag in irg to "dom_consistent".
@@ -199,13 +236,21 @@ FIRM_API void compute_postdoms(ir_graph *irg);
 FIRM_API void ir_compute_dominance_frontiers(ir_graph *irg);
 
 /**
- * Get the dominance frontier of a block.
+ * Get the dominance frontier of a block. Computes the dominance frontiers
+ * of the graph on the first query if not available yet.
  * @param block   The block whose dominance frontier you want.
- * @return        A list containing all blocks in the dominance frontier of
- *                @p block (as array, use ARR_LEN() to determine the size)
+ * @return        An array containing all blocks in the dominance frontier of
+ *                @p block, use ir_get_dominance_frontier_size() to determine
+ *                the size.
  */
 FIRM_API ir_node **ir_get_dominance_frontier(const ir_node *block);
 
+/**
+ * Returns the number of blocks in the dominance frontier of a block.
+ * @param block   The block whose dominance frontier size you want.
+ */
+FIRM_API size_t ir_get_dominance_frontier_size(const ir_node *block);
+
 /** @} */
 
 #include "end.h"
@@ -43,6 +43,24 @@
  */
 FIRM_API void dump_ir_graph(ir_graph *graph, const char *suffix);
 
+/**
+ * Dumps only the region of a graph around a set of interesting nodes.
+ * This keeps dumps of huge graphs manageable when only a small part is
+ * under investigation. The region contains everything reachable within
+ * @p depth steps from the given nodes, following inputs and (when out
+ * edges are available) users, plus the blocks of those nodes. Edges
+ * leaving the region are suppressed.
+ *
+ * @param graph    The graph to dump
+ * @param suffix   A suffix for the file name
+ * @param nodes    The nodes of interest
+ * @param n_nodes  Number of entries in @p nodes
+ * @param depth    Neighborhood radius in graph edges
+ */
+FIRM_API void dump_ir_subgraph(ir_graph *graph, const char *suffix,
+                               ir_node *const *nodes, size_t n_nodes,
+                               unsigned depth);
+
 /**
  * type for dumpers that dump information about the whole program
  */
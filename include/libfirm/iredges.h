@@ -223,6 +223,26 @@ FIRM_API void edges_activate(ir_graph *irg);
  */
 FIRM_API void edges_deactivate(ir_graph *irg);
 
+/**
+ * Opens a deferred-update scope for all activated edge kinds of @p irg.
+ * Inside the scope edge changes are only recorded, not applied, so
+ * passes performing heavy graph surgery avoid the per-operand
+ * bookkeeping. The out edges must not be read until the matching
+ * edges_commit_updates(); scopes may be nested.
+ *
+ * @param irg  The graph.
+ */
+FIRM_API void edges_defer_updates(ir_graph *irg);
+
+/**
+ * Closes a scope opened by edges_defer_updates(). When the outermost
+ * scope is closed and changes happened inside it, the edge information
+ * is reconciled by a single rebuild.
+ *
+ * @param irg  The graph.
+ */
+FIRM_API void edges_commit_updates(ir_graph *irg);
+
 /**
  * Ensures that edges are activated.
  *
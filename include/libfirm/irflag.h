@@ -50,6 +50,48 @@ FIRM_API void set_optimize(int value);
  * @see set_optimize() */
 FIRM_API int get_optimize(void);
 
+/**
+ * Compilation tiers for individual functions.
+ *
+ * Where set_optimize() switches optimization globally, the tier of a
+ * function selects a whole pipeline per graph: hot functions deserve
+ * the full optimization and code generation pipeline, cold functions
+ * just construction, minimal cleanup and quick code generation. The
+ * backend honors the tier on its own: scheduling and register
+ * allocation of a cold graph use the same quick modules as the tier-1
+ * JIT pipeline. Which midend passes to skip for a cold graph remains
+ * the decision of the driver, which should query get_function_tier().
+ */
+typedef enum ir_function_tier {
+	ir_tier_hot,  /**< run the full pipeline on this function */
+	ir_tier_cold  /**< restrict this function to quick compilation */
+} ir_function_tier;
+
+/** Callback deciding the compilation tier of a function. */
+typedef ir_function_tier (ir_tier_selector_func)(ir_graph const *irg);
+
+/**
+ * Installs a callback that decides the tier of each function.
+ * A selector takes precedence over profile based tier selection.
+ * Passing NULL uninstalls the callback.
+ */
+FIRM_API void set_tier_selector(ir_tier_selector_func *selector);
+
+/**
+ * Sets the execution count below which a function counts as cold when
+ * profile data is loaded and no tier selector is installed.
+ * The default threshold of 1 makes exactly the never executed
+ * functions cold.
+ */
+FIRM_API void set_tier_cold_threshold(unsigned execcount);
+
+/**
+ * Returns the compilation tier of a function: the installed selector's
+ * verdict, otherwise cold if loaded profile data shows fewer entries
+ * into the function than the threshold, otherwise hot.
+ */
+FIRM_API ir_function_tier get_function_tier(ir_graph const *irg);
+
 /** Enables/Disables constant folding optimization.
  *
  *  If opt_constant_folding == 1 perform
@@ -11,6 +11,8 @@
 #ifndef FIRM_IR_IRGOPT_H
 #define FIRM_IR_IRGOPT_H
 
+#include <stddef.h>
+
 #include "firm_types.h"
 
 #include "begin.h"
@@ -55,11 +57,106 @@ FIRM_API void local_optimize_graph(ir_graph *irg);
  */
 FIRM_API void optimize_graph_df(ir_graph *irg);
 
+/** Applies local optimizations (see iropt.h) to the nodes of the listed
+ * blocks and everything reachable through their dataflow fan-out.
+ *
+ * This is the incremental variant of optimize_graph_df() for callers that
+ * know which blocks contain fresh code, e.g. a frontend cleaning up after
+ * constructing one statement or the inliner after copying a callee: the
+ * fixpoint iteration is seeded with the listed blocks only, and users of
+ * changed nodes are followed from there, so the cost is proportional to
+ * the new code instead of the whole graph.  Unreachable code elimination
+ * is not performed; run optimize_graph_df() for that.
+ *
+ * @param irg       The graph to be optimized.
+ * @param blocks    The blocks whose nodes are optimized.
+ * @param n_blocks  The number of blocks in @p blocks.
+ */
+FIRM_API void optimize_blocks(ir_graph *irg, ir_node *const *blocks,
+                              size_t n_blocks);
+
 /**
  * Perform local optimizations on nodes on const code irg
  */
 FIRM_API void local_opts_const_code(void);
 
+/** A pass operating on a single graph, suitable for run_irg_passes(). */
+typedef void (*irg_pass_func)(ir_graph *irg);
+
+/** Runs a list of intraprocedural passes on every graph of the program.
+ *
+ * Each graph is processed by the complete pass list before the driver
+ * moves on, which keeps a graph's nodes cache-hot across passes. When
+ * @p n_threads is greater than 1 and the platform provides threads,
+ * independent graphs are processed concurrently by a pool of workers.
+ *
+ * Concurrent execution requires that the passes only touch their own
+ * graph and do not mutate shared program state (idents, tarvals, the
+ * type graph) without external synchronization; passes relying on such
+ * mutation must be run with @p n_threads set to 1.
+ *
+ * @param passes    array of passes to apply, in order
+ * @param n_passes  number of entries in @p passes
+ * @param n_threads maximum number of worker threads (1 = serial)
+ */
+FIRM_API void run_irg_passes(irg_pass_func const *passes, size_t n_passes,
+                             unsigned n_threads);
+
+/** Cheap applicability predicate for a pass, see run_irg_pass_list().
+ * Returns non-zero if the pass should run on @p irg. */
+typedef int (*irg_pass_guard_func)(ir_graph *irg);
+
+/** A named pass with an optional applicability guard. */
+typedef struct irg_pass_t {
+	const char          *name;  /**< name used in statistic events,
+	                                 may be NULL */
+	irg_pass_func        run;   /**< the pass itself */
+	irg_pass_guard_func  guard; /**< may be NULL, then the pass always
+	                                 runs */
+} irg_pass_t;
+
+/** Like run_irg_passes(), but skips passes whose guard rejects the graph
+ * and records statistic events per named pass (time spent, nodes created,
+ * skips). Guards allow a pipeline to cheaply leave out passes that cannot
+ * help a given graph shape, e.g. loop optimizations on loop-free graphs
+ * or load/store optimization on graphs without memory operations; the
+ * recorded events show which passes pay off for which functions. */
+FIRM_API void run_irg_pass_list(irg_pass_t const *passes, size_t n_passes,
+                                unsigned n_threads);
+
+/** Pass guard: returns non-zero if @p irg contains at least one loop. */
+FIRM_API int irg_has_loops(ir_graph *irg);
+
+/** Pass guard: returns non-zero if @p irg contains memory operations
+ * (Load, Store or CopyB nodes). */
+FIRM_API int irg_has_memory_ops(ir_graph *irg);
+
+/** Selects the cleanup transformations ir_cleanup_graph() performs. */
+typedef enum ir_cleanup_flags_t {
+	/** Cut all edges into (obviously) unreachable code. */
+	IR_CLEANUP_UNREACHABLE_CODE = 1U << 0,
+	/** Remove Bad nodes by shortening block and Phi inputs. */
+	IR_CLEANUP_BADS             = 1U << 1,
+	/** Remove Tuple nodes by routing Projs to the tupled values. */
+	IR_CLEANUP_TUPLES           = 1U << 2,
+	/** Finally collect the garbage left behind by the other
+	 * transformations, see dead_node_elimination(). */
+	IR_CLEANUP_DEAD_NODES       = 1U << 3,
+} ir_cleanup_flags_t;
+ENUM_BITSET(ir_cleanup_flags_t)
+
+/**
+ * Performs the cleanup transformations selected by @p flags in a single
+ * graph walk. This is equivalent to calling remove_unreachable_code(),
+ * remove_tuples() and remove_bads() in sequence, but avoids one full
+ * walk per transformation; pipelines cleaning up between most passes
+ * should prefer it.
+ *
+ * @param irg    The graph to be cleaned up.
+ * @param flags  The transformations to perform.
+ */
+FIRM_API void ir_cleanup_graph(ir_graph *irg, ir_cleanup_flags_t flags);
+
 /**
  * Eliminates (obviously) unreachable code
  */
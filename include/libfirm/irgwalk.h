@@ -11,6 +11,8 @@
 #ifndef FIRM_IR_IRGWALK_H
 #define FIRM_IR_IRGWALK_H
 
+#include <stddef.h>
+
 #include "firm_types.h"
 
 #include "begin.h"
@@ -228,6 +230,20 @@ FIRM_API void irg_walk_anchors(ir_graph *irg, irg_walk_func *pre,
 FIRM_API void irg_walk_2(ir_node *node, irg_walk_func *pre, irg_walk_func *post,
                          void *env);
 
+/**
+ * Returns a cached topological order of all nodes reachable from the End
+ * node: every node appears after its operands (up to cycles through Phi and
+ * Block nodes). The position in the array is a dense numbering of the nodes.
+ *
+ * The array is owned by the graph and recomputed on demand after the graph
+ * changed; it becomes invalid with the next structural change.
+ *
+ * @param irg    the graph
+ * @param order  receives a pointer to the order array
+ * @return       the number of nodes in the order
+ */
+FIRM_API size_t ir_get_topo_order(ir_graph *irg, ir_node ***order);
+
 /** @} */
 
 #include "end.h"
@@ -11,6 +11,7 @@
 #ifndef FIRM_IR_IRIO_H
 #define FIRM_IR_IRIO_H
 
+#include <stdint.h>
 #include <stdio.h>
 #include "firm_types.h"
 
@@ -52,6 +53,39 @@ FIRM_API int ir_import(const char *filename);
  */
 FIRM_API int ir_import_file(FILE *input, const char *inputname);
 
+/**
+ * Computes a hash over the canonical form of @p irg. The hash only
+ * depends on the structure, attributes and referenced names of the
+ * graph, not on node numbers or debug info, so structurally identical
+ * graphs of repeated builds hash to the same value. A driver can use it
+ * as a cache key to skip re-optimizing functions that did not change.
+ */
+FIRM_API uint64_t ir_graph_content_hash(ir_graph *irg);
+
+/**
+ * Loads the graph hash cache written by a previous ir_cache_store() from
+ * the given file. A missing file leaves the cache empty.
+ *
+ * @return  0 if no errors occured, other values in case of errors
+ */
+FIRM_API int ir_cache_load(const char *filename);
+
+/** Returns whether @p hash is recorded in the cache. */
+FIRM_API int ir_cache_contains(uint64_t hash);
+
+/** Records @p hash in the cache. */
+FIRM_API void ir_cache_insert(uint64_t hash);
+
+/**
+ * Writes the cache to the given file.
+ *
+ * @return  0 if no errors occured, other values in case of errors
+ */
+FIRM_API int ir_cache_store(const char *filename);
+
+/** Frees the cache. */
+FIRM_API void ir_cache_free(void);
+
 /** @} */
 
 #include "end.h"
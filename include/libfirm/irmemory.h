@@ -106,9 +106,19 @@ FIRM_API void set_irp_globals_entity_usage_state(ir_entity_usage_computed_state
  * set_irp_globals_entity_usage_state(ir_entity_usage_not_computed).
  * Even then the information is not cleaned from the variables, call
  * assure_irp_globals_entity_usage_computed() again for recomputation.
+ *
+ * The contribution of each graph is cached, so a recomputation only
+ * rescans graphs that changed since the last analysis.
  */
 FIRM_API void assure_irp_globals_entity_usage_computed(void);
 
+/**
+ * Like assure_irp_globals_entity_usage_computed(), but distributes the
+ * per-graph scans over up to @p n_threads worker threads before merging
+ * the per-graph results.
+ */
+FIRM_API void assure_irp_globals_entity_usage_computed_parallel(unsigned n_threads);
+
 /**
  * Returns the memory disambiguator options for a graph.
  *
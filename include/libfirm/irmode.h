@@ -99,6 +99,24 @@ FIRM_API ir_mode *new_float_mode(const char *name,
  */
 FIRM_API ir_mode *new_non_arithmetic_mode(const char *name, unsigned bit_size);
 
+/**
+ * Creates a new vector mode with @p n_elems elements of mode @p elem_mode.
+ * The mode is a data mode with arithmetic irma_none: vector values can be
+ * loaded, stored, copied and selected, scalar arithmetic nodes do not
+ * accept them. The name is derived from the element mode, so requesting
+ * the same combination twice yields the same mode.
+ */
+FIRM_API ir_mode *new_vector_mode(ir_mode *elem_mode, unsigned n_elems);
+
+/** Returns true if @p mode is a vector mode. */
+FIRM_API int mode_is_vector(const ir_mode *mode);
+
+/** Returns the number of vector elements of a mode, 1 for scalar modes. */
+FIRM_API unsigned get_mode_n_vector_elems(const ir_mode *mode);
+
+/** Returns the element mode of a vector mode, NULL for scalar modes. */
+FIRM_API ir_mode *get_mode_element_mode(const ir_mode *mode);
+
 /** Returns the ident* of the mode */
 FIRM_API ident *get_mode_ident(const ir_mode *mode);
 
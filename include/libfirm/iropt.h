@@ -59,6 +59,19 @@ FIRM_API void ir_allow_imprecise_float_transforms(int enable);
 /** return 1 if imprecise float transformations are allowed. */
 FIRM_API int ir_imprecise_float_transforms_allowed(void);
 
+/**
+ * enable/disable imprecise floatingpoint optimizations for a single graph.
+ * This enables float reassociation and rules like x*0=0 for code compiled
+ * under a fast-math style contract, while the rest of the program keeps
+ * strict float semantics.
+ */
+FIRM_API void ir_allow_imprecise_float_transforms_irg(ir_graph *irg,
+                                                      int enable);
+
+/** return 1 if imprecise float transformations are allowed for @p irg,
+ * either through the graph's own flag or the global switch. */
+FIRM_API int ir_imprecise_float_transforms_allowed_irg(const ir_graph *irg);
+
 /** @} */
 
 #include "end.h"
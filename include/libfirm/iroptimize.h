@@ -39,6 +39,18 @@ FIRM_API void optimize_cf(ir_graph *irg);
  */
 FIRM_API void opt_jumpthreading(ir_graph* irg);
 
+/**
+ * Performs tail-duplication on the given graph.
+ *
+ * Small join blocks with a single control flow successor are duplicated
+ * behind their hottest predecessor (judged by ir_estimate_execfreq()),
+ * lengthening the straight-line trace on the frequent path and enabling
+ * further folding across the former join.
+ *
+ * @param irg  the graph
+ */
+FIRM_API void opt_tail_duplication(ir_graph *irg);
+
 /**
  * Simplifies boolean expression in the given ir graph.
  * eg. x < 5 && x < 6 becomes x < 5
@@ -84,6 +96,20 @@ typedef int (*check_alloc_entity_func)(ir_entity *ent);
  */
 FIRM_API void optimize_funccalls(void);
 
+/**
+ * Merges calls of pure functions with identical arguments.
+ *
+ * The result of a pure function depends solely on its arguments, so a
+ * call dominated by an equivalent call recomputes already available
+ * values. This pass value-numbers pure calls over the whole graph and
+ * reroutes the results of dominated duplicates to the dominating call,
+ * removing the duplicates from the memory chain. Most effective after
+ * optimize_funccalls() has deduced purity.
+ *
+ * @param irg  the graph
+ */
+FIRM_API void opt_pure_call_cse(ir_graph *irg);
+
 /**
  * Does Partial Redundancy Elimination combined with
  * Global Value Numbering.
@@ -138,6 +164,17 @@ FIRM_API void opt_if_conv_cb(ir_graph *irg, arch_allow_ifconv_func callback);
  */
 FIRM_API void opt_parallelize_mem(ir_graph *irg);
 
+/**
+ * Merges chains of adjacent Load/Store operations, as left behind by
+ * unrolled copy and initialization loops, into single accesses of up to
+ * register width. Copies are only merged when source and destination
+ * ranges are provably independent, constants only when the written
+ * pattern is one repeated byte. Merged accesses are marked unaligned, so
+ * this is only beneficial on targets with cheap misaligned accesses.
+ * @param irg   the graph where memory operations should be merged
+ */
+FIRM_API void opt_merge_mem(ir_graph *irg);
+
 /**
  * Check if we can replace the load by a given const from
  * the const code irg.
@@ -301,6 +338,17 @@ FIRM_API void remove_phi_cycles(ir_graph *irg);
  */
 FIRM_API void proc_cloning(float threshold);
 
+/**
+ * Performs interprocedural constant propagation on the whole program.
+ * Parameters that receive the same constant from every known call site
+ * are replaced by that constant inside the callee, and results of calls
+ * to functions returning the same constant on every path are folded in
+ * the callers. Unlike proc_cloning() the functions are changed in place,
+ * so parameter propagation is limited to functions whose calls are all
+ * known.
+ */
+FIRM_API void opt_ipcp(void);
+
 /**
  * Reassociation.
  *
@@ -370,6 +418,16 @@ FIRM_API void normalize_n_returns(ir_graph *irg);
  */
 FIRM_API void scalar_replacement_opt(ir_graph *irg);
 
+/**
+ * Performs an escape analysis on malloc()/free() calls and rewrites
+ * allocations whose pointer provably never leaves the current function
+ * into frame allocations.  Successfully promoted allocations are handed
+ * to scalar_replacement_opt() afterwards.
+ *
+ * @param irg  the graph which should be optimized
+ */
+FIRM_API void opt_escape_analysis(ir_graph *irg);
+
 /**
  * Optimizes tail-recursion calls by converting them into loops.
  * Depends on the flag opt_tail_recursion.
@@ -414,6 +472,43 @@ typedef void (*opt_ptr)(ir_graph *irg);
 FIRM_API void inline_functions(unsigned maxsize, int inline_threshold,
                                opt_ptr after_inline_opt);
 
+/**
+ * Devirtualize polymorphic calls using the class hierarchy.
+ * A dynamic dispatch through a method entity that the subtype graph
+ * proves to reach exactly one implementation is turned into a direct
+ * reference to that implementation. A dispatch with exactly two
+ * implementations is expanded into a test of the dispatched address
+ * against the first implementation with a direct call on either branch,
+ * so both targets become visible to the inliner. Like the callee
+ * analysis, the type graph is trusted to describe all overriding
+ * implementations of the program.
+ */
+FIRM_API void devirtualize_calls(void);
+
+/**
+ * Speculate on the dominant target of hot indirect calls.
+ * An indirect call whose callee analysis (see cgana()) names exactly one
+ * internal target besides the unknown fallback is expanded into a test
+ * of the call pointer against that target: the passing branch calls it
+ * directly, so the inliner can inline it, and the failing branch keeps
+ * the original indirect call as slow path. Block execution frequencies
+ * (measured ones when profile data is loaded) restrict the expansion to
+ * hot calls. Calls whose pointer provably computes a single target are
+ * rewritten into direct calls without a guard.
+ */
+FIRM_API void opt_guarded_calls(ir_graph *irg);
+
+/**
+ * Merges functions with structurally identical graphs into one body.
+ * Two functions are merged when their graphs are isomorphic: same
+ * operations, modes and attributes connected in the same shape. The
+ * duplicate loses its graph and becomes an alias entity for the kept
+ * body, so all references through its symbol stay valid. Functions
+ * whose address escapes (see cgana()) keep their own body, because
+ * merging them would make distinct function pointers compare equal.
+ */
+FIRM_API void merge_identical_functions(void);
+
 /**
  * Combines congruent blocks into one.
  *
@@ -449,6 +544,53 @@ FIRM_API void unroll_loops(ir_graph *irg, unsigned factor, unsigned maxsize);
  */
 FIRM_API void do_loop_peeling(ir_graph *irg);
 
+/**
+ * Peel off the first iteration of innermost head-controlled loops.
+ * A copy of the loop body is placed on the loop entry edges and executes
+ * at most once, so the first exit test runs on the unchanged entry
+ * values, where constant arguments and dominating Confirm nodes fold it
+ * away; the remaining loop behaves like a foot-controlled one behind the
+ * peeled copy.
+ *
+ * @param irg      the IR-graph to optimize
+ * @param maxsize  the maximum number of nodes in a loop to peel
+ */
+FIRM_API void peel_loops(ir_graph *irg, unsigned maxsize);
+
+/**
+ * Recognize simple loop idioms and replace them by library calls.
+ * Currently byte-wise memory clearing/filling loops are rewritten into
+ * calls to memset().
+ */
+FIRM_API void opt_loop_idiom(ir_graph *irg);
+
+/**
+ * Perform loop-invariant code motion for memory operations on a given
+ * graph. Loads from loop-invariant addresses are moved into the loop
+ * preheader when no operation inside the loop can modify the loaded
+ * memory and the Load is executed on every path through the loop.
+ */
+FIRM_API void opt_licm(ir_graph *irg);
+
+/**
+ * Removes redundant bounds checks on a given graph. A bounds check is a
+ * Cond on a Cmp with one branch leading into a block that traps or calls
+ * a noreturn handler. Checks proven by value ranges or by a dominating
+ * check on the same operands are folded away; per-iteration checks on
+ * the counter of a counted loop are replaced by one widened check on the
+ * loop entry edge, which may make the loop trap earlier than the checked
+ * iteration would have.
+ */
+FIRM_API void opt_bounds_checks(ir_graph *irg);
+
+/**
+ * Run the whole loop optimization pipeline (inversion, unrolling,
+ * operator strength reduction and code placement) on a given graph.
+ * Running the passes back to back lets them share the loop tree and
+ * dominance info as long as no pass transforms the graph.
+ */
+FIRM_API void optimize_loop_nests(ir_graph *irg);
+
 /**
  * Removes all entities which are unused.
  *
@@ -459,6 +601,18 @@ FIRM_API void do_loop_peeling(ir_graph *irg);
  */
 FIRM_API void garbage_collect_entities(void);
 
+/**
+ * Removes entities which are only ever written, together with the stores
+ * writing them.
+ *
+ * An entity qualifies when it has ir_visibility_local and the entity usage
+ * analysis shows neither a read nor a taken address. Qualifying global,
+ * thread local and frame entities are freed; volatile accesses keep an
+ * entity alive. Best run after garbage_collect_entities() so that writes
+ * from removed code do not keep entities in.
+ */
+FIRM_API void remove_write_only_entities(void);
+
 /**
  * Performs dead node elimination by copying the ir graph to a new obstack.
  *
@@ -480,6 +634,21 @@ FIRM_API void garbage_collect_entities(void);
  */
 FIRM_API void dead_node_elimination(ir_graph *irg);
 
+/**
+ * Like dead_node_elimination(), but with control over the node indices:
+ * if @p preserve_node_idx is non-zero every copied node keeps its index,
+ * so index-keyed analysis data stays valid across the compaction;
+ * otherwise the indices are reassigned densely from zero.
+ *
+ * The live nodes are packed into the fresh arena with operands placed
+ * before their users, so walks over the compacted graph touch memory
+ * roughly in traversal order.
+ *
+ * @param irg                The graph to be compacted.
+ * @param preserve_node_idx  If non-zero, node indices are preserved.
+ */
+FIRM_API void ir_compact_graph(ir_graph *irg, int preserve_node_idx);
+
 /**
  * Code Placement.
  *
@@ -496,6 +665,18 @@ FIRM_API void dead_node_elimination(ir_graph *irg);
  */
 FIRM_API void place_code(ir_graph *irg);
 
+/**
+ * Code Placement respecting register pressure.
+ *
+ * Variant of place_code() that consults execution frequency estimates and a
+ * rough per-block register pressure estimate: nodes are only hoisted towards
+ * blocks that actually run less often, and cheap rematerializable
+ * computations stay close to their uses when the hoisting path is already
+ * crowded with values.  This keeps live ranges short where hoisting would
+ * otherwise make the spiller step in.
+ */
+FIRM_API void place_code_pressure_aware(ir_graph *irg);
+
 /**
  * This optimization finds values where the bits are either constant or irrelevant
  * and exchanges them for a corresponding constant.
@@ -98,6 +98,24 @@ FIRM_API int ir_obst_vprintf(struct obstack *obst, const char *fmt,
  */
 FIRM_API int tarval_snprintf(char *buf, size_t buflen, ir_tarval const *tv);
 
+/**
+ * Prints a tarval like the @%T conversion, without going through the
+ * format string parser. The direct emitters below are meant for hot
+ * printers like the graph dumpers, where parsing the format string for
+ * every node is measurable; the result is identical to the
+ * corresponding ir_fprintf() conversion.
+ */
+FIRM_API void ir_fprint_tarval(FILE *f, ir_tarval const *tv);
+
+/** Prints an entity name like the @%F conversion. */
+FIRM_API void ir_fprint_entity(FILE *f, ir_entity const *entity);
+
+/** Prints a type with its number like the @%+F conversion. */
+FIRM_API void ir_fprint_type(FILE *f, ir_type const *type);
+
+/** Prints a node with its number like the @%+F conversion. */
+FIRM_API void ir_fprint_node(FILE *f, ir_node const *node);
+
 /** @} */
 #include "end.h"
 
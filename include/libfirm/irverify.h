@@ -44,6 +44,45 @@ FIRM_API int irg_verify(ir_graph *irg);
  */
 FIRM_API void irg_assert_verify(ir_graph *irg);
 
+/**
+ * Enables (@p enable != 0) or disables recording of nodes created or
+ * exchanged since the last incremental verification. While enabled,
+ * irg_verify_incremental() only checks the recorded nodes instead of
+ * walking the whole graph, which makes verification after every pass
+ * affordable. Recording is not thread-safe, do not combine it with
+ * parallel pass drivers.
+ */
+FIRM_API void ir_verify_enable_incremental(int enable);
+
+/**
+ * Cheap verification tier: calls irn_verify() for all nodes of @p irg
+ * created or exchanged since the last call (and their direct users if out
+ * edges are available). Falls back to a full irg_verify() if incremental
+ * recording is not enabled. Global properties like dominance of uses are
+ * only checked by the full verifier.
+ * @return NON-zero if no problems were found
+ */
+FIRM_API int irg_verify_incremental(ir_graph *irg);
+
+/**
+ * Runs irg_verify() on every graph of the program, distributing the graphs
+ * over @p n_threads worker threads if libFirm was built with thread
+ * support.
+ * @return NON-zero if no problems were found
+ */
+FIRM_API int irp_verify(unsigned n_threads);
+
+/**
+ * Validates the whole program representation: all graphs (irp_verify())
+ * and the type/entity graph (tr_verify()). This is the explicit boundary
+ * check for embedders building with FIRM_FAST_ACCESSORS, where the
+ * internal accessor checks are compiled out: call it after constructing
+ * or modifying IR through the public API instead of relying on asserts
+ * inside the hot pipeline.
+ * @return NON-zero if no problems were found
+ */
+FIRM_API int ir_validate_api_usage(void);
+
 /** @} */
 
 #include "end.h"
@@ -62,6 +62,42 @@ FIRM_API void const *be_jit_get_entity_addr(ir_entity const *entity);
 FIRM_API ir_jit_function_t *be_jit_compile(ir_jit_segment_t *segment,
                                            ir_graph *irg);
 
+/**
+ * Like be_jit_compile() but uses a tier-1 quick-codegen pipeline: the
+ * fastest available scheduler and register allocator are used and copy
+ * optimizations are skipped, trading code quality for compile time.
+ */
+FIRM_API ir_jit_function_t *be_jit_compile_fast(ir_jit_segment_t *segment,
+                                                ir_graph *irg);
+
+/**
+ * Callback invoked on the worker thread when an asynchronously submitted
+ * graph finished compiling. \see be_jit_compile_async()
+ */
+typedef void (*ir_jit_compile_callback_t)(ir_graph *irg,
+                                          ir_jit_function_t *function,
+                                          void *env);
+
+/**
+ * Submit \p irg for compilation on a background worker owned by
+ * \p segment and return immediately; \p callback is invoked with the
+ * result (and \p env) on the worker thread. Compilation itself is
+ * serialized on a global lock since the IR is not thread-safe — the
+ * benefit is that the submitting thread keeps running. The caller must
+ * not modify \p irg or construct new graphs while compiles are pending;
+ * use be_jit_sync() to establish a safe point. Degrades to a synchronous
+ * compile when the toolchain has no thread support.
+ */
+FIRM_API void be_jit_compile_async(ir_jit_segment_t *segment, ir_graph *irg,
+                                   ir_jit_compile_callback_t callback,
+                                   void *env);
+
+/**
+ * Wait until all graphs submitted to \p segment with
+ * be_jit_compile_async() have finished compiling.
+ */
+FIRM_API void be_jit_sync(ir_jit_segment_t *segment);
+
 /**
  * Return the buffer size necessary to emit \p function with be_emit_function().
  */
@@ -72,6 +108,31 @@ FIRM_API unsigned be_get_function_size(ir_jit_function_t const *function);
  */
 FIRM_API void be_emit_function(char *buffer, ir_jit_function_t *function);
 
+/**
+ * Return the buffer size necessary to emit all functions compiled into
+ * \p segment with be_jit_finalize_segment(). This also lays the functions
+ * out, so be_get_function_offset() is valid afterwards.
+ */
+FIRM_API unsigned be_get_segment_size(ir_jit_segment_t *segment);
+
+/**
+ * Return the offset of \p function inside its laid out segment.
+ * Only valid after be_get_segment_size(). Use it to register the final
+ * function addresses with be_jit_set_entity_addr() before finalizing.
+ */
+FIRM_API unsigned be_get_function_offset(ir_jit_function_t const *function);
+
+/**
+ * Emit all functions of \p segment into \p buffer, apply all relocations
+ * in a single pass and flip the page protections of the buffer to
+ * read+execute with one call. \p buffer must provide
+ * be_get_segment_size() bytes on pages not shared with other data.
+ * Since the relocation tables are retained, a segment may be finalized
+ * again into a different buffer, e.g. to compact a code cache.
+ * Returns 1 on success, 0 if changing the page protection failed.
+ */
+FIRM_API int be_jit_finalize_segment(ir_jit_segment_t *segment, char *buffer);
+
 /** @} */
 
 #include "end.h"
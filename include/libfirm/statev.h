@@ -11,6 +11,8 @@
 #ifndef FIRM_STATEVENT_H
 #define FIRM_STATEVENT_H
 
+#include <stddef.h>
+
 #include "begin.h"
 
 /**
@@ -67,6 +69,59 @@ FIRM_API void stat_ev_begin(const char *filename_prefix, const char *filter);
  */
 FIRM_API void stat_ev_end(void);
 
+/**
+ * Enables the binary ring-buffer backend as an alternative to
+ * stat_ev_begin(). Events are appended to fixed-size in-memory records
+ * (one buffer per thread, the oldest records are overwritten when a
+ * buffer is full) instead of being formatted to a file, which is cheap
+ * enough to leave enabled in production. Event keys must stay valid
+ * until the dump; in practice they are string literals.
+ * @param n_records  capacity of each per-thread buffer in records
+ */
+FIRM_API void stat_ev_ring_begin(size_t n_records);
+
+/**
+ * Writes the surviving records of all ring buffers to @p prefix\.ev in
+ * the same text format stat_ev_begin() produces, followed by a
+ * statev_dropped event per buffer counting overwritten records.
+ */
+FIRM_API void stat_ev_ring_dump(const char *prefix);
+
+/**
+ * Shuts down the ring-buffer backend and frees all buffers. Only call
+ * this after worker threads which emitted events have terminated.
+ */
+FIRM_API void stat_ev_ring_end(void);
+
+/**
+ * Adds @p delta to the named per-thread counter. Counters are an
+ * alternative to plain events for high-frequency statistics: each
+ * thread accumulates into its own slot without locking, and the sums
+ * are only materialized when a snapshot is written. @p name must be a
+ * string literal. Does nothing while snapshots are not active.
+ */
+FIRM_API void stat_ev_counter_add(const char *name, unsigned long long delta);
+
+/**
+ * Starts periodic counter snapshots. A background thread aggregates
+ * the per-thread counters every @p interval_ms milliseconds and appends
+ * the sums to @p prefix\.ev in the text event format, each snapshot
+ * wrapped in a statev_snapshot context, so the statistics of a long
+ * compilation can be observed without stopping it. Periodic snapshots
+ * may miss increments that race with the aggregation; the final
+ * snapshot written by stat_ev_snapshot_end() is exact.
+ * @param prefix       output file name (\.ev will be appended)
+ * @param interval_ms  snapshot period; 0 writes only the final snapshot
+ */
+FIRM_API void stat_ev_snapshot_begin(const char *prefix, unsigned interval_ms);
+
+/**
+ * Stops the snapshot thread, writes a final exact snapshot and frees
+ * all counter blocks. Only call this after worker threads which added
+ * to counters have terminated.
+ */
+FIRM_API void stat_ev_snapshot_end(void);
+
 /**
  * This variable indicates whether statev output is enabled.
  */
@@ -82,6 +82,12 @@ FIRM_API int ir_target_supports_pic(void);
  */
 FIRM_API int ir_target_fast_unaligned_memaccess(void);
 
+/**
+ * Returns the widest unit in bytes the target can copy with a single
+ * load/store pair. Used when expanding block copies inline.
+ */
+FIRM_API unsigned ir_target_copy_unit_size(void);
+
 /**
  * Returns supported float arithmetic mode or NULL if mode_D and mode_F
  * are supported natively.
@@ -10,6 +10,8 @@
 #ifndef FIRM_TIMING_H
 #define FIRM_TIMING_H
 
+#include <stdio.h>
+
 #include "begin.h"
 
 /**
@@ -43,6 +45,13 @@ FIRM_API int ir_timer_leave_high_priority(void);
  */
 FIRM_API ir_timer_t *ir_timer_new(void);
 
+/**
+ * Create a new timer carrying a name for reports.
+ * @param name  The name, must stay valid for the timer's lifetime.
+ * @return The timer.
+ */
+FIRM_API ir_timer_t *ir_timer_new_named(const char *name);
+
 /**
  * free memory occupied by a timer
  * @param timer The timer
@@ -114,6 +123,20 @@ FIRM_API unsigned long ir_timer_elapsed_usec(const ir_timer_t *timer);
  */
 FIRM_API double ir_timer_elapsed_sec(const ir_timer_t *timer);
 
+/**
+ * Returns the number of CPU ticks the timer has elapsed. Uses the
+ * cycle counter where available, otherwise falls back to microseconds.
+ */
+FIRM_API unsigned long long ir_timer_elapsed_ticks(const ir_timer_t *timer);
+
+/**
+ * Prints the timer and all timers ever started below it as an indented
+ * tree to @p out. Each line shows the elapsed wall time and CPU ticks;
+ * below the root each timer's share of the ticks spent on its level is
+ * given as a percentage.
+ */
+FIRM_API void ir_timer_print_tree(FILE *out, const ir_timer_t *timer);
+
 #include "end.h"
 
 #endif
@@ -871,6 +871,22 @@ FIRM_API int tr_verify(void);
  */
 FIRM_API void free_type(ir_type *tp);
 
+/**
+ * Unifies @p type with a structurally identical type created earlier.
+ *
+ * Frontends create thousands of structurally identical pointer and method
+ * types; interning them shrinks the type graph and every walk over it.
+ * If an identical type was interned before, @p type is freed and the
+ * canonical representative is returned; otherwise @p type becomes the
+ * representative and is returned unchanged.
+ *
+ * Only pointer, primitive and method types can be interned, and only when
+ * they are complete: the caller must not mutate a type (or free it) after
+ * handing it to this function. Component types are compared by identity,
+ * so interning works bottom-up.
+ */
+FIRM_API ir_type *ir_type_intern(ir_type *type);
+
 /** Returns opcode of type @p type */
 FIRM_API tp_opcode get_type_opcode(const ir_type *type);
 
@@ -1289,6 +1305,15 @@ FIRM_API unsigned get_method_calling_convention(const ir_type *method);
 /** Returns the number of registers parameters, 0 means default. */
 FIRM_API unsigned get_method_n_regparams(ir_type *method);
 
+/** Returns the number of leading hidden pointer parameters through which
+ * compound results are returned, as recorded by the compound lowering.
+ * Zero for types that were not lowered or return no compound in memory. */
+FIRM_API size_t get_method_n_compound_ret_params(const ir_type *method);
+
+/** Records that the first @p n_hidden parameters of @p method are hidden
+ * compound-return pointers, see get_method_n_compound_ret_params(). */
+FIRM_API void set_method_n_compound_ret_params(ir_type *method, size_t n_hidden);
+
 /** Returns true if a type is a method type. */
 FIRM_API int is_Method_type(const ir_type *method);
 
@@ -1453,6 +1478,24 @@ FIRM_API size_t get_compound_member_index(ir_type const *tp,
 /** Remove a member from a compound type. */
 FIRM_API void remove_compound_member(ir_type *compound, ir_entity *entity);
 
+/**
+ * Returns the member of @p tp with name @p name, NULL if there is none.
+ * For compounds with many members a hash index is built lazily behind
+ * the scenes, so repeated lookups are cheap; it is dropped again
+ * whenever members are added, removed or renamed.
+ */
+FIRM_API ir_entity *get_compound_member_by_name(ir_type const *tp,
+                                                ident *name);
+
+/**
+ * Returns the member of @p tp placed exactly at byte offset @p offset,
+ * NULL if there is none. Members without a fixed offset are ignored.
+ * Backed by a lazily built index sorted by offset which is dropped
+ * whenever members are added, removed or moved.
+ */
+FIRM_API ir_entity *get_compound_member_at_offset(ir_type const *tp,
+                                                  int offset);
+
 /**
  * Layout members of a compound type in the default way (as determined
  * by the target ABI). The compound type may not contain bitfield
@@ -1460,6 +1503,17 @@ FIRM_API void remove_compound_member(ir_type *compound, ir_entity *entity);
  */
 FIRM_API void default_layout_compound_type(ir_type *tp);
 
+/**
+ * Applies default_layout_compound_type() to every compound type of the
+ * program whose layout is still undefined. One topological walk over
+ * the type graph lays out member types before the compounds using them,
+ * so shared types are handled exactly once, which is considerably
+ * cheaper than laying out large type hierarchies one compound at a
+ * time. Segment and frame types, compounds with bitfield members and
+ * compounds whose member types cannot be laid out are left untouched.
+ */
+FIRM_API void ir_compute_all_type_layouts(void);
+
 /**
  * Checks whether a type is a compound type.
  *
@@ -1548,6 +1602,49 @@ FIRM_API void type_walk(type_walk_func *pre, type_walk_func *post, void *env);
 FIRM_API void type_walk_irg(ir_graph *irg, type_walk_func *pre,
                             type_walk_func *post, void *env);
 
+/** Walks over all type information reachable from a single entity:
+ *  its type, its owner and, for aliases and initialized entities, the
+ *  types and entities referenced from there. */
+FIRM_API void type_walk_entity(ir_entity *entity, type_walk_func *pre,
+                               type_walk_func *post, void *env);
+
+/**
+ * A snapshot of the types and entities a walk touches, stored in flat
+ * arrays in discovery order. Consumers that traverse the same type
+ * information repeatedly - per-function debug info emitters for
+ * example - take the walk once and iterate the arrays afterwards
+ * instead of paying for a walk each time. The snapshot does not follow
+ * later changes to the type graph; types or entities created or freed
+ * after the snapshot are not reflected.
+ */
+typedef struct type_snapshot_t type_snapshot_t;
+
+/** Creates a snapshot of every type and entity, see type_walk(). */
+FIRM_API type_snapshot_t *create_type_snapshot(void);
+
+/** Creates a snapshot of the type information reachable from @p irg,
+ *  see type_walk_irg(). */
+FIRM_API type_snapshot_t *create_type_snapshot_irg(ir_graph *irg);
+
+/** Returns the number of types in the snapshot. */
+FIRM_API size_t get_type_snapshot_n_types(const type_snapshot_t *snapshot);
+
+/** Returns the type at position @p pos, 0 <= pos < number of types. */
+FIRM_API ir_type *get_type_snapshot_type(const type_snapshot_t *snapshot,
+                                         size_t pos);
+
+/** Returns the number of entities in the snapshot. */
+FIRM_API size_t get_type_snapshot_n_entities(const type_snapshot_t *snapshot);
+
+/** Returns the entity at position @p pos, 0 <= pos < number of
+ *  entities. */
+FIRM_API ir_entity *get_type_snapshot_entity(const type_snapshot_t *snapshot,
+                                             size_t pos);
+
+/** Frees a snapshot created by create_type_snapshot() or
+ *  create_type_snapshot_irg(). */
+FIRM_API void free_type_snapshot(type_snapshot_t *snapshot);
+
 /**
  * Touches every class in specified order:
  *    - first the super class
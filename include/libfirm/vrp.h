@@ -73,6 +73,19 @@ FIRM_API ir_relation vrp_cmp(const ir_node *left, const ir_node *right);
  */
 FIRM_API vrp_attr *vrp_get_info(const ir_node *n);
 
+/**
+ * Returns the vrp data for this node, computing it on demand if it is
+ * missing or has been invalidated by graph modifications since it was
+ * last computed. Unlike set_vrp_data() this does not walk the whole
+ * graph; only the operand cone of @p n (up to a depth limit) is
+ * evaluated and the result is cached for later queries.
+ * Note: only allowed for nodes with an integer mode!
+ *
+ * @param n: the node for which to return the vrp information
+ * @return a pointer to the vrp data or NULL if none can be derived
+ */
+FIRM_API vrp_attr *vrp_get_or_compute_info(ir_node *n);
+
 /** @} */
 
 #include "end.h"
@@ -45,6 +45,16 @@ void *ir_new_arr_d(struct obstack *obstack, size_t nelts, size_t elts_size)
 	return dp->elts;
 }
 
+void *ir_init_arr_d(void *space, size_t nelts)
+{
+	ir_arr_descr *const dp = (ir_arr_descr*)space;
+#ifndef NDEBUG
+	dp->magic = ARR_D_MAGIC;
+#endif
+	dp->allocated = dp->nelts = nelts;
+	return dp->elts;
+}
+
 void *ir_new_arr_f(size_t nelts, size_t elts_size)
 {
 	ir_arr_descr *const dp = (ir_arr_descr*)xmalloc(sizeof(*dp)+elts_size);
@@ -55,6 +65,50 @@ void *ir_new_arr_f(size_t nelts, size_t elts_size)
 	return dp->elts;
 }
 
+void *ir_new_arr_f_reserve(size_t nelts, size_t reserve, size_t eltsize)
+{
+	size_t        const capacity = MAX(nelts, reserve);
+	ir_arr_descr *const dp
+		= (ir_arr_descr*)xmalloc(sizeof(*dp) + eltsize*capacity);
+#ifndef NDEBUG
+	dp->magic = ARR_F_MAGIC;
+#endif
+	dp->allocated = capacity;
+	dp->nelts     = nelts;
+	return dp->elts;
+}
+
+void *ir_arr_reserve(void *elts, size_t capacity, size_t eltsize)
+{
+	ir_verify_arr(elts);
+
+	ir_arr_descr *dp = ARR_DESCR(elts);
+	assert(dp->magic == ARR_F_MAGIC);
+	if (capacity > dp->allocated) {
+		/* keep the geometric growth so a sequence of reservations stays
+		 * amortized like plain appending */
+		size_t n = MAX(1, dp->allocated);
+		while (capacity > n)
+			n <<= 1;
+		dp = (ir_arr_descr*)xrealloc(dp, sizeof(*dp) + eltsize*n);
+		dp->allocated = n;
+	}
+	return dp->elts;
+}
+
+void *ir_arr_shrink_to_fit(void *elts, size_t eltsize)
+{
+	ir_verify_arr(elts);
+
+	ir_arr_descr *dp = ARR_DESCR(elts);
+	assert(dp->magic == ARR_F_MAGIC);
+	if (dp->allocated > dp->nelts) {
+		dp = (ir_arr_descr*)xrealloc(dp, sizeof(*dp) + eltsize*dp->nelts);
+		dp->allocated = dp->nelts;
+	}
+	return dp->elts;
+}
+
 void DEL_ARR_F(void *elts)
 {
 	ir_verify_arr(elts);
@@ -64,7 +118,7 @@ void DEL_ARR_F(void *elts)
 #ifndef NDEBUG
 	dp->magic = 0xdeadbeef;
 #endif
-	free(dp);
+	xfree(dp);
 }
 
 void *ir_arr_setlen(void *elts, size_t nelts, size_t elts_size)
@@ -89,8 +143,6 @@ void *ir_arr_resize(void *elts, size_t nelts, size_t eltsize)
 	size_t n = MAX(1, dp->allocated);
 	while (nelts > n)
 		n <<= 1;
-	while (3*nelts < n)
-		n >>= 1;
 	assert(n >= nelts);
 
 	if (n != dp->allocated) {
@@ -188,7 +188,7 @@ static inline size_t bitset_next_set(bitset_t const *bs, size_t pos)
  * @param elm A size_t variable.
  */
 #define bitset_foreach(bitset, elm) \
-	for (size_t elm = 0; (elm = bitset_next_set((bitset), elm)) != (size_t)-1; ++elm)
+	rbitset_foreach((bitset)->data, (bitset)->size, elm)
 
 
 #define bitset_foreach_clear(bitset, elm) \
@@ -0,0 +1,61 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   implementation of pmap_new
+ * @author  Matthias Braun
+ */
+#include "pmap_new.h"
+
+#include "hashptr.h"
+#include <string.h>
+
+static pmap_new_entry_t null_pmap_new_entry = { NULL, NULL };
+
+/** probing method: quadratic probing */
+#define DO_REHASH
+#define HashSet                   pmap_new_t
+#define HashSetIterator           pmap_new_iterator_t
+#define ValueType                 pmap_new_entry_t
+#define NullValue                 null_pmap_new_entry
+#define KeyType                   void const*
+#define ConstKeyType              void const*
+#define GetKey(value)             (value).key
+#define InitData(self,value,key)  (value).key = (key)
+#define Hash(self,key)            hash_ptr(key)
+#define KeysEqual(self,key1,key2) (key1) == (key2)
+#define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof((ptr)[0]))
+#define EntrySetEmpty(value)      (value).key = NULL
+#define EntrySetDeleted(value)    (value).key = (void const*)-1
+#define EntryIsEmpty(value)       ((value).key == NULL)
+#define EntryIsDeleted(value)     ((value).key == (void const*)-1)
+
+#define hashset_init            pmap_new_init
+#define hashset_init_size       pmap_new_init_size
+#define hashset_destroy         pmap_new_destroy
+pmap_new_entry_t *pmap_new_insert_(pmap_new_t *self, void const *key);
+#define hashset_insert          pmap_new_insert_
+#define hashset_remove          pmap_new_remove
+pmap_new_entry_t *pmap_new_find_(const pmap_new_t *self, void const *key);
+#define hashset_find            pmap_new_find_
+#define hashset_size            pmap_new_size
+#define hashset_iterator_init   pmap_new_iterator_init
+#define hashset_iterator_next   pmap_new_iterator_next
+#define hashset_remove_iterator pmap_new_remove_iterator
+
+#include "hashset.c.h"
+
+void *(pmap_new_get)(const pmap_new_t *self, void const *key)
+{
+	pmap_new_entry_t *entry = pmap_new_find_(self, key);
+	return entry->data;
+}
+
+void pmap_new_insert(pmap_new_t *self, void const *key, void *data)
+{
+	pmap_new_entry_t *entry = pmap_new_insert_(self, key);
+	entry->data             = data;
+}
@@ -0,0 +1,141 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   open addressing hashmap for pointer -> pointer mappings
+ * @author  Matthias Braun
+ *
+ * @note This performs better than pmap in terms of speed and memory usage:
+ *       entries are stored in a flat array instead of per-entry obstack
+ *       allocations chained into buckets. Unlike pmap, iteration order is
+ *       not stable across insertions; use a deterministic key (see
+ *       irnodehashmap) if the iteration order matters.
+ */
+#ifndef FIRM_ADT_PMAP_NEW_H
+#define FIRM_ADT_PMAP_NEW_H
+
+#include <stddef.h>
+
+typedef struct pmap_new_entry_t {
+	void const *key;
+	void       *data;
+} pmap_new_entry_t;
+
+/** @cond PRIVATE */
+
+#define HashSet          pmap_new_t
+#define HashSetIterator  pmap_new_iterator_t
+#define ValueType        pmap_new_entry_t
+#define DO_REHASH
+#include "hashset.h"
+#undef DO_REHASH
+#undef ValueType
+#undef HashSetIterator
+#undef HashSet
+
+/** @endcond */
+
+/** a pointer -> pointer (hash)map */
+typedef struct pmap_new_t          pmap_new_t;
+/** iterator over a pointer map.
+ * @see #pmap_new_t */
+typedef struct pmap_new_iterator_t pmap_new_iterator_t;
+
+/**
+ * Initializes a pmap_new
+ *
+ * @param pmap_new   Pointer to allocated space for the pmap_new
+ */
+void pmap_new_init(pmap_new_t *pmap_new);
+
+/**
+ * Initializes a pmap_new
+ *
+ * @param pmap_new            Pointer to allocated space for the pmap_new
+ * @param expected_elements   Number of elements expected in the pmap_new
+ *                            (roughly)
+ */
+void pmap_new_init_size(pmap_new_t *pmap_new, size_t expected_elements);
+
+/**
+ * Destroys a pmap_new and frees the memory allocated for hashtable. The
+ * memory of the pmap_new itself is not freed.
+ *
+ * @param pmap_new   Pointer to the pmap_new
+ */
+void pmap_new_destroy(pmap_new_t *pmap_new);
+
+/**
+ * Inserts a mapping from @p key to @p data into the map, overwriting an
+ * existing mapping for @p key.
+ *
+ * @param pmap_new  Pointer to the pmap_new
+ * @param key       key to insert into the pmap_new
+ * @param data      data to associate with the key
+ */
+void pmap_new_insert(pmap_new_t *pmap_new, void const *key, void *data);
+
+/**
+ * Removes a key from the map. Does nothing if the map doesn't contain the
+ * key.
+ *
+ * @param pmap_new  Pointer to the pmap_new
+ * @param key       key to remove from the pmap_new
+ */
+void pmap_new_remove(pmap_new_t *pmap_new, void const *key);
+
+/**
+ * Returns the data associated with a key or NULL if the key is not in the
+ * map.
+ *
+ * @param pmap_new   Pointer to the pmap_new
+ * @param key        The key to look up
+ */
+void *pmap_new_get(const pmap_new_t *pmap_new, void const *key);
+
+#define pmap_new_get(type, self, key) ((type*)pmap_new_get((self), (key)))
+
+/**
+ * Returns the number of mappings contained in the map
+ *
+ * @param pmap_new   Pointer to the pmap_new
+ */
+size_t pmap_new_size(const pmap_new_t *pmap_new);
+
+/**
+ * Initializes a pmap_new iterator. Sets the iterator before the first
+ * element in the pmap_new.
+ *
+ * @param iterator   Pointer to already allocated iterator memory
+ * @param pmap_new   Pointer to the pmap_new
+ */
+void pmap_new_iterator_init(pmap_new_iterator_t *iterator,
+                            const pmap_new_t *pmap_new);
+
+/**
+ * Advances the iterator and returns the current element or an entry with a
+ * NULL key if all elements in the pmap_new have been processed.
+ * @attention It is not allowed to use pmap_new_insert or pmap_new_remove
+ * while iterating over a pmap_new.
+ *
+ * @param iterator  Pointer to the pmap_new iterator.
+ * @returns         Next element in the pmap_new or an entry with NULL key
+ */
+pmap_new_entry_t pmap_new_iterator_next(pmap_new_iterator_t *iterator);
+
+/**
+ * Removes the element the iterator currently points to.
+ *
+ * @param pmap_new  Pointer to the pmap_new
+ * @param iterator  Pointer to the pmap_new iterator.
+ */
+void pmap_new_remove_iterator(pmap_new_t *pmap_new,
+                              const pmap_new_iterator_t *iterator);
+
+#define foreach_pmap_new(pmap_new, entry, iter) \
+	for (pmap_new_iterator_init(&iter, pmap_new); (entry = pmap_new_iterator_next(&iter)).key;)
+
+#endif
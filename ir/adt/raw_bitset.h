@@ -92,11 +92,13 @@ static inline unsigned *rbitset_duplicate_obstack_alloc(struct obstack *obst,
  */
 static inline bool rbitset_is_empty(const unsigned *bitset, size_t size)
 {
+	/* accumulate instead of exiting early, so the compiler can unroll and
+	 * vectorize the loop; typical bitsets here are only a few words long */
+	unsigned common = 0;
 	for (size_t i = 0, n = BITSET_SIZE_ELEMS(size); i < n; ++i) {
-		if (bitset[i] != 0)
-			return false;
+		common |= bitset[i];
 	}
-	return true;
+	return common == 0;
 }
 
 /**
@@ -321,6 +323,38 @@ static inline size_t rbitset_next_max(const unsigned *bitset, size_t pos,
 	return res;
 }
 
+/**
+ * Returns the position of the next run of @p width consecutive clear bits
+ * starting from (and including) a given position. Words without clear bits
+ * are skipped via the tzcnt based scans, so this is cheaper than probing
+ * the range bit by bit. Used for example when searching an aligned group
+ * of free registers for a wide value.
+ *
+ * @param bitset  a bitset
+ * @param pos     the first position to check
+ * @param last    first position that is not checked anymore
+ * @param width   length of the clear run to find
+ *
+ * @return the first position where the run starts, (size_t)-1 if there
+ *         is no such run before @p last
+ */
+static inline size_t rbitset_next_clear_range(const unsigned *bitset,
+                                              size_t pos, size_t last,
+                                              size_t width)
+{
+	while (pos + width <= last) {
+		size_t const start = rbitset_next_max(bitset, pos, last, false);
+		if (start == (size_t)-1 || start + width > last)
+			return (size_t)-1;
+		size_t const next_set = rbitset_next_max(bitset, start, start + width,
+		                                         true);
+		if (next_set == (size_t)-1)
+			return start;
+		pos = next_set + 1;
+	}
+	return (size_t)-1;
+}
+
 /**
  * Returns the position of the previous bit starting from (but not including)
  * a given position.
@@ -506,11 +540,12 @@ static inline bool rbitsets_equal(const unsigned *bitset1,
 static inline bool rbitsets_have_common(const unsigned *bitset1,
                                         const unsigned *bitset2, size_t size)
 {
+	/* branch-free accumulation, see rbitset_is_empty() */
+	unsigned common = 0;
 	for (size_t i = 0, n = BITSET_SIZE_ELEMS(size); i < n; ++i) {
-		if ((bitset1[i] & bitset2[i]) != 0)
-			return true;
+		common |= bitset1[i] & bitset2[i];
 	}
-	return false;
+	return common != 0;
 }
 
 /**
@@ -523,11 +558,12 @@ static inline bool rbitsets_have_common(const unsigned *bitset1,
 static inline bool rbitset_contains(const unsigned *bitset1,
                                     const unsigned *bitset2, size_t size)
 {
+	/* branch-free accumulation, see rbitset_is_empty() */
+	unsigned missing = 0;
 	for (size_t i = 0, n = BITSET_SIZE_ELEMS(size); i < n; ++i) {
-		if ((bitset1[i] & bitset2[i]) != bitset1[i])
-			return false;
+		missing |= bitset1[i] & ~bitset2[i];
 	}
-	return true;
+	return missing == 0;
 }
 
 /**
@@ -563,14 +599,55 @@ static inline void rbitset_copy(unsigned *dst, const unsigned *src,
 	memcpy(dst, src, BITSET_SIZE_BYTES(size));
 }
 
+/** Internal state of rbitset_foreach: the not yet visited bits of the
+ * current element and the position of the element. */
+typedef struct rbitset_iterator_t {
+	const unsigned *bitset;
+	unsigned        elem;
+	size_t          elem_pos;
+	size_t          n_elems;
+} rbitset_iterator_t;
+
+/* internal helper: set up an iteration over all set bits */
+static inline rbitset_iterator_t rbitset_iter_begin_(const unsigned *bitset,
+                                                     size_t size)
+{
+	rbitset_iterator_t iter;
+	iter.bitset   = bitset;
+	iter.elem     = size == 0 ? 0 : bitset[0];
+	iter.elem_pos = 0;
+	iter.n_elems  = BITSET_SIZE_ELEMS(size);
+	return iter;
+}
+
+/* internal helper: fetch the next set bit or return false when the end of
+ * the bitset is reached */
+static inline bool rbitset_iter_next_(rbitset_iterator_t *iter, size_t *pos)
+{
+	while (iter->elem == 0) {
+		if (++iter->elem_pos >= iter->n_elems)
+			return false;
+		iter->elem = iter->bitset[iter->elem_pos];
+	}
+	*pos = iter->elem_pos * BITS_PER_ELEM + ntz(iter->elem);
+	/* strip the lowest set bit, the next query continues behind it */
+	iter->elem &= iter->elem - 1;
+	return true;
+}
+
 /**
  * Convenience macro for raw bitset iteration.
+ * Visits all set bits in ascending order. Each element is fetched only once
+ * and stripped bit by bit, which is noticeably faster than rescanning the
+ * bitset with rbitset_next_max() for every single bit.
  * @param bitset The bitset.
  * @param size   Size of the bitset.
  * @param elm    A size_t variable.
  */
 #define rbitset_foreach(bitset, size, elm) \
-	for (size_t elm = 0; (elm = rbitset_next_max((bitset), elm, size, 1)) != (size_t)-1; ++elm)
+	for (bool elm##_once = true; elm##_once;) \
+		for (rbitset_iterator_t elm##_iter = rbitset_iter_begin_((bitset), (size)); elm##_once; elm##_once = false) \
+			for (size_t elm; rbitset_iter_next_(&elm##_iter, &elm);)
 
 /**
  * Convenience macro for raw bitset iteration.
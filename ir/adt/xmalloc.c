@@ -11,10 +11,26 @@
 #include "xmalloc.h"
 
 #include "funcattr.h"
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+static const ir_allocator_t default_allocator = {
+	.alloc   = malloc,
+	.realloc = realloc,
+	.free    = free,
+};
+
+static const ir_allocator_t *allocator = &default_allocator;
+
+void ir_set_allocator(const ir_allocator_t *const new_allocator)
+{
+	assert(new_allocator->alloc != NULL && new_allocator->realloc != NULL
+	       && new_allocator->free != NULL);
+	allocator = new_allocator;
+}
+
 static FIRM_NORETURN xnomem(void)
 {
 	/* Do not use panic() here, because it might try to allocate memory! */
@@ -24,7 +40,7 @@ static FIRM_NORETURN xnomem(void)
 
 void *xmalloc(size_t size)
 {
-	void *res = malloc(size);
+	void *res = allocator->alloc(size);
 
 	if (!res) xnomem();
 	return res;
@@ -33,7 +49,7 @@ void *xmalloc(size_t size)
 void *xrealloc(void *ptr, size_t size)
 {
 	/* ANSI blesses realloc (0, x) but SunOS chokes on it */
-	void *res = ptr ? realloc (ptr, size) : malloc (size);
+	void *res = ptr ? allocator->realloc(ptr, size) : allocator->alloc(size);
 
 	if (!res) xnomem();
 	return res;
@@ -44,3 +60,8 @@ char *xstrdup(const char *str)
 	size_t len = strlen (str) + 1;
 	return (char*) memcpy(xmalloc(len), str, len);
 }
+
+void xfree(void *ptr)
+{
+	allocator->free(ptr);
+}
@@ -13,6 +13,7 @@
 
 #include "array.h"
 #include "cgana.h"
+#include "firm_threads.h"
 #include "hashptr.h"
 #include "irgraph_t.h"
 #include "irgwalk.h"
@@ -21,8 +22,10 @@
 #include "irprog_t.h"
 #include "panic.h"
 #include "pmap.h"
+#include "pset.h"
 #include "raw_bitset.h"
 #include "util.h"
+#include "xmalloc.h"
 #include <stdlib.h>
 
 static ir_visited_t master_cg_visited = 0;
@@ -320,6 +323,240 @@ void callgraph_walk(callgraph_walk_func *pre, callgraph_walk_func *post, void *e
 	}
 }
 
+/** A strongly connected component of the callgraph condensation. */
+typedef struct cg_scc_t cg_scc_t;
+struct cg_scc_t {
+	ir_graph **graphs;   /**< the member graphs */
+	size_t     n_graphs; /**< number of member graphs */
+	cg_scc_t **users;    /**< caller components waiting for this one,
+	                          one entry per cross edge */
+	size_t     n_users;  /**< number of entries in users */
+	size_t     n_deps;   /**< number of unfinished callee cross edges */
+};
+
+/** Per-graph state of the callgraph Tarjan run, kept in the irg link. */
+typedef struct cg_scc_info_t {
+	unsigned  dfn;      /**< depth-first number, 0 while unvisited */
+	unsigned  lowlink;  /**< smallest dfn reachable from here */
+	bool      on_stack; /**< graph sits on the Tarjan stack */
+	cg_scc_t *scc;      /**< component the graph was assigned to */
+} cg_scc_info_t;
+
+typedef struct cg_scc_env_t {
+	struct obstack  obst;     /**< holds infos and components */
+	ir_graph      **stack;    /**< the Tarjan node stack */
+	cg_scc_t      **sccs;     /**< finished components, callees first */
+	unsigned        next_dfn; /**< depth-first numbering state */
+} cg_scc_env_t;
+
+static cg_scc_info_t *get_cg_scc_info(const ir_graph *irg)
+{
+	return (cg_scc_info_t*)get_irg_link(irg);
+}
+
+/**
+ * Tarjan's algorithm over the callee edges. Components are appended to
+ * env->sccs when complete, which happens after all their callees'
+ * components are complete: the resulting order is bottom-up.
+ */
+static void cg_scc_visit(cg_scc_env_t *env, ir_graph *irg)
+{
+	cg_scc_info_t *const info = get_cg_scc_info(irg);
+	info->dfn = info->lowlink = ++env->next_dfn;
+	info->on_stack = true;
+	ARR_APP1(ir_graph*, env->stack, irg);
+
+	for (size_t i = 0, n_callees = get_irg_n_callees(irg); i < n_callees;
+	     ++i) {
+		ir_graph *const callee = get_irg_callee(irg, i);
+		if (callee == NULL)
+			continue;
+		cg_scc_info_t *const callee_info = get_cg_scc_info(callee);
+		if (callee_info->dfn == 0) {
+			cg_scc_visit(env, callee);
+			info->lowlink = MIN(info->lowlink, callee_info->lowlink);
+		} else if (callee_info->on_stack) {
+			info->lowlink = MIN(info->lowlink, callee_info->dfn);
+		}
+	}
+
+	if (info->lowlink != info->dfn)
+		return;
+
+	/* irg is the root of a component: pop its members off the stack. */
+	size_t first = ARR_LEN(env->stack);
+	while (env->stack[--first] != irg) {
+	}
+	size_t const top = ARR_LEN(env->stack);
+
+	cg_scc_t *const scc = OALLOCZ(&env->obst, cg_scc_t);
+	scc->n_graphs = top - first;
+	scc->graphs   = OALLOCN(&env->obst, ir_graph*, scc->n_graphs);
+	for (size_t i = first; i < top; ++i) {
+		ir_graph      *const member      = env->stack[i];
+		cg_scc_info_t *const member_info = get_cg_scc_info(member);
+		member_info->on_stack  = false;
+		member_info->scc       = scc;
+		scc->graphs[i - first] = member;
+	}
+	ARR_SHRINKLEN(env->stack, first);
+	ARR_APP1(cg_scc_t*, env->sccs, scc);
+}
+
+#if FIRM_HAS_THREADS
+/** Shared state of the parallel component walk. */
+typedef struct scc_walk_env_t {
+	cg_scc_t            **ready;        /**< components with no unfinished
+	                                         callees, used as a stack */
+	size_t                n_unfinished; /**< components not yet processed */
+	callgraph_walk_func  *func;
+	void                 *env;
+	firm_mutex_t          lock; /**< protects ready and n_unfinished */
+	firm_cond_t           cond; /**< signalled when ready grows or the
+	                                 walk finishes */
+} scc_walk_env_t;
+
+static int scc_walk_worker(void *data)
+{
+	scc_walk_env_t *const w = (scc_walk_env_t*)data;
+	firm_mutex_lock(&w->lock);
+	while (w->n_unfinished > 0) {
+		size_t const n_ready = ARR_LEN(w->ready);
+		if (n_ready == 0) {
+			/* All ready components are being worked on; their
+			 * completion may ready our next one. */
+			firm_cond_wait(&w->cond, &w->lock);
+			continue;
+		}
+		cg_scc_t *const scc = w->ready[n_ready - 1];
+		ARR_SHRINKLEN(w->ready, n_ready - 1);
+		firm_mutex_unlock(&w->lock);
+
+		for (size_t i = 0; i < scc->n_graphs; ++i)
+			w->func(scc->graphs[i], w->env);
+
+		firm_mutex_lock(&w->lock);
+		--w->n_unfinished;
+		for (size_t i = 0; i < scc->n_users; ++i) {
+			cg_scc_t *const user = scc->users[i];
+			if (--user->n_deps == 0)
+				ARR_APP1(cg_scc_t*, w->ready, user);
+		}
+		firm_cond_broadcast(&w->cond);
+	}
+	firm_mutex_unlock(&w->lock);
+	return 0;
+}
+#endif
+
+void callgraph_scc_walk(callgraph_walk_func *func, void *env,
+                        unsigned n_threads)
+{
+	assert(irp->callgraph_state != irp_callgraph_none);
+
+	cg_scc_env_t scc_env;
+	obstack_init(&scc_env.obst);
+	scc_env.stack    = NEW_ARR_F(ir_graph*, 0);
+	scc_env.sccs     = NEW_ARR_F(cg_scc_t*, 0);
+	scc_env.next_dfn = 0;
+
+	foreach_irp_irg(i, irg) {
+		set_irg_link(irg, OALLOCZ(&scc_env.obst, cg_scc_info_t));
+	}
+	foreach_irp_irg(i, irg) {
+		if (get_cg_scc_info(irg)->dfn == 0)
+			cg_scc_visit(&scc_env, irg);
+	}
+	assert(ARR_LEN(scc_env.stack) == 0);
+	size_t const n_sccs = ARR_LEN(scc_env.sccs);
+
+#if FIRM_HAS_THREADS
+	if (n_threads > n_sccs)
+		n_threads = (unsigned)n_sccs;
+	if (n_threads > 1) {
+		/* Count, allocate and fill the cross edges of the condensation.
+		 * Duplicate edges between two components are left in; they
+		 * increment n_deps and users consistently. */
+		foreach_irp_irg(i, irg) {
+			cg_scc_t *const scc = get_cg_scc_info(irg)->scc;
+			for (size_t c = 0, n_callees = get_irg_n_callees(irg);
+			     c < n_callees; ++c) {
+				ir_graph *const callee = get_irg_callee(irg, c);
+				if (callee == NULL)
+					continue;
+				cg_scc_t *const callee_scc = get_cg_scc_info(callee)->scc;
+				if (callee_scc != scc)
+					++callee_scc->n_users;
+			}
+		}
+		for (size_t s = 0; s < n_sccs; ++s) {
+			cg_scc_t *const scc = scc_env.sccs[s];
+			scc->users   = OALLOCN(&scc_env.obst, cg_scc_t*, scc->n_users);
+			scc->n_users = 0; /* reused as fill index below */
+		}
+		foreach_irp_irg(i, irg) {
+			cg_scc_t *const scc = get_cg_scc_info(irg)->scc;
+			for (size_t c = 0, n_callees = get_irg_n_callees(irg);
+			     c < n_callees; ++c) {
+				ir_graph *const callee = get_irg_callee(irg, c);
+				if (callee == NULL)
+					continue;
+				cg_scc_t *const callee_scc = get_cg_scc_info(callee)->scc;
+				if (callee_scc != scc) {
+					callee_scc->users[callee_scc->n_users++] = scc;
+					++scc->n_deps;
+				}
+			}
+		}
+
+		scc_walk_env_t walk_env;
+		walk_env.ready        = NEW_ARR_F(cg_scc_t*, 0);
+		walk_env.n_unfinished = n_sccs;
+		walk_env.func         = func;
+		walk_env.env          = env;
+		firm_mutex_init(&walk_env.lock);
+		firm_cond_init(&walk_env.cond);
+		for (size_t s = 0; s < n_sccs; ++s) {
+			if (scc_env.sccs[s]->n_deps == 0)
+				ARR_APP1(cg_scc_t*, walk_env.ready, scc_env.sccs[s]);
+		}
+
+		firm_thread_t *workers = XMALLOCN(firm_thread_t, n_threads);
+		unsigned       started = 0;
+		for (unsigned t = 0; t < n_threads; ++t) {
+			if (!firm_thread_create(&workers[t], scc_walk_worker,
+			                        &walk_env))
+				break;
+			++started;
+		}
+		if (started == 0)
+			scc_walk_worker(&walk_env);
+		for (unsigned t = 0; t < started; ++t)
+			firm_thread_join(workers[t]);
+		free(workers);
+		firm_cond_destroy(&walk_env.cond);
+		firm_mutex_destroy(&walk_env.lock);
+		DEL_ARR_F(walk_env.ready);
+		goto done;
+	}
+#else
+	(void)n_threads;
+#endif
+	/* Serial walk: the emission order is already bottom-up. */
+	for (size_t s = 0; s < n_sccs; ++s) {
+		cg_scc_t *const scc = scc_env.sccs[s];
+		for (size_t i = 0; i < scc->n_graphs; ++i)
+			func(scc->graphs[i], env);
+	}
+
+#if FIRM_HAS_THREADS
+done:
+#endif
+	DEL_ARR_F(scc_env.sccs);
+	DEL_ARR_F(scc_env.stack);
+	obstack_free(&scc_env.obst, NULL);
+}
+
 static ir_graph *outermost_ir_graph;   /**< The outermost graph the scc is computed
                                             for */
 static ir_loop *current_loop;      /**< Current cfloop construction is working
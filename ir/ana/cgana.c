@@ -33,6 +33,7 @@
 #include "irtools.h"
 #include "panic.h"
 #include "pmap.h"
+#include "pset.h"
 #include "xmalloc.h"
 
 /* unambiguous address used as a mark. */
@@ -640,7 +641,9 @@ static void callee_ana(void)
 	foreach_irp_irg(i, irg) {
 		assure_irg_properties(irg, IR_GRAPH_PROPERTY_NO_TUPLES);
 		ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
-		irg_walk_graph(irg, callee_walker, NULL, NULL);
+		/* clear the marks the free method analysis left behind, they
+		 * would cut the address traversal short */
+		irg_walk_graph(irg, firm_clear_link, callee_walker, NULL);
 		ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
 		set_irg_callee_info_state(irg, irg_callee_info_consistent);
 	}
@@ -10,12 +10,15 @@
  */
 #include "constbits.h"
 
+#include "callgraph.h"
 #include "debug.h"
 #include "iredges_t.h"
 #include "irgwalk.h"
+#include "irmemory.h"
 #include "irnode_t.h"
 #include "irnodemap.h"
 #include "iropt.h"
+#include "pdeq.h"
 #include <assert.h>
 
 #ifndef VERIFY_CONSTBITS
@@ -168,8 +171,182 @@ static bitinfo *get_bitinfo_direct(ir_node const *const irn)
 	return b;
 }
 
+bitinfo *get_bitinfo_slot(ir_node const *const irn)
+{
+	ir_graph   *const irg = get_irn_irg(irn);
+	ir_nodemap *const map = &irg->bitinfo.map;
+	bitinfo          *b   = ir_nodemap_get(bitinfo, map, irn);
+	if (b == NULL) {
+		b = OALLOCZ(&irg->bitinfo.obst, bitinfo);
+		/* top: nothing is known about the value's bits */
+		ir_mode *const mode = get_irn_mode(irn);
+		if (mode_is_intb(mode)) {
+			b->z = get_mode_all_one(mode);
+			b->o = get_mode_null(mode);
+		} else {
+			b->z = tarval_b_true;
+			b->o = tarval_b_false;
+		}
+		b->state = BITINFO_VALID;
+		ir_nodemap_insert(map, irn, b);
+	}
+	return b;
+}
+
 static void calc_bitinfo(ir_node const *irn, bitinfo *b);
 
+/** A node whose transfer function read the bit information of another node
+ * without being its user; kept so changes still trigger a re-evaluation. */
+typedef struct bitinfo_dep_t {
+	struct bitinfo_dep_t *next;
+	ir_node const        *dependent;
+} bitinfo_dep_t;
+
+static void register_hidden_dep(ir_node const *const value,
+                                ir_node const *const dependent)
+{
+	ir_graph   *const irg = get_irn_irg(value);
+	ir_nodemap *const map = &irg->bitinfo.deps;
+	bitinfo_dep_t *const head = ir_nodemap_get(bitinfo_dep_t, map, value);
+	for (bitinfo_dep_t *d = head; d != NULL; d = d->next) {
+		if (d->dependent == dependent)
+			return;
+	}
+	bitinfo_dep_t *const dep = OALLOC(&irg->bitinfo.obst, bitinfo_dep_t);
+	dep->next      = head;
+	dep->dependent = dependent;
+	ir_nodemap_insert(map, value, dep);
+}
+
+/**
+ * Tries to find the value a Load from a frame entity will read by walking
+ * the memory chain to the dominating Store. Only entities whose address is
+ * never taken are tracked: nothing but Loads and Stores through their
+ * Member can touch them, so Calls and Stores to non-aliasing addresses are
+ * transparent.
+ */
+static ir_node *find_local_stored_value(ir_node const *const load)
+{
+	if (get_Load_volatility(load) == volatility_is_volatile)
+		return NULL;
+	ir_node *const ptr = get_Load_ptr(load);
+	if (!is_Member(ptr))
+		return NULL;
+	ir_graph *const irg = get_irn_irg(load);
+	if (get_Member_ptr(ptr) != get_irg_frame(irg))
+		return NULL;
+	ir_entity *const entity = get_Member_entity(ptr);
+	if (get_entity_usage(entity)
+	    & (ir_usage_address_taken | ir_usage_reinterpret_cast))
+		return NULL;
+
+	ir_mode *const mode      = get_Load_mode(load);
+	ir_type *const load_type = get_Load_type(load);
+	unsigned const load_size = get_mode_size_bytes(mode);
+	for (ir_node *mem = get_Load_mem(load);;) {
+		if (!is_Proj(mem))
+			return NULL;
+		ir_node *const pred = get_Proj_pred(mem);
+		if (is_Store(pred)) {
+			if (get_Store_ptr(pred) == ptr) {
+				ir_node *const value = get_Store_value(pred);
+				/* a Store of another mode only overwrites parts */
+				return get_irn_mode(value) == mode ? value : NULL;
+			}
+			ir_node *const store_value = get_Store_value(pred);
+			if (get_alias_relation(get_Store_ptr(pred), get_Store_type(pred),
+			                       get_mode_size_bytes(get_irn_mode(store_value)),
+			                       ptr, load_type, load_size) != ir_no_alias)
+				return NULL;
+			mem = get_Store_mem(pred);
+		} else if (is_Load(pred)) {
+			mem = get_Load_mem(pred);
+		} else if (is_Call(pred)) {
+			/* Calls cannot modify a local whose address never escaped. */
+			mem = get_Call_mem(pred);
+		} else {
+			return NULL;
+		}
+	}
+}
+
+/** Bit information of the parameters, joined over the arguments of all
+ * call sites; NULL entries mean top. Only valid while a private function
+ * with consistent callgraph information is being analyzed. */
+static size_t      n_param_bits;
+static ir_tarval **param_z;
+static ir_tarval **param_o;
+
+typedef struct param_scan_env_t {
+	ir_entity *entity; /**< the called entity the arguments belong to */
+} param_scan_env_t;
+
+/**
+ * Walker: join the bit information of the arguments of every call to the
+ * analyzed function into the parameter info. Only Const arguments
+ * contribute, other graphs carry no bit information at this point.
+ */
+static void scan_call_args(ir_node *const node, void *const data)
+{
+	param_scan_env_t *const env = (param_scan_env_t*)data;
+	if (!is_Call(node) || get_Call_callee(node) != env->entity)
+		return;
+
+	for (size_t i = 0, n = get_Call_n_params(node); i < n_param_bits; ++i) {
+		if (param_z[i] == NULL)
+			continue;
+		ir_node *const arg = i < n ? get_Call_param(node, i) : NULL;
+		if (arg != NULL && is_Const(arg)
+		    && get_tarval_mode(get_Const_tarval(arg))
+		       == get_tarval_mode(param_z[i])) {
+			ir_tarval *const tv = get_Const_tarval(arg);
+			param_z[i] = tarval_or( param_z[i], tv);
+			param_o[i] = tarval_and(param_o[i], tv);
+		} else {
+			param_z[i] = NULL;
+		}
+	}
+}
+
+/**
+ * Computes bit information for the parameters of @p irg from the arguments
+ * of its call sites. This is only sound for private functions, all their
+ * callers are listed in the callgraph.
+ */
+static void compute_param_bits(ir_graph *const irg)
+{
+	n_param_bits = 0;
+	if (get_irp_callgraph_state() != irp_callgraph_consistent)
+		return;
+	ir_entity *const entity = get_irg_entity(irg);
+	if (!(get_entity_additional_properties(entity) & mtp_property_private))
+		return;
+
+	ir_type *const mtp      = get_entity_type(entity);
+	size_t   const n_params = get_method_n_params(mtp);
+	if (n_params == 0)
+		return;
+
+	struct obstack *const obst = &irg->bitinfo.obst;
+	param_z = OALLOCN(obst, ir_tarval*, n_params);
+	param_o = OALLOCN(obst, ir_tarval*, n_params);
+	for (size_t i = 0; i < n_params; ++i) {
+		ir_mode *const mode = get_type_mode(get_method_param_type(mtp, i));
+		if (mode != NULL && mode_is_intb(mode)) {
+			param_z[i] = get_mode_null(mode);
+			param_o[i] = get_mode_all_one(mode);
+		} else {
+			param_z[i] = NULL;
+		}
+	}
+	n_param_bits = n_params;
+
+	param_scan_env_t env = { .entity = entity };
+	for (size_t i = 0, n = get_irg_n_callers(irg); i < n; ++i) {
+		irg_walk_graph(get_irg_caller(irg, i), scan_call_args, NULL, &env);
+	}
+}
+
 /**
  * Get analysis information for node @p irn.
  *
@@ -737,6 +914,29 @@ undefined:
 						o = b->o;
 						goto set_info;
 					}
+					if (is_Load(pred) && get_Proj_num(irn) == pn_Load_res) {
+						ir_node *const value = find_local_stored_value(pred);
+						if (value != NULL) {
+							bitinfo *const b = get_bitinfo_recursive(value);
+							if (b != NULL) {
+								/* The stored value is no operand of the Proj,
+								 * so record the dependency explicitly. */
+								register_hidden_dep(value, irn);
+								z = b->z;
+								o = b->o;
+								goto set_info;
+							}
+						}
+					} else if (is_Proj(pred) && is_Start(get_Proj_pred(pred))
+					           && get_Proj_num(pred) == pn_Start_T_args) {
+						unsigned const num = get_Proj_num(irn);
+						if (num < n_param_bits && param_z[num] != NULL
+						    && get_tarval_mode(param_z[num]) == m) {
+							z = param_z[num];
+							o = param_o[num];
+							goto set_info;
+						}
+					}
 					goto cannot_analyse;
 				}
 
@@ -760,7 +960,9 @@ set_info:;
 	return changed;
 }
 
-static void trigger_users(ir_node const *irn);
+/** Work list of nodes marked BITINFO_UNSTABLE.  The state serves as O(1)
+ * membership test, so every node is queued at most once. */
+static deq_t unstable_queue;
 
 static void trigger(ir_node const *const irn, ir_node const *const operand)
 {
@@ -770,7 +972,7 @@ static void trigger(ir_node const *const irn, ir_node const *const operand)
 	if (b && b->state == BITINFO_VALID) {
 		DB((dbg, LEVEL_5, "%+F triggers %+F\n", operand, irn));
 		b->state = BITINFO_UNSTABLE;
-		trigger_users(irn);
+		deq_push_pointer_right(&unstable_queue, (ir_node*)irn);
 	} else {
 		DB((dbg, LEVEL_5, "%+F does not trigger %+F\n", operand, irn));
 	}
@@ -781,6 +983,12 @@ static void trigger_users(ir_node const *const irn)
 	if (is_Bad(irn))
 		return;
 
+	ir_nodemap *const deps = &get_irn_irg(irn)->bitinfo.deps;
+	for (bitinfo_dep_t *dep = ir_nodemap_get(bitinfo_dep_t, deps, irn);
+	     dep != NULL; dep = dep->next) {
+		trigger(dep->dependent, irn);
+	}
+
 	if (is_Block(irn)) {
 		/* Blocks just trigger the jump nodes inside.  The value of all other nodes
 		 * should not depend on the reachability of the block. */
@@ -876,21 +1084,39 @@ void constbits_analyze(ir_graph *const irg)
 	DB((dbg, LEVEL_1, "---> activating constbits for %+F\n", irg));
 
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
+	assure_irg_entity_usage_computed(irg);
 
 	obstack_init(&irg->bitinfo.obst);
 	ir_nodemap_init(&irg->bitinfo.map, irg);
+	ir_nodemap_init(&irg->bitinfo.deps, irg);
+	compute_param_bits(irg);
+	deq_init(&unstable_queue);
 	get_bitinfo_func = &get_bitinfo_recursive;
-	irg_walk_graph(irg, NULL, calc_bitinfo_walker, NULL);
+	ir_node **order;
+	for (size_t i = 0, n = ir_get_topo_order(irg, &order); i < n; ++i) {
+		calc_bitinfo_walker(order[i], NULL);
+	}
+	/* Revisit nodes whose operands changed after they were computed.  Nodes
+	 * are skipped if a recursive query recomputed them in the meantime. */
+	while (!deq_empty(&unstable_queue)) {
+		ir_node *const irn = deq_pop_pointer_left(ir_node, &unstable_queue);
+		bitinfo *const b   = get_bitinfo_direct(irn);
+		if (b->state == BITINFO_UNSTABLE)
+			get_bitinfo_recursive(irn);
+	}
 	get_bitinfo_func = &get_bitinfo_direct;
+	deq_free(&unstable_queue);
 
 #if VERIFY_CONSTBITS
 	verify_constbits(irg);
 #endif
+	n_param_bits = 0;
 }
 
 void constbits_clear(ir_graph *const irg)
 {
 	get_bitinfo_func = &get_bitinfo_null;
 	ir_nodemap_destroy(&irg->bitinfo.map);
+	ir_nodemap_destroy(&irg->bitinfo.deps);
 	obstack_free(&irg->bitinfo.obst, NULL);
 }
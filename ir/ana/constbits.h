@@ -15,12 +15,21 @@ typedef struct bitinfo
 {
 	ir_tarval    *z; /**< safe zeroes, 0 = bit is zero,       1 = bit maybe is 1 */
 	ir_tarval    *o; /**< safe ones,   0 = bit maybe is zero, 1 = bit is 1 */
+	ir_tarval    *dc; /**< relevant bits, 0 = don't care, 1 = bit may matter;
+	                       filled in by dca_analyze(), NULL before */
 	bitinfo_state state;
 } bitinfo;
 
 /** Get analysis information for node irn */
 bitinfo *get_bitinfo(ir_node const *irn);
 
+/**
+ * Get the analysis record for @p irn, creating an entry with top bit
+ * information if none exists yet. Used by analyses which store additional
+ * facts in the record, like dca_analyze().
+ */
+bitinfo *get_bitinfo_slot(ir_node const *irn);
+
 /**
  * Get analysis information for @p irn, if it is available.
  *
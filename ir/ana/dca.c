@@ -12,6 +12,11 @@
  * determining whether bits in integer mode nodes are relevant(1) or
  * irrelevant(0) for the program's computation.
  *
+ * The result is stored in the dc field of the nodes' bitinfo records,
+ * next to the known-bits facts of constbits, which must have been
+ * computed before: the transfer functions here sharpen their masks with
+ * the z/o information of the operands.
+ *
  * In combination with the VRP bitinfo, it ought to become the basis
  * for an improved Conv optimization.  It also allows finding
  * additional constants (vrp->z ^ vrp->o & dc == 0).
@@ -39,8 +44,9 @@ static void care_for(ir_node *irn, ir_tarval *care)
 		care = tarval_b_true;
 
 	/* Assume worst case if modes don't match and care has bits set. */
-	ir_tarval *old_care = (ir_tarval *)get_irn_link(irn);
-	ir_mode   *mode     = get_tarval_mode(old_care);
+	bitinfo   *const b        = get_bitinfo_slot(irn);
+	ir_tarval *const old_care = b->dc;
+	ir_mode   *const mode     = get_tarval_mode(old_care);
 	if (mode != get_tarval_mode(care))
 		care = tarval_is_null(care) ? get_mode_null(mode)
 		                            : get_mode_all_one(mode);
@@ -51,7 +57,7 @@ static void care_for(ir_node *irn, ir_tarval *care)
 	if (care != old_care) {
 		DBG((dbg, LEVEL_3, "queueing %+F: %T->%T\n", irn, old_care, care));
 		assert(old_care != tarval_b_true || care == tarval_b_true);
-		set_irn_link(irn, (void *)care);
+		b->dc = care;
 		deq_push_pointer_right(&worklist, irn);
 	} else {
 		DBG((dbg, LEVEL_3, "no change on %+F: %T\n", irn, old_care, care));
@@ -92,7 +98,7 @@ static void dca_transfer(ir_node *irn)
 {
 	DBG((dbg, LEVEL_2, "analysing %+F\n", irn));
 
-	ir_tarval *care = get_irn_link(irn);
+	ir_tarval *care = get_bitinfo_slot(irn)->dc;
 	if (is_Block(irn)) {
 		for (int i = 0; i < get_Block_n_cfgpreds(irn); i++)
 			care_for(get_Block_cfgpred(irn, i), care);
@@ -401,8 +407,8 @@ static void dca_init_node(ir_node *n, void *data)
 	(void)data;
 
 	ir_mode *m = get_irn_mode(n);
-	set_irn_link(n, (void *) (mode_is_int(m) ?
-	             get_mode_null(m) : tarval_b_false));
+	get_bitinfo_slot(n)->dc = mode_is_int(m) ? get_mode_null(m)
+	                                         : tarval_b_false;
 }
 
 void dca_analyze(ir_graph *irg)
@@ -413,9 +419,6 @@ void dca_analyze(ir_graph *irg)
 
 	assert(tarval_get_wrap_on_overflow());
 
-	assert(((ir_resources_reserved(irg) & IR_RESOURCE_IRN_LINK) != 0) &&
-	       "user of dc analysis must reserve links");
-
 	irg_walk_graph(irg, dca_init_node, NULL, 0);
 
 	deq_init(&worklist);
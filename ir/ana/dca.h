@@ -5,7 +5,9 @@
 
 /**
  * Compute don't care bits.
- * The result is available via links to tarvals.
+ * constbits_analyze() must have been run on the graph before. The result
+ * is stored in the dc field of the nodes' bitinfo records and stays
+ * available until constbits_clear() is called.
  */
 void dca_analyze(ir_graph *irg);
 
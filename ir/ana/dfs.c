@@ -15,6 +15,7 @@
 
 #define DISABLE_STATEV
 
+#include "hashptr.h"
 #include "irdom_t.h"
 #include "iredges_t.h"
 #include "irgraph_t.h"
@@ -10,10 +10,11 @@
  * @date        04.05.2005
  */
 #include "array.h"
-#include "irdom.h"
+#include "irdom_t.h"
 #include "iredges_t.h"
-#include "obst.h"
-#include "pmap.h"
+#include "irgraph_t.h"
+#include "util.h"
+#include "xmalloc.h"
 
 /**
  * A wrapper for get_Block_idom.
@@ -32,11 +33,13 @@ static inline ir_node *get_idom(ir_node *bl)
 /**
  * Compute the dominance frontier for a given block.
  *
- * @param blk   the block where the calculation starts
+ * @param blk        the block where the calculation starts
+ * @param tmp_lists  per dominator tree pre-order number temporary frontier
+ *                   lists, filled by this function
  *
  * @return the list of all blocks in the dominance frontier of blk
  */
-static ir_node **compute_df(ir_node *blk, ir_dom_front_info_t *info)
+static ir_node **compute_df(ir_node *blk, ir_node ***tmp_lists)
 {
 	ir_node **df_list = NEW_ARR_F(ir_node *, 0);
 
@@ -56,7 +59,7 @@ static ir_node **compute_df(ir_node *blk, ir_dom_front_info_t *info)
 	 */
 	for (ir_node *c = get_Block_dominated_first(blk); c != NULL;
 	     c = get_Block_dominated_next(c)) {
-		ir_node **df_c_list = compute_df(c, info);
+		ir_node **df_c_list = compute_df(c, tmp_lists);
 
 		for (size_t i = ARR_LEN(df_c_list); i-- > 0;) {
 			ir_node *w = df_c_list[i];
@@ -65,12 +68,8 @@ static ir_node **compute_df(ir_node *blk, ir_dom_front_info_t *info)
 		}
 	}
 
-	/* now copy the flexible array to the obstack */
-	ir_node **const df = DUP_ARR_D(ir_node*, &info->obst, df_list);
-	DEL_ARR_F(df_list);
-
-	pmap_insert(info->df_map, blk, df);
-	return df;
+	tmp_lists[get_Block_dom_tree_pre_num(blk)] = df_list;
+	return df_list;
 }
 
 void ir_compute_dominance_frontiers(ir_graph *irg)
@@ -79,9 +78,34 @@ void ir_compute_dominance_frontiers(ir_graph *irg)
 
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
 	                         | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
-	obstack_init(&info->obst);
-	info->df_map = pmap_create();
-	compute_df(get_irg_start_block(irg), info);
+	ir_node  *const start_block = get_irg_start_block(irg);
+	unsigned  const n_blocks
+		= get_Block_dom_max_subtree_pre_num(start_block) + 1;
+
+	ir_node ***const tmp_lists = XMALLOCNZ(ir_node**, n_blocks);
+	compute_df(start_block, tmp_lists);
+
+	/* pack the per-block lists into a single compressed array */
+	size_t total = 0;
+	for (unsigned i = 0; i < n_blocks; ++i) {
+		if (tmp_lists[i] != NULL)
+			total += ARR_LEN(tmp_lists[i]);
+	}
+	info->data    = XMALLOCN(ir_node*, total);
+	info->offsets = XMALLOCN(unsigned, n_blocks + 1);
+	size_t pos = 0;
+	for (unsigned i = 0; i < n_blocks; ++i) {
+		info->offsets[i] = pos;
+		ir_node **const df_list = tmp_lists[i];
+		if (df_list != NULL) {
+			size_t const len = ARR_LEN(df_list);
+			MEMCPY(&info->data[pos], df_list, len);
+			pos += len;
+			DEL_ARR_F(df_list);
+		}
+	}
+	info->offsets[n_blocks] = pos;
+	free(tmp_lists);
 
 	add_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE_FRONTIERS);
 }
@@ -91,12 +115,13 @@ void ir_free_dominance_frontiers(ir_graph *irg)
 	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE_FRONTIERS);
 
 	ir_dom_front_info_t *info = &irg->domfront;
-	if (info->df_map == NULL)
+	if (info->offsets == NULL)
 		return;
 
-	obstack_free(&info->obst, NULL);
-	pmap_destroy(info->df_map);
-	info->df_map = NULL;
+	free(info->data);
+	free(info->offsets);
+	info->data    = NULL;
+	info->offsets = NULL;
 }
 
 /* Get the dominance frontier of a block. */
@@ -104,5 +129,17 @@ ir_node **ir_get_dominance_frontier(const ir_node *block)
 {
 	ir_graph            *irg  = get_irn_irg(block);
 	ir_dom_front_info_t *info = &irg->domfront;
-	return pmap_get(ir_node*, info->df_map, block);
+	if (info->offsets == NULL)
+		ir_compute_dominance_frontiers(irg);
+	return &info->data[info->offsets[get_Block_dom_tree_pre_num(block)]];
+}
+
+size_t ir_get_dominance_frontier_size(const ir_node *block)
+{
+	ir_graph            *irg  = get_irn_irg(block);
+	ir_dom_front_info_t *info = &irg->domfront;
+	if (info->offsets == NULL)
+		ir_compute_dominance_frontiers(irg);
+	unsigned const pre_num = get_Block_dom_tree_pre_num(block);
+	return info->offsets[pre_num + 1] - info->offsets[pre_num];
 }
@@ -29,6 +29,7 @@
 
 #include "dfs_t.h"
 #include "gaussjordan.h"
+#include "gaussseidel.h"
 #include "hashptr.h"
 #include "iredges_t.h"
 #include "irgraph_t.h"
@@ -53,6 +54,15 @@
 
 #define MAX_INT_FREQ 1000000
 
+/** Up to this many blocks the dense QR solver is used; it is exact and the
+ * matrix still fits comfortably into the cache.  Larger graphs are solved
+ * iteratively on a sparse matrix. */
+#define DENSE_SOLVER_MAX_BLOCKS 64
+
+/** Convergence control for the iterative solver. */
+#define SEIDEL_TOLERANCE 1e-7
+#define SEIDEL_MAX_STEPS 1000
+
 static hook_entry_t hook;
 
 typedef struct {
@@ -435,33 +445,17 @@ static void free_properties_and_dfs(ir_graph *const irg, dfs_t *const dfs) {
 	dfs_free(dfs);
 }
 
-void ir_estimate_execfreq(ir_graph *irg)
+/**
+ * Solve the frequency system exactly with the dense QR solver.
+ * Simple substitution chains are eliminated beforehand, so the matrix
+ * handed to nullspace() only contains the blocks involved in cycles.
+ *
+ * Returns false when the solution contains invalid frequencies.
+ */
+static bool solve_lgs_dense(ir_graph *const irg, dfs_t *const dfs,
+                            double const inv_loop_weight)
 {
-	double loop_weight = 10.0;
-
-	assure_irg_properties(irg,
-		IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
-		| IR_GRAPH_PROPERTY_NO_BADS
-		| IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
-		| IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
-
-	/* compute a DFS.
-	 * using a toposort on the CFG (without back edges) will propagate
-	 * the values better for the gauss/seidel iteration.
-	 * => they can "flow" from start to end. */
-	dfs_t *const dfs = dfs_new(irg);
-
-	unsigned       size   = dfs_get_n_nodes(dfs);
-
-	/* It is undesirable to allocate more than 2GB for the matrix */
-	if (size*size*sizeof(double) > 1 << 30) {
-		if (!fallback_loop_weight(dfs, loop_weight)) {
-			fallback_all_ones(dfs);
-		}
-		dfs_free(dfs);
-		return;
-	}
-
+	unsigned size = dfs_get_n_nodes(dfs);
 
 	square_matrix *in_fac = mat_create(size);
 	for (unsigned r = 0; r < size; r++) {
@@ -471,31 +465,12 @@ void ir_estimate_execfreq(ir_graph *irg)
 	}
 
 
-	ir_node *const start_block = get_irg_start_block(irg);
-	ir_node *const end_block   = get_irg_end_block(irg);
-	const int      end_idx     = size - dfs_get_post_num(dfs, end_block) - 1;
-
-	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED
-	                          | IR_RESOURCE_IRN_VISITED
-	                          | IR_RESOURCE_IRN_LINK);
-	inc_irg_block_visited(irg);
-
-	/* mark all blocks reachable from end_block as (block)visited
-	 * (so we can detect places like endless-loops/noreturn calls which
-	 *  do not reach the End block) */
-	block_walk_no_keeps(end_block);
-	/* mark all kept blocks as (node)visited */
-	inc_irg_visited(irg);
+	ir_node *const start_block  = get_irg_start_block(irg);
+	ir_node *const end_block    = get_irg_end_block(irg);
+	const int      end_idx      = size - dfs_get_post_num(dfs, end_block) - 1;
 	const ir_node *end          = get_irg_end(irg);
 	int const      n_keepalives = get_End_n_keepalives(end);
-	for (int k = n_keepalives - 1; k >= 0; --k) {
-		ir_node *keep = get_End_keepalive(end, k);
-		if (is_Block(keep)) {
-			mark_irn_visited(keep);
-		}
-	}
 
-	double const inv_loop_weight = 1.0 / loop_weight;
 	/* lgs_to_mat[i] is the index of the block represented by the
 	 * i-th row/column in the LGS matrix. */
 	int *lgs_to_mat = NEW_ARR_F(int, 0);
@@ -638,6 +613,167 @@ void ir_estimate_execfreq(ir_graph *irg)
 	}
 
 	DEL_ARR_F(freqs);
+	DEL_ARR_F(lgs_to_mat);
+	DEL_ARR_F(mat_to_lgs);
+	free(in_fac);
+	free(lgs_matrix);
+	DEL_ARR_F(lgs_x);
+	return valid_freq;
+}
+
+/**
+ * Solve the frequency system iteratively on a sparse matrix.
+ *
+ * The system is x = in_fac * x, i.e. we search the nullspace of
+ * (in_fac - I).  Every solution of that singular system is a fixed point
+ * of a Gauss-Seidel sweep, and since the outgoing probabilities of each
+ * block sum up to 1.0 the flow injected by the seed vector is conserved,
+ * so the iteration converges to a non-trivial solution.  Sweeping the
+ * rows in DFS toposort order lets the values "flow" from start to end,
+ * which keeps the number of sweeps low on reducible CFGs.
+ *
+ * Returns false when the iteration did not converge or produced invalid
+ * frequencies.
+ */
+static bool solve_lgs_sparse(ir_graph *const irg, dfs_t *const dfs,
+                             double const inv_loop_weight)
+{
+	unsigned const size        = dfs_get_n_nodes(dfs);
+	ir_node *const start_block = get_irg_start_block(irg);
+	ir_node *const end_block   = get_irg_end_block(irg);
+	unsigned const end_idx     = size - dfs_get_post_num(dfs, end_block) - 1;
+
+	gs_matrix_t *mat = gs_new_matrix(size, size);
+	for (unsigned idx = 0; idx < size; ++idx) {
+		ir_node const *const bb = dfs_get_post_num_node(dfs, size - idx - 1);
+
+		for (int i = get_Block_n_cfgpreds(bb) - 1; i >= 0; --i) {
+			ir_node *const pred     = get_Block_cfgpred_block(bb, i);
+			unsigned const pred_idx = size - dfs_get_post_num(dfs, pred) - 1;
+			double   const prob     = get_cf_probability(bb, i, inv_loop_weight);
+			gs_matrix_set(mat, idx, pred_idx,
+			              gs_matrix_get(mat, idx, pred_idx) + prob);
+		}
+
+		/* close the cycle: the start block is executed once per function
+		 * execution, i.e. once per execution of the end block */
+		if (bb == start_block)
+			gs_matrix_set(mat, idx, end_idx,
+			              gs_matrix_get(mat, idx, end_idx) + 1.0);
+	}
+
+	/* add artifical edges from "kept blocks without a path to end"
+	 * to end */
+	const ir_node *end = get_irg_end(irg);
+	for (int k = get_End_n_keepalives(end); k-- > 0; ) {
+		ir_node *keep = get_End_keepalive(end, k);
+		if (!is_Block(keep) || has_path_to_end(keep))
+			continue;
+
+		double   sum      = get_sum_succ_factors(keep, inv_loop_weight);
+		double   fac      = KEEP_FAC/sum;
+		unsigned keep_idx = size - dfs_get_post_num(dfs, keep) - 1;
+		gs_matrix_set(mat, end_idx, keep_idx,
+		              gs_matrix_get(mat, end_idx, keep_idx) + fac);
+	}
+
+	/* turn x = in_fac * x into (in_fac - I) * x = 0 */
+	for (unsigned idx = 0; idx < size; ++idx) {
+		double const diag = gs_matrix_get(mat, idx, idx) - 1.0;
+		if (diag == 0.0) {
+			/* a block fed only by itself; no sensible solution exists */
+			gs_delete_matrix(mat);
+			return false;
+		}
+		gs_matrix_set(mat, idx, idx, diag);
+	}
+
+	/* Seed with ones and iterate until the sweeps stop changing the
+	 * vector.  Graphs where the iteration stalls fall back to the loop
+	 * weight heuristic. */
+	double *x = XMALLOCN(double, size);
+	for (unsigned idx = 0; idx < size; ++idx) {
+		x[idx] = 1.0;
+	}
+	double res = 0.0;
+	for (unsigned step = 0; step < SEIDEL_MAX_STEPS; ++step) {
+		res = gs_matrix_gauss_seidel(mat, x);
+		if (res <= SEIDEL_TOLERANCE)
+			break;
+	}
+	gs_delete_matrix(mat);
+
+	bool valid_freq = res <= SEIDEL_TOLERANCE;
+	if (valid_freq) {
+		/* compute the normalization factor.
+		 * 1.0 / exec freq of end block. */
+		double end_freq = x[end_idx];
+		double norm     = end_freq != 0.0 ? 1.0 / end_freq : 1.0;
+
+		for (unsigned idx = 0; idx < size; ++idx) {
+			ir_node *const bb   = dfs_get_post_num_node(dfs, size - idx - 1);
+			double         freq = x[idx] * norm;
+
+			/* tiny negative values are iteration noise */
+			if (UNDEF(freq))
+				freq = 0.0;
+			/* Check for inf, nan and negative values. */
+			if (isinf(freq) || !(freq >= 0)) {
+				valid_freq = false;
+				break;
+			}
+			set_block_execfreq(bb, freq);
+		}
+	}
+	free(x);
+	return valid_freq;
+}
+
+void ir_estimate_execfreq(ir_graph *irg)
+{
+	double loop_weight = 10.0;
+
+	assure_irg_properties(irg,
+		IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+		| IR_GRAPH_PROPERTY_NO_BADS
+		| IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
+		| IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
+
+	/* compute a DFS.
+	 * using a toposort on the CFG (without back edges) will propagate
+	 * the values better for the gauss/seidel iteration.
+	 * => they can "flow" from start to end. */
+	dfs_t *const dfs = dfs_new(irg);
+
+	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED
+	                          | IR_RESOURCE_IRN_VISITED
+	                          | IR_RESOURCE_IRN_LINK);
+	inc_irg_block_visited(irg);
+
+	/* mark all blocks reachable from end_block as (block)visited
+	 * (so we can detect places like endless-loops/noreturn calls which
+	 *  do not reach the End block) */
+	block_walk_no_keeps(get_irg_end_block(irg));
+	/* mark all kept blocks as (node)visited */
+	inc_irg_visited(irg);
+	const ir_node *end          = get_irg_end(irg);
+	int const      n_keepalives = get_End_n_keepalives(end);
+	for (int k = n_keepalives - 1; k >= 0; --k) {
+		ir_node *keep = get_End_keepalive(end, k);
+		if (is_Block(keep)) {
+			mark_irn_visited(keep);
+		}
+	}
+
+	double const inv_loop_weight = 1.0 / loop_weight;
+	unsigned const size          = dfs_get_n_nodes(dfs);
+
+	bool valid_freq;
+	if (size <= DENSE_SOLVER_MAX_BLOCKS) {
+		valid_freq = solve_lgs_dense(irg, dfs, inv_loop_weight);
+	} else {
+		valid_freq = solve_lgs_sparse(irg, dfs, inv_loop_weight);
+	}
 
 	/* Fallbacks in case some frequencies were invalid */
 	if (!valid_freq && !fallback_loop_weight(dfs, loop_weight)) {
@@ -645,9 +781,4 @@ void ir_estimate_execfreq(ir_graph *irg)
 	}
 
 	free_properties_and_dfs(irg, dfs);
-	DEL_ARR_F(lgs_to_mat);
-	DEL_ARR_F(mat_to_lgs);
-	free(in_fac);
-	free(lgs_matrix);
-	DEL_ARR_F(lgs_x);
 }
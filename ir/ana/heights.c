@@ -13,49 +13,53 @@
 
 #include "irdump.h"
 #include "iredges_t.h"
+#include "irgraph_t.h"
 #include "irgwalk.h"
-#include "irnodemap.h"
-#include "list.h"
+#include "irnodedata.h"
+#include "irnodeset.h"
 #include "util.h"
+#include "xmalloc.h"
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-struct ir_heights_t {
-	ir_nodemap      data;
-	unsigned        visited;
-	hook_entry_t   *dump_handle;
-	struct obstack  obst;
-};
-
 typedef struct {
 	unsigned height;
 	unsigned visited;
 } irn_height_t;
 
-static irn_height_t *maybe_get_height_data(const ir_heights_t *heights,
-                                           const ir_node *node)
+struct ir_heights_t {
+	ir_graph     *irg;
+	/** Height data for all nodes, indexed by node index. */
+	ir_nodedata   data;
+	unsigned      visited;
+	/** Blocks whose height data is stale and recomputed on the next query. */
+	ir_nodeset_t  dirty_blocks;
+	hook_entry_t *dump_handle;
+};
+
+static irn_height_t *get_height_data(const ir_heights_t *heights,
+                                     const ir_node *node)
 {
-	irn_height_t *height = ir_nodemap_get(irn_height_t, &heights->data, node);
-	return height;
+	return ir_nodedata_get_fast(irn_height_t, &heights->data, node);
 }
 
-static irn_height_t *get_height_data(ir_heights_t *heights, const ir_node *node)
+/**
+ * Make sure the side array covers all nodes of the graph, including ones
+ * created after the last (re)computation.
+ */
+static void reserve_entries(ir_heights_t *heights)
 {
-	irn_height_t *height = ir_nodemap_get(irn_height_t, &heights->data, node);
-	if (height == NULL) {
-		height = OALLOCZ(&heights->obst, irn_height_t);
-		ir_nodemap_insert(&heights->data, node, height);
-	}
-	return height;
+	ir_nodedata_reserve(&heights->data, heights->irg);
 }
 
 static void height_dump_cb(void *data, FILE *f, const ir_node *irn)
 {
-	const ir_heights_t *heights = (const ir_heights_t*) data;
-	const irn_height_t *h       = maybe_get_height_data(heights, irn);
-	if (h != NULL)
-		fprintf(f, "height: %u\n", h->height);
+	ir_heights_t *heights = (ir_heights_t*) data;
+	if (is_Block(irn))
+		return;
+	const irn_height_t *h = ir_nodedata_get(irn_height_t, &heights->data, irn);
+	fprintf(f, "height: %u\n", h->height);
 }
 
 /**
@@ -78,12 +82,12 @@ static bool search(ir_heights_t *h, const ir_node *curr, const ir_node *tgt)
 		return false;
 
 	/* Check, if we have already been here. Coming more often won't help :-) */
-	irn_height_t *h_curr = maybe_get_height_data(h, curr);
+	irn_height_t *h_curr = get_height_data(h, curr);
 	if (h_curr->visited >= h->visited)
 		return false;
 
 	/* If we are too deep into the DAG we won't find the target either. */
-	irn_height_t *h_tgt = maybe_get_height_data(h, tgt);
+	irn_height_t *h_tgt = get_height_data(h, tgt);
 	if (h_curr->height > h_tgt->height)
 		return false;
 
@@ -99,24 +103,6 @@ static bool search(ir_heights_t *h, const ir_node *curr, const ir_node *tgt)
 	return false;
 }
 
-int heights_reachable_in_block(ir_heights_t *h, const ir_node *n,
-                               const ir_node *m)
-{
-	int           res = 0;
-	irn_height_t *hn  = maybe_get_height_data(h, n);
-	irn_height_t *hm  = maybe_get_height_data(h, m);
-
-	assert(get_nodes_block(n) == get_nodes_block(m));
-	assert(hn != NULL && hm != NULL);
-
-	if (hn->height <= hm->height) {
-		h->visited++;
-		res = search(h, n, m);
-	}
-
-	return res;
-}
-
 /**
  * Compute the height of a node in a block.
  * @param h   The heights object.
@@ -167,11 +153,49 @@ static void compute_heights_in_block_walker(ir_node *block, void *data)
 	compute_heights_in_block(block, h);
 }
 
-unsigned get_irn_height(const ir_heights_t *heights, const ir_node *irn)
+/**
+ * Recompute the height data of @p block if it was invalidated.  Bumping
+ * h->visited makes the stale per-node data of the block invisible, so one
+ * walk over the block suffices and all other blocks keep their data.
+ */
+static void revalidate_block(ir_heights_t *h, ir_node *block)
+{
+	if (ir_nodeset_size(&h->dirty_blocks) == 0)
+		return;
+	if (!ir_nodeset_contains(&h->dirty_blocks, block))
+		return;
+	ir_nodeset_remove(&h->dirty_blocks, block);
+	reserve_entries(h);
+	compute_heights_in_block(block, h);
+}
+
+void heights_invalidate_block(ir_heights_t *h, ir_node *block)
 {
-	const irn_height_t *height = maybe_get_height_data(heights, irn);
-	assert(height != NULL);
-	return height->height;
+	ir_nodeset_insert(&h->dirty_blocks, block);
+}
+
+int heights_reachable_in_block(ir_heights_t *h, const ir_node *n,
+                               const ir_node *m)
+{
+	assert(get_nodes_block(n) == get_nodes_block(m));
+	revalidate_block(h, get_nodes_block(n));
+
+	int           res = 0;
+	irn_height_t *hn  = get_height_data(h, n);
+	irn_height_t *hm  = get_height_data(h, m);
+
+	if (hn->height <= hm->height) {
+		h->visited++;
+		res = search(h, n, m);
+	}
+
+	return res;
+}
+
+unsigned get_irn_height(ir_heights_t *heights, const ir_node *irn)
+{
+	revalidate_block(heights, get_nodes_block(irn));
+	return get_height_data(heights, irn)->height;
 }
 
 unsigned heights_recompute_block(ir_heights_t *h, ir_node *block)
@@ -179,25 +203,21 @@ unsigned heights_recompute_block(ir_heights_t *h, ir_node *block)
 	ir_graph *irg = get_irn_irg(block);
 	assure_edges(irg);
 
-	/* reset data for all nodes in the block */
-	foreach_out_edge(block, edge) {
-		ir_node      *irn = get_edge_src_irn(edge);
-		irn_height_t *ih  = get_height_data(h, irn);
-		memset(ih, 0, sizeof(*ih));
-	}
-
-	h->visited = 0;
+	ir_nodeset_remove(&h->dirty_blocks, block);
+	reserve_entries(h);
 	return compute_heights_in_block(block, h);
 }
 
 ir_heights_t *heights_new(ir_graph *irg)
 {
 	ir_heights_t *res = XMALLOCZ(ir_heights_t);
-	ir_nodemap_init(&res->data, irg);
-	obstack_init(&res->obst);
+	res->irg = irg;
+	ir_nodedata_init(&res->data, irg, sizeof(irn_height_t));
+	ir_nodeset_init(&res->dirty_blocks);
 	res->dump_handle = dump_add_node_info_callback(height_dump_cb, res);
 
 	assure_edges(irg);
+	reserve_entries(res);
 	irg_block_walk_graph(irg, compute_heights_in_block_walker, NULL, res);
 
 	return res;
@@ -206,7 +226,7 @@ ir_heights_t *heights_new(ir_graph *irg)
 void heights_free(ir_heights_t *h)
 {
 	dump_remove_node_info_callback(h->dump_handle);
-	obstack_free(&h->obst, NULL);
-	ir_nodemap_destroy(&h->data);
+	ir_nodeset_destroy(&h->dirty_blocks);
+	ir_nodedata_destroy(&h->data);
 	free(h);
 }
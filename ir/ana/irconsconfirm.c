@@ -21,8 +21,10 @@
 #include "irgraph_t.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "irnodemap.h"
 #include "iropt_dbg.h"
 #include "irtools.h"
+#include "xmalloc.h"
 
 /**
  * Walker environment.
@@ -569,6 +571,216 @@ void construct_confirms_only(ir_graph *irg)
 	do_construct_confirms(irg, false);
 }
 
+/** A single entry of the value fact side-table. */
+typedef struct value_fact_t value_fact_t;
+struct value_fact_t {
+	value_fact_t *next;     /**< next fact about the same value */
+	ir_node      *block;    /**< the fact holds in blocks dominated by this */
+	ir_node      *bound;    /**< the value is in relation to this bound */
+	ir_relation   relation; /**< the relation between value and bound */
+};
+
+/** The value fact side-table of a graph, see construct_value_facts(). */
+typedef struct ir_value_facts_t {
+	struct obstack obst;  /**< storage for the fact entries */
+	ir_nodemap     map;   /**< maps a value to its list of facts */
+} ir_value_facts_t;
+
+/**
+ * Record the fact @p value @p relation @p bound, valid in all blocks
+ * dominated by @p block.
+ */
+static void add_value_fact(ir_node *value, ir_node *block, ir_node *bound,
+                           ir_relation relation, env_t *env)
+{
+	ir_graph         *irg   = get_irn_irg(value);
+	ir_value_facts_t *facts = irg->value_facts;
+	value_fact_t     *fact  = OALLOC(&facts->obst, value_fact_t);
+	fact->next     = ir_nodemap_get(value_fact_t, &facts->map, value);
+	fact->block    = block;
+	fact->bound    = bound;
+	fact->relation = relation;
+	ir_nodemap_insert(&facts->map, value, fact);
+
+	DB((dbg, LEVEL_2, "At %+F recording %+F %= %+F\n", block, value,
+	    relation, bound));
+	env->num_confirms += 1;
+}
+
+/**
+ * Record the facts an IF-branch establishes; side-table counterpart of
+ * handle_if().
+ */
+static void record_if_facts(ir_node *block, ir_node *cmp, ir_relation rel,
+                            env_t *env)
+{
+	ir_node *left  = get_Cmp_left(cmp);
+	ir_node *right = get_Cmp_right(cmp);
+	if (is_Bad(left) || is_Bad(right))
+		return;
+	if (is_Const(left) && is_Const(right))
+		return;
+
+	/* try to place the constant on the right side of the fact */
+	switch (get_irn_opcode(left)) {
+	case iro_Address:
+	case iro_Align:
+	case iro_Const:
+	case iro_Offset:
+	case iro_Size: {
+		ir_node *t = left;
+		left  = right;
+		right = t;
+
+		rel = get_inversed_relation(rel);
+		break;
+	}
+
+	default:
+		break;
+	}
+
+	add_value_fact(left, block, right, rel, env);
+	if (!is_Const(right))
+		add_value_fact(right, block, left, get_inversed_relation(rel), env);
+}
+
+/**
+ * Block-walker: record the facts established by a block's single
+ * conditional entry; side-table counterpart of insert_Confirm_in_block().
+ */
+static void record_facts_in_block(ir_node *block, void *data)
+{
+	if (get_Block_n_cfgpreds(block) != 1)
+		return;
+
+	ir_node *proj = get_Block_cfgpred(block, 0);
+	if (!is_Proj(proj))
+		return;
+
+	env_t   *env  = (env_t*)data;
+	ir_node *cond = get_Proj_pred(proj);
+	if (is_Switch(cond)) {
+		unsigned pn = get_Proj_num(proj);
+		if (pn == pn_Switch_default)
+			return;
+		ir_node *c = get_case_value(cond, pn);
+		if (c == NULL)
+			return;
+		add_value_fact(get_Switch_selector(cond), block, c,
+		               ir_relation_equal, env);
+	} else if (is_Cond(cond)) {
+		ir_node *selector = get_Cond_selector(cond);
+		bool     is_true  = get_Proj_num(proj) == pn_Cond_true;
+		ir_graph *irg     = get_irn_irg(block);
+		ir_node  *con     = new_r_Const(irg, is_true ? tarval_b_true
+		                                             : tarval_b_false);
+		add_value_fact(selector, block, con, ir_relation_equal, env);
+		if (!is_Cmp(selector))
+			return;
+
+		ir_relation rel = get_Cmp_relation(selector);
+		if (!is_true)
+			rel = get_negated_relation(rel);
+		record_if_facts(block, selector, rel, env);
+	}
+}
+
+/**
+ * Walker: also record non-null facts for dereferenced pointers;
+ * side-table counterpart of insert_Confirm().
+ */
+static void record_facts(ir_node *node, void *data)
+{
+	env_t *env = (env_t*)data;
+	switch (get_irn_opcode(node)) {
+	case iro_Block:
+		record_facts_in_block(node, env);
+		break;
+	case iro_Load:
+	case iro_Store: {
+		ir_node *ptr = is_Load(node) ? get_Load_ptr(node)
+		                             : get_Store_ptr(node);
+		if (is_non_null_Confirm(ptr))
+			break;
+		ir_graph *irg  = get_irn_irg(node);
+		ir_node  *null = new_r_Const_null(irg, get_irn_mode(ptr));
+		add_value_fact(ptr, get_nodes_block(node), null,
+		               ir_relation_less_greater, env);
+		env->num_non_null += 1;
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void construct_value_facts(ir_graph *irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.ana.confirm");
+
+	/* The table neither reroutes users nor creates control flow, so only
+	 * dominance (for scoping) is needed. */
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
+	                         | IR_GRAPH_PROPERTY_NO_BADS);
+
+	free_value_facts(irg);
+	ir_value_facts_t *facts = XMALLOCZ(ir_value_facts_t);
+	obstack_init(&facts->obst);
+	ir_nodemap_init(&facts->map, irg);
+	irg->value_facts = facts;
+
+	env_t env;
+	env.optimize     = false;
+	env.num_confirms = 0;
+	env.num_consts   = 0;
+	env.num_eq       = 0;
+	env.num_non_null = 0;
+
+	if (get_opt_global_null_ptr_elimination()) {
+		irg_walk_graph(irg, record_facts, NULL, &env);
+	} else {
+		irg_block_walk_graph(irg, record_facts_in_block, NULL, &env);
+	}
+
+	DB((dbg, LEVEL_1, "# value facts       : %u\n", env.num_confirms));
+	DB((dbg, LEVEL_1, "# non-null facts    : %u\n", env.num_non_null));
+
+	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+}
+
+ir_relation ir_get_value_fact(const ir_node *value, const ir_node *block,
+                              ir_node **bound)
+{
+	ir_graph         *irg   = get_irn_irg(value);
+	ir_value_facts_t *facts = irg->value_facts;
+	/* without consistent dominance the recorded scopes mean nothing */
+	if (facts == NULL
+	    || !irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return ir_relation_true;
+
+	for (value_fact_t *fact
+	     = ir_nodemap_get(value_fact_t, &facts->map, value);
+	     fact != NULL; fact = fact->next) {
+		if (block_dominates(fact->block, block)) {
+			*bound = fact->bound;
+			return fact->relation;
+		}
+	}
+	return ir_relation_true;
+}
+
+void free_value_facts(ir_graph *irg)
+{
+	ir_value_facts_t *facts = irg->value_facts;
+	if (facts == NULL)
+		return;
+	ir_nodemap_destroy(&facts->map);
+	obstack_free(&facts->obst, NULL);
+	free(facts);
+	irg->value_facts = NULL;
+}
+
 static void remove_confirm(ir_node *n, void *env)
 {
 	(void)env;
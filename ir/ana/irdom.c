@@ -708,3 +708,175 @@ void compute_postdoms(ir_graph *irg)
 	postdom_tree_walk(get_irg_end_block(irg), assign_tree_postdom_pre_order,
 	                  assign_tree_postdom_pre_order_max, &tree_pre_order);
 }
+
+/**
+ * Unlink a block from the child list of its immediate dominator.
+ */
+static void dom_tree_unlink_child(ir_node *block)
+{
+	ir_dom_info *bi   = get_dom_info(block);
+	ir_node     *idom = bi->idom;
+	if (idom == NULL)
+		return;
+
+	ir_dom_info *pi = get_dom_info(idom);
+	if (pi->first == block) {
+		pi->first = bi->next;
+	} else {
+		for (ir_node *p = pi->first; p != NULL; p = get_dom_info(p)->next) {
+			ir_dom_info *cur = get_dom_info(p);
+			if (cur->next == block) {
+				cur->next = bi->next;
+				break;
+			}
+		}
+	}
+	bi->next = NULL;
+	bi->idom = NULL;
+}
+
+/**
+ * Reassign the dominator tree pre-order intervals after the idom pointers
+ * were patched. This is a single walk over the tree and therefore much
+ * cheaper than a full compute_doms().
+ */
+static void dom_tree_renumber(ir_graph *irg)
+{
+	unsigned tree_pre_order = 0;
+	dom_tree_walk(get_irg_start_block(irg), assign_tree_dom_pre_order,
+	              assign_tree_dom_pre_order_max, &tree_pre_order);
+}
+
+/**
+ * Shift the dominator tree depth of a whole subtree by @p delta.
+ */
+static void dom_tree_shift_depth(ir_node *block, int delta)
+{
+	set_Block_dom_depth(block, get_Block_dom_depth(block) + delta);
+	dominates_for_each(block, child) {
+		dom_tree_shift_depth(child, delta);
+	}
+}
+
+/**
+ * Mark a whole dominator subtree as unreachable.
+ */
+static void dom_tree_mark_unreachable(ir_node *block)
+{
+	set_Block_dom_pre_num(block, -1);
+	set_Block_dom_depth(block, -1);
+	get_dom_info(block)->idom = NULL;
+	dominates_for_each(block, child) {
+		dom_tree_mark_unreachable(child);
+	}
+}
+
+void dom_tree_update_insert_edge(ir_node *pred_block, ir_node *block)
+{
+	ir_graph *irg = get_irn_irg(block);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_POSTDOMINANCE);
+
+	/* An edge leaving unreachable code adds no paths from Start. */
+	if (get_Block_dom_depth(pred_block) < 0)
+		return;
+	/* Edges into previously unreachable code can make arbitrary parts of
+	 * the graph reachable; this needs a full recomputation. */
+	if (get_Block_dom_depth(block) < 0) {
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+		return;
+	}
+
+	/* The tree is unchanged iff the deepest common dominator of source and
+	 * target is the target itself (back edge to a dominator) or the
+	 * target's immediate dominator (edge within the dominated region). */
+	ir_node *nca = ir_deepest_common_dominator(pred_block, block);
+	if (nca == block || nca == get_dom_info(block)->idom)
+		return;
+
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+}
+
+void dom_tree_update_delete_edge(ir_node *pred_block, ir_node *block)
+{
+	ir_graph *irg = get_irn_irg(block);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_POSTDOMINANCE);
+
+	/* Deleting an edge in or into unreachable code changes nothing. */
+	if (get_Block_dom_depth(pred_block) < 0
+	 || get_Block_dom_depth(block) < 0)
+		return;
+
+	/* If the target has no reachable predecessor left, its whole dominator
+	 * subtree just became unreachable and the rest of the tree is intact. */
+	bool has_reachable_pred = false;
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+		ir_node *pred = get_Block_cfgpred(block, i);
+		if (is_Bad(pred))
+			continue;
+		if (get_Block_dom_depth(get_nodes_block(pred)) >= 0) {
+			has_reachable_pred = true;
+			break;
+		}
+	}
+	if (!has_reachable_pred) {
+		dom_tree_unlink_child(block);
+		dom_tree_mark_unreachable(block);
+		dom_tree_renumber(irg);
+		return;
+	}
+
+	/* Removing an edge can push immediate dominators further down the
+	 * tree; detecting the affected region requires a recomputation. */
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+}
+
+void dom_tree_update_split_edge(ir_node *pred_block, ir_node *new_block,
+                                ir_node *succ_block)
+{
+	ir_graph *irg = get_irn_irg(new_block);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_POSTDOMINANCE);
+
+	if (get_Block_dom_depth(pred_block) < 0) {
+		/* The split block lives in unreachable code. */
+		set_Block_dom_pre_num(new_block, -1);
+		set_Block_dom_depth(new_block, -1);
+		get_dom_info(new_block)->idom = NULL;
+		return;
+	}
+
+	/* The new block is dominated exactly by the edge source. */
+	set_Block_dom_pre_num(new_block, get_Block_dom_pre_num(pred_block));
+	set_Block_dom_depth(new_block, get_Block_dom_depth(pred_block) + 1);
+	set_Block_idom(new_block, pred_block);
+
+	/* The successor's immediate dominator moves down to the new block iff
+	 * all its other reachable predecessors are dominated by the successor
+	 * itself, i.e. every acyclic path enters through the split edge. */
+	bool dominated_by_new_block = true;
+	for (int i = 0, n = get_Block_n_cfgpreds(succ_block); i < n; ++i) {
+		ir_node *pred = get_Block_cfgpred(succ_block, i);
+		if (is_Bad(pred))
+			continue;
+		ir_node *pred_bl = get_nodes_block(pred);
+		if (pred_bl == new_block || get_Block_dom_depth(pred_bl) < 0)
+			continue;
+		if (!block_dominates(succ_block, pred_bl)) {
+			dominated_by_new_block = false;
+			break;
+		}
+	}
+	if (dominated_by_new_block) {
+		assert(get_dom_info(succ_block)->idom == pred_block);
+		dom_tree_unlink_child(succ_block);
+		set_Block_idom(succ_block, new_block);
+		dom_tree_shift_depth(succ_block, 1);
+	}
+
+	dom_tree_renumber(irg);
+}
@@ -13,8 +13,6 @@
 #define FIRM_ANA_IRDOM_T_H
 
 #include "irdom.h"
-#include "pmap.h"
-#include "obst.h"
 
 /** For dominator information */
 typedef struct ir_dom_info {
@@ -31,8 +29,11 @@ typedef struct ir_dom_info {
 } ir_dom_info;
 
 typedef struct ir_dom_front_info_t {
-	pmap *df_map;         /**< A map, mapping every block to a list of its dominance frontier blocks. */
-	struct obstack obst;  /**< An obstack holding all the frontier data. */
+	ir_node  **data;    /**< The frontier blocks of all blocks, stored as one
+	                         compressed array with a segment per block. */
+	unsigned  *offsets; /**< Start offset of each block's segment in @c data,
+	                         indexed by dominator tree pre-order number, with
+	                         one extra sentinel entry holding the total size. */
 } ir_dom_front_info_t;
 
 void set_Block_idom(ir_node *bl, ir_node *n);
@@ -244,7 +244,14 @@ void lv_chk_free(lv_chk_t *lv)
 	free(lv);
 }
 
-unsigned lv_chk_bl_xxx(lv_chk_t *lv, const ir_node *bl, const ir_node *var)
+/**
+ * The core of the liveness check. The block info of @p bl and the
+ * scratch bitset @p uses (of size n_blocks, trashed here) come from the
+ * caller so that batch queries against the same block set them up once.
+ */
+static unsigned lv_chk_bl_query(lv_chk_t *lv, const ir_node *bl,
+                                const bl_info_t *bli, const ir_node *var,
+                                bitset_t *uses)
 {
 	assert(is_Block(bl));
 	assert(is_liveness_node(var));
@@ -302,14 +309,13 @@ unsigned lv_chk_bl_xxx(lv_chk_t *lv, const ir_node *bl, const ir_node *var)
 		 * Note that we know for sure that bl != def_bl. That is sometimes
 		 * silently exploited below.
 		 */
-		const bl_info_t *bli = get_block_info(lv, bl);
 		const bl_info_t *def = get_block_info(lv, def_bl);
 		(void)def;
 		DBG((lv->dbg, LEVEL_2,
 		     "lv check %+F (def in %+F #%d) in different block %+F #%d\n",
 		     var, def_bl, def->id, bl, bli->id));
 
-		bitset_t *uses = bitset_alloca(lv->n_blocks);
+		bitset_clear_all(uses);
 		foreach_out_edge(var, edge) {
 			ir_node *user = get_edge_src_irn(edge);
 
@@ -424,3 +430,44 @@ end:
 
 	return res;
 }
+
+unsigned lv_chk_bl_xxx(lv_chk_t *lv, const ir_node *bl, const ir_node *var)
+{
+	bitset_t *uses = bitset_alloca(lv->n_blocks);
+	return lv_chk_bl_query(lv, bl, get_block_info(lv, bl), var, uses);
+}
+
+void lv_chk_bl_batch(lv_chk_t *lv, const ir_node *bl, ir_node *const *vars,
+                     size_t n_vars, bitset_t *live_in, bitset_t *live_end,
+                     bitset_t *live_out)
+{
+	const bl_info_t *bli  = get_block_info(lv, bl);
+	bitset_t        *uses = bitset_alloca(lv->n_blocks);
+
+	for (size_t i = 0; i < n_vars; ++i) {
+		unsigned const state = lv_chk_bl_query(lv, bl, bli, vars[i], uses);
+		if (live_in != NULL && (state & lv_chk_state_in))
+			bitset_set(live_in, i);
+		if (live_end != NULL && (state & lv_chk_state_end))
+			bitset_set(live_end, i);
+		if (live_out != NULL && (state & lv_chk_state_out))
+			bitset_set(live_out, i);
+	}
+}
+
+void lv_chk_bl_delta(lv_chk_t *lv, const ir_node *bl, ir_node *const *vars,
+                     size_t n_vars, bitset_t *born, bitset_t *died)
+{
+	const bl_info_t *bli  = get_block_info(lv, bl);
+	bitset_t        *uses = bitset_alloca(lv->n_blocks);
+
+	for (size_t i = 0; i < n_vars; ++i) {
+		unsigned const state = lv_chk_bl_query(lv, bl, bli, vars[i], uses);
+		bool     const in    = (state & lv_chk_state_in)  != 0;
+		bool     const out   = (state & lv_chk_state_out) != 0;
+		if (born != NULL && !in && out)
+			bitset_set(born, i);
+		if (died != NULL && in && !out)
+			bitset_set(died, i);
+	}
+}
@@ -18,6 +18,9 @@
 #define FIRM_ANA_IRLIVECHK_H
 
 #include <stdbool.h>
+#include <stddef.h>
+
+#include "bitset.h"
 #include "irnode_t.h"
 
 typedef enum {
@@ -71,6 +74,41 @@ extern void lv_chk_free(lv_chk_t *lv);
  */
 extern unsigned lv_chk_bl_xxx(lv_chk_t *lv, const ir_node *bl, const ir_node *irn);
 
+/**
+ * Batch version of lv_chk_bl_xxx(): checks several nodes against the
+ * same block with one query setup. For each node vars[i] that is live
+ * in/end/out at @p bl, bit i is set in the respective caller-provided
+ * bitset. Each bitset must hold at least @p n_vars bits or may be NULL
+ * when that state is not of interest.
+ * @param lv       The liveness environment.
+ * @param bl       The block to investigate.
+ * @param vars     The nodes to check for.
+ * @param n_vars   The number of nodes in vars.
+ * @param live_in  Receives the live in nodes, may be NULL.
+ * @param live_end Receives the live end nodes, may be NULL.
+ * @param live_out Receives the live out nodes, may be NULL.
+ */
+extern void lv_chk_bl_batch(lv_chk_t *lv, const ir_node *bl,
+                            ir_node *const *vars, size_t n_vars,
+                            bitset_t *live_in, bitset_t *live_end,
+                            bitset_t *live_out);
+
+/**
+ * Computes the liveness delta across @p bl for several nodes: bit i is
+ * set in @p born if vars[i] is live out but not live in (it starts
+ * living in the block), and in @p died if it is live in but not live
+ * out (its last use is inside the block). Either bitset may be NULL.
+ * @param lv     The liveness environment.
+ * @param bl     The block to investigate.
+ * @param vars   The nodes to check for.
+ * @param n_vars The number of nodes in vars.
+ * @param born   Receives the nodes becoming live, may be NULL.
+ * @param died   Receives the nodes ceasing to live, may be NULL.
+ */
+extern void lv_chk_bl_delta(lv_chk_t *lv, const ir_node *bl,
+                            ir_node *const *vars, size_t n_vars,
+                            bitset_t *born, bitset_t *died);
+
 #define lv_chk_bl_in(lv, bl, irn)  ((lv_chk_bl_xxx((lv), (bl), (irn)) & lv_chk_state_in)  != 0)
 #define lv_chk_bl_end(lv, bl, irn) ((lv_chk_bl_xxx((lv), (bl), (irn)) & lv_chk_state_end) != 0)
 #define lv_chk_bl_out(lv, bl, irn) ((lv_chk_bl_xxx((lv), (bl), (irn)) & lv_chk_state_out) != 0)
@@ -12,10 +12,13 @@
 #include "irmemory_t.h"
 
 #include "adt/pmap.h"
+#include "array.h"
 #include "debug.h"
+#include "firm_threads.h"
 #include "hashptr.h"
 #include "irflag.h"
 #include "irflag.h"
+#include "irgopt.h"
 #include "irgraph_t.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
@@ -26,6 +29,7 @@
 #include "type_t.h"
 #include "typerep.h"
 #include "util.h"
+#include "xmalloc.h"
 #include <stdbool.h>
 #include <stdlib.h>
 
@@ -294,6 +298,27 @@ follow_ptr:
 	}
 }
 
+/**
+ * An entry of the per-graph memoization cache for alias queries.
+ * An entry is only trusted if its change_nr matches the current change
+ * counter of the graph, so the cache needs no explicit invalidation when
+ * the graph is transformed.
+ */
+typedef struct alias_cache_entry_t {
+	const ir_node    *addr1;
+	const ir_node    *addr2;
+	const ir_type    *type1;
+	const ir_type    *type2;
+	unsigned          size1;
+	unsigned          size2;
+	unsigned          change_nr; /**< graph change counter at query time */
+	unsigned          options;   /**< disambiguator options at query time */
+	ir_alias_relation relation;
+} alias_cache_entry_t;
+
+/** Number of entries of the alias query cache, must be a power of 2. */
+#define N_ALIAS_CACHE_ENTRIES 512
+
 static ir_alias_relation _get_alias_relation(const ir_node *addr1, const ir_type *const objt1, unsigned size1,
                                              const ir_node *addr2, const ir_type *const objt2, unsigned size2)
 {
@@ -477,7 +502,39 @@ leave_type_based_alias:;
 ir_alias_relation get_alias_relation(const ir_node *const addr1, const ir_type *const type1, unsigned size1,
                                      const ir_node *const addr2, const ir_type *const type2, unsigned size2)
 {
+	ir_graph *const irg     = get_irn_irg(addr1);
+	unsigned  const options = get_irg_memory_disambiguator_options(irg);
+
+	/* The load/store optimizations ask about the same pairs over and over
+	 * again, so memoize the relations in a direct mapped cache. */
+	alias_cache_entry_t *cache = irg->alias_cache;
+	if (cache == NULL) {
+		cache = XMALLOCNZ(alias_cache_entry_t, N_ALIAS_CACHE_ENTRIES);
+		irg->alias_cache = cache;
+	}
+	unsigned hash = hash_combine(hash_combine(hash_ptr(addr1), hash_ptr(addr2)),
+	                             hash_combine(hash_ptr(type1), hash_ptr(type2)));
+	hash = hash_combine(hash, size1 | (size2 << 16));
+	alias_cache_entry_t *const entry = &cache[hash & (N_ALIAS_CACHE_ENTRIES-1)];
+	if (entry->addr1 == addr1 && entry->addr2 == addr2
+	    && entry->type1 == type1 && entry->type2 == type2
+	    && entry->size1 == size1 && entry->size2 == size2
+	    && entry->change_nr == irg->change_nr && entry->options == options) {
+		DB((dbg, LEVEL_1, "alias(%+F, %+F) = %s (cached)\n", addr1, addr2,
+		    get_ir_alias_relation_name(entry->relation)));
+		return entry->relation;
+	}
+
 	ir_alias_relation rel = _get_alias_relation(addr1, type1, size1, addr2, type2, size2);
+	entry->addr1     = addr1;
+	entry->addr2     = addr2;
+	entry->type1     = type1;
+	entry->type2     = type2;
+	entry->size1     = size1;
+	entry->size2     = size2;
+	entry->change_nr = irg->change_nr;
+	entry->options   = options;
+	entry->relation  = rel;
 	DB((dbg, LEVEL_1, "alias(%+F, %+F) = %s\n", addr1, addr2,
 	    get_ir_alias_relation_name(rel)));
 	return rel;
@@ -803,25 +860,82 @@ static void print_entity_usage_flags(const ir_type *tp)
 #endif /* DEBUG_libfirm */
 
 /**
- * Post-walker: check for global entity address
+ * Usage flags a single graph contributes to one global entity.
  */
-static void check_global_address(ir_node *irn, void *data)
+typedef struct global_usage_entry_t {
+	ir_entity *entity; /**< the entity whose address the graph uses */
+	unsigned   flags;  /**< the contributed ir_entity_usage bits */
+} global_usage_entry_t;
+
+/** Maps each scanned ir_graph to an ARR_F of global_usage_entry_t, its
+ * last computed contribution to the global entity usage. Recomputation
+ * only rescans graphs whose entry was dropped since the last analysis. */
+static pmap *global_usage_cache;
+
+/** Protects global_usage_cache, the scans run on worker threads. */
+static firm_mutex_t global_usage_lock;
+
+/**
+ * Post-walker: record the usage a global entity address contributes.
+ */
+static void collect_global_usage(ir_node *irn, void *data)
 {
-	(void)data;
+	global_usage_entry_t **entries = (global_usage_entry_t**)data;
 	if (!is_Address(irn))
 		return;
 
 	ir_entity *entity = get_Address_entity(irn);
-	unsigned   flags  = get_entity_usage(entity);
-	flags |= determine_entity_usage(irn, entity);
-	set_entity_usage(entity, (ir_entity_usage) flags);
+	global_usage_entry_t entry
+		= { entity, determine_entity_usage(irn, entity) };
+	ARR_APP1(global_usage_entry_t, *entries, entry);
+}
+
+/**
+ * Pass guard: a graph only needs a scan if its cached contribution was
+ * dropped or never computed.
+ */
+static int globals_usage_scan_needed(ir_graph *irg)
+{
+	firm_mutex_lock(&global_usage_lock);
+	global_usage_entry_t *entries
+		= pmap_get(global_usage_entry_t, global_usage_cache, irg);
+	firm_mutex_unlock(&global_usage_lock);
+	return entries == NULL;
+}
+
+/**
+ * Compute and cache the contribution of a single graph. Touches only the
+ * graph itself and its cache slot, so scans of different graphs can run
+ * concurrently.
+ */
+static void scan_irg_globals_usage(ir_graph *irg)
+{
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS
+	                      | IR_GRAPH_PROPERTY_NO_TUPLES);
+	global_usage_entry_t *entries = NEW_ARR_F(global_usage_entry_t, 0);
+	irg_walk_graph(irg, NULL, collect_global_usage, &entries);
+
+	firm_mutex_lock(&global_usage_lock);
+	pmap_insert(global_usage_cache, irg, entries);
+	firm_mutex_unlock(&global_usage_lock);
 }
 
+static const irg_pass_t globals_usage_scan_pass = {
+	"globals_entity_usage", scan_irg_globals_usage, globals_usage_scan_needed
+};
+
 /**
- * Update the entity usage flags of all global entities.
+ * Update the entity usage flags of all global entities: rescan graphs
+ * with an invalidated contribution on up to @p n_threads workers, then
+ * merge all cached contributions.
  */
-static void analyse_irp_globals_entity_usage(void)
+static void analyse_irp_globals_entity_usage(unsigned n_threads)
 {
+	if (global_usage_cache == NULL)
+		global_usage_cache = pmap_create();
+
+	run_irg_pass_list(&globals_usage_scan_pass, 1, n_threads);
+
 	for (ir_segment_t s = IR_SEGMENT_FIRST; s <= IR_SEGMENT_LAST; ++s) {
 		ir_type *type = get_segment_type(s);
 		init_entity_usage(type);
@@ -833,8 +947,14 @@ static void analyse_irp_globals_entity_usage(void)
 	}
 
 	foreach_irp_irg(i, irg) {
-		assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS | IR_GRAPH_PROPERTY_NO_TUPLES);
-		irg_walk_graph(irg, NULL, check_global_address, NULL);
+		global_usage_entry_t *entries
+			= pmap_get(global_usage_entry_t, global_usage_cache, irg);
+		assert(entries != NULL);
+		for (size_t e = 0, n = ARR_LEN(entries); e < n; ++e) {
+			ir_entity *entity = entries[e].entity;
+			unsigned   flags  = get_entity_usage(entity) | entries[e].flags;
+			set_entity_usage(entity, (ir_entity_usage) flags);
+		}
 	}
 
 #ifdef DEBUG_libfirm
@@ -849,6 +969,35 @@ static void analyse_irp_globals_entity_usage(void)
 	irp->globals_entity_usage_state = ir_entity_usage_computed;
 }
 
+/** Frees all cached per graph contributions. */
+static void flush_globals_usage_cache(void)
+{
+	if (global_usage_cache == NULL)
+		return;
+	foreach_pmap(global_usage_cache, entry) {
+		global_usage_entry_t *entries = (global_usage_entry_t*)entry->value;
+		if (entries != NULL)
+			DEL_ARR_F(entries);
+	}
+	pmap_destroy(global_usage_cache);
+	global_usage_cache = NULL;
+}
+
+void ir_invalidate_globals_entity_usage(ir_graph *irg)
+{
+	firm_mutex_lock(&global_usage_lock);
+	if (global_usage_cache != NULL) {
+		global_usage_entry_t *entries
+			= pmap_get(global_usage_entry_t, global_usage_cache, irg);
+		if (entries != NULL) {
+			DEL_ARR_F(entries);
+			pmap_insert(global_usage_cache, irg, NULL);
+		}
+	}
+	irp->globals_entity_usage_state = ir_entity_usage_not_computed;
+	firm_mutex_unlock(&global_usage_lock);
+}
+
 ir_entity_usage_computed_state get_irp_globals_entity_usage_state(void)
 {
 	return irp->globals_entity_usage_state;
@@ -856,21 +1005,38 @@ ir_entity_usage_computed_state get_irp_globals_entity_usage_state(void)
 
 void set_irp_globals_entity_usage_state(ir_entity_usage_computed_state state)
 {
+	/* External invalidation gives no hint which graphs changed, so all
+	 * cached contributions have to go. Passes invalidate single graphs
+	 * through ir_invalidate_globals_entity_usage() instead. */
+	if (state == ir_entity_usage_not_computed)
+		flush_globals_usage_cache();
 	irp->globals_entity_usage_state = state;
 }
 
-void assure_irp_globals_entity_usage_computed(void)
+void assure_irp_globals_entity_usage_computed_parallel(unsigned n_threads)
 {
 	if (irp->globals_entity_usage_state != ir_entity_usage_not_computed)
 		return;
 
-	analyse_irp_globals_entity_usage();
+	analyse_irp_globals_entity_usage(n_threads);
+}
+
+void assure_irp_globals_entity_usage_computed(void)
+{
+	assure_irp_globals_entity_usage_computed_parallel(1);
 }
 
 void firm_init_memory_disambiguator(void)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.ana.irmemory");
 	FIRM_DBG_REGISTER(dbgcall, "firm.opt.cc");
+	firm_mutex_init(&global_usage_lock);
+}
+
+void firm_finish_memory_disambiguator(void)
+{
+	flush_globals_usage_cache();
+	firm_mutex_destroy(&global_usage_lock);
 }
 
 /** Maps method types to cloned method types. */
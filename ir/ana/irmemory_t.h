@@ -20,6 +20,19 @@
  */
 void firm_init_memory_disambiguator(void);
 
+/**
+ * Frees the caches of the memory disambiguator.
+ */
+void firm_finish_memory_disambiguator(void);
+
+/**
+ * Drops the cached contribution of @p irg to the global entity usage
+ * analysis and marks the analysis as outdated. Called whenever a graph
+ * changes without preserving its entity usage property; the next
+ * assure_irp_globals_entity_usage_computed() rescans only such graphs.
+ */
+void ir_invalidate_globals_entity_usage(ir_graph *irg);
+
 bool is_partly_volatile(ir_node *ptr);
 
 /**
@@ -0,0 +1,277 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Scalar evolution analysis for loop induction variables.
+ *
+ * The recognition of counted loops was moved here from the loop
+ * unroller, generalized from constant to loop-invariant initial values
+ * and steps, and is cached per loop so that all loop passes can query it.
+ */
+#include "scalar_evolution.h"
+
+#include "array.h"
+#include "debug.h"
+#include "irloop_t.h"
+#include "irnode_t.h"
+#include "irouts_t.h"
+#include "obst.h"
+#include "tv.h"
+#include "util.h"
+#include "xmalloc.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+static struct obstack  obst;
+static ir_loop       **cached_loops;
+
+static bool is_inner_loop(ir_loop *const outer_loop, ir_loop *inner_loop)
+{
+	ir_loop *old_inner_loop;
+	do {
+		old_inner_loop = inner_loop;
+		inner_loop = get_loop_outer_loop(inner_loop);
+	} while (inner_loop != old_inner_loop && inner_loop != outer_loop);
+	return inner_loop != old_inner_loop;
+}
+
+static bool block_is_inside_loop(ir_node *const block, ir_loop *const loop)
+{
+	ir_loop *const block_loop = get_irn_loop(block);
+	if (block_loop == NULL)
+		return false;
+	return block_loop == loop || is_inner_loop(loop, block_loop);
+}
+
+/** Returns whether @p node computes the same value in every iteration. */
+static bool is_invariant_in(ir_node *const node, ir_loop *const loop)
+{
+	return !block_is_inside_loop(get_nodes_block(node), loop);
+}
+
+/**
+ * walk trivial phis (with only one input) until another node is found
+ */
+static ir_node *skip_trivial_phis(ir_node *start)
+{
+	if (is_Phi(start) && get_Phi_n_preds(start) == 1) {
+		return skip_trivial_phis(get_Phi_pred(start, 0));
+	}
+	return start;
+}
+
+/**
+ * Tries to match @p phi as an induction variable of @p loop, i.e. a
+ * header Phi merging a loop-invariant initial value with its own value
+ * incremented by a loop-invariant step.
+ */
+static bool analyze_phi(ir_node *const phi, ir_loop *const loop,
+                        scev_addrec_t *const rec)
+{
+	if (!mode_is_int(get_irn_mode(phi)))
+		return false;
+
+	ir_node *init = NULL;
+	ir_node *add  = NULL;
+	ir_node *step = NULL;
+	for (int j = 0, n = get_Phi_n_preds(phi); j < n; ++j) {
+		ir_node *pred = get_Phi_pred(phi, j);
+		if (is_invariant_in(pred, loop)) {
+			/* found the (possible) initial value of the counter */
+			if (init == NULL || init == pred) {
+				init = pred;
+				continue;
+			}
+			return false;
+		}
+		pred = skip_trivial_phis(pred);
+		if (is_Add(pred) && add == NULL) {
+			add = pred;
+			ir_node *left  = get_binop_left(pred);
+			ir_node *right = get_binop_right(pred);
+			if (is_Phi(left) && is_invariant_in(right, loop)) {
+				// found Add(phi, invariant)
+
+				bool found_step = false;
+				// LCSSA construction builds additional phi nodes
+				do {
+					if (left == phi) {
+						found_step = true;
+						step = right;
+						break;
+					}
+					left = get_Phi_pred(left, 0);
+
+				} while (is_Phi(left)
+				         && (get_Phi_n_preds(left) == 1 || left == phi));
+
+				if (found_step) {
+					continue;
+				}
+			}
+			return false;
+		}
+		// multiple uses of the same loop counter increment/decrement
+		if (pred == add) {
+			continue;
+		}
+		return false;
+	}
+	if (init == NULL || step == NULL)
+		return false;
+
+	rec->phi     = phi;
+	rec->add     = add;
+	rec->init    = init;
+	rec->step    = step;
+	rec->init_tv = is_Const(init) ? get_Const_tarval(init) : NULL;
+	rec->step_tv = is_Const(step) ? get_Const_tarval(step) : NULL;
+	return true;
+}
+
+/**
+ * Computes the trip count of a loop running a counter from init by step
+ * until the Cmp relation against limit no longer holds. The arithmetic
+ * matches what the loop unroller previously did, so unrolling decisions
+ * stay the same.
+ */
+static long compute_trip_count(ir_relation cmp_rel, ir_tarval *tv_init,
+                               ir_tarval *tv_step, ir_tarval *tv_limit)
+{
+	// normalize: use less or less_equal as relation
+	if (cmp_rel & ir_relation_greater) {
+		ir_tarval *tmp = tv_init;
+		tv_init  = tv_limit;
+		tv_limit = tmp;
+		tv_step  = tarval_neg(tv_step);
+		cmp_rel  = get_inversed_relation(cmp_rel);
+	}
+
+	ir_tarval *tv_interval = tarval_sub(tv_limit, tv_init);
+	if (tarval_is_negative(tv_interval) || tarval_is_negative(tv_step)) {
+		return -1;
+	}
+
+	ir_tarval *tv_one = new_tarval_from_long(1, get_tarval_mode(tv_interval));
+	// normalize: use less_equal as relation
+	if (!(cmp_rel & ir_relation_equal)) {
+		// interval -= 1
+		tv_interval = tarval_sub(tv_interval, tv_one);
+	}
+
+	assert(!tarval_is_null(tv_step));
+	// calculate loop iterations; add one iteration to count the first iteration
+	ir_tarval *tv_loop_count
+		= tarval_add(tarval_div(tv_interval, tv_step), tv_one);
+	long loop_count = get_tarval_long(tv_loop_count);
+	return loop_count > 0 ? loop_count : -1;
+}
+
+/**
+ * Looks for the exit condition in the loop header and fills in the
+ * counted loop facts of @p info.
+ */
+static void analyze_exit_condition(scev_loop_info_t *const info)
+{
+	ir_node *const header = info->header;
+	unsigned const n_outs = get_irn_n_outs(header);
+	for (unsigned i = 0; i < n_outs; ++i) {
+		ir_node *const node = get_irn_out(header, i);
+		assert(!is_Block(node));
+		if (get_nodes_block(node) != header || !is_Cmp(node))
+			continue;
+
+		ir_relation const cmp_rel = get_Cmp_relation(node);
+		if (cmp_rel == ir_relation_less_greater
+		    || cmp_rel == ir_relation_equal
+		    || (cmp_rel & ir_relation_unordered)) {
+			return;
+		}
+		ir_node *const cmp_right = get_Cmp_right(node);
+		if (!is_Const(cmp_right) || !mode_is_int(get_irn_mode(cmp_right)))
+			return;
+		ir_node *const cmp_left = get_Cmp_left(node);
+
+		for (size_t j = 0; j < info->n_addrecs; ++j) {
+			scev_addrec_t *const rec = &info->addrecs[j];
+			if (rec->phi != cmp_left)
+				continue;
+			info->counter  = rec;
+			info->cmp      = node;
+			info->limit_tv = get_Const_tarval(cmp_right);
+			if (rec->init_tv != NULL && rec->step_tv != NULL) {
+				info->trip_count = compute_trip_count(cmp_rel, rec->init_tv,
+				                                      rec->step_tv,
+				                                      info->limit_tv);
+			}
+			return;
+		}
+		return;
+	}
+}
+
+static scev_loop_info_t *analyze_loop(ir_loop *const loop,
+                                      ir_node *const header)
+{
+	scev_loop_info_t *const info = OALLOCZ(&obst, scev_loop_info_t);
+	info->header     = header;
+	info->trip_count = -1;
+
+	scev_addrec_t *addrecs = NEW_ARR_F(scev_addrec_t, 0);
+	unsigned const n_outs  = get_irn_n_outs(header);
+	for (unsigned i = 0; i < n_outs; ++i) {
+		ir_node *const node = get_irn_out(header, i);
+		if (get_nodes_block(node) != header || !is_Phi(node))
+			continue;
+		scev_addrec_t rec;
+		if (analyze_phi(node, loop, &rec)) {
+			ARR_APP1(scev_addrec_t, addrecs, rec);
+			DB((dbg, LEVEL_2, "\t%+F is an induction variable of %+F\n",
+			    node, loop));
+		}
+	}
+	info->n_addrecs = ARR_LEN(addrecs);
+	info->addrecs   = OALLOCN(&obst, scev_addrec_t, info->n_addrecs);
+	MEMCPY(info->addrecs, addrecs, info->n_addrecs);
+	DEL_ARR_F(addrecs);
+
+	analyze_exit_condition(info);
+	DB((dbg, LEVEL_1, "%+F: %u induction variables, trip count %ld\n",
+	    loop, (unsigned)info->n_addrecs, info->trip_count));
+	return info;
+}
+
+scev_loop_info_t const *scev_get_loop_info(ir_loop *const loop,
+                                           ir_node *const header)
+{
+	if (cached_loops == NULL) {
+		FIRM_DBG_REGISTER(dbg, "firm.ana.scev");
+		obstack_init(&obst);
+		cached_loops = NEW_ARR_F(ir_loop*, 0);
+	}
+	/* only trust the link when we set it: other modules use it, too */
+	for (size_t i = 0, n = ARR_LEN(cached_loops); i < n; ++i) {
+		if (cached_loops[i] == loop)
+			return (scev_loop_info_t const*)get_loop_link(loop);
+	}
+
+	scev_loop_info_t *const info = analyze_loop(loop, header);
+	set_loop_link(loop, info);
+	ARR_APP1(ir_loop*, cached_loops, loop);
+	return info;
+}
+
+void scev_free_info(void)
+{
+	if (cached_loops == NULL)
+		return;
+	for (size_t i = 0, n = ARR_LEN(cached_loops); i < n; ++i) {
+		set_loop_link(cached_loops[i], NULL);
+	}
+	DEL_ARR_F(cached_loops);
+	cached_loops = NULL;
+	obstack_free(&obst, NULL);
+}
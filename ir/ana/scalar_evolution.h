@@ -0,0 +1,68 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Scalar evolution analysis for loop induction variables.
+ *
+ * Recognizes the induction variables of a loop in add-recurrence form
+ * (initial value plus a loop-invariant step per iteration) and, for
+ * counted loops, derives the loop trip count. The result is cached in
+ * the ir_loop via its link field, so the loop passes share one analysis
+ * instead of re-deriving the induction information each.
+ */
+#ifndef FIRM_ANA_SCALAR_EVOLUTION_H
+#define FIRM_ANA_SCALAR_EVOLUTION_H
+
+#include <stddef.h>
+
+#include "firm_types.h"
+
+/**
+ * An induction variable in add-recurrence form: the value starts at init
+ * and advances by step on every iteration of the loop.
+ */
+typedef struct scev_addrec_t {
+	ir_node   *phi;     /**< header Phi holding the current value */
+	ir_node   *add;     /**< Add computing the value of the next iteration */
+	ir_node   *init;    /**< loop-invariant value entering the loop */
+	ir_node   *step;    /**< loop-invariant step operand of the Add */
+	ir_tarval *init_tv; /**< constant initial value or NULL */
+	ir_tarval *step_tv; /**< constant step or NULL */
+} scev_addrec_t;
+
+/**
+ * Everything the analysis knows about one loop.
+ */
+typedef struct scev_loop_info_t {
+	ir_node       *header;    /**< block dominating all loop blocks */
+	scev_addrec_t *addrecs;   /**< the recognized induction variables */
+	size_t         n_addrecs;
+	/* counted loop facts, only valid if counter is not NULL: */
+	scev_addrec_t *counter;   /**< the add-rec tested by the exit condition */
+	ir_node       *cmp;       /**< the exit condition Cmp(counter, limit) */
+	ir_tarval     *limit_tv;  /**< the constant loop bound */
+	/** Number of loop iterations, counting the first one, or -1 when the
+	 * bound is not a compile time constant. A computed count implies that
+	 * the counter reaches the bound without wrapping around. */
+	long           trip_count;
+} scev_loop_info_t;
+
+/**
+ * Returns the scalar evolution info of @p loop, analyzing it on first
+ * request and returning the cached result afterwards. The graph needs
+ * consistent outs. @p header must be the loop header, i.e. the block
+ * dominating all blocks of the loop.
+ */
+scev_loop_info_t const *scev_get_loop_info(ir_loop *loop, ir_node *header);
+
+/**
+ * Frees all cached scalar evolution info and clears the loop links used
+ * for caching. Must be called before the loop tree is deallocated or the
+ * graph is transformed.
+ */
+void scev_free_info(void);
+
+#endif
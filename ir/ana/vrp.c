@@ -26,29 +26,56 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 
+/** Maximum operand depth followed by an on-demand query. */
+#define VRP_MAX_DEPTH 64
+
 typedef struct vrp_env_t {
 	deq_t        workqueue;
 	bitset_t    *visited;
 	ir_vrp_info *info;
 } vrp_env_t;
 
-static vrp_attr *vrp_get_or_set_info(ir_vrp_info *info, const ir_node *node)
+/** Cached information for one node. The public part must stay first so
+ * that the pointer stored in the nodemap can be handed out directly. */
+typedef struct vrp_entry_t {
+	vrp_attr attr;       /**< the public value information */
+	unsigned generation; /**< generation the information was computed in */
+	bool     busy;       /**< currently being (re)computed, breaks cycles */
+} vrp_entry_t;
+
+static void vrp_reset_attr(vrp_attr *attr, ir_mode *mode)
+{
+	attr->range_type   = VRP_UNDEFINED;
+	attr->bits_set     = get_mode_null(mode);
+	attr->bits_not_set = get_mode_all_one(mode);
+	attr->range_bottom = tarval_bad;
+	attr->range_top    = tarval_bad;
+}
+
+static vrp_entry_t *vrp_get_or_set_entry(ir_vrp_info *info,
+                                         const ir_node *node)
 {
-	vrp_attr *attr = ir_nodemap_get(vrp_attr, &info->infos, node);
-	if (attr == NULL) {
-		ir_mode *mode = get_irn_mode(node);
-		assert(mode_is_int(mode));
-
-		attr = OALLOCZ(&info->obst, vrp_attr);
-		attr->range_type   = VRP_UNDEFINED;
-		attr->bits_set     = get_mode_null(mode);
-		attr->bits_not_set = get_mode_all_one(mode);
-		attr->range_bottom = tarval_bad;
-		attr->range_top    = tarval_bad;
-
-		ir_nodemap_insert(&info->infos, node, attr);
+	vrp_entry_t *entry = ir_nodemap_get(vrp_entry_t, &info->infos, node);
+	ir_mode     *mode  = get_irn_mode(node);
+	assert(mode_is_int(mode));
+
+	if (entry == NULL) {
+		entry = OALLOCZ(&info->obst, vrp_entry_t);
+		vrp_reset_attr(&entry->attr, mode);
+		/* not computed yet: start out stale */
+		entry->generation = info->generation - 1;
+		ir_nodemap_insert(&info->infos, node, entry);
+	} else if (entry->generation != info->generation && !entry->busy) {
+		/* the graph changed since this was computed; anything derived
+		 * from the stale facts must start from scratch */
+		vrp_reset_attr(&entry->attr, mode);
 	}
-	return attr;
+	return entry;
+}
+
+static vrp_attr *vrp_get_or_set_info(ir_vrp_info *info, const ir_node *node)
+{
+	return &vrp_get_or_set_entry(info, node)->attr;
 }
 
 vrp_attr *vrp_get_info(const ir_node *node)
@@ -56,7 +83,10 @@ vrp_attr *vrp_get_info(const ir_node *node)
 	ir_graph *irg = get_irn_irg(node);
 	if (irg->vrp.infos.data == NULL)
 		return NULL;
-	return ir_nodemap_get(vrp_attr, &irg->vrp.infos, node);
+	vrp_entry_t *entry = ir_nodemap_get(vrp_entry_t, &irg->vrp.infos, node);
+	if (entry == NULL || entry->generation != irg->vrp.generation)
+		return NULL;
+	return &entry->attr;
 }
 
 static int vrp_update_node(ir_vrp_info *info, ir_node *node)
@@ -71,7 +101,9 @@ static int vrp_update_node(ir_vrp_info *info, ir_node *node)
 		return 0; /* we don't optimize for non-int-nodes*/
 	}
 
-	vrp_attr *vrp = vrp_get_or_set_info(info, node);
+	vrp_entry_t *entry = vrp_get_or_set_entry(info, node);
+	vrp_attr    *vrp   = &entry->attr;
+	entry->generation  = info->generation;
 
 	/* TODO: Check if all predecessors have valid VRP information*/
 
@@ -498,22 +530,93 @@ static void dump_vrp_info(void *ctx, FILE *F, const ir_node *node)
 
 static hook_entry_t dump_hook;
 
-void set_vrp_data(ir_graph *irg)
+/**
+ * hook_replace listener: graph surgery makes the facts derived for the
+ * affected graph unreliable, so move on to a new generation. The cached
+ * entries are revalidated lazily on the next query instead of being
+ * thrown away wholesale.
+ */
+static void vrp_invalidate_hook(void *ctx, ir_node *old_node,
+                                ir_node *new_node)
 {
-	if (irg->vrp.infos.data != NULL)
-		free_vrp_data(irg);
+	(void)ctx;
+	(void)new_node;
+	ir_graph *irg = get_irn_irg(old_node);
+	if (irg->vrp.infos.data == NULL)
+		return;
+	++irg->vrp.generation;
+}
+
+static hook_entry_t invalidate_hook;
 
+/**
+ * Initializes the vrp maps of @p irg without computing any data yet.
+ */
+static void vrp_init_data(ir_graph *irg)
+{
 	FIRM_DBG_REGISTER(dbg, "ir.ana.vrp");
 
-	assure_irg_outs(irg); /* ensure that out edges are consistent*/
 	ir_nodemap_init(&irg->vrp.infos, irg);
 	obstack_init(&irg->vrp.obst);
-	ir_vrp_info *info = &irg->vrp;
+	irg->vrp.generation = 0;
 
 	if (dump_hook.hook._hook_node_info == NULL) {
 		dump_hook.hook._hook_node_info = dump_vrp_info;
 		register_hook(hook_node_info, &dump_hook);
 	}
+	if (invalidate_hook.hook._hook_replace == NULL) {
+		invalidate_hook.hook._hook_replace = vrp_invalidate_hook;
+		register_hook(hook_replace, &invalidate_hook);
+	}
+}
+
+/**
+ * Computes the information of @p node on demand: the operands are
+ * (re)validated recursively up to a depth limit, then the node itself is
+ * updated. Cycles are broken optimistically at the currently-busy node,
+ * which merely weakens the result, so unlike the eager fixpoint no
+ * iteration is needed.
+ */
+static void vrp_compute(ir_vrp_info *info, ir_node *node, int depth)
+{
+	if (!mode_is_int(get_irn_mode(node)))
+		return;
+
+	vrp_entry_t *entry = vrp_get_or_set_entry(info, node);
+	if (entry->busy || entry->generation == info->generation)
+		return;
+
+	entry->busy = true;
+	if (depth < VRP_MAX_DEPTH) {
+		foreach_irn_in(node, i, pred) {
+			vrp_compute(info, pred, depth + 1);
+		}
+	}
+	vrp_update_node(info, node);
+	entry->busy = false;
+}
+
+vrp_attr *vrp_get_or_compute_info(ir_node *node)
+{
+	if (!mode_is_int(get_irn_mode(node)))
+		return NULL;
+
+	ir_graph *irg = get_irn_irg(node);
+	if (irg->vrp.infos.data == NULL)
+		vrp_init_data(irg);
+
+	vrp_compute(&irg->vrp, node, 0);
+	return vrp_get_info(node);
+}
+
+void set_vrp_data(ir_graph *irg)
+{
+	if (irg->vrp.infos.data != NULL)
+		free_vrp_data(irg);
+
+	assure_irg_outs(irg); /* ensure that out edges are consistent*/
+	vrp_init_data(irg);
+	ir_vrp_info *info = &irg->vrp;
 
 	vrp_env_t *env = OALLOCZ(&irg->vrp.obst, vrp_env_t);
 	env->info      = info;
@@ -16,13 +16,17 @@
 #include "amd64_optimize.h"
 #include "amd64_transform.h"
 #include "amd64_varargs.h"
+#include "be_t.h"
+#include "bearch.h"
 #include "beflags.h"
 #include "beirg.h"
+#include "belistsched.h"
 #include "bemodule.h"
 #include "bera.h"
 #include "besched.h"
 #include "bespillslots.h"
 #include "bestack.h"
+#include "betranshlp.h"
 #include "beutil.h"
 #include "gen_amd64_regalloc_if.h"
 #include "irarch.h"
@@ -43,10 +47,16 @@
 #include "platform_t.h"
 #include "target_t.h"
 
-pmap *amd64_constants;
-
 ir_mode *amd64_mode_xmm;
 
+bool amd64_no_x87;
+
+bool amd64_compact_jump_tables = true;
+
+bool amd64_align_loops = true;
+
+bool amd64_use_fma;
+
 static ir_node *create_push(ir_node *node, ir_node *schedpoint, ir_node *sp,
                             ir_node *mem, ir_entity *ent, x86_insn_size_t size)
 {
@@ -422,7 +432,7 @@ static void amd64_select_instructions(ir_graph *irg)
 	be_dump(DUMP_BE, irg, "opt");
 }
 
-static void introduce_epilogue(ir_node *ret, bool omit_fp)
+static void introduce_epilogue(ir_node *ret, bool omit_fp, bool use_red_zone)
 {
 	ir_graph *irg      = get_irn_irg(ret);
 	ir_node  *block    = get_nodes_block(ret);
@@ -443,7 +453,7 @@ static void introduce_epilogue(ir_node *ret, bool omit_fp)
 
 		set_irn_n(ret, n_amd64_ret_mem, curr_mem);
 		set_irn_n(ret, n_rbp,           curr_bp);
-	} else {
+	} else if (!use_red_zone) {
 		ir_type *frame_type = get_irg_frame_type(irg);
 		unsigned frame_size = get_type_size(frame_type);
 		ir_node *incsp = amd64_new_IncSP(block, curr_sp, -(int)frame_size,
@@ -459,7 +469,8 @@ static void introduce_epilogue(ir_node *ret, bool omit_fp)
 	}
 }
 
-static void introduce_prologue(ir_graph *const irg, bool omit_fp)
+static void introduce_prologue(ir_graph *const irg, bool omit_fp,
+                               bool use_red_zone)
 {
 	const arch_register_t *sp         = &amd64_registers[REG_RSP];
 	const arch_register_t *bp         = &amd64_registers[REG_RBP];
@@ -491,7 +502,7 @@ static void introduce_prologue(ir_graph *const irg, bool omit_fp)
 
 		/* make sure the initial IncSP is really used by someone */
 		be_keep_if_unused(incsp);
-	} else {
+	} else if (!use_red_zone) {
 		ir_node *const incsp = amd64_new_IncSP(block, initial_sp,
 		                                       frame_size, false);
 		sched_add_after(start, incsp);
@@ -499,15 +510,30 @@ static void introduce_prologue(ir_graph *const irg, bool omit_fp)
 	}
 }
 
-static void introduce_prologue_epilogue(ir_graph *irg, bool omit_fp)
+static void introduce_prologue_epilogue(ir_graph *irg, bool omit_fp,
+                                        bool use_red_zone)
 {
 	/* introduce epilogue for every return node */
 	foreach_irn_in(get_irg_end_block(irg), i, ret) {
 		assert(is_amd64_ret(ret));
-		introduce_epilogue(ret, omit_fp);
+		introduce_epilogue(ret, omit_fp, use_red_zone);
 	}
 
-	introduce_prologue(irg, omit_fp);
+	introduce_prologue(irg, omit_fp, use_red_zone);
+}
+
+/**
+ * Walker checking whether the graph keeps the stack pointer untouched, so
+ * frame accesses may target the red zone below it.
+ */
+static void check_red_zone_node(ir_node *const node, void *const env)
+{
+	bool *const can_use = (bool*)env;
+	if (is_amd64_call(node) || is_amd64_sub_sp(node)
+	 || is_amd64_push_am(node) || is_amd64_push_reg(node)
+	 || is_amd64_pop_am(node)
+	 || (be_is_IncSP(node) && be_get_IncSP_offset(node) != 0))
+		*can_use = false;
 }
 
 static bool node_has_sp_base(ir_node const *const node,
@@ -600,7 +626,7 @@ int amd64_get_sp_change(ir_node *const node)
 /**
  * Called immediately before emit phase.
  */
-static void amd64_finish_and_emit(ir_graph *irg)
+static void amd64_finish_graph(ir_graph *irg)
 {
 	amd64_irg_data_t const *const irg_data = amd64_get_irg_data(irg);
 	bool                    const omit_fp  = irg_data->omit_fp;
@@ -619,7 +645,15 @@ static void amd64_finish_and_emit(ir_graph *irg)
 
 	irg_block_walk_graph(irg, NULL, amd64_after_ra_walker, NULL);
 
-	introduce_prologue_epilogue(irg, omit_fp);
+	/* A leaf function with a small frame needs no stack pointer adjustment
+	 * at all: the SysV ABI guarantees that the 128 bytes below the stack
+	 * pointer (the red zone) are not clobbered asynchronously. */
+	bool use_red_zone = amd64_use_red_zone && omit_fp
+	                 && get_type_size(frame) <= 128;
+	if (use_red_zone)
+		irg_walk_graph(irg, check_red_zone_node, NULL, &use_red_zone);
+
+	introduce_prologue_epilogue(irg, omit_fp, use_red_zone);
 
 	/* fix stack entity offsets */
 	be_fix_stack_nodes(irg, &amd64_registers[REG_RSP]);
@@ -630,11 +664,18 @@ static void amd64_finish_and_emit(ir_graph *irg)
 	/* Fix 2-address code constraints. */
 	amd64_finish_irg(irg);
 
-	amd64_simulate_graph_x87(irg);
+	if (!amd64_no_x87)
+		amd64_simulate_graph_x87(irg);
 
 	amd64_peephole_optimization(irg);
 
-	/* emit code */
+	/* after the peepholes: they rewrite leas into the ALU instructions
+	 * the reload folding wants to see */
+	amd64_fold_mem_operands(irg);
+}
+
+static void amd64_emit_graph(ir_graph *irg)
+{
 	be_timer_push(T_EMIT);
 	amd64_emit_function(irg);
 	be_timer_pop(T_EMIT);
@@ -652,39 +693,125 @@ static const regalloc_if_t amd64_regalloc_if = {
 	.new_reload  = amd64_new_reload,
 };
 
-static void amd64_generate_code(FILE *output, const char *cup_name)
+/** Shared "stack pointer is non-SSA" bitset for all graphs. */
+static unsigned *amd64_sp_is_non_ssa;
+
+/**
+ * Tries to use the flags of an arithmetic instruction computing the reversed
+ * comparison instead of rematerializing an explicit cmp.  A cmp b sets the
+ * same flags as sub b, a with all condition codes reversed, so a sub on the
+ * swapped operands (the direct case is handled by CSE already) makes the cmp
+ * redundant if all consumers carry an invertible condition code.
+ */
+static bool amd64_try_replace_flags(ir_node *consumers, ir_node *flags,
+                                    ir_node *available)
 {
-	amd64_constants = pmap_create();
-	be_begin(output, cup_name);
-	unsigned *const sp_is_non_ssa = rbitset_alloca(N_AMD64_REGISTERS);
-	rbitset_set(sp_is_non_ssa, REG_RSP);
+	if (!is_amd64_cmp(flags) && !is_amd64_sub(flags))
+		return false;
+	unsigned pn;
+	if (is_amd64_sub(available)) {
+		pn = pn_amd64_sub_flags;
+	} else if (is_amd64_cmp(available)) {
+		pn = pn_amd64_cmp_flags;
+	} else {
+		return false;
+	}
+	/* Only handle the plain register-register forms, where the operands are
+	 * inputs 0 and 1. */
+	amd64_attr_t const *const flags_attr = get_amd64_attr_const(flags);
+	amd64_attr_t const *const avail_attr = get_amd64_attr_const(available);
+	if (flags_attr->op_mode != AMD64_OP_REG_REG
+	 || avail_attr->op_mode != AMD64_OP_REG_REG
+	 || flags_attr->size    != avail_attr->size)
+		return false;
+	if (get_irn_n(flags, 0) != get_irn_n(available, 1)
+	 || get_irn_n(flags, 1) != get_irn_n(available, 0))
+		return false;
+	/* Reversing the comparison only works for consumers with a condition
+	 * code; adc/sbb-style consumers need the carry flag as it is. */
+	for (ir_node *c = consumers; c != NULL; c = (ir_node*)get_irn_link(c)) {
+		if (!is_amd64_jcc(c) && !is_amd64_setcc(c))
+			return false;
+	}
 
-	foreach_irp_irg(i, irg) {
-		if (!be_step_first(irg))
-			continue;
+	arch_set_irn_register_out(available, pn, &amd64_registers[REG_EFLAGS]);
+	ir_node *const proj = get_irn_mode(available) == mode_T
+	                    ? be_get_or_make_Proj_for_pn(available, pn)
+	                    : available;
+	for (ir_node *c = consumers; c != NULL; c = (ir_node*)get_irn_link(c)) {
+		amd64_cc_attr_t *const cc_attr = get_amd64_cc_attr(c);
+		cc_attr->cc = x86_invert_condition_code(cc_attr->cc);
+
+		int const pos = be_get_input_pos_for_req(c, &amd64_class_reg_req_flags);
+		assert(pos >= 0);
+		set_irn_n(c, pos, proj);
+	}
+	return true;
+}
 
-		struct obstack *obst = be_get_be_obst(irg);
-		be_birg_from_irg(irg)->isa_link = OALLOCZ(obst, amd64_irg_data_t);
+/**
+ * Everything from instruction selection up to (but excluding) emission
+ * for one graph.  Must not touch the emitter, so the driver may run it
+ * on a worker thread.
+ */
+static void amd64_codegen_irg(ir_graph *irg)
+{
+	if (!be_step_first(irg))
+		return;
 
-		be_birg_from_irg(irg)->non_ssa_regs = sp_is_non_ssa;
-		amd64_select_instructions(irg);
+	struct obstack *obst = be_get_be_obst(irg);
+	be_birg_from_irg(irg)->isa_link = OALLOCZ(obst, amd64_irg_data_t);
 
-		be_step_schedule(irg);
+	be_birg_from_irg(irg)->non_ssa_regs = amd64_sp_is_non_ssa;
+	amd64_select_instructions(irg);
 
-		be_timer_push(T_RA_PREPARATION);
-		be_sched_fix_flags(irg, &amd64_reg_classes[CLASS_amd64_flags], NULL,
-		                   NULL, NULL);
-		be_timer_pop(T_RA_PREPARATION);
+	be_step_schedule(irg);
 
-		be_step_regalloc(irg, &amd64_regalloc_if);
+	be_timer_push(T_RA_PREPARATION);
+	be_sched_fix_flags(irg, &amd64_reg_classes[CLASS_amd64_flags], NULL,
+	                   NULL, &amd64_try_replace_flags);
+	be_timer_pop(T_RA_PREPARATION);
 
-		amd64_finish_and_emit(irg);
+	be_step_regalloc(irg, &amd64_regalloc_if);
 
-		be_step_last(irg);
+	amd64_finish_graph(irg);
+}
+
+static void amd64_generate_code(FILE *output, const char *cup_name)
+{
+	be_init_tarval_entities();
+	be_begin(output, cup_name);
+	unsigned *const sp_is_non_ssa = rbitset_alloca(N_AMD64_REGISTERS);
+	rbitset_set(sp_is_non_ssa, REG_RSP);
+	amd64_sp_is_non_ssa = sp_is_non_ssa;
+
+	if (be_parallel_codegen()) {
+		/* Farm the per-graph work out to worker threads; the assembly
+		 * has to be written in program order, so emission is serialized
+		 * afterwards. */
+		be_codegen_irgs(amd64_codegen_irg);
+
+		foreach_irp_irg(i, irg) {
+			ir_entity *entity = get_irg_entity(irg);
+			if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN)
+				continue;
+			amd64_emit_graph(irg);
+			be_step_last(irg);
+		}
+	} else {
+		foreach_irp_irg(i, irg) {
+			amd64_codegen_irg(irg);
+
+			ir_entity *entity = get_irg_entity(irg);
+			if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN)
+				continue;
+			amd64_emit_graph(irg);
+			be_step_last(irg);
+		}
 	}
 
 	be_finish();
-	pmap_destroy(amd64_constants);
+	be_free_tarval_entities();
 }
 
 static const ir_settings_arch_dep_t amd64_arch_dep = {
@@ -727,6 +854,9 @@ static void amd64_lower_for_target(void)
 		be_after_transform(irg, "lower-switch");
 	}
 
+	amd64_lower128();
+	be_after_irp_transform("lower-128");
+
 	foreach_irp_irg(i, irg) {
 		/* lower for mode_b stuff */
 		ir_lower_mode_b(irg, mode_Lu);
@@ -744,14 +874,20 @@ static void amd64_lower_for_target(void)
 		be_after_transform(irg, "lower-copyb");
 	}
 
-	ir_builtin_kind supported[6];
+	ir_builtin_kind supported[12];
 	size_t  s = 0;
+	supported[s++] = ir_bk_prefetch;
 	supported[s++] = ir_bk_ffs;
 	supported[s++] = ir_bk_clz;
 	supported[s++] = ir_bk_ctz;
 	supported[s++] = ir_bk_compare_swap;
+	supported[s++] = ir_bk_atomic_exchange;
+	supported[s++] = ir_bk_atomic_fetch_add;
 	supported[s++] = ir_bk_saturating_increment;
 	supported[s++] = ir_bk_va_start;
+	supported[s++] = ir_bk_add_overflow;
+	supported[s++] = ir_bk_sub_overflow;
+	supported[s++] = ir_bk_mul_overflow;
 
 	assert(s <= ARRAY_SIZE(supported));
 	lower_builtins(s, supported, amd64_lower_va_arg);
@@ -765,9 +901,22 @@ static void amd64_init_types(void)
 	amd64_mode_xmm = new_int_mode("x86_xmm", 128, 0, 0);
 	x86_init_x87_type();
 
+	if (amd64_no_x87) {
+		/* Degrade long double to plain double, so all floating point
+		 * strictly uses SSE registers and no x87 code is ever created. */
+		ir_platform.x87_long_double   = false;
+		ir_platform.long_double_size  = 8;
+		ir_platform.long_double_align = 8;
+	}
+
 	ir_platform.va_list_type = amd64_build_va_list_type();
 }
 
+static unsigned amd64_get_op_latency(ir_node const *const node)
+{
+	return arch_get_op_timing(get_irn_op(node)).latency;
+}
+
 static void amd64_init(void)
 {
 	amd64_init_types();
@@ -775,16 +924,17 @@ static void amd64_init(void)
 	amd64_create_opcodes();
 	amd64_cconv_init();
 	x86_set_be_asm_constraint_support(&amd64_asm_constraints);
+	be_list_sched_set_latency(amd64_get_op_latency);
 
 	ir_target.experimental = "the amd64 backend is experimental and unfinished (consider the ia32 backend)";
 	ir_target.fast_unaligned_memaccess = true;
+	ir_target.am_scale_limit           = 3;
 	ir_target.float_int_overflow       = ir_overflow_indefinite;
 }
 
 static unsigned amd64_get_op_estimated_cost(const ir_node *node)
 {
-	(void)node;/* TODO */
-	return 1;
+	return arch_get_op_timing(get_irn_op(node)).latency;
 }
 
 /** we don't have a concept of aliasing registers, so enumerate them
@@ -834,6 +984,10 @@ void be_init_arch_amd64(void)
 {
 	static const lc_opt_table_entry_t options[] = {
 		LC_OPT_ENT_BOOL("no-red-zone", "gcc compatibility",                &amd64_use_red_zone),
+		LC_OPT_ENT_BOOL("no-x87",      "SSE only floating point, long double becomes double", &amd64_no_x87),
+		LC_OPT_ENT_BOOL("compact-jumptables", "emit switch jump tables as 4 byte table-relative offsets", &amd64_compact_jump_tables),
+		LC_OPT_ENT_BOOL("align-loops", "align hot loop heads to 16 bytes for the uop cache", &amd64_align_loops),
+		LC_OPT_ENT_BOOL("fma",         "contract float mul+add to FMA3 vfmadd instructions", &amd64_use_fma),
 		LC_OPT_LAST
 	};
 	lc_opt_entry_t *be_grp    = lc_opt_get_grp(firm_opt_get_root(), "be");
@@ -18,12 +18,26 @@ typedef struct amd64_irg_data_t {
 	bool omit_fp;
 } amd64_irg_data_t;
 
-extern pmap *amd64_constants; /**< A map of entities that store const tarvals */
-
 extern ir_mode *amd64_mode_xmm;
 
 extern bool amd64_use_red_zone;
 
+/** Avoid x87 code entirely: long double degrades to plain double and the
+ * x87 stack simulation pass is skipped. */
+extern bool amd64_no_x87;
+
+/** Emit switch jump tables as 4 byte table-relative offsets instead of
+ * 8 byte absolute addresses. Always the case for PIC code; this flag
+ * extends it to non-PIC code. */
+extern bool amd64_compact_jump_tables;
+
+/** Align hot loop heads to 16 bytes. */
+extern bool amd64_align_loops;
+
+/** Contract float Mul/Add pairs into vfmadd instructions. Off by
+ * default since FMA3 is not part of the plain x86_64 baseline. */
+extern bool amd64_use_fma;
+
 #define AMD64_REGISTER_SIZE   8
 /** power of two stack alignment on calls */
 #define AMD64_PO2_STACK_ALIGNMENT 4
@@ -48,6 +62,9 @@ int amd64_get_sp_change(ir_node *const node);
 
 void amd64_cconv_init(void);
 
+/** Lower 128bit integer operations to 64bit operation pairs. */
+void amd64_lower128(void);
+
 void amd64_adjust_pic(ir_graph *irg);
 
 void amd64_simulate_graph_x87(ir_graph *irg);
@@ -53,6 +53,24 @@ static const arch_register_t* const float_param_regs[] = {
 };
 static unsigned n_float_param_regs;
 
+/**
+ * Extended parameter register list for private methods. These are only
+ * reached by direct calls with a matching cloned method type (see
+ * mark_private_methods()), so we are free to pass further arguments in
+ * the remaining caller saved registers.
+ */
+static const arch_register_t* const private_param_regs[] = {
+	&amd64_registers[REG_RDI],
+	&amd64_registers[REG_RSI],
+	&amd64_registers[REG_RDX],
+	&amd64_registers[REG_RCX],
+	&amd64_registers[REG_R8],
+	&amd64_registers[REG_R9],
+	&amd64_registers[REG_RAX],
+	&amd64_registers[REG_R10],
+	&amd64_registers[REG_R11],
+};
+
 static const arch_register_t* const result_regs[] = {
 	&amd64_registers[REG_RAX],
 	&amd64_registers[REG_RDX],
@@ -107,6 +125,16 @@ x86_cconv_t *amd64_decide_calling_convention(ir_type *function_type,
 	 * easy in case of variadic functions. */
 	bool amd64_use_x64_abi = ir_platform.amd64_x64abi;
 	unsigned stack_offset = amd64_use_x64_abi ? 32 : 0;
+
+	/* use the register maximizing convention for private methods */
+	const arch_register_t *const *gp_param_regs   = param_regs;
+	unsigned                      n_gp_param_regs = n_param_regs;
+	if ((get_method_additional_properties(function_type) & mtp_property_private)
+	 && !is_method_variadic(function_type) && !amd64_use_x64_abi) {
+		gp_param_regs   = private_param_regs;
+		n_gp_param_regs = ARRAY_SIZE(private_param_regs);
+	}
+
 	for (size_t i = 0; i < n_params; ++i) {
 		ir_type *param_type = get_method_param_type(function_type,i);
 		reg_or_stackslot_t *param = &params[i];
@@ -122,8 +150,8 @@ x86_cconv_t *amd64_decide_calling_convention(ir_type *function_type,
 			if (amd64_use_x64_abi) {
 				++param_regnum;
 			}
-		} else if (!mode_is_float(mode) && param_regnum < n_param_regs) {
-			param->reg = param_regs[param_regnum++];
+		} else if (!mode_is_float(mode) && param_regnum < n_gp_param_regs) {
+			param->reg = gp_param_regs[param_regnum++];
 			if (amd64_use_x64_abi) {
 				++float_param_regnum;
 			}
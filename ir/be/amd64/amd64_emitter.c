@@ -22,6 +22,7 @@
 #include "beirg.h"
 #include "benode.h"
 #include "besched.h"
+#include "execfreq.h"
 #include "gen_amd64_emitter.h"
 #include "gen_amd64_regalloc_if.h"
 #include "iredges_t.h"
@@ -606,7 +607,7 @@ static void emit_jumptable_target(ir_entity const *const table,
                                   ir_node const *const proj_x)
 {
 	be_emit_cfop_target(proj_x);
-	if (ir_platform.pic_style != BE_PIC_NONE) {
+	if (ir_platform.pic_style != BE_PIC_NONE || amd64_compact_jump_tables) {
 		be_emit_char('-');
 		be_gas_emit_entity(table);
 	}
@@ -617,8 +618,9 @@ static void emit_amd64_jmp_switch(const ir_node *node)
 	const amd64_switch_jmp_attr_t *attr = get_amd64_switch_jmp_attr_const(node);
 
 	amd64_emitf(node, "jmp %*AM");
-	ir_mode *entry_mode = ir_platform.pic_style != BE_PIC_NONE ? mode_Iu
-	                                                           : mode_Lu;
+	ir_mode *entry_mode
+		= ir_platform.pic_style != BE_PIC_NONE || amd64_compact_jump_tables
+		? mode_Iu : mode_Lu;
 	be_emit_jump_table(node, &attr->swtch, entry_mode, emit_jumptable_target);
 }
 
@@ -805,12 +807,56 @@ static void amd64_register_emitters(void)
 	be_set_emitter(op_be_Perm,          emit_be_Perm);
 }
 
+/** log2 of the alignment applied to hot loop heads. 16 byte alignment
+ * keeps such blocks within as few fetch/uop cache lines as possible. */
+#define LOOP_ALIGNMENT          4
+/** maximum number of padding bytes spent on aligning a loop head */
+#define LOOP_ALIGNMENT_MAX_SKIP 15
+/** minimum execution frequency (relative to the function entry) for a
+ * block to be considered a hot loop head */
+#define LOOP_ALIGNMENT_MIN_FREQ 2.0
+
+/**
+ * Test whether a block is a hot loop head worth aligning: it must be
+ * clearly hotter than the function entry and be entered by jumps more
+ * often than by falling through, as is the case for a loop head with its
+ * backedge. Padding in front of cold blocks or blocks mostly entered by
+ * fallthrough would only be fetched, never skipped over.
+ */
+static bool amd64_should_align_block(ir_node const *const block)
+{
+	double const block_freq = get_block_execfreq(block);
+	if (block_freq < LOOP_ALIGNMENT_MIN_FREQ)
+		return false;
+
+	ir_node const *const prev      = be_emit_get_prev_block(block);
+	double               prev_freq = 0.0; /**< execfreq of the fallthrough block */
+	double               jmp_freq  = 0.0; /**< execfreq of all non-fallthrough blocks */
+	for (int i = 0, n_cfgpreds = get_Block_n_cfgpreds(block);
+	     i < n_cfgpreds; ++i) {
+		ir_node const *const pred      = get_Block_cfgpred_block(block, i);
+		double         const pred_freq = get_block_execfreq(pred);
+		if (pred == prev) {
+			prev_freq += pred_freq;
+		} else {
+			jmp_freq += pred_freq;
+		}
+	}
+	return jmp_freq > prev_freq;
+}
+
 /**
  * Walks over the nodes in a block connected by scheduling edges
  * and emits code for each node.
  */
 static void amd64_gen_block(ir_node *block)
 {
+	if (amd64_align_loops && amd64_should_align_block(block)) {
+		/* gas pads code sections with multi-byte nops */
+		be_emit_irprintf("\t.p2align %u,,%u\n", LOOP_ALIGNMENT,
+		                 LOOP_ALIGNMENT_MAX_SKIP);
+		be_emit_write_line();
+	}
 	be_gas_begin_block(block);
 
 	if (omit_fp) {
@@ -0,0 +1,56 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief    amd64 128bit lowering
+ *
+ * Splits 128bit integer operations into operations on 64bit registers.
+ * Most cases are covered by the generic doubleword lowering; we only
+ * override Mul, which would otherwise become a __multi3 call, with an
+ * inline mulq/imulq sequence built around Mulh.
+ */
+#include "amd64_bearch_t.h"
+#include "ircons_t.h"
+#include "irmode_t.h"
+#include "lower_dw.h"
+
+static void lower128_mul(ir_node *const node)
+{
+	/* (2^64 lh + ll) * (2^64 rh + rl)
+	 *  = 2^64 (ll * rh + lh * rl + mulh(ll, rl)) + ll * rl  (mod 2^128) */
+	dbg_info *dbgi       = get_irn_dbg_info(node);
+	ir_node  *block      = get_nodes_block(node);
+	ir_node  *left       = get_Mul_left(node);
+	ir_node  *right      = get_Mul_right(node);
+	ir_node  *left_low   = get_lowered_low(left);
+	ir_node  *left_high  = get_lowered_high(left);
+	ir_node  *right_low  = get_lowered_low(right);
+	ir_node  *right_high = get_lowered_high(right);
+	ir_mode  *mode       = get_node_high_mode(node);
+	ir_node  *conv_l_low = new_rd_Conv(dbgi, block, left_low, mode);
+	ir_node  *mul1       = new_rd_Mul(dbgi, block, conv_l_low, right_high);
+	ir_node  *conv_r_low = new_rd_Conv(dbgi, block, right_low, mode);
+	ir_node  *mul2       = new_rd_Mul(dbgi, block, conv_r_low, left_high);
+	ir_node  *mulh       = new_rd_Mulh(dbgi, block, left_low, right_low);
+	ir_node  *conv_mulh  = new_rd_Conv(dbgi, block, mulh, mode);
+	ir_node  *add1       = new_rd_Add(dbgi, block, mul2, mul1);
+	ir_node  *add2       = new_rd_Add(dbgi, block, add1, conv_mulh);
+	ir_node  *low        = new_rd_Mul(dbgi, block, left_low, right_low);
+	ir_set_dw_lowered(node, low, add2);
+}
+
+void amd64_lower128(void)
+{
+	lwrdw_param_t lower_dw_params = {
+		mode_Lu,
+		mode_Ls,
+		128  /* doubleword size */
+	};
+
+	ir_prepare_dw_lowering(&lower_dw_params);
+	ir_register_dw_lower_function(op_Mul, lower128_mul);
+	ir_lower_dw_ops();
+}
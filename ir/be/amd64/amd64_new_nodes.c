@@ -16,6 +16,7 @@
 #include "amd64_nodes_attr.h"
 #include "bedump.h"
 #include "gen_amd64_regalloc_if.h"
+#include "hashptr.h"
 #include "ircons_t.h"
 #include "irgraph_t.h"
 #include "irmode_t.h"
@@ -192,6 +193,24 @@ int amd64_movimm_attrs_equal(const ir_node *const a, const ir_node *const b)
 	    && imm64s_equal(&attr_a->immediate, &attr_b->immediate);
 }
 
+unsigned amd64_hash_mov_imm(const ir_node *node)
+{
+	const amd64_movimm_attr_t *const attr = get_amd64_movimm_attr_const(node);
+	return hash_ptr(attr->immediate.entity) + (unsigned)attr->immediate.offset;
+}
+
+unsigned amd64_hash_lea(const ir_node *node)
+{
+	const amd64_addr_attr_t *const attr = get_amd64_addr_attr_const(node);
+	unsigned hash = hash_ptr(attr->addr.immediate.entity)
+	              + (unsigned)attr->addr.immediate.offset
+	              + (unsigned)attr->addr.variant;
+	foreach_irn_in(node, i, pred) {
+		hash = 9 * hash + hash_ptr(pred);
+	}
+	return hash;
+}
+
 int amd64_copyb_attrs_equal(const ir_node *const a, const ir_node *const b)
 {
 	const amd64_copyb_attr_t *const attr_a = get_amd64_copyb_attr_const(a);
@@ -23,6 +23,9 @@ void init_amd64_movimm_attributes(ir_node *node, const amd64_imm64_t *imm);
 
 void init_amd64_copyb_attributes(ir_node *node, unsigned size);
 
+unsigned amd64_hash_mov_imm(const ir_node *node);
+unsigned amd64_hash_lea(const ir_node *node);
+
 int amd64_attrs_equal(const ir_node *a, const ir_node *b);
 int amd64_addr_attrs_equal(const ir_node *a, const ir_node *b);
 int amd64_binop_addr_attrs_equal(const ir_node *a, const ir_node *b);
@@ -11,11 +11,13 @@
 
 #include "amd64_new_nodes.h"
 #include "amd64_transform.h"
+#include "bememfold.h"
 #include "benode.h"
 #include "bepeephole.h"
 #include "besched.h"
 #include "gen_amd64_regalloc_if.h"
 #include "iredges_t.h"
+#include "irgmod.h"
 #include "util.h"
 
 static void peephole_amd64_cmp(ir_node *const node)
@@ -190,6 +192,171 @@ static void peephole_be_IncSP(ir_node *const node)
 	be_peephole_IncSP_IncSP(node);
 }
 
+/** Returns true if @p node writes the flags register. */
+static bool amd64_clobbers_flags(ir_node const *const node)
+{
+	be_foreach_out(node, o) {
+		arch_register_req_t const *const req
+			= arch_get_irn_register_req_out(node, o);
+		if (req->cls == &amd64_reg_classes[CLASS_amd64_flags])
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Removes a test instruction that re-computes flags an ALU instruction in
+ * the window already set:
+ *   subl %r2, %r1
+ *   testl %r1, %r1
+ *   je ...
+ * The arithmetic instructions set ZF and SF according to their result just
+ * like test does; the bitwise ones additionally clear CF and OF the same
+ * way. The flag users can therefore read the ALU's flags directly, as long
+ * as their condition only depends on flags with equal semantics and no
+ * instruction in between writes the flags register.
+ */
+static void window_amd64_flags_retest(ir_node *const *const window,
+                                      unsigned const length)
+{
+	ir_node *const alu = window[0];
+	/* for add/sub/neg only ZF and SF match the test semantics, CF and OF
+	 * reflect the operation instead of being cleared */
+	bool const arith
+		= is_amd64_add(alu) || is_amd64_sub(alu) || is_amd64_neg(alu);
+
+	ir_node *const res = get_Proj_for_pn(alu, 0);
+	if (res == NULL)
+		return;
+
+	for (unsigned i = 1; i < length; ++i) {
+		ir_node *const test = window[i];
+		if (is_amd64_test(test)
+		 && get_amd64_attr_const(test)->op_mode == AMD64_OP_REG_REG
+		 && get_irn_n(test, 0) == res && get_irn_n(test, 1) == res
+		 && get_amd64_attr_const(test)->size == get_amd64_attr_const(alu)->size) {
+			ir_node *const test_flags
+				= get_Proj_for_pn(test, pn_amd64_test_flags);
+			if (test_flags == NULL)
+				return;
+
+			foreach_out_edge(test_flags, edge) {
+				ir_node *const user = get_edge_src_irn(edge);
+				if (!is_amd64_jcc(user) && !is_amd64_setcc(user))
+					return;
+				x86_condition_code_t const cc
+					= get_amd64_cc_attr_const(user)->cc;
+				if (cc & (x86_cc_additional_float_cases
+				        | x86_cc_float_parity_cases))
+					return;
+				if (arith
+				 && cc != x86_cc_equal && cc != x86_cc_not_equal
+				 && cc != x86_cc_sign  && cc != x86_cc_not_sign)
+					return;
+			}
+
+			/* pn 1 is the flags output for all handled ALU instructions */
+			ir_node *const alu_flags = be_get_or_make_Proj_for_pn(alu, 1);
+			arch_set_irn_register(alu_flags, &amd64_registers[REG_EFLAGS]);
+			be_peephole_exchange_using_proj(test_flags, alu_flags);
+			return;
+		}
+		if (amd64_clobbers_flags(test))
+			return;
+	}
+}
+
+typedef ir_node *(*construct_binop_func)(dbg_info *dbgi, ir_node *block, int arity, ir_node *const *in, arch_register_req_t const **in_reqs, amd64_binop_addr_attr_t const *attr_init);
+
+/**
+ * Tries to turn the single user of a reloaded value into its memory
+ * operand form, e.g. "mov O(%rbp), %r1; add %r1, %r2" becomes
+ * "add O(%rbp), %r2". Only the untied source operand of a reg-reg ALU
+ * instruction can be replaced: the destination operand stays tied to the
+ * output register assigned by the register allocator.
+ */
+static bool amd64_fold_reload(ir_node *const node, ir_node *const proj,
+                              unsigned const pos)
+{
+	construct_binop_func cons;
+	if (is_amd64_add(node)) {
+		cons = &new_bd_amd64_add;
+	} else if (is_amd64_and(node)) {
+		cons = &new_bd_amd64_and;
+	} else if (is_amd64_cmp(node)) {
+		cons = &new_bd_amd64_cmp;
+	} else if (is_amd64_imul(node)) {
+		cons = &new_bd_amd64_imul;
+	} else if (is_amd64_or(node)) {
+		cons = &new_bd_amd64_or;
+	} else if (is_amd64_sub(node)) {
+		cons = &new_bd_amd64_sub;
+	} else if (is_amd64_xor(node)) {
+		cons = &new_bd_amd64_xor;
+	} else {
+		return false;
+	}
+
+	amd64_binop_addr_attr_t const *const attr
+		= get_amd64_binop_addr_attr_const(node);
+	if (attr->base.base.op_mode != AMD64_OP_REG_REG)
+		return false;
+	/* for AMD64_OP_REG_REG the source operand is input 1 by convention;
+	 * input 0 stays tied to the output register */
+	if (pos != 1)
+		return false;
+
+	/* gp reloads are mov instructions loading from the frame; the slot
+	 * always holds the full spilled value, so narrower users just read
+	 * its low bits */
+	ir_node *const reload = get_Proj_pred(proj);
+	if (!is_amd64_mov_gp(reload))
+		return false;
+	amd64_addr_attr_t const *const reload_attr
+		= get_amd64_addr_attr_const(reload);
+	if (reload_attr->base.op_mode != AMD64_OP_ADDR)
+		return false;
+	x86_addr_t addr = reload_attr->addr;
+	if (addr.variant != X86_ADDR_BASE)
+		return false;
+
+	ir_node *const base    = get_irn_n(reload, addr.base_input);
+	ir_node *const mem     = get_irn_n(reload, addr.mem_input);
+	ir_node *const operand = get_irn_n(node, 0);
+
+	amd64_binop_addr_attr_t folded_attr = *attr;
+	folded_attr.base.base.op_mode = AMD64_OP_REG_ADDR;
+	folded_attr.u.reg_input       = 0;
+	addr.base_input               = 1;
+	addr.mem_input                = 2;
+	folded_attr.base.addr         = addr;
+
+	dbg_info *const dbgi   = get_irn_dbg_info(node);
+	ir_node  *const block  = get_nodes_block(node);
+	ir_node  *const in[]   = { operand, base, mem };
+	ir_node  *const folded = cons(dbgi, block, ARRAY_SIZE(in), in,
+	                              gp_am_reqs[2], &folded_attr);
+	if (!is_amd64_cmp(node))
+		arch_set_irn_register_req_out(folded, 0,
+		                              &amd64_requirement_gp_same_0);
+	be_foreach_out(node, o) {
+		arch_register_t const *const reg = arch_get_irn_register_out(node, o);
+		if (reg != NULL)
+			arch_set_irn_register_out(folded, o, reg);
+	}
+
+	sched_add_before(node, folded);
+	edges_reroute(node, folded);
+	sched_remove(node);
+	kill_node(node);
+	return true;
+}
+
+void amd64_fold_mem_operands(ir_graph *const irg)
+{
+	be_fold_mem_operands(irg, amd64_fold_reload);
+}
+
 void amd64_peephole_optimization(ir_graph *const irg)
 {
 	ir_clear_opcodes_generic_func();
@@ -200,5 +367,11 @@ void amd64_peephole_optimization(ir_graph *const irg)
 	register_peephole_optimization(op_amd64_cvtsi2sd, peephole_amd64_cvtsi2sX);
 	register_peephole_optimization(op_amd64_cvtsi2ss, peephole_amd64_cvtsi2sX);
 	register_peephole_optimization(op_be_IncSP,      peephole_be_IncSP);
+	register_peephole_window_optimization(op_amd64_add, window_amd64_flags_retest);
+	register_peephole_window_optimization(op_amd64_and, window_amd64_flags_retest);
+	register_peephole_window_optimization(op_amd64_neg, window_amd64_flags_retest);
+	register_peephole_window_optimization(op_amd64_or,  window_amd64_flags_retest);
+	register_peephole_window_optimization(op_amd64_sub, window_amd64_flags_retest);
+	register_peephole_window_optimization(op_amd64_xor, window_amd64_flags_retest);
 	be_peephole_opt(irg);
 }
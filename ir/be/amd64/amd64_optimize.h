@@ -12,6 +12,14 @@
 
 #include "firm_types.h"
 
+/**
+ * Folds reloads into memory operands of ALU instructions, erasing the
+ * reload. Run after register allocation and 2-address fixup.
+ *
+ * @param irg  the graph
+ */
+void amd64_fold_mem_operands(ir_graph *irg);
+
 /**
  * Perform peephole optimizations an a graph.
  *
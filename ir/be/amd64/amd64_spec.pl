@@ -151,8 +151,11 @@ my $sextop = {
 };
 
 my $divop = {
-	irn_flags => [ "modify_flags" ],
-	state     => "pinned",
+	irn_flags  => [ "modify_flags" ],
+	state      => "pinned",
+	latency    => 25,
+	throughput => 25,
+	uops       => 10,
 	in_reqs   => "...",
 	out_reqs  => [ "rax", "flags", "mem", "rdx" ],
 	outs      => [ "res_div", "flags", "M", "res_mod" ],
@@ -170,6 +173,8 @@ my $mulop = {
 	# It produces 2 results and has strict constraints
 	irn_flags => [ "modify_flags" ],
 	state     => "exc_pinned",
+	latency   => 3,
+	uops      => 2,
 	in_reqs   => "...",
 	out_reqs  => [ "rax", "flags", "mem", "rdx" ],
 	outs      => [ "res_low", "flags", "M", "res_high" ],
@@ -188,6 +193,17 @@ my $shiftop = {
 	emit      => "{name}%M %SO",
 };
 
+my $prefetchop = {
+	state     => "exc_pinned",
+	in_reqs   => "...",
+	out_reqs  => [ "mem" ],
+	outs      => [ "M" ],
+	attr_type => "amd64_addr_attr_t",
+	attr      => "amd64_op_mode_t op_mode, x86_addr_t addr",
+	fixed     => "x86_insn_size_t size = X86_SIZE_8;",
+	emit      => "{name} %AM",
+};
+
 my $unop = {
 	irn_flags => [ "modify_flags", "rematerializable" ],
 	in_reqs   => [ "gp" ],
@@ -235,6 +251,8 @@ my $binopx_commutative = {
 
 my $cvtop2x = {
 	state     => "exc_pinned",
+	latency   => 4,
+	uops      => 2,
 	in_reqs   => "...",
 	out_reqs  => [ "xmm", "none", "mem" ],
 	outs      => [ "res", "none", "M" ],
@@ -245,6 +263,8 @@ my $cvtop2x = {
 
 my $cvtopx2i = {
 	state     => "exc_pinned",
+	latency   => 4,
+	uops      => 2,
 	in_reqs   => "...",
 	out_reqs  => [ "gp", "none", "mem" ],
 	outs      => [ "res", "none", "M" ],
@@ -380,7 +400,7 @@ div => { template => $divop },
 
 idiv => { template => $divop },
 
-imul => { template => $binop_commutative },
+imul => { template => $binop_commutative, latency => 3 },
 
 imul_1op => {
 	template => $mulop,
@@ -427,6 +447,7 @@ mov_imm => {
 	outs      => [ "res" ],
 	attr_type => "amd64_movimm_attr_t",
 	attr      => "x86_insn_size_t size, const amd64_imm64_t *imm",
+	hash_func => "amd64_hash_mov_imm",
 	emit      => 'mov%M $%C, %D0',
 },
 
@@ -484,6 +505,36 @@ cmpxchg => {
 	emit      => "lock cmpxchg%M %AM",
 },
 
+prefetcht0 => { template => $prefetchop },
+
+prefetcht1 => { template => $prefetchop },
+
+prefetcht2 => { template => $prefetchop },
+
+prefetchnta => { template => $prefetchop },
+
+# implicitly locked when used with a memory operand
+xchg => {
+	state     => "exc_pinned",
+	in_reqs   => "...",
+	out_reqs  => [ "gp", "mem" ],
+	outs      => [ "res", "M" ],
+	attr_type => "amd64_binop_addr_attr_t",
+	attr      => "const amd64_binop_addr_attr_t *attr_init",
+	emit      => "xchg%M %AM",
+},
+
+xadd => {
+	irn_flags => [ "modify_flags" ],
+	state     => "exc_pinned",
+	in_reqs   => "...",
+	out_reqs  => [ "gp", "flags", "mem" ],
+	outs      => [ "res", "flags", "M" ],
+	attr_type => "amd64_binop_addr_attr_t",
+	attr      => "const amd64_binop_addr_attr_t *attr_init",
+	emit      => "lock xadd%M %AM",
+},
+
 # TODO Setcc can also operate on memory
 setcc => {
 	irn_flags => [  ],
@@ -504,6 +555,7 @@ lea => {
 	out_reqs  => [ "gp" ],
 	attr_type => "amd64_addr_attr_t",
 	attr      => "x86_insn_size_t size, x86_addr_t addr",
+	hash_func => "amd64_hash_lea",
 	fixed     => "amd64_op_mode_t op_mode = AMD64_OP_ADDR;\n",
 	emit      => "lea%M %A, %D0",
 },
@@ -568,10 +620,12 @@ bsr => { template => $unop_out },
 
 # SSE
 
-adds => { template => $binopx_commutative },
+adds => { template => $binopx_commutative, latency => 3 },
 
 divs => {
-	template => $binopx,
+	template   => $binopx,
+	latency    => 13,
+	throughput => 5,
 	emit     => "divs%MX %AM",
 },
 
@@ -581,7 +635,23 @@ movs_xmm => {
 	emit     => "movs%MX %AM, %D0",
 },
 
-muls => { template => $binopx_commutative },
+muls => { template => $binopx_commutative, latency => 4 },
+
+# FMA3 scalar fused multiply-add: res = left * right + add.  Emitted as
+# vfmadd213, whose destination is both multiplicand and result, so the
+# output is tied to "left".  Only created when the fma backend option
+# is set, see try_gen_fma().
+fmadds => {
+	irn_flags => [ "rematerializable" ],
+	in_reqs   => [ "xmm", "xmm", "xmm" ],
+	out_reqs  => [ "in_r0" ],
+	ins       => [ "left", "right", "add" ],
+	outs      => [ "res" ],
+	fixed     => "amd64_op_mode_t op_mode = AMD64_OP_REG_REG;",
+	attr      => "x86_insn_size_t size",
+	latency   => 4,
+	emit      => "vfmadd213s%MX %^S2, %^S1, %^D0",
+},
 
 movs_store_xmm => {
 	op_flags  => [ "uses_memory" ],
@@ -596,6 +666,7 @@ movs_store_xmm => {
 
 subs => {
 	template => $binopx,
+	latency  => 3,
 	emit     => "subs%MX %AM",
 },
 
@@ -89,6 +89,18 @@ arch_register_req_t const amd64_requirement_gp_same_0 = {
 	.width             = 1,
 };
 
+static arch_register_req_t const amd64_requirement_gp_same_1 = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.should_be_same    = BIT(1),
+	.width             = 1,
+};
+
+static arch_register_req_t const amd64_requirement_gp_same_2 = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.should_be_same    = BIT(2),
+	.width             = 1,
+};
+
 static const arch_register_req_t amd64_requirement_xmm_same_0 = {
 	.cls               = &amd64_reg_classes[CLASS_amd64_xmm],
 	.should_be_same    = BIT(0),
@@ -299,24 +311,7 @@ static ir_node *get_frame_base(ir_graph *irg)
 
 ir_entity *create_float_const_entity(ir_tarval *const tv)
 {
-	/* TODO: share code with ia32 backend */
-	ir_entity *entity = pmap_get(ir_entity, amd64_constants, tv);
-	if (entity != NULL)
-		return entity;
-
-	ir_mode *mode = get_tarval_mode(tv);
-	ir_type *type = get_type_for_mode(mode);
-	ir_type *glob = get_glob_type();
-
-	entity = new_global_entity(glob, id_unique("C"), type,
-	                           ir_visibility_private,
-	                           IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
-
-	ir_initializer_t *initializer = create_initializer_tarval(tv);
-	set_entity_initializer(entity, initializer);
-
-	pmap_insert(amd64_constants, tv, entity);
-	return entity;
+	return be_create_tarval_entity(tv);
 }
 
 void init_lconst_addr(x86_addr_t *addr, ir_entity *entity)
@@ -985,6 +980,41 @@ static x86_insn_size_t get_size_32_64_from_mode(ir_mode *const mode)
 	return get_mode_size_bits(mode) <= 32 ? X86_SIZE_32 : X86_SIZE_64;
 }
 
+/**
+ * Contract a float Add with a Mul operand into a vfmadd node.  Needs
+ * the fma backend option (FMA3 is not in the x86_64 baseline) and the
+ * graph's permission for imprecise float transformations, since fusing
+ * drops the intermediate rounding of the product.  Returns NULL when
+ * the Add has to be selected normally.
+ */
+static ir_node *try_gen_fma(ir_node *const node, ir_node *const op1,
+                            ir_node *const op2)
+{
+	if (!amd64_use_fma)
+		return NULL;
+	if (!ir_imprecise_float_transforms_allowed_irg(get_irn_irg(node)))
+		return NULL;
+
+	ir_node *mul    = op1;
+	ir_node *addend = op2;
+	if (!is_Mul(mul)) {
+		mul    = op2;
+		addend = op1;
+	}
+	/* only fuse a product that dies in the Add, otherwise it is
+	 * computed separately anyway */
+	if (!is_Mul(mul) || get_irn_n_edges(mul) != 1)
+		return NULL;
+
+	dbg_info *const dbgi      = get_irn_dbg_info(node);
+	ir_node  *const new_block = be_transform_nodes_block(node);
+	ir_node  *const left      = be_transform_node(get_Mul_left(mul));
+	ir_node  *const right     = be_transform_node(get_Mul_right(mul));
+	ir_node  *const add       = be_transform_node(addend);
+	x86_insn_size_t const size = x86_size_from_mode(get_irn_mode(node));
+	return new_bd_amd64_fmadds(dbgi, new_block, left, right, add, size);
+}
+
 static ir_node *gen_Add(ir_node *const node)
 {
 	ir_node *const op1   = get_Add_left(node);
@@ -995,6 +1025,9 @@ static ir_node *gen_Add(ir_node *const node)
 	if (mode_is_float(mode)) {
 		if (mode == x86_mode_E)
 			return gen_binop_x87(node, op1, op2, new_bd_amd64_fadd);
+		ir_node *const fma = try_gen_fma(node, op1, op2);
+		if (fma != NULL)
+			return fma;
 		return gen_binop_am(node, op1, op2, new_bd_amd64_adds,
 		                    pn_amd64_adds_res, match_commutative | match_am);
 	}
@@ -1561,7 +1594,7 @@ static ir_node *gen_Switch(ir_node *const node)
 
 	ir_type   *const utype = get_unknown_type();
 	ir_entity *const entity
-		= new_global_entity(irp->dummy_owner, id_unique("TBL"), utype,
+		= new_global_entity(irp->dummy_owner, irg_unique_ident(irg, "TBL"), utype,
 		                    ir_visibility_private,
 		                    IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
@@ -1570,7 +1603,10 @@ static ir_node *gen_Switch(ir_node *const node)
 	int arity = 0;
 	ir_node *in[1];
 	x86_addr_t addr;
-	if (ir_platform.pic_style != BE_PIC_NONE) {
+	if (ir_platform.pic_style != BE_PIC_NONE || amd64_compact_jump_tables) {
+		/* table-relative 4 byte entries: load the offset sign extended and
+		 * add the table base. Mandatory for PIC (no absolute addresses),
+		 * and halves the table size otherwise. */
 		ir_node *const base
 			= create_picaddr_lea(dbgi, new_block, X86_IMM_PCREL, entity);
 		ir_node *load_in[3];
@@ -3066,6 +3102,95 @@ static ir_node *gen_compare_swap(ir_node *const node)
 	return new_bd_amd64_cmpxchg(dbgi, block, arity, in, reqs, &attr);
 }
 
+static ir_node *gen_prefetch(ir_node *const node)
+{
+	dbg_info *const dbgi  = get_irn_dbg_info(node);
+	ir_node  *const block = be_transform_nodes_block(node);
+	ir_node  *const ptr   = get_Builtin_param(node, 0);
+
+	ir_node *in[3];
+	int arity = 0;
+	x86_addr_t addr;
+	perform_address_matching(ptr, &arity, in, &addr);
+
+	arch_register_req_t const **const reqs = gp_am_reqs[arity];
+	in[arity++] = be_transform_node(get_Builtin_mem(node));
+
+	/* The write hint is ignored: prefetchw needs the PRFCHW extension,
+	 * which we must not assume for a generic x86-64 target. */
+	size_t const n_params = get_Builtin_n_params(node);
+	long   const locality
+		= n_params > 2 ? get_Const_long(get_Builtin_param(node, 2)) : 3;
+
+	ir_node *(*cons)(dbg_info*, ir_node*, int, ir_node *const*,
+	                 arch_register_req_t const**, amd64_op_mode_t, x86_addr_t);
+	switch (locality) {
+	case 0:  cons = new_bd_amd64_prefetchnta; break;
+	case 1:  cons = new_bd_amd64_prefetcht2;  break;
+	case 2:  cons = new_bd_amd64_prefetcht1;  break;
+	default: cons = new_bd_amd64_prefetcht0;  break;
+	}
+	ir_node *const res = cons(dbgi, block, arity, in, reqs,
+	                          AMD64_OP_ADDR, addr);
+	set_irn_pinned(res, get_irn_pinned(node));
+	return res;
+}
+
+/**
+ * Lower an atomic read-modify-write Builtin (xchg/xadd style: the value
+ * register receives the previous memory contents).
+ */
+static ir_node *gen_atomic_rmw(ir_node *const node,
+	ir_node *(*const cons)(dbg_info*, ir_node*, int, ir_node *const*,
+	                       arch_register_req_t const**,
+	                       amd64_binop_addr_attr_t const*))
+{
+	dbg_info *const dbgi    = get_irn_dbg_info(node);
+	ir_node  *const block   = be_transform_nodes_block(node);
+	ir_node  *const ptr     = get_Builtin_param(node, 0);
+	ir_node  *const value   = get_Builtin_param(node, 1);
+	ir_node  *const mem     = get_Builtin_mem(node);
+	ir_node  *const new_val = be_transform_node(value);
+	ir_node  *const new_mem = be_transform_node(mem);
+	ir_mode  *const mode    = get_irn_mode(value);
+
+	ir_node *in[4];
+	int arity = 0;
+	x86_addr_t addr;
+	perform_address_matching(ptr, &arity, in, &addr);
+
+	arch_register_req_t const **const reqs = gp_am_reqs[arity + 1];
+
+	int const value_input = arity;
+	in[arity++] = new_val;
+	in[arity++] = new_mem;
+
+	amd64_binop_addr_attr_t const attr = {
+		.base = {
+			.base = {
+				.op_mode = AMD64_OP_ADDR_REG,
+				.size    = x86_size_from_mode(mode),
+			},
+			.addr = addr,
+		},
+		.u = {
+			.reg_input = value_input,
+		},
+	};
+	ir_node *const res = cons(dbgi, block, arity, in, reqs, &attr);
+
+	/* the instruction overwrites the value register with the old memory
+	 * contents */
+	static arch_register_req_t const *const same_value_reqs[] = {
+		&amd64_requirement_gp_same_0,
+		&amd64_requirement_gp_same_1,
+		&amd64_requirement_gp_same_2,
+	};
+	assert((size_t)value_input < ARRAY_SIZE(same_value_reqs));
+	arch_set_irn_register_req_out(res, 0, same_value_reqs[value_input]);
+	return res;
+}
+
 static ir_node *gen_saturating_increment(ir_node *const node)
 {
 	dbg_info *const dbgi      = get_irn_dbg_info(node);
@@ -3122,6 +3247,123 @@ static ir_node *gen_saturating_increment(ir_node *const node)
 	return sbb;
 }
 
+/**
+ * Transforms an overflow-checking builtin into the plain ALU operation;
+ * gen_Proj_Builtin() picks up both the result and the flags output.
+ * No address/immediate matching here: the flags are only valid when the
+ * operation is performed at exactly the operand width.
+ */
+static ir_node *gen_overflow_binop(ir_node *const node,
+                                   construct_binop_func const cons)
+{
+	dbg_info *const dbgi      = get_irn_dbg_info(node);
+	ir_node  *const new_block = be_transform_nodes_block(node);
+	ir_node  *const left      = get_Builtin_param(node, 0);
+	ir_node  *const right     = get_Builtin_param(node, 1);
+	ir_mode  *const mode      = get_irn_mode(left);
+
+	amd64_binop_addr_attr_t const attr = {
+		.base = {
+			.base = {
+				.op_mode = AMD64_OP_REG_REG,
+				.size    = x86_size_from_mode(mode),
+			},
+			.addr = {
+				.base_input = 0,
+				.variant    = X86_ADDR_REG,
+			},
+		},
+		.u = {
+			.reg_input = 1,
+		},
+	};
+	ir_node *const in[] = {
+		be_transform_node(left),
+		be_transform_node(right),
+	};
+	ir_node *const res = cons(dbgi, new_block, ARRAY_SIZE(in), in,
+	                          amd64_reg_reg_reqs, &attr);
+	arch_set_irn_register_req_out(res, 0, &amd64_requirement_gp_same_0);
+	return res;
+}
+
+static ir_node *gen_overflow_op(ir_node *const node)
+{
+	ir_node *const param0 = get_Builtin_param(node, 0);
+	ir_mode *const mode   = get_irn_mode(param0);
+	switch (get_Builtin_kind(node)) {
+	case ir_bk_add_overflow:
+		return gen_overflow_binop(node, new_bd_amd64_add);
+	case ir_bk_sub_overflow:
+		return gen_overflow_binop(node, new_bd_amd64_sub);
+	case ir_bk_mul_overflow:
+		if (mode_is_signed(mode))
+			return gen_overflow_binop(node, new_bd_amd64_imul);
+		return gen_binop_rax(node, param0, get_Builtin_param(node, 1),
+		                     new_bd_amd64_mul, match_commutative);
+	default:
+		panic("unexpected builtin %+F", node);
+	}
+}
+
+/** Materializes the overflow predicate from the flags the operation
+ * computed anyway. */
+static ir_node *gen_overflow_flags(ir_node *const node,
+                                   ir_node *const new_node)
+{
+	dbg_info *const dbgi  = get_irn_dbg_info(new_node);
+	ir_node  *const block = get_nodes_block(new_node);
+	ir_mode  *const mode  = get_irn_mode(get_Builtin_param(node, 0));
+	bool      const mul   = get_Builtin_kind(node) == ir_bk_mul_overflow;
+
+	ir_node             *flags;
+	x86_condition_code_t cc;
+	if (mul && !mode_is_signed(mode)) {
+		/* mul does set OF/CF, but it is not rematerializable (two results
+		 * in fixed registers), so beflags cannot repair its flags when they
+		 * get clobbered.  The high half of the product is non-zero exactly
+		 * when CF would be set and a cmp against zero can be repeated
+		 * freely. */
+		ir_node *const res_high = be_new_Proj(new_node, pn_amd64_mul_res_high);
+		amd64_binop_addr_attr_t const cmp_attr = {
+			.base = {
+				.base = {
+					.op_mode = AMD64_OP_REG_IMM,
+					.size    = x86_size_from_mode(mode),
+				},
+				.addr = {
+					.base_input = 0,
+					.variant    = X86_ADDR_REG,
+				},
+			},
+			.u.immediate = {
+				.kind = X86_IMM_VALUE,
+			},
+		};
+		ir_node *const cmp_in[] = { res_high };
+		ir_node *const cmp = new_bd_amd64_cmp(dbgi, block, ARRAY_SIZE(cmp_in),
+		                                      cmp_in, reg_reqs, &cmp_attr);
+		flags = be_new_Proj(cmp, pn_amd64_cmp_flags);
+		cc    = x86_cc_not_equal;
+	} else {
+		/* the flags are output 1 of add, sub and imul alike */
+		flags = be_new_Proj(new_node, pn_amd64_add_flags);
+		cc    = mul || mode_is_signed(mode) ? x86_cc_overflow : x86_cc_carry;
+	}
+	ir_node *const setcc = new_bd_amd64_setcc(dbgi, block, flags, cc);
+
+	/* movzbl: consumers expect a plain 0/1 value */
+	ir_node *const movzbl_in[] = { setcc };
+	x86_addr_t const movzbl_addr = {
+		.base_input = 0,
+		.variant    = X86_ADDR_REG,
+	};
+	ir_node *const movzbl
+		= new_bd_amd64_mov_gp(dbgi, block, ARRAY_SIZE(movzbl_in), movzbl_in,
+		                      reg_reqs, X86_SIZE_8, AMD64_OP_REG, movzbl_addr);
+	return be_new_Proj(movzbl, pn_amd64_mov_gp_res);
+}
+
 static ir_node *gen_va_start(ir_node *const node)
 {
 	ir_graph *const irg   = get_irn_irg(node);
@@ -3144,10 +3386,20 @@ static ir_node *gen_Builtin(ir_node *const node)
 		return gen_ctz(node);
 	case ir_bk_ffs:
 		return gen_ffs(node);
+	case ir_bk_prefetch:
+		return gen_prefetch(node);
 	case ir_bk_compare_swap:
 		return gen_compare_swap(node);
+	case ir_bk_atomic_exchange:
+		return gen_atomic_rmw(node, new_bd_amd64_xchg);
+	case ir_bk_atomic_fetch_add:
+		return gen_atomic_rmw(node, new_bd_amd64_xadd);
 	case ir_bk_saturating_increment:
 		return gen_saturating_increment(node);
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+		return gen_overflow_op(node);
 	case ir_bk_va_start:
 		return gen_va_start(node);
 	default:
@@ -3168,6 +3420,9 @@ static ir_node *gen_Proj_Builtin(ir_node *const proj)
 	case ir_bk_ffs:
 	case ir_bk_parity:
 		return new_node;
+	case ir_bk_prefetch:
+		assert(get_Proj_num(proj) == pn_Builtin_M);
+		return new_node;
 	case ir_bk_compare_swap:
 		assert(is_amd64_cmpxchg(new_node));
 		if (get_Proj_num(proj) == pn_Builtin_M) {
@@ -3176,8 +3431,37 @@ static ir_node *gen_Proj_Builtin(ir_node *const proj)
 			assert(get_Proj_num(proj) == pn_Builtin_max+1);
 			return be_new_Proj(new_node, pn_amd64_cmpxchg_res);
 		}
+	case ir_bk_atomic_exchange:
+		assert(is_amd64_xchg(new_node));
+		if (get_Proj_num(proj) == pn_Builtin_M) {
+			return be_new_Proj(new_node, pn_amd64_xchg_M);
+		} else {
+			assert(get_Proj_num(proj) == pn_Builtin_max+1);
+			return be_new_Proj(new_node, pn_amd64_xchg_res);
+		}
+	case ir_bk_atomic_fetch_add:
+		assert(is_amd64_xadd(new_node));
+		if (get_Proj_num(proj) == pn_Builtin_M) {
+			return be_new_Proj(new_node, pn_amd64_xadd_M);
+		} else {
+			assert(get_Proj_num(proj) == pn_Builtin_max+1);
+			return be_new_Proj(new_node, pn_amd64_xadd_res);
+		}
 	case ir_bk_saturating_increment:
 		return be_new_Proj(new_node, pn_amd64_sbb_res);
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow: {
+		unsigned const num = get_Proj_num(proj);
+		if (num == pn_Builtin_M)
+			return be_transform_node(get_Builtin_mem(node));
+		if (num == pn_Builtin_max + 1) {
+			/* the value is output 0 of add, sub, imul and mul alike */
+			return be_new_Proj(new_node, pn_amd64_add_res);
+		}
+		assert(num == pn_Builtin_max + 2);
+		return gen_overflow_flags(node, new_node);
+	}
 	case ir_bk_va_start:
 		assert(get_Proj_num(proj) == pn_Builtin_M);
 		return new_node;
@@ -365,7 +365,7 @@ static ir_node *load_aggregate_va(dbg_info *dbgi, ir_node *block, ir_type *resty
 	ir_node *true_mem        = xmm_check_mem;
 
 	ir_type   *frame    = get_irg_frame_type(irg);
-	ident     *id       = id_unique("$vararg_param");
+	ident     *id       = irg_unique_ident(irg, "$vararg_param");
 	ir_entity *entity   = new_entity(frame, id, restype);
 	ir_node   *ent_addr = new_rd_Member(dbgi, true_block, get_irg_frame(irg), entity);
 
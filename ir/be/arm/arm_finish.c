@@ -148,4 +148,6 @@ void arm_finish_graph(ir_graph *irg)
 	arm_peephole_optimization(irg);
 
 	be_handle_2addr(irg, NULL);
+
+	arm_merge_dual_transfers(irg);
 }
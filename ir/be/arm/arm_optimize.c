@@ -21,6 +21,7 @@
 #include "ircons.h"
 #include "iredges_t.h"
 #include "irgmod.h"
+#include "irgwalk.h"
 
 static uint32_t arm_ror(uint32_t v, uint32_t ror)
 {
@@ -202,3 +203,192 @@ bool arm_is_valid_offset(int32_t const v, ir_mode *const mode, bool const is_sto
 		}
 	}
 }
+
+/**
+ * Returns true if @p node is a word access that a dual transfer can cover:
+ * ldrd/strd transfer full words and only have the 8 bit sign+magnitude
+ * offset range.
+ */
+static bool is_mergeable_word_access(ir_node const *const node)
+{
+	arm_load_store_attr_t const *const attr = get_arm_load_store_attr_const(node);
+	return get_mode_size_bits(attr->load_store_mode) == 32
+	    && arm_is_offset8(attr->offset);
+}
+
+/**
+ * Returns true if the registers @p lo and @p hi form the even/odd
+ * consecutive pair required by ldrd/strd.
+ */
+static bool is_dual_transfer_pair(arch_register_t const *const lo,
+                                  arch_register_t const *const hi)
+{
+	return lo->index % 2 == 0 && hi->index == lo->index + 1;
+}
+
+/**
+ * Try to merge the Str @p node with the directly following Str into a Strd.
+ * Returns the merged node or NULL.
+ */
+static ir_node *try_merge_strd(ir_node *const node)
+{
+	ir_node *const next = sched_next(node);
+	if (sched_is_end(next) || !is_arm_Str(next))
+		return NULL;
+	/* the stores must access adjacent words relative to the same base and
+	 * be directly chained, so no other memory access lies in between */
+	if (get_irn_n(next, n_arm_Str_mem) != node || !be_has_only_one_user(node))
+		return NULL;
+	if (get_irn_n(node, n_arm_Str_ptr) != get_irn_n(next, n_arm_Str_ptr))
+		return NULL;
+	if (!is_mergeable_word_access(node) || !is_mergeable_word_access(next))
+		return NULL;
+
+	arm_load_store_attr_t const *const attr_a = get_arm_load_store_attr_const(node);
+	arm_load_store_attr_t const *const attr_b = get_arm_load_store_attr_const(next);
+	ir_node *lo;
+	ir_node *hi;
+	if (attr_a->offset + 4 == attr_b->offset) {
+		lo = node;
+		hi = next;
+	} else if (attr_b->offset + 4 == attr_a->offset) {
+		lo = next;
+		hi = node;
+	} else {
+		return NULL;
+	}
+	int32_t const offset = get_arm_load_store_attr_const(lo)->offset;
+	if (!arm_is_offset8(offset + 4))
+		return NULL;
+
+	ir_node               *const val_lo = get_irn_n(lo, n_arm_Str_val);
+	ir_node               *const val_hi = get_irn_n(hi, n_arm_Str_val);
+	arch_register_t const *const reg_lo = arch_get_irn_register(val_lo);
+	arch_register_t const *const reg_hi = arch_get_irn_register(val_hi);
+	if (!is_dual_transfer_pair(reg_lo, reg_hi))
+		return NULL;
+
+	dbg_info *const dbgi  = get_irn_dbg_info(node);
+	ir_node  *const block = get_nodes_block(node);
+	ir_node  *const ptr   = get_irn_n(node, n_arm_Str_ptr);
+	ir_node  *const mem   = get_irn_n(node, n_arm_Str_mem);
+	ir_node  *const strd  = new_bd_arm_Strd(dbgi, block, ptr, val_lo, val_hi,
+	                                        mem, attr_a->load_store_mode, NULL,
+	                                        0, offset, false);
+	sched_add_before(node, strd);
+	sched_remove(node);
+	sched_remove(next);
+	exchange(next, strd);
+	return strd;
+}
+
+/**
+ * Try to merge the Ldr @p node with the directly following Ldr into a Ldrd.
+ * Returns the merged node or NULL.
+ */
+static ir_node *try_merge_ldrd(ir_node *const node)
+{
+	ir_node *const next = sched_next(node);
+	if (sched_is_end(next) || !is_arm_Ldr(next))
+		return NULL;
+	if (get_irn_n(node, n_arm_Ldr_ptr) != get_irn_n(next, n_arm_Ldr_ptr))
+		return NULL;
+	if (!is_mergeable_word_access(node) || !is_mergeable_word_access(next))
+		return NULL;
+	/* the loads must see the same memory state */
+	ir_node *const mem_a = get_irn_n(node, n_arm_Ldr_mem);
+	ir_node *const mem_b = get_irn_n(next, n_arm_Ldr_mem);
+	if (mem_a != mem_b && !(is_Proj(mem_b) && get_Proj_pred(mem_b) == node))
+		return NULL;
+
+	ir_node *res_a = NULL;
+	ir_node *m_a   = NULL;
+	foreach_out_edge(node, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (get_Proj_num(proj) == pn_arm_Ldr_res) {
+			res_a = proj;
+		} else {
+			m_a = proj;
+		}
+	}
+	ir_node *res_b = NULL;
+	ir_node *m_b   = NULL;
+	foreach_out_edge(next, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (get_Proj_num(proj) == pn_arm_Ldr_res) {
+			res_b = proj;
+		} else {
+			m_b = proj;
+		}
+	}
+	if (res_a == NULL || res_b == NULL)
+		return NULL;
+
+	arm_load_store_attr_t const *const attr_a = get_arm_load_store_attr_const(node);
+	arm_load_store_attr_t const *const attr_b = get_arm_load_store_attr_const(next);
+	ir_node *res_lo;
+	ir_node *res_hi;
+	int32_t  offset;
+	if (attr_a->offset + 4 == attr_b->offset) {
+		res_lo = res_a;
+		res_hi = res_b;
+		offset = attr_a->offset;
+	} else if (attr_b->offset + 4 == attr_a->offset) {
+		res_lo = res_b;
+		res_hi = res_a;
+		offset = attr_b->offset;
+	} else {
+		return NULL;
+	}
+	if (!arm_is_offset8(offset + 4))
+		return NULL;
+
+	arch_register_t const *const reg_lo = arch_get_irn_register(res_lo);
+	arch_register_t const *const reg_hi = arch_get_irn_register(res_hi);
+	if (!is_dual_transfer_pair(reg_lo, reg_hi))
+		return NULL;
+
+	dbg_info *const dbgi  = get_irn_dbg_info(node);
+	ir_node  *const block = get_nodes_block(node);
+	ir_node  *const ptr   = get_irn_n(node, n_arm_Ldr_ptr);
+	ir_node  *const ldrd  = new_bd_arm_Ldrd(dbgi, block, ptr, mem_a,
+	                                        attr_a->load_store_mode, NULL, 0,
+	                                        offset, false);
+	sched_add_before(node, ldrd);
+
+	ir_node *const new_lo = be_new_Proj_reg(ldrd, pn_arm_Ldrd_res,  reg_lo);
+	ir_node *const new_hi = be_new_Proj_reg(ldrd, pn_arm_Ldrd_res2, reg_hi);
+	ir_node *const new_m  = be_new_Proj(ldrd, pn_arm_Ldrd_M);
+
+	sched_remove(node);
+	sched_remove(next);
+	exchange(res_lo, new_lo);
+	exchange(res_hi, new_hi);
+	if (m_a != NULL)
+		exchange(m_a, new_m);
+	if (m_b != NULL)
+		exchange(m_b, new_m);
+	return ldrd;
+}
+
+/**
+ * Block walker: merge adjacent word loads/stores into dual transfers.
+ */
+static void merge_dual_transfers_block(ir_node *const block, void *const env)
+{
+	(void)env;
+	for (ir_node *node = sched_first(block); !sched_is_end(node);) {
+		ir_node *merged = NULL;
+		if (is_arm_Str(node)) {
+			merged = try_merge_strd(node);
+		} else if (is_arm_Ldr(node)) {
+			merged = try_merge_ldrd(node);
+		}
+		node = sched_next(merged != NULL ? merged : node);
+	}
+}
+
+void arm_merge_dual_transfers(ir_graph *irg)
+{
+	irg_block_walk_graph(irg, NULL, merge_dual_transfers_block, NULL);
+}
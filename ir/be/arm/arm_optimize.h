@@ -22,6 +22,17 @@
  */
 void arm_peephole_optimization(ir_graph *irg);
 
+/**
+ * Merges adjacent word loads/stores with the same base register and
+ * consecutive offsets into ldrd/strd dual transfers. Must run after register
+ * allocation and stack offset fixup, because the merged access has to
+ * satisfy the even/odd register pair constraint and the smaller offset
+ * range of the dual transfers.
+ *
+ * @param irg   the graph
+ */
+void arm_merge_dual_transfers(ir_graph *irg);
+
 typedef struct arm_vals {
 	unsigned ops;
 	uint8_t values[4];
@@ -463,6 +463,19 @@ Ldr => {
 	attr      => "ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity",
 },
 
+# Dual word transfer (ARMv5TE). Only created by the post-regalloc load/store
+# merging pass, which guarantees the even/odd register pair constraint.
+Ldrd => {
+	state     => "exc_pinned",
+	ins       => [ "ptr", "mem" ],
+	outs      => [ "res", "res2", "M" ],
+	in_reqs   => [ "gp", "mem" ],
+	out_reqs  => [ "gp", "gp", "mem" ],
+	emit      => 'ldrd %D0, %D1, %A',
+	attr_type => "arm_load_store_attr_t",
+	attr      => "ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity",
+},
+
 Str => {
 	state     => "exc_pinned",
 	ins       => [ "ptr", "val", "mem" ],
@@ -474,6 +487,18 @@ Str => {
 	attr      => "ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity",
 },
 
+# Dual word transfer (ARMv5TE), see Ldrd.
+Strd => {
+	state     => "exc_pinned",
+	ins       => [ "ptr", "val", "val2", "mem" ],
+	outs      => [ "M" ],
+	in_reqs   => [ "gp", "gp", "gp", "mem" ],
+	out_reqs  => [ "mem" ],
+	emit      => 'strd %S1, %S2, %A',
+	attr_type => "arm_load_store_attr_t",
+	attr      => "ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity",
+},
+
 
 Adf => { template => $binopf },
 
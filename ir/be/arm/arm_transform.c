@@ -1406,6 +1406,11 @@ static ir_node *gen_Builtin(ir_node *node)
 	case ir_bk_may_alias:
 	case ir_bk_va_start:
 	case ir_bk_va_arg:
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 		break;
 	}
 	panic("Builtin %s not implemented", get_builtin_kind_name(kind));
@@ -1443,6 +1448,11 @@ static ir_node *gen_Proj_Builtin(ir_node *proj)
 	case ir_bk_may_alias:
 	case ir_bk_va_start:
 	case ir_bk_va_arg:
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 		break;
 	}
 	panic("Builtin %s not implemented", get_builtin_kind_name(kind));
@@ -13,11 +13,14 @@
 #include "bearch.h"
 #include "bemodule.h"
 #include "benode.h"
+#include "bepeephole.h"
 #include "besched.h"
 #include "debug.h"
+#include "heights.h"
 #include "iredges.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "util.h"
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
@@ -47,6 +50,72 @@ static ir_node *get_result_node(ir_node *const node, unsigned const pos)
 		/*                          */ NULL;
 }
 
+/**
+ * Keep a heights object registered via be_peephole_set_heights() valid
+ * when a copy was inserted into the block of @p node.
+ */
+static void invalidate_heights(ir_node *const node)
+{
+	ir_heights_t *const heights = be_peephole_get_heights();
+	if (heights != NULL)
+		heights_invalidate_block(heights, get_nodes_block(node));
+}
+
+/**
+ * Resolve a should_be_same constraint by swapping the register of the tied
+ * input with the register of the operand occupying the output register,
+ * using a Perm in front of the instruction. This is only possible if the
+ * tied input value dies at the instruction (its register is overwritten by
+ * the result) and all operands sitting in the output register accept the
+ * exchanged register.
+ */
+static bool try_swap_registers(ir_node *const node, unsigned const out_pos, unsigned const same_as)
+{
+	ir_node               *const in_node = get_irn_n(node, same_as);
+	arch_register_t const *const out_reg = arch_get_irn_register_out(node, out_pos);
+	arch_register_t const *const in_reg  = arch_get_irn_register(in_node);
+	if (arch_get_irn_register_req_out(node, out_pos)->width != 1)
+		return false;
+
+	/* The tied input value must die at the instruction: after the swap it
+	 * only lives in the output register, which the instruction overwrites. */
+	foreach_out_edge(in_node, edge) {
+		if (get_edge_src_irn(edge) != node)
+			return false;
+	}
+
+	ir_node *other = NULL;
+	foreach_irn_in(node, k, in) {
+		if (arch_get_irn_register(in) != out_reg)
+			continue;
+		if (other != NULL && other != in)
+			return false;
+		arch_register_req_t const *const in_req = arch_get_irn_register_req_in(node, k);
+		if (in_req->width != 1)
+			return false;
+		if (in_req->limited != NULL && !rbitset_is_set(in_req->limited, in_reg->index))
+			return false;
+		other = in;
+	}
+	if (other == NULL)
+		return false;
+
+	ir_node *const block  = get_nodes_block(node);
+	ir_node *const ins[]  = { in_node, other };
+	ir_node *const perm   = be_new_Perm(block, ARRAY_SIZE(ins), ins);
+	sched_add_before(node, perm);
+	ir_node *const proj0  = be_new_Proj_reg(perm, 0, out_reg);
+	ir_node *const proj1  = be_new_Proj_reg(perm, 1, in_reg);
+	foreach_irn_in(node, k, in) {
+		if (in == in_node)
+			set_irn_n(node, k, proj0);
+		else if (in == other)
+			set_irn_n(node, k, proj1);
+	}
+	invalidate_heights(node);
+	return true;
+}
+
 static void be_handle_2addr_node(ir_node *const node, be_handle_2addr_callback_t *const callback)
 {
 	be_foreach_out(node, i) {
@@ -58,18 +127,28 @@ static void be_handle_2addr_node(ir_node *const node, be_handle_2addr_callback_t
 		ir_node               *const in_node = get_irn_n(node, same_as);
 		arch_register_t const *const out_reg = arch_get_irn_register_out(node, i);
 		arch_register_t const *const in_reg  = arch_get_irn_register(in_node);
+		bool                   const in_killed
+			= arch_get_irn_register_req_in(node, same_as)->kills_value
+			&& !is_irn_writing_reg(node, in_reg);
 		if (in_reg == out_reg) {
 			continue; /* Requirement already fulfilled. */
 		} else if (!be_is_Asm(node) && callback(node, req, out_reg)) {
 			DBG((dbg, LEVEL_1, "backend callback handled should_be_same constraint at input %u of %+F\n", same_as, node));
 			continue;
+		} else if (in_killed && get_result_node(node, i) == NULL) {
+			/* The result is unused and the input register is killed anyway, so
+			 * renaming the output to the input register fulfills the constraint
+			 * without any copy at all. */
+			arch_set_irn_register_out(node, i, in_reg);
+			DBG((dbg, LEVEL_1, "renamed unused output %u of %+F for should_be_same constraint\n", i, node));
 		} else if (!is_irn_reading_reg(node, out_reg)) {
 			/* No-one else is reading the out reg, we can simply copy it.  The register
 			 * cannot be live since the operation will override it anyway. */
 			ir_node *const copy = be_new_Copy_before_reg(in_node, node, out_reg);
 			set_irn_n(node, same_as, copy);
+			invalidate_heights(node);
 			DBG((dbg, LEVEL_1, "created %+F for should_be_same constraint at input %u of %+F\n", copy, same_as, node));
-		} else if (arch_get_irn_register_req_in(node, same_as)->kills_value && !is_irn_writing_reg(node, in_reg)) {
+		} else if (in_killed) {
 			/* The output register is read by some other input, so a Copy to the right
 			 * output register before the instruction is not possible.  But the input
 			 * register is killed and no output is writing to the input register.
@@ -85,8 +164,11 @@ static void be_handle_2addr_node(ir_node *const node, be_handle_2addr_callback_t
 				arch_set_irn_register_out(copy, 0, out_reg);
 				sched_add_after(node, copy);
 				edges_reroute_except(node, copy, copy);
+				invalidate_heights(node);
 				DBG((dbg, LEVEL_1, "created %+F for should_be_same constraint at output %u of %+F\n", copy, i, node));
 			}
+		} else if (try_swap_registers(node, i, same_as)) {
+			DBG((dbg, LEVEL_1, "swapped registers %s and %s for should_be_same constraint at input %u of %+F\n", in_reg->name, out_reg->name, same_as, node));
 		} else {
 			/* TODO There can be more complex cases which could be resolved by
 			 * parallel copies before or after the instruction. */
@@ -41,6 +41,10 @@ struct be_options_t {
 	bool do_verify;            /**< backend verify option */
 	char ilp_solver[128];      /**< the ilp solver name */
 	bool verbose_asm;          /**< dump verbose assembler */
+	int  n_threads;            /**< worker threads for per-graph codegen */
+	char dump_filter[128];     /**< only dump functions containing this substring */
+	int  dump_every;           /**< only dump every Nth function */
+	int  dump_min_nodes;       /**< only dump functions with at least this many nodes */
 };
 extern be_options_t be_options;
 
@@ -65,6 +69,21 @@ unsigned be_get_n_allocatable_regs(const ir_graph *irg,
 
 void be_after_irp_transform(const char *name);
 
+/**
+ * Returns true when the backend driver should farm per-graph codegen out
+ * to worker threads.  False when threading is unavailable or the timer /
+ * statistics machinery is active, which expects one graph in flight.
+ */
+bool be_parallel_codegen(void);
+
+/**
+ * Runs @p codegen on every graph of the program, distributing the graphs
+ * over be_options.n_threads worker threads when be_parallel_codegen()
+ * holds, serially otherwise.  @p codegen must not emit any code; emission
+ * has to happen afterwards in program order.
+ */
+void be_codegen_irgs(void (*codegen)(ir_graph *irg));
+
 void be_check_verify_result(bool fine, ir_graph *irg);
 
 /**
@@ -120,6 +139,13 @@ static inline void be_timer_pop(be_timer_id_t id)
 	ir_timer_pop(be_timers[id]);
 }
 
+/**
+ * Returns true if @p irg passes the dump sampling/filter options
+ * (be.dumpfilter, be.dumpevery, be.dumpminnodes), so dumping can stay
+ * enabled in triage builds without dumping every function.
+ */
+bool be_dump_selected(ir_graph const *irg);
+
 /**
  * A wrapper around a firm dumper. Dumps only, if flags are enabled.
  *
@@ -130,7 +156,7 @@ static inline void be_timer_pop(be_timer_id_t id)
 static inline void be_dump(be_dump_flags_t const mask, ir_graph *const irg,
                            char const *const suffix)
 {
-	if (be_options.dump_flags & mask)
+	if (be_options.dump_flags & mask && be_dump_selected(irg))
 		dump_ir_graph(irg, suffix);
 }
 
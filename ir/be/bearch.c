@@ -21,6 +21,7 @@
 #include "raw_bitset.h"
 #include "target_t.h"
 #include "util.h"
+#include "xmalloc.h"
 
 arch_register_class_t arch_exec_cls = {
 	.name      = "exec",
@@ -179,6 +180,39 @@ arch_register_req_t const *be_create_reg_req(ir_graph *const irg, arch_register_
 	return req;
 }
 
+/** Timing information indexed by opcode; entries left zero report the
+ * single-cycle default. */
+static arch_op_timing_t *op_timings;
+static size_t            n_op_timings;
+
+void arch_set_op_timing(ir_op *const op, arch_op_timing_t const timing)
+{
+	unsigned const code = get_op_code(op);
+	if (code >= n_op_timings) {
+		size_t const new_len = code + 1;
+		op_timings = XREALLOC(op_timings, arch_op_timing_t, new_len);
+		memset(&op_timings[n_op_timings], 0,
+		       (new_len - n_op_timings) * sizeof(op_timings[0]));
+		n_op_timings = new_len;
+	}
+	op_timings[code] = timing;
+}
+
+arch_op_timing_t arch_get_op_timing(ir_op const *const op)
+{
+	arch_op_timing_t timing = { 0, 0, 0 };
+	unsigned const   code   = get_op_code(op);
+	if (code < n_op_timings)
+		timing = op_timings[code];
+	if (timing.latency == 0)
+		timing.latency = 1;
+	if (timing.throughput == 0)
+		timing.throughput = 1;
+	if (timing.uops == 0)
+		timing.uops = 1;
+	return timing;
+}
+
 int be_get_input_pos_for_req(ir_node const *const irn, arch_register_req_t const *const req)
 {
 	for (int i = 0, n = get_irn_arity(irn); i != n; ++i) {
@@ -194,3 +228,11 @@ void be_init_arch(void)
 	arch_exec_cls.mode   = mode_X;
 	arch_memory_cls.mode = mode_M;
 }
+
+BE_REGISTER_MODULE_DESTRUCTOR(be_quit_arch)
+void be_quit_arch(void)
+{
+	free(op_timings);
+	op_timings   = NULL;
+	n_op_timings = 0;
+}
@@ -339,6 +339,29 @@ static inline bool arch_irn_consider_in_reg_alloc(
 
 arch_register_t const *arch_find_register(char const *name);
 
+/**
+ * Static timing information for a machine operation on a generic model of
+ * the target processor, as specified in the backend spec files.
+ */
+typedef struct arch_op_timing_t {
+	uint8_t latency;    /**< cycles until the result is available */
+	uint8_t throughput; /**< inverse throughput: minimum cycles between
+	                         two independent issues of the operation */
+	uint8_t uops;       /**< number of decoded micro-operations */
+} arch_op_timing_t;
+
+/**
+ * Record timing information for @p op. Called from the generated opcode
+ * creation code for operations annotated in the spec file.
+ */
+void arch_set_op_timing(ir_op *op, arch_op_timing_t timing);
+
+/**
+ * Return the timing information for @p op. Operations without annotation
+ * report single-cycle latency and throughput and one micro-operation.
+ */
+arch_op_timing_t arch_get_op_timing(ir_op const *op);
+
 #define be_foreach_value(node, value, code) \
 	do { \
 		if (get_irn_mode(node) == mode_T) { \
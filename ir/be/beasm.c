@@ -400,7 +400,7 @@ ir_node *be_emit_asm(ir_node const *const asmn, be_emit_asm_operand_func *const
 			 * compilation.  This is useful for making local labels that are
 			 * referred to more than once in a given insn. */
 			++s; /* Skip '='. */
-			be_emit_irprintf("%ld", get_irn_node_nr(asmn));
+			be_emit_long(get_irn_node_nr(asmn));
 			break;
 
 		default: {
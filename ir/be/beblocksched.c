@@ -31,6 +31,7 @@
 #include "irgmod.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "irprofile.h"
 #include "pdeq.h"
 #include "util.h"
 
@@ -38,6 +39,17 @@ DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
 static bool blocks_removed;
 
+/**
+ * Returns true for blocks that were never executed in the profiling run.
+ * Without profile data all blocks count as hot, so the hot/cold splitting
+ * below is a no-op then.
+ */
+static bool is_cold_block(const ir_node *block)
+{
+	return ir_profile_has_data()
+	    && ir_profile_get_block_execcount(block) == 0;
+}
+
 /**
  * Post-block-walker: Find blocks containing only one jump and
  * remove them.
@@ -163,6 +175,8 @@ struct blocksched_env_t {
 	struct obstack  obst;
 	edge_t         *edges;
 	deq_t           worklist;
+	deq_t           worklist_cold; /**< drained after worklist, so cold
+	                                    blocks end up at the function tail */
 	unsigned        blockcount;
 };
 
@@ -219,6 +233,8 @@ static void collect_egde_frequency(ir_node *block, void *data)
 		int    highest_edge_num = -1;
 
 		edge.block = block;
+		/* batch the growth instead of reallocating per edge */
+		ARR_RESERVE(edge_t, env->edges, ARR_LEN(env->edges) + arity);
 		for (int i = 0; i < arity; ++i) {
 			ir_node *const pred_block = get_Block_cfgpred_block(block, i);
 			double   const execfreq   = get_block_execfreq(pred_block);
@@ -325,6 +341,11 @@ static void coalesce_blocks(blocksched_env_t *env)
 		if (pred_entry->next != NULL || entry->prev != NULL)
 			continue;
 
+		/* never chain hot and cold blocks together, cold ones are laid
+		 * out at the function tail */
+		if (is_cold_block(block) != is_cold_block(pred_block))
+			continue;
+
 		/* only coalesce jumps */
 		if (get_block_succ_next(pred_block, get_block_succ_first(pred_block)) != NULL)
 			continue;
@@ -359,6 +380,9 @@ static void coalesce_blocks(blocksched_env_t *env)
 		if (pred_entry->next != NULL || entry->prev != NULL)
 			continue;
 
+		if (is_cold_block(block) != is_cold_block(pred_block))
+			continue;
+
 		/* we want at most 1 outedge fallthrough per loop */
 		ir_loop *loop = get_irn_loop(pred_block);
 		if (get_loop_link(loop) != NULL)
@@ -400,6 +424,9 @@ static void coalesce_blocks(blocksched_env_t *env)
 		if (pred_entry->next != NULL || entry->prev != NULL)
 			continue;
 
+		if (is_cold_block(block) != is_cold_block(pred_block))
+			continue;
+
 		/* schedule the two blocks behind each other */
 		DB((dbg, LEVEL_1, "Coalesce (CondJump) %+F -> %+F (%.3g)\n",
 		           pred_entry->block, entry->block, edge->execfreq));
@@ -442,7 +469,10 @@ static void pick_block_successor(blocksched_entry_t *entry, blocksched_env_t *en
 			continue;
 
 		DB((dbg, LEVEL_1, "Put %+F into worklist\n", succ_entry->block));
-		deq_push_pointer_right(&env->worklist, succ_entry->block);
+		if (is_cold_block(succ_entry->block))
+			deq_push_pointer_right(&env->worklist_cold, succ_entry->block);
+		else
+			deq_push_pointer_right(&env->worklist, succ_entry->block);
 	}
 
 	if (entry->next != NULL) {
@@ -466,6 +496,11 @@ static void pick_block_successor(blocksched_entry_t *entry, blocksched_env_t *en
 		if (succ_entry->prev != NULL)
 			continue;
 
+		/* hot blocks never fall through into cold ones, those are
+		 * appended once the worklists run dry */
+		if (is_cold_block(succ_block) && !is_cold_block(block))
+			continue;
+
 		double execfreq = get_block_execfreq(succ_block);
 		if (best_succ_execfreq < execfreq) {
 			best_succ_execfreq = execfreq;
@@ -477,11 +512,14 @@ static void pick_block_successor(blocksched_entry_t *entry, blocksched_env_t *en
 		DB((dbg, LEVEL_1, "pick from worklist\n"));
 
 		do {
-			if (deq_empty(&env->worklist)) {
+			if (!deq_empty(&env->worklist)) {
+				succ = deq_pop_pointer_left(ir_node, &env->worklist);
+			} else if (!deq_empty(&env->worklist_cold)) {
+				succ = deq_pop_pointer_left(ir_node, &env->worklist_cold);
+			} else {
 				DB((dbg, LEVEL_1, "worklist empty\n"));
 				return;
 			}
-			succ = deq_pop_pointer_left(ir_node, &env->worklist);
 		} while (irn_visited(succ));
 	}
 
@@ -502,10 +540,13 @@ static blocksched_entry_t *finish_block_schedule(blocksched_env_t *env)
 	mark_irn_visited(get_irg_end_block(irg));
 
 	deq_init(&env->worklist);
+	deq_init(&env->worklist_cold);
 	ir_node            *const startblock = get_irg_start_block(irg);
 	blocksched_entry_t *const entry      = get_blocksched_entry(startblock);
 	pick_block_successor(entry, env);
 	assert(deq_empty(&env->worklist));
+	assert(deq_empty(&env->worklist_cold));
+	deq_free(&env->worklist_cold);
 	deq_free(&env->worklist);
 
 	ir_free_resources(irg, IR_RESOURCE_IRN_VISITED);
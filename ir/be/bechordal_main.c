@@ -106,7 +106,7 @@ static void be_ra_chordal_coloring(be_chordal_env_t *env)
 
 void be_chordal_dump(unsigned const mask, ir_graph *const irg, arch_register_class_t const *const cls, char const *const suffix)
 {
-	if ((options.dump_flags & mask) == mask) {
+	if ((options.dump_flags & mask) == mask && be_dump_selected(irg)) {
 		if (cls != NULL) {
 			char buf[256];
 			snprintf(buf, sizeof(buf), "%s-%s", cls->name, suffix);
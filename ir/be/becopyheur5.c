@@ -0,0 +1,271 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Conservative copy minimization with bounded work.
+ *
+ * Walks the affinity edges in order of decreasing costs and tries to give
+ * both ends the same color by recoloring a single node, without any
+ * cascaded recoloring. A recoloring attempt costs one budget unit per
+ * inspected interference neighbour and every affinity cluster (connected
+ * component of the affinity graph) only gets a budget proportional to its
+ * size. This trades copy quality for a strict, predictable bound on the
+ * work spent per cluster, which the chunk based heuristic cannot give on
+ * large clusters.
+ */
+#include <stdlib.h>
+
+#include "array.h"
+#include "be_t.h"
+#include "bearch.h"
+#include "becopyopt_t.h"
+#include "beifg.h"
+#include "bemodule.h"
+#include "bitset.h"
+#include "debug.h"
+#include "irnode_t.h"
+#include "irnodemap.h"
+#include "irtools.h"
+#include "lc_opts.h"
+#include "raw_bitset.h"
+#include "statev_t.h"
+#include "util.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
+
+/** Interference checks a cluster may spend, per affinity node in it. */
+static int work_factor = 64;
+
+/** An affinity edge together with the union find index of its source. */
+typedef struct bounded_edge_t {
+	const ir_node *src;
+	const ir_node *tgt;
+	int            costs;
+	unsigned       src_idx;
+	unsigned       tgt_idx;
+} bounded_edge_t;
+
+typedef struct bounded_env_t {
+	be_ifg_t       *ifg;               /**< the interference graph */
+	bitset_t const *allocatable_regs;  /**< colors the class may use */
+	ir_nodemap      node_idx;          /**< maps nodes to union find indices (+1) */
+	unsigned       *parent;            /**< union find parent relation */
+	unsigned       *n_nodes;           /**< cluster sizes, valid for roots */
+	long           *budget;            /**< remaining budgets, valid for roots */
+} bounded_env_t;
+
+/**
+ * Get the union find index of @p irn, allocating a fresh singleton
+ * cluster if the node was not seen before.
+ */
+static unsigned get_node_index(bounded_env_t *env, const ir_node *irn)
+{
+	void *data = ir_nodemap_get(void, &env->node_idx, irn);
+	if (data != NULL)
+		return (unsigned)((uintptr_t)data - 1);
+
+	unsigned const idx = ARR_LEN(env->parent);
+	ARR_APP1(unsigned, env->parent, idx);
+	ARR_APP1(unsigned, env->n_nodes, 1);
+	ir_nodemap_insert(&env->node_idx, irn, (void*)(uintptr_t)(idx + 1));
+	return idx;
+}
+
+static unsigned find_cluster(unsigned *parent, unsigned idx)
+{
+	while (parent[idx] != idx) {
+		parent[idx] = parent[parent[idx]];
+		idx         = parent[idx];
+	}
+	return idx;
+}
+
+static void union_clusters(bounded_env_t *env, unsigned idx1, unsigned idx2)
+{
+	unsigned const root1 = find_cluster(env->parent, idx1);
+	unsigned const root2 = find_cluster(env->parent, idx2);
+	if (root1 == root2)
+		return;
+	env->parent[root1]   = root2;
+	env->n_nodes[root2] += env->n_nodes[root1];
+}
+
+/**
+ * Compare two edges, order by decreasing costs. Ties are broken by the
+ * node indices to keep the order deterministic.
+ */
+static int cmp_edges(const void *a, const void *b)
+{
+	const bounded_edge_t *e1 = (const bounded_edge_t*)a;
+	const bounded_edge_t *e2 = (const bounded_edge_t*)b;
+	if (e1->costs != e2->costs)
+		return QSORT_CMP(e2->costs, e1->costs);
+	if (e1->src_idx != e2->src_idx)
+		return QSORT_CMP(e1->src_idx, e2->src_idx);
+	return QSORT_CMP(e1->tgt_idx, e2->tgt_idx);
+}
+
+/**
+ * Try to give @p irn the color @p col. The recoloring is performed
+ * immediately if @p col is admissible for @p irn and no interference
+ * neighbour uses it; nothing else is recolored. Every inspected
+ * neighbour costs one unit of @p budget, if the budget runs out the
+ * attempt fails.
+ */
+static bool try_recolor(bounded_env_t *env, const ir_node *irn, unsigned col,
+                        long *budget)
+{
+	arch_register_req_t const *const req = arch_get_irn_register_req(irn);
+	if (req->ignore)
+		return false;
+	if (!bitset_is_set(env->allocatable_regs, col))
+		return false;
+	if (req->limited != NULL && !rbitset_is_set(req->limited, col))
+		return false;
+
+	neighbours_iter_t neigh_it;
+	be_ifg_foreach_neighbour(env->ifg, &neigh_it, irn, neigh) {
+		if (--*budget < 0) {
+			be_ifg_neighbours_break(&neigh_it);
+			return false;
+		}
+		if (arch_get_irn_register(neigh)->index == col) {
+			be_ifg_neighbours_break(&neigh_it);
+			return false;
+		}
+	}
+
+	DB((dbg, LEVEL_2, "\trecoloring %+F to %u\n", irn, col));
+	arch_set_irn_register_idx((ir_node*)irn, col);
+	return true;
+}
+
+/**
+ * Try to satisfy the affinity edge @p edge by recoloring one of its ends
+ * to the color of the other one.
+ */
+static bool try_coalesce(bounded_env_t *env, const bounded_edge_t *edge,
+                         long *budget)
+{
+	unsigned const col_src = arch_get_irn_register(edge->src)->index;
+	unsigned const col_tgt = arch_get_irn_register(edge->tgt)->index;
+	if (col_src == col_tgt)
+		return true;
+	return try_recolor(env, edge->tgt, col_src, budget)
+	    || try_recolor(env, edge->src, col_tgt, budget);
+}
+
+static int co_solve_heuristic_bounded(copy_opt_t *co)
+{
+	stat_ev_tim_push();
+
+	bounded_env_t env;
+	env.ifg              = co->cenv->ifg;
+	env.allocatable_regs = co->cenv->allocatable_regs;
+	env.parent           = NEW_ARR_F(unsigned, 0);
+	env.n_nodes          = NEW_ARR_F(unsigned, 0);
+	env.budget           = NULL;
+	ir_nodemap_init(&env.node_idx, co->irg);
+
+	DBG((dbg, LEVEL_1, "==== Coalescing %+F, class %s ====\n", co->irg,
+	     co->cls->name));
+
+	/* collect the affinity edges and build the clusters */
+	bounded_edge_t *edges = NEW_ARR_F(bounded_edge_t, 0);
+	co_gs_foreach_aff_node(co, an) {
+		const ir_node *irn = an->irn;
+		co_gs_foreach_neighb(an, neigh) {
+			/* both directions are recorded, only take one of them */
+			if (get_irn_idx(irn) >= get_irn_idx(neigh->irn))
+				continue;
+
+			bounded_edge_t edge;
+			edge.src     = irn;
+			edge.tgt     = neigh->irn;
+			edge.costs   = neigh->costs;
+			edge.src_idx = get_node_index(&env, irn);
+			edge.tgt_idx = get_node_index(&env, neigh->irn);
+			ARR_APP1(bounded_edge_t, edges, edge);
+			union_clusters(&env, edge.src_idx, edge.tgt_idx);
+		}
+	}
+
+	/* hand out the budgets, one per cluster */
+	size_t             n_clusters  = 0;
+	unsigned long long work_bound  = 0;
+	size_t const       n_aff_nodes = ARR_LEN(env.parent);
+	env.budget = NEW_ARR_F(long, n_aff_nodes);
+	for (size_t i = 0; i < n_aff_nodes; ++i) {
+		if (env.parent[i] != i)
+			continue;
+		env.budget[i] = (long)work_factor * env.n_nodes[i];
+		work_bound   += env.budget[i];
+		++n_clusters;
+	}
+
+	/* work on the edges in order of decreasing costs */
+	QSORT_ARR(edges, cmp_edges);
+
+	unsigned long long n_coalesced = 0;
+	unsigned long long n_starved   = 0;
+	for (size_t i = 0, n = ARR_LEN(edges); i < n; ++i) {
+		const bounded_edge_t *edge = &edges[i];
+		unsigned const root = find_cluster(env.parent, edge->src_idx);
+		if (env.budget[root] <= 0) {
+			++n_starved;
+			continue;
+		}
+		if (try_coalesce(&env, edge, &env.budget[root]))
+			++n_coalesced;
+	}
+
+	unsigned long long work_spent = work_bound;
+	for (size_t i = 0; i < n_aff_nodes; ++i) {
+		if (env.parent[i] == i && env.budget[i] > 0)
+			work_spent -= env.budget[i];
+	}
+
+	stat_ev_ull("heur5_clusters",      n_clusters);
+	stat_ev_ull("heur5_edges",         ARR_LEN(edges));
+	stat_ev_ull("heur5_coalesced",     n_coalesced);
+	stat_ev_ull("heur5_starved_edges", n_starved);
+	stat_ev_ull("heur5_work_spent",    work_spent);
+	stat_ev_ull("heur5_work_bound",    work_bound);
+
+	DEL_ARR_F(edges);
+	DEL_ARR_F(env.budget);
+	DEL_ARR_F(env.n_nodes);
+	DEL_ARR_F(env.parent);
+	ir_nodemap_destroy(&env.node_idx);
+
+	stat_ev_tim_pop("heur5_total");
+
+	return 0;
+}
+
+static const lc_opt_table_entry_t options[] = {
+	LC_OPT_ENT_INT("workfactor", "interference checks per affinity node of a cluster", &work_factor),
+	LC_OPT_LAST
+};
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_copyheur5)
+void be_init_copyheur5(void)
+{
+	lc_opt_entry_t *be_grp      = lc_opt_get_grp(firm_opt_get_root(), "be");
+	lc_opt_entry_t *ra_grp      = lc_opt_get_grp(be_grp, "ra");
+	lc_opt_entry_t *chordal_grp = lc_opt_get_grp(ra_grp, "chordal");
+	lc_opt_entry_t *co_grp      = lc_opt_get_grp(chordal_grp, "co");
+	lc_opt_entry_t *heur5_grp   = lc_opt_get_grp(co_grp, "heur5");
+
+	static co_algo_info copyheur = {
+		co_solve_heuristic_bounded
+	};
+
+	lc_opt_add_table(heur5_grp, options);
+	be_register_copyopt("heur5", &copyheur);
+
+	FIRM_DBG_REGISTER(dbg, "firm.be.co.heur5");
+}
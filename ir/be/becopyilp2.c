@@ -38,6 +38,7 @@
 #include "irprintf.h"
 #include "panic.h"
 #include "pdeq.h"
+#include "pset.h"
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 
@@ -538,7 +538,7 @@ static void co_complete_stats(const copy_opt_t *co, co_complete_stats_t *stat)
 					stat->unsatisfied_edges += 1;
 				}
 
-				if (be_values_interfere(an->irn, neigh->irn)) {
+				if (be_ifg_interfere(co->cenv->ifg, an->irn, neigh->irn)) {
 					stat->aff_int += 1;
 					stat->inevit_costs += neigh->costs;
 				}
@@ -590,7 +590,14 @@ static void add_edge(copy_opt_t *co, ir_node *n1, ir_node *n2, int costs)
 
 static inline void add_edges(copy_opt_t *co, ir_node *n1, ir_node *n2, int costs)
 {
-	if (n1 != n2 && !be_values_interfere(n1, n2)) {
+	if (n1 == n2)
+		return;
+	/* ignore values are not part of the precomputed interference graph,
+	 * fall back to the liveness based check for them */
+	bool const interfere = arch_irn_is_ignore(n2)
+		? be_values_interfere(n1, n2)
+		: be_ifg_interfere(co->cenv->ifg, n1, n2);
+	if (!interfere) {
 		add_edge(co, n1, n2, costs);
 		add_edge(co, n2, n1, costs);
 	}
@@ -0,0 +1,112 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Common subexpression elimination for machine nodes.
+ *
+ * Instruction selection constructs machine nodes without consulting a
+ * value table, so identical address computations and constant loads
+ * proliferate after the transform. This pass runs between selection
+ * and scheduling and merges machine nodes that agree in operation,
+ * mode, attributes and operands within one block. Only unpinned nodes
+ * without memory operands take part, which keeps control flow, loads,
+ * stores and calls out of harm's way. The node hashes come from the
+ * ops, so a target can sharpen them in its node spec via hash_func.
+ */
+#include "becse.h"
+
+#include "array.h"
+#include "debug.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgwalk.h"
+#include "iridentityset.h"
+#include "irnode_t.h"
+#include "irop_t.h"
+#include <stdbool.h>
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+/**
+ * Identity set compare following the pset convention: returns zero if
+ * both nodes compute the same value. In contrast to the middle end
+ * value table no normalization happens here, because swapping the
+ * operands of a commutative machine node would invalidate attributes
+ * that refer to operand positions.
+ */
+static int cse_nodes_cmp(const void *e1, const void *e2)
+{
+	const ir_node *a = (const ir_node*)e1;
+	const ir_node *b = (const ir_node*)e2;
+	if (a == b)
+		return 0;
+	if (get_irn_op(a) != get_irn_op(b)
+	 || get_irn_mode(a) != get_irn_mode(b))
+		return 1;
+	int const arity = get_irn_arity(a);
+	if (arity != get_irn_arity(b))
+		return 1;
+	if (get_nodes_block(a) != get_nodes_block(b))
+		return 1;
+	for (int i = 0; i < arity; ++i) {
+		if (get_irn_n(a, i) != get_irn_n(b, i))
+			return 1;
+	}
+	return !a->op->ops.attrs_equal(a, b);
+}
+
+static bool is_cse_candidate(const ir_node *node)
+{
+	/* pinned nodes cover blocks, control flow and everything with side
+	 * effects; Phis additionally depend on predecessor order */
+	if (get_irn_pinned(node) || is_Phi(node))
+		return false;
+	ir_op *const op = get_irn_op(node);
+	if (op->ops.attrs_equal == attrs_equal_false)
+		return false;
+	foreach_irn_in(node, i, pred) {
+		if (get_irn_mode(pred) == mode_M)
+			return false;
+	}
+	return true;
+}
+
+static void collect_candidate(ir_node *node, void *data)
+{
+	ir_node ***const candidates = (ir_node***)data;
+	if (is_cse_candidate(node))
+		ARR_APP1(ir_node*, *candidates, node);
+}
+
+void be_cse(ir_graph *irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.be.cse");
+
+	/* without edges an exchange would leave Id nodes behind */
+	if (!edges_activated(irg))
+		return;
+
+	/* the post order walk lists operands before their users, so merged
+	 * operands are already rerouted when the users are looked up */
+	ir_node **candidates = NEW_ARR_F(ir_node*, 0);
+	irg_walk_graph(irg, NULL, collect_candidate, &candidates);
+
+	ir_identityset_t values;
+	ir_identityset_init(&values, cse_nodes_cmp, 128);
+	unsigned n_merged = 0;
+	for (size_t i = 0, n = ARR_LEN(candidates); i < n; ++i) {
+		ir_node *const node     = candidates[i];
+		ir_node *const existing = ir_identityset_insert(&values, node);
+		if (existing != node) {
+			DB((dbg, LEVEL_2, "  merging %+F into %+F\n", node, existing));
+			exchange(node, existing);
+			++n_merged;
+		}
+	}
+	ir_identityset_destroy(&values);
+	DEL_ARR_F(candidates);
+	DB((dbg, LEVEL_1, "%+F: %u machine nodes merged\n", irg, n_merged));
+}
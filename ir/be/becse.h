@@ -0,0 +1,22 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Common subexpression elimination for machine nodes.
+ */
+#ifndef FIRM_BE_BECSE_H
+#define FIRM_BE_BECSE_H
+
+#include "firm_types.h"
+
+/**
+ * Merges machine nodes computing the same value within a block.
+ * Intended to run after instruction selection and before scheduling;
+ * only unpinned nodes without memory operands take part.
+ */
+void be_cse(ir_graph *irg);
+
+#endif
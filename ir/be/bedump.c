@@ -121,7 +121,9 @@ void be_dump_liveness_block(be_lv_t *lv, FILE *F, const ir_node *bl)
 	if (info != NULL) {
 		for (unsigned i = 0, n = info->n_members; i < n; ++i) {
 			be_lv_info_node_t *const n = &info->nodes[i];
-			ir_fprintf(F, "%s %+F\n", lv_flags_to_str(n->flags), n->node);
+			fprintf(F, "%s ", lv_flags_to_str(n->flags));
+			ir_fprint_node(F, n->node);
+			fputc('\n', F);
 		}
 	}
 }
@@ -131,7 +133,7 @@ static void dump_bitmask(FILE *const F, char const *const ctx, unsigned mask)
 	fputs(ctx, F);
 	for (unsigned i = 0; mask != 0; ++i, mask >>= 1) {
 		if (mask & 1)
-			ir_fprintf(F, " #%u", i);
+			fprintf(F, " #%u", i);
 	}
 }
 
@@ -84,8 +84,10 @@ typedef struct dwarf_t {
 	pset_new_t        emitted_types;
 	const char       *main_file;    /**< name of the main source file */
 	const char       *curr_file;    /**< name of the current source file */
+	unsigned          curr_filenum; /**< file list number of curr_file */
 	unsigned          label_num;
-	unsigned          last_line;
+	unsigned          last_line;    /**< line of the last .loc directive */
+	unsigned          last_column;  /**< column of the last .loc directive */
 } dwarf_t;
 
 static dwarf_t               env;
@@ -303,6 +305,22 @@ static void emit_pubnames(void)
 	emit_label("pubnames_end");
 }
 
+/**
+ * Emit an unsigned decimal without going through the printf machinery.
+ * Location directives are emitted per instruction, so their formatting
+ * dominates the -g emission time.
+ */
+static void emit_unsigned_raw(unsigned value)
+{
+	char  buf[3 * sizeof(value)];
+	char *p = buf + sizeof(buf);
+	do {
+		*--p = '0' + value % 10;
+		value /= 10;
+	} while (value != 0);
+	be_emit_string_len(p, buf + sizeof(buf) - p);
+}
+
 void be_dwarf_location(dbg_info *dbgi)
 {
 	if (debug_level < LEVEL_LOCATIONS)
@@ -311,8 +329,26 @@ void be_dwarf_location(dbg_info *dbgi)
 	if (!loc.file)
 		return;
 
-	unsigned filenum = insert_file(loc.file);
-	be_emit_irprintf("\t.loc %u %u %u\n", filenum, loc.line, loc.column);
+	/* the file map is keyed by pointer, so a pointer comparison is enough
+	 * to stay on the cached number for the common case of one file */
+	if (loc.file != env.curr_file) {
+		env.curr_file    = loc.file;
+		env.curr_filenum = insert_file(loc.file);
+	} else if (loc.line == env.last_line && loc.column == env.last_column) {
+		/* consecutive instructions from the same source position, the
+		 * line program state does not change */
+		return;
+	}
+	env.last_line   = loc.line;
+	env.last_column = loc.column;
+
+	be_emit_cstring("\t.loc ");
+	emit_unsigned_raw(env.curr_filenum);
+	be_emit_char(' ');
+	emit_unsigned_raw(loc.line);
+	be_emit_char(' ');
+	emit_unsigned_raw(loc.column);
+	be_emit_char('\n');
 	be_emit_write_line();
 }
 
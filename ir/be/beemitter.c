@@ -13,21 +13,93 @@
 
 #include "irprintf.h"
 #include "panic.h"
+#include "xmalloc.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+/** Size of the output batch buffer. Finished lines are collected here
+ * and written out in one go, so we do not pay one libc call (and
+ * potentially one syscall) per assembly line. */
+#define EMIT_BUFFER_SIZE (256 * 1024)
 
 static FILE    *emit_file;
+static char    *emit_buffer;
+static size_t   emit_buffer_pos;
 struct obstack  emit_obst;
 
+/** While a capture is active, finished lines grow this object instead
+ * of going to the output, see be_emit_buffer_begin(). */
+static struct obstack capture_obst;
+static bool           capturing;
+
 void be_emit_init(FILE *file)
 {
-	emit_file = file;
+	emit_file       = file;
+	emit_buffer     = XMALLOCN(char, EMIT_BUFFER_SIZE);
+	emit_buffer_pos = 0;
 	obstack_init(&emit_obst);
+	obstack_init(&capture_obst);
+}
+
+static void flush_emit_buffer(void)
+{
+	if (emit_buffer_pos == 0)
+		return;
+	fwrite(emit_buffer, 1, emit_buffer_pos, emit_file);
+	emit_buffer_pos = 0;
 }
 
 void be_emit_exit(void)
 {
+	assert(!capturing);
+	flush_emit_buffer();
+	free(emit_buffer);
+	emit_buffer = NULL;
+	obstack_free(&capture_obst, NULL);
 	obstack_free(&emit_obst, NULL);
 }
 
+void be_emit_buffer_begin(void)
+{
+	assert(!capturing);
+	capturing = true;
+}
+
+be_emit_buffer_t be_emit_buffer_end(void)
+{
+	assert(capturing);
+	capturing = false;
+
+	be_emit_buffer_t buffer;
+	buffer.size = obstack_object_size(&capture_obst);
+	char *const captured = (char*)obstack_finish(&capture_obst);
+	/* copy the bytes out so buffers can be freed in any order while the
+	 * capture obstack is reused for the next function */
+	buffer.data = (char*)memcpy(XMALLOCN(char, buffer.size ? buffer.size : 1),
+	                            captured, buffer.size);
+	obstack_free(&capture_obst, captured);
+	return buffer;
+}
+
+void be_emit_buffer_write(be_emit_buffer_t *buffer)
+{
+	assert(!capturing);
+	size_t const size = buffer->size;
+	if (size >= EMIT_BUFFER_SIZE) {
+		flush_emit_buffer();
+		fwrite(buffer->data, 1, size, emit_file);
+	} else {
+		if (emit_buffer_pos + size > EMIT_BUFFER_SIZE)
+			flush_emit_buffer();
+		memcpy(&emit_buffer[emit_buffer_pos], buffer->data, size);
+		emit_buffer_pos += size;
+	}
+	xfree(buffer->data);
+	buffer->data = NULL;
+	buffer->size = 0;
+}
+
 void be_emit_irvprintf(const char *fmt, va_list args)
 {
 	ir_obst_vprintf(&emit_obst, fmt, args);
@@ -45,6 +117,17 @@ void be_emit_write_line(void)
 {
 	size_t const len  = obstack_object_size(&emit_obst);
 	char  *const line = (char*)obstack_finish(&emit_obst);
-	fwrite(line, 1, len, emit_file);
+	if (capturing) {
+		obstack_grow(&capture_obst, line, len);
+	} else if (len >= EMIT_BUFFER_SIZE) {
+		/* Oversized lines go out directly, bypassing the batch buffer. */
+		flush_emit_buffer();
+		fwrite(line, 1, len, emit_file);
+	} else {
+		if (emit_buffer_pos + len > EMIT_BUFFER_SIZE)
+			flush_emit_buffer();
+		memcpy(&emit_buffer[emit_buffer_pos], line, len);
+		emit_buffer_pos += len;
+	}
 	obstack_free(&emit_obst, line);
 }
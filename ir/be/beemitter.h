@@ -59,6 +59,41 @@ static inline void be_emit_string(const char *str)
 #define be_emit_cstring(str) \
 	be_emit_string_len(str, sizeof(str) - 1)
 
+/**
+ * Emit a decimal number to the (assembler) output.
+ *
+ * Like the other typed emitters this bypasses the format string
+ * machinery of be_emit_irprintf(), which is measurable when an operand
+ * is emitted for every instruction.
+ */
+static inline void be_emit_long(long value)
+{
+	char buf[22];
+	int  len = snprintf(buf, sizeof(buf), "%ld", value);
+	be_emit_string_len(buf, (size_t)len);
+}
+
+/**
+ * Emit an unsigned decimal number to the (assembler) output.
+ */
+static inline void be_emit_ulong(unsigned long value)
+{
+	char buf[22];
+	int  len = snprintf(buf, sizeof(buf), "%lu", value);
+	be_emit_string_len(buf, (size_t)len);
+}
+
+/**
+ * Emit a decimal number always preceded by its sign, as assemblers
+ * expect for displacements following a base.
+ */
+static inline void be_emit_long_signed(long value)
+{
+	char buf[23];
+	int  len = snprintf(buf, sizeof(buf), "%+ld", value);
+	be_emit_string_len(buf, (size_t)len);
+}
+
 /**
  * Initializes an emitter environment.
  *
@@ -71,6 +106,34 @@ void be_emit_init(FILE *F);
  */
 void be_emit_exit(void);
 
+/**
+ * A detached piece of emitter output, see be_emit_buffer_begin().
+ */
+typedef struct be_emit_buffer_t {
+	char   *data; /**< the captured bytes, owned by the buffer */
+	size_t  size; /**< number of captured bytes */
+} be_emit_buffer_t;
+
+/**
+ * Starts capturing emitter output: subsequent finished lines are
+ * collected instead of being written out, until be_emit_buffer_end()
+ * detaches them. Capturing one function's output into a buffer and
+ * writing the buffers with be_emit_buffer_write() in program order
+ * afterwards keeps the assembly byte-identical however the functions
+ * were produced - the contract for reproducible parallel emission.
+ */
+void be_emit_buffer_begin(void);
+
+/**
+ * Stops capturing and returns the captured output.
+ */
+be_emit_buffer_t be_emit_buffer_end(void);
+
+/**
+ * Writes a detached buffer to the output and frees it.
+ */
+void be_emit_buffer_write(be_emit_buffer_t *buffer);
+
 /**
  * Emit the output of an ir_printf.
  *
@@ -11,6 +11,7 @@
  */
 #include "begnuas.h"
 
+#include "array.h"
 #include "be_t.h"
 #include "bearch.h"
 #include "beemithlp.h"
@@ -721,15 +722,15 @@ static void emit_init_expression(ir_node *const init)
 		return;
 
 	case iro_Offset:
-		be_emit_irprintf("%d", get_entity_offset(get_Offset_entity(init)));
+		be_emit_long(get_entity_offset(get_Offset_entity(init)));
 		return;
 
 	case iro_Align:
-		be_emit_irprintf("%u", get_type_alignment(get_Align_type(init)));
+		be_emit_ulong(get_type_alignment(get_Align_type(init)));
 		return;
 
 	case iro_Size:
-		be_emit_irprintf("%u", get_type_size(get_Size_type(init)));
+		be_emit_ulong(get_type_size(get_Size_type(init)));
 		return;
 
 	case iro_Add:
@@ -1117,6 +1118,34 @@ static void emit_node_data(ir_node *const init, ir_type *const type)
 	be_emit_write_line();
 }
 
+/**
+ * Emit @p n raw bytes as comma separated .byte blocks, 16 values per
+ * line, formatted without the printf machinery.
+ */
+static void emit_byte_block(unsigned char const *const bytes, size_t const n)
+{
+	static const char hex[] = "0123456789abcdef";
+	for (size_t i = 0; i < n; i += 16) {
+		char    line[7 + 16 * 5 + 1];
+		char   *p     = line;
+		size_t  limit = MIN(n - i, 16);
+		memcpy(p, "\t.byte\t", 7);
+		p += 7;
+		for (size_t j = 0; j < limit; ++j) {
+			unsigned char const b = bytes[i + j];
+			if (j > 0)
+				*p++ = ',';
+			*p++ = '0';
+			*p++ = 'x';
+			*p++ = hex[b >> 4];
+			*p++ = hex[b & 0xf];
+		}
+		*p++ = '\n';
+		be_emit_string_len(line, p - line);
+		be_emit_write_line();
+	}
+}
+
 static void emit_initializer(ir_entity const *const entity,
                              unsigned long const size)
 {
@@ -1152,10 +1181,41 @@ static void emit_initializer(ir_entity const *const entity,
 				elem_size = 0;
 			}
 			break;
-		case TARVAL:
+		case TARVAL: {
+			/* Fast path for runs of plain tarval data: converting them to
+			 * raw bytes and emitting .byte blocks avoids one printf call
+			 * per scalar byte, which dominates the emission time of large
+			 * initialized tables. */
+			size_t run_end   = k;
+			size_t run_bytes = 0;
+			while (run_end < size && vals[run_end].kind == TARVAL) {
+				size_t const elem = get_type_size(vals[run_end].type);
+				run_bytes += elem;
+				run_end   += elem;
+			}
+			if (run_bytes >= 32) {
+				unsigned char *const bytes      = XMALLOCN(unsigned char,
+				                                           run_bytes);
+				bool           const big_endian = ir_target_big_endian();
+				size_t               b          = 0;
+				for (size_t pos = k; pos < run_end;) {
+					ir_tarval *const tv   = vals[pos].v.tarval;
+					unsigned   const elem = get_type_size(vals[pos].type);
+					for (unsigned i = 0; i < elem; ++i) {
+						unsigned const sub = big_endian ? elem - 1 - i : i;
+						bytes[b++] = get_tarval_sub_bits(tv, sub);
+					}
+					pos += elem;
+				}
+				emit_byte_block(bytes, run_bytes);
+				free(bytes);
+				k = run_end;
+				continue;
+			}
 			emit_tarval_data(vals[k].type, vals[k].v.tarval);
 			elem_size = get_type_size(vals[k].type);
 			break;
+		}
 		case STRING:
 			elem_size = emit_string_initializer(vals[k].v.string);
 			break;
@@ -1506,6 +1566,40 @@ static void emit_global(be_main_env_t const *const main_env,
 	}
 }
 
+/**
+ * Returns true for anonymous constants created by the backends (see
+ * be_create_tarval_entity()). They are only referenced by their label, so we
+ * may emit them in any order.
+ */
+static bool is_pool_constant(ir_entity const *const entity)
+{
+	if (get_entity_visibility(entity) != ir_visibility_private)
+		return false;
+	ir_linkage const linkage = get_entity_linkage(entity);
+	return (linkage & IR_LINKAGE_CONSTANT) && (linkage & IR_LINKAGE_NO_IDENTITY)
+	    && get_entity_kind(entity) == IR_ENTITY_NORMAL;
+}
+
+/**
+ * Order pool constants by decreasing alignment (then decreasing size), so
+ * their .align directives never insert padding between them.
+ */
+static int cmp_pool_constant(void const *const p1, void const *const p2)
+{
+	ir_entity const *const ent1 = *(ir_entity const *const *)p1;
+	ir_entity const *const ent2 = *(ir_entity const *const *)p2;
+	int res = QSORT_CMP(get_effective_entity_alignment(ent2),
+	                    get_effective_entity_alignment(ent1));
+	if (res != 0)
+		return res;
+	res = QSORT_CMP(get_type_size(get_entity_type(ent2)),
+	                get_type_size(get_entity_type(ent1)));
+	if (res != 0)
+		return res;
+	/* keep the output deterministic */
+	return QSORT_CMP(get_entity_nr(ent1), get_entity_nr(ent2));
+}
+
 /**
  * Dumps declarations of global variables and the initialization code.
  *
@@ -1513,11 +1607,23 @@ static void emit_global(be_main_env_t const *const main_env,
  */
 static void be_gas_emit_globals(ir_type *const gt, be_main_env_t const *const main_env)
 {
+	ir_entity **pool_constants = NEW_ARR_F(ir_entity*, 0);
 	for (size_t i = 0, n = get_compound_n_members(gt); i < n; i++) {
 		ir_entity *const ent = get_compound_member(gt, i);
-		if (!(get_entity_linkage(ent) & IR_LINKAGE_NO_CODEGEN))
+		if (get_entity_linkage(ent) & IR_LINKAGE_NO_CODEGEN)
+			continue;
+		if (is_pool_constant(ent)) {
+			ARR_APP1(ir_entity*, pool_constants, ent);
+		} else {
 			emit_global(main_env, ent);
+		}
+	}
+
+	QSORT_ARR(pool_constants, cmp_pool_constant);
+	for (size_t i = 0, n = ARR_LEN(pool_constants); i < n; i++) {
+		emit_global(main_env, pool_constants[i]);
 	}
+	DEL_ARR_F(pool_constants);
 }
 
 /* Generate all entities. */
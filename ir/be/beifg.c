@@ -11,6 +11,7 @@
  */
 #include "beifg.h"
 
+#include "array.h"
 #include "bechordal_t.h"
 #include "beirg.h"
 #include "belive.h"
@@ -20,12 +21,25 @@
 #include "irnode_t.h"
 #include "lc_opts.h"
 #include "lc_opts_enum.h"
+#include "pset.h"
 #include "timing.h"
+#include "util.h"
 #include "xmalloc.h"
 #include <stdlib.h>
 
+/**
+ * Precomputed adjacency of a node: its interference neighbours sorted by
+ * node index for binary searching.
+ */
+typedef struct ifg_adj_t {
+	ir_node **neighbours;
+	unsigned  degree;
+} ifg_adj_t;
+
 void be_ifg_free(be_ifg_t *self)
 {
+	ir_nodemap_destroy(&self->adjacency);
+	obstack_free(&self->obst, NULL);
 	free(self);
 }
 
@@ -66,81 +80,37 @@ ir_node *be_ifg_nodes_next(nodes_iter_t *const it)
 	}
 }
 
-static void find_neighbour_walker(ir_node *block, void *data)
-{
-	neighbours_iter_t *it    = (neighbours_iter_t*)data;
-	struct list_head  *head  = get_block_border_head(it->env, block);
-	be_lv_t           *lv    = be_get_irg_liveness(it->env->irg);
-
-	int has_started = 0;
-
-	if (!be_is_live_in(lv, block, it->irn) && block != get_nodes_block(it->irn))
-		return;
-
-	foreach_border_head(head, b) {
-		ir_node *irn = b->irn;
-
-		if (irn == it->irn) {
-			if (b->is_def)
-				has_started = 1;
-			else
-				break; /* if we reached the end of the node's lifetime we can safely break */
-		} else if (b->is_def) {
-			/* if any other node than the one in question starts living, add it to the set */
-			ir_nodeset_insert(&it->neighbours, irn);
-		} else if (!has_started) {
-			/* we only delete, if the live range in question has not yet started */
-			ir_nodeset_remove(&it->neighbours, irn);
-		}
-
-	}
-}
-
-static void find_neighbours(const be_ifg_t *ifg, neighbours_iter_t *it, const ir_node *irn)
+static ifg_adj_t const *get_adjacency(const be_ifg_t *ifg, const ir_node *irn)
 {
-	it->env         = ifg->env;
-	it->irn         = irn;
-	it->valid       = 1;
-	ir_nodeset_init(&it->neighbours);
-
-	dom_tree_walk(get_nodes_block(irn), find_neighbour_walker, NULL, it);
-
-	ir_nodeset_iterator_init(&it->iter, &it->neighbours);
-}
-
-static inline void neighbours_break(neighbours_iter_t *it, int force)
-{
-	(void) force;
-	assert(it->valid == 1);
-	ir_nodeset_destroy(&it->neighbours);
-	it->valid = 0;
-}
-
-static ir_node *get_next_neighbour(neighbours_iter_t *it)
-{
-	ir_node *res = ir_nodeset_iterator_next(&it->iter);
-
-	if (res == NULL) {
-		ir_nodeset_destroy(&it->neighbours);
-	}
-	return res;
+	return ir_nodemap_get(ifg_adj_t, &ifg->adjacency, irn);
 }
 
 ir_node *be_ifg_neighbours_begin(const be_ifg_t *ifg, neighbours_iter_t *iter,
                                  const ir_node *irn)
 {
-	find_neighbours(ifg, iter, irn);
-	return get_next_neighbour(iter);
+	ifg_adj_t const *const adj = get_adjacency(ifg, irn);
+	if (adj == NULL) {
+		iter->neighbours = NULL;
+		iter->degree     = 0;
+		iter->curr       = 0;
+		return NULL;
+	}
+	iter->neighbours = adj->neighbours;
+	iter->degree     = adj->degree;
+	iter->curr       = 0;
+	return be_ifg_neighbours_next(iter);
 }
 
 ir_node *be_ifg_neighbours_next(neighbours_iter_t *iter)
 {
-	return get_next_neighbour(iter);
+	if (iter->curr >= iter->degree)
+		return NULL;
+	return iter->neighbours[iter->curr++];
 }
 
 void be_ifg_neighbours_break(neighbours_iter_t *iter)
 {
-	neighbours_break(iter, 1);
+	(void)iter;
 }
 
 static inline void free_clique_iter(cliques_iter_t *it)
@@ -242,18 +212,135 @@ void be_ifg_cliques_break(cliques_iter_t *iter)
 
 int be_ifg_degree(const be_ifg_t *ifg, const ir_node *irn)
 {
-	neighbours_iter_t it;
-	int degree;
-	find_neighbours(ifg, &it, irn);
-	degree = ir_nodeset_size(&it.neighbours);
-	neighbours_break(&it, 1);
-	return degree;
+	ifg_adj_t const *const adj = get_adjacency(ifg, irn);
+	return adj != NULL ? (int)adj->degree : 0;
+}
+
+bool be_ifg_interfere(const be_ifg_t *ifg, const ir_node *a, const ir_node *b)
+{
+	ifg_adj_t const *adj   = get_adjacency(ifg, a);
+	ir_node   const *other = b;
+	ifg_adj_t const *adj_b = get_adjacency(ifg, b);
+	/* search in the shorter adjacency array */
+	if (adj == NULL || (adj_b != NULL && adj_b->degree < adj->degree)) {
+		adj   = adj_b;
+		other = a;
+	}
+	if (adj == NULL)
+		return false;
+
+	unsigned const idx = get_irn_idx(other);
+	unsigned       lo  = 0;
+	unsigned       hi  = adj->degree;
+	while (lo < hi) {
+		unsigned const mid     = lo + (hi - lo) / 2;
+		unsigned const mid_idx = get_irn_idx(adj->neighbours[mid]);
+		if (mid_idx < idx) {
+			lo = mid + 1;
+		} else if (mid_idx > idx) {
+			hi = mid;
+		} else {
+			return true;
+		}
+	}
+	return false;
+}
+
+typedef struct edge_t {
+	ir_node *src;
+	ir_node *dst;
+} edge_t;
+
+typedef struct build_adj_env_t {
+	const be_chordal_env_t *env;
+	ir_nodeset_t            living;
+	edge_t                 *edges; /**< both directions of each edge (ARR_F) */
+} build_adj_env_t;
+
+/**
+ * Sweep over the borders of @p block in program order. Whenever a live
+ * range starts it interferes with exactly the ranges living at that
+ * point (chordal property), so no other walk is needed.
+ */
+static void build_adjacency_walker(ir_node *block, void *data)
+{
+	build_adj_env_t  *const bw   = (build_adj_env_t*)data;
+	struct list_head *const head = get_block_border_head(bw->env, block);
+
+	foreach_border_head(head, b) {
+		ir_node *const irn = b->irn;
+		if (b->is_def) {
+			foreach_ir_nodeset(&bw->living, other, iter) {
+				edge_t const edge = { irn, other };
+				ARR_APP1(edge_t, bw->edges, edge);
+				edge_t const redge = { other, irn };
+				ARR_APP1(edge_t, bw->edges, redge);
+			}
+			ir_nodeset_insert(&bw->living, irn);
+		} else {
+			ir_nodeset_remove(&bw->living, irn);
+		}
+	}
+	assert(ir_nodeset_size(&bw->living) == 0
+	       && "Something has survived! (At the end of the block living must be empty)");
+}
+
+static int edge_cmp(const void *p1, const void *p2)
+{
+	edge_t const *const e1 = (edge_t const*)p1;
+	edge_t const *const e2 = (edge_t const*)p2;
+	unsigned const src1 = get_irn_idx(e1->src);
+	unsigned const src2 = get_irn_idx(e2->src);
+	if (src1 != src2)
+		return src1 < src2 ? -1 : 1;
+	unsigned const dst1 = get_irn_idx(e1->dst);
+	unsigned const dst2 = get_irn_idx(e2->dst);
+	if (dst1 != dst2)
+		return dst1 < dst2 ? -1 : 1;
+	return 0;
 }
 
 be_ifg_t *be_create_ifg(const be_chordal_env_t *env)
 {
 	be_ifg_t *ifg = XMALLOC(be_ifg_t);
 	ifg->env = env;
+	obstack_init(&ifg->obst);
+	ir_nodemap_init(&ifg->adjacency, env->irg);
+
+	/* collect all interference edges in one linear sweep */
+	build_adj_env_t bw;
+	bw.env   = env;
+	bw.edges = NEW_ARR_F(edge_t, 0);
+	ir_nodeset_init(&bw.living);
+	irg_block_walk_graph(env->irg, build_adjacency_walker, NULL, &bw);
+	ir_nodeset_destroy(&bw.living);
+
+	/* sort by (source, destination); pairs living together in several
+	 * blocks were recorded once per block and are deduplicated here */
+	size_t const n_edges = ARR_LEN(bw.edges);
+	QSORT(bw.edges, n_edges, edge_cmp);
+
+	for (size_t i = 0; i < n_edges;) {
+		ir_node *const src  = bw.edges[i].src;
+		ir_node       *last = NULL;
+		unsigned       degree = 0;
+		size_t         j;
+		for (j = i; j < n_edges && bw.edges[j].src == src; ++j) {
+			ir_node *const dst = bw.edges[j].dst;
+			if (dst == last)
+				continue;
+			obstack_ptr_grow(&ifg->obst, dst);
+			last = dst;
+			++degree;
+		}
+		ir_node  **const neighbours = (ir_node**)obstack_finish(&ifg->obst);
+		ifg_adj_t *const adj        = OALLOC(&ifg->obst, ifg_adj_t);
+		adj->degree     = degree;
+		adj->neighbours = neighbours;
+		ir_nodemap_insert(&ifg->adjacency, src, adj);
+		i = j;
+	}
+	DEL_ARR_F(bw.edges);
 
 	return ifg;
 }
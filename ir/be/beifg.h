@@ -14,12 +14,15 @@
 
 #include "be_types.h"
 #include "bechordal.h"
+#include "irnodemap.h"
 #include "irnodeset.h"
 #include "obstack.h"
 #include "pset.h"
 
 struct be_ifg_t {
 	const be_chordal_env_t *env;
+	struct obstack          obst;      /**< holds the adjacency arrays */
+	ir_nodemap              adjacency; /**< maps nodes to their ifg_adj_t */
 };
 
 typedef struct nodes_iter_t {
@@ -31,11 +34,9 @@ typedef struct nodes_iter_t {
 } nodes_iter_t;
 
 typedef struct neighbours_iter_t {
-	const be_chordal_env_t *env;
-	const ir_node        *irn;
-	int                   valid;
-	ir_nodeset_t          neighbours;
-	ir_nodeset_iterator_t iter;
+	ir_node **neighbours;
+	unsigned  degree;
+	unsigned  curr;
 } neighbours_iter_t;
 
 typedef struct cliques_iter_t {
@@ -60,6 +61,9 @@ int      be_ifg_cliques_begin(const be_ifg_t *ifg, cliques_iter_t *iter,
 int      be_ifg_cliques_next(cliques_iter_t *iter);
 void     be_ifg_cliques_break(cliques_iter_t *iter);
 int      be_ifg_degree(const be_ifg_t *ifg, const ir_node *irn);
+/** O(log degree) interference test on the precomputed adjacency. */
+bool     be_ifg_interfere(const be_ifg_t *ifg, const ir_node *a,
+                          const ir_node *b);
 
 #define be_ifg_foreach_neighbour(ifg, iter, irn, pos) \
 	for (ir_node *pos = be_ifg_neighbours_begin(ifg, iter, irn); pos; pos = be_ifg_neighbours_next(iter))
@@ -17,10 +17,19 @@
 #include "bitfiddle.h"
 #include "compiler.h"
 #include "entity_t.h"
+#include "firm_threads.h"
 #include "obst.h"
 #include "panic.h"
 #include <assert.h>
 #include <limits.h>
+#include <stdbool.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 typedef enum reloc_dest_kind_t {
 	RELOC_DEST_CODE_FRAGMENT,
@@ -47,22 +56,50 @@ typedef struct fragment_info_t {
 	relocation_t relocations[];
 } fragment_info_t;
 
+typedef struct jit_queue_entry_t jit_queue_entry_t;
+struct jit_queue_entry_t {
+	jit_queue_entry_t         *next;
+	ir_graph                  *irg;
+	ir_jit_compile_callback_t  callback;
+	void                      *env;
+};
+
 struct ir_jit_segment_t {
-	struct obstack code_obst;
-	struct obstack fragment_info_obst;
-	struct obstack fragment_info_arr_obst;
+	struct obstack      code_obst;
+	struct obstack      fragment_info_obst;
+	struct obstack      fragment_info_arr_obst;
+	ir_jit_function_t **functions;      /**< finished functions (ARR_F) */
+
+	/* background compilation worker */
+	firm_mutex_t       lock;
+	firm_cond_t        work_ready;
+	firm_cond_t        work_done;
+	jit_queue_entry_t *queue_head;
+	jit_queue_entry_t *queue_tail;
+	unsigned           n_pending;
+	firm_thread_t      worker;
+	bool               worker_running;
+	bool               shutdown;
 };
 
+/** Compilation mutates global state (irp, the emitter obstack pointers),
+ * so at most one graph may be in the backend at any time, even with
+ * multiple segments. */
+static firm_mutex_t jit_compile_lock;
+static bool         jit_compile_lock_initialized;
+
 struct ir_jit_function_t {
 	unsigned          size;
+	unsigned          segment_offset; /**< offset in the laid out segment */
 	unsigned          n_fragments;
 	char const       *code;
 	fragment_info_t **fragment_infos;
 };
 
-struct obstack        *code_obst;
-static struct obstack *fragment_info_obst;
-static struct obstack *fragment_info_arr_obst;
+struct obstack          *code_obst;
+static struct obstack   *fragment_info_obst;
+static struct obstack   *fragment_info_arr_obst;
+static ir_jit_segment_t *current_segment;
 
 ir_jit_segment_t *be_new_jit_segment(void)
 {
@@ -70,11 +107,30 @@ ir_jit_segment_t *be_new_jit_segment(void)
 	obstack_init(&segment->code_obst);
 	obstack_init(&segment->fragment_info_obst);
 	obstack_init(&segment->fragment_info_arr_obst);
+	segment->functions = NEW_ARR_F(ir_jit_function_t*, 0);
+	firm_mutex_init(&segment->lock);
+	firm_cond_init(&segment->work_ready);
+	firm_cond_init(&segment->work_done);
+	if (!jit_compile_lock_initialized) {
+		firm_mutex_init(&jit_compile_lock);
+		jit_compile_lock_initialized = true;
+	}
 	return segment;
 }
 
 void be_destroy_jit_segment(ir_jit_segment_t *segment)
 {
+	if (segment->worker_running) {
+		firm_mutex_lock(&segment->lock);
+		segment->shutdown = true;
+		firm_cond_signal(&segment->work_ready);
+		firm_mutex_unlock(&segment->lock);
+		firm_thread_join(segment->worker);
+	}
+	firm_cond_destroy(&segment->work_done);
+	firm_cond_destroy(&segment->work_ready);
+	firm_mutex_destroy(&segment->lock);
+	DEL_ARR_F(segment->functions);
 	obstack_free(&segment->code_obst, NULL);
 	obstack_free(&segment->fragment_info_obst, NULL);
 	obstack_free(&segment->fragment_info_arr_obst, NULL);
@@ -93,6 +149,73 @@ void const *be_jit_get_entity_addr(ir_entity const *const entity)
 	return entity->attr.global.jit_addr;
 }
 
+static int jit_worker(void *const data)
+{
+	ir_jit_segment_t *const segment = (ir_jit_segment_t*)data;
+	firm_mutex_lock(&segment->lock);
+	for (;;) {
+		while (segment->queue_head == NULL && !segment->shutdown)
+			firm_cond_wait(&segment->work_ready, &segment->lock);
+		jit_queue_entry_t *const entry = segment->queue_head;
+		if (entry == NULL)
+			break;
+		segment->queue_head = entry->next;
+		if (segment->queue_head == NULL)
+			segment->queue_tail = NULL;
+		firm_mutex_unlock(&segment->lock);
+
+		firm_mutex_lock(&jit_compile_lock);
+		ir_jit_function_t *const function
+			= be_jit_compile(segment, entry->irg);
+		firm_mutex_unlock(&jit_compile_lock);
+		entry->callback(entry->irg, function, entry->env);
+		free(entry);
+
+		firm_mutex_lock(&segment->lock);
+		--segment->n_pending;
+		firm_cond_broadcast(&segment->work_done);
+	}
+	firm_mutex_unlock(&segment->lock);
+	return 0;
+}
+
+void be_jit_compile_async(ir_jit_segment_t *const segment, ir_graph *const irg,
+                          ir_jit_compile_callback_t const callback,
+                          void *const env)
+{
+	firm_mutex_lock(&segment->lock);
+	if (!segment->worker_running)
+		segment->worker_running
+			= firm_thread_create(&segment->worker, jit_worker, segment);
+	if (!segment->worker_running) {
+		/* No thread support: degrade to a synchronous compile. */
+		firm_mutex_unlock(&segment->lock);
+		callback(irg, be_jit_compile(segment, irg), env);
+		return;
+	}
+	jit_queue_entry_t *const entry = XMALLOCZ(jit_queue_entry_t);
+	entry->irg      = irg;
+	entry->callback = callback;
+	entry->env      = env;
+	if (segment->queue_tail != NULL) {
+		segment->queue_tail->next = entry;
+	} else {
+		segment->queue_head = entry;
+	}
+	segment->queue_tail = entry;
+	++segment->n_pending;
+	firm_cond_signal(&segment->work_ready);
+	firm_mutex_unlock(&segment->lock);
+}
+
+void be_jit_sync(ir_jit_segment_t *const segment)
+{
+	firm_mutex_lock(&segment->lock);
+	while (segment->n_pending > 0)
+		firm_cond_wait(&segment->work_done, &segment->lock);
+	firm_mutex_unlock(&segment->lock);
+}
+
 void be_jit_begin_function(ir_jit_segment_t *const segment)
 {
 	assert(obstack_object_size(&segment->code_obst) == 0);
@@ -101,6 +224,7 @@ void be_jit_begin_function(ir_jit_segment_t *const segment)
 	code_obst              = &segment->code_obst;
 	fragment_info_obst     = &segment->fragment_info_obst;
 	fragment_info_arr_obst = &segment->fragment_info_arr_obst;
+	current_segment        = segment;
 }
 
 static void layout_fragments(ir_jit_function_t *const function,
@@ -153,11 +277,14 @@ ir_jit_function_t *be_jit_finish_function(void)
 
 	layout_fragments(res, code_size);
 
+	ARR_APP1(ir_jit_function_t*, current_segment->functions, res);
+
 #ifndef NDEBUG
 	code_obst              = NULL;
 	fragment_info_obst     = NULL;
 	fragment_info_arr_obst = NULL;
 #endif
+	current_segment = NULL;
 
 	return res;
 }
@@ -167,6 +294,51 @@ unsigned be_get_function_size(ir_jit_function_t const *const function)
 	return function->size;
 }
 
+unsigned be_get_segment_size(ir_jit_segment_t *const segment)
+{
+	/* Lay the functions out back to back with the usual function
+	 * alignment. */
+	unsigned address = 0;
+	for (size_t i = 0, n = ARR_LEN(segment->functions); i < n; ++i) {
+		ir_jit_function_t *const function = segment->functions[i];
+		address = round_up2(address, 16);
+		function->segment_offset = address;
+		address += function->size;
+	}
+	return address;
+}
+
+unsigned be_get_function_offset(ir_jit_function_t const *const function)
+{
+	return function->segment_offset;
+}
+
+size_t be_jit_segment_n_functions(ir_jit_segment_t const *const segment)
+{
+	return ARR_LEN(segment->functions);
+}
+
+ir_jit_function_t *be_jit_segment_function(ir_jit_segment_t *const segment,
+                                           size_t const num)
+{
+	assert(num < ARR_LEN(segment->functions));
+	return segment->functions[num];
+}
+
+bool be_jit_protect_code(char *const buffer, size_t const size)
+{
+#ifdef _WIN32
+	DWORD old_protect;
+	return VirtualProtect(buffer, size, PAGE_EXECUTE_READ, &old_protect) != 0;
+#else
+	uintptr_t const page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+	uintptr_t const begin     = (uintptr_t)buffer & ~(page_size-1);
+	uintptr_t const end
+		= ((uintptr_t)buffer + size + page_size-1) & ~(page_size-1);
+	return mprotect((void*)begin, end-begin, PROT_READ | PROT_EXEC) == 0;
+#endif
+}
+
 unsigned be_begin_fragment(uint8_t const p2align, uint8_t const max_skip)
 {
 	assert(obstack_object_size(fragment_info_obst) == 0);
@@ -360,7 +532,7 @@ void be_jit_emit_memory(char *const buffer, ir_jit_function_t *const function,
 	for (size_t i = 0, n = function->n_fragments; i < n; ++i) {
 		fragment_info_t const *const fragment  = function->fragment_infos[i];
 		unsigned               const address   = fragment->address;
-		unsigned               const nop_bytes = last_address - address;
+		unsigned               const nop_bytes = address - last_address;
 		assert(address >= last_address);
 		if (nop_bytes > 0)
 			emitter->nops(buffer + last_address, nop_bytes);
@@ -12,6 +12,8 @@
 #ifndef FIRM_BE_BEEMITTER_BINARY_H
 #define FIRM_BE_BEEMITTER_BINARY_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "firm_types.h"
@@ -38,6 +40,13 @@ void be_jit_emit_as_asm(ir_jit_function_t *function, emit_relocation_func emit);
 void be_jit_begin_function(ir_jit_segment_t *segment);
 ir_jit_function_t *be_jit_finish_function(void);
 
+size_t be_jit_segment_n_functions(ir_jit_segment_t const *segment);
+ir_jit_function_t *be_jit_segment_function(ir_jit_segment_t *segment,
+                                           size_t num);
+
+/** Flip the pages holding @p size bytes at @p buffer to read+execute. */
+bool be_jit_protect_code(char *buffer, size_t size);
+
 unsigned be_begin_fragment(uint8_t p2align, uint8_t max_skip);
 void be_finish_fragment(void);
 
@@ -28,18 +28,34 @@
 #include "lc_opts_enum.h"
 #include "list.h"
 #include "obst.h"
+#include "xmalloc.h"
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static ir_node     *current_block;
-static unsigned    *available;
-static ir_node     *ready_cfop;
+static ir_node           *current_block;
+static unsigned          *available;
+static ir_node           *ready_cfop;
 /** Set of ready nodes (nodes where all dependencies are already fulfilled).
  * Does not contain cfops. */
-static ir_nodeset_t ready_set;
+static ir_nodeset_t       ready_set;
+/** Backend latency callback, NULL if every instruction counts as 1 cycle. */
+static sched_latency_func latency_func;
+/** Number of instructions issued in the current block so far. */
+static unsigned           clock_time;
+/** Per-node cycle in which the result becomes available. While a node sits
+ * in the pending set the entry holds the cycle it matures instead. */
+static unsigned          *finish_times;
+/** Nodes whose operands are all scheduled, but whose results are not
+ * available yet because of operand latency. */
+static ir_nodeset_t       pending_set;
+
+void be_list_sched_set_latency(sched_latency_func func)
+{
+	latency_func = func;
+}
 
 /**
  * Returns non-zero if the node is already available
@@ -53,6 +69,25 @@ static bool is_available(const ir_node *const node)
 static void make_available(ir_node *node);
 static void add_to_sched(ir_node *node);
 
+/**
+ * Returns the first cycle in which all operand results of @p node are
+ * available. Only meaningful when a latency callback is set.
+ */
+static unsigned operands_ready_time(const ir_node *node)
+{
+	unsigned ready_time = 0;
+	if (is_Phi(node))
+		return ready_time;
+	foreach_irn_in(node, i, op) {
+		if (is_Block(op) || get_nodes_block(op) != current_block)
+			continue;
+		unsigned const finish = finish_times[get_irn_idx(op)];
+		if (finish > ready_time)
+			ready_time = finish;
+	}
+	return ready_time;
+}
+
 /**
  * Put a node in the ready set, or make it available immediately if it doesn't
  * need to be scheduled
@@ -74,9 +109,21 @@ static void node_ready(ir_node *node)
 			/* we must not have multiple cfops in a block */
 			assert(ready_cfop == NULL || ready_cfop == node);
 			ready_cfop = node;
-		} else {
-			ir_nodeset_insert(&ready_set, node);
+			return;
 		}
+		if (latency_func != NULL) {
+			unsigned const ready_time = operands_ready_time(node);
+			if (ready_time > clock_time) {
+				/* an operand is still in flight, withhold the node so
+				 * the selector prefers independent work */
+				DB((dbg, LEVEL_2, "\tpending until cycle %u: %+F\n",
+				    ready_time, node));
+				finish_times[get_irn_idx(node)] = ready_time;
+				ir_nodeset_insert(&pending_set, node);
+				return;
+			}
+		}
+		ir_nodeset_insert(&ready_set, node);
 	}
 }
 
@@ -104,6 +151,23 @@ static void make_available(ir_node *node)
 	unsigned idx = get_irn_idx(node);
 	rbitset_set(available, idx);
 
+	if (latency_func != NULL) {
+		unsigned finish;
+		if (is_Proj(node)) {
+			/* data results inherit the latency of the producing node,
+			 * the memory result only orders the schedule */
+			finish = get_irn_mode(node) == mode_M
+			       ? clock_time
+			       : finish_times[get_irn_idx(get_Proj_pred(node))];
+		} else if (arch_is_irn_not_scheduled(node)) {
+			finish = clock_time;
+		} else {
+			/* the node was issued in the previous cycle */
+			finish = clock_time - 1 + latency_func(node);
+		}
+		finish_times[idx] = finish;
+	}
+
     /* check users, they might be ready now */
 	foreach_out_edge(node, edge) {
 		ir_node *user = get_edge_src_irn(edge);
@@ -134,13 +198,49 @@ static void add_to_sched(ir_node *node)
 	sched_add_before(current_block, node);
 
 	ir_nodeset_remove(&ready_set, node);
+	++clock_time;
 	make_available(node);
 }
 
+/**
+ * Move matured nodes from the pending set into the ready set. If no other
+ * work is ready the clock is advanced to the next maturing node, modelling
+ * a pipeline stall.
+ */
+static void release_pending(void)
+{
+	if (latency_func == NULL || ir_nodeset_size(&pending_set) == 0)
+		return;
+
+	if (ir_nodeset_size(&ready_set) == 0) {
+		/* no independent work left: stall until the next result is done */
+		unsigned next_time = 0;
+		bool     first     = true;
+		foreach_ir_nodeset(&pending_set, node, iter) {
+			unsigned const ready_time = finish_times[get_irn_idx(node)];
+			if (first || ready_time < next_time) {
+				next_time = ready_time;
+				first     = false;
+			}
+		}
+		if (next_time > clock_time)
+			clock_time = next_time;
+	}
+
+	foreach_ir_nodeset(&pending_set, node, iter) {
+		if (finish_times[get_irn_idx(node)] <= clock_time) {
+			DB((dbg, LEVEL_2, "\tmatured: %+F\n", node));
+			ir_nodeset_remove_iterator(&pending_set, &iter);
+			ir_nodeset_insert(&ready_set, node);
+		}
+	}
+}
+
 void be_list_sched_schedule(ir_node *node)
 {
 	DB((dbg, LEVEL_1, "\tpicked %+F\n", node));
 	add_to_sched(node);
+	release_pending();
 	maybe_add_cfop();
 }
 
@@ -151,7 +251,9 @@ ir_nodeset_t *be_list_sched_begin_block(ir_node *block)
 
 	sched_init_block(block);
 	ir_nodeset_init(&ready_set);
+	ir_nodeset_init(&pending_set);
 	ready_cfop = NULL;
+	clock_time = 0;
 	DB((dbg, LEVEL_1, "scheduling %+F\n", block));
 
 	/* fill ready set */
@@ -167,7 +269,9 @@ ir_nodeset_t *be_list_sched_begin_block(ir_node *block)
 void be_list_sched_end_block(void)
 {
 	assert(ir_nodeset_size(&ready_set) == 0);
+	assert(ir_nodeset_size(&pending_set) == 0);
 	ir_nodeset_destroy(&ready_set);
+	ir_nodeset_destroy(&pending_set);
 	current_block = NULL;
 }
 
@@ -179,11 +283,15 @@ void be_list_sched_begin(ir_graph *irg)
 
 	unsigned last_idx = get_irg_last_idx(irg);
 	available = rbitset_malloc(last_idx);
+	if (latency_func != NULL)
+		finish_times = XMALLOCNZ(unsigned, last_idx);
 }
 
 void be_list_sched_finish(void)
 {
 	free(available);
+	free(finish_times);
+	finish_times = NULL;
 }
 
 BE_REGISTER_MODULE_CONSTRUCTOR(be_init_listsched)
@@ -18,6 +18,20 @@
 #include "be.h"
 #include "be_types.h"
 
+/**
+ * Callback reporting the result latency of @p node in cycles.
+ */
+typedef unsigned (*sched_latency_func)(const ir_node *node);
+
+/**
+ * Set the latency callback used by the list schedulers. Consumers of a
+ * result with a latency greater than 1 are withheld from the ready set
+ * while independent work is available, so the scheduler can hide load-use
+ * and similar delays. Passing NULL (the default) treats every instruction
+ * as single-cycle.
+ */
+void be_list_sched_set_latency(sched_latency_func func);
+
 /**
  * Begin list scheduling for a graph.
  */
@@ -530,21 +530,34 @@ static void be_live_chk_compare(be_lv_t *lv, lv_chk_t *lvc)
 	obstack_ptr_grow(&obst, NULL);
 	ir_node **nodes = (ir_node**)obstack_finish(&obst);
 
-	stat_ev_ctx_push("be_lv_chk_compare");
+	size_t n_vars = 0;
 	for (unsigned j = 0; nodes[j] != NULL; ++j) {
-		const ir_node *irn = nodes[j];
-		if (is_Block(irn))
-			continue;
+		if (is_liveness_node(nodes[j]))
+			nodes[n_vars++] = nodes[j];
+	}
 
-		for (unsigned i = 0; blocks[i] != NULL; ++i) {
-			const ir_node *bl = blocks[i];
+	bitset_t *live_in  = bitset_malloc(n_vars);
+	bitset_t *live_end = bitset_malloc(n_vars);
+	bitset_t *live_out = bitset_malloc(n_vars);
+
+	stat_ev_ctx_push("be_lv_chk_compare");
+	for (unsigned i = 0; blocks[i] != NULL; ++i) {
+		const ir_node *bl = blocks[i];
+		bitset_clear_all(live_in);
+		bitset_clear_all(live_end);
+		bitset_clear_all(live_out);
+		lv_chk_bl_batch(lvc, bl, nodes, n_vars, live_in, live_end,
+		                live_out);
+
+		for (size_t j = 0; j < n_vars; ++j) {
+			const ir_node *irn = nodes[j];
 			bool lvr_in  = be_is_live_in (lv, bl, irn);
 			bool lvr_out = be_is_live_out(lv, bl, irn);
 			bool lvr_end = be_is_live_end(lv, bl, irn);
 
-			bool lvc_in  = lv_chk_bl_in (lvc, bl, irn);
-			bool lvc_out = lv_chk_bl_out(lvc, bl, irn);
-			bool lvc_end = lv_chk_bl_end(lvc, bl, irn);
+			bool lvc_in  = bitset_is_set(live_in,  j);
+			bool lvc_out = bitset_is_set(live_out, j);
+			bool lvc_end = bitset_is_set(live_end, j);
 
 			if (lvr_in != lvc_in)
 				ir_fprintf(stderr, "live in  info for %+F at %+F differs: nml: %d, chk: %d\n", irn, bl, lvr_in, lvc_in);
@@ -558,6 +571,9 @@ static void be_live_chk_compare(be_lv_t *lv, lv_chk_t *lvc)
 	}
 	stat_ev_ctx_pop("be_lv_chk_compare");
 
+	free(live_out);
+	free(live_end);
+	free(live_in);
 	obstack_free(&obst, NULL);
 }
 
@@ -17,6 +17,7 @@
 #include "bemodule.h"
 #include "besched.h"
 #include "debug.h"
+#include "hashptr.h"
 #include "irloop_t.h"
 #include "irnode_t.h"
 #include "set.h"
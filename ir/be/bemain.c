@@ -12,11 +12,13 @@
 #include "be_t.h"
 #include "beasm.h"
 #include "bechordal_t.h"
+#include "becse.h"
 #include "bediagnostic.h"
 #include "beemitter.h"
 #include "begnuas.h"
 #include "beifg.h"
 #include "beirg.h"
+#include "bejit.h"
 #include "belistsched.h"
 #include "belive.h"
 #include "belower.h"
@@ -31,11 +33,13 @@
 #include "beutil.h"
 #include "beverify.h"
 #include "execfreq_t.h"
+#include "firm_threads.h"
 #include "ident_t.h"
 #include "ircons.h"
 #include "irdom_t.h"
 #include "irdump.h"
 #include "iredges_t.h"
+#include "irflag_t.h"
 #include "irgopt.h"
 #include "irloop_t.h"
 #include "iroptimize.h"
@@ -54,6 +58,8 @@
 static struct obstack obst;
 static be_main_env_t  env;
 
+static const char *get_timer_name(be_timer_id_t id);
+
 /* options visible for anyone */
 be_options_t be_options = {
 	.dump_flags           = DUMP_NONE,
@@ -64,6 +70,10 @@ be_options_t be_options = {
 	.do_verify            = true,
 	.ilp_solver           = "",
 	.verbose_asm          = true,
+	.n_threads            = 1,
+	.dump_filter          = "",
+	.dump_every           = 0,
+	.dump_min_nodes       = 0,
 };
 
 /* possible dumping options */
@@ -92,10 +102,31 @@ static const lc_opt_table_entry_t be_main_options[] = {
 	LC_OPT_ENT_BOOL     ("profileuse",      "use existing profile data",                         &be_options.opt_profile_use),
 	LC_OPT_ENT_BOOL     ("verboseasm", "enable verbose assembler output",                        &be_options.verbose_asm),
 
+	LC_OPT_ENT_STR("dumpfilter",   "only dump functions whose name contains this substring", &be_options.dump_filter),
+	LC_OPT_ENT_INT("dumpevery",    "only dump every Nth function",                        &be_options.dump_every),
+	LC_OPT_ENT_INT("dumpminnodes", "only dump functions with at least N nodes",           &be_options.dump_min_nodes),
+
 	LC_OPT_ENT_STR("ilp.solver", "the ilp solver name", &be_options.ilp_solver),
+	LC_OPT_ENT_INT("threads", "worker threads for per-graph codegen (experimental)", &be_options.n_threads),
 	LC_OPT_LAST
 };
 
+bool be_dump_selected(ir_graph const *const irg)
+{
+	if (be_options.dump_filter[0] != '\0'
+	 && strstr(get_entity_name(get_irg_entity(irg)),
+	           be_options.dump_filter) == NULL)
+		return false;
+	/* the node index watermark serves as a cheap size measure */
+	if (be_options.dump_min_nodes > 0
+	 && get_irg_last_idx(irg) < (unsigned)be_options.dump_min_nodes)
+		return false;
+	if (be_options.dump_every > 1
+	 && get_irg_graph_nr(irg) % be_options.dump_every != 0)
+		return false;
+	return true;
+}
+
 asm_constraint_flags_t be_asm_constraint_flags[256];
 
 void be_set_constraint_support(asm_constraint_flags_t const flags, char const *const constraints)
@@ -319,7 +350,7 @@ void be_begin(FILE *file_handle, const char *cup_name)
 
 	bemain_timer = NULL;
 	if (be_options.timing) {
-		bemain_timer = ir_timer_new();
+		bemain_timer = ir_timer_new_named("bemain");
 
 		if (ir_timer_enter_high_priority())
 			be_warningf(NULL, "could not enter high priority mode");
@@ -345,7 +376,7 @@ void be_begin(FILE *file_handle, const char *cup_name)
 
 	if (be_timing) {
 		for (be_timer_id_t t = T_FIRST; t < T_LAST+1; ++t) {
-			be_timers[t] = ir_timer_new();
+			be_timers[t] = ir_timer_new_named(get_timer_name(t));
 			ir_timer_init_parent(be_timers[t]);
 		}
 	}
@@ -459,6 +490,15 @@ void be_lower_for_target(void)
 
 static int cse_setting;
 
+/** Whether the tier-1 JIT pipeline is active, see be_jit_compile_fast(). */
+static bool jit_fast_codegen;
+
+/** Cold functions get the same quick pipeline as the tier-1 JIT. */
+static bool use_quick_codegen(ir_graph const *irg)
+{
+	return jit_fast_codegen || get_function_tier(irg) == ir_tier_cold;
+}
+
 bool be_step_first(ir_graph *irg)
 {
 	ir_entity *const entity = get_irg_entity(irg);
@@ -477,13 +517,20 @@ bool be_step_first(ir_graph *irg)
 
 void be_step_schedule(ir_graph *irg)
 {
+	/* Selection constructs machine nodes without value numbering; merge
+	 * the duplicates while the code is still unscheduled. */
+	be_cse(irg);
+
 	/* We generally disable CSE after scheduling as we now may want to duplicate
 	 * operations on purpose, new operations should not merge with existing ones
 	 * before they are scheduled. */
 	set_opt_cse(0);
 
 	be_timer_push(T_SCHED);
-	be_schedule_graph(irg);
+	if (use_quick_codegen(irg))
+		be_schedule_graph_fast(irg);
+	else
+		be_schedule_graph(irg);
 	be_timer_pop(T_SCHED);
 	be_dump(DUMP_SCHED, irg, "sched");
 	be_sched_verify(irg);
@@ -499,7 +546,10 @@ void be_step_regalloc(ir_graph *irg, const regalloc_if_t *regif)
 	}
 
 	/* Do register allocation */
-	be_allocate_registers(irg, regif);
+	if (use_quick_codegen(irg))
+		be_allocate_registers_fast(irg, regif);
+	else
+		be_allocate_registers(irg, regif);
 	be_regalloc_verify(irg);
 
 	if (stat_ev_enabled) {
@@ -533,10 +583,7 @@ void be_step_last(ir_graph *irg)
 			}
 		} else {
 			printf("==>> IRG %s <<==\n", get_entity_name(get_irg_entity(irg)));
-			for (be_timer_id_t t = T_FIRST; t < T_LAST+1; ++t) {
-				double val = ir_timer_elapsed_usec(be_timers[t]) / 1000.0;
-				printf("%-20s: %10.3f msec\n", get_timer_name(t), val);
-			}
+			ir_timer_print_tree(stdout, bemain_timer);
 		}
 		for (be_timer_id_t t = T_FIRST; t < T_LAST+1; ++t) {
 			ir_timer_reset(be_timers[t]);
@@ -577,14 +624,88 @@ void be_finish(void)
 	free_type(env.pic_symbols_type);
 }
 
+bool be_parallel_codegen(void)
+{
+	return FIRM_HAS_THREADS && be_options.n_threads > 1
+	    && !be_timing && !stat_ev_enabled;
+}
+
+/** Work distribution state shared by all codegen workers. */
+typedef struct codegen_driver_env_t {
+	void       (*codegen)(ir_graph *irg); /**< per-graph codegen function */
+	size_t       next;                    /**< index of the next unclaimed graph */
+	firm_mutex_t lock;                    /**< protects next */
+} codegen_driver_env_t;
+
+/**
+ * Claim the next unprocessed graph, or return NULL if all graphs have
+ * been handed out.
+ */
+static ir_graph *codegen_driver_claim_irg(codegen_driver_env_t *env)
+{
+	ir_graph *irg = NULL;
+	firm_mutex_lock(&env->lock);
+	if (env->next < get_irp_n_irgs())
+		irg = get_irp_irg(env->next++);
+	firm_mutex_unlock(&env->lock);
+	return irg;
+}
+
+static int codegen_driver_worker(void *data)
+{
+	codegen_driver_env_t *env = (codegen_driver_env_t *)data;
+	for (ir_graph *irg; (irg = codegen_driver_claim_irg(env)) != NULL;) {
+		env->codegen(irg);
+	}
+	return 0;
+}
+
+void be_codegen_irgs(void (*codegen)(ir_graph *irg))
+{
+	codegen_driver_env_t env = { codegen, 0, 0 };
+	/* The claim path always locks, so the mutex must be valid even when
+	 * running inline. */
+	firm_mutex_init(&env.lock);
+
+	size_t   const n_irgs    = get_irp_n_irgs();
+	unsigned       n_threads = be_options.n_threads > 0
+	                         ? (unsigned)be_options.n_threads : 1;
+	if (n_threads > n_irgs)
+		n_threads = (unsigned)n_irgs;
+	if (!be_parallel_codegen())
+		n_threads = 1;
+
+#if FIRM_HAS_THREADS
+	if (n_threads > 1) {
+		firm_thread_t *workers = XMALLOCN(firm_thread_t, n_threads);
+		unsigned       started = 0;
+		for (unsigned t = 0; t < n_threads; ++t) {
+			if (!firm_thread_create(&workers[t], codegen_driver_worker, &env))
+				break;
+			++started;
+		}
+		/* If no worker could be spawned, fall back to running inline. */
+		if (started == 0)
+			codegen_driver_worker(&env);
+		for (unsigned t = 0; t < started; ++t)
+			firm_thread_join(workers[t]);
+		free(workers);
+		firm_mutex_destroy(&env.lock);
+		return;
+	}
+#endif
+	codegen_driver_worker(&env);
+	firm_mutex_destroy(&env.lock);
+}
+
 void be_main(FILE *file_handle, const char *cup_name)
 {
 	/* Let the target control how the codegeneration works. */
 	ir_target.isa->generate_code(file_handle, cup_name);
 }
 
-ir_jit_function_t *be_jit_compile(ir_jit_segment_t *const segment,
-                                  ir_graph *const irg)
+static ir_jit_function_t *jit_compile(ir_jit_segment_t *const segment,
+                                      ir_graph *const irg)
 {
 	if (ir_target.isa->jit_compile == NULL)
 		return NULL;
@@ -603,7 +724,39 @@ ir_jit_function_t *be_jit_compile(ir_jit_segment_t *const segment,
 	return ir_target.isa->jit_compile(segment, irg);
 }
 
+ir_jit_function_t *be_jit_compile(ir_jit_segment_t *const segment,
+                                  ir_graph *const irg)
+{
+	return jit_compile(segment, irg);
+}
+
+ir_jit_function_t *be_jit_compile_fast(ir_jit_segment_t *const segment,
+                                       ir_graph *const irg)
+{
+	/* Tier-1 pipeline: the steps invoked from the targets jit_compile
+	 * callback pick the fastest scheduler and register allocator while
+	 * the flag is set. */
+	jit_fast_codegen = true;
+	ir_jit_function_t *const res = jit_compile(segment, irg);
+	jit_fast_codegen = false;
+	return res;
+}
+
 void be_emit_function(char *const buffer, ir_jit_function_t *const function)
 {
 	ir_target.isa->emit_function(buffer, function);
 }
+
+int be_jit_finalize_segment(ir_jit_segment_t *const segment,
+                            char *const buffer)
+{
+	/* Emit all functions applying their relocations in one pass, then
+	 * flip the page protections with a single call. */
+	unsigned const size = be_get_segment_size(segment);
+	for (size_t i = 0, n = be_jit_segment_n_functions(segment); i < n; ++i) {
+		ir_jit_function_t *const function = be_jit_segment_function(segment, i);
+		ir_target.isa->emit_function(buffer + be_get_function_offset(function),
+		                             function);
+	}
+	return be_jit_protect_code(buffer, size);
+}
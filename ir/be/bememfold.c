@@ -0,0 +1,117 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Fold reloads into memory operands of their users
+ */
+#include "bememfold.h"
+
+#include "bearch.h"
+#include "bemodule.h"
+#include "besched.h"
+#include "debug.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
+
+/** Returns the unique value Proj of a reload, NULL if there is more than
+ * one (keeps us out of exotic reload constructions). */
+static ir_node *get_reload_value(ir_node *const reload)
+{
+	ir_node *res = NULL;
+	foreach_out_edge(reload, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (get_irn_mode(proj) == mode_M)
+			continue;
+		if (res != NULL)
+			return NULL;
+		res = proj;
+	}
+	return res;
+}
+
+/** The fold moves the load from the reload's schedule position to the
+ * user's. Spill slots are never address-taken, so the only instructions
+ * which could write to the slot in between are other spill stores. */
+static bool safe_to_fold(ir_node *const reload, ir_node *const user)
+{
+	for (ir_node *irn = sched_next(reload); irn != user;
+	     irn = sched_next(irn)) {
+		assert(!sched_is_end(irn));
+		if (arch_get_irn_flags(irn) & arch_irn_flag_spill)
+			return false;
+	}
+	return true;
+}
+
+/** Unlinks a folded reload: memory users skip to the reload's memory
+ * input, the (now unused) value Proj and the reload itself die. */
+static void remove_reload(ir_node *const reload, ir_node *const value)
+{
+	ir_node *mem = NULL;
+	foreach_irn_in(reload, i, in) {
+		if (get_irn_mode(in) == mode_M) {
+			mem = in;
+			break;
+		}
+	}
+	foreach_out_edge_safe(reload, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (get_irn_mode(proj) == mode_M) {
+			assert(mem != NULL);
+			exchange(proj, mem);
+		}
+	}
+	kill_node(value);
+	sched_remove(reload);
+	kill_node(reload);
+}
+
+static void fold_mem_operands_walker(ir_node *const block, void *const env)
+{
+	be_fold_reload_callback_t *const callback
+		= (be_fold_reload_callback_t*)env;
+
+	for (ir_node *reload = sched_first(block), *next;
+	     !sched_is_end(reload); reload = next) {
+		next = sched_next(reload);
+		if (!(arch_get_irn_flags(reload) & arch_irn_flag_reload))
+			continue;
+		ir_node *const proj = get_reload_value(reload);
+		if (proj == NULL || get_irn_n_edges(proj) != 1)
+			continue;
+		ir_edge_t const *const edge = get_irn_out_edge_first(proj);
+		ir_node         *const user = get_edge_src_irn(edge);
+		unsigned         const pos  = get_edge_src_pos(edge);
+		if (is_Phi(user) || get_nodes_block(user) != block)
+			continue;
+		if (!safe_to_fold(reload, user))
+			continue;
+		if (!callback(user, proj, pos))
+			continue;
+		DBG((dbg, LEVEL_1, "folded %+F into its user at input %u\n",
+		     reload, pos));
+		/* the callback replaced user in the schedule; recompute the
+		 * iterator before erasing the reload */
+		next = sched_next(reload);
+		remove_reload(reload, proj);
+	}
+}
+
+void be_fold_mem_operands(ir_graph *const irg,
+                          be_fold_reload_callback_t *const callback)
+{
+	irg_block_walk_graph(irg, NULL, fold_mem_operands_walker, (void*)callback);
+}
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_memfold)
+void be_init_memfold(void)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.be.memfold");
+}
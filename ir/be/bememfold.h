@@ -0,0 +1,41 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Fold reloads into memory operands of their users
+ */
+#ifndef FIRM_BE_BEMEMFOLD_H
+#define FIRM_BE_BEMEMFOLD_H
+
+#include <stdbool.h>
+
+#include "be_types.h"
+
+/**
+ * Type of the reload folding callback.
+ *
+ * @param node  the single user of the reloaded value
+ * @param proj  the reload result used by @p node
+ * @param pos   the input position of @p proj in @p node
+ *
+ * @return Whether the callback replaced @p node by a variant with a memory
+ *         operand. The reload itself is removed by the caller afterwards.
+ */
+typedef bool be_fold_reload_callback_t(ir_node *node, ir_node *proj, unsigned pos);
+
+/**
+ * Folds reload instructions into their users on targets which support
+ * memory operands. Spilling runs after instruction selection, so these
+ * pairs cannot be matched during the transform phase. For every reload
+ * whose value has exactly one user in the same block the backend callback
+ * may replace the user by a memory operand form; the reload is erased.
+ *
+ * @param irg       The graph to process
+ * @param callback  Backend-specific callback trying to fold one reload
+ */
+void be_fold_mem_operands(ir_graph *irg, be_fold_reload_callback_t *callback);
+
+#endif
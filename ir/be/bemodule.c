@@ -33,6 +33,7 @@ void be_init_chordal(void);
 void be_init_chordal_common(void);
 void be_init_chordal_main(void);
 void be_init_copyheur4(void);
+void be_init_copyheur5(void);
 void be_init_copyilp(void);
 void be_init_copyilp2(void);
 void be_init_copynone(void);
@@ -42,14 +43,17 @@ void be_init_dwarf(void);
 void be_init_listsched(void);
 void be_init_live(void);
 void be_init_loopana(void);
+void be_init_memfold(void);
 void be_init_pbqp(void);
 void be_init_pbqp_coloring(void);
 void be_init_peephole(void);
 void be_init_pref_alloc(void);
 void be_init_ra(void);
 void be_init_sched(void);
+void be_init_sched_cp(void);
 void be_init_sched_normal(void);
 void be_init_sched_rand(void);
+void be_init_sched_regpress(void);
 void be_init_sched_trivial(void);
 void be_init_spill(void);
 void be_init_spillbelady(void);
@@ -58,6 +62,7 @@ void be_init_spillslots(void);
 void be_init_ssaconstr(void);
 void be_init_state(void);
 
+void be_quit_arch(void);
 void be_quit_pbqp(void);
 
 /**
@@ -79,6 +84,7 @@ void be_init_modules(void)
 	be_init_dwarf();
 	be_init_live();
 	be_init_loopana();
+	be_init_memfold();
 	be_init_peephole();
 	be_init_ra();
 	be_init_sched();
@@ -98,8 +104,10 @@ void be_init_modules(void)
 	be_init_arch_TEMPLATE();
 
 	be_init_listsched();
+	be_init_sched_cp();
 	be_init_sched_normal();
 	be_init_sched_rand();
+	be_init_sched_regpress();
 	be_init_sched_trivial();
 
 	be_init_chordal_main();
@@ -112,6 +120,7 @@ void be_init_modules(void)
 	be_init_daemelspill();
 
 	be_init_copyheur4();
+	be_init_copyheur5();
 	be_init_copyilp2();
 	be_init_copynone();
 	be_init_copyilp();
@@ -123,6 +132,7 @@ void be_init_modules(void)
 
 void be_quit_modules(void)
 {
+	be_quit_arch();
 #ifdef FIRM_GRGEN_BE
 	be_quit_pbqp();
 #endif
@@ -202,6 +212,17 @@ static int dump_opt_module_vals(char *buf, size_t buflen, void *data)
 	return strlen(buf);
 }
 
+void *be_find_module_in_list(be_module_list_entry_t const *list_head,
+                             const char *name)
+{
+	for (be_module_list_entry_t const *module = list_head; module != NULL;
+	     module = module->next) {
+		if (streq(module->name, name))
+			return module->data;
+	}
+	return NULL;
+}
+
 /**
  * Add a new module to list.
  */
@@ -48,6 +48,10 @@ typedef struct be_module_list_entry_t be_module_list_entry_t;
 void be_add_module_to_list(be_module_list_entry_t **list_head, const char *name,
                            void *module);
 
+/** Returns the module registered under @p name or NULL if there is none. */
+void *be_find_module_in_list(be_module_list_entry_t const *list_head,
+                             const char *name);
+
 void be_add_module_list_opt(lc_opt_entry_t *grp, const char *name,
                             const char *description,
                             be_module_list_entry_t * const * first,
@@ -27,9 +27,20 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static be_lv_t *lv;
-static ir_node *current_node;
-ir_node       **register_values;
+static be_lv_t      *lv;
+static ir_node      *current_node;
+static ir_heights_t *heights;
+ir_node            **register_values;
+
+void be_peephole_set_heights(ir_heights_t *h)
+{
+	heights = h;
+}
+
+ir_heights_t *be_peephole_get_heights(void)
+{
+	return heights;
+}
 
 static void clear_reg_value(ir_node *node)
 {
@@ -95,6 +106,10 @@ static void be_peephole_before_exchange(const ir_node *old_node,
 	DB((dbg, LEVEL_1, "About to exchange and kill %+F with %+F\n", old_node,
 	    new_node));
 
+	if (heights != NULL)
+		heights_invalidate_block(heights,
+		                         get_nodes_block(skip_Proj_const(old_node)));
+
 	assert(sched_is_scheduled(skip_Proj_const(old_node)));
 	assert(sched_is_scheduled(skip_Proj(new_node)));
 
@@ -157,6 +172,8 @@ void be_peephole_replace(ir_node *const old, ir_node *const nw)
 
 ir_node *be_peephole_to_tuple(ir_node *const node)
 {
+	if (heights != NULL)
+		heights_invalidate_block(heights, get_nodes_block(node));
 	be_liveness_remove(lv, node);
 	set_irn_mode(node, mode_T);
 	ir_node *const res = be_new_Proj(node, 0);
@@ -192,15 +209,56 @@ static void process_block(ir_node *block, void *data)
 		clear_defs(current_node);
 		set_uses(current_node);
 
-		ir_op            *op            = get_irn_op(current_node);
+		ir_node          *node          = current_node;
+		ir_op            *op            = get_irn_op(node);
 		peephole_opt_func peephole_node = (peephole_opt_func)op->ops.generic;
-		if (peephole_node == NULL)
+		if (peephole_node != NULL) {
+			DB((dbg, LEVEL_2, "optimize %+F\n", node));
+			peephole_node(node);
+			assert(!is_Bad(current_node));
+		}
+
+		/* window rules only run when the single node rule left the node in
+		 * place */
+		if (current_node != node)
+			continue;
+		peephole_window_func window_func = (peephole_window_func)op->ops.generic1;
+		if (window_func != NULL) {
+			ir_node *window[BE_PEEPHOLE_MAX_WINDOW];
+			unsigned length = 0;
+			for (ir_node *n = node;
+			     !sched_is_end(n) && length < BE_PEEPHOLE_MAX_WINDOW;
+			     n = sched_next(n)) {
+				window[length++] = n;
+			}
+			DB((dbg, LEVEL_2, "optimize window at %+F (%u nodes)\n", node,
+			    length));
+			window_func(window, length);
+			assert(!is_Bad(current_node));
+		}
+	}
+}
+
+bool be_peephole_value_used_only_in(ir_node *const *window, unsigned length,
+                                    const ir_node *value)
+{
+	foreach_out_edge(value, edge) {
+		ir_node *src = get_edge_src_irn(edge);
+		/* ignore anchor and keep-alive edges */
+		if (is_Anchor(src) || is_End(src))
 			continue;
 
-		DB((dbg, LEVEL_2, "optimize %+F\n", current_node));
-		peephole_node(current_node);
-		assert(!is_Bad(current_node));
+		bool found = false;
+		for (unsigned i = 0; i < length; ++i) {
+			if (window[i] == src || window[i] == skip_Proj(src)) {
+				found = true;
+				break;
+			}
+		}
+		if (!found)
+			return false;
 	}
+	return true;
 }
 
 /**
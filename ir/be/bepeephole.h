@@ -31,6 +31,21 @@ static inline ir_node *be_peephole_get_reg_value(const arch_register_t *reg)
  */
 typedef void (*peephole_opt_func) (ir_node *node);
 
+/**
+ * Register a heights object that is kept up to date while peephole
+ * optimizations (and be_handle_2addr()) edit the schedule: every exchange
+ * or insertion invalidates the height data of the affected block, which is
+ * lazily recomputed on the next query.  Pass NULL to unregister the object
+ * before freeing it.
+ */
+void be_peephole_set_heights(ir_heights_t *heights);
+
+/**
+ * Returns the heights object registered with be_peephole_set_heights(),
+ * or NULL if there is none.
+ */
+ir_heights_t *be_peephole_get_heights(void);
+
 /**
  * When doing peephole optimization use this function instead of plain
  * exchange(), so it can update its internal state.  This function also removes
@@ -91,6 +106,39 @@ static inline void register_peephole_optimization(ir_op *const op, peephole_opt_
 	op->ops.generic = (op_func)func;
 }
 
+/** Maximum number of scheduled nodes a window callback gets to see. */
+#define BE_PEEPHOLE_MAX_WINDOW 4
+
+/**
+ * Datatype of a windowed optimization handler. @p window holds @p length
+ * (at least 1, at most BE_PEEPHOLE_MAX_WINDOW) consecutively scheduled
+ * nodes of one block; window[0] is the node the rule was registered for,
+ * the others follow it in schedule order and have already been visited by
+ * the backward walk. The handler may rewrite the matched nodes with the
+ * usual be_peephole_exchange()/be_peephole_replace() helpers.
+ */
+typedef void (*peephole_window_func)(ir_node *const *window, unsigned length);
+
+/**
+ * Register a windowed peephole optimization function for nodes of @p op.
+ * The window rule of a node runs after its single node rule, if both are
+ * registered.
+ */
+static inline void register_peephole_window_optimization(ir_op *const op,
+		peephole_window_func const func)
+{
+	assert(!op->ops.generic1);
+	op->ops.generic1 = (op_func)func;
+}
+
+/**
+ * Checks that all users of @p value are inside the window, i.e. that the
+ * value does not escape the matched instruction sequence. Keep-alive and
+ * anchor edges are ignored.
+ */
+bool be_peephole_value_used_only_in(ir_node *const *window, unsigned length,
+                                    const ir_node *value);
+
 /**
  * Do peephole optimizations. It traverses the schedule of all blocks in
  * backward direction. The register_values variable indicates which (live)
@@ -64,6 +64,7 @@
 #define NEIGHBOR_FACTOR                0.2f
 #define AFF_SHOULD_BE_SAME             0.5f
 #define AFF_PHI                        1.0f
+#define AFF_CLASS                      0.5f
 #define SPLIT_DELTA                    1.0f
 #define MAX_OPTIMISTIC_SPLIT_RECURSION 0
 
@@ -76,6 +77,8 @@ static be_lv_t                     *lv;
 static unsigned                     n_regs;
 static unsigned                    *normal_regs;
 static int                         *congruence_classes;
+static size_t                       n_congruence_idx;
+static float                      **class_biases;
 static ir_node                    **block_order;
 static size_t                       n_block_order;
 
@@ -467,7 +470,43 @@ static void combine_congruence_classes(void)
 	irg_block_walk_graph(irg, create_congruence_class, NULL, NULL);
 	/* merge preferences */
 	irg_walk_graph(irg, set_congruence_prefs, NULL, NULL);
+	/* the classes are kept during assignment for biased coloring */
+	n_congruence_idx = n;
+	class_biases     = XMALLOCNZ(float*, n);
+}
+
+static void free_congruence_classes(void)
+{
+	free(class_biases);
 	free(congruence_classes);
+	class_biases       = NULL;
+	congruence_classes = NULL;
+}
+
+/**
+ * Returns the register bias of the congruence class of @p node, creating
+ * it on first access. While the preferences merged by
+ * combine_congruence_classes() are static, the bias accumulates the
+ * registers actually assigned to class members, so later members are
+ * drawn towards the same register even when their defining blocks are far
+ * apart. Returns NULL for values outside any class (created during
+ * allocation and no copy of a pre-existing value).
+ */
+static float *get_class_bias(ir_node *node)
+{
+	const allocation_info_t *info = try_get_allocation_info(node);
+	if (info != NULL)
+		node = info->original_value;
+	unsigned idx = get_irn_idx(node);
+	if (idx >= n_congruence_idx)
+		return NULL;
+	idx = uf_find(congruence_classes, idx);
+	float *bias = class_biases[idx];
+	if (bias == NULL) {
+		bias = OALLOCNZ(&obst, float, n_regs);
+		class_biases[idx] = bias;
+	}
+	return bias;
 }
 
 
@@ -526,10 +565,13 @@ static int compare_reg_pref(const void *e1, const void *e2)
 }
 
 static void fill_sort_candidates(reg_pref_t *regprefs,
-                                 const allocation_info_t *info)
+                                 const allocation_info_t *info,
+                                 const float *bias)
 {
 	for (unsigned r = 0; r < n_regs; ++r) {
 		float pref = info->prefs[r];
+		if (bias != NULL)
+			pref += bias[r];
 		regprefs[r].num  = r;
 		regprefs[r].pref = pref;
 	}
@@ -563,7 +605,7 @@ static bool try_optimistic_split(ir_node *to_split, ir_node *before,
 
 	/* find the best free position where we could move to */
 	reg_pref_t *prefs = ALLOCAN(reg_pref_t, n_regs);
-	fill_sort_candidates(prefs, info);
+	fill_sort_candidates(prefs, info, get_class_bias(to_split));
 	unsigned i;
 	for (i = 0; i < n_regs; ++i) {
 		/* we need a normal register which is not an output register
@@ -674,8 +716,9 @@ static void assign_reg(ir_node const *const block, ir_node *const node, arch_reg
 
 	/* create list of register candidates and sort by their preference */
 	DB((dbg, LEVEL_2, "Candidates for %+F:", node));
+	float      *bias      = get_class_bias(node);
 	reg_pref_t *reg_prefs = ALLOCAN(reg_pref_t, n_regs);
-	fill_sort_candidates(reg_prefs, info);
+	fill_sort_candidates(reg_prefs, info, bias);
 	for (unsigned r = 0; r < n_regs; ++r) {
 		unsigned num = reg_prefs[r].num;
 		if (!rbitset_is_set(normal_regs, num))
@@ -701,7 +744,8 @@ static void assign_reg(ir_node const *const block, ir_node *const node, arch_reg
 			if (final_reg_index % width != 0)
 				continue;
 			bool fine = true;
-			for (unsigned r0 = r+1; r0 < r+width; ++r0) {
+			for (unsigned r0 = final_reg_index + 1;
+			     r0 < final_reg_index + width; ++r0) {
 				if (assignments[r0] != NULL)
 					fine = false;
 			}
@@ -728,6 +772,9 @@ static void assign_reg(ir_node const *const block, ir_node *const node, arch_reg
 	}
 
 	use_reg_idx(node, final_reg_index, width);
+	/* draw the remaining members of the congruence class to this register */
+	if (bias != NULL)
+		bias[final_reg_index] += (float)get_block_execfreq(block) * AFF_CLASS;
 	DB((dbg, LEVEL_2, "Assign %+F -> %s\n", node, arch_get_irn_register(node)->name));
 }
 
@@ -1396,12 +1443,15 @@ static void assign_phi_registers(ir_node *block)
 		adapt_phi_prefs(node);
 		/* add stuff to bipartite problem */
 		allocation_info_t *info = get_allocation_info(node);
+		const float       *bias = get_class_bias(node);
 		DB((dbg, LEVEL_3, "Prefs for %+F: ", node));
 		for (unsigned r = 0; r < n_regs; ++r) {
 			if (!rbitset_is_set(normal_regs, r))
 				continue;
 
 			float costs = info->prefs[r];
+			if (bias != NULL)
+				costs += bias[r];
 			costs = costs < 0 ? -logf(-costs+1) : logf(costs+1);
 			costs *= 100;
 			costs += 10000;
@@ -1432,6 +1482,9 @@ static void assign_phi_registers(ir_node *block)
 		unsigned r = assignment[n++];
 		assert(rbitset_is_set(normal_regs, r));
 		use_reg_idx(node, r, req->width);
+		float *const bias = get_class_bias(node);
+		if (bias != NULL)
+			bias[r] += (float)get_block_execfreq(block) * AFF_CLASS;
 		DB((dbg, LEVEL_2, "Assign %+F -> %s\n", node, arch_get_irn_register(node)->name));
 
 		/* adapt preferences for phi inputs */
@@ -1750,6 +1803,7 @@ static void be_pref_alloc_cls(void)
 		ir_node *block = block_order[i];
 		allocate_coalesce_block(block, NULL);
 	}
+	free_congruence_classes();
 
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
 }
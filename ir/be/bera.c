@@ -30,6 +30,18 @@ void be_allocate_registers(ir_graph *irg, const regalloc_if_t *regif)
 	selected_allocator(irg, regif);
 }
 
+void be_allocate_registers_fast(ir_graph *irg, const regalloc_if_t *regif)
+{
+	/* The preference guided allocator colors in one pass over the
+	 * dominance tree and does not run the copy optimizations of the
+	 * chordal allocator, which makes it the tier-1 JIT choice. */
+	allocate_func allocator
+		= (allocate_func)be_find_module_in_list(register_allocators, "pref");
+	if (allocator == NULL)
+		allocator = selected_allocator;
+	allocator(irg, regif);
+}
+
 BE_REGISTER_MODULE_CONSTRUCTOR(be_init_ra)
 void be_init_ra(void)
 {
@@ -54,6 +54,12 @@ struct regalloc_if_t {
  */
 void be_allocate_registers(ir_graph *irg, const regalloc_if_t *regif);
 
+/**
+ * Do register allocation with the fastest available allocator, trading
+ * code quality for compile time (used by the tier-1 JIT pipeline).
+ */
+void be_allocate_registers_fast(ir_graph *irg, const regalloc_if_t *regif);
+
 typedef void (*allocate_func)(ir_graph *irg, const regalloc_if_t *regif);
 
 void be_register_allocator(const char *name, allocate_func allocator);
@@ -156,6 +156,17 @@ void be_schedule_graph(ir_graph *irg)
 	scheduler(irg);
 }
 
+void be_schedule_graph_fast(ir_graph *irg)
+{
+	/* The trivial scheduler just emits the candidates in whatever order
+	 * they become ready, which is all a tier-1 JIT needs. */
+	schedule_func func
+		= (schedule_func)be_find_module_in_list(schedulers, "trivial");
+	if (func == NULL)
+		func = scheduler;
+	func(irg);
+}
+
 BE_REGISTER_MODULE_CONSTRUCTOR(be_init_sched)
 void be_init_sched(void)
 {
@@ -246,6 +246,12 @@ void be_register_scheduler(const char *name, schedule_func func);
  */
 void be_schedule_graph(ir_graph *irg);
 
+/**
+ * schedule a graph with the cheapest available scheduler, trading code
+ * quality for compile time (used by the tier-1 JIT pipeline).
+ */
+void be_schedule_graph_fast(ir_graph *irg);
+
 /**
  * Return the last schedule_first node following node, if there is any, node
  * otherwise.
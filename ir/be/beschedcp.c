@@ -0,0 +1,89 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Critical path node selector.
+ *
+ * Selects among the ready nodes the one with the greatest height, i.e. the
+ * one starting the longest data dependency chain to the end of the block.
+ * Ties are broken by the number of users inside the block, so nodes which
+ * unlock more work are scheduled first. This keeps long latency chains
+ * going and tends to expose more instruction level parallelism than the
+ * purely register pressure driven selectors.
+ */
+#include "belistsched.h"
+#include "bemodule.h"
+#include "besched.h"
+#include "heights.h"
+#include "iredges_t.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "irnodeset.h"
+
+static ir_heights_t *heights;
+
+/**
+ * Count the users of a node inside its own block. Scheduling a node with
+ * many block local users makes more nodes ready.
+ */
+static unsigned count_block_users(const ir_node *node)
+{
+	ir_node *block   = get_nodes_block(node);
+	unsigned n_users = 0;
+	foreach_out_edge(node, edge) {
+		ir_node *user = get_edge_src_irn(edge);
+		if (!is_Block(user) && get_nodes_block(user) == block)
+			++n_users;
+	}
+	return n_users;
+}
+
+static ir_node *cp_select(ir_nodeset_t *ready_set)
+{
+	ir_node *best        = NULL;
+	unsigned best_height = 0;
+	unsigned best_users  = 0;
+	foreach_ir_nodeset(ready_set, node, iter) {
+		unsigned const height  = get_irn_height(heights, node);
+		unsigned const n_users = count_block_users(node);
+		if (best == NULL
+		    || height > best_height
+		    || (height == best_height && n_users > best_users)
+		    || (height == best_height && n_users == best_users
+		        && get_irn_idx(node) < get_irn_idx(best))) {
+			best        = node;
+			best_height = height;
+			best_users  = n_users;
+		}
+	}
+	return best;
+}
+
+static void cp_sched_block(ir_node *block, void *data)
+{
+	(void)data;
+	ir_nodeset_t *cands = be_list_sched_begin_block(block);
+	while (ir_nodeset_size(cands) > 0) {
+		ir_node *node = cp_select(cands);
+		be_list_sched_schedule(node);
+	}
+	be_list_sched_end_block();
+}
+
+static void sched_cp(ir_graph *irg)
+{
+	heights = heights_new(irg);
+	be_list_sched_begin(irg);
+	irg_block_walk_graph(irg, cp_sched_block, NULL, NULL);
+	be_list_sched_finish();
+	heights_free(heights);
+}
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_sched_cp)
+void be_init_sched_cp(void)
+{
+	be_register_scheduler("cp", sched_cp);
+}
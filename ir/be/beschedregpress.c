@@ -0,0 +1,149 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Register pressure aware node selector.
+ *
+ * Greedy list scheduling which picks from the ready set the node that
+ * reduces the number of live values the most: operands whose last
+ * unscheduled user is the candidate die, results are born. Ties are
+ * broken in favour of the node with the larger height so the critical
+ * path is not needlessly stretched.
+ */
+#include "bearch.h"
+#include "belistsched.h"
+#include "bemodule.h"
+#include "besched.h"
+#include "heights.h"
+#include "iredges_t.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "irnodeset.h"
+#include <stdlib.h>
+
+static ir_heights_t *heights;
+
+static bool is_data_value(const ir_node *node)
+{
+	ir_mode *mode = get_irn_mode(node);
+	if (mode == mode_M || mode == mode_X || mode == mode_T)
+		return false;
+	return !arch_irn_is_ignore(node);
+}
+
+/**
+ * Check whether value @p value dies when @p node is scheduled, i.e.
+ * @p node is the only remaining unscheduled user in the block and the
+ * value is not used in another block.
+ */
+static bool value_dies_at(const ir_node *value, const ir_node *node)
+{
+	ir_node *block = get_nodes_block(node);
+	foreach_out_edge(value, edge) {
+		ir_node *user = get_edge_src_irn(edge);
+		if (user == node)
+			continue;
+		if (is_Anchor(user))
+			continue;
+		/* users in other blocks keep the value live */
+		if (get_nodes_block(user) != block)
+			return false;
+		/* Phis use their operands at the end of the predecessor block */
+		if (is_Phi(user))
+			continue;
+		if (!sched_is_scheduled(user))
+			return false;
+	}
+	return true;
+}
+
+/** Number of values defined by @p node (for mode_T via its Projs). */
+static int count_births(const ir_node *node)
+{
+	if (get_irn_mode(node) == mode_T) {
+		int births = 0;
+		foreach_out_edge(node, edge) {
+			ir_node *proj = get_edge_src_irn(edge);
+			if (is_Proj(proj) && is_data_value(proj))
+				++births;
+		}
+		return births;
+	}
+	return is_data_value(node) ? 1 : 0;
+}
+
+/** Number of operands of @p node whose live range ends at @p node. */
+static int count_deaths(const ir_node *node)
+{
+	int deaths = 0;
+	foreach_irn_in(node, i, op) {
+		if (!is_data_value(op))
+			continue;
+		/* don't count repeated operands twice */
+		bool repeated = false;
+		for (int j = 0; j < i; ++j) {
+			if (get_irn_n(node, j) == op) {
+				repeated = true;
+				break;
+			}
+		}
+		if (repeated)
+			continue;
+		if (value_dies_at(op, node))
+			++deaths;
+	}
+	return deaths;
+}
+
+/**
+ * Select the ready node freeing the most registers.
+ */
+static ir_node *regpress_select(ir_nodeset_t *ready_set)
+{
+	ir_node *best         = NULL;
+	int      best_benefit = 0;
+	unsigned best_height  = 0;
+	foreach_ir_nodeset(ready_set, irn, iter) {
+		int      benefit = count_deaths(irn) - count_births(irn);
+		unsigned height  = get_irn_height(heights, irn);
+		if (best == NULL || benefit > best_benefit
+		    || (benefit == best_benefit
+		        && (height > best_height
+		            || (height == best_height
+		                && get_irn_idx(irn) < get_irn_idx(best))))) {
+			best         = irn;
+			best_benefit = benefit;
+			best_height  = height;
+		}
+	}
+	return best;
+}
+
+static void sched_block(ir_node *block, void *data)
+{
+	(void)data;
+	ir_nodeset_t *cands = be_list_sched_begin_block(block);
+	while (ir_nodeset_size(cands) > 0) {
+		ir_node *node = regpress_select(cands);
+		be_list_sched_schedule(node);
+	}
+	be_list_sched_end_block();
+}
+
+static void sched_regpress(ir_graph *irg)
+{
+	heights = heights_new(irg);
+	be_list_sched_begin(irg);
+	irg_block_walk_graph(irg, sched_block, NULL, NULL);
+	be_list_sched_finish();
+	heights_free(heights);
+}
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_sched_regpress)
+void be_init_sched_regpress(void)
+{
+	be_register_scheduler("regpress", sched_regpress);
+}
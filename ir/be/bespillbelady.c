@@ -75,6 +75,8 @@ static workset_t                   *temp_workset;
 static bool                         move_spills      = true;
 static bool                         respectloopdepth = true;
 static bool                         improve_known_preds = true;
+static bool                         split_loop_ranges = true;
+static bool                         loop_global_uses = true;
 /* factor to weight the different costs of reloading/rematerializing a node
    (see bespill.h be_get_reload_costs_no_weight) */
 static int                          remat_bonus      = 10;
@@ -83,6 +85,8 @@ static const lc_opt_table_entry_t options[] = {
 	LC_OPT_ENT_BOOL   ("movespills", "try to move spills out of loops", &move_spills),
 	LC_OPT_ENT_BOOL   ("respectloopdepth", "outermost loop cutting", &respectloopdepth),
 	LC_OPT_ENT_BOOL   ("improveknownpreds", "known preds cutting", &improve_known_preds),
+	LC_OPT_ENT_BOOL   ("splitloopranges", "prefer disposing values next used outside the current loop", &split_loop_ranges),
+	LC_OPT_ENT_BOOL   ("loopglobaluses", "consider uses in the whole loop when deciding loop header worksets", &loop_global_uses),
 	LC_OPT_ENT_INT    ("rematbonus", "give bonus to rematerialisable nodes", &remat_bonus),
 	LC_OPT_LAST
 };
@@ -276,6 +280,20 @@ static unsigned get_distance(ir_node *from, const ir_node *def,
 		time += 1000 - (costs * remat_bonus);
 	}
 
+	/* Values whose next use lies outside the current loop are the cheapest
+	 * to dispose at a pressure spike (typically a call site): their reload
+	 * is executed at most once per loop execution instead of once per
+	 * iteration, effectively splitting their live range at the loop
+	 * boundary while loop-hot values stay in registers. */
+	if (split_loop_ranges) {
+		unsigned depth = get_loop_depth(get_irn_loop(get_nodes_block(from)));
+		if (use.outermost_loop < depth) {
+			time += 10000 * (depth - use.outermost_loop);
+			if (time >= USES_PENDING)
+				time = USES_PENDING - 1;
+		}
+	}
+
 	return time;
 }
 
@@ -397,11 +415,48 @@ static available_t available_in_all_preds(workset_t* const* pred_worksets,
 	return available;
 }
 
+/**
+ * Determines whether @p other is @p loop itself or nested inside it.
+ */
+static bool loop_contains(const ir_loop *loop, const ir_loop *other)
+{
+	unsigned const depth = get_loop_depth(loop);
+	for (; other != NULL && get_loop_depth(other) >= depth;
+	     other = get_loop_outer_loop(other)) {
+		if (other == loop)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Checks whether @p def has a use somewhere inside @p loop. Unlike the
+ * next-use distance this is not restricted to the nearest use, so it
+ * spots values needed again in every iteration even when their next use
+ * lies behind the current position. Phi uses count at the end of the
+ * respective predecessor block.
+ */
+static bool used_in_loop(const ir_loop *loop, const ir_node *def)
+{
+	foreach_out_edge(def, edge) {
+		ir_node *node = get_edge_src_irn(edge);
+		if (is_Anchor(node))
+			continue;
+		ir_node *block = get_nodes_block(node);
+		if (is_Phi(node))
+			block = get_Block_cfgpred_block(block, get_edge_src_pos(edge));
+		if (loop_contains(loop, get_irn_loop(block)))
+			return true;
+	}
+	return false;
+}
+
 /**
  * Decides whether a specific node should be in the start workset or not
  */
 static loc_t to_take_or_not_to_take(ir_node* first, ir_node *node,
-                                    ir_loop *loop, unsigned available)
+                                    ir_loop *loop, unsigned available,
+                                    bool loop_head)
 {
 	loc_t loc;
 	loc.time    = USES_INFINITY;
@@ -431,10 +486,18 @@ static loc_t to_take_or_not_to_take(ir_node* first, ir_node *node,
 			    node, loc.time));
 			return loc;
 		} else if (available == AVAILABLE_NOWHERE) {
-			DB((dbg, DBG_START, "    %+F not taken (%u, live in no pred)\n",
-			    node, loc.time));
-			loc.time = USES_INFINITY;
-			return loc;
+			/* A value live in no predecessor must be reloaded anyway.
+			 * Still take it at a loop head if it is used inside the loop:
+			 * the reloads then sit on the entry edges instead of being
+			 * executed again in every iteration. */
+			if (!loop_global_uses || !loop_head || !used_in_loop(loop, node)) {
+				DB((dbg, DBG_START, "    %+F not taken (%u, live in no pred)\n",
+				    node, loc.time));
+				loc.time = USES_INFINITY;
+				return loc;
+			}
+			DB((dbg, DBG_START, "    %+F considered anyway (used in loop)\n",
+			    node));
 		}
 	}
 
@@ -482,7 +545,14 @@ static void decide_start_workset(ir_node *const block)
 	ir_node *first = sched_first(block);
 
 	/* check all Phis first */
-	ir_loop *loop = get_irn_loop(block);
+	ir_loop *loop      = get_irn_loop(block);
+	bool     loop_head = false;
+	for (int i = 0; i < n_cfgpreds; ++i) {
+		if (is_backedge(block, i)) {
+			loop_head = true;
+			break;
+		}
+	}
 	sched_foreach_phi(block, node) {
 		if (!arch_irn_consider_in_reg_alloc(cls, node))
 			continue;
@@ -493,7 +563,8 @@ static void decide_start_workset(ir_node *const block)
 			                                   node, true);
 		}
 
-		loc_t loc = to_take_or_not_to_take(first, node, loop, available);
+		loc_t loc = to_take_or_not_to_take(first, node, loop, available,
+		                                   loop_head);
 		if (!USES_IS_INFINITE(loc.time)) {
 			if (USES_IS_PENDING(loc.time))
 				ARR_APP1(loc_t, delayed, loc);
@@ -512,7 +583,8 @@ static void decide_start_workset(ir_node *const block)
 			                                   node, false);
 		}
 
-		loc_t loc = to_take_or_not_to_take(first, node, loop, available);
+		loc_t loc = to_take_or_not_to_take(first, node, loop, available,
+		                                   loop_head);
 		if (!USES_IS_INFINITE(loc.time)) {
 			if (USES_IS_PENDING(loc.time))
 				ARR_APP1(loc_t, delayed, loc);
@@ -533,6 +605,17 @@ static void decide_start_workset(ir_node *const block)
 	DB((dbg, DBG_START, "Loop pressure %d, taking %d delayed vals\n",
 	    pressure, free_slots));
 	if (free_slots > 0) {
+		/* All delayed values carry the pending marker as their time, so
+		 * sorting them used to degenerate to node number order. Rank them
+		 * by their real next-use distance instead, so the free slots go to
+		 * the values reloaded first after the loop. */
+		if (loop_global_uses) {
+			for (size_t i = 0; i < ARR_LEN(delayed); ++i) {
+				be_next_use_t use = be_get_next_use(uses, first,
+				                                    delayed[i].node, false);
+				delayed[i].time = use.time;
+			}
+		}
 		QSORT_ARR(delayed, loc_compare);
 
 		for (size_t i = 0; i < ARR_LEN(delayed) && free_slots > 0; ++i) {
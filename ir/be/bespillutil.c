@@ -16,12 +16,14 @@
 #include "bearch.h"
 #include "bechordal_t.h"
 #include "beirg.h"
+#include "belive.h"
 #include "bemodule.h"
 #include "benode.h"
 #include "besched.h"
 #include "bespill.h"
 #include "bessaconstr.h"
 #include "beutil.h"
+#include "beverify.h"
 #include "debug.h"
 #include "execfreq.h"
 #include "ident_t.h"
@@ -43,6 +45,11 @@ DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 DEBUG_ONLY(static firm_dbg_module_t *dbg_constr;)
 
 #define REMAT_COST_INFINITE  1000
+/** maximum number of operand chains rematerialized along with a node */
+#define REMAT_MAX_ARG_CHAINS    2
+/** extra cost per additional rematerialized operand chain (they are live
+ * simultaneously and thus raise register pressure) */
+#define REMAT_ARG_PRESSURE_COST 1
 
 typedef struct reloader_t reloader_t;
 struct reloader_t {
@@ -387,11 +394,17 @@ static int check_remat_conditions_costs(spill_env_t *env,
 
 		/* we have to rematerialize the argument as well */
 		++argremats;
-		if (argremats > 1) {
-			/* we only support rematerializing 1 argument at the moment,
-			 * as multiple arguments could increase register pressure */
+		if (argremats > REMAT_MAX_ARG_CHAINS) {
+			/* each rematerialized operand chain is live at the same time
+			 * and increases register pressure, so bound their number */
 			return REMAT_COST_INFINITE;
 		}
+		if (argremats > 1) {
+			/* charge additional chains a pressure penalty so only cheap
+			 * expressions like address computations from base+offset
+			 * constants qualify */
+			costs += REMAT_ARG_PRESSURE_COST;
+		}
 
 		costs += check_remat_conditions_costs(env, arg, reloader,
 		                                      parentcosts + costs);
@@ -432,6 +445,16 @@ static ir_node *do_remat(spill_env_t *env, ir_node *spilled, ir_node *reloader)
 	if (!is_Proj(res))
 		sched_add_before(reloader, res);
 
+	/* The remat uses its operands at the reload position, which may extend
+	 * their live ranges. Patch the liveness info accordingly. */
+	be_lv_t *const lv = be_get_irg_liveness(env->irg);
+	if (lv->sets_valid) {
+		foreach_irn_in(res, i, in) {
+			if (is_liveness_node(in))
+				be_liveness_update(lv, in);
+		}
+	}
+
 	return res;
 }
 
@@ -540,6 +563,8 @@ void be_insert_spills_reloads(spill_env_t *env)
 {
 	be_timer_push(T_RA_SPILL_APPLY);
 
+	be_lv_t *const lv = be_get_irg_liveness(env->irg);
+
 	/* create all phi-ms first, this is needed so, that phis, hanging on
 	   spilled phis work correctly */
 	for (spill_info_t *info = env->mem_phis; info != NULL;
@@ -547,6 +572,12 @@ void be_insert_spills_reloads(spill_env_t *env)
 		spill_node(env, info);
 	}
 
+	/* share one SSA construction environment over all spilled nodes, a
+	 * reset between the values is much cheaper than a fresh environment */
+	be_ssa_construction_env_t senv;
+	be_ssa_construction_init(&senv, env->irg);
+	bool senv_used = false;
+
 	/* process each spilled node */
 	for (spill_info_t *si = env->spills; si != NULL; si = si->next) {
 		ir_node  *to_spill        = si->to_spill;
@@ -632,17 +663,24 @@ void be_insert_spills_reloads(spill_env_t *env)
 		/* if we had any reloads or remats, then we need to reconstruct the
 		 * SSA form for the spilled value */
 		if (ARR_LEN(copies) > 0) {
-			be_ssa_construction_env_t senv;
-			be_ssa_construction_init(&senv, env->irg);
+			if (senv_used)
+				be_ssa_construction_reset(&senv);
+			senv_used = true;
 			be_ssa_construction_add_copy(&senv, to_spill);
 			be_ssa_construction_add_copies(&senv, copies, ARR_LEN(copies));
 			be_ssa_construction_fix_users(&senv, to_spill);
-			be_ssa_construction_destroy(&senv);
+			if (lv->sets_valid) {
+				be_ssa_construction_update_liveness_phis(&senv, lv);
+				for (size_t i = 0, n = ARR_LEN(copies); i < n; ++i) {
+					be_liveness_introduce(lv, copies[i]);
+				}
+			}
 		}
 		/* need to reconstruct SSA form if we had multiple spills */
 		if (si->spills != NULL && si->spills->next != NULL) {
-			be_ssa_construction_env_t senv;
-			be_ssa_construction_init(&senv, env->irg);
+			if (senv_used)
+				be_ssa_construction_reset(&senv);
+			senv_used = true;
 			unsigned spill_count = 0;
 			for (spill_t *spill = si->spills ; spill != NULL;
 			     spill = spill->next) {
@@ -657,21 +695,37 @@ void be_insert_spills_reloads(spill_env_t *env)
 				be_ssa_construction_fix_users(&senv, si->spills->spill);
 			}
 
-			be_ssa_construction_destroy(&senv);
+			if (lv->sets_valid)
+				be_ssa_construction_update_liveness_phis(&senv, lv);
+		}
+
+		/* The live range of the spilled value changed (uses were rerouted to
+		 * the copies) and the spill memory values gained uses: patch the
+		 * liveness sets instead of forcing a full recomputation later. */
+		if (lv->sets_valid) {
+			be_liveness_update(lv, to_spill);
+			for (spill_t *spill = si->spills; spill != NULL;
+			     spill = spill->next) {
+				if (spill->spill != NULL)
+					be_liveness_update(lv, spill->spill);
+			}
 		}
 
 		DEL_ARR_F(copies);
 		si->reloaders = NULL;
 	}
+	be_ssa_construction_destroy(&senv);
 
 	stat_ev_dbl("spill_spills", env->spill_count);
 	stat_ev_dbl("spill_reloads", env->reload_count);
 	stat_ev_dbl("spill_remats", env->remat_count);
 	stat_ev_dbl("spill_spilled_phis", env->spilled_phi_count);
 
-	/* Matze: In theory be_ssa_construction should take care of the liveness...
-	 * try to disable this again in the future */
-	be_invalidate_live_sets(env->irg);
+	/* The liveness sets were patched above while inserting spills, reloads
+	 * and remats, so the expensive recomputation before coloring is not
+	 * necessary anymore. */
+	if (lv->sets_valid && be_options.do_verify)
+		be_liveness_check(lv);
 
 	be_remove_dead_nodes_from_schedule(env->irg);
 
@@ -1012,6 +1066,10 @@ void be_spill_prepare_for_constraints(ir_graph *irg)
 
 	irg_block_walk_graph(irg, NULL, assure_constraints_walker, &cenv);
 
+	be_ssa_construction_env_t senv;
+	be_ssa_construction_init(&senv, irg);
+	bool senv_used = false;
+
 	/* for all */
 	ir_nodehashmap_iterator_t map_iter;
 	ir_nodehashmap_entry_t    map_entry;
@@ -1023,12 +1081,12 @@ void be_spill_prepare_for_constraints(ir_graph *irg)
 		DBG((dbg_constr, LEVEL_1, "introduce %zu copies for %+F\n", n_copies, map_entry.node));
 
 		/* introduce the copies for the operand and its copies */
-		be_ssa_construction_env_t senv;
-		be_ssa_construction_init(&senv, irg);
+		if (senv_used)
+			be_ssa_construction_reset(&senv);
+		senv_used = true;
 		be_ssa_construction_add_copy(&senv, map_entry.node);
 		be_ssa_construction_add_copies(&senv, copies, n_copies);
 		be_ssa_construction_fix_users(&senv, map_entry.node);
-		be_ssa_construction_destroy(&senv);
 
 		/* Could be that not all CopyKeeps are really needed,
 		 * so we transform unnecessary ones into Keeps. */
@@ -1047,6 +1105,7 @@ void be_spill_prepare_for_constraints(ir_graph *irg)
 
 		DEL_ARR_F(copies);
 	}
+	be_ssa_construction_destroy(&senv);
 
 	ir_nodehashmap_destroy(&cenv.op_set);
 	obstack_free(&cenv.obst, NULL);
@@ -86,6 +86,7 @@ static constr_info *get_or_set_info(be_ssa_construction_env_t *env,
 	if (info == NULL) {
 		info = OALLOCZ(&env->obst, constr_info);
 		ir_nodemap_insert(&env->infos, node, info);
+		ARR_APP1(ir_node*, env->touched, (ir_node*)node);
 	}
 	return info;
 }
@@ -170,7 +171,8 @@ static void mark_iterated_dominance_frontiers(be_ssa_construction_env_t *env)
 	while (!deq_empty(&env->worklist)) {
 		ir_node  *block    = deq_pop_pointer_left(ir_node, &env->worklist);
 		ir_node **domfront = ir_get_dominance_frontier(block);
-		for (size_t i = 0, len = ARR_LEN(domfront); i < len; ++i) {
+		size_t    len      = ir_get_dominance_frontier_size(block);
+		for (size_t i = 0; i < len; ++i) {
 			ir_node *y = domfront[i];
 			if (Block_block_visited(y))
 				continue;
@@ -360,6 +362,7 @@ void be_ssa_construction_init(be_ssa_construction_env_t *env, ir_graph *irg)
 	memset(env, 0, sizeof(env[0]));
 	env->irg       = irg;
 	env->new_phis  = NEW_ARR_F(ir_node*, 0);
+	env->touched   = NEW_ARR_F(ir_node*, 0);
 	deq_init(&env->worklist);
 	ir_nodemap_init(&env->infos, irg);
 	obstack_init(&env->obst);
@@ -378,12 +381,34 @@ void be_ssa_construction_init(be_ssa_construction_env_t *env, ir_graph *irg)
 	inc_irg_block_visited(irg);
 }
 
+void be_ssa_construction_reset(be_ssa_construction_env_t *env)
+{
+	assert(deq_empty(&env->worklist));
+
+	/* only clear the map entries of the previous round instead of the
+	 * whole (graph sized) map */
+	for (size_t i = 0, n = ARR_LEN(env->touched); i < n; ++i)
+		ir_nodemap_insert_fast(&env->infos, env->touched[i], NULL);
+	ARR_SHRINKLEN(env->touched, 0);
+	ARR_SHRINKLEN(env->new_phis, 0);
+	obstack_free(&env->obst, NULL);
+	obstack_init(&env->obst);
+
+	env->phi_req                      = NULL;
+	env->iterated_domfront_calculated = false;
+
+	/* get fresh visited epochs, the dominance information stays valid */
+	inc_irg_visited(env->irg);
+	inc_irg_block_visited(env->irg);
+}
+
 void be_ssa_construction_destroy(be_ssa_construction_env_t *env)
 {
 	stat_ev_int("bessaconstr_phis", ARR_LEN(env->new_phis));
 	obstack_free(&env->obst, NULL);
 	ir_nodemap_destroy(&env->infos);
 	deq_free(&env->worklist);
+	DEL_ARR_F(env->touched);
 	DEL_ARR_F(env->new_phis);
 
 	ir_free_resources(env->irg, IR_RESOURCE_IRN_VISITED
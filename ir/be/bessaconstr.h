@@ -48,6 +48,9 @@ typedef struct be_ssa_construction_env_t {
 	ir_node                    **new_phis;
 	bool                         iterated_domfront_calculated;
 	ir_nodemap                   infos;
+	/** All nodes with an entry in @c infos, so a reset only has to clear
+	 * the entries actually used. */
+	ir_node                    **touched;
 	struct obstack               obst;
 } be_ssa_construction_env_t;
 
@@ -59,6 +62,15 @@ typedef struct be_ssa_construction_env_t {
  */
 void be_ssa_construction_init(be_ssa_construction_env_t *env, ir_graph *irg);
 
+/**
+ * Prepares the environment for the reconstruction of another, independent
+ * value. In contrast to a destroy/init pair this reuses the allocated maps
+ * and keeps the analysis info valid, so batching many reconstructions (as
+ * the spillers do, one per spilled value) stays linear in the touched nodes
+ * instead of the graph size.
+ */
+void be_ssa_construction_reset(be_ssa_construction_env_t *env);
+
 void be_ssa_construction_add_copy(be_ssa_construction_env_t *env,
                                   ir_node *value);
 
@@ -177,6 +177,43 @@ void be_fix_stack_nodes(ir_graph *const irg, arch_register_t const *const sp)
 	}
 }
 
+/**
+ * Determine size and alignment of a frame member, the same way
+ * be_layout_frame_type() does when placing it.
+ */
+static void get_member_layout_req(ir_entity const *const member,
+                                  unsigned *const size,
+                                  unsigned *const alignment)
+{
+	*alignment = get_entity_alignment(member);
+	if (member->kind == IR_ENTITY_SPILLSLOT) {
+		*size = member->attr.spillslot.size;
+	} else {
+		ir_type const *const type = get_entity_type(member);
+		*size      = get_type_size(type);
+		*alignment = MAX(*alignment, get_type_alignment(type));
+	}
+}
+
+/**
+ * Order two frame members within their group so that the sequential
+ * layout packs them densely: larger alignments first, larger sizes
+ * second, so small members fill up behind big ones instead of
+ * introducing padding before them.
+ */
+static int cmp_member_packing(ir_entity const *const e0,
+                              ir_entity const *const e1)
+{
+	unsigned size0, align0, size1, align1;
+	get_member_layout_req(e0, &size0, &align0);
+	get_member_layout_req(e1, &size1, &align1);
+	if (align0 != align1)
+		return QSORT_CMP(align1, align0);
+	if (size0 != size1)
+		return QSORT_CMP(size1, size0);
+	return 0;
+}
+
 static int cmp_slots_last(void const *const p0, void const *const p1)
 {
 	ir_entity const *const e0 = *(ir_entity const**)p0;
@@ -187,6 +224,9 @@ static int cmp_slots_last(void const *const p0, void const *const p1)
 	} else if (e1->kind == IR_ENTITY_SPILLSLOT)
 		return 1;
 
+	int const cmp = cmp_member_packing(e0, e1);
+	if (cmp != 0)
+		return cmp;
 	return QSORT_CMP(e1->nr, e0->nr);
 }
 
@@ -200,6 +240,9 @@ static int cmp_slots_first(void const *const p0, void const *const p1)
 	} else if (e1->kind == IR_ENTITY_SPILLSLOT)
 		return -1;
 
+	int const cmp = cmp_member_packing(e0, e1);
+	if (cmp != 0)
+		return cmp;
 	return QSORT_CMP(e0->nr, e1->nr);
 }
 
@@ -19,9 +19,11 @@
 #include "cgana.h"
 #include "debug.h"
 #include "execfreq_t.h"
+#include "firm_threads.h"
 #include "heights.h"
 #include "irargs_t.h"
 #include "ircons_t.h"
+#include "irconsconfirm.h"
 #include "iredges_t.h"
 #include "irgmod.h"
 #include "irgraph_t.h"
@@ -35,6 +37,8 @@
 #include "irtools.h"
 #include "panic.h"
 #include "pdeq.h"
+#include "pmap.h"
+#include "typerep.h"
 #include "util.h"
 #include "vrp.h"
 
@@ -321,10 +325,11 @@ void be_transform_graph(ir_graph *irg, arch_pretrans_nodes *func)
 {
 	/* create a new obstack */
 	struct obstack old_obst = irg->obst;
-	obstack_init(&irg->obst);
+	irg_init_obstack(irg);
 	irg->last_node_idx = 0;
 
 	free_vrp_data(irg);
+	free_value_facts(irg);
 
 	/* create new value table for CSE */
 	new_identities(irg);
@@ -952,3 +957,57 @@ unsigned be_get_out_for_reg(ir_node const *const node, arch_register_t const *co
 	}
 	panic("register requirement not found");
 }
+
+/** Maps tarvals to entities holding them as initialized constant data. */
+static pmap *tarval_entities;
+
+/** Protects tarval_entities when codegen runs on worker threads. */
+static firm_mutex_t tarval_entities_lock;
+
+void be_init_tarval_entities(void)
+{
+	tarval_entities = pmap_create();
+	firm_mutex_init(&tarval_entities_lock);
+}
+
+void be_free_tarval_entities(void)
+{
+	firm_mutex_destroy(&tarval_entities_lock);
+	pmap_destroy(tarval_entities);
+	tarval_entities = NULL;
+}
+
+ir_entity *be_create_tarval_entity(ir_tarval *const tv)
+{
+	firm_mutex_lock(&tarval_entities_lock);
+	ir_entity *entity = pmap_get(ir_entity, tarval_entities, tv);
+	if (entity == NULL) {
+		ir_mode *mode = get_tarval_mode(tv);
+		ir_type *type = get_type_for_mode(mode);
+		ir_type *glob = get_glob_type();
+
+		/* Tarval entities are shared between graphs, so a counter-based
+		 * name would depend on which worker thread sees the value first.
+		 * Name the entity after the value instead; that is unique per
+		 * tarval and reproducible. */
+		char   name[64];
+		size_t len = (size_t)snprintf(name, sizeof(name), "C_%s_",
+		                              get_mode_name(mode));
+		for (unsigned i = 0, n = get_mode_size_bytes(mode);
+		     i < n && len + 3 < sizeof(name); ++i) {
+			len += (size_t)snprintf(&name[len], sizeof(name) - len, "%02x",
+			                        get_tarval_sub_bits(tv, i));
+		}
+
+		entity = new_global_entity(glob, new_id_from_str(name), type,
+		                           ir_visibility_private,
+		                           IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
+
+		ir_initializer_t *initializer = create_initializer_tarval(tv);
+		set_entity_initializer(entity, initializer);
+
+		pmap_insert(tarval_entities, tv, entity);
+	}
+	firm_mutex_unlock(&tarval_entities_lock);
+	return entity;
+}
@@ -199,4 +199,14 @@ static inline bool be_mode_needs_gp_reg(ir_mode *const mode)
  */
 unsigned be_get_out_for_reg(ir_node const *node, arch_register_t const *reg);
 
+/**
+ * Return a private constant entity holding @p tv, creating it on first
+ * request. Tarvals are interned, so identical constants share one entity
+ * program wide. Call be_init_tarval_entities() before the first request.
+ */
+ir_entity *be_create_tarval_entity(ir_tarval *tv);
+
+void be_init_tarval_entities(void);
+void be_free_tarval_entities(void);
+
 #endif
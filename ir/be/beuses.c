@@ -16,6 +16,7 @@
 #include "benode.h"
 #include "besched.h"
 #include "debug.h"
+#include "hashptr.h"
 #include "ircons_t.h"
 #include "irdom_t.h"
 #include "iredges_t.h"
@@ -49,8 +49,6 @@
 #include "target_t.h"
 #include "x86_x87.h"
 
-pmap *ia32_tv_ent; /**< A map of entities that store const tarvals */
-
 ir_mode *ia32_mode_fpcw;
 ir_mode *ia32_mode_flags;
 ir_mode *ia32_mode_gp;
@@ -1350,6 +1348,8 @@ static void ia32_init(void)
 	                                   ir_overflow_indefinite);
 
 	ir_target.fast_unaligned_memaccess = true;
+	ir_target.am_scale_limit           = 3;
+	ir_target.mux_latency              = 2;
 	ir_target.allow_ifconv             = ia32_is_mux_allowed;
 	ir_target.float_int_overflow       = ir_overflow_indefinite;
 	ir_platform_set_va_list_type_pointer();
@@ -1414,7 +1414,7 @@ static bool lower_for_emit(ir_graph *const irg, const unsigned *const sp_is_non_
 
 static void ia32_generate_code(FILE *output, const char *cup_name)
 {
-	ia32_tv_ent = pmap_create();
+	be_init_tarval_entities();
 
 	be_begin(output, cup_name);
 	unsigned *const sp_is_non_ssa = rbitset_alloca(N_IA32_REGISTERS);
@@ -1434,7 +1434,7 @@ static void ia32_generate_code(FILE *output, const char *cup_name)
 	ia32_emit_thunks();
 
 	be_finish();
-	pmap_destroy(ia32_tv_ent);
+	be_free_tarval_entities();
 }
 
 static ir_jit_function_t *ia32_jit_compile(ir_jit_segment_t *const segment,
@@ -28,8 +28,6 @@ typedef struct ia32_irg_data_t {
 	ir_node *get_eip;        /**< get eip node */
 } ia32_irg_data_t;
 
-extern pmap *ia32_tv_ent; /**< A map of entities that store const tarvals */
-
 /** The mode for the floating point control word. */
 extern ir_mode *ia32_mode_fpcw;
 extern ir_mode *ia32_mode_gp;
@@ -587,7 +587,7 @@ x86_condition_code_t ia32_determine_final_cc(ir_node const *const node,
 static void ia32_emit_exc_label(const ir_node *node)
 {
 	be_emit_string(be_gas_insn_label_prefix());
-	be_emit_irprintf("%lu", get_ia32_exc_label_id(node));
+	be_emit_ulong(get_ia32_exc_label_id(node));
 }
 
 static void emit_jmp(ir_node const *const node, ir_node const *const target)
@@ -1439,7 +1439,7 @@ static unsigned emit_jit_entity_relocation_asm(char *const buffer,
 	}
 	x86_emit_relocation_no_offset(be_kind, entity);
 	if (offset != 0)
-		be_emit_irprintf("%+"PRId32, offset);
+		be_emit_long_signed(offset);
 	be_emit_char('\n');
 	be_emit_write_line();
 	return res;
@@ -11,6 +11,7 @@
  * This file implements the creation of the architecture specific firm opcodes
  * and the corresponding node constructors for the ia32 assembler irg.
  */
+#include "hashptr.h"
 #include "ia32_new_nodes_t.h"
 
 #include "bearch.h"
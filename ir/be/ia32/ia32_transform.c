@@ -257,40 +257,24 @@ static ir_node *try_create_Immediate(const ir_node *node, char const constraint)
 	return ia32_create_Immediate_full(irg, &immediate);
 }
 
-static ir_entity *create_float_const_entity(ir_tarval *tv, ident *name)
+static ir_entity *create_float_const_entity(ir_tarval *tv)
 {
-	ir_mode *mode = get_tarval_mode(tv);
 	if (!ia32_cg_config.use_sse2) {
 		/* try to reduce the mode to produce smaller sized entities */
+		ir_mode *const mode    = get_tarval_mode(tv);
 		ir_mode *const modes[] = { mode_F, mode_D, NULL };
 		for (ir_mode *const *i = modes;; ++i) {
 			ir_mode *const to = *i;
 			if (!to || to == mode)
 				break;
 			if (tarval_ieee754_can_conv_lossless(tv, to)) {
-				tv   = tarval_convert_to(tv, to);
-				mode = to;
+				tv = tarval_convert_to(tv, to);
 				break;
 			}
 		}
 	}
 
-	ir_entity *res = pmap_get(ir_entity, ia32_tv_ent, tv);
-	if (!res) {
-		if (!name)
-			name = id_unique("C");
-
-		ir_type *const tp = get_type_for_mode(mode);
-		res = new_global_entity(get_glob_type(), name, tp,
-		                        ir_visibility_private,
-		                        IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
-
-		ir_initializer_t *const initializer = create_initializer_tarval(tv);
-		set_entity_initializer(res, initializer);
-
-		pmap_insert(ia32_tv_ent, tv, res);
-	}
-	return res;
+	return be_create_tarval_entity(tv);
 }
 
 static void set_am_const_entity(ir_node *node, ir_entity *entity)
@@ -352,7 +336,7 @@ static ir_node *gen_Const(ir_node *node)
 					goto end;
 				}
 #endif /* CONSTRUCT_SSE_CONST */
-				ir_entity *const floatent = create_float_const_entity(tv, NULL);
+				ir_entity *const floatent = create_float_const_entity(tv);
 
 				ir_node *base = get_global_base(irg);
 				ir_node *load = new_bd_ia32_xLoad(dbgi, block, base, noreg_GP,
@@ -375,7 +359,7 @@ static ir_node *gen_Const(ir_node *node)
 negate:
 				res = new_bd_ia32_fchs(dbgi, block, res);
 			} else {
-				ir_entity *const floatent = create_float_const_entity(tv, NULL);
+				ir_entity *const floatent = create_float_const_entity(tv);
 				/* create_float_const_ent is smart and sometimes creates
 				   smaller entities */
 				ir_mode *ent_mode = get_type_mode(get_entity_type(floatent));
@@ -506,7 +490,7 @@ ir_entity *ia32_gen_fp_known_const(ia32_known_const_t const kct)
 				create_initializer_tarval(tv));
 			set_entity_initializer(ent, initializer);
 		} else {
-			ent = create_float_const_entity(tv, name);
+			ent = create_float_const_entity(tv);
 		}
 		/* cache the entry */
 		ent_cache[kct] = ent;
@@ -750,7 +734,7 @@ static void build_address(ia32_address_mode_t *am, ir_node *node,
 	if (is_Const(node)) {
 		ir_graph  *const irg    = get_irn_irg(node);
 		ir_tarval *const tv     = get_Const_tarval(node);
-		ir_entity *const entity = create_float_const_entity(tv, NULL);
+		ir_entity *const entity = create_float_const_entity(tv);
 		addr->base        = get_global_base(irg);
 		addr->index       = noreg_GP;
 		addr->mem         = nomem;
@@ -2787,7 +2771,8 @@ static ir_node *gen_Switch(ir_node *node)
 
 	ir_type   *const utype = get_unknown_type();
 	ir_entity *const entity
-		= new_global_entity(irp->dummy_owner, id_unique("TBL"), utype,
+		= new_global_entity(irp->dummy_owner,
+		                    irg_unique_ident(get_irn_irg(node), "TBL"), utype,
 		                    ir_visibility_private,
 		                    IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
@@ -3166,7 +3151,8 @@ static ir_entity *ia32_create_const_array(ir_node *c0, ir_node *c1,
 	tp = ia32_create_float_array(tp);
 
 	ir_entity *ent
-		= new_global_entity(get_glob_type(), id_unique("C"), tp,
+		= new_global_entity(get_glob_type(),
+		                    irg_unique_ident(get_irn_irg(c0), "C"), tp,
 		                    ir_visibility_private,
 		                    IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
@@ -5220,6 +5206,11 @@ static ir_node *gen_Builtin(ir_node *node)
 		return gen_va_start(node);
 	case ir_bk_may_alias:
 	case ir_bk_va_arg:
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 		break;
 	}
 	panic("Builtin %s not implemented", get_builtin_kind_name(kind));
@@ -5279,6 +5270,11 @@ static ir_node *gen_Proj_Builtin(ir_node *proj)
 		break;
 	case ir_bk_may_alias:
 	case ir_bk_va_arg:
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 		break;
 	}
 	panic("Builtin %s not implemented", get_builtin_kind_name(kind));
@@ -511,11 +511,11 @@ void x86_emit_addr(ir_node const *const node, x86_addr_t const *const addr)
 	if (entity) {
 		x86_emit_relocation_no_offset(addr->immediate.kind, entity);
 		if (offset != 0)
-			be_emit_irprintf("%+"PRId32, offset);
+			be_emit_long_signed(offset);
 	} else if (offset != 0 || variant == X86_ADDR_JUST_IMM) {
 		assert(addr->immediate.kind == X86_IMM_VALUE);
 		/* also handle special case if nothing is set */
-		be_emit_irprintf("%"PRId32, offset);
+		be_emit_long(offset);
 	}
 
 	if (variant != X86_ADDR_JUST_IMM) {
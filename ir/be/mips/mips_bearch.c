@@ -8,6 +8,7 @@
 #include "be2addr.h"
 #include "be_t.h"
 #include "beirg.h"
+#include "belistsched.h"
 #include "bemodule.h"
 #include "bera.h"
 #include "besched.h"
@@ -60,6 +61,26 @@ static int mips_ifconv(ir_node const *const sel, ir_node const *const mux_false,
 	return false;
 }
 
+static unsigned mips_get_op_latency(ir_node const *const node)
+{
+	if (is_mips_irn(node)) {
+		switch ((mips_opcodes)get_mips_irn_opcode(node)) {
+		/* the classic load-use delay: the loaded value is not available
+		 * in the cycle directly after the load */
+		case iro_mips_lb:
+		case iro_mips_lbu:
+		case iro_mips_lh:
+		case iro_mips_lhu:
+		case iro_mips_lw:
+			return 2;
+
+		default:
+			break;
+		}
+	}
+	return 1;
+}
+
 static void mips_init(void)
 {
 	mips_init_asm_constraints();
@@ -70,6 +91,8 @@ static void mips_init(void)
 		= "the MIPS backend is highly experimental and unfinished";
 	ir_target.allow_ifconv       = mips_ifconv;
 	ir_target.float_int_overflow = ir_overflow_indefinite;
+
+	be_list_sched_set_latency(&mips_get_op_latency);
 }
 
 static void mips_finish(void)
@@ -371,6 +371,9 @@ static ir_node *gen_Builtin(ir_node *const node)
 	case ir_bk_saturating_increment: return gen_saturating_increment(node);
 
 	case ir_bk_bswap:
+	case ir_bk_add_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 	case ir_bk_clz:
 	case ir_bk_compare_swap:
 	case ir_bk_ctz:
@@ -379,11 +382,13 @@ static ir_node *gen_Builtin(ir_node *const node)
 	case ir_bk_frame_address:
 	case ir_bk_inport:
 	case ir_bk_may_alias:
+	case ir_bk_mul_overflow:
 	case ir_bk_outport:
 	case ir_bk_parity:
 	case ir_bk_popcount:
 	case ir_bk_prefetch:
 	case ir_bk_return_address:
+	case ir_bk_sub_overflow:
 	case ir_bk_trap:
 	case ir_bk_va_arg:
 	case ir_bk_va_start:
@@ -843,6 +848,9 @@ static ir_node *gen_Proj_Builtin(ir_node *const node)
 		return new_pred;
 
 	case ir_bk_bswap:
+	case ir_bk_add_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 	case ir_bk_clz:
 	case ir_bk_compare_swap:
 	case ir_bk_ctz:
@@ -851,11 +859,13 @@ static ir_node *gen_Proj_Builtin(ir_node *const node)
 	case ir_bk_frame_address:
 	case ir_bk_inport:
 	case ir_bk_may_alias:
+	case ir_bk_mul_overflow:
 	case ir_bk_outport:
 	case ir_bk_parity:
 	case ir_bk_popcount:
 	case ir_bk_prefetch:
 	case ir_bk_return_address:
+	case ir_bk_sub_overflow:
 	case ir_bk_trap:
 	case ir_bk_va_arg:
 	case ir_bk_va_start:
@@ -1154,7 +1164,7 @@ static ir_node *gen_Switch(ir_node *const node)
 	ir_switch_table const *const table = ir_switch_table_duplicate(irg, get_Switch_table(node));
 
 	ir_type   *const utype  = get_unknown_type();
-	ident     *const id     = id_unique("TBL");
+	ident     *const id     = irg_unique_ident(irg, "TBL");
 	ir_entity *const entity = new_global_entity(irp->dummy_owner, id, utype, ir_visibility_private, IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
 	dbg_info  *const dbgi   = get_irn_dbg_info(node);
@@ -8,6 +8,7 @@
 #include "be2addr.h"
 #include "be_t.h"
 #include "beirg.h"
+#include "belistsched.h"
 #include "bemodule.h"
 #include "benode.h"
 #include "bera.h"
@@ -120,6 +121,26 @@ static int riscv_ifconv(ir_node const *const sel, ir_node const *const mux_false
 	return false;
 }
 
+static unsigned riscv_get_op_latency(ir_node const *const node)
+{
+	if (is_riscv_irn(node)) {
+		switch ((riscv_opcodes)get_riscv_irn_opcode(node)) {
+		/* loaded values are not available in the cycle directly after the
+		 * load on typical in-order implementations */
+		case iro_riscv_lb:
+		case iro_riscv_lbu:
+		case iro_riscv_lh:
+		case iro_riscv_lhu:
+		case iro_riscv_lw:
+			return 2;
+
+		default:
+			break;
+		}
+	}
+	return 1;
+}
+
 static void riscv_init(void)
 {
 	riscv_init_asm_constraints();
@@ -132,6 +153,8 @@ static void riscv_init(void)
 	ir_target.float_int_overflow = ir_overflow_min_max;
 	ir_platform_set_va_list_type_pointer();
 
+	be_list_sched_set_latency(&riscv_get_op_latency);
+
 	use_softfloat = ((riscv_isa_t)isa == rv32ima);
 	if (use_softfloat && (riscv_abi_t)abi == ilp32d) {
 		panic("requested ABI requires -march to subsume the 'D' extension");
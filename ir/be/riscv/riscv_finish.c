@@ -16,6 +16,9 @@
 #include "be2addr.h"
 #include "beirg.h"
 #include "bepeephole.h"
+#include "iredges_t.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
 #include "riscv_transform.h"
 #include "gen_riscv_regalloc_if.h"
 
@@ -163,6 +166,87 @@ static void peephole_riscv_shift(ir_node *const node)
 	}
 }
 
+/**
+ * Many RISC-V implementations fuse certain producer/consumer pairs into a
+ * single macro-op when the consumer directly follows the producer in the
+ * instruction stream, e.g. lui+addi, lui+load/store and shift-add address
+ * generation (slli+add with a shift amount of 1-3).
+ */
+static bool is_fusible_pair(ir_node const *const producer, ir_node const *const consumer)
+{
+	if (is_riscv_lui(producer)) {
+		switch ((riscv_opcodes)get_riscv_irn_opcode(consumer)) {
+		case iro_riscv_addi:
+			return get_irn_n(consumer, n_riscv_addi_left) == producer;
+		case iro_riscv_lb:
+		case iro_riscv_lbu:
+		case iro_riscv_lh:
+		case iro_riscv_lhu:
+		case iro_riscv_lw:
+		case iro_riscv_sb:
+		case iro_riscv_sh:
+		case iro_riscv_sw:
+			return get_irn_n(consumer, n_riscv_sw_base) == producer;
+		default:
+			return false;
+		}
+	}
+	if (is_riscv_slli(producer) && is_riscv_add(consumer)) {
+		riscv_immediate_attr_t const *const imm
+			= get_riscv_immediate_attr_const(producer);
+		return 1 <= imm->val && imm->val <= 3;
+	}
+	return false;
+}
+
+/**
+ * Returns true if @p node writes the register @p reg.
+ */
+static bool writes_register(ir_node *const node, arch_register_t const *const reg)
+{
+	be_foreach_out(node, o) {
+		if (arch_get_irn_register_out(node, o) == reg)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Move fusible producers in the schedule directly before their consumer.
+ * The producer result is live up to the consumer anyway, so sinking the
+ * producer is legal as long as no instruction in between overwrites one of
+ * its input registers.
+ */
+static void schedule_fusible_pairs(ir_node *const block, void *const env)
+{
+	(void)env;
+	sched_foreach_safe(block, node) {
+		if ((!is_riscv_lui(node) && !is_riscv_slli(node))
+		    || !be_has_only_one_user(node))
+			continue;
+		ir_node *const user = get_edge_src_irn(get_irn_out_edge_first(node));
+		if (get_nodes_block(user) != block || sched_next(node) == user
+		    || !is_fusible_pair(node, user))
+			continue;
+
+		bool safe = true;
+		for (ir_node *n = sched_next(node); n != user && safe;
+		     n = sched_next(n)) {
+			foreach_irn_in(node, i, pred) {
+				arch_register_t const *const reg = arch_get_irn_register(pred);
+				if (reg != NULL && writes_register(n, reg)) {
+					safe = false;
+					break;
+				}
+			}
+		}
+		if (safe) {
+			sched_remove(node);
+			sched_add_before(user, node);
+		}
+	}
+}
+
 void riscv_finish_graph(ir_graph *irg)
 {
 	/* perform peephole optimizations */
@@ -187,4 +271,7 @@ void riscv_finish_graph(ir_graph *irg)
 
 	register_peephole_optimization(op_be_IncSP, finish_be_IncSP);
 	be_peephole_opt(irg);
+
+	/* place macro-op fusible pairs adjacently */
+	irg_block_walk_graph(irg, NULL, schedule_fusible_pairs, NULL);
 }
@@ -547,6 +547,17 @@ EOF
 	if (defined(my $op_attr_init = $n{op_attr_init})) {
 		$obst_new_irop .= "\t$op_attr_init\n";
 	}
+
+	# record timing information for cost aware scheduling/peepholing
+	my $latency    = $n{latency};
+	my $throughput = $n{throughput};
+	my $uops       = $n{uops};
+	if (defined($latency) || defined($throughput) || defined($uops)) {
+		$latency    //= 1;
+		$throughput //= 1;
+		$uops       //= 1;
+		$obst_new_irop .= "\tarch_set_op_timing(op, (arch_op_timing_t){ .latency = $latency, .throughput = $throughput, .uops = $uops });\n";
+	}
 	$obst_new_irop .= "\top_$op = op;\n";
 
 	$obst_free_irop .= "\tfree_ir_op(op_$op); op_$op = NULL;\n";
@@ -570,6 +581,7 @@ open(my $out_c, ">", $target_c) // die("Fatal error: Could not open $target_c, r
 print $out_c <<EOF;
 #include "gen_${arch}_new_nodes.h"
 
+#include "bearch.h"
 #include "benode.h"
 #include "${arch}_bearch_t.h"
 #include "gen_${arch}_regalloc_if.h"
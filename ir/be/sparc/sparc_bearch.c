@@ -43,8 +43,6 @@
 #include "target_t.h"
 #include "util.h"
 
-pmap *sparc_constants;
-
 ir_mode *sparc_mode_Q;
 
 typedef enum {
@@ -434,7 +432,7 @@ static void sparc_generate_code(FILE *output, const char *cup_name)
 {
 	be_gas_elf_type_char = '#';
 	be_gas_elf_variant   = ELF_VARIANT_SPARC;
-	sparc_constants = pmap_create();
+	be_init_tarval_entities();
 
 	be_begin(output, cup_name);
 	unsigned *const sp_is_non_ssa = rbitset_alloca(N_SPARC_REGISTERS);
@@ -468,7 +466,7 @@ static void sparc_generate_code(FILE *output, const char *cup_name)
 	}
 
 	be_finish();
-	pmap_destroy(sparc_constants);
+	be_free_tarval_entities();
 }
 
 static void sparc_lower_va_arg(ir_node *node)
@@ -31,8 +31,6 @@ typedef struct sparc_codegen_config_t {
 } sparc_codegen_config_t;
 extern sparc_codegen_config_t sparc_cg_config;
 
-extern pmap *sparc_constants;
-
 extern ir_mode *sparc_mode_Q;
 
 /**
@@ -47,7 +47,7 @@ static bool emitting_delay_slot;
 static void sparc_emit_immediate(int32_t value, ir_entity *entity)
 {
 	if (entity == NULL) {
-		be_emit_irprintf("%"PRId32, value);
+		be_emit_long(value);
 	} else {
 		if (is_tls_entity(entity)) {
 			be_emit_cstring("%tle_lox10(");
@@ -56,7 +56,7 @@ static void sparc_emit_immediate(int32_t value, ir_entity *entity)
 		}
 		be_gas_emit_entity(entity);
 		if (value != 0) {
-			be_emit_irprintf("%+"PRId32, value);
+			be_emit_long_signed(value);
 		}
 		be_emit_char(')');
 	}
@@ -78,7 +78,7 @@ static void sparc_emit_high_immediate(ir_node const *node)
 		}
 		be_gas_emit_entity(entity);
 		if (attr->immediate_value != 0) {
-			be_emit_irprintf("%+"PRId32, attr->immediate_value);
+			be_emit_long_signed(attr->immediate_value);
 		}
 		be_emit_char(')');
 	}
@@ -119,7 +119,7 @@ static void sparc_emit_offset(const ir_node *node, int offset_node_pos)
 		int32_t offset = attr->base.immediate_value;
 		if (offset != 0) {
 			assert(sparc_is_value_imm_encodeable(offset));
-			be_emit_irprintf("%+"PRId32, offset);
+			be_emit_long_signed(offset);
 		}
 	} else if (attr->base.immediate_value != 0
 	           || attr->base.immediate_value_entity != NULL) {
@@ -390,6 +390,73 @@ static bool can_move_up_into_delayslot(const ir_node *node, const ir_node *to)
 	return true;
 }
 
+/**
+ * Check whether @p node can move down from the end of the only predecessor
+ * block into the delay slot of @p to. Besides the usual intra-block
+ * conditions for the rest of the predecessor block, no instruction of the
+ * target block up to and including @p to may use or overwrite one of the
+ * results of @p node or overwrite one of its inputs: the delay slot executes
+ * after all of them.
+ */
+static bool can_move_down_across_block(const ir_node *node, const ir_node *to)
+{
+	for (ir_node *schedpoint = sched_next(node); !sched_is_end(schedpoint);
+	     schedpoint = sched_next(schedpoint)) {
+		/* schedpoint must not use our computed values */
+		if (heights_reachable_in_block(heights, schedpoint, node))
+			return false;
+		/* schedpoint must not overwrite registers of our inputs */
+		foreach_irn_in(node, i, in) {
+			const arch_register_t *reg = arch_get_irn_register(in);
+			if (reg == NULL)
+				continue;
+			const arch_register_req_t *req
+				= arch_get_irn_register_req_in(node, i);
+			if (writes_reg(schedpoint, reg->global_index, req->width))
+				return false;
+		}
+	}
+
+	ir_node *block      = get_nodes_block(to);
+	ir_node *schedpoint = sched_first(block);
+	for (;; schedpoint = sched_next(schedpoint)) {
+		be_foreach_out(node, o) {
+			const arch_register_t *reg = arch_get_irn_register_out(node, o);
+			if (reg == NULL)
+				continue;
+			const arch_register_req_t *req
+				= arch_get_irn_register_req_out(node, o);
+			if (uses_reg(schedpoint, reg->global_index, req->width)
+			 || writes_reg(schedpoint, reg->global_index, req->width))
+				return false;
+		}
+		foreach_irn_in(node, i, in) {
+			const arch_register_t *reg = arch_get_irn_register(in);
+			if (reg == NULL)
+				continue;
+			const arch_register_req_t *req
+				= arch_get_irn_register_req_in(node, i);
+			if (writes_reg(schedpoint, reg->global_index, req->width))
+				return false;
+		}
+		if (schedpoint == to)
+			break;
+	}
+	return true;
+}
+
+/**
+ * Returns true if @p succ is the only control flow successor of @p block.
+ */
+static bool has_single_successor(const ir_node *block, const ir_node *succ)
+{
+	foreach_block_succ(block, edge) {
+		if (get_edge_src_irn(edge) != succ)
+			return false;
+	}
+	return true;
+}
+
 static void optimize_fallthrough(ir_node *node)
 {
 	be_cond_branch_projs_t const projs = be_get_cond_branch_projs(node);
@@ -485,6 +552,42 @@ static ir_node *pick_delay_slot_for(ir_node *node)
 		}
 	}
 
+	/* look into the predecessor block: if it is our only predecessor and
+	 * jumps nowhere else, its instructions may move down into the delay
+	 * slot, they still execute exactly on the paths that executed them
+	 * before. */
+	if (get_Block_n_cfgpreds(block) == 1) {
+		ir_node *pred_block = get_Block_cfgpred_block(block, 0);
+		bool     has_phis   = false;
+		sched_foreach_phi(block, phi) {
+			(void)phi;
+			has_phis = true;
+			break;
+		}
+		if (pred_block != NULL && !has_phis
+		 && has_single_successor(pred_block, block)) {
+			tries = 0;
+			sched_foreach_reverse(pred_block, schedpoint) {
+				/* moving across the jump terminating the predecessor block
+				 * is fine, it leads here on all paths */
+				if (is_cfop(schedpoint))
+					continue;
+				if (tries++ >= PICK_DELAY_SLOT_MAX_DISTANCE)
+					break;
+				if (!is_legal_delay_slot_filler(schedpoint))
+					continue;
+				/* restore doesn't model register window switching correctly,
+				 * memory ops are not tracked across blocks by heights */
+				if (is_restore(schedpoint) || get_irn_pinned(schedpoint)
+				 || is_memop(schedpoint))
+					continue;
+				if (!can_move_down_across_block(schedpoint, node))
+					continue;
+				return schedpoint;
+			}
+		}
+	}
+
 	return NULL;
 }
 
@@ -590,6 +590,7 @@ void sparc_finish_graph(ir_graph *irg)
 	sparc_fix_stack_bias(irg);
 
 	heights = heights_new(irg);
+	be_peephole_set_heights(heights);
 
 	/* perform peephole optimizations */
 	ir_clear_opcodes_generic_func();
@@ -613,6 +614,7 @@ void sparc_finish_graph(ir_graph *irg)
 	register_peephole_optimization(op_sparc_Stf,       finish_sparc_Stf);
 	be_peephole_opt(irg);
 
+	be_peephole_set_heights(NULL);
 	heights_free(heights);
 
 	be_handle_2addr(irg, NULL);
@@ -1080,22 +1080,7 @@ static ir_node *gen_Minus(ir_node *node)
  */
 static ir_entity *create_float_const_entity(ir_tarval *const tv)
 {
-	ir_entity *entity = pmap_get(ir_entity, sparc_constants, tv);
-	if (entity != NULL)
-		return entity;
-
-	ir_mode *mode   = get_tarval_mode(tv);
-	ir_type *type   = get_type_for_mode(mode);
-	ir_type *glob   = get_glob_type();
-	entity = new_global_entity(glob, id_unique("C"), type,
-	                           ir_visibility_private,
-	                           IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
-
-	ir_initializer_t *initializer = create_initializer_tarval(tv);
-	set_entity_initializer(entity, initializer);
-
-	pmap_insert(sparc_constants, tv, entity);
-	return entity;
+	return be_create_tarval_entity(tv);
 }
 
 static ir_node *gen_float_const(dbg_info *dbgi, ir_node *block, ir_tarval *tv)
@@ -1163,7 +1148,7 @@ static ir_node *gen_Switch(ir_node *node)
 
 	ir_type   *const utype = get_unknown_type();
 	ir_entity *const entity
-		= new_global_entity(irp->dummy_owner, id_unique("TBL"), utype,
+		= new_global_entity(irp->dummy_owner, irg_unique_ident(irg, "TBL"), utype,
 		                    ir_visibility_private,
 		                    IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
@@ -1981,6 +1966,11 @@ static ir_node *gen_Builtin(ir_node *node)
 		return gen_va_start(node);
 	case ir_bk_may_alias:
 	case ir_bk_va_arg:
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 		break;
 	}
 	panic("Builtin %s not implemented", get_builtin_kind_name(kind));
@@ -2031,6 +2021,11 @@ static ir_node *gen_Proj_Builtin(ir_node *proj)
 		}
 	case ir_bk_may_alias:
 	case ir_bk_va_arg:
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 		break;
 	}
 	panic("Builtin %s not implemented", get_builtin_kind_name(kind));
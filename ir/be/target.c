@@ -16,6 +16,11 @@ target_info_t ir_target;
 
 int ir_target_set_triple(ir_machine_triple_t const *machine)
 {
+	/* Deferred from library initialization: the backend modules are only
+	 * needed once a target is selected, and be_set_arch() below relies on
+	 * the module lists being registered. */
+	firm_be_init();
+
 	memset(&ir_target, 0, sizeof(ir_target));
 	ir_target.allow_ifconv = ir_is_optimizable_mux;
 
@@ -81,6 +86,8 @@ void ir_target_init(void)
 	set_modeP(ptr_mode);
 
 	be_initialize();
+	ir_target.copy_unit_size = pointer_size;
+	ir_target.mux_latency    = 1;
 	ir_target.isa->init();
 	ir_target.isa_initialized = true;
 
@@ -105,7 +112,10 @@ int ir_target_option(const char *arg)
 {
 	assert(ir_target.isa != NULL && "Did not call ir_target_set yet");
 
-	lc_opt_entry_t *be_grp = lc_opt_get_grp(firm_opt_get_root(), "be");
+	/* resolved once; embedders pass many options per session */
+	static lc_opt_entry_t *be_grp;
+	if (be_grp == NULL)
+		be_grp = lc_opt_get_grp(firm_opt_get_root(), "be");
 	if (streq(arg, "help") || streq(arg, "?")) {
 		lc_opt_print_help_for_entry(be_grp, '-', stdout);
 		return -1;
@@ -144,6 +154,12 @@ int ir_target_fast_unaligned_memaccess(void)
 	return ir_target.fast_unaligned_memaccess;
 }
 
+unsigned ir_target_copy_unit_size(void)
+{
+	assert(ir_target.isa_initialized);
+	return ir_target.copy_unit_size;
+}
+
 int ir_target_supports_pic(void)
 {
 	return ir_target.isa->pic_supported;
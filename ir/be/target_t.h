@@ -21,6 +21,19 @@ typedef struct target_info_t {
 	char const            *experimental;
 	arch_allow_ifconv_func allow_ifconv;
 	ir_mode               *mode_float_arithmetic;
+	/** Widest unit in bytes the target copies with one load/store pair.
+	 * Defaults to the pointer size, backends with wider move instructions
+	 * can raise it in their init function. */
+	unsigned char          copy_unit_size;
+	/** Largest shift amount the target can fold as an index scale into an
+	 * address mode, 0 if there is no scaled-index addressing. Reassociation
+	 * uses this to normalize address arithmetic towards
+	 * base + (index << scale) + offset. */
+	unsigned char          am_scale_limit;
+	/** Latency in cycles of a conditional move/select instruction.
+	 * If-conversion weighs it against the misprediction cost of a branch.
+	 * Defaults to 1, backends with slower conditional moves raise it. */
+	unsigned char          mux_latency;
 	bool isa_initialized          : 1;
 	bool fast_unaligned_memaccess : 1;
 	ENUMBF(float_int_conversion_overflow_style_t) float_int_overflow : 2;
@@ -25,6 +25,7 @@
 #include <string.h>
 #include <time.h>
 
+#include "hashptr.h"
 #include "set.h"
 #include "ident.h"
 #include "irhooks.h"
@@ -31,6 +31,7 @@
 #include "irprog_t.h"
 #include "irtools.h"
 #include "lc_opts.h"
+#include "memstat.h"
 #include "opt_init.h"
 #include "target_t.h"
 #include "tv_t.h"
@@ -56,6 +57,7 @@ void ir_init_library(void)
 		panic("Double initialization");
 	initialized = true;
 
+	firm_init_memstat();
 	firm_init_flags();
 	init_ident();
 	init_edges();
@@ -76,7 +78,9 @@ void ir_init_library(void)
 	firm_init_loop_opt();
 
 	init_execfreq();
-	firm_be_init();
+	/* The backend modules and their option tables are registered when a
+	 * target is selected, see ir_target_set_triple(). Processes that only
+	 * use the middle end never pay for the backend setup. */
 
 #ifdef DEBUG_libfirm
 	firm_init_debugger();
@@ -90,6 +94,7 @@ void ir_finish(void)
 #endif
 	exit_execfreq();
 	firm_be_finish();
+	firm_finish_memory_disambiguator();
 
 	free_ir_prog();
 	firm_finish_op();
@@ -0,0 +1,175 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Minimal threading abstraction used by parallel drivers.
+ *
+ * Wraps C11 <threads.h> when the toolchain provides it. On toolchains
+ * without thread support all primitives degrade to no-ops and
+ * FIRM_HAS_THREADS is 0, so callers can fall back to serial execution
+ * without sprinkling #ifdefs around.
+ */
+#ifndef FIRM_COMMON_FIRM_THREADS_H
+#define FIRM_COMMON_FIRM_THREADS_H
+
+#include <stdbool.h>
+
+#if !defined(__STDC_NO_THREADS__) && defined(__has_include)
+#if __has_include(<threads.h>)
+#define FIRM_HAS_THREADS 1
+#endif
+#endif
+
+#ifndef FIRM_HAS_THREADS
+#define FIRM_HAS_THREADS 0
+#endif
+
+#if FIRM_HAS_THREADS
+
+#include <threads.h>
+#include <time.h>
+
+typedef mtx_t  firm_mutex_t;
+typedef cnd_t  firm_cond_t;
+typedef thrd_t firm_thread_t;
+
+static inline void firm_mutex_init(firm_mutex_t *mutex)
+{
+	mtx_init(mutex, mtx_plain);
+}
+
+static inline void firm_mutex_destroy(firm_mutex_t *mutex)
+{
+	mtx_destroy(mutex);
+}
+
+static inline void firm_mutex_lock(firm_mutex_t *mutex)
+{
+	mtx_lock(mutex);
+}
+
+static inline void firm_mutex_unlock(firm_mutex_t *mutex)
+{
+	mtx_unlock(mutex);
+}
+
+static inline void firm_cond_init(firm_cond_t *cond)
+{
+	cnd_init(cond);
+}
+
+static inline void firm_cond_destroy(firm_cond_t *cond)
+{
+	cnd_destroy(cond);
+}
+
+static inline void firm_cond_wait(firm_cond_t *cond, firm_mutex_t *mutex)
+{
+	cnd_wait(cond, mutex);
+}
+
+static inline void firm_cond_signal(firm_cond_t *cond)
+{
+	cnd_signal(cond);
+}
+
+static inline void firm_cond_broadcast(firm_cond_t *cond)
+{
+	cnd_broadcast(cond);
+}
+
+/** Suspends the calling thread for at least @p ms milliseconds. */
+static inline void firm_thread_sleep(unsigned ms)
+{
+	struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000L };
+	thrd_sleep(&ts, NULL);
+}
+
+static inline bool firm_thread_create(firm_thread_t *thread,
+                                      int (*func)(void *), void *arg)
+{
+	return thrd_create(thread, func, arg) == thrd_success;
+}
+
+static inline void firm_thread_join(firm_thread_t thread)
+{
+	thrd_join(thread, NULL);
+}
+
+#else
+
+typedef char firm_mutex_t;
+typedef char firm_cond_t;
+typedef char firm_thread_t;
+
+static inline void firm_mutex_init(firm_mutex_t *mutex)
+{
+	(void)mutex;
+}
+
+static inline void firm_mutex_destroy(firm_mutex_t *mutex)
+{
+	(void)mutex;
+}
+
+static inline void firm_mutex_lock(firm_mutex_t *mutex)
+{
+	(void)mutex;
+}
+
+static inline void firm_mutex_unlock(firm_mutex_t *mutex)
+{
+	(void)mutex;
+}
+
+static inline void firm_cond_init(firm_cond_t *cond)
+{
+	(void)cond;
+}
+
+static inline void firm_cond_destroy(firm_cond_t *cond)
+{
+	(void)cond;
+}
+
+static inline void firm_cond_wait(firm_cond_t *cond, firm_mutex_t *mutex)
+{
+	(void)cond;
+	(void)mutex;
+}
+
+static inline void firm_cond_signal(firm_cond_t *cond)
+{
+	(void)cond;
+}
+
+static inline void firm_cond_broadcast(firm_cond_t *cond)
+{
+	(void)cond;
+}
+
+static inline void firm_thread_sleep(unsigned ms)
+{
+	(void)ms;
+}
+
+static inline bool firm_thread_create(firm_thread_t *thread,
+                                      int (*func)(void *), void *arg)
+{
+	(void)thread;
+	(void)func;
+	(void)arg;
+	return false;
+}
+
+static inline void firm_thread_join(firm_thread_t thread)
+{
+	(void)thread;
+}
+
+#endif
+
+#endif
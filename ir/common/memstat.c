@@ -0,0 +1,123 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Accounting of obstack chunk memory.
+ *
+ * All obstacks initialized through obst.h route their chunk traffic
+ * through ir_obstack_chunk_alloc()/ir_obstack_chunk_free() below, so
+ * the counters here see every chunk the library allocates. The graph
+ * node obstacks use their own chunk allocator with a recycling cache
+ * (see irgraph.c) and report into the same counters. On top of the
+ * global numbers, ir_memory_stats() attributes live bytes to the
+ * subsystems with the long-lived obstacks: the node obstacks of the
+ * graphs and the backend obstacks.
+ */
+#include "memstat.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "beirg.h"
+#include "firm_common.h"
+#include "firm_threads.h"
+#include "irgraph_t.h"
+#include "irprog_t.h"
+#include "obst.h"
+#include "statev_t.h"
+#include "xmalloc.h"
+
+/** Protects the chunk counters. Only taken once the library is
+ * initialized; before that all obstack users are single-threaded. */
+static firm_mutex_t memstat_lock;
+static bool         memstat_lock_ready;
+
+static size_t live_bytes;
+static size_t peak_bytes;
+static size_t live_chunks;
+static size_t peak_chunks;
+
+void firm_init_memstat(void)
+{
+	if (!memstat_lock_ready) {
+		firm_mutex_init(&memstat_lock);
+		memstat_lock_ready = true;
+	}
+}
+
+static void account_alloc(size_t const size)
+{
+	if (memstat_lock_ready)
+		firm_mutex_lock(&memstat_lock);
+	live_bytes += size;
+	if (live_bytes > peak_bytes)
+		peak_bytes = live_bytes;
+	++live_chunks;
+	if (live_chunks > peak_chunks)
+		peak_chunks = live_chunks;
+	if (memstat_lock_ready)
+		firm_mutex_unlock(&memstat_lock);
+}
+
+static void account_free(size_t const size)
+{
+	if (memstat_lock_ready)
+		firm_mutex_lock(&memstat_lock);
+	assert(live_bytes >= size && live_chunks > 0);
+	live_bytes -= size;
+	--live_chunks;
+	if (memstat_lock_ready)
+		firm_mutex_unlock(&memstat_lock);
+}
+
+void *ir_obstack_chunk_alloc(size_t const size)
+{
+	account_alloc(size);
+	return xmalloc(size);
+}
+
+void ir_obstack_chunk_free(void *const chunk)
+{
+	struct _obstack_chunk *const c = (struct _obstack_chunk*)chunk;
+	account_free((size_t)(c->limit - (char*)c));
+	xfree(chunk);
+}
+
+void ir_obstack_chunk_free_sized(void *const chunk, size_t const size)
+{
+	account_free(size);
+	xfree(chunk);
+}
+
+void ir_memory_stats(ir_memory_stats_t *const stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	if (memstat_lock_ready)
+		firm_mutex_lock(&memstat_lock);
+	stats->obstack_live        = live_bytes;
+	stats->obstack_peak        = peak_bytes;
+	stats->obstack_chunks      = live_chunks;
+	stats->obstack_chunks_peak = peak_chunks;
+	if (memstat_lock_ready)
+		firm_mutex_unlock(&memstat_lock);
+
+	foreach_irp_irg(i, irg) {
+		stats->irg_live += irg_obstack_memory(irg);
+		if (irg->be_data != NULL)
+			stats->be_live += (size_t)obstack_memory_used(be_get_be_obst(irg));
+	}
+	ir_graph *const const_code = get_const_code_irg();
+	if (const_code != NULL)
+		stats->irg_live += irg_obstack_memory(const_code);
+
+	stat_ev_ull("mem_obstack_live",        stats->obstack_live);
+	stat_ev_ull("mem_obstack_peak",        stats->obstack_peak);
+	stat_ev_ull("mem_obstack_chunks",      stats->obstack_chunks);
+	stat_ev_ull("mem_obstack_chunks_peak", stats->obstack_chunks_peak);
+	stat_ev_ull("mem_irg_live",            stats->irg_live);
+	stat_ev_ull("mem_be_live",             stats->be_live);
+}
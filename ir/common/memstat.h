@@ -0,0 +1,26 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Accounting of obstack chunk memory, see ir_memory_stats().
+ */
+#ifndef FIRM_COMMON_MEMSTAT_H
+#define FIRM_COMMON_MEMSTAT_H
+
+#include <stddef.h>
+
+/** Initializes the lock protecting the chunk counters. */
+void firm_init_memstat(void);
+
+/**
+ * Frees an accounted chunk whose obstack chunk header is no longer
+ * valid, like ir_obstack_chunk_free() would; the caller supplies the
+ * chunk size. Used by the graph chunk cache, which overwrites the
+ * header of recycled chunks.
+ */
+void ir_obstack_chunk_free_sized(void *chunk, size_t size);
+
+#endif
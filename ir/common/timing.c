@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "stat_timing.h"
 #include "timing.h"
 #include "xmalloc.h"
 #include "panic.h"
@@ -49,9 +50,15 @@ static inline void _time_reset(ir_timer_val_t *val);
 struct ir_timer_t {
 	ir_timer_val_t elapsed;     /**< the elapsed time so far */
 	ir_timer_val_t start;       /**< the start value of the timer */
+	timing_ticks_t ticks_elapsed; /**< elapsed CPU ticks (rdtsc if available) */
+	timing_ticks_t ticks_start;   /**< tick count when the timer was started */
+	const char     *name;       /**< name for reports, may be NULL */
 	ir_timer_t     *parent;     /**< parent of a timer */
 	ir_timer_t     *displaced;  /**< former timer in case of timer_push */
+	ir_timer_t     *first_child;  /**< head of the child list */
+	ir_timer_t     *next_sibling; /**< next timer with the same parent */
 	unsigned       running : 1; /**< set if this timer is running */
+	unsigned       linked  : 1; /**< set if in the parent's child list */
 };
 
 /** The top of the timer stack */
@@ -65,6 +72,25 @@ ir_timer_t *ir_timer_new(void)
 	return timer;
 }
 
+ir_timer_t *ir_timer_new_named(const char *name)
+{
+	ir_timer_t *timer = ir_timer_new();
+	timer->name = name;
+	return timer;
+}
+
+/** Appends @p timer to its parent's child list (once). */
+static void _timer_link(ir_timer_t *timer)
+{
+	if (timer->linked || timer->parent == NULL)
+		return;
+	ir_timer_t **anchor = &timer->parent->first_child;
+	while (*anchor != NULL)
+		anchor = &(*anchor)->next_sibling;
+	*anchor = timer;
+	timer->linked = 1;
+}
+
 void ir_timer_free(ir_timer_t *timer)
 {
 	free(timer);
@@ -284,6 +310,8 @@ void ir_timer_reset(ir_timer_t *timer)
 {
 	_time_reset(&timer->elapsed);
 	_time_reset(&timer->start);
+	timer->ticks_elapsed = 0;
+	timer->ticks_start   = 0;
 	timer->running = 0;
 }
 
@@ -295,10 +323,12 @@ void ir_timer_start(ir_timer_t *timer)
 
 	_time_reset(&timer->start);
 	_time_get(&timer->start);
+	timer->ticks_start = timing_ticks();
 	timer->running = 1;
 
 	if (timer->parent == NULL) {
 		timer->parent = timer_stack;
+		_timer_link(timer);
 	} else if (timer->parent != timer_stack) {
 		panic("timer used at different stack positions");
 	}
@@ -324,6 +354,7 @@ void ir_timer_stop(ir_timer_t *timer)
 
 	_time_get(&val);
 	timer->running = 0;
+	timer->ticks_elapsed += timing_ticks() - timer->ticks_start;
 	_time_add(&timer->elapsed, &timer->elapsed, _time_sub(&tgt, &val, &timer->start));
 }
 
@@ -334,6 +365,7 @@ void ir_timer_init_parent(ir_timer_t *timer)
 	if (timer->parent != NULL && timer->parent != timer_stack)
 		panic("timer parent mismatch");
 	timer->parent = timer_stack;
+	_timer_link(timer);
 }
 
 void ir_timer_push(ir_timer_t *timer)
@@ -417,3 +449,38 @@ double ir_timer_elapsed_sec(const ir_timer_t *timer)
 	}
 	return _time_to_sec(elapsed);
 }
+
+unsigned long long ir_timer_elapsed_ticks(const ir_timer_t *timer)
+{
+	timing_ticks_t elapsed = timer->ticks_elapsed;
+	if (timer->running)
+		elapsed += timing_ticks() - timer->ticks_start;
+	return elapsed;
+}
+
+static void print_tree_rec(FILE *out, const ir_timer_t *timer, int depth,
+                           timing_ticks_t level_total)
+{
+	timing_ticks_t const ticks = ir_timer_elapsed_ticks(timer);
+	fprintf(out, "%*s%-*s %10.3f msec %14llu ticks", 2 * depth, "",
+	        24 - 2 * depth, timer->name != NULL ? timer->name : "<anonymous>",
+	        (double)ir_timer_elapsed_usec(timer) / 1000.0, ticks);
+	if (level_total > 0)
+		fprintf(out, " %5.1f%%", 100.0 * (double)ticks / (double)level_total);
+	fputc('\n', out);
+
+	timing_ticks_t children_total = 0;
+	for (const ir_timer_t *child = timer->first_child; child != NULL;
+	     child = child->next_sibling) {
+		children_total += ir_timer_elapsed_ticks(child);
+	}
+	for (const ir_timer_t *child = timer->first_child; child != NULL;
+	     child = child->next_sibling) {
+		print_tree_rec(out, child, depth + 1, children_total);
+	}
+}
+
+void ir_timer_print_tree(FILE *out, const ir_timer_t *timer)
+{
+	print_tree_rec(out, timer, 0, 0);
+}
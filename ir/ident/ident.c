@@ -10,28 +10,65 @@
  */
 #include "ident_t.h"
 
-#include "hashptr.h"
+#include "firm_threads.h"
 #include "obst.h"
 #include "set.h"
+#include "xmalloc.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
-static set *id_set;
+/** Must be a power of two. */
+#define N_IDENT_SHARDS 16
+
+typedef struct ident_shard_t {
+	set          *set;  /**< idents whose hash maps to this shard */
+	firm_mutex_t  lock; /**< protects set */
+} ident_shard_t;
+
+/** The interned strings, sharded by hash so parallel graph passes do not
+ * serialize on a single table. */
+static ident_shard_t id_shards[N_IDENT_SHARDS];
 
 /** An obstack used for temporary space */
 static struct obstack id_obst;
 
+/** Protects id_obst and the id_unique() counter. */
+static firm_mutex_t id_fmt_lock;
+
 void init_ident(void)
 {
-	/* it's ok to use memcmp here, we check only strings */
-	id_set = new_set(memcmp, 128);
+	for (unsigned i = 0; i < N_IDENT_SHARDS; ++i) {
+		/* it's ok to use memcmp here, we check only strings */
+		id_shards[i].set = new_set(memcmp, 128 / N_IDENT_SHARDS);
+		firm_mutex_init(&id_shards[i].lock);
+	}
+	firm_mutex_init(&id_fmt_lock);
 	obstack_init(&id_obst);
 }
 
+/**
+ * 64bit FNV-1a. The low bits select the shard, the upper 32 bits are
+ * stored in the entry so colliding entries are rejected without a
+ * string compare.
+ */
+static uint64_t id_hash(const char *str, size_t len)
+{
+	uint64_t hash = UINT64_C(0xCBF29CE484222325);
+	for (size_t i = 0; i < len; ++i) {
+		hash = (hash ^ (unsigned char)str[i]) * UINT64_C(0x100000001B3);
+	}
+	return hash;
+}
+
 ident *new_id_from_chars(const char *str, size_t len)
 {
-	unsigned   hash   = hash_data((const unsigned char*)str, len);
-	set_entry *result = set_hinsert0(id_set, str, len, hash);
+	uint64_t       const hash  = id_hash(str, len);
+	ident_shard_t *const shard = &id_shards[hash % N_IDENT_SHARDS];
+	firm_mutex_lock(&shard->lock);
+	set_entry *result = set_hinsert0(shard->set, str, len,
+	                                 (unsigned)(hash >> 32));
+	firm_mutex_unlock(&shard->lock);
 	return (ident*)result->dptr;
 }
 
@@ -40,6 +77,29 @@ ident *new_id_from_str(const char *str)
 	return new_id_from_chars(str, strlen(str));
 }
 
+void new_ids_from_strs(const char *const *strs, ident **idents, size_t n)
+{
+	uint64_t *const hashes = XMALLOCN(uint64_t, n);
+	for (size_t i = 0; i < n; ++i) {
+		hashes[i] = id_hash(strs[i], strlen(strs[i]));
+	}
+	/* process shard by shard, so every lock is taken at most once */
+	for (unsigned s = 0; s < N_IDENT_SHARDS; ++s) {
+		ident_shard_t *const shard = &id_shards[s];
+		firm_mutex_lock(&shard->lock);
+		for (size_t i = 0; i < n; ++i) {
+			if (hashes[i] % N_IDENT_SHARDS != s)
+				continue;
+			set_entry *const result
+				= set_hinsert0(shard->set, strs[i], strlen(strs[i]),
+				               (unsigned)(hashes[i] >> 32));
+			idents[i] = (ident*)result->dptr;
+		}
+		firm_mutex_unlock(&shard->lock);
+	}
+	free(hashes);
+}
+
 static ident *new_ident_from_obst(struct obstack *const obst)
 {
 	size_t const len    = obstack_object_size(obst);
@@ -53,9 +113,12 @@ ident *new_id_fmt(char const *const fmt, ...)
 {
 	va_list ap;
 	va_start(ap, fmt);
+	firm_mutex_lock(&id_fmt_lock);
 	obstack_vprintf(&id_obst, fmt, ap);
+	ident *const res = new_ident_from_obst(&id_obst);
+	firm_mutex_unlock(&id_fmt_lock);
 	va_end(ap);
-	return new_ident_from_obst(&id_obst);
+	return res;
 }
 
 const char *(get_id_str)(ident *id)
@@ -66,12 +129,21 @@ const char *(get_id_str)(ident *id)
 void finish_ident(void)
 {
 	obstack_free(&id_obst, NULL);
-	del_set(id_set);
-	id_set = NULL;
+	firm_mutex_destroy(&id_fmt_lock);
+	for (unsigned i = 0; i < N_IDENT_SHARDS; ++i) {
+		del_set(id_shards[i].set);
+		id_shards[i].set = NULL;
+		firm_mutex_destroy(&id_shards[i].lock);
+	}
 }
 
 ident *id_unique(const char *tag)
 {
 	static unsigned unique_id = 0;
-	return new_id_fmt("%s.%u", tag, unique_id++);
+	firm_mutex_lock(&id_fmt_lock);
+	unsigned const id = unique_id++;
+	obstack_printf(&id_obst, "%s.%u", tag, id);
+	ident *const res = new_ident_from_obst(&id_obst);
+	firm_mutex_unlock(&id_fmt_lock);
+	return res;
 }
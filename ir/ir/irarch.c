@@ -15,23 +15,30 @@
  */
 #include "irarch.h"
 
+#include "array.h"
 #include "dbginfo_t.h"
+#include "execfreq.h"
 #include "ircons.h"
 #include "ircons_t.h"
+#include "iredges_t.h"
 #include "irflag.h"
 #include "irflag_t.h"
 #include "irgmod.h"
 #include "irgopt.h"
 #include "irgraph_t.h"
+#include "irgwalk.h"
 #include "irhooks.h"
 #include "irmode_t.h"
 #include "irnode_t.h"
 #include "iropt_dbg.h"
 #include "iropt_t.h"
 #include "irprog_t.h"
+#include "pmap.h"
 #include "irverify.h"
 #include "panic.h"
 #include "tv_t.h"
+#include "util.h"
+#include "vrp.h"
 #include <assert.h>
 #include <stdlib.h>
 
@@ -42,6 +49,7 @@ void ir_arch_lower(ir_settings_arch_dep_t const *const new_settings)
 	settings = *new_settings;
 	foreach_irp_irg(i, irg) {
 		optimize_graph_df(irg);
+		arch_dep_specialize_mods(irg);
 	}
 }
 
@@ -802,10 +810,39 @@ static struct magicu_info compute_unsigned_magic_info(ir_tarval *divisor,
 	return result;
 }
 
+/** (divisor, mode) -> magic info caches. Divisor tarvals are interned, so
+ * the tarval pointer already identifies both the value and the mode. The
+ * caches live for the whole program: the same few divisors tend to show up
+ * in thousands of divisions. */
+static pmap *signed_magic_cache;
+static pmap *unsigned_magic_cache;
+
+static struct ms get_signed_magic_info(ir_tarval *d)
+{
+	if (signed_magic_cache == NULL)
+		signed_magic_cache = pmap_create();
+	struct ms *cached = pmap_get(struct ms, signed_magic_cache, d);
+	if (cached == NULL) {
+		cached  = XMALLOC(struct ms);
+		*cached = magic(d);
+		pmap_insert(signed_magic_cache, d, cached);
+	}
+	return *cached;
+}
+
 static struct magicu_info get_magic_info(ir_tarval *d)
 {
-	unsigned num_bits = get_mode_size_bits(get_tarval_mode(d));
-	return compute_unsigned_magic_info(d, num_bits);
+	if (unsigned_magic_cache == NULL)
+		unsigned_magic_cache = pmap_create();
+	struct magicu_info *cached
+		= pmap_get(struct magicu_info, unsigned_magic_cache, d);
+	if (cached == NULL) {
+		unsigned num_bits = get_mode_size_bits(get_tarval_mode(d));
+		cached  = XMALLOC(struct magicu_info);
+		*cached = compute_unsigned_magic_info(d, num_bits);
+		pmap_insert(unsigned_magic_cache, d, cached);
+	}
+	return *cached;
 }
 
 /**
@@ -827,7 +864,7 @@ static ir_node *replace_div_by_mulh(ir_node *div, ir_tarval *tv)
 	ir_node  *res;
 	if (mode_is_signed(mode)) {
 		ir_graph *irg = get_irn_irg(div);
-		struct ms mag = magic(tv);
+		struct ms mag = get_signed_magic_info(tv);
 
 		/* generate the Mulh instruction */
 		ir_node *c = new_r_Const(irg, mag.M);
@@ -1051,3 +1088,131 @@ ir_node *arch_dep_replace_mod_by_const(ir_node *irn)
 
 	return res;
 }
+
+/**
+ * Largest proven divisor bound for which the runtime power-of-two check
+ * of arch_dep_specialize_mods() is considered worthwhile.
+ */
+#define MAX_SPECIALIZED_DIVISOR 4096
+
+/**
+ * Pre-walker collecting unsigned Mod nodes with a variable divisor that
+ * is proven non-zero and small, in blocks at least as hot as the graph
+ * entry.
+ */
+static void collect_mod_candidates(ir_node *node, void *data)
+{
+	ir_node ***candidates = (ir_node***)data;
+
+	if (!is_Mod(node) || ir_throws_exception(node))
+		return;
+	ir_node *right = get_Mod_right(node);
+	ir_mode *mode  = get_irn_mode(right);
+	if (mode_is_signed(mode))
+		return;
+	if (is_Const(right))
+		return; /* handled by arch_dep_replace_mod_by_const() */
+
+	/* only specialize when the divisor provably stays small and non-zero:
+	 * non-zero keeps the fast path out of the division-by-zero case, small
+	 * makes a power-of-two divisor likely (container sizes etc.) */
+	vrp_attr *vrp = vrp_get_or_compute_info(right);
+	if (vrp == NULL || vrp->range_type != VRP_RANGE)
+		return;
+	ir_tarval *one   = get_mode_one(mode);
+	ir_tarval *limit = new_tarval_from_long(MAX_SPECIALIZED_DIVISOR, mode);
+	if (tarval_cmp(vrp->range_bottom, one) & ir_relation_less)
+		return;
+	if (tarval_cmp(vrp->range_top, limit) & ir_relation_greater)
+		return;
+
+	/* the extra branch only pays off on hot paths */
+	ir_graph *irg = get_irn_irg(node);
+	if (get_block_execfreq(get_nodes_block(node))
+	    < get_block_execfreq(get_irg_start_block(irg)))
+		return;
+
+	ARR_APP1(ir_node*, *candidates, node);
+}
+
+/**
+ * Replace an unsigned Mod by a power-of-two test with an And on the fast
+ * path and the original Mod as fallback:
+ *
+ *    if ((d & (d-1)) == 0) r = x & (d-1); else r = x % d;
+ */
+static void specialize_mod(ir_node *mod)
+{
+	ir_graph *irg   = get_irn_irg(mod);
+	dbg_info *dbgi  = get_irn_dbg_info(mod);
+	ir_node  *left  = get_Mod_left(mod);
+	ir_node  *right = get_Mod_right(mod);
+	ir_node  *mem   = get_Mod_mem(mod);
+	ir_mode  *mode  = get_irn_mode(right);
+
+	ir_node *lower = part_block_edges(mod);
+	ir_node *upper = get_nodes_block(mod);
+
+	/* upper block: test whether the divisor is a power of two */
+	ir_node *one   = new_r_Const(irg, get_mode_one(mode));
+	ir_node *dec   = new_rd_Sub(dbgi, upper, right, one);
+	ir_node *conj  = new_rd_And(dbgi, upper, right, dec);
+	ir_node *zero  = new_r_Const_null(irg, mode);
+	ir_node *cmp   = new_rd_Cmp(dbgi, upper, conj, zero, ir_relation_equal);
+	ir_node *cond  = new_rd_Cond(dbgi, upper, cmp);
+	ir_node *projT = new_r_Proj(cond, mode_X, pn_Cond_true);
+	ir_node *projF = new_r_Proj(cond, mode_X, pn_Cond_false);
+
+	/* the slow path keeps the Mod */
+	ir_node *in_slow[] = { projF };
+	ir_node *slow      = new_r_Block(irg, ARRAY_SIZE(in_slow), in_slow);
+	set_nodes_block(mod, slow);
+	ir_node *jmp_slow  = new_r_Jmp(slow);
+
+	/* fast path: x % d == x & (d-1) for d a power of two */
+	ir_node *fast_res = new_rd_And(dbgi, upper, left, dec);
+
+	ir_node *in_lower[] = { projT, jmp_slow };
+	set_irn_in(lower, ARRAY_SIZE(in_lower), in_lower);
+
+	/* merge result and memory; on the fast path the memory passes through */
+	foreach_out_edge_safe(mod, edge) {
+		ir_node *proj = get_edge_src_irn(edge);
+		if (!is_Proj(proj))
+			continue;
+		unsigned pn = get_Proj_num(proj);
+		assert(pn == pn_Mod_res || pn == pn_Mod_M);
+		set_nodes_block(proj, slow);
+		ir_node *other    = pn == pn_Mod_res ? fast_res : mem;
+		ir_node *phi_in[] = { other, proj };
+		ir_node *phi      = new_rd_Phi(dbgi, lower, ARRAY_SIZE(phi_in),
+		                               phi_in, get_irn_mode(proj));
+		foreach_out_edge_safe(proj, user_edge) {
+			ir_node *user = get_edge_src_irn(user_edge);
+			if (user == phi)
+				continue;
+			set_irn_n(user, get_edge_src_pos(user_edge), phi);
+		}
+	}
+}
+
+void arch_dep_specialize_mods(ir_graph *irg)
+{
+	if (!settings.replace_mods)
+		return;
+
+	ir_estimate_execfreq(irg);
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
+
+	ir_node **candidates = NEW_ARR_F(ir_node*, 0);
+	irg_walk_graph(irg, collect_mod_candidates, NULL, &candidates);
+
+	if (ARR_LEN(candidates) > 0) {
+		for (size_t i = 0, n = ARR_LEN(candidates); i < n; ++i)
+			specialize_mod(candidates[i]);
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
+	} else {
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+	}
+	DEL_ARR_F(candidates);
+}
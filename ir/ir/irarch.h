@@ -103,6 +103,18 @@ ir_node *arch_dep_replace_div_by_const(ir_node *irn);
  */
 ir_node *arch_dep_replace_mod_by_const(ir_node *irn);
 
+/**
+ * Specializes unsigned Mods with a variable divisor for the common case
+ * that the divisor is a power of two at runtime (hash-table sizes etc.).
+ * When value range propagation proves the divisor non-zero and small, the
+ * Mod is replaced by a branch on `(d & (d-1)) == 0` with an And on the
+ * fast path and the original Mod as fallback. Only blocks at least as
+ * hot as the graph entry (by execution frequency estimate) are touched.
+ *
+ * Driven by the replace_mods setting of ir_arch_lower().
+ */
+void arch_dep_specialize_mods(ir_graph *irg);
+
 /**
  * Initialize machine dependent mul/div/mod with constant localopts and
  * run optimize_graph_df() once to do the replacements.
@@ -109,31 +109,28 @@ static const char *get_entity_name_or_null_str(const ir_entity *const ent)
 }
 
 /**
- * emit a Firm object
+ * Formats a Firm object like the %F conversion: the main part into
+ * @p buf and the trailing [number] part (the + flag) into @p add.
+ * This is shared between the runtime format dispatcher and the
+ * direct ir_fprint_*() emitters.
  */
-static int firm_emit(lc_appendable_t *app, const lc_arg_occ_t *occ,
-                     const lc_arg_value_t *arg)
+void firm_format_obj(char *buf, size_t buf_size, char *add, size_t add_size,
+                     const void *X, char conversion, bool with_kind)
 {
-	void *X = (void*)arg->v_ptr;
-	if (X == NULL)
-		return lc_arg_append(app, occ, "(null)", 6);
-
-	char buf[256];
 	buf[0] = '\0';
-	char add[64];
 	add[0] = '\0';
 
-#define A(s)    occ->flag_hash ? s " ": ""
-	firm_kind *obj = (firm_kind*)X;
+#define A(s)    with_kind ? s " ": ""
+	const firm_kind *obj = (const firm_kind*)X;
 	switch (*obj) {
 	case k_BAD:
-		snprintf(buf, sizeof(buf), "BAD");
-		snprintf(add, sizeof(add), "[%p]", X);
+		snprintf(buf, buf_size, "BAD");
+		snprintf(add, add_size, "[%p]", X);
 		break;
 	case k_entity: {
 		ir_entity const *const entity = (ir_entity const*)X;
-		print_entity_name(buf, sizeof(buf), A("ent"), entity);
-		snprintf(add, sizeof(add), "[%ld]", get_entity_nr(entity));
+		print_entity_name(buf, buf_size, A("ent"), entity);
+		snprintf(add, add_size, "[%ld]", get_entity_nr(entity));
 		break;
 	}
 	case k_type: {
@@ -141,32 +138,32 @@ static int firm_emit(lc_appendable_t *app, const lc_arg_occ_t *occ,
 		char type_name[256];
 		ir_print_type(type_name, sizeof(type_name), type);
 		tp_opcode opcode = get_type_opcode(type);
-		snprintf(buf, sizeof(buf), "%s%s:%s", A("type"),
+		snprintf(buf, buf_size, "%s%s:%s", A("type"),
 		         get_type_opcode_name(opcode), type_name);
-		snprintf(add, sizeof(add), "[%ld]", get_type_nr(type));
+		snprintf(add, add_size, "[%ld]", get_type_nr(type));
 		break;
 	}
 	case k_ir_graph: {
 		ir_graph *irg = (ir_graph*)X;
 		if (irg == get_const_code_irg())
-			snprintf(buf, sizeof(buf), "%s<ConstCodeIrg>", A("irg"));
+			snprintf(buf, buf_size, "%s<ConstCodeIrg>", A("irg"));
 		else
-			ir_snprintf(buf, sizeof(buf), "%s%F", A("irg"), get_irg_entity(irg));
-		snprintf(add, sizeof(add), "[%ld]", get_irg_graph_nr(irg));
+			ir_snprintf(buf, buf_size, "%s%F", A("irg"), get_irg_entity(irg));
+		snprintf(add, add_size, "[%ld]", get_irg_graph_nr(irg));
 		break;
 	}
 	case k_ir_node: {
 		ir_node *node = (ir_node*)X;
-		switch (occ->conversion) {
+		switch (conversion) {
 		case 'B': {
 			ir_node *const block = get_block(node);
-			snprintf(buf, sizeof(buf), "%s%s %s", A("irn"),
+			snprintf(buf, buf_size, "%s%s %s", A("irn"),
 			         get_irn_opname(block), get_mode_name(get_irn_mode(block)));
-			snprintf(add, sizeof(add), "[%ld]", get_irn_node_nr(block));
+			snprintf(add, add_size, "[%ld]", get_irn_node_nr(block));
 			break;
 		}
 		case 'N':
-			snprintf(buf, sizeof(buf), "%ld", get_irn_node_nr(node));
+			snprintf(buf, buf_size, "%ld", get_irn_node_nr(node));
 			break;
 		default:
 			if (is_Const(node)) {
@@ -176,49 +173,66 @@ static int firm_emit(lc_appendable_t *app, const lc_arg_occ_t *occ,
 					tarval_snprintf(tv_buf, sizeof(tv_buf), tv);
 				else
 					strncpy(tv_buf, "(NULL)", sizeof(tv_buf));
-				snprintf(buf, sizeof(buf), "%s%s %s<%s>", A("irn"), get_irn_opname(node),
+				snprintf(buf, buf_size, "%s%s %s<%s>", A("irn"), get_irn_opname(node),
 				         get_mode_name(get_irn_mode(node)), tv_buf);
 			} else if (is_Address(node)) {
 				const char *entity_name = get_entity_name_or_null_str(get_Address_entity(node));
-				snprintf(buf, sizeof(buf), "%s%s %s[%s]", A("irn"), get_irn_opname(node),
+				snprintf(buf, buf_size, "%s%s %s[%s]", A("irn"), get_irn_opname(node),
 				         get_mode_name(get_irn_mode(node)), entity_name);
 			} else if (is_Member(node)) {
 				const char *entity_name = get_entity_name_or_null_str(get_Member_entity(node));
-				snprintf(buf, sizeof(buf), "%s%s %s[%s]", A("irn"), get_irn_opname(node),
+				snprintf(buf, buf_size, "%s%s %s[%s]", A("irn"), get_irn_opname(node),
 				         get_mode_name(get_irn_mode(node)), entity_name);
 			} else if (is_Cmp(node)) {
 				ir_relation relation = get_Cmp_relation(node);
-				snprintf(buf, sizeof(buf), "%s%s %s", A("irn"), get_irn_opname(node), get_relation_string(relation));
+				snprintf(buf, buf_size, "%s%s %s", A("irn"), get_irn_opname(node), get_relation_string(relation));
 			} else {
-				snprintf(buf, sizeof(buf), "%s%s %s", A("irn"), get_irn_opname(node),
+				snprintf(buf, buf_size, "%s%s %s", A("irn"), get_irn_opname(node),
 				         get_mode_name(get_irn_mode(node)));
 			}
-			snprintf(add, sizeof(add), "[%ld:%u]", get_irn_node_nr(node), get_irn_idx(node));
+			snprintf(add, add_size, "[%ld:%u]", get_irn_node_nr(node), get_irn_idx(node));
 		}
 		break;
 	}
 	case k_ir_mode: {
 		ir_mode *mode = (ir_mode*)X;
-		snprintf(buf, sizeof(buf), "%s%s", A("mode"), get_mode_name(mode));
+		snprintf(buf, buf_size, "%s%s", A("mode"), get_mode_name(mode));
 		break;
 	}
 	case k_tarval: {
 		ir_tarval *tarval = (ir_tarval*)X;
 		char tv_buf[256];
 		tarval_snprintf(tv_buf, sizeof(tv_buf), tarval);
-		snprintf(buf, sizeof(buf), "%s%s", A("tv"), tv_buf);
+		snprintf(buf, buf_size, "%s%s", A("tv"), tv_buf);
 		break;
 	}
 	case k_ir_loop: {
 		ir_loop *loop = (ir_loop*)X;
-		snprintf(buf, sizeof(buf), "loop[%ld:%u]", get_loop_loop_nr(loop), get_loop_depth(loop));
+		snprintf(buf, buf_size, "loop[%ld:%u]", get_loop_loop_nr(loop), get_loop_depth(loop));
 		break;
 	}
 
 	default:
-		snprintf(buf, sizeof(buf), "UNKWN");
-		snprintf(add, sizeof(add), "[%p]", X);
+		snprintf(buf, buf_size, "UNKWN");
+		snprintf(add, add_size, "[%p]", X);
 	}
+#undef A
+}
+
+/**
+ * emit a Firm object
+ */
+static int firm_emit(lc_appendable_t *app, const lc_arg_occ_t *occ,
+                     const lc_arg_value_t *arg)
+{
+	const void *X = arg->v_ptr;
+	if (X == NULL)
+		return lc_arg_append(app, occ, "(null)", 6);
+
+	char buf[256];
+	char add[64];
+	firm_format_obj(buf, sizeof(buf), add, sizeof(add), X, occ->conversion,
+	                occ->flag_hash);
 
 	if (occ->flag_plus)
 		strncat(buf, add, sizeof(buf)-strlen(buf)-1);
@@ -226,7 +240,6 @@ static int firm_emit(lc_appendable_t *app, const lc_arg_occ_t *occ,
 	size_t size = strlen(buf);
 	lc_arg_append(app, occ, buf, size);
 	return size;
-#undef A
 }
 
 /**
@@ -11,6 +11,8 @@
 #define FIRM_IR_IRARGS_H
 
 #include "lc_printf.h"
+#include <stdbool.h>
+#include <stddef.h>
 
 /**
  * Get the firm printf arg environment.
@@ -18,4 +20,13 @@
  */
 lc_arg_env_t *firm_get_arg_env(void);
 
+/**
+ * Formats the Firm object @p obj like the %F conversion: the main part
+ * into @p buf, the trailing [number] part (the + flag) into @p add.
+ * @p conversion selects the node sub-format ('B', 'N' or '\0'),
+ * @p with_kind prefixes the kind as the # flag does.
+ */
+void firm_format_obj(char *buf, size_t buf_size, char *add, size_t add_size,
+                     const void *obj, char conversion, bool with_kind);
+
 #endif
@@ -0,0 +1,311 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Content hashing of ir graphs and a persistent hash cache.
+ *
+ * The hash is computed over a canonical form of the graph: nodes are
+ * numbered in walker order, so node numbers, addresses and debug info do
+ * not influence the result. Two structurally identical graphs - for
+ * example the same function in a repeated build - therefore hash to the
+ * same value, which allows a driver to skip re-optimizing functions that
+ * did not change since the last run.
+ */
+#include <stdlib.h>
+
+#include "array.h"
+#include "irgwalk.h"
+#include "irio.h"
+#include "irnode_t.h"
+#include "irnodemap.h"
+#include "tv.h"
+#include "type_t.h"
+#include "util.h"
+
+/* 64bit FNV-1a */
+static uint64_t hash_word(uint64_t hash, uint64_t value)
+{
+	for (unsigned i = 0; i < 8; ++i) {
+		hash = (hash ^ (value & 0xFF)) * UINT64_C(0x100000001B3);
+		value >>= 8;
+	}
+	return hash;
+}
+
+static uint64_t hash_str(uint64_t hash, char const *str)
+{
+	for (; *str != '\0'; ++str) {
+		hash = (hash ^ (unsigned char)*str) * UINT64_C(0x100000001B3);
+	}
+	return hash;
+}
+
+/**
+ * Mixes the aspects of @p type which influence the generated code into
+ * the hash. Named types are identified by name, everything else by its
+ * size, so layout changes of a used type change the hash.
+ */
+static uint64_t hash_type(uint64_t hash, ir_type const *const type)
+{
+	hash = hash_word(hash, get_type_opcode(type));
+	if (is_Method_type(type)) {
+		size_t const n_params = get_method_n_params(type);
+		size_t const n_ress   = get_method_n_ress(type);
+		hash = hash_word(hash, n_params);
+		hash = hash_word(hash, n_ress);
+		for (size_t i = 0; i < n_params; ++i) {
+			hash = hash_word(hash, get_type_size(get_method_param_type(type, i)));
+		}
+		for (size_t i = 0; i < n_ress; ++i) {
+			hash = hash_word(hash, get_type_size(get_method_res_type(type, i)));
+		}
+	} else {
+		hash = hash_word(hash, get_type_size(type));
+	}
+	return hash;
+}
+
+static uint64_t hash_tarval(uint64_t hash, ir_tarval *const tv)
+{
+	ir_mode *const mode = get_tarval_mode(tv);
+	hash = hash_str(hash, get_mode_name(mode));
+	if (mode_is_int(mode) || mode_is_float(mode) || mode_is_reference(mode)) {
+		unsigned const n_bytes = (get_mode_size_bits(mode) + 7) / 8;
+		for (unsigned i = 0; i < n_bytes; ++i) {
+			hash = hash_word(hash, get_tarval_sub_bits(tv, i));
+		}
+	}
+	return hash;
+}
+
+typedef struct hash_env_t {
+	ir_nodemap ids;     /**< maps nodes to their canonical number + 1 */
+	uintptr_t  next_id;
+	uint64_t   hash;
+} hash_env_t;
+
+static uintptr_t get_node_id(hash_env_t const *const env, ir_node const *const node)
+{
+	uintptr_t const id = (uintptr_t)ir_nodemap_get(void, &env->ids, node);
+	assert(id != 0);
+	return id;
+}
+
+/** Pre-walker: numbers the nodes in walker order. */
+static void assign_id(ir_node *const node, void *const data)
+{
+	hash_env_t *const env = (hash_env_t*)data;
+	ir_nodemap_insert(&env->ids, node, (void*)++env->next_id);
+}
+
+/** Post-walker: mixes a node and its operands into the hash. */
+static void hash_node(ir_node *const node, void *const data)
+{
+	hash_env_t *const env  = (hash_env_t*)data;
+	uint64_t          hash = env->hash;
+
+	hash = hash_word(hash, get_node_id(env, node));
+	hash = hash_str(hash, get_irn_opname(node));
+	hash = hash_str(hash, get_mode_name(get_irn_mode(node)));
+	if (!is_Block(node))
+		hash = hash_word(hash, get_node_id(env, get_nodes_block(node)));
+	int const arity = get_irn_arity(node);
+	hash = hash_word(hash, arity);
+	for (int i = 0; i < arity; ++i) {
+		hash = hash_word(hash, get_node_id(env, get_irn_n(node, i)));
+	}
+
+	/* the attributes which are not implied by opcode and mode */
+	switch ((ir_opcode)get_irn_opcode(node)) {
+	case iro_ASM:
+		hash = hash_str(hash, get_id_str(get_ASM_text(node)));
+		break;
+	case iro_Address:
+		hash = hash_str(hash, get_entity_ld_name(get_Address_entity(node)));
+		break;
+	case iro_Align:
+		hash = hash_type(hash, get_Align_type(node));
+		break;
+	case iro_Alloc:
+		hash = hash_word(hash, get_Alloc_alignment(node));
+		break;
+	case iro_Builtin:
+		hash = hash_word(hash, get_Builtin_kind(node));
+		break;
+	case iro_Call:
+		hash = hash_type(hash, get_Call_type(node));
+		break;
+	case iro_Cmp:
+		hash = hash_word(hash, get_Cmp_relation(node));
+		break;
+	case iro_Confirm:
+		hash = hash_word(hash, get_Confirm_relation(node));
+		break;
+	case iro_Const:
+		hash = hash_tarval(hash, get_Const_tarval(node));
+		break;
+	case iro_CopyB:
+		hash = hash_type(hash, get_CopyB_type(node));
+		hash = hash_word(hash, get_CopyB_volatility(node));
+		break;
+	case iro_Div:
+		hash = hash_str(hash, get_mode_name(get_Div_resmode(node)));
+		hash = hash_word(hash, get_Div_no_remainder(node));
+		break;
+	case iro_Load:
+		hash = hash_str(hash, get_mode_name(get_Load_mode(node)));
+		hash = hash_type(hash, get_Load_type(node));
+		hash = hash_word(hash, get_Load_volatility(node));
+		hash = hash_word(hash, get_Load_unaligned(node));
+		break;
+	case iro_Member:
+		hash = hash_str(hash, get_entity_ld_name(get_Member_entity(node)));
+		break;
+	case iro_Mod:
+		hash = hash_str(hash, get_mode_name(get_Mod_resmode(node)));
+		break;
+	case iro_Offset:
+		hash = hash_str(hash, get_entity_ld_name(get_Offset_entity(node)));
+		break;
+	case iro_Phi:
+		hash = hash_word(hash, get_Phi_loop(node));
+		break;
+	case iro_Proj:
+		hash = hash_word(hash, get_Proj_num(node));
+		break;
+	case iro_Sel:
+		hash = hash_type(hash, get_Sel_type(node));
+		break;
+	case iro_Size:
+		hash = hash_type(hash, get_Size_type(node));
+		break;
+	case iro_Store:
+		hash = hash_type(hash, get_Store_type(node));
+		hash = hash_word(hash, get_Store_volatility(node));
+		hash = hash_word(hash, get_Store_unaligned(node));
+		break;
+	case iro_Switch: {
+		ir_switch_table const *const table = get_Switch_table(node);
+		size_t const n_entries = ir_switch_table_get_n_entries(table);
+		hash = hash_word(hash, n_entries);
+		for (size_t i = 0; i < n_entries; ++i) {
+			hash = hash_tarval(hash, ir_switch_table_get_min(table, i));
+			hash = hash_tarval(hash, ir_switch_table_get_max(table, i));
+			hash = hash_word(hash, ir_switch_table_get_pn(table, i));
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	env->hash = hash;
+}
+
+uint64_t ir_graph_content_hash(ir_graph *const irg)
+{
+	ir_entity *const ent = get_irg_entity(irg);
+
+	hash_env_t env;
+	ir_nodemap_init(&env.ids, irg);
+	env.next_id = 0;
+	env.hash    = UINT64_C(0xCBF29CE484222325);
+
+	env.hash = hash_str(env.hash, get_entity_ld_name(ent));
+	env.hash = hash_type(env.hash, get_entity_type(ent));
+	irg_walk_graph(irg, assign_id, NULL, &env);
+	irg_walk_graph(irg, NULL, hash_node, &env);
+
+	ir_nodemap_destroy(&env.ids);
+	return env.hash;
+}
+
+/** The loaded cache: a lazily sorted array of graph hashes. */
+static uint64_t *cache_hashes;
+static bool      cache_sorted;
+
+static void init_cache(void)
+{
+	if (cache_hashes == NULL)
+		cache_hashes = NEW_ARR_F(uint64_t, 0);
+}
+
+static int compare_hashes(void const *const a, void const *const b)
+{
+	uint64_t const hash_a = *(uint64_t const*)a;
+	uint64_t const hash_b = *(uint64_t const*)b;
+	if (hash_a < hash_b)
+		return -1;
+	if (hash_a > hash_b)
+		return 1;
+	return 0;
+}
+
+int ir_cache_load(char const *const filename)
+{
+	init_cache();
+	FILE *const file = fopen(filename, "r");
+	if (file == NULL) {
+		/* a missing cache is not an error, merely a cold one */
+		return 0;
+	}
+
+	int                res = 0;
+	unsigned long long value;
+	while (fscanf(file, "%llx", &value) == 1) {
+		ARR_APP1(uint64_t, cache_hashes, (uint64_t)value);
+	}
+	if (ferror(file))
+		res = 1;
+	fclose(file);
+	cache_sorted = false;
+	return res;
+}
+
+int ir_cache_contains(uint64_t const hash)
+{
+	if (cache_hashes == NULL)
+		return 0;
+	if (!cache_sorted) {
+		QSORT_ARR(cache_hashes, compare_hashes);
+		cache_sorted = true;
+	}
+	return bsearch(&hash, cache_hashes, ARR_LEN(cache_hashes),
+	               sizeof(cache_hashes[0]), compare_hashes) != NULL;
+}
+
+void ir_cache_insert(uint64_t const hash)
+{
+	init_cache();
+	if (ir_cache_contains(hash))
+		return;
+	ARR_APP1(uint64_t, cache_hashes, hash);
+	cache_sorted = false;
+}
+
+int ir_cache_store(char const *const filename)
+{
+	FILE *const file = fopen(filename, "w");
+	if (file == NULL)
+		return 1;
+	if (cache_hashes != NULL) {
+		for (size_t i = 0, n = ARR_LEN(cache_hashes); i < n; ++i) {
+			fprintf(file, "%llx\n", (unsigned long long)cache_hashes[i]);
+		}
+	}
+	int const res = ferror(file) ? 1 : 0;
+	fclose(file);
+	return res;
+}
+
+void ir_cache_free(void)
+{
+	if (cache_hashes == NULL)
+		return;
+	DEL_ARR_F(cache_hashes);
+	cache_hashes = NULL;
+	cache_sorted = false;
+}
@@ -211,10 +211,18 @@ void mature_immBlock(ir_node *block)
 	if (get_Block_matured(block))
 		return;
 
+	ir_graph *const irg = get_irn_irg(block);
+
+	/* in deferred mode just record the block; irg_finalize_cons() matures
+	 * all recorded blocks in one batch */
+	if (irg->pending_mature != NULL) {
+		ARR_APP1(ir_node*, irg->pending_mature, block);
+		return;
+	}
+
 	set_Block_matured(block, 1);
 
 	/* Create final in-array for the block. */
-	ir_graph *const irg = get_irn_irg(block);
 	if (block->attr.block.dynamic_ins) {
 		/* Attach a Bad predecessor if there is no other. This is necessary to
 		 * fulfill the invariant that all nodes can be found through reverse
@@ -507,8 +515,52 @@ void ir_set_uninitialized_local_variable_func(
 	default_initialize_local_variable = func;
 }
 
+void ir_defer_block_maturation(ir_graph *irg)
+{
+	assert(irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_CONSTRUCTION));
+	if (irg->pending_mature == NULL)
+		irg->pending_mature = NEW_ARR_F(ir_node*, 0);
+}
+
+/**
+ * Mature a recorded block after all its predecessor blocks, so reading
+ * the Phi operands mostly hits matured blocks and yields real values.
+ * Cycles are broken by the block visited mark; reads from blocks still on
+ * the recursion stack use Phi0 placeholders as in the eager scheme.
+ */
+static void mature_pending_block(ir_node *block)
+{
+	if (Block_block_visited(block))
+		return;
+	mark_Block_block_visited(block);
+
+	if (get_Block_matured(block))
+		return;
+
+	for (int i = 0, n = get_irn_arity(block); i < n; ++i) {
+		ir_node *const pred_block = get_Block_cfgpred_block(block, i);
+		if (pred_block != NULL)
+			mature_pending_block(pred_block);
+	}
+	mature_immBlock(block);
+}
+
 void irg_finalize_cons(ir_graph *irg)
 {
+	if (irg->pending_mature != NULL) {
+		ir_node **const pending = irg->pending_mature;
+		/* let mature_immBlock() work directly again */
+		irg->pending_mature = NULL;
+
+		ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+		inc_irg_block_visited(irg);
+		for (size_t i = 0, n = ARR_LEN(pending); i < n; ++i) {
+			mature_pending_block(pending[i]);
+		}
+		ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+		DEL_ARR_F(pending);
+	}
+
 	ir_node *end_block = get_irg_end_block(irg);
 	mature_immBlock(end_block);
 
@@ -22,6 +22,7 @@
 #include "irhooks.h"
 #include "irloop_t.h"
 #include "irnode_t.h"
+#include "irnodeset.h"
 #include "irop_t.h"
 #include "irouts_t.h"
 #include "irprintf.h"
@@ -192,6 +193,9 @@ static bool get_opt_dump_const_local(void)
 
 static char *dump_filter;
 
+/** If set, only nodes in this set are dumped (see dump_ir_subgraph()). */
+static ir_nodeset_t *dump_region;
+
 void ir_set_dump_filter(const char *new_filter)
 {
 	free(dump_filter);
@@ -562,6 +566,8 @@ static void ird_walk_graph(ir_graph *irg, irg_walk_func *pre, irg_walk_func *pos
 static void collect_node(ir_node *node, void *env)
 {
 	(void)env;
+	if (dump_region != NULL && !ir_nodeset_contains(dump_region, node))
+		return;
 	if (is_Block(node)
 	    || node_floats(node)
 	    || (get_op_flags(get_irn_op(node)) & irop_flag_dump_noblock)) {
@@ -628,11 +634,13 @@ void dump_node_opcode(FILE *F, const ir_node *n)
 	/* implementation for default nodes */
 	switch (get_irn_opcode(n)) {
 	case iro_Address:
-		ir_fprintf(F, "%s &%F", name, get_Address_entity(n));
+		fprintf(F, "%s &", name);
+		ir_fprint_entity(F, get_Address_entity(n));
 		break;
 
 	case iro_Align:
-		ir_fprintf(F, "%s %+F", name, get_Align_type(n));
+		fprintf(F, "%s ", name);
+		ir_fprint_type(F, get_Align_type(n));
 		break;
 
 	case iro_Block: {
@@ -652,7 +660,8 @@ void dump_node_opcode(FILE *F, const ir_node *n)
 		break;
 
 	case iro_Const:
-		ir_fprintf(F, "%s %T", name, get_Const_tarval(n));
+		fprintf(F, "%s ", name);
+		ir_fprint_tarval(F, get_Const_tarval(n));
 		break;
 
 	case iro_Div:
@@ -679,11 +688,13 @@ void dump_node_opcode(FILE *F, const ir_node *n)
 		break;
 
 	case iro_Offset:
-		ir_fprintf(F, "%s %F", name, get_Offset_entity(n));
+		fprintf(F, "%s ", name);
+		ir_fprint_entity(F, get_Offset_entity(n));
 		break;
 
 	case iro_Size:
-		ir_fprintf(F, "%s %+F", name, get_Size_type(n));
+		fprintf(F, "%s ", name);
+		ir_fprint_type(F, get_Size_type(n));
 		break;
 
 	case iro_Store: {
@@ -745,9 +756,11 @@ static void dump_node_nodeattr(FILE *F, const ir_node *n)
 				ir_switch_table_entry const *const entry = ir_switch_table_get_entry_const(table, i);
 				if (entry->pn != proj_nr)
 					continue;
-				ir_fprintf(F, "%s%T", sep, entry->min);
+				fputs(sep, F);
+				ir_fprint_tarval(F, entry->min);
 				if (entry->min != entry->max)
-					ir_fprintf(F, "...%T", entry->max);
+					fputs("...", F);
+					ir_fprint_tarval(F, entry->max);
 				sep = ", ";
 			}
 			fputc(' ', F);
@@ -786,7 +799,9 @@ static void dump_node_nodeattr(FILE *F, const ir_node *n)
 		fprintf(F, "%s ", get_relation_string(get_Confirm_relation(n)));
 		break;
 	case iro_CopyB:
-		ir_fprintf(F, "(%+F)", get_CopyB_type(n));
+		fputc('(', F);
+		ir_fprint_type(F, get_CopyB_type(n));
+		fputc(')', F);
 		break;
 
 	default:
@@ -1129,6 +1144,11 @@ void dump_ir_data_edges(FILE *F, const ir_node *n)
 	}
 
 	foreach_irn_in(n, i, pred) {
+		/* suppress dangling edges in region dumps, except to constants
+		 * which get dumped as local copies anyway */
+		if (dump_region != NULL && !ir_nodeset_contains(dump_region, pred)
+		    && !(get_opt_dump_const_local() && is_irn_constlike(pred)))
+			continue;
 		if ((flags & ir_dump_flag_back_edges) && is_backedge(n, i)) {
 			fprintf(F, "backedge: {sourcename: ");
 		} else {
@@ -1373,7 +1393,7 @@ void dump_type_node(FILE *F, ir_type *tp)
 		tp_opcode opcode = get_type_opcode(tp);
 		fprintf(F, "%s '%s'", get_type_opcode_name(opcode), buf);
 	} else {
-		ir_fprintf(F, "%+F", tp);
+		ir_fprint_type(F, tp);
 	}
 	fputs("\" info1: \"", F);
 	dump_type_to_file(F, tp);
@@ -1569,7 +1589,7 @@ static void dump_loop_son_edge(FILE *F, const ir_loop *loop, size_t i)
 	print_loopid(F, loop);
 	fprintf(F, " targetname: ");
 	print_loopid(F, get_loop_element(loop, i).son);
-	ir_fprintf(F, " color: darkgreen label: \"%zu\"}\n", i);
+	fprintf(F, " color: darkgreen label: \"%zu\"}\n", i);
 }
 
 static void dump_loops(FILE *F, const ir_loop *loop)
@@ -2196,6 +2216,45 @@ void dump_ir_graph(ir_graph *graph, const char *suffix)
 	dump_ir_graph_ext(dump_ir_graph_file, graph, buf);
 }
 
+/**
+ * Inserts @p node, its block and everything within @p depth steps of its
+ * inputs (and users, if out edges are available) into @p region.
+ */
+static void mark_region(ir_nodeset_t *region, ir_node *node, unsigned depth)
+{
+	if (!ir_nodeset_insert(region, node))
+		return;
+	if (!is_Block(node)) {
+		ir_node *const block = get_nodes_block(node);
+		ir_nodeset_insert(region, block);
+	}
+	if (depth == 0)
+		return;
+	foreach_irn_in(node, i, pred) {
+		mark_region(region, pred, depth - 1);
+	}
+	if (edges_activated(get_irn_irg(node))) {
+		foreach_out_edge(node, edge) {
+			mark_region(region, get_edge_src_irn(edge), depth - 1);
+		}
+	}
+}
+
+void dump_ir_subgraph(ir_graph *graph, const char *suffix,
+                      ir_node *const *nodes, size_t n_nodes, unsigned depth)
+{
+	ir_nodeset_t region;
+	ir_nodeset_init(&region);
+	for (size_t i = 0; i < n_nodes; ++i) {
+		mark_region(&region, nodes[i], depth);
+	}
+
+	dump_region = &region;
+	dump_ir_graph(graph, suffix);
+	dump_region = NULL;
+	ir_nodeset_destroy(&region);
+}
+
 void dump_all_ir_graphs(const char *suffix)
 {
 	foreach_irp_irg(i, irg) {
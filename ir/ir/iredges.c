@@ -16,43 +16,15 @@
 
 #include "bitset.h"
 #include "debug.h"
-#include "hashptr.h"
 #include "irdump_t.h"
 #include "iredgekinds.h"
-#include "iredgeset.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
 #include "irnodemap.h"
 #include "iropt_t.h"
 #include "irprintf.h"
-#include "set.h"
-
-#define DO_REHASH
-#define SCALAR_RETURN
-#define HashSet                   ir_edgeset_t
-#define HashSetIterator           ir_edgeset_iterator_t
-#define ValueType                 ir_edge_t*
-#define NullValue                 NULL
-#define DeletedValue              ((ir_edge_t*)-1)
-#define Hash(this,key)            (hash_ptr(key->src) ^ (key->pos * 40013))
-#define KeysEqual(this,key1,key2) ((key1->src) == (key2->src) && (key1->pos == key2->pos))
-#define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof((ptr)[0]))
-
-#define hashset_init            ir_edgeset_init
-void ir_edgeset_init_size(ir_edgeset_t *self, size_t size);
-#define hashset_init_size       ir_edgeset_init_size
-#define hashset_destroy         ir_edgeset_destroy
-#define hashset_insert          ir_edgeset_insert
-#define hashset_remove          ir_edgeset_remove
-ir_edge_t *ir_edgeset_find(const ir_edgeset_t *self, const ir_edge_t* key);
-#define hashset_find            ir_edgeset_find
-size_t ir_edgeset_size(const ir_edgeset_t *self);
-#define hashset_size            ir_edgeset_size
-#define hashset_iterator_init   ir_edgeset_iterator_init
-#define hashset_iterator_next   ir_edgeset_iterator_next
-#define hashset_remove_iterator ir_edgeset_remove_iterator
-
-#include "hashset.c.h"
+#include "pset.h"
+#include "util.h"
 
 /**
  * A function that allows for setting an edge.
@@ -138,21 +110,45 @@ static inline long edge_get_id(const ir_edge_t *e)
 void edges_init_graph_kind(ir_graph *irg, ir_edge_kind_t kind)
 {
 	if (edges_activated_kind(irg, kind)) {
-		irg_edge_info_t *info   = get_irg_edge_info(irg, kind);
-		size_t           amount = get_irg_last_idx(irg) * 5 / 4;
+		irg_edge_info_t *info = get_irg_edge_info(irg, kind);
 
-		if (info->allocated) {
-			amount = ir_edgeset_size(&info->edges);
-			ir_edgeset_destroy(&info->edges);
+		if (info->allocated)
 			obstack_free(&info->edges_obst, NULL);
-		}
 		obstack_init(&info->edges_obst);
 		INIT_LIST_HEAD(&info->free_edges);
-		ir_edgeset_init_size(&info->edges, amount);
 		info->allocated = 1;
 	}
 }
 
+/**
+ * Returns the slot holding the edge object for (src, pos), or NULL if no
+ * slot exists and @p grow is false. Slots are indexed by pos + 1 since
+ * normal edges use position -1 for a node's block edge. The slot arrays
+ * live on the edge obstack; outgrown arrays are abandoned there and
+ * reclaimed when the edges are deactivated.
+ */
+static ir_edge_t **edge_slot(ir_node *src, int pos, ir_edge_kind_t kind,
+                             irg_edge_info_t *info, bool grow)
+{
+	irn_edge_info_t *src_info = get_irn_edge_info(src, kind);
+	unsigned   const idx      = (unsigned)(pos + 1);
+	if (idx >= src_info->n_in_edges) {
+		if (!grow)
+			return NULL;
+		/* size for the full arity up front so the usual build pattern
+		 * (ascending positions) allocates only once per node */
+		unsigned const arity = edge_kind_info[kind].get_arity(src) + 1;
+		unsigned       new_size = MAX(idx + 1, arity);
+		new_size = MAX(new_size, src_info->n_in_edges * 2);
+		ir_edge_t **const new_edges
+			= OALLOCNZ(&info->edges_obst, ir_edge_t*, new_size);
+		MEMCPY(new_edges, src_info->in_edges, src_info->n_in_edges);
+		src_info->in_edges   = new_edges;
+		src_info->n_in_edges = new_size;
+	}
+	return &src_info->in_edges[idx];
+}
+
 /**
  * Change the out count
  *
@@ -193,18 +189,20 @@ static inline void verify_list_head(ir_node *irn, ir_edge_kind_t kind)
 	del_pset(lh_set);
 }
 
+static void dump_node_edges(ir_node *irn, void *data)
+{
+	ir_edge_kind_t kind = *(ir_edge_kind_t*)data;
+	foreach_out_edge_kind(irn, e, kind) {
+		ir_printf("%+F %d\n", e->src, e->pos);
+	}
+}
+
 void edges_dump_kind(ir_graph *irg, ir_edge_kind_t kind)
 {
 	if (!edges_activated_kind(irg, kind))
 		return;
 
-	irg_edge_info_t       *info  = get_irg_edge_info(irg, kind);
-	ir_edgeset_t          *edges = &info->edges;
-	ir_edge_t             *e;
-	ir_edgeset_iterator_t  iter;
-	foreach_ir_edgeset(edges, e, iter) {
-		ir_printf("%+F %d\n", e->src, e->pos);
-	}
+	irg_walk_anchors(irg, dump_node_edges, NULL, &kind);
 }
 
 static void add_edge(ir_node *src, int pos, ir_node *tgt, ir_edge_kind_t kind,
@@ -213,8 +211,7 @@ static void add_edge(ir_node *src, int pos, ir_node *tgt, ir_edge_kind_t kind,
 	if (tgt == NULL)
 		return;
 	assert(edges_activated_kind(irg, kind));
-	irg_edge_info_t *info  = get_irg_edge_info(irg, kind);
-	ir_edgeset_t    *edges = &info->edges;
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
 
 	irn_edge_info_t  *tgt_info = get_irn_edge_info(tgt, kind);
 	struct list_head *head     = &tgt_info->outs_head;
@@ -230,16 +227,14 @@ static void add_edge(ir_node *src, int pos, ir_node *tgt, ir_edge_kind_t kind,
 		list_del(&edge->list);
 	}
 
-	edge->src     = src;
-	edge->pos     = pos;
-#ifdef DEBUG_libfirm
-	edge->present = false;
-#endif
+	edge->src = src;
+	edge->pos = pos;
 
-	ir_edge_t *new_edge = ir_edgeset_insert(edges, edge);
-	assert(new_edge == edge);
+	ir_edge_t **const slot = edge_slot(src, pos, kind, info, true);
+	assert(*slot == NULL);
+	*slot = edge;
 
-	list_add(&new_edge->list, head);
+	list_add(&edge->list, head);
 	edge_change_cnt(tgt_info, +1);
 }
 
@@ -250,23 +245,16 @@ static void delete_edge(ir_node *src, int pos, ir_node *old_tgt,
 		return;
 	assert(edges_activated_kind(irg, kind));
 
-	irg_edge_info_t *info  = get_irg_edge_info(irg, kind);
-	ir_edgeset_t    *edges = &info->edges;
-
-	/* Initialize the edge template to search in the set. */
-	ir_edge_t templ;
-	templ.src = src;
-	templ.pos = pos;
-
-	/* search the edge in the set. */
-	ir_edge_t *edge = ir_edgeset_find(edges, &templ);
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
 
-	/* mark the edge invalid if it was found */
-	if (edge == NULL)
+	/* look the edge up in the source's slot array. */
+	ir_edge_t **const slot = edge_slot(src, pos, kind, info, false);
+	if (slot == NULL || *slot == NULL)
 		return;
+	ir_edge_t *edge = *slot;
+	*slot = NULL;
 
 	list_del(&edge->list);
-	ir_edgeset_remove(edges, edge);
 	list_add(&edge->list, &info->free_edges);
 	edge->pos = -2;
 	edge->src = NULL;
@@ -289,8 +277,7 @@ static void edges_notify_edge_kind(ir_node *src, int pos, ir_node *tgt, ir_node
 	if (tgt == old_tgt)
 		return;
 
-	irg_edge_info_t *info  = get_irg_edge_info(irg, kind);
-	ir_edgeset_t    *edges = &info->edges;
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
 
 	/* The target is not NULL and the old target differs
 	 * from the new target, the edge shall be moved (if the
@@ -301,13 +288,9 @@ static void edges_notify_edge_kind(ir_node *src, int pos, ir_node *tgt, ir_node
 	assert(head->next && head->prev &&
 	       "target list head must have been initialized");
 
-	/* Initialize the edge template to search in the set. */
-	ir_edge_t templ;
-	templ.src = src;
-	templ.pos = pos;
-
-	ir_edge_t *edge = ir_edgeset_find(edges, &templ);
-	assert(edge && "edge to redirect not found!");
+	ir_edge_t **const slot = edge_slot(src, pos, kind, info, false);
+	assert(slot != NULL && *slot != NULL && "edge to redirect not found!");
+	ir_edge_t *edge = *slot;
 
 	list_move(&edge->list, head);
 	irn_edge_info_t *old_tgt_info = get_irn_edge_info(old_tgt, kind);
@@ -325,14 +308,29 @@ static void edges_notify_edge_kind(ir_node *src, int pos, ir_node *tgt, ir_node
 #endif
 }
 
+/**
+ * Returns whether updates for the given edge kind are currently deferred
+ * and records that a reconciliation will be necessary.
+ */
+static bool edges_deferred_kind(ir_graph *irg, ir_edge_kind_t kind)
+{
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
+	if (info->deferred == 0)
+		return false;
+	info->dirty = 1;
+	return true;
+}
+
 void edges_notify_edge(ir_node *src, int pos, ir_node *tgt, ir_node *old_tgt,
                        ir_graph *irg)
 {
-	if (edges_activated_kind(irg, EDGE_KIND_NORMAL)) {
+	if (edges_activated_kind(irg, EDGE_KIND_NORMAL)
+	    && !edges_deferred_kind(irg, EDGE_KIND_NORMAL)) {
 		edges_notify_edge_kind(src, pos, tgt, old_tgt, EDGE_KIND_NORMAL, irg);
 	}
 
-	if (edges_activated_kind(irg, EDGE_KIND_BLOCK)) {
+	if (edges_activated_kind(irg, EDGE_KIND_BLOCK)
+	    && !edges_deferred_kind(irg, EDGE_KIND_BLOCK)) {
 		if (is_Block(src)) {
 			ir_node *bl_old = NULL;
 			ir_node *bl_tgt = NULL;
@@ -377,7 +375,7 @@ static void edges_node_deleted_kind(ir_node *old, ir_edge_kind_t kind)
 {
 	ir_graph *irg = get_irn_irg(old);
 
-	if (!edges_activated_kind(irg, kind))
+	if (!edges_activated_kind(irg, kind) || edges_deferred_kind(irg, kind))
 		return;
 
 	DBG((dbg, LEVEL_5, "node deleted (kind: %s): %+F\n", get_kind_str(kind), old));
@@ -399,7 +397,7 @@ static void edges_node_revival_kind(ir_node *irn, ir_edge_kind_t kind)
 {
 	ir_graph *irg = get_irn_irg(irn);
 
-	if (!edges_activated_kind(irg, kind))
+	if (!edges_activated_kind(irg, kind) || edges_deferred_kind(irg, kind))
 		return;
 
 	irn_edge_info_t *info = get_irn_edge_info(irn, kind);
@@ -417,7 +415,6 @@ static void edges_node_revival_kind(ir_node *irn, ir_edge_kind_t kind)
 
 typedef struct build_walker {
 	ir_edge_kind_t kind;
-	bitset_t      *reachable;
 	bool           fine;
 } build_walker;
 
@@ -445,10 +442,31 @@ static void init_lh_walker(ir_node *irn, void *data)
 {
 	build_walker   *w    = (build_walker*)data;
 	ir_edge_kind_t  kind = w->kind;
-	list_head      *head = &get_irn_edge_info(irn, kind)->outs_head;
-	INIT_LIST_HEAD(head);
-	get_irn_edge_info(irn, kind)->edges_built = 0;
-	get_irn_edge_info(irn, kind)->out_count   = 0;
+	irn_edge_info_t *info = get_irn_edge_info(irn, kind);
+	INIT_LIST_HEAD(&info->outs_head);
+	info->edges_built = 0;
+	info->out_count   = 0;
+	/* slot arrays of a former activation died with the edge obstack */
+	info->in_edges    = NULL;
+	info->n_in_edges  = 0;
+}
+
+/**
+ * (Re)builds the edge set of the given kind from scratch.
+ * @internal
+ */
+static void edges_rebuild_kind(ir_graph *irg, ir_edge_kind_t kind)
+{
+	struct build_walker w = { .kind = kind };
+
+	edges_init_graph_kind(irg, kind);
+	if (kind == EDGE_KIND_BLOCK) {
+		visit_all_identities(irg, init_lh_walker, &w);
+		irg_block_walk_graph(irg, init_lh_walker, build_edges_walker, &w);
+	} else {
+		visit_all_identities(irg, init_lh_walker, &w);
+		irg_walk_anchors(irg, init_lh_walker, build_edges_walker, &w);
+	}
 }
 
 void edges_activate_kind(ir_graph *irg, ir_edge_kind_t kind)
@@ -475,20 +493,12 @@ void edges_activate_kind(ir_graph *irg, ir_edge_kind_t kind)
 	 *
 	 * Currently, we use the last option.
 	 */
-	struct build_walker  w    = { .kind = kind };
-	irg_edge_info_t     *info = get_irg_edge_info(irg, kind);
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
 
 	assert(!info->activated);
 
 	info->activated = 1;
-	edges_init_graph_kind(irg, kind);
-	if (kind == EDGE_KIND_BLOCK) {
-		visit_all_identities(irg, init_lh_walker, &w);
-		irg_block_walk_graph(irg, init_lh_walker, build_edges_walker, &w);
-	} else {
-		visit_all_identities(irg, init_lh_walker, &w);
-		irg_walk_anchors(irg, init_lh_walker, build_edges_walker, &w);
-	}
+	edges_rebuild_kind(irg, kind);
 }
 
 void edges_deactivate_kind(ir_graph *irg, ir_edge_kind_t kind)
@@ -496,9 +506,10 @@ void edges_deactivate_kind(ir_graph *irg, ir_edge_kind_t kind)
 	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
 
 	info->activated = 0;
+	info->deferred  = 0;
+	info->dirty     = 0;
 	if (info->allocated) {
 		obstack_free(&info->edges_obst, NULL);
-		ir_edgeset_destroy(&info->edges);
 		info->allocated = 0;
 	}
 	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
@@ -520,6 +531,8 @@ void edges_reroute_kind(ir_node *from, ir_node *to, ir_edge_kind_t kind)
 	set_edge_func_t *set_edge = edge_kind_info[kind].set_edge;
 
 	if (set_edge && edges_activated_kind(irg, kind)) {
+		assert(get_irg_edge_info(irg, kind)->deferred == 0
+		       && "out edges are stale inside a deferred-update scope");
 		struct list_head *head = &get_irn_edge_info(from, kind)->outs_head;
 
 		DBG((dbg, LEVEL_5, "reroute from %+F to %+F\n", from, to));
@@ -547,36 +560,44 @@ void edges_reroute_except(ir_node *from, ir_node *to, ir_node *exception)
 	}
 }
 
-static void verify_set_presence(ir_node *irn, void *data)
+static void verify_index_presence(ir_node *irn, void *data)
 {
-	build_walker *w     = (build_walker*)data;
-	ir_graph     *irg   = get_irn_irg(irn);
-	ir_edgeset_t *edges = &get_irg_edge_info(irg, w->kind)->edges;
+	build_walker    *w    = (build_walker*)data;
+	ir_graph        *irg  = get_irn_irg(irn);
+	irg_edge_info_t *info = get_irg_edge_info(irg, w->kind);
 
+	int last_pos = edge_kind_info[w->kind].first_idx;
 	foreach_tgt(irn, i, n, w->kind) {
-		ir_edge_t  templ = { .src = irn, .pos = i };
-		ir_edge_t *e     = ir_edgeset_find(edges, &templ);
-		ir_node   *dst   = get_n(irn, i, w->kind);
+		last_pos = i + 1;
+		ir_edge_t **slot = edge_slot(irn, i, w->kind, info, false);
+		ir_node    *dst  = get_n(irn, i, w->kind);
 		if (dst == NULL)
 			continue;
-		if (e != NULL) {
-#ifdef DEBUG_libfirm
-			e->present = true;
-#endif
-		} else {
+		if (slot == NULL || *slot == NULL) {
 			w->fine = false;
 			ir_fprintf(stderr, "Edge Verifier: %+F,%d is missing\n",
 			           irn, i);
 		}
 	}
+
+	/* slots beyond the current arity must be empty */
+	const irn_edge_info_t *irn_info = get_irn_edge_info(irn, w->kind);
+	for (unsigned idx = (unsigned)(last_pos + 1); idx < irn_info->n_in_edges;
+	     ++idx) {
+		const ir_edge_t *e = irn_info->in_edges[idx];
+		if (e != NULL) {
+			w->fine = false;
+			ir_fprintf(stderr,
+			           "Edge Verifier: edge(%ld) %+F,%d is superfluous\n",
+			           edge_get_id(e), e->src, e->pos);
+		}
+	}
 }
 
 static void verify_list_presence(ir_node *irn, void *data)
 {
 	build_walker *w = (build_walker*)data;
 
-	bitset_set(w->reachable, get_irn_idx(irn));
-
 	/* check list heads */
 	verify_list_head(irn, w->kind);
 
@@ -599,35 +620,9 @@ static void verify_list_presence(ir_node *irn, void *data)
 
 int edges_verify_kind(ir_graph *irg, ir_edge_kind_t kind)
 {
-	struct build_walker    w     = { .kind      = kind,
-	                                 .reachable = bitset_alloca(get_irg_last_idx(irg)),
-	                                 .fine      = true };
-
-#ifdef DEBUG_libfirm
-	ir_edgeset_t          *edges = &get_irg_edge_info(irg, kind)->edges;
-	ir_edge_t             *e;
-	ir_edgeset_iterator_t iter;
-	/* Clear the present bit in all edges available. */
-	foreach_ir_edgeset(edges, e, iter) {
-		e->present = false;
-	}
-#endif
-
-	irg_walk_graph(irg, verify_set_presence, verify_list_presence, &w);
+	struct build_walker    w     = { .kind = kind, .fine = true };
 
-#ifdef DEBUG_libfirm
-	/*
-	 * Dump all edges which are not invalid and not present.
-	 * These edges are superfluous and their presence in the
-	 * edge set is wrong.
-	 */
-	foreach_ir_edgeset(edges, e, iter) {
-		if (! e->present && bitset_is_set(w.reachable, get_irn_idx(e->src))) {
-			w.fine = false;
-			ir_fprintf(stderr, "Edge Verifier: edge(%ld) %+F,%d is superfluous\n", edge_get_id(e), e->src, e->pos);
-		}
-	}
-#endif
+	irg_walk_graph(irg, verify_index_presence, verify_list_presence, &w);
 
 	return w.fine;
 }
@@ -753,6 +748,33 @@ void edges_deactivate(ir_graph *irg)
 	edges_deactivate_kind(irg, EDGE_KIND_NORMAL);
 }
 
+void edges_defer_updates(ir_graph *irg)
+{
+	for (ir_edge_kind_t kind = EDGE_KIND_FIRST; kind <= EDGE_KIND_LAST;
+	     ++kind) {
+		if (!edges_activated_kind(irg, kind))
+			continue;
+		++get_irg_edge_info(irg, kind)->deferred;
+	}
+}
+
+void edges_commit_updates(ir_graph *irg)
+{
+	for (ir_edge_kind_t kind = EDGE_KIND_FIRST; kind <= EDGE_KIND_LAST;
+	     ++kind) {
+		if (!edges_activated_kind(irg, kind))
+			continue;
+		/* edges activated inside the scope are up to date already */
+		irg_edge_info_t *info = get_irg_edge_info(irg, kind);
+		if (info->deferred == 0)
+			continue;
+		if (--info->deferred == 0 && info->dirty) {
+			edges_rebuild_kind(irg, kind);
+			info->dirty = 0;
+		}
+	}
+}
+
 void assure_edges(ir_graph *irg)
 {
 	assure_edges_kind(irg, EDGE_KIND_BLOCK);
@@ -11,6 +11,8 @@
 #include "irflag_t.h"
 
 #include "firm_common.h"
+#include "irgraph_t.h"
+#include "irprofile.h"
 #include "irtools.h"
 #include "lc_opts.h"
 #include <stdio.h>
@@ -54,6 +56,32 @@ int (get_optimize)(void)
 	return get_opt_optimize();
 }
 
+/** Decides function tiers; overrides the profile based selection. */
+static ir_tier_selector_func *tier_selector;
+/** Entry counts below this make a function cold, see get_function_tier(). */
+static unsigned tier_cold_threshold = 1;
+
+void set_tier_selector(ir_tier_selector_func *selector)
+{
+	tier_selector = selector;
+}
+
+void set_tier_cold_threshold(unsigned execcount)
+{
+	tier_cold_threshold = execcount;
+}
+
+ir_function_tier get_function_tier(ir_graph const *irg)
+{
+	if (tier_selector != NULL)
+		return tier_selector(irg);
+	if (ir_profile_has_data()
+	 && ir_profile_get_block_execcount(get_irg_start_block(irg))
+	    < tier_cold_threshold)
+		return ir_tier_cold;
+	return ir_tier_hot;
+}
+
 void save_optimization_state(optimization_state_t *state)
 {
 	*state = libFIRM_opt;
@@ -84,6 +84,7 @@ void exchange(ir_node *old, ir_node *nw)
 	}
 
 	/* update irg flags */
+	irg_inc_change_nr(irg);
 	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS
 	                        | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
 }
@@ -13,19 +13,21 @@
 #include "array.h"
 #include "irbackedge_t.h"
 #include "ircons_t.h"
+#include "irconsconfirm.h"
 #include "iredges_t.h"
 #include "irflag_t.h"
 #include "irgmod.h"
 #include "irgopt.h"
 #include "irgwalk.h"
 #include "irhooks.h"
-#include "irmemory.h"
+#include "irmemory_t.h"
 #include "irnode_t.h"
 #include "iropt_t.h"
 #include "iroptimize.h"
 #include "irouts.h"
 #include "irprog_t.h"
 #include "irtools.h"
+#include "memstat.h"
 #include "type_t.h"
 #include "util.h"
 #include "xmalloc.h"
@@ -34,6 +36,70 @@
 
 ir_graph *current_ir_graph;
 
+/** Chunk allocator of the node obstack: reuses a cached chunk of the
+ * right size if there is one. Only exact fits are taken, since the
+ * obstack derives the usable space from the requested size. */
+static void *irg_chunk_alloc(void *env, ptrdiff_t size)
+{
+	ir_graph *irg = (ir_graph*)env;
+	for (irg_chunk_cache_t **anchor = &irg->chunk_cache; *anchor != NULL;
+	     anchor = &(*anchor)->next) {
+		irg_chunk_cache_t *entry = *anchor;
+		if (entry->size == (size_t)size) {
+			*anchor = entry->next;
+			return entry;
+		}
+	}
+	return ir_obstack_chunk_alloc((size_t)size);
+}
+
+/** Chunk deallocator of the node obstack: puts the chunk into the
+ * graph's chunk cache. */
+static void irg_chunk_free(void *env, struct _obstack_chunk *chunk)
+{
+	ir_graph *irg = (ir_graph*)env;
+	/* read the size before the cache header overwrites the chunk header */
+	size_t const size = (size_t)(chunk->limit - (char*)chunk);
+
+	irg_chunk_cache_t *entry = (irg_chunk_cache_t*)chunk;
+	entry->next      = irg->chunk_cache;
+	entry->size      = size;
+	irg->chunk_cache = entry;
+}
+
+void irg_init_obstack(ir_graph *irg)
+{
+	obstack_specify_allocation_with_arg(&irg->obst, 0, 0, irg_chunk_alloc,
+	                                    irg_chunk_free, irg);
+}
+
+void irg_free_chunk_cache(ir_graph *irg)
+{
+	for (irg_chunk_cache_t *entry = irg->chunk_cache, *next; entry != NULL;
+	     entry = next) {
+		next = entry->next;
+		/* the cache header has overwritten the chunk header, so pass the
+		 * recorded size instead of letting the deallocator read it */
+		ir_obstack_chunk_free_sized(entry, entry->size);
+	}
+	irg->chunk_cache = NULL;
+}
+
+ident *irg_unique_ident(ir_graph *irg, const char *tag)
+{
+	return new_id_fmt("%s.%ld.%u", tag, get_irg_graph_nr(irg),
+	                  irg->next_unique_id++);
+}
+
+size_t irg_obstack_memory(const ir_graph *irg)
+{
+	size_t res = (size_t)obstack_memory_used((struct obstack*)&irg->obst);
+	for (irg_chunk_cache_t *entry = irg->chunk_cache; entry != NULL;
+	     entry = entry->next)
+		res += entry->size;
+	return res;
+}
+
 ir_graph *get_current_ir_graph(void)
 {
 	return current_ir_graph;
@@ -61,7 +127,7 @@ static ir_graph *alloc_graph(void)
 	/* initialize the idx->node map. */
 	res->idx_irn_map = NEW_ARR_FZ(ir_node*, INITIAL_IDX_IRN_MAP_SIZE);
 
-	obstack_init(&res->obst);
+	irg_init_obstack(res);
 
 	/* value table for global value numbering for optimizing use in iropt.c */
 	new_identities(res);
@@ -275,13 +341,20 @@ void free_ir_graph(ir_graph *irg)
 	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
 
 	free_irg_outs(irg);
+	free_value_facts(irg);
 	del_identities(irg);
+	free(irg->alias_cache);
+	if (irg->topo_order != NULL)
+		DEL_ARR_F(irg->topo_order);
+	if (irg->pending_mature != NULL)
+		DEL_ARR_F(irg->pending_mature);
 	if (irg->ent) {
 		set_entity_irg(irg->ent, NULL);  /* not set in const code irg */
 	}
 
 	free_End(get_irg_end(irg));
 	obstack_free(&irg->obst, NULL);
+	irg_free_chunk_cache(irg);
 	if (irg->loc_descriptions)
 		free(irg->loc_descriptions);
 	irg->kind = k_BAD;
@@ -613,7 +686,7 @@ void confirm_irg_properties(ir_graph *irg, ir_graph_properties_t props)
 	    && (irg->properties & IR_GRAPH_PROPERTY_CONSISTENT_OUTS))
 	    free_irg_outs(irg);
 	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_ENTITY_USAGE))
-		set_irp_globals_entity_usage_state(ir_entity_usage_not_computed);
+		ir_invalidate_globals_entity_usage(irg);
 	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE_FRONTIERS))
 		ir_free_dominance_frontiers(irg);
 }
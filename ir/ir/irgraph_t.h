@@ -16,13 +16,12 @@
 #include "entity_t.h"
 #include "firm_types.h"
 #include "iredgekinds.h"
-#include "iredgeset.h"
 #include "irloop.h"
+#include "iridentityset.h"
 #include "irnodemap.h"
 #include "irprog.h"
 #include "list.h"
 #include "obst.h"
-#include "pset.h"
 #include "type_t.h"
 
 #define get_irg_start_block(irg)              get_irg_start_block_(irg)
@@ -73,11 +72,12 @@
  * Edge info to put into an irg.
  */
 typedef struct irg_edge_info_t {
-	ir_edgeset_t     edges;          /**< A set containing all edges of the current graph. */
 	struct list_head free_edges;     /**< list of all free edges. */
 	struct obstack   edges_obst;     /**< Obstack, where edges are allocated on. */
+	unsigned         deferred;       /**< Number of open update deferral scopes. */
 	unsigned         allocated : 1;  /**< Set if edges are allocated on the obstack. */
 	unsigned         activated : 1;  /**< Set if edges are activated for the graph. */
+	unsigned         dirty     : 1;  /**< Set if changes happened while deferred. */
 } irg_edge_info_t;
 
 typedef irg_edge_info_t irg_edges_info_t[EDGE_KIND_LAST+1];
@@ -91,14 +91,27 @@ typedef struct cg_callee_entry {
 
 typedef struct ir_bitinfo {
 	struct ir_nodemap map;
+	/** per node: list of nodes whose transfer function read its bit
+	 * information without being connected by an edge */
+	struct ir_nodemap deps;
 	struct obstack    obst;
 } ir_bitinfo;
 
 typedef struct ir_vrp_info {
 	struct ir_nodemap infos;
 	struct obstack    obst;
+	unsigned          generation; /**< bumped on graph modifications; data
+	                                   from older generations is stale */
 } ir_vrp_info;
 
+/** A recycled chunk of the node obstack, see irg_init_obstack(). The
+ * header is stored in the chunk memory itself. */
+typedef struct irg_chunk_cache_t irg_chunk_cache_t;
+struct irg_chunk_cache_t {
+	irg_chunk_cache_t *next;
+	size_t             size; /**< full size of the chunk in bytes */
+};
+
 /**
  * An ir_graph represents the code of a function as a graph of nodes.
  */
@@ -112,6 +125,10 @@ struct ir_graph {
 	ir_type               *frame_type;
 	ir_node               *anchor;        /**< Pointer to the anchor node. */
 	struct obstack         obst;          /**< obstack allocator for nodes. */
+	/** Chunks given back by the node obstack, kept for reuse. Filled when
+	 * an old arena is cremated (dead node elimination, backend
+	 * transformation), drained again as the new arena grows. */
+	irg_chunk_cache_t     *chunk_cache;
 
 	ir_graph_properties_t  properties;
 	ir_graph_constraints_t constraints;
@@ -123,26 +140,54 @@ struct ir_graph {
 	ir_visited_t     visited;
 	ir_visited_t     block_visited; /**< Visited flag for block nodes. */
 	ir_visited_t     self_visited;  /**< Visited flag of the irg */
+	/** Counter bumped on every structural change (node creation, in-edge
+	 * rewiring).  Allows passes to detect that a graph is unchanged since
+	 * they last ran. */
+	unsigned         change_nr;
+	/** Value of change_nr after the last complete combo() run. */
+	unsigned         last_combo_nr;
 	ir_node        **idx_irn_map;   /**< Map of node indexes to nodes. */
 	size_t           index;         /**< a unique number for each graph */
+	/** Sequence number of the next irg_unique_ident() name. Only touched
+	 * by whoever currently processes the graph, so it needs no lock even
+	 * when graphs are transformed on worker threads. */
+	unsigned         next_unique_id;
 	/** A void* field to link any information to the graph. */
 	void            *link;
 	void            *be_data;       /**< backend can put in private data here */
 	unsigned short   dump_nr;       /**< number of graph dumps */
 
 	unsigned char    mem_disambig_opt;
+	/** Whether imprecise (fast-math style) float transformations are
+	 * allowed for this graph even when the global switch is off, see
+	 * ir_allow_imprecise_float_transforms_irg(). */
+	bool             imprecise_float_transforms;
 
 	/** Number of local variables in this function during construction. */
 	int      n_loc;
 	void   **loc_descriptions; /**< Descriptions for variables. */
 	ir_node *current_block;    /**< Block for new_*()ly created nodes. */
+	/** During deferred maturation: blocks recorded by mature_immBlock(),
+	 * matured in one batch by irg_finalize_cons(). NULL when maturation
+	 * happens immediately. */
+	ir_node **pending_mature;
 
 	/** Hash table for global value numbering (CSE) */
-	pset               *value_table;
+	ir_identityset_t   *value_table;
+	/** Memoization cache for alias queries, see irmemory.c. Lazily
+	 * allocated, entries are validated against change_nr. */
+	struct alias_cache_entry_t *alias_cache;
+	/** Cached topological order of all nodes (operands before users), see
+	 * ir_get_topo_order(). Lazily computed, validated against change_nr. */
+	ir_node           **topo_order;
+	unsigned            topo_order_change_nr;
 	struct obstack      out_obst;    /**< Space for the Def-Use arrays. */
 	bool                out_obst_allocated;
 	ir_bitinfo          bitinfo;     /**< bit info */
 	ir_vrp_info         vrp;         /**< vrp info */
+	/** Dominance-scoped side-table of value facts, see
+	 * construct_value_facts(). Lazily allocated. */
+	struct ir_value_facts_t *value_facts;
 	ir_loop            *loop;        /**< The outermost loop for this graph. */
 	ir_dom_front_info_t domfront;    /**< dominance frontier analysis data */
 	irg_edges_info_t    edge_info;   /**< edge info for automatic outs */
@@ -191,6 +236,43 @@ ir_graph *new_const_code_irg(void);
  */
 ir_graph *create_irg_copy(ir_graph *irg);
 
+/**
+ * (Re-)Initializes the node obstack of a graph. The obstack draws its
+ * chunks from the graph's chunk cache before falling back to malloc and
+ * gives them back to the cache when freed, so phases which swap the node
+ * arena (dead node elimination, the backend transformation) recycle the
+ * old chunks instead of returning them to malloc.
+ *
+ * @param irg  the IR graph
+ */
+void irg_init_obstack(ir_graph *irg);
+
+/**
+ * Returns all chunks in the graph's chunk cache to malloc.
+ *
+ * @param irg  the IR graph
+ */
+void irg_free_chunk_cache(ir_graph *irg);
+
+/**
+ * Returns the bytes held by the graph's node obstack, including the
+ * chunks waiting in the chunk cache. See ir_memory_stats().
+ *
+ * @param irg  the IR graph
+ */
+size_t irg_obstack_memory(const ir_graph *irg);
+
+/**
+ * Creates a new unique ident scoped to the graph: "tag.graphnr.seq".
+ * Unlike id_unique() the name does not depend on a global counter, so
+ * it stays the same however graphs are interleaved on worker threads -
+ * a requirement for reproducible assembly output.
+ *
+ * @param irg  the IR graph
+ * @param tag  prefix of the ident
+ */
+ident *irg_unique_ident(ir_graph *irg, const char *tag);
+
 /**
  * Set the op_pin_state_pinned state of a graph.
  *
@@ -456,6 +538,15 @@ static inline unsigned irg_register_node_idx(ir_graph *irg, ir_node *irn)
 	return idx;
 }
 
+/**
+ * Record a structural modification of the graph. Cheap enough to be
+ * called from the node mutators on every change.
+ */
+static inline void irg_inc_change_nr(ir_graph *irg)
+{
+	++irg->change_nr;
+}
+
 /**
  * Kill a node from the irg. BEWARE: this kills
  * all later created nodes.
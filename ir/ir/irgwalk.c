@@ -21,7 +21,6 @@
 #include "irhooks.h"
 #include "irnode_t.h"
 #include "irprog_t.h"
-#include "irnodeset.h"
 #include "panic.h"
 #include "pset_new.h"
 #include <stdlib.h>
@@ -132,6 +131,28 @@ void irg_walk_graph(ir_graph *irg, irg_walk_func *pre, irg_walk_func *post,
 	irg_walk(get_irg_end(irg), pre, post, env);
 }
 
+/** Appends the visited node to the order array in walker post order. */
+static void topo_order_walker(ir_node *node, void *env)
+{
+	ir_node ***const order = (ir_node***)env;
+	ARR_APP1(ir_node*, *order, node);
+}
+
+size_t ir_get_topo_order(ir_graph *irg, ir_node ***const order)
+{
+	if (irg->topo_order == NULL
+	 || irg->topo_order_change_nr != irg->change_nr) {
+		if (irg->topo_order != NULL)
+			DEL_ARR_F(irg->topo_order);
+		ir_node **new_order = NEW_ARR_F(ir_node*, 0);
+		irg_walk_graph(irg, NULL, topo_order_walker, &new_order);
+		irg->topo_order           = new_order;
+		irg->topo_order_change_nr = irg->change_nr;
+	}
+	*order = irg->topo_order;
+	return ARR_LEN(irg->topo_order);
+}
+
 void all_irg_walk(irg_walk_func *pre, irg_walk_func *post, void *env)
 {
 	foreach_irp_irg(i, irg) {
@@ -245,10 +266,16 @@ void irg_walk_in_or_dep_graph(ir_graph *irg, irg_walk_func *pre,
 	irg_walk_in_or_dep(get_irg_end(irg), pre, post, env);
 }
 
-static void walk_topo_helper(ir_node *irn, ir_nodeset_t *walker_called, irg_walk_func *walker, void *env)
+/* The topological walk distinguishes three node states with the visited
+ * epoch alone: "unseen" (visited < called - 1), "seen but walker not yet
+ * called" (visited == called - 1) and "walker called" (visited == called).
+ * This avoids a per-walk hash set and resets in O(1) like all other
+ * walkers. */
+static void walk_topo_helper(ir_node *irn, ir_visited_t called,
+                             irg_walk_func *walker, void *env)
 {
-	if (irn_visited(irn)) {
-		if (!ir_nodeset_contains(walker_called, irn)) {
+	if (get_irn_visited(irn) + 1 >= called) {
+		if (get_irn_visited(irn) < called) {
 			/* We have already visited this node, but not
 			 * yet called the walker with it. Now, we are
 			 * seeing it a second time, therefore we have
@@ -257,41 +284,40 @@ static void walk_topo_helper(ir_node *irn, ir_nodeset_t *walker_called, irg_walk
 			 * or the node one recursion above us will be
 			 * called before one of its arguments. */
 			walker(irn, env);
-			ir_nodeset_insert(walker_called, irn);
+			set_irn_visited(irn, called);
 		}
 		return;
 	}
 
-	/* Break loops at phi/block nodes. Mark them visited, so
+	/* Break loops at phi/block nodes. Mark them seen, so
 	 * recursion will stop, but don't call the walker yet. */
 	const bool is_loop_breaker = is_Phi(irn) || is_Block(irn);
 	if (is_loop_breaker)
-		mark_irn_visited(irn);
+		set_irn_visited(irn, called - 1);
 
 	if (!is_Block(irn)) {
 		ir_node *const block = get_nodes_block(irn);
-		walk_topo_helper(block, walker_called, walker, env);
+		walk_topo_helper(block, called, walker, env);
 	}
 
 	for (int i = 0; i < get_irn_arity(irn); ++i) {
 		ir_node *const pred = get_irn_n(irn, i);
-		walk_topo_helper(pred, walker_called, walker, env);
+		walk_topo_helper(pred, called, walker, env);
 	}
 
-	if (!ir_nodeset_contains(walker_called, irn)) {
+	if (get_irn_visited(irn) < called)
 		walker(irn, env);
-		ir_nodeset_insert(walker_called, irn);
-	}
 
-	mark_irn_visited(irn);
+	set_irn_visited(irn, called);
 }
 
 void irg_walk_topological(ir_graph *irg, irg_walk_func *walker, void *env)
 {
+	/* Burn two epochs: the older one marks seen nodes, the newer one nodes
+	 * the walker already ran on. */
+	inc_irg_visited(irg);
 	inc_irg_visited(irg);
-	ir_nodeset_t walker_called;
-	ir_nodeset_init(&walker_called);
-	walk_topo_helper(get_irg_end(irg), &walker_called, walker, env);
+	walk_topo_helper(get_irg_end(irg), get_irg_visited(irg), walker, env);
 }
 
 /** Walks back from n until it finds a real cf op. */
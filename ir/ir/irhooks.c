@@ -13,6 +13,7 @@
 #include <assert.h>
 
 hook_entry_t *hooks[hook_last];
+unsigned      hooks_active;
 
 void register_hook(hook_type_t hook, hook_entry_t *entry)
 {
@@ -23,8 +24,9 @@ void register_hook(hook_type_t hook, hook_entry_t *entry)
 	/* hook should not be registered yet */
 	assert(entry->next == NULL && hooks[hook] != entry);
 
-	entry->next = hooks[hook];
-	hooks[hook] = entry;
+	entry->next   = hooks[hook];
+	hooks[hook]   = entry;
+	hooks_active |= 1U << hook;
 }
 
 void unregister_hook(hook_type_t hook, hook_entry_t *entry)
@@ -36,4 +38,6 @@ void unregister_hook(hook_type_t hook, hook_entry_t *entry)
 			break;
 		}
 	}
+	if (hooks[hook] == NULL)
+		hooks_active &= ~(1U << hook);
 }
@@ -92,18 +92,36 @@ void unregister_hook(hook_type_t hook, hook_entry_t *entry);
 /** Global list of registerd hooks. */
 extern hook_entry_t *hooks[hook_last];
 
+/** Bitmask with the bit @c 1U<<hook set for every hook type that has at
+ * least one entry registered. Lets the dispatch sites test for consumers
+ * with a single branch on one shared word instead of touching the list
+ * heads, which matters for hook_new_node() in the node constructor. */
+extern unsigned hooks_active;
+
+#ifdef DISABLE_HOOKS
+
+/* Production embedders can compile all hook dispatch out; registered
+ * entries are kept but never fire. */
+#define hook_exec(what, args) ((void)0)
+
+#else
+
 /**
  * Executes the hook @p what with the args @p args
  * Do not use this macro directly.
  */
-#define hook_exec(what, args) do {             \
-	hook_entry_t *_p;                          \
-	for (_p = hooks[what]; _p; _p = _p->next){ \
-		void *hook_ctx_ = _p->context;         \
-		_p->hook._##what args;                 \
-	}                                          \
+#define hook_exec(what, args) do {                 \
+	if (hooks_active & (1U << (what))) {           \
+		hook_entry_t *_p;                          \
+		for (_p = hooks[what]; _p; _p = _p->next){ \
+			void *hook_ctx_ = _p->context;         \
+			_p->hook._##what args;                 \
+		}                                          \
+	}                                              \
 } while (0)
 
+#endif
+
 /** Called after a new node has been created */
 #define hook_new_node(node)               hook_exec(hook_new_node, (hook_ctx_, node))
 /** Called when a node is replaced */
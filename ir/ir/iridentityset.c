@@ -0,0 +1,50 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   A value numbering set for ir_node* keys.
+ *
+ * This instantiates the generic open addressing hashset for the CSE
+ * value table. The node hash is stored inline with each entry, so
+ * probing does not touch the nodes themselves and growing the table
+ * does not recompute any hashes.
+ */
+#include "iridentityset.h"
+
+#include "irnode_t.h"
+#include "iropt_t.h"
+
+#define HashSet                   ir_identityset_t
+#define HashSetIterator           ir_identityset_iterator_t
+#define HashSetEntry              ir_identityset_entry_t
+#define ValueType                 ir_node*
+#define ConstKeyType              const ir_node*
+#define NullValue                 NULL
+#define DeletedValue              ((ir_node*)-1)
+#define Hash(this,key)            ir_node_hash(key)
+#define KeysEqual(this,key1,key2) (this->cmp_function(key1, key2) == 0)
+#define SCALAR_RETURN
+#define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof((ptr)[0]))
+
+void ir_identityset_init_size(ir_identityset_t *self, size_t expected_elements);
+#define hashset_init_size       ir_identityset_init_size
+#define hashset_destroy         ir_identityset_destroy
+#define hashset_insert          ir_identityset_insert
+#define hashset_remove          ir_identityset_remove
+#define hashset_find            ir_identityset_find
+#define hashset_size            ir_identityset_size
+#define hashset_iterator_init   ir_identityset_iterator_init
+#define hashset_iterator_next   ir_identityset_iterator_next
+
+#include "hashset.c.h"
+
+void ir_identityset_init(ir_identityset_t *identityset,
+                         ir_identityset_cmp_function cmp_function,
+                         size_t expected_elements)
+{
+	identityset->cmp_function = cmp_function;
+	ir_identityset_init_size(identityset, expected_elements);
+}
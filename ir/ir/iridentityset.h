@@ -0,0 +1,104 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief     A value numbering set for ir_node* keys.
+ *
+ * Open addressing set used as CSE value table. In contrast to a generic
+ * pset the entries live in one flat array with the hash stored inline,
+ * so the hot lookup path in optimize_node() touches far fewer cache
+ * lines. The node hash is fixed to ir_node_hash(), only the equality
+ * function is selectable (GVN-PRE uses a relaxed variant).
+ */
+#ifndef FIRM_IR_IRIDENTITYSET_H
+#define FIRM_IR_IRIDENTITYSET_H
+
+#include <stdbool.h>
+#include "firm_types.h"
+#include "xmalloc.h"
+
+/**
+ * The type of an identity set compare function. Follows the pset
+ * convention: returns zero if both nodes compute the same value.
+ */
+typedef int (*ir_identityset_cmp_function)(const void *a, const void *b);
+
+#define HashSet          ir_identityset_t
+#define HashSetIterator  ir_identityset_iterator_t
+#define HashSetEntry     ir_identityset_entry_t
+#define ValueType        ir_node*
+#define ADDITIONAL_DATA  ir_identityset_cmp_function cmp_function;
+
+#include "hashset.h"
+
+#undef ADDITIONAL_DATA
+#undef ValueType
+#undef HashSetEntry
+#undef HashSetIterator
+#undef HashSet
+
+typedef struct ir_identityset_t          ir_identityset_t;
+typedef struct ir_identityset_iterator_t ir_identityset_iterator_t;
+
+/**
+ * Initializes an identity set.
+ *
+ * @param identityset         Pointer to allocated space for the set
+ * @param cmp_function        The equality function to use
+ * @param expected_elements   Number of elements expected (roughly)
+ */
+void ir_identityset_init(ir_identityset_t *identityset,
+                         ir_identityset_cmp_function cmp_function,
+                         size_t expected_elements);
+
+/**
+ * Destroys an identity set and frees the memory allocated for the
+ * hashtable. The memory of the set itself is not freed.
+ */
+void ir_identityset_destroy(ir_identityset_t *identityset);
+
+/**
+ * Inserts a node into the identity set.
+ *
+ * @param identityset   Pointer to the set
+ * @param node          node to insert
+ * @returns             @p node itself or the equal node already present
+ */
+ir_node *ir_identityset_insert(ir_identityset_t *identityset, ir_node *node);
+
+/**
+ * Removes a node from the identity set. Does nothing if the set doesn't
+ * contain the node.
+ */
+void ir_identityset_remove(ir_identityset_t *identityset, const ir_node *node);
+
+/**
+ * Returns the node equal to @p node in the set, or NULL.
+ */
+ir_node *ir_identityset_find(const ir_identityset_t *identityset,
+                             const ir_node *node);
+
+/**
+ * Returns the number of nodes contained in the identity set.
+ */
+size_t ir_identityset_size(const ir_identityset_t *identityset);
+
+/**
+ * Initializes an identity set iterator. Sets the iterator before the
+ * first element in the set.
+ */
+void ir_identityset_iterator_init(ir_identityset_iterator_t *iterator,
+                                  const ir_identityset_t *identityset);
+
+/**
+ * Advances the iterator and returns the current element or NULL if all
+ * elements have been processed.
+ * @attention It is not allowed to use any insert or remove operation
+ *            while iterating over the set.
+ */
+ir_node *ir_identityset_iterator_next(ir_identityset_iterator_t *iterator);
+
+#endif
@@ -8,6 +8,7 @@
  * @brief   Write textual representation of firm to file.
  * @author  Moritz Kroll, Matthias Braun
  */
+#include "hashptr.h"
 #include "irio_t.h"
 
 #include "array.h"
@@ -145,7 +146,7 @@ parse_error(read_env_t *env, const char *fmt, ...)
 	va_end(ap);
 }
 
-COMPILETIME_ASSERT(ir_bk_va_arg == ir_bk_last, complete_builtin_list)
+COMPILETIME_ASSERT(ir_bk_atomic_fetch_add == ir_bk_last, complete_builtin_list)
 
 /** Initializes the symbol table. May be called more than once without problems. */
 static void symtbl_init(void)
@@ -241,6 +242,11 @@ static void symtbl_init(void)
 	INSERTENUM(tt_builtin_kind, ir_bk_may_alias);
 	INSERTENUM(tt_builtin_kind, ir_bk_va_start);
 	INSERTENUM(tt_builtin_kind, ir_bk_va_arg);
+	INSERTENUM(tt_builtin_kind, ir_bk_add_overflow);
+	INSERTENUM(tt_builtin_kind, ir_bk_sub_overflow);
+	INSERTENUM(tt_builtin_kind, ir_bk_mul_overflow);
+	INSERTENUM(tt_builtin_kind, ir_bk_atomic_exchange);
+	INSERTENUM(tt_builtin_kind, ir_bk_atomic_fetch_add);
 
 	INSERTENUM(tt_cond_jmp_predicate, COND_JMP_PRED_NONE);
 	INSERTENUM(tt_cond_jmp_predicate, COND_JMP_PRED_TRUE);
@@ -1108,7 +1114,7 @@ void ir_export_file(FILE *file)
 
 static void read_c(read_env_t *env)
 {
-	int c = fgetc(env->file);
+	int c = env->pos < env->bufend ? (unsigned char)*env->pos++ : EOF;
 	env->c = c;
 	if (c == '\n')
 		env->line++;
@@ -1318,7 +1324,7 @@ static void expect_list_begin(read_env_t *env)
 
 static bool list_has_next(read_env_t *env)
 {
-	if (feof(env->file)) {
+	if (env->c == EOF) {
 		parse_error(env, "Unexpected EOF while reading list");
 		exit(1);
 	}
@@ -2260,8 +2266,28 @@ int ir_import_file(FILE *input, const char *inputname)
 	env->idset      = new_set(id_cmp, 128);
 	env->fixedtypes = NEW_ARR_F(ir_type *, 0);
 	env->inputname  = inputname;
-	env->file       = input;
 	env->line       = 1;
+
+	/* Slurp the whole input up front: scanning memory is much faster than
+	 * going through stdio for every character. */
+	{
+		size_t capacity = 64 * 1024;
+		size_t size     = 0;
+		char  *buf      = XMALLOCN(char, capacity);
+		for (;;) {
+			size_t got = fread(buf + size, 1, capacity - size, input);
+			size += got;
+			if (got == 0)
+				break;
+			if (size == capacity) {
+				capacity *= 2;
+				buf = XREALLOC(buf, char, capacity);
+			}
+		}
+		env->buf    = buf;
+		env->pos    = buf;
+		env->bufend = buf + size;
+	}
 	env->delayed_initializers = NEW_ARR_F(delayed_initializer_t, 0);
 
 	/* read first character */
@@ -2342,6 +2368,7 @@ int ir_import_file(FILE *input, const char *inputname)
 
 	obstack_free(&env->preds_obst, NULL);
 	obstack_free(&env->obst, NULL);
+	free(env->buf);
 
 	pmap_destroy(node_readers);
 	node_readers = NULL;
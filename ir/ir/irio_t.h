@@ -24,7 +24,9 @@ typedef struct delayed_pred_t {
 
 typedef struct read_env_t {
 	int            c;           /**< currently read char */
-	FILE          *file;
+	char          *buf;         /**< complete input, slurped at import time */
+	const char    *pos;         /**< next character to read */
+	const char    *bufend;      /**< one past the last input character */
 	const char    *inputname;
 	unsigned       line;
 
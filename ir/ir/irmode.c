@@ -118,6 +118,7 @@ static ir_mode *alloc_mode(const char *name, ir_mode_sort sort,
 	mode_tmpl->sign         = sign ? 1 : 0;
 	mode_tmpl->modulo_shift = modulo_shift;
 	mode_tmpl->arithmetic   = arithmetic;
+	mode_tmpl->n_elems      = 1;
 	return mode_tmpl;
 }
 
@@ -206,6 +207,37 @@ ir_mode *new_non_arithmetic_mode(const char *name, unsigned bit_size)
 	return register_mode(result);
 }
 
+ir_mode *new_vector_mode(ir_mode *elem_mode, unsigned n_elems)
+{
+	assert(n_elems > 1);
+	assert(mode_is_num(elem_mode));
+
+	char name[32];
+	snprintf(name, sizeof(name), "v%u%s", n_elems, get_mode_name(elem_mode));
+	/* data modes are identified by name, so equal element/count
+	 * combinations fold onto the same mode in register_mode() */
+	ir_mode *result = alloc_mode(name, irms_data, irma_none,
+	                             n_elems * get_mode_size_bits(elem_mode), 0, 0);
+	result->elem_mode = elem_mode;
+	result->n_elems   = n_elems;
+	return register_mode(result);
+}
+
+int mode_is_vector(const ir_mode *mode)
+{
+	return mode->elem_mode != NULL;
+}
+
+unsigned get_mode_n_vector_elems(const ir_mode *mode)
+{
+	return mode->n_elems;
+}
+
+ir_mode *get_mode_element_mode(const ir_mode *mode)
+{
+	return mode->elem_mode;
+}
+
 static ir_mode *new_non_data_mode(const char *name)
 {
 	ir_mode *result = alloc_mode(name, irms_auxiliary, irma_none, 0, 0, 0);
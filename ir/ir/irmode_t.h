@@ -92,6 +92,10 @@ struct ir_mode {
 	/** For reference modes, a signed integer mode used to add/subtract
 	 * offsets. */
 	ir_mode            *offset_mode;
+	/** For vector modes, the mode of a single element, else NULL. */
+	ir_mode            *elem_mode;
+	/** Number of vector elements, 1 for scalar modes. */
+	unsigned            n_elems;
 };
 
 static inline ident *get_mode_ident_(const ir_mode *mode)
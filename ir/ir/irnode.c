@@ -11,6 +11,7 @@
 #include "irnode_t.h"
 
 #include "beinfo.h"
+#include "bitfiddle.h"
 #include "ident.h"
 #include "irbackedge_t.h"
 #include "ircons.h"
@@ -78,26 +79,39 @@ ir_node *new_ir_node(dbg_info *db, ir_graph *irg, ir_node *block, ir_op *op,
 {
 	assert(mode != NULL);
 
-	size_t   const node_size = offsetof(ir_node, attr) + op->attr_size;
-	ir_node *const res       = (ir_node*)OALLOCNZ(get_irg_obstack(irg), char, node_size);
+	size_t          const node_size = offsetof(ir_node, attr) + op->attr_size;
+	struct obstack *const obst      = get_irg_obstack(irg);
+	ir_node              *res;
+
+	if (arity >= 0 && op->opar != oparity_dynamic) {
+		/* Allocate the node header and its in-array as one block, so the
+		 * ins of the common small-arity nodes share the header's cache
+		 * lines instead of being scattered over the obstack. */
+		size_t const header_size = round_up2(node_size, sizeof(aligned_type));
+		size_t const in_size = ARR_ELTS_OFFS
+		                     + ((size_t)arity + 1) * sizeof(ir_node*);
+		char *const mem = OALLOCNZ(obst, char, header_size + in_size);
+		res     = (ir_node*)mem;
+		res->in = (ir_node**)ir_init_arr_d(mem + header_size, arity + 1);
+		MEMCPY(&res->in[1], in, arity);
+	} else {
+		res = (ir_node*)OALLOCNZ(obst, char, node_size);
+		if (arity < 0) {
+			res->in = NEW_ARR_F(ir_node *, 1);  /* 1: space for block */
+		} else {
+			/* Nodes with dynamic arity must always have a flexible array. */
+			res->in = NEW_ARR_F(ir_node *, (arity+1));
+			MEMCPY(&res->in[1], in, arity);
+		}
+	}
 
 	res->kind     = k_ir_node;
 	res->op       = op;
+	res->opcode   = op->code;
 	res->mode     = mode;
 	res->irg      = irg;
 	res->node_idx = irg_register_node_idx(irg, res);
 
-	if (arity < 0) {
-		res->in = NEW_ARR_F(ir_node *, 1);  /* 1: space for block */
-	} else {
-		/* Nodes with dynamic arity must always have a flexible array. */
-		if (op->opar == oparity_dynamic)
-			res->in = NEW_ARR_F(ir_node *, (arity+1));
-		else
-			res->in = NEW_ARR_D(ir_node*, get_irg_obstack(irg), arity + 1);
-		MEMCPY(&res->in[1], in, arity);
-	}
-
 	res->in[0]   = block;
 	set_irn_dbg_info(res, db);
 	res->node_nr = get_irp_new_node_nr();
@@ -115,6 +129,7 @@ ir_node *new_ir_node(dbg_info *db, ir_graph *irg, ir_node *block, ir_op *op,
 	for (int i = 0; i < arity; ++i)
 		edges_notify_edge(res, i, res->in[i+1], NULL, irg);
 
+	irg_inc_change_nr(irg);
 	hook_new_node(res);
 	if (irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_BACKEND))
 		be_info_new_node(irg, res);
@@ -193,6 +208,7 @@ void set_irn_in(ir_node *const node, int const arity, ir_node *const *const in)
 	MEMCPY(*pOld_in + 1, in, arity);
 
 	/* update irg flags */
+	irg_inc_change_nr(irg);
 	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
 }
 
@@ -216,6 +232,7 @@ void set_irn_n(ir_node *node, int n, ir_node *in)
 	node->in[n + 1] = in;
 
 	/* update irg flags */
+	irg_inc_change_nr(irg);
 	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
 }
 
@@ -582,6 +599,11 @@ const char *get_builtin_kind_name(ir_builtin_kind kind)
 		X(ir_bk_may_alias);
 		X(ir_bk_va_start);
 		X(ir_bk_va_arg);
+		X(ir_bk_add_overflow);
+		X(ir_bk_sub_overflow);
+		X(ir_bk_mul_overflow);
+		X(ir_bk_atomic_exchange);
+		X(ir_bk_atomic_fetch_add);
 	}
 	return "<unknown>";
 #undef X
@@ -840,6 +862,8 @@ int is_irn_const_memory(const ir_node *node)
 		case ir_bk_trap:
 		case ir_bk_debugbreak:
 		case ir_bk_compare_swap:
+		case ir_bk_atomic_exchange:
+		case ir_bk_atomic_fetch_add:
 		case ir_bk_va_start:
 		case ir_bk_va_arg:
 			return false;
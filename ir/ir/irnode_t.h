@@ -21,6 +21,18 @@
 #include "irop_t.h"
 #include "list.h"
 
+/**
+ * The checks in the node accessors are hot enough to show up in compile
+ * time profiles. Building with FIRM_FAST_ACCESSORS removes them even in
+ * asserting builds; embedders then validate graphs explicitly at their
+ * API boundary via ir_validate_api_usage().
+ */
+#ifdef FIRM_FAST_ACCESSORS
+#define irn_assert(expr) ((void)0)
+#else
+#define irn_assert(expr) assert(expr)
+#endif
+
 /* This section MUST come first, so the inline functions get used in this header. */
 #define get_irn_arity(node)                   get_irn_arity_(node)
 #define get_irn_n(node, n)                    get_irn_n_(node, n)
@@ -267,6 +279,9 @@ typedef union ir_attr {
  */
 typedef struct irn_edge_kind_info_t {
 	struct list_head outs_head;  /**< The list of all outs. */
+	ir_edge_t **in_edges;        /**< Edge objects of this node's in
+	                                  positions, indexed by pos + 1. */
+	unsigned n_in_edges;         /**< Capacity of in_edges. */
 	unsigned edges_built : 1;    /**< Set edges where built for this node. */
 	unsigned out_count   : 31;   /**< Number of outs in the list. */
 } irn_edge_info_t;
@@ -292,6 +307,11 @@ typedef struct ir_def_use_edges {
 struct ir_node {
 	firm_kind        kind;     /**< Distinguishes this node from others. */
 	unsigned         node_idx; /**< The node index of this node in its graph. */
+	unsigned         opcode;   /**< Cached copy of op->code, so opcode
+	                                dispatch reads the node header instead
+	                                of taking a detour through the ir_op
+	                                structure. Kept in sync by
+	                                set_irn_op(). */
 	ir_op           *op;       /**< The Opcode of this node. */
 	ir_mode         *mode;     /**< The Mode of this node. */
 	struct ir_node **in;       /**< The array of predecessors / operands. */
@@ -350,7 +370,8 @@ static inline ir_op *get_irn_op_(const ir_node *node)
  */
 static inline void set_irn_op(ir_node *node, ir_op *op)
 {
-	node->op = op;
+	node->op     = op;
+	node->opcode = op->code;
 }
 
 /** Copies all attributes stored in the old node  to the new node.
@@ -370,8 +391,9 @@ static inline void copy_node_attr_(ir_graph *irg, const ir_node *old_node,
  */
 static inline unsigned get_irn_opcode_(const ir_node *node)
 {
-	assert(k_ir_node == get_kind(node));
-	return node->op->code;
+	irn_assert(k_ir_node == get_kind(node));
+	irn_assert(node->opcode == node->op->code);
+	return node->opcode;
 }
 
 /**
@@ -390,7 +412,7 @@ static inline ir_node *get_irn_n_(const ir_node *node, int n)
 {
 	ir_node *nn;
 
-	assert(-1 <= n && n < get_irn_arity_(node));
+	irn_assert(-1 <= n && n < get_irn_arity_(node));
 
 	nn = node->in[n + 1];
 	if (!is_Id(nn)) return nn;
@@ -429,7 +451,7 @@ static inline void set_irn_mode_(ir_node *node, ir_mode *mode)
 
 static inline ir_node *get_nodes_block_(const ir_node *node)
 {
-	assert(!is_Block(node));
+	irn_assert(!is_Block(node));
 	return get_irn_n(node, -1);
 }
 
@@ -489,7 +511,7 @@ static inline int irn_visited_else_mark_(ir_node *node)
  */
 static inline void set_irn_link_(ir_node *node, void *link)
 {
-	assert(ir_resources_reserved(get_irn_irg(node)) & IR_RESOURCE_IRN_LINK);
+	irn_assert(ir_resources_reserved(get_irn_irg(node)) & IR_RESOURCE_IRN_LINK);
 	node->link = link;
 }
 
@@ -499,8 +521,8 @@ static inline void set_irn_link_(ir_node *node, void *link)
  */
 static inline void *get_irn_link_(const ir_node *node)
 {
-	assert(node->kind == k_ir_node);
-	assert(ir_resources_reserved(get_irn_irg(node)) & IR_RESOURCE_IRN_LINK);
+	irn_assert(node->kind == k_ir_node);
+	irn_assert(ir_resources_reserved(get_irn_irg(node)) & IR_RESOURCE_IRN_LINK);
 	return node->link;
 }
 
@@ -512,7 +534,7 @@ static inline void *get_irn_link_(const ir_node *node)
  */
 static inline int get_irn_pinned_(const ir_node *node)
 {
-	assert(node->kind == k_ir_node);
+	irn_assert(node->kind == k_ir_node);
 	/* Check opcode */
 	op_pin_state state = get_op_pinned_(get_irn_op_(node));
 	if (state >= op_pin_state_exc_pinned)
@@ -523,7 +545,7 @@ static inline int get_irn_pinned_(const ir_node *node)
 
 static inline int is_binop_(const ir_node *node)
 {
-	assert(node->kind == k_ir_node);
+	irn_assert(node->kind == k_ir_node);
 	return (node->op->opar == oparity_binary);
 }
 
@@ -551,13 +573,13 @@ static inline ir_node *get_Block_cfgpred_block_(const ir_node *node, int pos)
 
 static inline ir_visited_t get_Block_block_visited_(const ir_node *node)
 {
-	assert(is_Block(node));
+	irn_assert(is_Block(node));
 	return node->attr.block.block_visited;
 }
 
 static inline void set_Block_block_visited_(ir_node *node, ir_visited_t visit)
 {
-	assert(is_Block(node));
+	irn_assert(is_Block(node));
 	node->attr.block.block_visited = visit;
 }
 
@@ -647,9 +669,9 @@ static inline void set_irn_dbg_info_(ir_node *n, dbg_info *db)
  */
 static inline void set_Block_phis_(ir_node *block, ir_node *phi)
 {
-	assert(ir_resources_reserved(get_irn_irg(block)) & IR_RESOURCE_PHI_LIST);
-	assert(is_Block_(block));
-	assert(phi == NULL || is_Phi_(phi));
+	irn_assert(ir_resources_reserved(get_irn_irg(block)) & IR_RESOURCE_PHI_LIST);
+	irn_assert(is_Block_(block));
+	irn_assert(phi == NULL || is_Phi_(phi));
 	block->attr.block.phis = phi;
 }
 
@@ -659,29 +681,29 @@ static inline void set_Block_phis_(ir_node *block, ir_node *phi)
  */
 static inline ir_node *get_Block_phis_(const ir_node *block)
 {
-	assert(ir_resources_reserved(get_irn_irg(block)) & IR_RESOURCE_PHI_LIST);
-	assert(is_Block_(block));
+	irn_assert(ir_resources_reserved(get_irn_irg(block)) & IR_RESOURCE_PHI_LIST);
+	irn_assert(is_Block_(block));
 	return block->attr.block.phis;
 }
 
 static inline void set_Phi_next_(ir_node *phi, ir_node *next)
 {
-	assert(ir_resources_reserved(get_irn_irg(phi)) & IR_RESOURCE_PHI_LIST);
-	assert(is_Phi_(phi));
+	irn_assert(ir_resources_reserved(get_irn_irg(phi)) & IR_RESOURCE_PHI_LIST);
+	irn_assert(is_Phi_(phi));
 	phi->attr.phi.next = next;
 }
 
 static inline ir_node *get_Phi_next_(const ir_node *phi)
 {
-	assert(ir_resources_reserved(get_irn_irg(phi)) & IR_RESOURCE_PHI_LIST);
-	assert(is_Phi_(phi));
+	irn_assert(ir_resources_reserved(get_irn_irg(phi)) & IR_RESOURCE_PHI_LIST);
+	irn_assert(is_Phi_(phi));
 	return phi->attr.phi.next;
 }
 
 /** Add a Phi node to the list of Block Phi's. */
 static inline void add_Block_phi_(ir_node *block, ir_node *phi)
 {
-	assert(is_Block_(block));
+	irn_assert(is_Block_(block));
 	set_Phi_next_(phi, get_Block_phis_(block));
 	set_Block_phis_(block, phi);
 }
@@ -689,14 +711,14 @@ static inline void add_Block_phi_(ir_node *block, ir_node *phi)
 /** Get the Block mark (single bit). */
 static inline unsigned get_Block_mark_(const ir_node *block)
 {
-	assert(is_Block_(block));
+	irn_assert(is_Block_(block));
 	return block->attr.block.marked;
 }
 
 /** Set the Block mark (single bit). */
 static inline void set_Block_mark_(ir_node *block, unsigned mark)
 {
-	assert(is_Block_(block));
+	irn_assert(is_Block_(block));
 	block->attr.block.marked = mark;
 }
 
@@ -708,14 +730,14 @@ static inline size_t ir_switch_table_get_n_entries_(const ir_switch_table *table
 static inline ir_switch_table_entry *ir_switch_table_get_entry(
 		ir_switch_table *table, size_t entry)
 {
-	assert(entry < table->n_entries);
+	irn_assert(entry < table->n_entries);
 	return &table->entries[entry];
 }
 
 static inline const ir_switch_table_entry *ir_switch_table_get_entry_const(
 		const ir_switch_table *table, size_t entry)
 {
-	assert(entry < table->n_entries);
+	irn_assert(entry < table->n_entries);
 	return &table->entries[entry];
 }
 
@@ -0,0 +1,108 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Typed per-node side arrays. Like ir_nodemap this is indexed by
+ *          node index, but the data is stored by value in one flat
+ *          allocation instead of mapping to separately allocated records.
+ *          Initializing covers the whole graph with a single zeroed
+ *          allocation and any number of side arrays may be live on the
+ *          same graph simultaneously, so passes needing scratch data per
+ *          node do not have to fight over the single link field.
+ */
+#ifndef FIRM_IRNODEDATA_H
+#define FIRM_IRNODEDATA_H
+
+#include "irnodedata_t.h"
+#include "firm_types.h"
+#include "irgraph_t.h"
+#include "irnode_t.h"
+#include "util.h"
+#include "xmalloc.h"
+#include <string.h>
+
+/**
+ * Initialize a nodedata object holding one element of @p elt_size bytes
+ * for every node of @p irg. All elements start out zeroed.
+ */
+static inline void ir_nodedata_init(ir_nodedata *nodedata, const ir_graph *irg,
+                                    size_t elt_size)
+{
+	size_t n_elts = get_irg_last_idx(irg) + 32;
+	nodedata->data     = XMALLOCNZ(char, n_elts * elt_size);
+	nodedata->elt_size = elt_size;
+	nodedata->n_elts   = n_elts;
+}
+
+/**
+ * Frees all internal memory used by the nodedata but does not free the
+ * nodedata struct itself.
+ */
+static inline void ir_nodedata_destroy(ir_nodedata *nodedata)
+{
+	free(nodedata->data);
+	nodedata->data = NULL;
+}
+
+/**
+ * Make sure the side array covers all nodes currently in @p irg. Pointers
+ * obtained from ir_nodedata_get() stay valid as long as no element of a
+ * node outside the covered range is requested, so call this after creating
+ * nodes when element pointers are kept across further accesses.
+ */
+static inline void ir_nodedata_reserve(ir_nodedata *nodedata,
+                                       const ir_graph *irg)
+{
+	size_t n_elts = get_irg_last_idx(irg);
+	if (n_elts <= nodedata->n_elts)
+		return;
+	nodedata->data = XREALLOC(nodedata->data, char,
+	                          n_elts * nodedata->elt_size);
+	memset(nodedata->data + nodedata->n_elts * nodedata->elt_size, 0,
+	       (n_elts - nodedata->n_elts) * nodedata->elt_size);
+	nodedata->n_elts = n_elts;
+}
+
+/**
+ * Get a pointer to the element of @p node, growing the side array if the
+ * node was created after initialization. New elements are zeroed.
+ */
+static inline void *ir_nodedata_get(ir_nodedata *nodedata,
+                                    const ir_node *node)
+{
+	size_t idx = get_irn_idx(node);
+	if (idx >= nodedata->n_elts) {
+		size_t old_n  = nodedata->n_elts;
+		size_t n_elts = MAX(idx + 1, old_n * 2);
+		nodedata->data = XREALLOC(nodedata->data, char,
+		                          n_elts * nodedata->elt_size);
+		memset(nodedata->data + old_n * nodedata->elt_size, 0,
+		       (n_elts - old_n) * nodedata->elt_size);
+		nodedata->n_elts = n_elts;
+	}
+	return nodedata->data + idx * nodedata->elt_size;
+}
+
+#define ir_nodedata_get(type, nodedata, node) ((type*)ir_nodedata_get(nodedata, node))
+
+/**
+ * Get a pointer to the element of @p node (fast version).
+ *
+ * @attention You must only use this version if you can be sure that the
+ * side array already covers @p node. This is the case if the node already
+ * existed at ir_nodedata_init() time or after ir_nodedata_reserve().
+ */
+static inline void *ir_nodedata_get_fast(const ir_nodedata *nodedata,
+                                         const ir_node *node)
+{
+	size_t idx = get_irn_idx(node);
+	assert(idx < nodedata->n_elts);
+	return nodedata->data + idx * nodedata->elt_size;
+}
+
+#define ir_nodedata_get_fast(type, nodedata, node) ((type*)ir_nodedata_get_fast(nodedata, node))
+
+#endif
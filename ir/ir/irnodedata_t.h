@@ -0,0 +1,21 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   nodedata -- private header.
+ */
+#ifndef FIRM_IRNODEDATA_T_H
+#define FIRM_IRNODEDATA_T_H
+
+#include <stddef.h>
+
+typedef struct ir_nodedata {
+	char  *data;     /**< value storage, n_elts * elt_size bytes */
+	size_t elt_size; /**< size of one element in bytes */
+	size_t n_elts;   /**< number of elements allocated */
+} ir_nodedata;
+
+#endif
@@ -15,10 +15,18 @@
 
 #include "hashptr.h"
 #include "irnode_t.h"
+#include "xmalloc.h"
 
 static ir_nodehashmap_entry_t null_nodehashmap_entry = { NULL, NULL };
 
 #define DO_REHASH
+#define HT_MIN_BUCKETS            IR_NODEHASHMAP_N_INSITU
+#define Alloc(size)               ((size) <= IR_NODEHASHMAP_N_INSITU \
+                                   && self->entries != self->small_entries \
+                                   ? self->small_entries \
+                                   : XMALLOCN(ir_nodehashmap_entry_t, (size)))
+#define Free(ptr)                 ((ptr) == self->small_entries ? (void)0 \
+                                                                : free(ptr))
 #define HashSet                   ir_nodehashmap_t
 #define HashSetIterator           ir_nodehashmap_iterator_t
 #define ValueType                 ir_nodehashmap_entry_t
@@ -36,8 +44,10 @@ static ir_nodehashmap_entry_t null_nodehashmap_entry = { NULL, NULL };
 #define EntryIsDeleted(value)     ((value).node == (ir_node*)-1)
 
 void ir_nodehashmap_init_(ir_nodehashmap_t *self);
+void ir_nodehashmap_init_size_(ir_nodehashmap_t *self,
+                               size_t expected_elements);
 #define hashset_init            ir_nodehashmap_init_
-#define hashset_init_size       ir_nodehashmap_init_size
+#define hashset_init_size       ir_nodehashmap_init_size_
 #define hashset_destroy         ir_nodehashmap_destroy
 ir_nodehashmap_entry_t *ir_nodehashmap_insert_(ir_nodehashmap_t *self,
                                                ir_node *node);
@@ -53,9 +63,25 @@ ir_nodehashmap_entry_t *ir_nodehashmap_find_(const ir_nodehashmap_t *self,
 
 #include "hashset.c.h"
 
+void ir_nodehashmap_init_size(ir_nodehashmap_t *nodehashmap,
+                              size_t expected_elements)
+{
+	/* tell Alloc() that the in-situ buffer is still free */
+	nodehashmap->entries = NULL;
+	ir_nodehashmap_init_size_(nodehashmap, expected_elements);
+}
+
 void ir_nodehashmap_init(ir_nodehashmap_t *nodehashmap)
 {
-	ir_nodehashmap_init_size(nodehashmap, 16);
+	ir_nodehashmap_init_size(nodehashmap, IR_NODEHASHMAP_N_INSITU / 2);
+}
+
+void ir_nodehashmap_move(ir_nodehashmap_t *dest, ir_nodehashmap_t *source)
+{
+	*dest = *source;
+	if (source->entries == source->small_entries)
+		dest->entries = dest->small_entries;
+	source->entries = NULL;
 }
 
 void *(ir_nodehashmap_get)(const ir_nodehashmap_t *self, const ir_node *node)
@@ -20,11 +20,16 @@ typedef struct ir_nodehashmap_entry_t {
 	void    *data;
 } ir_nodehashmap_entry_t;
 
+/** number of entries stored inside the map before spilling to the heap */
+#define IR_NODEHASHMAP_N_INSITU 8
+
 #define HashSet          ir_nodehashmap_t
 #define HashSetIterator  ir_nodehashmap_iterator_t
 #define ValueType        ir_nodehashmap_entry_t
 #define DO_REHASH
+#define ADDITIONAL_DATA  ir_nodehashmap_entry_t small_entries[IR_NODEHASHMAP_N_INSITU];
 #include "hashset.h"
+#undef ADDITIONAL_DATA
 #undef DO_REHASH
 #undef ValueType
 #undef HashSetIterator
@@ -58,6 +63,14 @@ void ir_nodehashmap_init_size(ir_nodehashmap_t *nodehashmap,
  */
 void ir_nodehashmap_destroy(ir_nodehashmap_t *nodehashmap);
 
+/**
+ * Transfers the contents of @p source to @p dest without copying the
+ * entries one by one. @p dest must not be initialized yet, @p source is
+ * left empty and must be initialized again before further use (it may
+ * still be destroyed).
+ */
+void ir_nodehashmap_move(ir_nodehashmap_t *dest, ir_nodehashmap_t *source);
+
 /**
  * Inserts a node into a nodehashmap.
  *
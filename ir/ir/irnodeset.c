@@ -17,6 +17,13 @@
 
 #define DO_REHASH
 #define ID_HASH
+#define HT_MIN_BUCKETS            IR_NODESET_N_INSITU
+#define Alloc(size)               ((size) <= IR_NODESET_N_INSITU \
+                                   && self->entries != self->small_entries \
+                                   ? self->small_entries \
+                                   : XMALLOCN(ir_node*, (size)))
+#define Free(ptr)                 ((ptr) == self->small_entries ? (void)0 \
+                                                                : free(ptr))
 #define HashSet                   ir_nodeset_t
 #define HashSetIterator           ir_nodeset_iterator_t
 #define ValueType                 ir_node*
@@ -27,8 +34,9 @@
 #define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof((ptr)[0]))
 
 void ir_nodeset_init_(ir_nodeset_t *self);
+void ir_nodeset_init_size_(ir_nodeset_t *self, size_t expected_elements);
 #define hashset_init            ir_nodeset_init_
-#define hashset_init_size       ir_nodeset_init_size
+#define hashset_init_size       ir_nodeset_init_size_
 #define hashset_destroy         ir_nodeset_destroy
 #define hashset_insert          ir_nodeset_insert
 #define hashset_remove          ir_nodeset_remove
@@ -40,7 +48,22 @@ void ir_nodeset_init_(ir_nodeset_t *self);
 
 #include "hashset.c.h"
 
+void ir_nodeset_init_size(ir_nodeset_t *nodeset, size_t expected_elements)
+{
+	/* tell Alloc() that the in-situ buffer is still free */
+	nodeset->entries = NULL;
+	ir_nodeset_init_size_(nodeset, expected_elements);
+}
+
 void ir_nodeset_init(ir_nodeset_t *nodeset)
 {
-	ir_nodeset_init_size(nodeset, 16);
+	ir_nodeset_init_size(nodeset, IR_NODESET_N_INSITU / 2);
+}
+
+void ir_nodeset_move(ir_nodeset_t *dest, ir_nodeset_t *source)
+{
+	*dest = *source;
+	if (source->entries == source->small_entries)
+		dest->entries = dest->small_entries;
+	source->entries = NULL;
 }
@@ -19,13 +19,18 @@
 #include "firm_types.h"
 #include "xmalloc.h"
 
+/** number of entries stored inside the set before spilling to the heap */
+#define IR_NODESET_N_INSITU 8
+
 #define HashSet          ir_nodeset_t
 #define HashSetIterator  ir_nodeset_iterator_t
 #define ValueType        ir_node*
 #define DO_REHASH
+#define ADDITIONAL_DATA  ir_node *small_entries[IR_NODESET_N_INSITU];
 
 #include "hashset.h"
 
+#undef ADDITIONAL_DATA
 #undef DO_REHASH
 #undef ValueType
 #undef HashSetIterator
@@ -57,6 +62,14 @@ void ir_nodeset_init_size(ir_nodeset_t *nodeset, size_t expected_elements);
  */
 void ir_nodeset_destroy(ir_nodeset_t *nodeset);
 
+/**
+ * Transfers the contents of @p source to @p dest without copying the
+ * elements one by one. @p dest must not be initialized yet, @p source is
+ * left empty and must be initialized again before further use (it may
+ * still be destroyed).
+ */
+void ir_nodeset_move(ir_nodeset_t *dest, ir_nodeset_t *source);
+
 /**
  * Allocates memory for a nodeset and initializes the set.
  *
@@ -8,6 +8,7 @@
  * @brief   Representation of opcode of intermediate operation.
  * @author  Christian Schaefer, Goetz Lindenmaier, Michael Beck
  */
+#include "hashptr.h"
 #include "irop_t.h"
 
 #include "benode.h"
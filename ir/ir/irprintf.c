@@ -71,3 +71,38 @@ int ir_obst_vprintf(struct obstack *obst, const char *fmt, va_list args)
 {
 	return lc_evoprintf(firm_get_arg_env(), obst, fmt, args);
 }
+
+/** Prints @p obj like %F/%+F without going through the format parser. */
+static void fprint_obj(FILE *f, const void *obj, bool with_nr)
+{
+	if (obj == NULL) {
+		fputs("(null)", f);
+		return;
+	}
+	char buf[256];
+	char add[64];
+	firm_format_obj(buf, sizeof(buf), add, sizeof(add), obj, '\0', false);
+	fputs(buf, f);
+	if (with_nr)
+		fputs(add, f);
+}
+
+void ir_fprint_tarval(FILE *f, ir_tarval const *tv)
+{
+	fprint_obj(f, tv, false);
+}
+
+void ir_fprint_entity(FILE *f, ir_entity const *entity)
+{
+	fprint_obj(f, entity, false);
+}
+
+void ir_fprint_type(FILE *f, ir_type const *type)
+{
+	fprint_obj(f, type, true);
+}
+
+void ir_fprint_node(FILE *f, ir_node const *node)
+{
+	fprint_obj(f, node, true);
+}
@@ -71,6 +71,11 @@ static int cmp_execcount(const void *a, const void *b, size_t size)
 	return ea->block != eb->block;
 }
 
+bool ir_profile_has_data(void)
+{
+	return profile != NULL;
+}
+
 uint32_t ir_profile_get_block_execcount(const ir_node *block)
 {
 	execcount_t  const query = { .block = get_irn_node_nr(block), .count = 0 };
@@ -85,17 +90,42 @@ uint32_t ir_profile_get_block_execcount(const ir_node *block)
 }
 
 /**
- * Block walker, count number of blocks.
+ * Check whether the execution count of a block equals the one of its single
+ * predecessor, so it needs no counter of its own. This is the case on
+ * single-entry/single-exit chains: every execution of the predecessor
+ * continues into this block and there is no other way in.
+ *
+ * The predicate only depends on the shape of the control flow graph, so the
+ * instrumenting and the reading compiler run agree on which blocks own a
+ * counter - the same property the positional counter matching relies on
+ * anyway.
+ */
+static bool block_count_derivable(const ir_node *bb)
+{
+	ir_graph *const irg = get_irn_irg(bb);
+	if (bb == get_irg_start_block(irg) || bb == get_irg_end_block(irg))
+		return false;
+	if (get_Block_n_cfgpreds(bb) != 1)
+		return false;
+	/* entered through an unconditional jump only: every execution of the
+	 * predecessor continues here */
+	ir_node *const pred = get_Block_cfgpred(bb, 0);
+	return is_Jmp(pred) && get_nodes_block(pred) != bb;
+}
+
+/**
+ * Block walker, count number of blocks needing their own counter.
  */
 static void block_counter(ir_node *bb, void *data)
 {
 	unsigned *const count = (unsigned*)data;
-	(void)bb;
+	if (block_count_derivable(bb))
+		return;
 	++*count;
 }
 
 /**
- * Returns the number of blocks the given graph.
+ * Returns the number of counters needed for the given graph.
  */
 static unsigned int get_irg_n_blocks(ir_graph *irg)
 {
@@ -233,6 +263,27 @@ static void instrument_block(ir_node *const bb, ir_node *const address, unsigned
 	set_irn_link(smem, load);
 }
 
+/**
+ * Returns the instrumentation memory state at the end of the given block.
+ *
+ * For instrumented blocks this is the store result set up by
+ * instrument_block(). Blocks sharing their predecessor's counter leave the
+ * instrumentation memory untouched and simply forward the predecessor's
+ * state.
+ */
+static ir_node *get_block_end_mem(ir_node *bb)
+{
+	ir_node *link = (ir_node*)get_irn_link(bb);
+	if (link != NULL)
+		return link;
+
+	assert(block_count_derivable(bb));
+	ir_node *const pred = get_Block_cfgpred_block(bb, 0);
+	ir_node *const mem  = get_block_end_mem(pred);
+	set_irn_link(bb, mem);
+	return mem;
+}
+
 /**
  * SSA Construction for instrumentation code memory.
  *
@@ -250,18 +301,22 @@ static void fix_ssa(ir_node *const bb, void *const data)
 	if (bb == get_irg_end_block(irg))
 		return;
 
+	/* blocks sharing their predecessor's counter have no load to wire up */
+	if (block_count_derivable(bb))
+		return;
+
 	ir_node  *mem;
 	int const arity = get_Block_n_cfgpreds(bb);
 	if (bb == get_irg_start_block(irg)) {
 		mem = get_irg_initial_mem(irg);
 	} else if (arity == 1) {
 		ir_node *const pred = get_Block_cfgpred_block(bb, 0);
-		mem = pred ? (ir_node*)get_irn_link(pred) : new_r_NoMem(irg);
+		mem = pred ? get_block_end_mem(pred) : new_r_NoMem(irg);
 	} else {
 		ir_node **ins = ALLOCAN(ir_node*, arity);
 		for (int n = arity; n-- != 0;) {
 			ir_node *const pred = get_Block_cfgpred_block(bb, n);
-			ins[n] = pred ? (ir_node*)get_irn_link(pred) : new_r_NoMem(irg);
+			ins[n] = pred ? get_block_end_mem(pred) : new_r_NoMem(irg);
 		}
 		mem = new_r_Phi(bb, arity, ins, mode_M);
 	}
@@ -280,6 +335,8 @@ static void fix_ssa(ir_node *const bb, void *const data)
 static void block_instrument_walker(ir_node *bb, void *data)
 {
 	block_id_walker_data_t *wd = (block_id_walker_data_t*)data;
+	if (block_count_derivable(bb))
+		return;
 	instrument_block(bb, wd->counters, wd->id);
 	++wd->id;
 }
@@ -290,7 +347,7 @@ static void block_instrument_walker(ir_node *bb, void *data)
  */
 static ir_node *sync_mem(ir_node *bb, ir_node *mem)
 {
-	ir_node *const ins[] = { (ir_node*)get_irn_link(bb), mem };
+	ir_node *const ins[] = { get_block_end_mem(bb), mem };
 	return new_r_Sync(bb, ARRAY_SIZE(ins), ins);
 }
 
@@ -423,36 +480,63 @@ static unsigned int *parse_profile(const char *filename, unsigned int num_blocks
 		return NULL;
 	}
 
-	/* check header */
-	uint32_t *result = NULL;
-	char      buf[8];
-	size_t    ret = fread(buf, 8, 1, f);
-	if (ret == 0 || strncmp(buf, "firmprof", 8) != 0) {
+	/* Slurp the whole file and decode from memory: profiles are read
+	 * exactly once per compiler run and decoding beats a stdio call per
+	 * counter. */
+	uint32_t      *result = NULL;
+	unsigned char *buf    = NULL;
+	long           file_size;
+	if (fseek(f, 0, SEEK_END) != 0 || (file_size = ftell(f)) < 8
+	 || fseek(f, 0, SEEK_SET) != 0) {
 		DBG((dbg, LEVEL_2, "Broken fileheader in profile\n"));
 		goto end;
 	}
-
-	result = XMALLOCN(unsigned int, num_blocks);
-
-	/* The profiling output format is defined to be a sequence of integer
-	 * values stored little endian format. */
-	for (unsigned i = 0; i < num_blocks; ++i) {
-		unsigned char bytes[4];
-		if ((ret = fread(bytes, 1, 4, f)) < 1)
-			break;
-
-		result[i] = (bytes[0] <<  0) | (bytes[1] <<  8)
-		          | (bytes[2] << 16) | (bytes[3] << 24);
+	buf = XMALLOCN(unsigned char, (size_t)file_size);
+	if (fread(buf, 1, (size_t)file_size, f) != (size_t)file_size) {
+		DBG((dbg, LEVEL_2, "Failed to read profile file (%s)\n", filename));
+		goto end;
 	}
 
-	if (ret < 1) {
-		DBG((dbg, LEVEL_4, "Failed to read counters... (size: %u)\n",
-			sizeof(unsigned int) * num_blocks));
-		free(result);
-		result = NULL;
+	unsigned char const       *p        = buf + 8;
+	unsigned char const *const file_end = buf + file_size;
+	if (memcmp(buf, "firmprf2", 8) == 0) {
+		/* Counters are stored as ULEB128, so cold blocks take one byte. */
+		result = XMALLOCN(uint32_t, num_blocks);
+		for (unsigned i = 0; i < num_blocks; ++i) {
+			uint32_t value = 0;
+			unsigned shift = 0;
+			unsigned char byte;
+			do {
+				if (p == file_end || shift >= 32) {
+					DBG((dbg, LEVEL_4, "Truncated counters in profile\n"));
+					free(result);
+					result = NULL;
+					goto end;
+				}
+				byte   = *p++;
+				value |= (uint32_t)(byte & 0x7f) << shift;
+				shift += 7;
+			} while (byte & 0x80);
+			result[i] = value;
+		}
+	} else if (memcmp(buf, "firmprof", 8) == 0) {
+		/* The old format is a sequence of integer values stored in little
+		 * endian format. */
+		if ((size_t)(file_end - p) < (size_t)num_blocks * 4) {
+			DBG((dbg, LEVEL_4, "Truncated counters in profile\n"));
+			goto end;
+		}
+		result = XMALLOCN(uint32_t, num_blocks);
+		for (unsigned i = 0; i < num_blocks; ++i, p += 4) {
+			result[i] = ((uint32_t)p[0] <<  0) | ((uint32_t)p[1] <<  8)
+			          | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+		}
+	} else {
+		DBG((dbg, LEVEL_2, "Broken fileheader in profile\n"));
 	}
 
 end:
+	free(buf);
 	fclose(f);
 	return result;
 }
@@ -465,16 +549,43 @@ static void block_associate_walker(ir_node *bb, void *env)
 	block_assoc_t *b = (block_assoc_t*)env;
 	execcount_t query;
 
+	if (block_count_derivable(bb))
+		return;
+
 	query.block = get_irn_node_nr(bb);
 	query.count = b->counters[b->i++];
 	DBG((dbg, LEVEL_4, "execcount(%+F, %u): %u\n", bb, query.block, query.count));
 	(void)set_insert(execcount_t, profile, &query, sizeof(query), query.block);
 }
 
+/**
+ * Second pass: blocks without an own counter inherit the count of the
+ * head of their single-entry/single-exit chain.
+ */
+static void block_associate_derived_walker(ir_node *bb, void *env)
+{
+	(void)env;
+	if (!block_count_derivable(bb))
+		return;
+
+	ir_node *source = bb;
+	do {
+		source = get_Block_cfgpred_block(source, 0);
+	} while (block_count_derivable(source));
+
+	execcount_t query;
+	query.block = get_irn_node_nr(bb);
+	query.count = ir_profile_get_block_execcount(source);
+	DBG((dbg, LEVEL_4, "execcount(%+F, %u): %u (from %+F)\n", bb, query.block,
+	     query.count, source));
+	(void)set_insert(execcount_t, profile, &query, sizeof(query), query.block);
+}
+
 static void irp_associate_blocks(block_assoc_t *env)
 {
 	foreach_irp_irg_r(i, irg) {
 		irg_block_walk_graph(irg, block_associate_walker, NULL, env);
+		irg_block_walk_graph(irg, block_associate_derived_walker, NULL, NULL);
 	}
 }
 
@@ -37,6 +37,11 @@ bool ir_profile_read(const char *filename);
  */
 void ir_profile_free(void);
 
+/**
+ * Returns true if profile information was read and is available
+ */
+bool ir_profile_has_data(void);
+
 /**
  * Get block execution count as determined be profiling
  */
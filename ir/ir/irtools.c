@@ -12,6 +12,7 @@
 
 #include "irbackedge_t.h"
 #include "irnode_t.h"
+#include "irnodemap.h"
 #include "iropt_t.h"
 #include "irprintf.h"
 #include <stdlib.h>
@@ -71,3 +72,21 @@ void irn_rewire_inputs(ir_node *node)
 	/* Now the new node is complete. We can add it to the hash table for CSE. */
 	add_identities(new_node);
 }
+
+void irn_rewire_inputs_map(ir_node *node, ir_nodemap *copies)
+{
+	ir_node *new_node = ir_nodemap_get(ir_node, copies, node);
+	if (!is_Block(node)) {
+		ir_node *block     = get_nodes_block(node);
+		ir_node *new_block = ir_nodemap_get(ir_node, copies, block);
+		set_nodes_block(new_node, new_block);
+	}
+
+	foreach_irn_in(node, i, in) {
+		ir_node *new_in = ir_nodemap_get(ir_node, copies, in);
+		set_irn_n(new_node, i, new_in);
+	}
+
+	/* Now the new node is complete. We can add it to the hash table for CSE. */
+	add_identities(new_node);
+}
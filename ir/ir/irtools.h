@@ -12,6 +12,7 @@
 #define FIRM_COMMON_IRTOOLS_H
 
 #include "firm_types.h"
+#include "irnodemap_t.h"
 #include "lc_opts.h"
 #include "pset.h"
 
@@ -58,4 +59,16 @@ void firm_collect_block_phis(ir_node *node, void *env);
  */
 void irn_rewire_inputs(ir_node *node);
 
+/**
+ * Variant of irn_rewire_inputs() for copy routines that record the
+ * old-node to new-node mapping in an index-keyed ir_nodemap instead of
+ * the link fields.  This neither requires IR_RESOURCE_IRN_LINK nor
+ * touches the old nodes, so it can run while the links are in use
+ * elsewhere.
+ *
+ * @param node    an old node whose copy is in @p copies
+ * @param copies  maps every reachable old node to its copy
+ */
+void irn_rewire_inputs_map(ir_node *node, ir_nodemap *copies);
+
 #endif
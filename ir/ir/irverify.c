@@ -16,14 +16,17 @@
 #include "irdump.h"
 #include "iredges_t.h"
 #include "irflag_t.h"
+#include "irgopt.h"
 #include "irgraph_t.h"
 #include "irgwalk.h"
+#include "irhooks.h"
 #include "irnode_t.h"
 #include "irnodeset.h"
 #include "irop_t.h"
 #include "irouts.h"
 #include "irprintf.h"
 #include "irprog.h"
+#include "util.h"
 
 static void warn(const ir_node *n, const char *format, ...)
 {
@@ -1302,6 +1305,96 @@ void irg_assert_verify(ir_graph *irg)
 	}
 }
 
+/* -- tiered verification -------------------------------------------- */
+
+/** Nodes created or exchanged since the last incremental verification. */
+static ir_nodeset_t verify_touched;
+static bool         verify_incremental;
+static hook_entry_t touch_new_node_hook;
+static hook_entry_t touch_replace_hook;
+
+static void touch_new_node(void *context, ir_node *node)
+{
+	(void)context;
+	ir_nodeset_insert(&verify_touched, node);
+}
+
+static void touch_replace(void *context, ir_node *old, ir_node *nw)
+{
+	(void)context;
+	ir_nodeset_insert(&verify_touched, old);
+	if (nw != NULL)
+		ir_nodeset_insert(&verify_touched, nw);
+}
+
+void ir_verify_enable_incremental(int enable)
+{
+	if ((bool)enable == verify_incremental)
+		return;
+	verify_incremental = enable;
+	if (enable) {
+		ir_nodeset_init(&verify_touched);
+		touch_new_node_hook.hook._hook_new_node = touch_new_node;
+		touch_replace_hook.hook._hook_replace   = touch_replace;
+		register_hook(hook_new_node, &touch_new_node_hook);
+		register_hook(hook_replace, &touch_replace_hook);
+	} else {
+		unregister_hook(hook_new_node, &touch_new_node_hook);
+		unregister_hook(hook_replace, &touch_replace_hook);
+		ir_nodeset_destroy(&verify_touched);
+	}
+}
+
+int irg_verify_incremental(ir_graph *irg)
+{
+	if (!verify_incremental)
+		return irg_verify(irg);
+
+	bool       fine       = true;
+	bool const have_edges = edges_activated(irg);
+	foreach_ir_nodeset(&verify_touched, node, iter) {
+		if (get_irn_irg(node) != irg)
+			continue;
+		ir_nodeset_remove_iterator(&verify_touched, &iter);
+		/* nodes consumed by an exchange are allowed to linger */
+		if (is_Deleted(node) || is_Id(node))
+			continue;
+		fine &= irn_verify(node);
+		/* an exchange may have made the inputs of the rewired users
+		 * inconsistent, check them too when the edges are cheap to get */
+		if (have_edges) {
+			foreach_out_edge(node, edge) {
+				fine &= irn_verify(get_edge_src_irn(edge));
+			}
+		}
+	}
+	return fine;
+}
+
+/* Only ever flipped to false by the workers, so the race is benign. */
+static bool irp_verify_fine;
+
+static void verify_graph_pass(ir_graph *irg)
+{
+	if (!irg_verify(irg))
+		irp_verify_fine = false;
+}
+
+int irp_verify(unsigned n_threads)
+{
+	irp_verify_fine = true;
+	static irg_pass_func const passes[] = { verify_graph_pass };
+	run_irg_passes(passes, ARRAY_SIZE(passes), n_threads);
+	return irp_verify_fine;
+}
+
+int ir_validate_api_usage(void)
+{
+	int fine = irp_verify(0);
+	fine &= tr_verify();
+	return fine;
+}
+
 void ir_register_verify_node_ops(void)
 {
 	set_op_verify(op_Add,      verify_node_Add);
@@ -14,29 +14,6 @@
 #include "adt/array.h"
 #include <string.h>
 
-num pbqp_add(num x, num y)
-{
-	if (x == INF_COSTS || y == INF_COSTS)
-		return INF_COSTS;
-
-	num res = x + y;
-
-#if !KAPS_USE_UNSIGNED
-	/* No positive overflow. */
-	assert(x < 0 || y < 0 || res >= x);
-	assert(x < 0 || y < 0 || res >= y);
-#endif
-
-	/* No negative overflow. */
-	assert(x > 0 || y > 0 || res <= x);
-	assert(x > 0 || y > 0 || res <= y);
-
-	/* Result is not infinity.*/
-	assert(res < INF_COSTS);
-
-	return res;
-}
-
 vector_t *vector_alloc(pbqp_t *pbqp, unsigned length)
 {
 	vector_t *vec = (vector_t *)obstack_alloc(&pbqp->obstack, sizeof(*vec) + sizeof(*vec->entries) * length);
@@ -14,7 +14,47 @@
 
 #include "vector_t.h"
 
-num pbqp_add(num x, num y);
+#include <assert.h>
+
+/**
+ * Saturating cost addition: infinity absorbs everything else.
+ *
+ * This is the innermost operation of all reductions, so it is inlined
+ * and, for unsigned costs, branch-free: infinity is the maximum value,
+ * hence a wrapped sum can only stem from an infinite operand and is
+ * flushed back to infinity with a mask. This keeps the loops over
+ * vectors and matrix rows free of data-dependent branches, so compilers
+ * can vectorize them.
+ */
+static inline num pbqp_add(num x, num y)
+{
+#if KAPS_USE_UNSIGNED
+	num res = x + y;
+	res |= -(num)(res < x);
+
+	/* A wrapped or exactly infinite sum of finite costs is an overflow. */
+	assert(res != INF_COSTS || x == INF_COSTS || y == INF_COSTS);
+	return res;
+#else
+	if (x == INF_COSTS || y == INF_COSTS)
+		return INF_COSTS;
+
+	num res = x + y;
+
+	/* No positive overflow. */
+	assert(x < 0 || y < 0 || res >= x);
+	assert(x < 0 || y < 0 || res >= y);
+
+	/* No negative overflow. */
+	assert(x > 0 || y > 0 || res <= x);
+	assert(x > 0 || y > 0 || res <= y);
+
+	/* Result is not infinity.*/
+	assert(res < INF_COSTS);
+
+	return res;
+#endif
+}
 
 vector_t *vector_alloc(pbqp_t *pbqp, unsigned length);
 
@@ -32,6 +32,18 @@ static void set_name(lc_opt_entry_t *ent, const char *name)
 #define entry_matches(ent,hash_val,str) \
 	((ent)->hash == hash_val && streq((ent)->name, (str)))
 
+static unsigned entry_index_hash(const void *obj)
+{
+	return ((const lc_opt_entry_t*)obj)->hash;
+}
+
+static int entry_index_cmp(const void *p1, const void *p2)
+{
+	const lc_opt_entry_t *e1 = (const lc_opt_entry_t*)p1;
+	const lc_opt_entry_t *e2 = (const lc_opt_entry_t*)p2;
+	return entry_matches(e1, e2->hash, e2->name);
+}
+
 static lc_opt_entry_t *init_entry(lc_opt_entry_t *ent, lc_opt_entry_t *parent,
                                   const char *name, const char *desc)
 {
@@ -52,9 +64,14 @@ static lc_opt_entry_t *init_grp(lc_opt_entry_t *ent)
 	ent->is_grp = true;
 	INIT_LIST_HEAD(&ent->v.grp.grps);
 	INIT_LIST_HEAD(&ent->v.grp.opts);
+	cpset_init(&ent->v.grp.grp_index, entry_index_hash, entry_index_cmp);
+	cpset_init(&ent->v.grp.opt_index, entry_index_hash, entry_index_cmp);
 
-	if (ent->parent && ent->parent->is_grp)
-		list_add_tail(&ent->list, &lc_get_grp_special(ent->parent)->grps);
+	if (ent->parent && ent->parent->is_grp) {
+		lc_grp_special_t *s = lc_get_grp_special(ent->parent);
+		list_add_tail(&ent->list, &s->grps);
+		cpset_insert(&s->grp_index, ent);
+	}
 
 	return ent;
 }
@@ -66,10 +83,12 @@ static lc_opt_entry_t *init_opt(lc_opt_entry_t *ent,
                                 lc_opt_dump_t *dump,
                                 lc_opt_dump_vals_t *dump_vals)
 {
-	lc_opt_special_t *s = lc_get_opt_special(ent);
+	lc_opt_special_t *s      = lc_get_opt_special(ent);
+	lc_grp_special_t *parent = lc_get_grp_special(ent->parent);
 
 	ent->is_grp = false;
-	list_add_tail(&ent->list, &lc_get_grp_special(ent->parent)->opts);
+	list_add_tail(&ent->list, &parent->opts);
+	cpset_insert(&parent->opt_index, ent);
 
 	s->type      = type;
 	s->value     = val;
@@ -158,25 +177,24 @@ lc_opt_entry_t *lc_opt_add_opt(lc_opt_entry_t *parent,
 }
 
 
-static lc_opt_entry_t *lc_opt_find_ent(const struct list_head *head,
-                                       const char *name)
+static lc_opt_entry_t *lc_opt_find_ent(const cpset_t *index, const char *name)
 {
-	unsigned hash = hash_str(name);
-	list_for_each_entry(lc_opt_entry_t, ent, head, list) {
-		if (entry_matches(ent, hash, name))
-			return ent;
-	}
-	return NULL;
+	lc_opt_entry_t key;
+	key.name = name;
+	key.hash = hash_str(name);
+	return (lc_opt_entry_t*)cpset_find(index, &key);
 }
 
 lc_opt_entry_t *lc_opt_find_grp(const lc_opt_entry_t *grp, const char *name)
 {
-	return grp ? lc_opt_find_ent(&lc_get_grp_special(grp)->grps, name) : NULL;
+	return grp ? lc_opt_find_ent(&lc_get_grp_special(grp)->grp_index, name)
+	           : NULL;
 }
 
 lc_opt_entry_t *lc_opt_find_opt(const lc_opt_entry_t *grp, const char *name)
 {
-	return grp ? lc_opt_find_ent(&lc_get_grp_special(grp)->opts, name) : NULL;
+	return grp ? lc_opt_find_ent(&lc_get_grp_special(grp)->opt_index, name)
+	           : NULL;
 }
 
 static const lc_opt_entry_t *resolve_up_to_last(const lc_opt_entry_t *root,
@@ -10,12 +10,17 @@
 
 #include <stdlib.h>
 
+#include "cpset.h"
 #include "lc_opts.h"
 #include "list.h"
 
 typedef struct {
 	struct list_head opts;
 	struct list_head grps;
+	/** the children of opts/grps indexed by name; the lists keep the
+	 * registration order for the help output */
+	cpset_t          opt_index;
+	cpset_t          grp_index;
 } lc_grp_special_t;
 
 typedef struct {
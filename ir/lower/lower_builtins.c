@@ -16,8 +16,10 @@
 #include "irgmod.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "irnodeset.h"
 #include "iroptimize.h"
 #include "irprog_t.h"
+#include "lowering.h"
 #include "panic.h"
 #include "target_t.h"
 #include "util.h"
@@ -26,6 +28,7 @@
 
 static bool dont_lower[ir_bk_last + 1];
 static lower_func lower_va_arg;
+static ir_nodeset_t created_mux_nodes;
 
 static const char *get_builtin_name(ir_builtin_kind kind)
 {
@@ -48,6 +51,11 @@ static const char *get_builtin_name(ir_builtin_kind kind)
 	case ir_bk_may_alias:
 	case ir_bk_va_start:
 	case ir_bk_va_arg:
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 		break;
 	}
 	abort();
@@ -158,6 +166,99 @@ static void replace_may_alias(ir_node *node)
 	turn_into_tuple(node, ARRAY_SIZE(in), in);
 }
 
+/**
+ * Expands an overflow-checking builtin into the plain operation plus a
+ * compare computing the overflow predicate, for targets without a native
+ * flag-based implementation. The predicate is materialized as Mux(cmp,0,1);
+ * Muxes the target does not want are turned into control flow afterwards.
+ */
+static void replace_overflow_op(ir_node *const node)
+{
+	ir_builtin_kind const kind   = get_Builtin_kind(node);
+	dbg_info *const dbgi   = get_irn_dbg_info(node);
+	ir_node  *const block  = get_nodes_block(node);
+	ir_node  *const left   = get_Builtin_param(node, 0);
+	ir_node  *const right  = get_Builtin_param(node, 1);
+	ir_mode  *const mode   = get_irn_mode(left);
+	ir_graph *const irg    = get_irn_irg(node);
+	ir_node  *const zero   = new_r_Const_null(irg, mode);
+
+	ir_node *res;
+	ir_node *cmp;
+	if (mode_is_signed(mode)) {
+		switch (kind) {
+		case ir_bk_add_overflow: {
+			/* overflow iff both operands have the same sign and the
+			 * result's sign differs */
+			res = new_rd_Add(dbgi, block, left, right);
+			ir_node *const eor_l = new_rd_Eor(dbgi, block, res, left);
+			ir_node *const eor_r = new_rd_Eor(dbgi, block, res, right);
+			ir_node *const both  = new_rd_And(dbgi, block, eor_l, eor_r);
+			cmp = new_rd_Cmp(dbgi, block, both, zero, ir_relation_less);
+			break;
+		}
+		case ir_bk_sub_overflow: {
+			/* overflow iff the operands have different signs and the
+			 * result's sign differs from the minuend's */
+			res = new_rd_Sub(dbgi, block, left, right);
+			ir_node *const eor_op  = new_rd_Eor(dbgi, block, left, right);
+			ir_node *const eor_res = new_rd_Eor(dbgi, block, res, left);
+			ir_node *const both    = new_rd_And(dbgi, block, eor_op, eor_res);
+			cmp = new_rd_Cmp(dbgi, block, both, zero, ir_relation_less);
+			break;
+		}
+		case ir_bk_mul_overflow: {
+			/* overflow iff the high half of the full product is not the
+			 * sign extension of the low half */
+			res = new_rd_Mul(dbgi, block, left, right);
+			ir_node *const mulh   = new_rd_Mulh(dbgi, block, left, right);
+			unsigned const bits   = get_mode_size_bits(mode);
+			ir_node *const amount = new_r_Const_long(irg, mode_Iu, bits - 1);
+			ir_node *const sign   = new_rd_Shrs(dbgi, block, res, amount);
+			cmp = new_rd_Cmp(dbgi, block, mulh, sign, ir_relation_less_greater);
+			break;
+		}
+		default:
+			panic("unexpected builtin %+F", node);
+		}
+	} else {
+		switch (kind) {
+		case ir_bk_add_overflow:
+			res = new_rd_Add(dbgi, block, left, right);
+			cmp = new_rd_Cmp(dbgi, block, res, left, ir_relation_less);
+			break;
+		case ir_bk_sub_overflow:
+			res = new_rd_Sub(dbgi, block, left, right);
+			cmp = new_rd_Cmp(dbgi, block, left, right, ir_relation_less);
+			break;
+		case ir_bk_mul_overflow: {
+			res = new_rd_Mul(dbgi, block, left, right);
+			ir_node *const mulh = new_rd_Mulh(dbgi, block, left, right);
+			cmp = new_rd_Cmp(dbgi, block, mulh, zero, ir_relation_less_greater);
+			break;
+		}
+		default:
+			panic("unexpected builtin %+F", node);
+		}
+	}
+
+	ir_type *const mtp       = get_Builtin_type(node);
+	ir_mode *const flag_mode = get_type_mode(get_method_res_type(mtp, 1));
+	ir_node *const flag_null = new_r_Const_null(irg, flag_mode);
+	ir_node *const flag_one  = new_r_Const_one(irg, flag_mode);
+	ir_node *const flag      = new_rd_Mux(dbgi, block, cmp, flag_null,
+	                                      flag_one);
+	if (!ir_target.allow_ifconv(cmp, flag_null, flag_one))
+		ir_nodeset_insert(&created_mux_nodes, flag);
+
+	ir_node *const in[] = {
+		[pn_Builtin_M]       = get_Builtin_mem(node),
+		[pn_Builtin_max + 1] = res,
+		[pn_Builtin_max + 2] = flag,
+	};
+	turn_into_tuple(node, ARRAY_SIZE(in), in);
+}
+
 static void lower_builtin(ir_node *node, void *env)
 {
 	bool *changed = (bool*)env;
@@ -187,6 +288,12 @@ static void lower_builtin(ir_node *node, void *env)
 		replace_with_call(node);
 		goto changed;
 
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+		replace_overflow_op(node);
+		goto changed;
+
 	case ir_bk_may_alias:
 		replace_may_alias(node);
 changed:
@@ -205,6 +312,8 @@ changed:
 	case ir_bk_outport:
 	case ir_bk_saturating_increment:
 	case ir_bk_compare_swap:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 	case ir_bk_va_start:
 		/* can't do anything about these, backend will probably fail now */
 		panic("builtin kind %s not supported (for this target)",
@@ -213,6 +322,14 @@ changed:
 	panic("unexpected builtin %+F", node);
 }
 
+/**
+ * Callback to lower only the Mux nodes we created.
+ */
+static int lower_mux_cb(ir_node *mux)
+{
+	return ir_nodeset_contains(&created_mux_nodes, mux);
+}
+
 static void collect_builtin(ir_node *node, void *env)
 {
 	deq_t *builtins = env;
@@ -251,8 +368,12 @@ void lower_builtins(size_t n_exceptions,
 
 	foreach_irp_irg(i, irg) {
 		bool changed = false;
+		ir_nodeset_init(&created_mux_nodes);
 		assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
 		irg_walk_builtin_nodes_post(irg, lower_builtin, &changed);
+		if (ir_nodeset_size(&created_mux_nodes) > 0)
+			lower_mux(irg, lower_mux_cb);
+		ir_nodeset_destroy(&created_mux_nodes);
 		confirm_irg_properties(irg, changed ? IR_GRAPH_PROPERTIES_CONTROL_FLOW
 		                                    : IR_GRAPH_PROPERTIES_ALL);
 	}
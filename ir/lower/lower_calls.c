@@ -131,7 +131,7 @@ static ir_type *get_pointer_type(ir_type *dest_type)
 {
 	ir_type *res = pmap_get(ir_type, pointer_types, dest_type);
 	if (res == NULL) {
-		res = new_type_pointer(dest_type);
+		res = ir_type_intern(new_type_pointer(dest_type));
 		pmap_insert(pointer_types, dest_type, res);
 	}
 	return res;
@@ -356,6 +356,13 @@ static ir_type *lower_mtp(lowering_env_t const *const env, ir_type *mtp)
 	for (size_t i = 0; i < nn_ress; ++i)
 		set_method_res_type(lowered, i, results[i]);
 
+	/* Record the hidden slots so later passes can tell the compound
+	 * return pointers apart from ordinary pointer parameters. */
+	set_method_n_compound_ret_params(lowered, n_hidden);
+
+	/* Calls with structurally identical signatures share one lowered type. */
+	lowered = ir_type_intern(lowered);
+
 	pmap_insert(lowered_mtps, mtp, lowered);
 
 	DBG((dbg, LEVEL_1, "%+F lowered to %+F\n", mtp, lowered));
@@ -743,6 +750,97 @@ static void get_dest_addrs(const cl_entry *entry, ir_node **ins,
 	}
 }
 
+/**
+ * Check whether two address nodes compute the same address. Frontends
+ * produce one Member node per use, so compare frame members structurally.
+ */
+static bool is_same_address(ir_node *const a, ir_node *const b)
+{
+	if (a == b)
+		return true;
+	return is_Member(a) && is_Member(b)
+	    && get_Member_entity(a) == get_Member_entity(b)
+	    && get_Member_ptr(a) == get_Member_ptr(b);
+}
+
+/**
+ * Forward results returned as values directly to Loads reading them back
+ * from the destination, so that field accesses of small returned compounds
+ * do not take a round-trip through memory.
+ *
+ * Only Loads whose memory input is the Sync over the result stores are
+ * considered: for these the loaded bytes are exactly the bytes the matching
+ * store has just written, independent of any aliasing.
+ */
+static void forward_return_stores(ir_node *const sync, ir_node *const base_addr,
+                                  unsigned const n_stores,
+                                  unsigned const *const offsets,
+                                  ir_node *const *const values)
+{
+	bool progress;
+	do {
+		progress = false;
+		foreach_out_edge_safe(sync, edge) {
+			ir_node *const load = get_edge_src_irn(edge);
+			if (!is_Load(load) || get_Load_mem(load) != sync
+			 || get_Load_volatility(load) != volatility_non_volatile
+			 || ir_throws_exception(load))
+				continue;
+
+			/* the address must be the destination plus a constant offset */
+			ir_node *ptr    = get_Load_ptr(load);
+			long     offset = 0;
+			if (is_Add(ptr) && is_Const(get_Add_right(ptr))) {
+				ir_tarval *const tv = get_Const_tarval(get_Add_right(ptr));
+				if (!tarval_is_long(tv))
+					continue;
+				offset = get_tarval_long(tv);
+				ptr    = get_Add_left(ptr);
+			}
+			if (offset < 0 || !is_same_address(ptr, base_addr))
+				continue;
+
+			/* find a store covering exactly the loaded bytes */
+			ir_mode *const load_mode = get_Load_mode(load);
+			ir_node       *value     = NULL;
+			for (unsigned i = 0; i < n_stores; ++i) {
+				if (offsets[i] == (unsigned)offset
+				 && get_mode_size_bytes(get_irn_mode(values[i]))
+				    == get_mode_size_bytes(load_mode)) {
+					value = values[i];
+					break;
+				}
+			}
+			if (value == NULL)
+				continue;
+
+			ir_mode *const value_mode = get_irn_mode(value);
+			if (value_mode != load_mode) {
+				ir_node *const block = get_nodes_block(load);
+				if (mode_is_float(value_mode) != mode_is_float(load_mode)) {
+					value = new_r_Bitcast(block, value, load_mode);
+				} else {
+					value = new_r_Conv(block, value, load_mode);
+				}
+			}
+
+			foreach_out_edge_safe(load, load_edge) {
+				ir_node *const proj = get_edge_src_irn(load_edge);
+				if (!is_Proj(proj))
+					continue;
+				if (get_Proj_num(proj) == pn_Load_M) {
+					exchange(proj, sync);
+				} else {
+					assert(get_Proj_num(proj) == pn_Load_res);
+					exchange(proj, value);
+				}
+			}
+			kill_node(load);
+			progress = true;
+		}
+	} while (progress);
+}
+
 static void fix_int_return(cl_entry const *const entry,
                            ir_type *const type,
                            ir_node *const base_addr,
@@ -774,9 +872,11 @@ static void fix_int_return(cl_entry const *const entry,
 	ir_node *dummy = new_r_Dummy(irg, mode_M);
 	edges_reroute(proj_mem, dummy);
 
-	unsigned   const length      = ret_spec->length;
-	ir_node  **const sync_in     = ALLOCAN(ir_node*, length * 3);
-	unsigned         sync_index  = 0;
+	unsigned   const length        = ret_spec->length;
+	ir_node  **const sync_in       = ALLOCAN(ir_node*, length * 3);
+	unsigned  *const store_offsets = ALLOCAN(unsigned, length * 3);
+	ir_node  **const store_values  = ALLOCAN(ir_node*, length * 3);
+	unsigned         sync_index    = 0;
 	unsigned         type_size   = get_type_size(type);
 	ir_mode  *const  mode_offset = get_reference_offset_mode(mode_ref);
 	int              offset      = 0;
@@ -825,6 +925,8 @@ static void fix_int_return(cl_entry const *const entry,
 
 			ir_type *const type  = get_type_for_mode(mode);
 			ir_node *const store = new_r_Store(block, proj_mem, addr, node_value, type, cons_none);
+			store_offsets[sync_index] = offset;
+			store_values[sync_index]  = node_value;
 			sync_in[sync_index++] = new_r_Proj(store, mode_M, pn_Store_M);
 
 			unsigned size = get_mode_size_bytes(mode);
@@ -841,6 +943,10 @@ static void fix_int_return(cl_entry const *const entry,
 	}
 
 	edges_reroute(dummy, sync);
+
+	if (sync_index > 0)
+		forward_return_stores(sync, base_addr, sync_index, store_offsets,
+		                      store_values);
 }
 
 static void fix_call_compound_ret(const cl_entry *entry,
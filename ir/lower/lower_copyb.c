@@ -45,19 +45,46 @@ static ir_mode *get_ir_mode(unsigned mode_bytes)
 	}
 }
 
+/**
+ * Creates one Load/Store pair copying @p mode sized data from
+ * @p addr_src + @p offset to @p addr_dst + @p offset.
+ * Returns the resulting memory.
+ */
+static ir_node *create_unit_copy(dbg_info *dbgi, ir_node *block,
+                                 ir_node *addr_src, ir_node *addr_dst,
+                                 unsigned offset, ir_mode *mode, ir_type *tp,
+                                 ir_cons_flags flags, ir_node *mem)
+{
+	ir_graph *irg          = get_irn_irg(block);
+	ir_mode  *mode_ref_int = get_reference_offset_mode(get_irn_mode(addr_src));
+
+	/* construct offset */
+	ir_node *addr_const = new_r_Const_long(irg, mode_ref_int, offset);
+	ir_node *add        = new_r_Add(block, addr_src, addr_const);
+
+	ir_node *load     = new_rd_Load(dbgi, block, mem, add, mode, tp, flags);
+	ir_node *load_res = new_r_Proj(load, mode, pn_Load_res);
+	ir_node *load_mem = new_r_Proj(load, mode_M, pn_Load_M);
+
+	ir_node *addr_const2 = new_r_Const_long(irg, mode_ref_int, offset);
+	ir_node *add2        = new_r_Add(block, addr_dst, addr_const2);
+
+	ir_node *store = new_rd_Store(dbgi, block, load_mem, add2, load_res, tp,
+	                              flags);
+	return new_r_Proj(store, mode_M, pn_Store_M);
+}
+
 /**
  * Turn a small CopyB node into a series of Load/Store nodes.
  */
 static void lower_small_copyb_node(ir_node *irn)
 {
-	ir_graph      *irg         = get_irn_irg(irn);
 	dbg_info      *dbgi        = get_irn_dbg_info(irn);
 	ir_node       *block       = get_nodes_block(irn);
 	ir_type       *tp          = get_CopyB_type(irn);
 	ir_node       *addr_src    = get_CopyB_src(irn);
 	ir_node       *addr_dst    = get_CopyB_dst(irn);
 	ir_node       *mem         = get_CopyB_mem(irn);
-	ir_mode       *mode_ref    = get_irn_mode(addr_src);
 	unsigned       mode_bytes  = allow_misalignments ? native_mode_bytes
 	                                                 : get_type_alignment(tp);
 	unsigned       size        = get_type_size(tp);
@@ -65,29 +92,33 @@ static void lower_small_copyb_node(ir_node *irn)
 	bool           is_volatile = get_CopyB_volatility(irn) == volatility_is_volatile;
 	ir_cons_flags  flags       = is_volatile ? cons_volatile : cons_none;
 
-	while (offset < size) {
+	if (allow_misalignments && !is_volatile && size > 0) {
+		/* Copy in the widest possible units and handle the remainder with
+		 * a single unit-sized copy ending at the last byte, overlapping
+		 * the previous one like modern memcpy implementations do.
+		 * Volatile copies must not touch bytes twice and use the
+		 * descending chain below instead. */
+		while (mode_bytes > size)
+			mode_bytes /= 2;
 		ir_mode *mode = get_ir_mode(mode_bytes);
 		for (; offset + mode_bytes <= size; offset += mode_bytes) {
-			ir_mode *mode_ref_int = get_reference_offset_mode(mode_ref);
-
-			/* construct offset */
-			ir_node *addr_const = new_r_Const_long(irg, mode_ref_int, offset);
-			ir_node *add        = new_r_Add(block, addr_src, addr_const);
-
-			ir_node *load     = new_rd_Load(dbgi, block, mem, add, mode, tp, flags);
-			ir_node *load_res = new_r_Proj(load, mode, pn_Load_res);
-			ir_node *load_mem = new_r_Proj(load, mode_M, pn_Load_M);
-
-			ir_node *addr_const2 = new_r_Const_long(irg, mode_ref_int, offset);
-			ir_node *add2        = new_r_Add(block, addr_dst, addr_const2);
-
-			ir_node *store     = new_rd_Store(dbgi, block, load_mem, add2, load_res, tp, flags);
-			ir_node *store_mem = new_r_Proj(store, mode_M, pn_Store_M);
-
-			mem = store_mem;
+			mem = create_unit_copy(dbgi, block, addr_src, addr_dst, offset,
+			                       mode, tp, flags, mem);
+		}
+		if (offset < size) {
+			mem = create_unit_copy(dbgi, block, addr_src, addr_dst,
+			                       size - mode_bytes, mode, tp, flags, mem);
+		}
+	} else {
+		while (offset < size) {
+			ir_mode *mode = get_ir_mode(mode_bytes);
+			for (; offset + mode_bytes <= size; offset += mode_bytes) {
+				mem = create_unit_copy(dbgi, block, addr_src, addr_dst,
+				                       offset, mode, tp, flags, mem);
+			}
+
+			mode_bytes /= 2;
 		}
-
-		mode_bytes /= 2;
 	}
 
 	exchange(irn, mem);
@@ -181,7 +212,7 @@ void lower_CopyB(ir_graph *irg, unsigned max_small_sz, unsigned min_large_sz,
 
 	max_small_size      = max_small_sz;
 	min_large_size      = min_large_sz;
-	native_mode_bytes   = ir_target_pointer_size();
+	native_mode_bytes   = ir_target_copy_unit_size();
 	allow_misalignments = allow_misaligns;
 
 	walk_env_t env = { .copybs = NEW_ARR_F(ir_node*, 0) };
@@ -9,6 +9,7 @@
  * @date    8.10.2004
  * @author  Michael Beck
  */
+#include "hashptr.h"
 #include "lower_dw.h"
 
 #include "array.h"
@@ -465,39 +466,61 @@ static void lower_Store(ir_node *node)
 
 static ir_entity *create_libgcc_entity(ir_type *const method, ir_op const *const op, ir_mode const *const imode, ir_mode const *const omode)
 {
+	/* doubleword == 128 bits means we lower TImode, the libgcc names then
+	 * carry a "ti" instead of a "di" suffix. */
+	bool const  ti = env.p.doubleword_size == 128;
 	const char *name;
 	if (op == op_Mul) {
-		name = "__muldi3";
+		name = ti ? "__multi3" : "__muldi3";
 	} else if (op == op_Div) {
-		name = mode_is_signed(imode) ? "__divdi3" : "__udivdi3";
+		if (mode_is_signed(imode))
+			name = ti ? "__divti3" : "__divdi3";
+		else
+			name = ti ? "__udivti3" : "__udivdi3";
 	} else if (op == op_Mod) {
-		name = mode_is_signed(imode) ? "__moddi3" : "__umoddi3";
+		if (mode_is_signed(imode))
+			name = ti ? "__modti3" : "__moddi3";
+		else
+			name = ti ? "__umodti3" : "__umoddi3";
 	} else if (op == op_Conv) {
 		if (mode_is_float(imode)) {
-			assert(get_mode_size_bits(omode) == 64);
+			assert(get_mode_size_bits(omode) == env.p.doubleword_size);
 			if (get_mode_size_bits(imode) == 64) {
-				name = mode_is_signed(omode) ? "__fixdfdi" : "__fixunsdfdi";
+				if (mode_is_signed(omode))
+					name = ti ? "__fixdfti" : "__fixdfdi";
+				else
+					name = ti ? "__fixunsdfti" : "__fixunsdfdi";
 			} else if (get_mode_size_bits(imode) == 32) {
-				name = mode_is_signed(omode) ? "__fixsfdi" : "__fixunssfdi";
+				if (mode_is_signed(omode))
+					name = ti ? "__fixsfti" : "__fixsfdi";
+				else
+					name = ti ? "__fixunssfti" : "__fixunssfdi";
 			} else {
 				assert(get_mode_size_bits(imode) == 128);
 				panic("can't conver long double to long long yet");
 			}
 		} else if (mode_is_float(omode)) {
-			assert(get_mode_size_bits(imode) == 64);
+			assert(get_mode_size_bits(imode) == env.p.doubleword_size);
 			if (get_mode_size_bits(omode) == 64) {
-				name = mode_is_signed(imode) ? "__floatdidf" : "__floatundidf";
+				if (mode_is_signed(imode))
+					name = ti ? "__floattidf" : "__floatdidf";
+				else
+					name = ti ? "__floatuntidf" : "__floatundidf";
 			} else if (get_mode_size_bits(omode) == 32) {
-				name = mode_is_signed(imode) ? "__floatdisf" : "__floatundisf";
+				if (mode_is_signed(imode))
+					name = ti ? "__floattisf" : "__floatdisf";
+				else
+					name = ti ? "__floatuntisf" : "__floatundisf";
 			} else {
 				assert(get_mode_size_bits(omode) == 128);
 				panic("can't convert long long to long double yet");
 			}
 		} else {
-			panic("can't lower 64bit Conv");
+			panic("can't lower %ubit Conv", (unsigned)env.p.doubleword_size);
 		}
 	} else {
-		panic("cannot lower unexpected 64bit operation %s", get_op_name(op));
+		panic("cannot lower unexpected %ubit operation %s",
+		      (unsigned)env.p.doubleword_size, get_op_name(op));
 	}
 
 	return create_compilerlib_entity(name, method);
@@ -1023,6 +1046,8 @@ static void lower_Minus(ir_node *const node)
 	ir_node  *const one          = new_r_Const(irg, get_mode_one(mode));
 	ir_node  *const zero_high    = new_r_Const(irg, get_mode_null(mode));
 	ir_node  *const carry        = new_rd_Mux(dbgi, block, cmp_carry, zero_high, one);
+	if (!ir_target.allow_ifconv(cmp_carry, zero_high, one))
+		ir_nodeset_insert(&created_mux_nodes, carry);
 
 	ir_node  *const res_high     = new_rd_Sub(dbgi, block, tmp_high, carry);
 	ir_set_dw_lowered(node, res_low, res_high);
@@ -1045,6 +1070,8 @@ static void lower_binop_additive(ir_node *const node, ir_node *(*const cons)(dbg
 	ir_node  *const one       = new_r_Const(irg, get_mode_one(mode));
 	ir_node  *const zero      = new_r_Const(irg, get_mode_null(mode));
 	ir_node  *const carry     = new_rd_Mux(dbg, block, cmp_carry, zero, one);
+	if (!ir_target.allow_ifconv(cmp_carry, zero, one))
+		ir_nodeset_insert(&created_mux_nodes, carry);
 	ir_node  *const sum_high  = cons(dbg, block, left_entry->high_word, right_entry->high_word);
 	ir_node  *const res_high  = cons(dbg, block, sum_high, carry);
 	ir_set_dw_lowered(node, res_low, res_high);
@@ -2250,6 +2277,11 @@ static void lower_Builtin(ir_node *const builtin)
 	case ir_bk_trap:
 	case ir_bk_va_start:
 	case ir_bk_va_arg:
+	case ir_bk_add_overflow:
+	case ir_bk_sub_overflow:
+	case ir_bk_mul_overflow:
+	case ir_bk_atomic_exchange:
+	case ir_bk_atomic_fetch_add:
 		/* Nothing to do/impossible to lower in a generic way */
 		return;
 	case ir_bk_bswap:
@@ -2380,8 +2412,44 @@ static void clear_node_and_phi_links(ir_node *node, void *data)
 		set_Phi_next(node, NULL);
 }
 
+/**
+ * Walker checking whether anything in the graph needs doubleword
+ * lowering, mirroring the conditions of prepare_links().
+ */
+static void find_doubleword_ops(ir_node *node, void *data)
+{
+	bool    *found = (bool*)data;
+	ir_mode *mode  = get_irn_op_mode(node);
+
+	if (needs_lowering(mode)) {
+		*found = true;
+	} else if (is_Conv(node)) {
+		if (needs_lowering(get_irn_mode(get_Conv_op(node))))
+			*found = true;
+	} else if (is_Call(node)) {
+		const ir_type *tp = get_Call_type(node);
+		for (size_t i = 0, n_res = get_method_n_ress(tp); i < n_res; ++i) {
+			if (type_needs_lowering(get_method_res_type(tp, i)))
+				*found = true;
+		}
+	}
+}
+
 static void lower_irg(ir_graph *irg)
 {
+	ir_entity *ent         = get_irg_entity(irg);
+	ir_type   *mtp         = get_entity_type(ent);
+	ir_type   *lowered_mtp = lower_mtp(mtp);
+
+	/* Cheap scan first: graphs without any doubleword values skip the
+	 * link setup and the constbits analysis entirely. */
+	bool found = false;
+	irg_walk_graph(irg, NULL, find_doubleword_ops, &found);
+	if (!found && lowered_mtp == mtp) {
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+		return;
+	}
+
 	constbits_analyze(irg);
 
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
@@ -2395,10 +2463,6 @@ static void lower_irg(ir_graph *irg)
 	env.irg       = irg;
 	env.flags     = 0;
 
-	ir_entity *ent         = get_irg_entity(irg);
-	ir_type   *mtp         = get_entity_type(ent);
-	ir_type   *lowered_mtp = lower_mtp(mtp);
-
 	if (lowered_mtp != mtp) {
 		set_entity_type(ent, lowered_mtp);
 		env.flags |= MUST_BE_LOWERED;
@@ -22,6 +22,7 @@
 #include "irtools.h"
 #include "lowering.h"
 #include "panic.h"
+#include "target_t.h"
 #include "tv.h"
 #include "util.h"
 #include <stdbool.h>
@@ -89,6 +90,61 @@ static ir_node *create_cond_set(ir_node *cond_value, ir_mode *dest_mode)
 	return phi;
 }
 
+/**
+ * Materializes a comparison against zero by shifting the sign bit down,
+ * as in Cmp(a, 0, <) => a >> 31. This is the cheapest branch-free variant
+ * and needs no target support beyond plain shifts.
+ */
+static ir_node *create_sign_set(ir_node *cmp, ir_mode *dest_mode)
+{
+	ir_relation relation = get_Cmp_relation(cmp);
+	if (relation != ir_relation_less
+	    && relation != ir_relation_greater_equal)
+		return NULL;
+	if (!is_irn_null(get_Cmp_right(cmp)))
+		return NULL;
+	ir_node *left = get_Cmp_left(cmp);
+	ir_mode *mode = get_irn_mode(left);
+	if (!mode_is_int(mode) || !mode_is_signed(mode)
+	    || mode_is_signed(dest_mode)
+	    || get_mode_size_bits(mode) > get_mode_size_bits(dest_mode))
+		return NULL;
+
+	dbg_info *dbgi   = get_irn_dbg_info(cmp);
+	ir_node  *block  = get_nodes_block(cmp);
+	ir_graph *irg    = get_irn_irg(cmp);
+	ir_node  *conv   = new_rd_Conv(dbgi, block, left, dest_mode);
+	ir_node  *amount = new_r_Const_long(irg, mode_Iu,
+	                                    get_mode_size_bits(dest_mode) - 1);
+	ir_node  *res    = new_rd_Shr(dbgi, block, conv, amount);
+	if (relation == ir_relation_greater_equal)
+		res = create_not(dbgi, res);
+	return res;
+}
+
+/** Expected cost in cycles of materializing through a branch. A predicate
+ * that is turned into a value carries no probability annotation, so the
+ * branch must be assumed 50/50 and pays for half a misprediction. */
+#define BRANCH_SET_COST 6
+
+/**
+ * Materializes a comparison as Mux(cmp, 0, 1), keeping the decision in the
+ * data flow so the backend can use its conditional set/move instructions.
+ */
+static ir_node *create_mux_set(ir_node *cond_value, ir_mode *dest_mode)
+{
+	if (ir_target.mux_latency > BRANCH_SET_COST)
+		return NULL;
+	ir_graph *irg  = get_irn_irg(cond_value);
+	ir_node  *one  = new_r_Const_one(irg, dest_mode);
+	ir_node  *zero = new_r_Const_null(irg, dest_mode);
+	if (!ir_target.allow_ifconv(cond_value, zero, one))
+		return NULL;
+	dbg_info *dbgi  = get_irn_dbg_info(cond_value);
+	ir_node  *block = get_nodes_block(cond_value);
+	return new_rd_Mux(dbgi, block, cond_value, zero, one);
+}
+
 static ir_node *lower_node(ir_node *node)
 {
 	ir_node *res = (ir_node *)get_irn_link(node);
@@ -172,7 +228,11 @@ static ir_node *lower_node(ir_node *node)
 	}
 
 	case iro_Cmp:
-		res = create_cond_set(node, mode);
+		res = create_sign_set(node, mode);
+		if (res == NULL)
+			res = create_mux_set(node, mode);
+		if (res == NULL)
+			res = create_cond_set(node, mode);
 		break;
 
 	case iro_Const: {
@@ -59,6 +59,13 @@ static ir_type *unop_tp_lu_f;
 /** A map from a method type to its lowered type. */
 static pmap *lowered_type;
 
+/** Program-wide cache of created runtime call entities (ident -> entity). */
+static pmap *entity_cache;
+
+/** Per-graph cache of Address nodes (entity -> Address), so every
+ * function references each soft-float routine through one node. */
+static pmap *address_cache;
+
 static ir_nodeset_t created_mux_nodes;
 
 /**
@@ -268,9 +275,19 @@ static ir_node *create_softfloat_address(const ir_node *n, const char *name)
 		new_id_fmt("__%s%s%s%s%u", name, first_param, second_param, result, float_types + double_types) :
 		new_id_fmt("__%s%s%s%s",   name, first_param, second_param, result);
 
-	ir_graph  *const irg = get_irn_irg(n);
-	ir_entity *const ent = create_compilerlib_entity(get_id_str(id), method);
-	return new_r_Address(irg, ent);
+	ir_entity *ent = pmap_get(ir_entity, entity_cache, id);
+	if (ent == NULL) {
+		ent = create_compilerlib_entity(get_id_str(id), method);
+		pmap_insert(entity_cache, id, ent);
+	}
+
+	ir_node *addr = pmap_get(ir_node, address_cache, ent);
+	if (addr == NULL) {
+		ir_graph *const irg = get_irn_irg(n);
+		addr = new_r_Address(irg, ent);
+		pmap_insert(address_cache, ent, addr);
+	}
+	return addr;
 }
 
 static ir_node *make_softfloat_call(ir_node *const n, char const *const name,
@@ -775,6 +792,8 @@ static void ir_prepare_softfloat_lowering(void)
 {
 	if (!lowered_type)
 		lowered_type = pmap_create();
+	if (!entity_cache)
+		entity_cache = pmap_create();
 
 	ir_type *const type_D  = get_type_for_mode(mode_D);
 	ir_type *const type_F  = get_type_for_mode(mode_F);
@@ -834,6 +853,7 @@ void lower_floating_point(void)
 	bool *const changed_irgs = XMALLOCNZ(bool, get_irp_n_irgs());
 	foreach_irp_irg(i, irg) {
 		ir_nodeset_init(&created_mux_nodes);
+		address_cache = pmap_create();
 
 		assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
 
@@ -842,6 +862,8 @@ void lower_floating_point(void)
 		if (ir_nodeset_size(&created_mux_nodes) > 0)
 			lower_mux(irg, lower_mux_cb);
 
+		pmap_destroy(address_cache);
+		address_cache = NULL;
 		ir_nodeset_destroy(&created_mux_nodes);
 	}
 
@@ -15,10 +15,12 @@
 #include "irnode_t.h"
 #include "irnodeset.h"
 #include "irouts_t.h"
+#include "irprofile.h"
 #include "lowering.h"
 #include "panic.h"
 #include "util.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 typedef struct walk_env_t {
 	ir_nodeset_t  processed;
@@ -42,8 +44,21 @@ typedef struct switch_info_t {
 	unsigned     num_cases;
 	target_t    *targets;
 	ir_node    **defusers;    /**< the Projs pointing to the default case */
+	ir_mode     *out_mode;    /**< backend selector mode for sub-tables */
+	ir_nodeset_t *processed;  /**< switches the walker must not visit again */
 } switch_info_t;
 
+/**
+ * A maximal run of table entries which is lowered as one unit: either a
+ * single case compare or a dense run worth a jump table of its own.
+ */
+typedef struct switch_cluster_t {
+	size_t   first;     /**< index of the first table entry */
+	size_t   n_entries; /**< number of table entries in the cluster */
+	uint64_t weight;    /**< accumulated profile weight of the targets */
+	bool     is_table;  /**< lower the cluster as a jump table */
+} switch_cluster_t;
+
 /**
  * analyze enough to decide if we should lower the switch
  */
@@ -311,64 +326,269 @@ static void connect_to_target(target_t *target, ir_node *cf)
 }
 
 /**
- * Creates an if cascade realizing binary search.
+ * Returns the profile weight of a table entry. Without profile data all
+ * entries are considered equally likely.
+ */
+static uint64_t get_entry_weight(const switch_info_t *info,
+                                 const ir_switch_table_entry *entry)
+{
+	if (!ir_profile_has_data())
+		return 1;
+	return ir_profile_get_block_execcount(info->targets[entry->pn].block);
+}
+
+/**
+ * Partitions the (sorted) switch table into clusters. Dense runs with more
+ * than @p small_switch cases become jump-table clusters, everything else
+ * is kept as single-case clusters for the compare cascade.
+ * Returns the number of clusters written to @p clusters.
+ */
+static unsigned compute_clusters(switch_info_t *info, const walk_env_t *env,
+                                 switch_cluster_t *clusters)
+{
+	const ir_node         *switchn    = info->switchn;
+	const ir_switch_table *table      = get_Switch_table(switchn);
+	size_t                 n_entries  = ir_switch_table_get_n_entries(table);
+	ir_mode *mode       = get_irn_mode(get_Switch_selector(switchn));
+	ir_mode *umode      = find_unsigned_mode(mode);
+	ir_tarval *spare_size = new_tarval_from_long(env->spare_size, umode);
+	unsigned n_outs     = get_Switch_n_outs(switchn);
+	bool    *seen       = XMALLOCN(bool, n_outs);
+
+	unsigned n_clusters = 0;
+	for (size_t i = 0; i < n_entries;) {
+		/* greedily extend the run as long as it stays dense; the spare
+		 * count is monotone in j, so this finds the maximal dense run */
+		size_t j = i;
+		if (info->out_mode != NULL) {
+			while (j + 1 < n_entries) {
+				ir_tarval *min = ir_switch_table_get_entry_const(table, i)->min;
+				ir_tarval *max = ir_switch_table_get_entry_const(table, j+1)->max;
+				ir_tarval *range = tarval_convert_to(tarval_sub(max, min), umode);
+				ir_tarval *ncases = new_tarval_from_long(j + 1 - i, umode);
+				ir_tarval *spare  = tarval_sub(range, ncases);
+				if (tarval_cmp(spare, spare_size) & ir_relation_greater_equal)
+					break;
+				++j;
+			}
+		}
+
+		switch_cluster_t *cluster = &clusters[n_clusters++];
+		if (j - i + 1 > env->small_switch) {
+			cluster->first     = i;
+			cluster->n_entries = j - i + 1;
+			cluster->is_table  = true;
+			cluster->weight    = 0;
+			/* all in-cluster entries of a target share one Proj, adjust
+			 * the predecessor count expected by connect_to_target() */
+			memset(seen, 0, n_outs * sizeof(seen[0]));
+			for (size_t e = i; e <= j; ++e) {
+				const ir_switch_table_entry *entry
+					= ir_switch_table_get_entry_const(table, e);
+				cluster->weight += get_entry_weight(info, entry);
+				if (seen[entry->pn])
+					--info->targets[entry->pn].n_entries;
+				else
+					seen[entry->pn] = true;
+			}
+			i = j + 1;
+		} else {
+			const ir_switch_table_entry *entry
+				= ir_switch_table_get_entry_const(table, i);
+			cluster->first     = i;
+			cluster->n_entries = 1;
+			cluster->is_table  = false;
+			cluster->weight    = get_entry_weight(info, entry);
+			++i;
+		}
+	}
+	free(seen);
+	return n_clusters;
+}
+
+/**
+ * Creates a jump table for a dense cluster, rebased to zero and converted
+ * to the backends selector mode like normalize_switch() does for full
+ * tables. The out-of-bounds check is the range compare guarding the block.
+ */
+static void create_cluster_switch(switch_info_t *info,
+                                  const switch_cluster_t *cluster,
+                                  ir_node *block)
+{
+	ir_node               *switchn  = info->switchn;
+	ir_graph              *irg      = get_irn_irg(block);
+	dbg_info              *dbgi     = get_irn_dbg_info(switchn);
+	ir_node               *selector = get_Switch_selector(switchn);
+	const ir_switch_table *table    = get_Switch_table(switchn);
+	ir_mode               *out_mode = info->out_mode;
+	ir_tarval             *min
+		= ir_switch_table_get_entry_const(table, cluster->first)->min;
+
+	if (!tarval_is_null(min)) {
+		ir_node *min_const = new_r_Const(irg, min);
+		selector = new_rd_Sub(dbgi, block, selector, min_const);
+	}
+	selector = new_r_Conv(block, selector, out_mode);
+
+	unsigned         n_outs    = get_Switch_n_outs(switchn);
+	ir_switch_table *new_table = ir_new_switch_table(irg, cluster->n_entries);
+	for (size_t e = 0; e < cluster->n_entries; ++e) {
+		const ir_switch_table_entry *entry
+			= ir_switch_table_get_entry_const(table, cluster->first + e);
+		ir_tarval *new_min
+			= tarval_convert_to(tarval_sub(entry->min, min), out_mode);
+		ir_tarval *new_max
+			= tarval_convert_to(tarval_sub(entry->max, min), out_mode);
+		ir_switch_table_set(new_table, e, new_min, new_max, entry->pn);
+	}
+	ir_node *new_switch = new_rd_Switch(dbgi, block, selector, n_outs,
+	                                    new_table);
+	/* the sub-table is already in backend form, keep the walker away */
+	ir_nodeset_insert(info->processed, new_switch);
+
+	bool *have_proj = ALLOCANZ(bool, n_outs);
+	for (size_t e = 0; e < cluster->n_entries; ++e) {
+		const ir_switch_table_entry *entry
+			= ir_switch_table_get_entry_const(table, cluster->first + e);
+		unsigned pn = entry->pn;
+		if (have_proj[pn])
+			continue;
+		have_proj[pn] = true;
+		connect_to_target(&info->targets[pn],
+		                  new_r_Proj(new_switch, mode_X, pn));
+	}
+	ARR_APP1(ir_node*, info->defusers,
+	         new_r_Proj(new_switch, mode_X, pn_Switch_default));
+}
+
+/**
+ * Creates the Cond checking whether the selector hits @p cluster: an
+ * equality/range compare for single cases, a range compare for tables.
+ */
+static ir_node *create_cluster_cond(const switch_info_t *info,
+                                    const switch_cluster_t *cluster,
+                                    dbg_info *dbgi, ir_node *block,
+                                    ir_node *selector)
+{
+	const ir_switch_table *table = get_Switch_table(info->switchn);
+	ir_switch_table_entry  range;
+	range.min = ir_switch_table_get_entry_const(table, cluster->first)->min;
+	range.max = ir_switch_table_get_entry_const(table,
+		cluster->first + cluster->n_entries - 1)->max;
+	range.pn  = 0;
+	return create_case_cond(&range, dbgi, block, selector);
+}
+
+/**
+ * Connects the matching control flow of a cluster: directly to the target
+ * block for single cases, to a new block holding the jump table otherwise.
+ */
+static void connect_cluster(switch_info_t *info,
+                            const switch_cluster_t *cluster, ir_node *cf)
+{
+	if (cluster->is_table) {
+		ir_graph *irg          = get_irn_irg(cf);
+		ir_node  *in[]         = { cf };
+		ir_node  *switch_block = new_r_Block(irg, ARRAY_SIZE(in), in);
+		create_cluster_switch(info, cluster, switch_block);
+	} else {
+		const ir_switch_table       *table = get_Switch_table(info->switchn);
+		const ir_switch_table_entry *entry
+			= ir_switch_table_get_entry_const(table, cluster->first);
+		connect_to_target(&info->targets[entry->pn], cf);
+	}
+}
+
+/**
+ * Creates an if cascade over the clusters realizing binary search.
+ * With profile weights the split point is the weighted median and a
+ * cluster holding the majority of the weight is tested first, so skewed
+ * switches degenerate into a hot-case-first compare chain.
+ * Note: @p clusters is scratch memory and may be reordered.
  */
 static void create_if_cascade(switch_info_t *info, ir_node *block,
-                              ir_switch_table_entry *curcases,
-                              unsigned numcases)
+                              switch_cluster_t *clusters, unsigned n_clusters)
 {
 	ir_graph      *irg      = get_irn_irg(block);
 	const ir_node *switchn  = info->switchn;
 	dbg_info      *dbgi     = get_irn_dbg_info(switchn);
 	ir_node       *selector = get_Switch_selector(switchn);
 
-	if (numcases == 0) {
+	if (n_clusters == 0) {
 		/* zero cases: "goto default;" */
 		ARR_APP1(ir_node*, info->defusers, new_r_Jmp(block));
-	} else if (numcases == 1) {
-		/*only one case: "if (sel == val) goto target else goto default;"*/
-		const ir_switch_table_entry *entry = &curcases[0];
-		ir_node *cond      = create_case_cond(entry, dbgi, block, selector);
+		return;
+	}
+	if (n_clusters == 1) {
+		/* "if (sel in cluster) goto target else goto default;" */
+		ir_node *cond = create_cluster_cond(info, &clusters[0], dbgi, block,
+		                                    selector);
 		ir_node *trueproj  = new_r_Proj(cond, mode_X, pn_Cond_true);
 		ir_node *falseproj = new_r_Proj(cond, mode_X, pn_Cond_false);
-
-		connect_to_target(&info->targets[entry->pn], trueproj);
+		connect_cluster(info, &clusters[0], trueproj);
 		ARR_APP1(ir_node*, info->defusers, falseproj);
-	} else if (numcases == 2) {
-		/* only two cases: "if (sel == val[0]) goto target[0];" */
-		const ir_switch_table_entry *entry0 = &curcases[0];
-		const ir_switch_table_entry *entry1 = &curcases[1];
-		ir_node *cond      = create_case_cond(entry0, dbgi, block, selector);
+		return;
+	}
+
+	uint64_t total = 0;
+	unsigned hot   = 0;
+	for (unsigned i = 0; i < n_clusters; ++i) {
+		total += clusters[i].weight;
+		if (clusters[i].weight > clusters[hot].weight)
+			hot = i;
+	}
+
+	if (n_clusters == 2 || 2*clusters[hot].weight > total) {
+		/* chain: test the hot cluster, continue with the rest. The case
+		 * compares are independent, so removing a cluster from the sorted
+		 * sequence keeps the remaining binary search correct. */
+		unsigned pick = n_clusters == 2
+			? (clusters[1].weight > clusters[0].weight ? 1 : 0) : hot;
+		ir_node *cond = create_cluster_cond(info, &clusters[pick], dbgi,
+		                                    block, selector);
 		ir_node *trueproj  = new_r_Proj(cond, mode_X, pn_Cond_true);
 		ir_node *falseproj = new_r_Proj(cond, mode_X, pn_Cond_false);
-		connect_to_target(&info->targets[entry0->pn], trueproj);
+		connect_cluster(info, &clusters[pick], trueproj);
 
 		ir_node *in[]    = { falseproj };
 		ir_node *neblock = new_r_Block(irg, ARRAY_SIZE(in), in);
 
-		/* second part: "else if (sel == val[1]) goto target[1] else goto default;" */
-		ir_node *cond1      = create_case_cond(entry1, dbgi, neblock, selector);
-		ir_node *trueproj1  = new_r_Proj(cond1, mode_X, pn_Cond_true);
-		ir_node *falseproj1 = new_r_Proj(cond1, mode_X, pn_Cond_false);
-		connect_to_target(&info->targets[entry1->pn], trueproj1);
-		ARR_APP1(ir_node*, info->defusers, falseproj1);
-	} else {
-		/* recursive case: split cases in the middle */
-		unsigned midcase = numcases / 2;
-		const ir_switch_table_entry *entry = &curcases[midcase];
-		ir_node *val = new_r_Const(irg, entry->min);
-		ir_node *cmp = new_rd_Cmp(dbgi, block, selector, val, ir_relation_less);
-		ir_node *cond = new_rd_Cond(dbgi, block, cmp);
+		memmove(&clusters[pick], &clusters[pick+1],
+		        (n_clusters - 1 - pick) * sizeof(clusters[0]));
+		create_if_cascade(info, neblock, clusters, n_clusters - 1);
+		return;
+	}
+
+	/* recursive case: split at the weighted median */
+	unsigned split = 0;
+	if (total != 0) {
+		uint64_t acc = 0;
+		for (unsigned i = 0; i < n_clusters - 1; ++i) {
+			acc += clusters[i].weight;
+			if (2*acc >= total) {
+				split = i + 1;
+				break;
+			}
+		}
+	}
+	if (split == 0)
+		split = n_clusters / 2;
+
+	const ir_switch_table *table = get_Switch_table(switchn);
+	ir_tarval *sep
+		= ir_switch_table_get_entry_const(table, clusters[split].first)->min;
+	ir_node *val  = new_r_Const(irg, sep);
+	ir_node *cmp  = new_rd_Cmp(dbgi, block, selector, val, ir_relation_less);
+	ir_node *cond = new_rd_Cond(dbgi, block, cmp);
 
-		ir_node *ltin[]  = { new_r_Proj(cond, mode_X, pn_Cond_true) };
-		ir_node *ltblock = new_r_Block(irg, ARRAY_SIZE(ltin), ltin);
+	ir_node *ltin[]  = { new_r_Proj(cond, mode_X, pn_Cond_true) };
+	ir_node *ltblock = new_r_Block(irg, ARRAY_SIZE(ltin), ltin);
 
-		ir_node *gein[]  = { new_r_Proj(cond, mode_X, pn_Cond_false) };
-		ir_node *geblock = new_r_Block(irg, ARRAY_SIZE(gein), gein);
+	ir_node *gein[]  = { new_r_Proj(cond, mode_X, pn_Cond_false) };
+	ir_node *geblock = new_r_Block(irg, ARRAY_SIZE(gein), gein);
 
-		create_if_cascade(info, ltblock, curcases, midcase);
-		create_if_cascade(info, geblock, curcases + midcase, numcases - midcase);
-	}
+	create_if_cascade(info, ltblock, clusters, split);
+	create_if_cascade(info, geblock, clusters + split, n_clusters - split);
 }
 
 /**
@@ -422,16 +642,22 @@ static void find_switch_nodes(ir_node *block, void *ctx)
 	normalize_table(switchn, selector_mode, NULL);
 	analyse_switch1(&info);
 
-	/* Now create the if cascade */
-	env->changed  = true;
-	info.defusers = NEW_ARR_F(ir_node*, 0);
+	/* Now create the if cascade over the case clusters */
+	env->changed   = true;
+	info.out_mode  = env->selector_mode;
+	info.processed = &env->processed;
+	info.defusers  = NEW_ARR_F(ir_node*, 0);
 	block         = get_nodes_block(switchn);
 	ir_switch_table *table = get_Switch_table(switchn);
-	create_if_cascade(&info, block, table->entries, table->n_entries);
+	switch_cluster_t *clusters
+		= XMALLOCN(switch_cluster_t, table->n_entries);
+	unsigned n_clusters = compute_clusters(&info, env, clusters);
+	create_if_cascade(&info, block, clusters, n_clusters);
 
 	/* Connect new default case users */
 	set_irn_in(info.default_block, ARR_LEN(info.defusers), info.defusers);
 
+	free(clusters);
 	DEL_ARR_F(info.defusers);
 	free(info.targets);
 }
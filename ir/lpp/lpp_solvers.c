@@ -9,9 +9,13 @@
  */
 #include "lpp_solvers.h"
 
+#include "array.h"
+#include "firm_threads.h"
 #include "lpp_cplex.h"
 #include "lpp_gurobi.h"
+#include "timing.h"
 #include "util.h"
+#include "xmalloc.h"
 
 typedef struct lpp_solver_t {
 	lpp_solver_func_t *solver;
@@ -41,3 +45,121 @@ lpp_solver_func_t *lpp_find_solver(char const *const name)
 
 	return NULL;
 }
+
+struct lpp_session_t {
+	lpp_solver_func_t *solver;
+	lpp_t            **queue;     /**< submitted problems; entries below
+	                                   next are claimed by workers */
+	size_t             next;
+	bool               finishing; /**< no further submissions will come */
+	double             deadline;  /**< session budget in seconds, 0.0 = none */
+	ir_timer_t        *timer;     /**< measures the elapsed session time */
+	firm_thread_t     *workers;
+	unsigned           n_workers;
+	firm_mutex_t       lock;      /**< protects queue, next and finishing */
+	firm_cond_t        cond;      /**< signalled on submission and finish */
+};
+
+/**
+ * Clamps the problem's time limit to what is left of the session
+ * deadline.
+ */
+static void lpp_session_apply_deadline(lpp_session_t *session, lpp_t *lpp)
+{
+	if (session->deadline <= 0.0)
+		return;
+	double remaining
+		= session->deadline - ir_timer_elapsed_sec(session->timer);
+	if (remaining < 0.01)
+		remaining = 0.01;
+	if (lpp->time_limit_secs == 0.0 || lpp->time_limit_secs > remaining)
+		lpp->time_limit_secs = remaining;
+}
+
+#if FIRM_HAS_THREADS
+static int lpp_session_worker(void *data)
+{
+	lpp_session_t *const session = (lpp_session_t*)data;
+	firm_mutex_lock(&session->lock);
+	for (;;) {
+		if (session->next < ARR_LEN(session->queue)) {
+			lpp_t *const lpp = session->queue[session->next++];
+			firm_mutex_unlock(&session->lock);
+			lpp_session_apply_deadline(session, lpp);
+			session->solver(lpp);
+			firm_mutex_lock(&session->lock);
+			continue;
+		}
+		if (session->finishing)
+			break;
+		firm_cond_wait(&session->cond, &session->lock);
+	}
+	firm_mutex_unlock(&session->lock);
+	return 0;
+}
+#endif
+
+lpp_session_t *lpp_session_begin(lpp_solver_func_t *const solver,
+                                 unsigned const n_threads,
+                                 double const deadline_secs)
+{
+	lpp_session_t *const session = XMALLOCZ(lpp_session_t);
+	session->solver   = solver;
+	session->queue    = NEW_ARR_F(lpp_t*, 0);
+	session->deadline = deadline_secs;
+	session->timer    = ir_timer_new();
+	ir_timer_start(session->timer);
+
+#if FIRM_HAS_THREADS
+	if (n_threads > 1) {
+		firm_mutex_init(&session->lock);
+		firm_cond_init(&session->cond);
+		session->workers = XMALLOCN(firm_thread_t, n_threads);
+		for (unsigned t = 0; t < n_threads; ++t) {
+			if (!firm_thread_create(&session->workers[t],
+			                        lpp_session_worker, session))
+				break;
+			++session->n_workers;
+		}
+	}
+#else
+	(void)n_threads;
+#endif
+	return session;
+}
+
+void lpp_session_submit(lpp_session_t *const session, lpp_t *const lpp)
+{
+#if FIRM_HAS_THREADS
+	if (session->n_workers > 0) {
+		firm_mutex_lock(&session->lock);
+		ARR_APP1(lpp_t*, session->queue, lpp);
+		firm_cond_signal(&session->cond);
+		firm_mutex_unlock(&session->lock);
+		return;
+	}
+#endif
+	/* no workers: solve synchronously, the deadline still applies */
+	lpp_session_apply_deadline(session, lpp);
+	session->solver(lpp);
+}
+
+void lpp_session_finish(lpp_session_t *const session)
+{
+#if FIRM_HAS_THREADS
+	if (session->n_workers > 0) {
+		firm_mutex_lock(&session->lock);
+		session->finishing = true;
+		firm_cond_broadcast(&session->cond);
+		firm_mutex_unlock(&session->lock);
+		for (unsigned t = 0; t < session->n_workers; ++t)
+			firm_thread_join(session->workers[t]);
+		firm_cond_destroy(&session->cond);
+		firm_mutex_destroy(&session->lock);
+	}
+#endif
+	free(session->workers);
+	ir_timer_free(session->timer);
+	DEL_ARR_F(session->queue);
+	free(session);
+}
@@ -19,4 +19,44 @@ typedef void lpp_solver_func_t(lpp_t *lpp);
  */
 lpp_solver_func_t *lpp_find_solver(char const *name);
 
+/**
+ * An asynchronous solver session: problems submitted to a session are
+ * solved by a pool of worker threads while the caller keeps building the
+ * next ones, all sharing one deadline.
+ */
+typedef struct lpp_session_t lpp_session_t;
+
+/**
+ * Opens a solver session.
+ *
+ * The session deadline starts running immediately: a problem picked up
+ * after some of it has elapsed only gets the remaining time as its time
+ * limit (an explicit tighter lpp_set_time_limit() is kept). Concurrent
+ * sessions require a solver whose instances are independent, which holds
+ * for the cplex and gurobi drivers as each solve opens its own
+ * environment.
+ *
+ * @param solver        the solver to run on every problem
+ * @param n_threads     maximum number of worker threads; without thread
+ *                      support or with n_threads <= 1 problems are
+ *                      solved synchronously on submission
+ * @param deadline_secs wall-clock budget for the whole session,
+ *                      0.0 means no deadline
+ */
+lpp_session_t *lpp_session_begin(lpp_solver_func_t *solver,
+                                 unsigned n_threads, double deadline_secs);
+
+/**
+ * Hands a problem to the session. The problem must be fully built and
+ * must not be touched again before lpp_session_finish() returns.
+ */
+void lpp_session_submit(lpp_session_t *session, lpp_t *lpp);
+
+/**
+ * Waits until all submitted problems are solved and frees the session.
+ * The solutions are found in the problems themselves, as after
+ * lpp_solve().
+ */
+void lpp_session_finish(lpp_session_t *session);
+
 #endif
@@ -620,6 +620,80 @@ static inline void matrix_fill_row(sp_matrix_t *m, int row, bitset_t *fullrow)
 	}
 }
 
+matrix_csr_t *matrix_csr_from_triplets(const matrix_elem_t *elems,
+                                       int n_elems, int rows, int cols)
+{
+	matrix_csr_t *csr = XMALLOC(matrix_csr_t);
+	csr->rows      = rows;
+	csr->cols      = cols;
+	csr->n_entries = n_elems;
+	csr->row_start = XMALLOCNZ(int, rows + 1);
+	csr->col       = XMALLOCN(int, n_elems);
+	csr->val       = XMALLOCN(float, n_elems);
+
+	/* bucket the triplets by row: count, prefix-sum, scatter */
+	for (int i = 0; i < n_elems; ++i) {
+		assert(elems[i].row >= 0 && elems[i].row < rows);
+		assert(elems[i].col >= 0 && elems[i].col < cols);
+		++csr->row_start[elems[i].row + 1];
+	}
+	for (int r = 0; r < rows; ++r)
+		csr->row_start[r + 1] += csr->row_start[r];
+
+	int *fill = XMALLOCN(int, rows);
+	MEMCPY(fill, csr->row_start, rows);
+	for (int i = 0; i < n_elems; ++i) {
+		int const pos = fill[elems[i].row]++;
+		csr->col[pos] = elems[i].col;
+		csr->val[pos] = elems[i].val;
+	}
+	free(fill);
+
+	/* sort every row segment by column; rows are short, so insertion
+	 * sort beats the qsort call overhead */
+	for (int r = 0; r < rows; ++r) {
+		for (int i = csr->row_start[r] + 1; i < csr->row_start[r + 1];
+		     ++i) {
+			int   const c = csr->col[i];
+			float const v = csr->val[i];
+			int         o = i;
+			for (; o > csr->row_start[r] && csr->col[o - 1] > c; --o) {
+				csr->col[o] = csr->col[o - 1];
+				csr->val[o] = csr->val[o - 1];
+			}
+			csr->col[o] = c;
+			csr->val[o] = v;
+		}
+	}
+	return csr;
+}
+
+matrix_csr_t *matrix_to_csr(sp_matrix_t *m)
+{
+	/* gather the lists into a triplet array and reuse the bulk path */
+	int const      n_elems = matrix_get_entries(m);
+	matrix_elem_t *elems   = XMALLOCN(matrix_elem_t, n_elems);
+	int            n       = 0;
+	matrix_foreach(m, e) {
+		elems[n++] = *e;
+	}
+	assert(n == n_elems);
+
+	matrix_csr_t *csr = matrix_csr_from_triplets(elems, n_elems,
+	                                             m->maxrow + 1,
+	                                             m->maxcol + 1);
+	free(elems);
+	return csr;
+}
+
+void matrix_csr_free(matrix_csr_t *csr)
+{
+	free(csr->row_start);
+	free(csr->col);
+	free(csr->val);
+	free(csr);
+}
+
 void matrix_optimize(sp_matrix_t *m)
 {
 	int i, size, redo;
@@ -771,5 +845,22 @@ void matrix_self_test(int d)
 	matrix_set(m, 1,1,0);
 	if (matrix_get_entries(m) != 5)
 		panic("matrix get/set 3 failed");
+
+	matrix_csr_t *csr = matrix_to_csr(m);
+	if (csr->n_entries != 5)
+		panic("matrix_to_csr entry count failed");
+	i = 0;
+	for (int r = 0; r < csr->rows; ++r) {
+		int last_col = -1;
+		matrix_csr_foreach_in_row(csr, r, idx) {
+			if (csr->col[idx] <= last_col)
+				panic("matrix csr columns not sorted");
+			last_col = csr->col[idx];
+			++i;
+		}
+	}
+	if (i != 5)
+		panic("matrix csr row iteration failed");
+	matrix_csr_free(csr);
 	del_matrix(m);
 }
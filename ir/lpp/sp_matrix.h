@@ -123,6 +123,55 @@ unsigned matrix_get_elem_size(void);
 #define matrix_foreach_in_col(m,c,curr) \
 		for (matrix_elem_t const *curr = matrix_col_first(m, c); curr; curr = matrix_next(m))
 
+/**
+ * A sealed, read-only matrix in compressed sparse row form. The entries
+ * of row r are val[row_start[r]] .. val[row_start[r+1] - 1] with their
+ * column indices in col[], sorted ascending. All three arrays are
+ * contiguous, so iteration does no pointer chasing.
+ */
+typedef struct matrix_csr_t {
+	int    rows;      /* number of rows */
+	int    cols;      /* number of columns */
+	int    n_entries; /* number of (not-0-)entries */
+	int   *row_start; /* rows + 1 offsets into col/val, last is n_entries */
+	int   *col;       /* column index per entry */
+	float *val;       /* value per entry */
+} matrix_csr_t;
+
+/**
+ * Builds a sealed matrix directly from an array of triplets, in any
+ * order and with any number of entries per row. O(n_elems) plus the
+ * per-row column sort.
+ */
+matrix_csr_t *matrix_csr_from_triplets(const matrix_elem_t *elems,
+                                       int n_elems, int rows, int cols);
+
+/**
+ * Seals the current contents of @p m into compressed sparse row form.
+ * The linked representation is left untouched.
+ */
+matrix_csr_t *matrix_to_csr(sp_matrix_t *m);
+
+/**
+ * Frees a sealed matrix.
+ */
+void matrix_csr_free(matrix_csr_t *csr);
+
+/**
+ * Iterates over the entry indices of row r; index the col/val arrays
+ * with idx.
+ */
+#define matrix_csr_foreach_in_row(csr, r, idx) \
+		for (int idx = (csr)->row_start[r]; idx < (csr)->row_start[(r) + 1]; ++idx)
+
+/**
+ * Iterates over the row numbers in blocks of bs rows; rb is the first
+ * row of the current block. Processing a block completely before moving
+ * on keeps the touched part of a column-indexed vector in the cache.
+ */
+#define matrix_csr_foreach_row_block(csr, bs, rb) \
+		for (int rb = 0; rb < (csr)->rows; rb += (bs))
+
 /**
  * Changes the matrix into an equivalent one with maximal number zero-rows.
  * The only equivalence transformation is:
@@ -24,6 +24,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 /* NOTE BEFORE MODIFYING THIS FILE: This version number must be
    incremented whenever callers compiled using an old obstack.h can no
    longer properly call the functions in this obstack.c.  */
@@ -319,6 +324,26 @@ void obstack_free(struct obstack *h, void *obj)
     abort ();
 }
 
+/* Return unused memory at the top of obstack H to the operating system.
+   Only whole pages strictly between `next_free' and the current chunk's
+   limit are decommitted; they stay mapped, so subsequent growth just
+   faults them back in.  Their previous contents are lost, which is fine
+   because the obstack never reads beyond `next_free'.  On systems
+   without madvise this is a no-op.  */
+
+void _obstack_trim (struct obstack *h)
+{
+#if defined(__unix__) || defined(__APPLE__)
+  uintptr_t const mask = (uintptr_t) sysconf (_SC_PAGESIZE) - 1;
+  uintptr_t const lo = ((uintptr_t) h->next_free + mask) & ~mask;
+  uintptr_t const hi = (uintptr_t) h->chunk_limit & ~mask;
+  if (lo < hi)
+    madvise ((void *) lo, hi - lo, MADV_DONTNEED);
+#else
+  (void) h;
+#endif
+}
+
 ptrdiff_t _obstack_memory_used(struct obstack *h)
 {
   register struct _obstack_chunk* lp;
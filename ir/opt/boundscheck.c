@@ -0,0 +1,545 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Elimination of redundant bounds checks.
+ *
+ * A bounds check is a Cond on a Cmp where exactly one of the two
+ * branches leads into a failure block, i.e. a block that traps or calls
+ * a noreturn handler. Memory-safe frontends emit one such check per
+ * access, which leaves many of them trivially redundant. Three proofs
+ * remove a check here: the possible relations of the operands (constant
+ * bits, value ranges, Confirms) already imply the passing relation; a
+ * dominating check on the same operands implies it; or the checked value
+ * is the counter of a counted loop, in which case the per-iteration
+ * check is replaced by one widened check against the extreme counter
+ * value on the loop entry edge.
+ */
+#include "array.h"
+#include "constbits.h"
+#include "debug.h"
+#include "ircons.h"
+#include "irdom.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irloop_t.h"
+#include "irnode_t.h"
+#include "iropt.h"
+#include "iroptimize.h"
+#include "scalar_evolution.h"
+#include "tv.h"
+#include "type_t.h"
+#include "util.h"
+#include "vrp.h"
+#include "xmalloc.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+typedef enum check_action_t {
+	CHECK_KEEP,          /**< no proof found, leave the check alone */
+	CHECK_ALWAYS_PASSES, /**< fold the Cond to the passing branch */
+	CHECK_ALWAYS_FAILS,  /**< fold the Cond to the failing branch */
+	CHECK_HOIST,         /**< replace by a widened check before the loop */
+} check_action_t;
+
+typedef struct bounds_check_t {
+	ir_node       *cond;
+	ir_node       *left;          /**< operands and relation of the Cmp, */
+	ir_node       *right;         /**< oriented so that left rel right */
+	ir_relation    pass_relation; /**< holds iff the check passes */
+	unsigned       pass_pn;       /**< Proj number of the passing branch */
+	ir_node       *pass_target;   /**< block entered when the check passes */
+	ir_node       *trap;          /**< trap Builtin of the failure block or
+	                                   NULL for a noreturn Call */
+	check_action_t action;
+	/* only valid for CHECK_HOIST: */
+	ir_node       *header;        /**< header of the loop to guard */
+	int            entry_pos;     /**< entry edge position in the header */
+	ir_node       *bound;         /**< the loop-invariant bound */
+	ir_relation    iv_relation;   /**< counter iv_relation bound passes */
+	ir_tarval     *extreme_tv;    /**< most demanding counter value */
+	ir_node       *entry_mem;     /**< memory state on the entry edge */
+} bounds_check_t;
+
+typedef struct bce_env_t {
+	bounds_check_t *checks;
+	bool            changed;
+} bce_env_t;
+
+static bool is_inner_loop(ir_loop *const outer_loop, ir_loop *inner_loop)
+{
+	ir_loop *old_inner_loop;
+	do {
+		old_inner_loop = inner_loop;
+		inner_loop = get_loop_outer_loop(inner_loop);
+	} while (inner_loop != old_inner_loop && inner_loop != outer_loop);
+	return inner_loop != old_inner_loop;
+}
+
+static bool block_is_inside_loop(ir_node *const block, ir_loop *const loop)
+{
+	ir_loop *const block_loop = get_irn_loop(block);
+	if (block_loop == NULL)
+		return false;
+	return block_loop == loop || is_inner_loop(loop, block_loop);
+}
+
+static bool block_dominates_loop(ir_node *const block, ir_loop *const loop)
+{
+	size_t const n_elements = get_loop_n_elements(loop);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_node) {
+			assert(is_Block(element.node));
+			if (!block_dominates(block, element.node))
+				return false;
+		} else if (*element.kind == k_ir_loop) {
+			if (!block_dominates_loop(block, element.son))
+				return false;
+		}
+	}
+	return true;
+}
+
+/** Returns the block that dominates all blocks in the loop or NULL. */
+static ir_node *get_loop_header(ir_loop *const loop)
+{
+	ir_node *header = NULL;
+	size_t const n_elements = get_loop_n_elements(loop);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind != k_ir_node)
+			continue;
+		if (header == NULL || block_dominates(element.node, header))
+			header = element.node;
+	}
+	if (header == NULL)
+		return NULL;
+	return block_dominates_loop(header, loop) ? header : NULL;
+}
+
+/** Returns whether @p stronger holding implies that @p weaker holds. */
+static bool relation_implies(ir_relation const stronger,
+                             ir_relation const weaker)
+{
+	return (stronger & ~weaker) == ir_relation_false;
+}
+
+/**
+ * Returns the failing control flow sink of @p block: a trap Builtin, a
+ * Call to a noreturn entity or NULL if the block is no failure block.
+ */
+static ir_node *get_failure_sink(ir_node *const block)
+{
+	foreach_out_edge(block, edge) {
+		ir_node *const node = get_edge_src_irn(edge);
+		if (is_Block(node) || get_nodes_block(node) != block)
+			continue;
+		if (is_Builtin(node) && get_Builtin_kind(node) == ir_bk_trap)
+			return node;
+		if (is_Call(node)
+		    && (get_method_additional_properties(get_Call_type(node))
+		        & mtp_property_noreturn))
+			return node;
+	}
+	return NULL;
+}
+
+/** Returns the single block a mode X node jumps to or NULL. */
+static ir_node *get_cf_target(ir_node *const projx)
+{
+	foreach_out_edge(projx, edge) {
+		ir_node *const user = get_edge_src_irn(edge);
+		if (is_Block(user))
+			return user;
+	}
+	return NULL;
+}
+
+/**
+ * Walker: collects all bounds checks of the graph.
+ */
+static void collect_check(ir_node *const node, void *const data)
+{
+	bce_env_t *const env = (bce_env_t*)data;
+	if (!is_Cond(node))
+		return;
+	ir_node *const sel = get_Cond_selector(node);
+	if (!is_Cmp(sel))
+		return;
+
+	ir_node *proj_true  = NULL;
+	ir_node *proj_false = NULL;
+	foreach_out_edge(node, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (get_Proj_num(proj) == pn_Cond_true)
+			proj_true = proj;
+		else
+			proj_false = proj;
+	}
+	if (proj_true == NULL || proj_false == NULL)
+		return;
+	ir_node *const target_true  = get_cf_target(proj_true);
+	ir_node *const target_false = get_cf_target(proj_false);
+	if (target_true == NULL || target_false == NULL)
+		return;
+
+	ir_node *const sink_true  = get_failure_sink(target_true);
+	ir_node *const sink_false = get_failure_sink(target_false);
+	if ((sink_true != NULL) == (sink_false != NULL))
+		return;
+
+	bool     const fails_true = sink_true != NULL;
+	ir_node *const sink       = fails_true ? sink_true : sink_false;
+	ir_relation    relation   = get_Cmp_relation(sel);
+	if (fails_true)
+		relation = get_negated_relation(relation);
+
+	bounds_check_t const check = {
+		.cond          = node,
+		.left          = get_Cmp_left(sel),
+		.right         = get_Cmp_right(sel),
+		.pass_relation = relation,
+		.pass_pn       = fails_true ? pn_Cond_false : pn_Cond_true,
+		.pass_target   = fails_true ? target_false : target_true,
+		.trap          = is_Builtin(sink) ? sink : NULL,
+		.action        = CHECK_KEEP,
+	};
+	ARR_APP1(bounds_check_t, env->checks, check);
+}
+
+/**
+ * Tries to decide @p check from the possible relations of its operands
+ * alone: value ranges, known bits and Confirm facts.
+ */
+static void prove_by_relations(bounds_check_t *const check)
+{
+	ir_relation const possible
+		= ir_get_possible_cmp_relations(check->left, check->right);
+	if (relation_implies(possible, check->pass_relation)) {
+		check->action = CHECK_ALWAYS_PASSES;
+	} else if ((possible & check->pass_relation) == ir_relation_false) {
+		check->action = CHECK_ALWAYS_FAILS;
+	}
+}
+
+/**
+ * Tries to prove @p check from a dominating check on the same operands.
+ * The dominating pass target must have the passing branch as its only
+ * predecessor: then every path into the dominated region evaluated the
+ * operands and took the passing branch, and since the operand
+ * definitions dominate both checks they cannot be re-evaluated in
+ * between without funneling through the passing branch again.
+ */
+static void prove_by_dominance(bce_env_t *const env,
+                               bounds_check_t *const check)
+{
+	ir_node *const block = get_nodes_block(check->cond);
+	for (size_t i = 0, n = ARR_LEN(env->checks); i < n; ++i) {
+		bounds_check_t const *const other = &env->checks[i];
+		if (other == check)
+			continue;
+
+		ir_relation other_relation;
+		if (other->left == check->left && other->right == check->right) {
+			other_relation = other->pass_relation;
+		} else if (other->left == check->right
+		           && other->right == check->left) {
+			other_relation = get_inversed_relation(other->pass_relation);
+		} else {
+			continue;
+		}
+		if (!relation_implies(other_relation, check->pass_relation))
+			continue;
+		if (get_Block_n_cfgpreds(other->pass_target) != 1)
+			continue;
+		if (!block_dominates(other->pass_target, block))
+			continue;
+
+		DB((dbg, LEVEL_1, "%+F implies %+F\n", other->cond, check->cond));
+		check->action = CHECK_ALWAYS_PASSES;
+		return;
+	}
+}
+
+/**
+ * Returns whether every loop exit is either the counted exit in the
+ * loop header or another bounds check. Only then is the check of the
+ * last iteration guaranteed to execute whenever the loop runs to
+ * completion, which the widened entry check assumes.
+ */
+static bool only_counted_and_failing_exits(ir_loop *const loop,
+                                           ir_loop *const part,
+                                           ir_node *const header)
+{
+	size_t const n_elements = get_loop_n_elements(part);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(part, i);
+		if (*element.kind == k_ir_loop) {
+			if (!only_counted_and_failing_exits(loop, element.son, header))
+				return false;
+			continue;
+		} else if (*element.kind != k_ir_node) {
+			continue;
+		}
+
+		ir_node *const block = element.node;
+		if (block == header)
+			continue;
+		foreach_out_edge(block, edge) {
+			ir_node *const node = get_edge_src_irn(edge);
+			if (is_Block(node) || get_nodes_block(node) != block
+			    || get_irn_mode(node) != mode_X)
+				continue;
+			ir_node *const target = get_cf_target(node);
+			if (target == NULL || block_is_inside_loop(target, loop))
+				continue;
+			if (get_failure_sink(target) == NULL)
+				return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Tries to subsume the per-iteration @p check under one widened check on
+ * the loop entry edge. The checked value must be the counter of a
+ * counted loop, the bound loop-invariant and the check executed on every
+ * iteration; the widened check then compares the bound against the most
+ * demanding value the counter ever takes.
+ */
+static void prove_by_induction(bounds_check_t *const check)
+{
+	ir_node *const block = get_nodes_block(check->cond);
+	ir_graph *const irg  = get_irn_irg(block);
+	ir_loop  *const loop = get_irn_loop(block);
+	if (loop == NULL || loop == get_irg_loop(irg))
+		return;
+	/* the original failure block may use values defined inside the loop,
+	 * so the widened check needs a fresh trap */
+	if (check->trap == NULL)
+		return;
+
+	ir_node *const header = get_loop_header(loop);
+	if (header == NULL)
+		return;
+	scev_loop_info_t const *const info = scev_get_loop_info(loop, header);
+	if (info->counter == NULL || info->trip_count < 1)
+		return;
+	scev_addrec_t const *const counter = info->counter;
+	assert(counter->init_tv != NULL && counter->step_tv != NULL);
+
+	/* the loop must actually run: the trip count assumes that the exit
+	 * relation holds for the initial counter value */
+	if (!relation_implies(tarval_cmp(counter->init_tv, info->limit_tv),
+	                      get_Cmp_relation(info->cmp)))
+		return;
+
+	ir_relation iv_relation = check->pass_relation
+	                        & ir_relation_less_equal_greater;
+	ir_node    *bound;
+	if (check->left == counter->phi) {
+		bound = check->right;
+	} else if (check->right == counter->phi) {
+		bound       = check->left;
+		iv_relation = get_inversed_relation(iv_relation);
+	} else {
+		return;
+	}
+	ir_node *const bound_block = get_nodes_block(bound);
+	if (bound_block == header || !block_dominates(bound_block, header))
+		return;
+
+	/* find the single entry edge and make sure the check runs on every
+	 * iteration, i.e. dominates all back edges */
+	int entry_pos = -1;
+	for (int i = 0, n = get_Block_n_cfgpreds(header); i < n; ++i) {
+		ir_node *const pred_block
+			= get_nodes_block(get_Block_cfgpred(header, i));
+		if (!block_is_inside_loop(pred_block, loop)) {
+			if (entry_pos >= 0)
+				return;
+			entry_pos = i;
+		} else if (!block_dominates(block, pred_block)) {
+			return;
+		}
+	}
+	if (entry_pos < 0)
+		return;
+	if (!only_counted_and_failing_exits(loop, loop, header))
+		return;
+
+	/* the hoisted trap must use the memory state on the entry edge: take
+	 * it from the memory Phi of the header or, when memory is not live
+	 * across the back edge, reuse the memory input of the original trap */
+	ir_node *entry_mem = NULL;
+	foreach_out_edge(header, edge) {
+		ir_node *const node = get_edge_src_irn(edge);
+		if (is_Phi(node) && get_nodes_block(node) == header
+		    && get_irn_mode(node) == mode_M) {
+			entry_mem = get_Phi_pred(node, entry_pos);
+			break;
+		}
+	}
+	if (entry_mem == NULL) {
+		entry_mem = get_Builtin_mem(check->trap);
+		ir_node *const entry_block
+			= get_nodes_block(get_Block_cfgpred(header, entry_pos));
+		if (!block_dominates(get_nodes_block(entry_mem), entry_block))
+			return;
+	}
+
+	/* the never reached Return after the hoisted trap needs values for
+	 * all results */
+	ir_type *const mtp = get_entity_type(get_irg_entity(irg));
+	for (size_t i = 0, n = get_method_n_ress(mtp); i < n; ++i) {
+		if (get_type_mode(get_method_res_type(mtp, i)) == NULL)
+			return;
+	}
+
+	/* counted loops do not wrap, so the extreme values of the counter
+	 * are the first and the last one */
+	ir_mode   *const mode = get_irn_mode(counter->phi);
+	ir_tarval *const last = tarval_add(counter->init_tv,
+		tarval_mul(new_tarval_from_long(info->trip_count - 1, mode),
+		           counter->step_tv));
+	ir_tarval *extreme;
+	bool const ascending
+		= tarval_cmp(counter->init_tv, last) != ir_relation_greater;
+	if (relation_implies(iv_relation, ir_relation_less_equal)
+	    && (iv_relation & ir_relation_less)) {
+		extreme = ascending ? last : counter->init_tv;
+	} else if (relation_implies(iv_relation, ir_relation_greater_equal)
+	           && (iv_relation & ir_relation_greater)) {
+		extreme = ascending ? counter->init_tv : last;
+	} else {
+		return;
+	}
+
+	check->action      = CHECK_HOIST;
+	check->header      = header;
+	check->entry_pos   = entry_pos;
+	check->bound       = bound;
+	check->iv_relation = iv_relation;
+	check->extreme_tv  = extreme;
+	check->entry_mem   = entry_mem;
+}
+
+/**
+ * Folds the Cond of @p check to one of its branches; the other becomes
+ * unreachable and is left to control flow optimization.
+ */
+static void fold_check(bounds_check_t const *const check, bool const passes)
+{
+	ir_node  *const cond  = check->cond;
+	ir_node  *const block = get_nodes_block(cond);
+	ir_graph *const irg   = get_irn_irg(cond);
+	ir_node  *const jmp   = new_r_Jmp(block);
+	ir_node  *const bad   = new_r_Bad(irg, mode_X);
+	bool      const jmp_true = (check->pass_pn == pn_Cond_true) == passes;
+	ir_node *const in[] = {
+		[pn_Cond_false] = jmp_true ? bad : jmp,
+		[pn_Cond_true]  = jmp_true ? jmp : bad,
+	};
+	DB((dbg, LEVEL_1, "%+F always %s\n", cond, passes ? "passes" : "fails"));
+	turn_into_tuple(cond, ARRAY_SIZE(in), in);
+}
+
+/**
+ * Places the widened check of @p check into a new block on the loop
+ * entry edge and folds the original in-loop check away. Several hoisted
+ * checks of one loop chain up on the entry edge.
+ */
+static void hoist_check(bounds_check_t const *const check)
+{
+	ir_graph *const irg   = get_irn_irg(check->cond);
+	dbg_info *const dbgi  = get_irn_dbg_info(check->cond);
+	ir_node  *const entry = get_Block_cfgpred(check->header,
+	                                          check->entry_pos);
+	ir_node  *const guard = new_r_Block(irg, 1, &entry);
+
+	ir_node *const extreme = new_r_Const(irg, check->extreme_tv);
+	ir_node *const cmp     = new_rd_Cmp(dbgi, guard, extreme, check->bound,
+	                                    check->iv_relation);
+	ir_node *const cond    = new_rd_Cond(dbgi, guard, cmp);
+	ir_node *const pass    = new_r_Proj(cond, mode_X, pn_Cond_true);
+	ir_node *const fail    = new_r_Proj(cond, mode_X, pn_Cond_false);
+	set_Block_cfgpred(check->header, check->entry_pos, pass);
+
+	ir_node *const trap_block = new_r_Block(irg, 1, &fail);
+	ir_node *const trap
+		= new_rd_Builtin(dbgi, trap_block, check->entry_mem, 0, NULL,
+		                 ir_bk_trap, get_Builtin_type(check->trap));
+	ir_node *const trap_mem = new_r_Proj(trap, mode_M, pn_Builtin_M);
+
+	/* the trap never returns; the Return merely keeps the block and the
+	 * memory state reachable from the end block */
+	ir_type *const  mtp   = get_entity_type(get_irg_entity(irg));
+	size_t   const  n_res = get_method_n_ress(mtp);
+	ir_node **const ress  = ALLOCAN(ir_node*, n_res);
+	for (size_t i = 0; i < n_res; ++i) {
+		ress[i] = new_r_Unknown(irg,
+		                        get_type_mode(get_method_res_type(mtp, i)));
+	}
+	ir_node *const ret = new_rd_Return(dbgi, trap_block, trap_mem,
+	                                   n_res, ress);
+	ir_node  *const end_block = get_irg_end_block(irg);
+	int       const n_preds   = get_Block_n_cfgpreds(end_block);
+	ir_node **const preds     = ALLOCAN(ir_node*, n_preds + 1);
+	for (int i = 0; i < n_preds; ++i)
+		preds[i] = get_Block_cfgpred(end_block, i);
+	preds[n_preds] = ret;
+	set_irn_in(end_block, n_preds + 1, preds);
+
+	DB((dbg, LEVEL_1, "hoisted %+F as %+F into %+F\n", check->cond, cond,
+	    guard));
+	fold_check(check, true);
+}
+
+void opt_bounds_checks(ir_graph *const irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.boundscheck");
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
+	                      | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
+	                      | IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+	                      | IR_GRAPH_PROPERTY_NO_BADS);
+	constbits_analyze(irg);
+	set_vrp_data(irg);
+
+	bce_env_t env = { .checks = NEW_ARR_F(bounds_check_t, 0) };
+	irg_walk_graph(irg, NULL, collect_check, &env);
+
+	/* analyze everything first: the proofs rely on dominance, loop and
+	 * out information of the unmodified graph */
+	for (size_t i = 0, n = ARR_LEN(env.checks); i < n; ++i) {
+		bounds_check_t *const check = &env.checks[i];
+		prove_by_relations(check);
+		if (check->action == CHECK_KEEP)
+			prove_by_dominance(&env, check);
+		if (check->action == CHECK_KEEP)
+			prove_by_induction(check);
+	}
+	scev_free_info();
+
+	for (size_t i = 0, n = ARR_LEN(env.checks); i < n; ++i) {
+		bounds_check_t const *const check = &env.checks[i];
+		switch (check->action) {
+		case CHECK_KEEP:          continue;
+		case CHECK_ALWAYS_PASSES: fold_check(check, true);  break;
+		case CHECK_ALWAYS_FAILS:  fold_check(check, false); break;
+		case CHECK_HOIST:         hoist_check(check);       break;
+		}
+		env.changed = true;
+	}
+
+	DEL_ARR_F(env.checks);
+	free_vrp_data(irg);
+	constbits_clear(irg);
+	confirm_irg_properties(irg, env.changed ? IR_GRAPH_PROPERTIES_NONE
+	                                        : IR_GRAPH_PROPERTIES_ALL);
+}
@@ -0,0 +1,310 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @brief    Graph cleanup: remove unreachable code, Bad and Tuple nodes
+ * @author   Andreas Zwinkau
+ *
+ * The cleanup transformations are requested between most passes of a
+ * pipeline, so they share a single engine doing one graph walk instead
+ * of one walk per node kind. Unreachable code is eliminated by cutting
+ * all edges into it, so that afterwards it is dead; Bad nodes may only
+ * be present as block or phi inputs (inputs that are now unreachable)
+ * and are removed by shortening their users; Tuple nodes are removed by
+ * routing their Projs to the tupled values.
+ */
+#include "iroptimize.h"
+
+#include "irgmod.h"
+#include "irgopt.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "irtools.h"
+#include <assert.h>
+
+typedef struct cleanup_env_t {
+	ir_cleanup_flags_t flags;
+	ir_node          **bad_blocks;  /**< blocks with Bad inputs, only
+	                                     collected for IR_CLEANUP_BADS */
+	bool               changed_unreachable;
+	bool               changed_tuples;
+} cleanup_env_t;
+
+static bool is_block_unreachable(ir_node *block)
+{
+	return get_Block_dom_depth(block) < 0;
+}
+
+/** Transforms:
+ *    a
+ *    |
+ *   Tuple
+ *    |        =>
+ *   Proj x          a
+ */
+static void exchange_tuple_projs(ir_node *node, cleanup_env_t *env)
+{
+	if (!is_Proj(node))
+		return;
+
+	/* Handle Tuple(Tuple,...) case. */
+	exchange_tuple_projs(get_Proj_pred(node), env);
+
+	ir_node *pred = get_Proj_pred(node);
+	if (!is_Tuple(pred))
+		return;
+
+	unsigned pn         = get_Proj_num(node);
+	ir_node *tuple_pred = get_Tuple_pred(pred, pn);
+	exchange(node, tuple_pred);
+	env->changed_tuples = true;
+}
+
+/**
+ * Eliminate block- and phi-inputs pointing to unreachable code
+ */
+static void unreachable_to_bad(ir_node *node, cleanup_env_t *env)
+{
+	if (is_Block(node)) {
+		/* optimization: we do not have to do anything inside the unreachable
+		 * code */
+		if (is_block_unreachable(node))
+			return;
+
+		ir_graph *irg = get_irn_irg(node);
+		foreach_irn_in(node, i, pred) {
+			if (is_Bad(pred) || !is_block_unreachable(get_nodes_block(pred)))
+				continue;
+			set_irn_n(node, i, new_r_Bad(irg, mode_X));
+			env->changed_unreachable = true;
+		}
+	} else if (is_Phi(node)) {
+		/* optimization: we do not have to do anything inside the unreachable
+		 * code */
+		ir_node  *block = get_nodes_block(node);
+		if (is_block_unreachable(block))
+			return;
+
+		ir_graph *const irg = get_irn_irg(node);
+		foreach_irn_in(node, i, phi_pred) {
+			if (is_Bad(phi_pred))
+				continue;
+			ir_node *const block_pred = get_Block_cfgpred(block, i);
+			if (!is_Bad(block_pred)
+			    && !is_block_unreachable(get_nodes_block(block_pred)))
+				continue;
+
+			set_irn_n(node, i, new_r_Bad(irg, get_irn_mode(node)));
+			env->changed_unreachable = true;
+		}
+	}
+}
+
+static bool has_bad_input(const ir_node *node)
+{
+	foreach_irn_in(node, i, pred) {
+		if (is_Bad(pred)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void cleanup_pre(ir_node *node, void *data)
+{
+	cleanup_env_t *env = (cleanup_env_t*)data;
+	if (env->flags & IR_CLEANUP_TUPLES)
+		exchange_tuple_projs(node, env);
+	if (env->flags & IR_CLEANUP_BADS)
+		firm_clear_block_phis(node, NULL);
+}
+
+/**
+ * The unreachable and Bad parts run post-order: by then all Tuples among
+ * the predecessors are resolved and all Bad inputs a block will get in
+ * this walk are already in place, so a single visit suffices.
+ */
+static void cleanup_post(ir_node *node, void *data)
+{
+	cleanup_env_t *env = (cleanup_env_t*)data;
+	if (env->flags & IR_CLEANUP_UNREACHABLE_CODE)
+		unreachable_to_bad(node, env);
+	if (env->flags & IR_CLEANUP_BADS) {
+		firm_collect_block_phis(node, NULL);
+		if (is_Block(node) && has_bad_input(node))
+			ARR_APP1(ir_node*, env->bad_blocks, node);
+	}
+}
+
+/**
+ * Block-walker, remove Bad block predecessors and shorten Phis.
+ * Phi links must be up-to-date.
+ */
+static void block_remove_bads(ir_node *block)
+{
+	/* 1. Create a new block without Bad inputs */
+	ir_graph  *irg     = get_irn_irg(block);
+	const int  max     = get_Block_n_cfgpreds(block);
+	ir_node  **new_in  = ALLOCAN(ir_node*, max);
+	unsigned   new_max = 0;
+	for (int i = 0; i < max; ++i) {
+		ir_node *const block_pred = get_Block_cfgpred(block, i);
+		if (!is_Bad(block_pred)) {
+			new_in[new_max++] = block_pred;
+		}
+	}
+
+	/* If the end block is unreachable, it might have zero predecessors. */
+	if (new_max == 0) {
+		ir_node *end_block = get_irg_end_block(irg);
+		if (block == end_block) {
+			set_irn_in(block, new_max, new_in);
+			return;
+		}
+	}
+
+	dbg_info  *dbgi         = get_irn_dbg_info(block);
+	ir_node   *new_block    = new_rd_Block(dbgi, irg, new_max, new_in);
+	ir_entity *block_entity = get_Block_entity(block);
+	set_Block_entity(new_block, block_entity);
+
+	/* 2. Remove inputs on Phis, where the block input is Bad. */
+	for (ir_node *phi = get_Block_phis(block), *next; phi != NULL; phi = next) {
+		next = get_Phi_next(phi);
+
+		assert(get_irn_arity(phi) == max);
+
+		unsigned j = 0;
+		foreach_irn_in(phi, i, pred) {
+			ir_node *const block_pred = get_Block_cfgpred(block, i);
+			if (!is_Bad(block_pred)) {
+				new_in[j++] = pred;
+			}
+		}
+		assert(j == new_max);
+
+		/* shortcut if only 1 phi input is left */
+		if (new_max == 1) {
+			ir_node *new_node = new_in[0];
+			/* can happen inside unreachable endless loops */
+			if (new_node == phi)
+				return;
+			if (get_Phi_loop(phi))
+				remove_keep_alive(phi);
+			exchange(phi, new_node);
+		} else {
+			set_irn_in(phi, new_max, new_in);
+		}
+	}
+
+	exchange(block, new_block);
+}
+
+void ir_cleanup_graph(ir_graph *irg, ir_cleanup_flags_t flags)
+{
+	if (flags & IR_CLEANUP_UNREACHABLE_CODE) {
+		ir_graph_properties_t required = IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE;
+		/* Tuples among the control flow predecessors would hide the
+		 * blocks the unreachability test must look at; either they are
+		 * resolved within this very walk or they must be gone already. */
+		if (!(flags & IR_CLEANUP_TUPLES))
+			required |= IR_GRAPH_PROPERTY_NO_TUPLES;
+		assure_irg_properties(irg, required);
+	} else if (flags & IR_CLEANUP_BADS) {
+		/* A block with only Bad predecessors would violate
+		 * the invariant that each block has at least one predecessor. */
+		assure_irg_properties(irg, IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
+	}
+
+	cleanup_env_t env = { .flags = flags };
+	if (flags & IR_CLEANUP_BADS) {
+		/* build phi list per block */
+		ir_reserve_resources(irg, IR_RESOURCE_PHI_LIST);
+		env.bad_blocks = NEW_ARR_F(ir_node*, 0);
+	}
+
+	irg_walk_graph(irg, cleanup_pre, cleanup_post, &env);
+
+	/* Reconcile the keep-alive edges in one pass. This must happen before
+	 * blocks are rebuilt below, while the dominance information the
+	 * unreachability test reads is still in place. */
+	ir_node *end = get_irg_end(irg);
+	for (int i = get_End_n_keepalives(end); i-- > 0; ) {
+		ir_node *ka = get_End_keepalive(end, i);
+		if ((flags & IR_CLEANUP_TUPLES) && is_Tuple(ka)) {
+			remove_End_n(end, i);
+			env.changed_tuples = true;
+			continue;
+		}
+		if ((flags & IR_CLEANUP_UNREACHABLE_CODE)
+		    && is_block_unreachable(get_block(ka))) {
+			remove_End_n(end, i);
+			env.changed_unreachable = true;
+		}
+	}
+
+	size_t n_bad_blocks = 0;
+	if (flags & IR_CLEANUP_BADS) {
+		n_bad_blocks = ARR_LEN(env.bad_blocks);
+		for (size_t i = 0; i < n_bad_blocks; ++i) {
+			block_remove_bads(env.bad_blocks[i]);
+		}
+		DEL_ARR_F(env.bad_blocks);
+		ir_free_resources(irg, IR_RESOURCE_PHI_LIST);
+
+		remove_End_Bads_and_doublets(end);
+	}
+
+	ir_graph_properties_t keep = IR_GRAPH_PROPERTIES_ALL;
+	if (env.changed_unreachable) {
+		keep &= IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES
+		      | IR_GRAPH_PROPERTY_NO_TUPLES
+		      | IR_GRAPH_PROPERTY_ONE_RETURN
+		      | IR_GRAPH_PROPERTY_MANY_RETURNS;
+	}
+	if (env.changed_tuples) {
+		keep &= IR_GRAPH_PROPERTIES_CONTROL_FLOW
+		      | IR_GRAPH_PROPERTY_ONE_RETURN
+		      | IR_GRAPH_PROPERTY_MANY_RETURNS
+		      | IR_GRAPH_PROPERTY_NO_BADS;
+	}
+	if (n_bad_blocks > 0) {
+		keep &= IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE
+		      | IR_GRAPH_PROPERTY_NO_TUPLES
+		      | IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES
+		      | IR_GRAPH_PROPERTY_ONE_RETURN
+		      | IR_GRAPH_PROPERTY_MANY_RETURNS
+		      | IR_GRAPH_PROPERTY_CONSISTENT_ENTITY_USAGE;
+	}
+	confirm_irg_properties(irg, keep);
+
+	if (flags & IR_CLEANUP_UNREACHABLE_CODE)
+		add_irg_properties(irg, IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
+	if (flags & IR_CLEANUP_TUPLES)
+		add_irg_properties(irg, IR_GRAPH_PROPERTY_NO_TUPLES);
+	if (flags & IR_CLEANUP_BADS)
+		add_irg_properties(irg, IR_GRAPH_PROPERTY_NO_BADS);
+
+	/* The copying garbage collection cannot share the walk above: it
+	 * traverses the already cleaned graph while moving it to a fresh
+	 * obstack. */
+	if (flags & IR_CLEANUP_DEAD_NODES)
+		dead_node_elimination(irg);
+}
+
+void remove_unreachable_code(ir_graph *irg)
+{
+	ir_cleanup_graph(irg, IR_CLEANUP_UNREACHABLE_CODE);
+}
+
+void remove_bads(ir_graph *irg)
+{
+	ir_cleanup_graph(irg, IR_CLEANUP_BADS);
+}
+
+void remove_tuples(ir_graph *irg)
+{
+	ir_cleanup_graph(irg, IR_CLEANUP_TUPLES);
+}
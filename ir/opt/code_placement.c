@@ -14,9 +14,12 @@
  * dependencies allow. After pushing them back up out of as many loops as
  * possible.
  */
+#include "execfreq.h"
 #include "iredges_t.h"
 #include "irgopt.h"
+#include "irgwalk.h"
 #include "irnode_t.h"
+#include "irnodemap.h"
 #include "iroptimize.h"
 #include "pdeq.h"
 #include <stdbool.h>
@@ -167,6 +170,72 @@ static inline int get_block_loop_depth(ir_node *block)
 	return get_loop_depth(get_irn_loop(block));
 }
 
+/** When set place_code() trades some hoisting for shorter live ranges. */
+static bool respect_pressure;
+
+/** Number of data values defined per block, see count_block_defs(). */
+static ir_nodemap block_defs;
+
+/**
+ * Hoisting a value past blocks that already define this many values is
+ * considered pressure critical: the chance is high that keeping it live
+ * through such a region makes the spiller step in.  This is a crude stand-in
+ * for the size of the integer register file of typical targets.
+ */
+#define PRESSURE_LIMIT 16
+
+/**
+ * Pre-pass walker counting the data values defined in each block.  The count
+ * is only an upper bound on the register pressure there (values may die
+ * immediately), but like the unused-register count in beschedregpress it is
+ * cheap and errs on the conservative side.
+ */
+static void count_block_defs(ir_node *n, void *env)
+{
+	(void)env;
+	if (is_Block(n) || !mode_is_data(get_irn_mode(n)))
+		return;
+	ir_node   *block = get_nodes_block(n);
+	uintptr_t  count = (uintptr_t)ir_nodemap_get(void, &block_defs, block);
+	ir_nodemap_insert(&block_defs, block, (void*)(count+1));
+}
+
+static unsigned get_block_pressure(ir_node *block)
+{
+	return (unsigned)(uintptr_t)ir_nodemap_get(void, &block_defs, block);
+}
+
+/**
+ * Returns true if recomputing @p n near its uses is about as cheap as keeping
+ * its result alive in a register, mirroring what the spillers accept as
+ * rematerializable.
+ */
+static bool is_cheaply_rematerializable(const ir_node *n)
+{
+	switch (get_irn_opcode(n)) {
+	case iro_Add:
+	case iro_Address:
+	case iro_Align:
+	case iro_And:
+	case iro_Const:
+	case iro_Conv:
+	case iro_Eor:
+	case iro_Minus:
+	case iro_Mul:
+	case iro_Not:
+	case iro_Offset:
+	case iro_Or:
+	case iro_Shl:
+	case iro_Shr:
+	case iro_Shrs:
+	case iro_Size:
+	case iro_Sub:
+		return true;
+	default:
+		return false;
+	}
+}
+
 /**
  * Move n to a block with less loop depth than its current block. The
  * new block must be dominated by early.
@@ -176,9 +245,12 @@ static inline int get_block_loop_depth(ir_node *block)
  */
 static void move_out_of_loops(ir_node *n, ir_node *early)
 {
-	ir_node *block      = get_nodes_block(n);
-	ir_node *best       = block;
-	int      best_depth = get_block_loop_depth(best);
+	ir_node *block         = get_nodes_block(n);
+	ir_node *best          = block;
+	int      best_depth    = get_block_loop_depth(best);
+	double   best_freq     = respect_pressure ? get_block_execfreq(best) : 0.0;
+	unsigned max_pressure  = respect_pressure ? get_block_pressure(block) : 0;
+	unsigned best_pressure = max_pressure;
 
 	/* Find the region deepest in the dominator tree dominating
 	   dca with the least loop nesting depth, but still dominated
@@ -186,14 +258,35 @@ static void move_out_of_loops(ir_node *n, ir_node *early)
 	while (block != early) {
 		ir_node *idom       = get_Block_idom(block);
 		int      idom_depth = get_block_loop_depth(idom);
-		if (idom_depth < best_depth) {
+		if (respect_pressure) {
+			/* hoisting to the idom keeps n live through every block on the
+			 * path, so remember the most crowded one passed so far */
+			unsigned idom_pressure = get_block_pressure(idom);
+			if (idom_pressure > max_pressure)
+				max_pressure = idom_pressure;
+			/* use the frequency estimate directly instead of the loop depth
+			 * proxy: only hoist if the target really runs less often */
+			if (get_block_execfreq(idom) < best_freq) {
+				best          = idom;
+				best_depth    = idom_depth;
+				best_freq     = get_block_execfreq(idom);
+				best_pressure = max_pressure;
+			}
+		} else if (idom_depth < best_depth) {
 			best       = idom;
 			best_depth = idom_depth;
 		}
 		block = idom;
 	}
-	if (best != get_nodes_block(n))
-		set_nodes_block(n, best);
+	if (best == get_nodes_block(n))
+		return;
+	/* A cheap computation is better recomputed in the loop than kept live
+	 * through a crowded region: the spill it provokes in the backend costs
+	 * more than the executions it saves. */
+	if (respect_pressure && best_pressure >= PRESSURE_LIMIT
+	    && is_cheaply_rematerializable(n))
+		return;
+	set_nodes_block(n, best);
 }
 
 /**
@@ -325,8 +418,7 @@ static void place_late(ir_graph *irg, deq_t *worklist)
 	}
 }
 
-/* Code Placement. */
-void place_code(ir_graph *irg)
+static void do_place_code(ir_graph *irg)
 {
 	/* Handle graph state */
 	assure_irg_properties(irg,
@@ -355,3 +447,28 @@ void place_code(ir_graph *irg)
 	deq_free(&worklist);
 	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_CONTROL_FLOW);
 }
+
+/* Code Placement. */
+void place_code(ir_graph *irg)
+{
+	respect_pressure = false;
+	do_place_code(irg);
+}
+
+/* Code Placement respecting register pressure. */
+void place_code_pressure_aware(ir_graph *irg)
+{
+	ir_estimate_execfreq(irg);
+
+	/* The counts are taken on the placement the optimizations left behind;
+	 * place_early() shuffles nodes around before they are consulted, but as
+	 * an estimate of where the crowded regions are they stay good enough. */
+	ir_nodemap_init(&block_defs, irg);
+	irg_walk_graph(irg, NULL, count_block_defs, NULL);
+
+	respect_pressure = true;
+	do_place_code(irg);
+	respect_pressure = false;
+
+	ir_nodemap_destroy(&block_defs);
+}
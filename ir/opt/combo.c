@@ -23,6 +23,7 @@
  */
 #include "array.h"
 #include "debug.h"
+#include "hashptr.h"
 #include "ircons.h"
 #include "irdump.h"
 #include "irflag.h"
@@ -2353,7 +2354,8 @@ static node_t *identity_comm_zero_binop(node_t *node)
 	ir_mode *mode = get_irn_mode(op);
 
 	/* for FP these optimizations are only allowed if fp_strict_algebraic is disabled */
-	if (mode_is_float(mode) && !ir_imprecise_float_transforms_allowed())
+	if (mode_is_float(mode)
+	    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(op)))
 		return node;
 
 	/* node: no input should be tarval_bottom, else the binop would be also
@@ -2394,7 +2396,8 @@ static node_t *identity_Mul(node_t *node)
 	ir_mode *mode = get_irn_mode(op);
 
 	/* for FP these optimizations are only allowed if fp_strict_algebraic is disabled */
-	if (mode_is_float(mode) && !ir_imprecise_float_transforms_allowed())
+	if (mode_is_float(mode)
+	    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(op)))
 		return node;
 
 	/* node: no input should be tarval_bottom, else the binop would be also
@@ -2418,7 +2421,8 @@ static node_t *identity_Sub(node_t *node)
 	ir_mode *mode = get_irn_mode(sub);
 
 	/* for FP these optimizations are only allowed if fp_strict_algebraic is disabled */
-	if (mode_is_float(mode) && !ir_imprecise_float_transforms_allowed())
+	if (mode_is_float(mode)
+	    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(sub)))
 		return node;
 
 	/* node: no input should be tarval_bottom, else the binop would be also
@@ -3180,6 +3184,12 @@ static void add_memory_keeps(ir_graph *irg, ir_node **kept_memory, size_t len)
 
 void combo(ir_graph *irg)
 {
+	/* Combo is idempotent: if the graph has not changed since the last
+	 * complete run, re-partitioning it cannot find anything new.  This
+	 * makes the repeated runs in the inline-then-optimize loop cheap. */
+	if (irg->last_combo_nr != 0 && irg->last_combo_nr == irg->change_nr)
+		return;
+
 	assure_irg_properties(irg,
 		IR_GRAPH_PROPERTY_NO_BADS
 		| IR_GRAPH_PROPERTY_NO_TUPLES
@@ -3275,4 +3285,9 @@ void combo(ir_graph *irg)
 	set_value_of_func(NULL);
 
 	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
+
+	/* Everything reachable is now in canonical form; remember that so the
+	 * next run can bail out early if nothing changed in between.  This must
+	 * come last: combo's own rewrites bump the change counter. */
+	irg->last_combo_nr = irg->change_nr;
 }
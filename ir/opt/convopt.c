@@ -30,6 +30,7 @@
 #include "irnode_t.h"
 #include "iropt_t.h"
 #include "iroptimize.h"
+#include "pdeq.h"
 #include "tv.h"
 #include "util.h"
 #include "vrp.h"
@@ -241,10 +242,13 @@ static ir_node *conv_transform(ir_node *node, ir_mode *dest_mode)
 	return new_node;
 }
 
-static void conv_opt_walker(ir_node *node, void *data)
-{
-	bool *const changed = (bool*)data;
+typedef struct conv_opt_env_t {
+	deq_t worklist; /**< Conv nodes left to look at */
+	bool  changed;
+} conv_opt_env_t;
 
+static void conv_opt_node(ir_node *const node, conv_opt_env_t *const env)
+{
 	if (!is_Conv(node))
 		return;
 
@@ -269,10 +273,27 @@ static void conv_opt_walker(ir_node *node, void *data)
 	ir_node *const transformed = conv_transform(pred, mode);
 	if (node != transformed) {
 		exchange(node, transformed);
-		*changed = true;
+		env->changed = true;
+
+		/* The replacement may enable further conversion optimizations at
+		 * the Convs around it: revisit those instead of the whole graph. */
+		if (is_Conv(transformed))
+			deq_push_pointer_right(&env->worklist, transformed);
+		foreach_out_edge(transformed, edge) {
+			ir_node *const user = get_edge_src_irn(edge);
+			if (is_Conv(user))
+				deq_push_pointer_right(&env->worklist, user);
+		}
 	}
 }
 
+static void conv_opt_collect(ir_node *node, void *data)
+{
+	conv_opt_env_t *const env = (conv_opt_env_t*)data;
+	if (is_Conv(node))
+		deq_push_pointer_right(&env->worklist, node);
+}
+
 void conv_opt(ir_graph *irg)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.opt.conv");
@@ -281,16 +302,22 @@ void conv_opt(ir_graph *irg)
 
 	DB((dbg, LEVEL_1, "===> Performing conversion optimization on %+F\n", irg));
 
-	bool global_changed = false;
-	bool changed;
-	do {
-		changed = false;
-		irg_walk_graph(irg, NULL, conv_opt_walker, &changed);
-		if (changed)
-			local_optimize_graph(irg);
-		global_changed |= changed;
-	} while (changed);
+	conv_opt_env_t env;
+	env.changed = false;
+	deq_init(&env.worklist);
+	irg_walk_graph(irg, NULL, conv_opt_collect, &env);
+
+	while (!deq_empty(&env.worklist)) {
+		ir_node *const node = deq_pop_pointer_left(ir_node, &env.worklist);
+		if (is_Deleted(node))
+			continue;
+		conv_opt_node(node, &env);
+	}
+	deq_free(&env.worklist);
+
+	if (env.changed)
+		local_optimize_graph(irg);
 
 	confirm_irg_properties(irg,
-		global_changed ? IR_GRAPH_PROPERTIES_NONE : IR_GRAPH_PROPERTIES_ALL);
+		env.changed ? IR_GRAPH_PROPERTIES_NONE : IR_GRAPH_PROPERTIES_ALL);
 }
@@ -15,17 +15,25 @@
  * the old one.
  */
 #include "cgana.h"
+#include "irconsconfirm.h"
 #include "iredges_t.h"
 #include "irgraph_t.h"
 #include "irgwalk.h"
 #include "irhooks.h"
 #include "irnode_t.h"
+#include "irnodemap.h"
 #include "iropt_t.h"
 #include "iroptimize.h"
 #include "irouts.h"
 #include "irtools.h"
 #include "pmap.h"
 #include "vrp.h"
+#include <string.h>
+
+typedef struct copy_env_t {
+	ir_nodemap copies;       /**< maps old node indices to their copies */
+	bool       preserve_idx; /**< if set, copies take over the old indices */
+} copy_env_t;
 
 /**
  * Reroute the inputs of a node from nodes in the old graph to copied nodes in
@@ -33,46 +41,63 @@
  */
 static void rewire_inputs(ir_node *node, void *env)
 {
-	(void)env;
-	irn_rewire_inputs(node);
+	copy_env_t *cenv = (copy_env_t*)env;
+	irn_rewire_inputs_map(node, &cenv->copies);
 }
 
 static void copy_node_dce(ir_node *node, void *env)
 {
-	(void)env;
-	ir_node *new_node = exact_copy(node);
+	copy_env_t *cenv     = (copy_env_t*)env;
+	ir_node    *new_node = exact_copy(node);
 	/* preserve the node numbers for easier debugging */
 	new_node->node_nr = node->node_nr;
-	set_irn_link(node, new_node);
+	if (cenv->preserve_idx) {
+		/* Give the freshly allocated index back and take over the old
+		 * one, so index-keyed data stays valid across the copy. */
+		ir_graph *irg     = get_irn_irg(node);
+		unsigned  new_idx = new_node->node_idx;
+		assert(new_idx + 1 == irg->last_node_idx);
+		irg->idx_irn_map[new_idx] = NULL;
+		--irg->last_node_idx;
+
+		unsigned old_idx = node->node_idx;
+		new_node->node_idx         = old_idx;
+		irg->idx_irn_map[old_idx]  = new_node;
+	}
+	ir_nodemap_insert(&cenv->copies, node, new_node);
 }
 
 /**
  * Copies the graph reachable from the End node to the obstack
  * in irg. Then fixes the fields containing nodes of the graph.
  *
- * @param copy_node_nr  If non-zero, the node number will be copied
+ * The old-to-new mapping lives in an index-keyed nodemap, not in the
+ * link fields, so the old nodes stay untouched and no link resource is
+ * needed.
  */
-static void copy_graph_env(ir_graph *irg)
+static void copy_graph_env(ir_graph *irg, bool preserve_idx)
 {
-	/* copy nodes */
+	copy_env_t env;
+	env.preserve_idx = preserve_idx;
+	ir_nodemap_init(&env.copies, irg);
+
+	/* Copy the nodes post-order, so operands land in the new arena before
+	 * their users and walks over the compacted graph touch memory roughly
+	 * in traversal order. Rewiring needs a second walk: at copy time the
+	 * copies of predecessors on cycles do not exist yet. */
 	ir_node *anchor = irg->anchor;
-	irg_walk_in_or_dep(anchor, copy_node_dce, rewire_inputs, NULL);
+	irg_walk_in_or_dep(anchor, NULL, copy_node_dce, &env);
+	irg_walk_in_or_dep(anchor, rewire_inputs, NULL, &env);
 
 	/* fix the anchor */
-	ir_node *new_anchor = (ir_node*)get_irn_link(anchor);
+	ir_node *new_anchor = ir_nodemap_get(ir_node, &env.copies, anchor);
 	assert(new_anchor != NULL);
 	irg->anchor = new_anchor;
+
+	ir_nodemap_destroy(&env.copies);
 }
 
-/**
- * Copies all reachable nodes to a new obstack.  Removes bad inputs
- * from block nodes and the corresponding inputs from Phi nodes.
- * Merges single exit blocks with single entry blocks and removes
- * 1-input Phis.
- * Adds all new nodes to a new hash table for CSE.  Does not
- * perform CSE, so the hash table might contain common subexpressions.
- */
-void dead_node_elimination(ir_graph *irg)
+void ir_compact_graph(ir_graph *irg, int preserve_node_idx)
 {
 	edges_deactivate(irg);
 
@@ -81,6 +106,7 @@ void dead_node_elimination(ir_graph *irg)
 	free_irg_outs(irg);
 	free_loop_information(irg);
 	free_vrp_data(irg);
+	free_value_facts(irg);
 	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 
 	/* A quiet place, where the old obstack can rest in peace,
@@ -88,17 +114,36 @@ void dead_node_elimination(ir_graph *irg)
 	struct obstack graveyard_obst = irg->obst;
 
 	/* A new obstack, where the reachable nodes will be copied to. */
-	obstack_init(&irg->obst);
-	irg->last_node_idx = 0;
+	irg_init_obstack(irg);
+	if (preserve_node_idx) {
+		/* The entries for dead indices must not dangle into the
+		 * graveyard; the live ones are filled in again by the copy. */
+		memset(irg->idx_irn_map, 0,
+		       ARR_LEN(irg->idx_irn_map) * sizeof(irg->idx_irn_map[0]));
+	} else {
+		irg->last_node_idx = 0;
+	}
 
 	/* We also need a new value table for CSE */
 	new_identities(irg);
 
 	/* Copy the graph from the old to the new obstack */
-	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
-	copy_graph_env(irg);
-	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+	copy_graph_env(irg, preserve_node_idx != 0);
 
-	/* Free memory from old unoptimized obstack */
+	/* Free memory from old unoptimized obstack: the chunks end up in the
+	 * graph's chunk cache and are reused as the new arena grows. */
 	obstack_free(&graveyard_obst, 0);  /* First empty the obstack ... */
 }
+
+/**
+ * Copies all reachable nodes to a new obstack.  Removes bad inputs
+ * from block nodes and the corresponding inputs from Phi nodes.
+ * Merges single exit blocks with single entry blocks and removes
+ * 1-input Phis.
+ * Adds all new nodes to a new hash table for CSE.  Does not
+ * perform CSE, so the hash table might contain common subexpressions.
+ */
+void dead_node_elimination(ir_graph *irg)
+{
+	ir_compact_graph(irg, 0);
+}
@@ -0,0 +1,336 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Devirtualization of polymorphic calls using the class hierarchy.
+ *
+ * A dynamic dispatch is represented as a Call through a Member on a
+ * method entity. The subtype graph computed by tr_inheritance tells us
+ * which implementations such a dispatch can reach: the entity itself and
+ * everything that transitively overwrites it. If exactly one
+ * implementation remains, the Member is replaced by the Address of that
+ * implementation and the call becomes direct. If exactly two remain, the
+ * call is expanded into a test of the dispatched address against the
+ * first implementation with a direct call on either branch, so both
+ * targets become visible to the inliner.
+ *
+ * Like the callee analysis in cgana, the type graph is trusted to
+ * describe all overriding implementations of the program: entities
+ * without an ir_graph contribute no implementation.
+ *
+ * The same guarded expansion serves opt_guarded_calls(): an indirect
+ * call whose callee analysis names exactly one internal target besides
+ * the unknown fallback is split into a guarded direct call to that
+ * target with the original indirect call as slow path, so the inliner
+ * can speculate on the dominant target of hot dispatch loops.
+ */
+#include "array.h"
+#include "cgana.h"
+#include "debug.h"
+#include "execfreq.h"
+#include "ircons.h"
+#include "irgmod.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "iroptimize.h"
+#include "irprofile.h"
+#include "irprog_t.h"
+#include "typerep.h"
+#include "util.h"
+#include <stdbool.h>
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+typedef struct devirt_env_t {
+	ir_node **speculative; /**< Calls with exactly two implementations */
+	bool      changed;
+} devirt_env_t;
+
+/**
+ * Collects up to @p max implementations the dispatch on @p entity can
+ * reach. Returns the number found, or max + 1 if there are more.
+ */
+static size_t collect_impls(ir_entity *const entity, ir_entity **const impls,
+                            size_t const max)
+{
+	size_t n = 0;
+	if (get_entity_irg(entity) != NULL)
+		impls[n++] = entity;
+	for (ir_entity *ov = get_entity_trans_overwrittenby_first(entity);
+	     ov != NULL; ov = get_entity_trans_overwrittenby_next(entity)) {
+		if (get_entity_irg(ov) == NULL)
+			continue;
+		if (n >= max)
+			return max + 1;
+		impls[n++] = ov;
+	}
+	return n;
+}
+
+/**
+ * Returns true if the call can be expanded into a dispatch test with
+ * two direct calls: result values must be mergeable by Phis and the
+ * control flow of an exception edge would not survive the expansion.
+ */
+static bool call_is_speculatable(ir_node const *const call)
+{
+	if (ir_throws_exception(call))
+		return false;
+	ir_type *const tp = get_Call_type(call);
+	for (size_t i = 0, n_res = get_method_n_ress(tp); i < n_res; ++i) {
+		if (get_type_mode(get_method_res_type(tp, i)) == NULL)
+			return false;
+	}
+	return true;
+}
+
+static void devirt_walker(ir_node *const node, void *const data)
+{
+	devirt_env_t *const env = (devirt_env_t*)data;
+
+	if (is_Member(node)) {
+		ir_entity *const entity = get_Member_entity(node);
+		if (!is_method_entity(entity))
+			return;
+		ir_entity *impls[2];
+		if (collect_impls(entity, impls, 2) != 1)
+			return;
+		/* unique implementation: the dispatch always yields its address */
+		ir_graph *const irg = get_irn_irg(node);
+		DB((dbg, LEVEL_2, "unique implementation %+F for %+F\n", impls[0],
+		    node));
+		exchange(node, new_r_Address(irg, impls[0]));
+		env->changed = true;
+	} else if (is_Call(node)) {
+		ir_node *const ptr = get_Call_ptr(node);
+		if (!is_Member(ptr))
+			return;
+		ir_entity *const entity = get_Member_entity(ptr);
+		if (!is_method_entity(entity))
+			return;
+		ir_entity *impls[2];
+		if (collect_impls(entity, impls, 2) != 2)
+			return;
+		if (!call_is_speculatable(node))
+			return;
+		ARR_APP1(ir_node*, env->speculative, node);
+	}
+}
+
+/**
+ * Expands the call into
+ *     if (ptr == &fast) fast(...) else (*slow_ptr)(...)
+ * The fast branch calls its target directly, so the inliner can look at
+ * it; the slow branch calls through @p slow_ptr, which is either the
+ * second implementation's Address or the original call pointer.
+ */
+static void expand_guarded_call(ir_node *const call, ir_entity *const fast,
+                                ir_node *const slow_ptr)
+{
+	ir_graph *const irg      = get_irn_irg(call);
+	ir_node  *const ptr      = get_Call_ptr(call);
+	ir_type  *const tp       = get_Call_type(call);
+	ir_node  *const mem      = get_Call_mem(call);
+	int       const n_params = get_Call_n_params(call);
+
+	DB((dbg, LEVEL_2, "guarded expansion of %+F for %+F\n", call, fast));
+
+	ir_node **const params = ALLOCAN(ir_node*, n_params);
+	for (int i = 0; i < n_params; ++i)
+		params[i] = get_Call_param(call, i);
+
+	/* Split the block so the dispatch test can branch over the two
+	 * specialized calls; the Tuple makes part_block() move every input
+	 * of the Call into the upper block. */
+	ir_node  *const block  = get_nodes_block(call);
+	ir_node **const pre_in = ALLOCAN(ir_node*, n_params + 2);
+	pre_in[0] = mem;
+	pre_in[1] = ptr;
+	for (int i = 0; i < n_params; ++i)
+		pre_in[i + 2] = params[i];
+	ir_node *const pre = new_r_Tuple(block, n_params + 2, pre_in);
+	part_block(pre);
+	ir_node *const upper = get_nodes_block(pre);
+
+	ir_node *const addr0  = new_r_Address(irg, fast);
+	ir_node *const cmp    = new_r_Cmp(upper, ptr, addr0,
+	                                  ir_relation_equal);
+	ir_node *const cond   = new_r_Cond(upper, cmp);
+	ir_node *const proj_t = new_r_Proj(cond, mode_X, pn_Cond_true);
+	ir_node *const proj_f = new_r_Proj(cond, mode_X, pn_Cond_false);
+
+	ir_node *const block_t = new_r_Block(irg, 1, &proj_t);
+	ir_node *const call_t  = new_r_Call(block_t, mem, addr0, n_params,
+	                                    params, tp);
+	ir_node *const jmp_t   = new_r_Jmp(block_t);
+	ir_node *const block_f = new_r_Block(irg, 1, &proj_f);
+	ir_node *const call_f  = new_r_Call(block_f, mem, slow_ptr, n_params,
+	                                    params, tp);
+	ir_node *const jmp_f   = new_r_Jmp(block_f);
+
+	/* the lower block joins the two variants */
+	ir_node *lower_in[] = { jmp_t, jmp_f };
+	set_irn_in(block, ARRAY_SIZE(lower_in), lower_in);
+
+	ir_node *mem_in[] = { new_r_Proj(call_t, mode_M, pn_Call_M),
+	                      new_r_Proj(call_f, mode_M, pn_Call_M) };
+	ir_node *const mem_phi = new_r_Phi(block, ARRAY_SIZE(mem_in), mem_in,
+	                                   mode_M);
+
+	size_t const n_res     = get_method_n_ress(tp);
+	ir_node     *res_tuple = new_r_Bad(irg, mode_T);
+	if (n_res > 0) {
+		ir_node  *const res_t = new_r_Proj(call_t, mode_T, pn_Call_T_result);
+		ir_node  *const res_f = new_r_Proj(call_f, mode_T, pn_Call_T_result);
+		ir_node **const phis  = ALLOCAN(ir_node*, n_res);
+		for (size_t i = 0; i < n_res; ++i) {
+			ir_mode *const mode = get_type_mode(get_method_res_type(tp, i));
+			ir_node *res_in[] = { new_r_Proj(res_t, mode, i),
+			                      new_r_Proj(res_f, mode, i) };
+			phis[i] = new_r_Phi(block, ARRAY_SIZE(res_in), res_in, mode);
+		}
+		res_tuple = new_r_Tuple(block, n_res, phis);
+	}
+
+	ir_node *tuple_in[] = { mem_phi, res_tuple };
+	assert(pn_Call_M == 0 && pn_Call_T_result == 1);
+	turn_into_tuple(call, ARRAY_SIZE(tuple_in), tuple_in);
+}
+
+void devirtualize_calls(void)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.devirt");
+
+	compute_inh_transitive_closure();
+
+	foreach_irp_irg(i, irg) {
+		devirt_env_t env;
+		env.changed     = false;
+		env.speculative = NEW_ARR_F(ir_node*, 0);
+		irg_walk_graph(irg, NULL, devirt_walker, &env);
+
+		if (ARR_LEN(env.speculative) > 0) {
+			ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK
+			                     | IR_RESOURCE_PHI_LIST);
+			for (size_t j = 0, n = ARR_LEN(env.speculative); j < n; ++j) {
+				ir_node *const call = env.speculative[j];
+				ir_entity *impls[2];
+				size_t const n_impls
+					= collect_impls(get_Member_entity(get_Call_ptr(call)),
+					                impls, 2);
+				assert(n_impls == 2);
+				(void)n_impls;
+				/* part_block() needs the Phi and Proj lists, which the
+				 * previous expansion invalidated */
+				collect_phiprojs_and_start_block_nodes(irg);
+				expand_guarded_call(call, impls[0],
+				                    new_r_Address(irg, impls[1]));
+			}
+			ir_free_resources(irg, IR_RESOURCE_IRN_LINK
+			                  | IR_RESOURCE_PHI_LIST);
+			env.changed = true;
+		}
+		DEL_ARR_F(env.speculative);
+
+		if (env.changed) {
+			if (get_irg_callee_info_state(irg) != irg_callee_info_none)
+				set_irg_callee_info_state(irg, irg_callee_info_inconsistent);
+			confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
+		} else {
+			confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+		}
+	}
+
+	free_inh_transitive_closure();
+}
+
+/**
+ * Walker collecting hot indirect calls whose callee analysis names
+ * exactly one internal target besides the unknown fallback.
+ */
+static void guarded_call_walker(ir_node *const node, void *const data)
+{
+	devirt_env_t *const env = (devirt_env_t*)data;
+	if (!is_Call(node))
+		return;
+	ir_node *const ptr = get_Call_ptr(node);
+	/* direct calls and class dispatch are handled elsewhere */
+	if (is_Address(ptr) || is_Member(ptr))
+		return;
+	if (!cg_call_has_callees(node))
+		return;
+
+	size_t const n_callees = cg_get_call_n_callees(node);
+	if (n_callees == 1) {
+		/* the pointer provably computes this one target */
+		ir_entity *const callee = cg_get_call_callee(node, 0);
+		if (!is_unknown_entity(callee)) {
+			DB((dbg, LEVEL_2, "sole callee %+F for %+F\n", callee, node));
+			set_Call_ptr(node, new_r_Address(get_irn_irg(node), callee));
+			env->changed = true;
+		}
+		return;
+	}
+	if (n_callees != 2)
+		return;
+	/* cgana keeps the unknown entity on position zero */
+	if (!is_unknown_entity(cg_get_call_callee(node, 0)))
+		return;
+	ir_entity *const fast = cg_get_call_callee(node, 1);
+	if (is_unknown_entity(fast) || get_entity_irg(fast) == NULL)
+		return;
+	if (!call_is_speculatable(node))
+		return;
+	/* the guard only pays off where the dispatch is hot */
+	ir_graph *const irg = get_irn_irg(node);
+	if (get_block_execfreq(get_nodes_block(node))
+	    < get_block_execfreq(get_irg_start_block(irg)))
+		return;
+	ARR_APP1(ir_node*, env->speculative, node);
+}
+
+void opt_guarded_calls(ir_graph *const irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.devirt");
+
+	if (get_irg_callee_info_state(irg) != irg_callee_info_consistent) {
+		DB((dbg, LEVEL_1, "%+F: no consistent callee info, skip\n", irg));
+		return;
+	}
+	/* block frequencies decide which dispatches are worth a guard */
+	if (ir_profile_has_data()) {
+		ir_create_execfreqs_from_profile();
+	} else {
+		ir_estimate_execfreq(irg);
+	}
+
+	devirt_env_t env;
+	env.changed     = false;
+	env.speculative = NEW_ARR_F(ir_node*, 0);
+	irg_walk_graph(irg, NULL, guarded_call_walker, &env);
+
+	if (ARR_LEN(env.speculative) > 0) {
+		ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK
+		                     | IR_RESOURCE_PHI_LIST);
+		for (size_t i = 0, n = ARR_LEN(env.speculative); i < n; ++i) {
+			ir_node *const call = env.speculative[i];
+			ir_entity *const fast = cg_get_call_callee(call, 1);
+			collect_phiprojs_and_start_block_nodes(irg);
+			expand_guarded_call(call, fast, get_Call_ptr(call));
+		}
+		ir_free_resources(irg, IR_RESOURCE_IRN_LINK
+		                  | IR_RESOURCE_PHI_LIST);
+		env.changed = true;
+	}
+	DEL_ARR_F(env.speculative);
+
+	if (env.changed) {
+		set_irg_callee_info_state(irg, irg_callee_info_inconsistent);
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
+	} else {
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+	}
+}
@@ -0,0 +1,251 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Escape analysis turning non-escaping heap allocations into
+ *          frame allocations.
+ *
+ * A call to malloc() whose result pointer provably never leaves the
+ * current function can be replaced by the address of a fresh frame
+ * entity; the matching free() calls become no-ops.  The accesses then
+ * hit local stack memory, which is cheaper than the allocator and
+ * visible to the other local memory optimizations.
+ */
+#include "array.h"
+#include "debug.h"
+#include "ircons.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "irnodeset.h"
+#include "iroptimize.h"
+#include "scalar_replace.h"
+#include "type_t.h"
+#include "util.h"
+#include "xmalloc.h"
+#include <string.h>
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+/** Maximum allocation size in bytes that is moved to the frame.  Larger
+ * blocks stay on the heap to keep stack usage bounded. */
+#define MAX_PROMOTED_SIZE 1024
+
+typedef struct alloc_candidate_t {
+	ir_node  *call;   /**< the malloc() call */
+	unsigned  size;   /**< allocation size in bytes */
+	ir_node **frees;  /**< ARR_F of free() calls on the pointer */
+} alloc_candidate_t;
+
+typedef struct walk_env_t {
+	ir_node **calls;  /**< ARR_F of collected malloc() calls */
+} walk_env_t;
+
+/**
+ * Checks whether @p call is a call to the given C runtime function.
+ * We must know the callee's complete semantics before removing the
+ * call, so we match the well-known names instead of relying on
+ * mtp_property_malloc, which permits reordering but not deletion.
+ */
+static bool is_runtime_call(const ir_node *call, const char *name)
+{
+	ir_entity *callee = get_Call_callee(call);
+	return callee != NULL
+	    && streq(get_entity_ld_name(callee), name);
+}
+
+/**
+ * Checks whether the pointer produced by the candidate call escapes the
+ * current function.  Address arithmetic is followed through the out
+ * edges; a pointer escapes as soon as it is stored as a value, passed
+ * to a call other than free(), returned or used in any way we do not
+ * understand.  Matching free() calls are collected on the fly.
+ */
+static bool ptr_escapes(alloc_candidate_t *cand, ir_node *ptr)
+{
+	bool          escapes = false;
+	ir_nodeset_t  visited;
+	ir_node     **queue   = NEW_ARR_F(ir_node*, 0);
+
+	ir_nodeset_init(&visited);
+	ARR_APP1(ir_node*, queue, ptr);
+	ir_nodeset_insert(&visited, ptr);
+
+	while (!escapes && ARR_LEN(queue) > 0) {
+		ir_node *node = queue[ARR_LEN(queue) - 1];
+		ARR_SHRINKLEN(queue, ARR_LEN(queue) - 1);
+
+		foreach_out_edge(node, edge) {
+			ir_node *user = get_edge_src_irn(edge);
+
+			if (is_Load(user)) {
+				/* reading through the pointer is fine */
+				continue;
+			} else if (is_Store(user)) {
+				/* storing through the pointer is fine, storing the
+				 * pointer itself makes it reachable from memory */
+				if (get_Store_value(user) == node) {
+					escapes = true;
+					break;
+				}
+				continue;
+			} else if (is_Call(user)) {
+				/* the matching deallocation of the unmodified pointer
+				 * is the only call the pointer may reach */
+				if (node == ptr && is_runtime_call(user, "free")
+				    && get_Call_n_params(user) == 1
+				    && get_Call_param(user, 0) == node
+				    && !ir_throws_exception(user)) {
+					ARR_APP1(ir_node*, cand->frees, user);
+					continue;
+				}
+				escapes = true;
+				break;
+			} else if (is_Cmp(user)) {
+				/* comparisons (including the NULL check) do not leak
+				 * the pointer */
+				continue;
+			} else if (is_Add(user) || is_Sub(user) || is_Member(user)
+			        || is_Sel(user) || is_Conv(user)) {
+				/* derived pointers must be tracked as well */
+				if (!mode_is_reference(get_irn_mode(user))) {
+					escapes = true;
+					break;
+				}
+				if (ir_nodeset_insert(&visited, user))
+					ARR_APP1(ir_node*, queue, user);
+				continue;
+			}
+			/* Phi, Mux, Return, ... are treated conservatively */
+			escapes = true;
+			break;
+		}
+	}
+
+	DEL_ARR_F(queue);
+	ir_nodeset_destroy(&visited);
+	return escapes;
+}
+
+/**
+ * Replaces the candidate call by the address of a new frame entity and
+ * turns the collected free() calls into no-ops.
+ */
+static void promote_allocation(alloc_candidate_t *cand)
+{
+	ir_node   *call       = cand->call;
+	ir_graph  *irg        = get_irn_irg(call);
+	ir_node   *block      = get_nodes_block(call);
+	ir_type   *frame_type = get_irg_frame_type(irg);
+	ident     *name       = new_id_fmt("stackalloc%ld", get_irn_node_nr(call));
+	ir_type   *byte_type  = get_type_for_mode(mode_Bu);
+	ir_type   *array_type = new_type_array(byte_type, cand->size);
+	ir_entity *entity     = new_entity(frame_type, name, array_type);
+	/* malloc'ed memory is suitably aligned for any object type */
+	set_entity_alignment(entity, 2 * get_mode_size_bytes(mode_P));
+
+	ir_node *frame  = get_irg_frame(irg);
+	ir_node *member = new_r_Member(block, frame, entity);
+	ir_node *rest   = new_r_Tuple(block, 1, &member);
+	ir_node *const in[] = {
+		[pn_Call_M]        = get_Call_mem(call),
+		[pn_Call_T_result] = rest,
+	};
+	turn_into_tuple(call, ARRAY_SIZE(in), in);
+
+	for (size_t i = 0, n = ARR_LEN(cand->frees); i < n; ++i) {
+		ir_node *free_call  = cand->frees[i];
+		ir_node *free_block = get_nodes_block(free_call);
+		ir_node *const free_in[] = {
+			[pn_Call_M]        = get_Call_mem(free_call),
+			[pn_Call_T_result] = new_r_Tuple(free_block, 0, NULL),
+		};
+		turn_into_tuple(free_call, ARRAY_SIZE(free_in), free_in);
+	}
+
+	DB((dbg, LEVEL_1, "promoted %+F (%u bytes) to frame entity %+F\n",
+	    call, cand->size, entity));
+}
+
+/**
+ * Post-walker: collects all promising malloc() calls.
+ */
+static void collect_mallocs(ir_node *node, void *data)
+{
+	walk_env_t *env = (walk_env_t*)data;
+	if (!is_Call(node) || !is_runtime_call(node, "malloc")
+	    || get_Call_n_params(node) != 1 || ir_throws_exception(node))
+		return;
+	ARR_APP1(ir_node*, env->calls, node);
+}
+
+/**
+ * Analyzes one collected call and promotes it if the allocated block
+ * has a known small size and the pointer does not escape.
+ *
+ * @return true if the graph was changed
+ */
+static bool try_promote(ir_node *call)
+{
+	ir_node *size = get_Call_param(call, 0);
+	if (!is_Const(size))
+		return false;
+	ir_tarval *tv = get_Const_tarval(size);
+	if (!tarval_is_long(tv))
+		return false;
+	long bytes = get_tarval_long(tv);
+	if (bytes <= 0 || bytes > MAX_PROMOTED_SIZE)
+		return false;
+
+	/* find the result pointer; an unused result still allows removal */
+	ir_node *res = NULL;
+	foreach_out_edge(call, edge) {
+		ir_node *proj = get_edge_src_irn(edge);
+		if (!is_Proj(proj) || get_Proj_num(proj) != pn_Call_T_result)
+			continue;
+		foreach_out_edge(proj, res_edge) {
+			ir_node *user = get_edge_src_irn(res_edge);
+			if (!is_Proj(user))
+				return false;
+			if (res != NULL && res != user)
+				return false;
+			res = user;
+		}
+	}
+
+	alloc_candidate_t cand = { .call = call, .size = (unsigned)bytes };
+	cand.frees = NEW_ARR_F(ir_node*, 0);
+	bool escapes = res != NULL && ptr_escapes(&cand, res);
+	if (!escapes)
+		promote_allocation(&cand);
+	DEL_ARR_F(cand.frees);
+	return !escapes;
+}
+
+void opt_escape_analysis(ir_graph *irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.escape_ana");
+
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
+
+	walk_env_t env = { .calls = NEW_ARR_F(ir_node*, 0) };
+	irg_walk_graph(irg, NULL, collect_mallocs, &env);
+
+	bool changed = false;
+	for (size_t i = 0, n = ARR_LEN(env.calls); i < n; ++i) {
+		changed |= try_promote(env.calls[i]);
+	}
+	DEL_ARR_F(env.calls);
+
+	confirm_irg_properties(irg, changed ? IR_GRAPH_PROPERTIES_CONTROL_FLOW
+	                                    : IR_GRAPH_PROPERTIES_ALL);
+
+	/* the new frame entities are fresh fodder for scalar replacement */
+	if (changed)
+		scalar_replacement_opt(irg);
+}
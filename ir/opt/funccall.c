@@ -349,9 +349,14 @@ static mtp_additional_properties follow_mem(ir_node *node,
 			case ir_bk_bswap:
 			case ir_bk_saturating_increment:
 			case ir_bk_may_alias:
+			case ir_bk_add_overflow:
+			case ir_bk_sub_overflow:
+			case ir_bk_mul_overflow:
 				/* just arithmetic/no semantic change => no problem */
 				continue;
 			case ir_bk_compare_swap:
+			case ir_bk_atomic_exchange:
+			case ir_bk_atomic_fetch_add:
 				/* write access */
 				max_prop &= ~(mtp_property_pure | mtp_property_no_write);
 				break;
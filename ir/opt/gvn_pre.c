@@ -71,6 +71,7 @@ typedef struct block_info {
 	ir_node           *avail;      /* saves available node for insert node phase */
 	int                found;      /* saves kind of availability for insert_node phase */
 	ir_node           *block;      /* block of the block_info */
+	char               antic_dirty; /* antic_in of a successor changed since the last visit */
 	struct block_info *next;       /* links all instances for easy access */
 } block_info;
 
@@ -100,8 +101,8 @@ typedef struct pre_env {
 	char            first_iter;   /* non-zero for first fixed point iteration */
 	int             iteration;    /* iteration counter */
 #if OPTIMIZE_NODES
-	pset           *value_table;   /* standard value table*/
-	pset           *gvnpre_values; /* GVN-PRE value table */
+	ir_identityset_t *value_table;   /* standard value table*/
+	ir_identityset_t *gvnpre_values; /* GVN-PRE value table */
 #endif
 } pre_env;
 
@@ -395,10 +396,11 @@ static void alloc_block_info(ir_node *block, pre_env *env)
 	info->trans = XMALLOC(ir_nodehashmap_t);
 	ir_nodehashmap_init(info->trans);
 
-	info->new_set = NULL;
-	info->avail   = NULL;
-	info->block   = block;
-	info->found   = 1;
+	info->new_set     = NULL;
+	info->avail       = NULL;
+	info->block       = block;
+	info->found       = 1;
+	info->antic_dirty = 1;
 
 	info->next = env->list;
 	env->list  = info;
@@ -898,6 +900,13 @@ static void compute_antic(ir_node *block, void *ctx)
 		return;
 
 	block_info *info = get_block_info(block);
+
+	/* worklist-style iteration: nothing can change unless the antic_in
+	 * of a successor (or our own) changed since the last visit */
+	if (!env->first_iter && !info->antic_dirty)
+		return;
+	info->antic_dirty = 0;
+
 	/* track changes */
 	size_t size   = ir_valueset_size(info->antic_in);
 	int    n_succ = get_Block_n_cfg_outs(block);
@@ -986,8 +995,17 @@ static void compute_antic(ir_node *block, void *ctx)
 
 	DEBUG_ONLY(dump_value_set(info->antic_in, "Antic_in", block);)
 
-	if (size != ir_valueset_size(info->antic_in))
+	if (size != ir_valueset_size(info->antic_in)) {
 		env->changes |= 1;
+		/* a grown antic_in can make more of our own expressions clean */
+		info->antic_dirty = 1;
+		/* the predecessors read our antic_in and must be revisited */
+		for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+			ir_node *const pred_block = get_Block_cfgpred_block(block, i);
+			if (pred_block != NULL)
+				get_block_info(pred_block)->antic_dirty = 1;
+		}
+	}
 }
 
 /* --------------------------------------------------------
@@ -1837,10 +1855,10 @@ void do_gvn_pre(ir_graph *irg)
 	   its block. */
 	set_opt_global_cse(1);
 	/* new_identities() */
-	if (irg->value_table != NULL)
-		del_pset(irg->value_table);
-	/* initially assumed nodes in pset are 512 */
-	irg->value_table = new_pset(compare_gvn_identities, 512);
+	del_identities(irg);
+	/* initially assumed number of nodes is 512 */
+	irg->value_table = XMALLOC(ir_identityset_t);
+	ir_identityset_init(irg->value_table, compare_gvn_identities, 512);
 #if OPTIMIZE_NODES
 	env.gvnpre_values = irg->value_table;
 #endif
@@ -1867,7 +1885,7 @@ void do_gvn_pre(ir_graph *irg)
 
 #if OPTIMIZE_NODES
 	irg->value_table = env.value_table;
-	del_pset(irg->value_table);
+	del_identities(irg);
 	irg->value_table = env.gvnpre_values;
 #endif
 
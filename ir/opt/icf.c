@@ -0,0 +1,206 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Identical code folding: merge functions with isomorphic graphs.
+ *
+ * Template expansion and similar frontend mechanisms produce many
+ * functions whose graphs only differ in node numbers. This pass buckets
+ * all graphs by a structural fingerprint, verifies candidates pairwise
+ * by walking both graphs in lockstep, and folds proven duplicates: the
+ * duplicate loses its graph and its entity becomes an alias for the
+ * kept body, so every reference through its symbol keeps working.
+ * Methods whose address escapes are left alone because folding them
+ * would make distinct function pointers compare equal.
+ */
+#include "cgana.h"
+#include "debug.h"
+#include "entity_t.h"
+#include "hashptr.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "irop_t.h"
+#include "iroptimize.h"
+#include "irprog_t.h"
+#include "irtools.h"
+#include "pset.h"
+#include "typerep.h"
+#include "xmalloc.h"
+#include <stdbool.h>
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+typedef struct candidate_t {
+	ir_graph *irg;
+	unsigned  hash;
+	bool      merged;
+} candidate_t;
+
+/**
+ * Accumulates a structural fingerprint of a graph. Only properties that
+ * are stable across isomorphic graphs may enter the hash, so node
+ * attributes and predecessor identities stay out; collisions are sorted
+ * out by the pairwise verification.
+ */
+static void fingerprint_walker(ir_node *node, void *data)
+{
+	unsigned *hash = (unsigned*)data;
+	*hash = 9 * *hash + get_irn_opcode(node);
+	*hash = 9 * *hash + hash_ptr(get_irn_mode(node));
+	*hash = 9 * *hash + (unsigned)get_irn_arity(node);
+}
+
+/**
+ * Checks whether two method types describe the same interface to the
+ * backend. The type objects themselves are usually distinct, so compare
+ * the properties that influence calling convention and parameter
+ * passing instead.
+ */
+static bool method_types_compatible(ir_type *const tp_a, ir_type *const tp_b)
+{
+	if (tp_a == tp_b)
+		return true;
+	if (get_method_calling_convention(tp_a)
+	    != get_method_calling_convention(tp_b)
+	 || is_method_variadic(tp_a) != is_method_variadic(tp_b)
+	 || get_method_additional_properties(tp_a)
+	    != get_method_additional_properties(tp_b))
+		return false;
+	size_t const n_params = get_method_n_params(tp_a);
+	size_t const n_ress   = get_method_n_ress(tp_a);
+	if (n_params != get_method_n_params(tp_b)
+	 || n_ress != get_method_n_ress(tp_b))
+		return false;
+	for (size_t p = 0; p < n_params; ++p) {
+		ir_type *const param_a = get_method_param_type(tp_a, p);
+		ir_type *const param_b = get_method_param_type(tp_b, p);
+		if (param_a != param_b
+		 && (get_type_mode(param_a) == NULL
+		  || get_type_mode(param_a) != get_type_mode(param_b)))
+			return false;
+	}
+	for (size_t r = 0; r < n_ress; ++r) {
+		ir_type *const res_a = get_method_res_type(tp_a, r);
+		ir_type *const res_b = get_method_res_type(tp_b, r);
+		if (res_a != res_b
+		 && (get_type_mode(res_a) == NULL
+		  || get_type_mode(res_a) != get_type_mode(res_b)))
+			return false;
+	}
+	return true;
+}
+
+/**
+ * Extends the correspondence between two graphs by the pair (a, b) and
+ * recursively by their predecessors. The mapping is kept in the links
+ * of both graphs: link(a) == b and link(b) == a. A node already mapped
+ * to a different partner proves the graphs non-isomorphic.
+ */
+static bool nodes_isomorphic(ir_node *const a, ir_node *const b)
+{
+	if (get_irn_link(a) != NULL || get_irn_link(b) != NULL)
+		return get_irn_link(a) == b && get_irn_link(b) == a;
+	if (get_irn_op(a) != get_irn_op(b)
+	 || get_irn_mode(a) != get_irn_mode(b))
+		return false;
+	int const arity = get_irn_arity(a);
+	if (arity != get_irn_arity(b))
+		return false;
+	if (!a->op->ops.attrs_equal(a, b))
+		return false;
+	set_irn_link(a, b);
+	set_irn_link(b, a);
+	if (!is_Block(a)
+	 && !nodes_isomorphic(get_nodes_block(a), get_nodes_block(b)))
+		return false;
+	for (int i = 0; i < arity; ++i) {
+		if (!nodes_isomorphic(get_irn_n(a, i), get_irn_n(b, i)))
+			return false;
+	}
+	return true;
+}
+
+static bool graphs_isomorphic(ir_graph *const irg_a, ir_graph *const irg_b)
+{
+	ir_reserve_resources(irg_a, IR_RESOURCE_IRN_LINK);
+	ir_reserve_resources(irg_b, IR_RESOURCE_IRN_LINK);
+	irg_walk_graph(irg_a, firm_clear_link, NULL, NULL);
+	irg_walk_graph(irg_b, firm_clear_link, NULL, NULL);
+	bool const result = nodes_isomorphic(get_irg_end(irg_a),
+	                                     get_irg_end(irg_b));
+	ir_free_resources(irg_b, IR_RESOURCE_IRN_LINK);
+	ir_free_resources(irg_a, IR_RESOURCE_IRN_LINK);
+	return result;
+}
+
+void merge_identical_functions(void)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.icf");
+
+	/* the free methods are exactly those whose address may be observed;
+	 * keep their bodies so distinct pointers stay distinct */
+	ir_entity **free_methods;
+	size_t const n_free = cgana(&free_methods);
+	pset *const free_set = pset_new_ptr(n_free > 0 ? n_free : 1);
+	for (size_t i = 0; i < n_free; ++i)
+		pset_insert_ptr(free_set, free_methods[i]);
+	free(free_methods);
+
+	size_t       n_candidates = 0;
+	candidate_t *candidates   = XMALLOCN(candidate_t, get_irp_n_irgs());
+	foreach_irp_irg(i, irg) {
+		ir_entity *const entity = get_irg_entity(irg);
+		if (pset_find_ptr(free_set, entity) != NULL)
+			continue;
+		/* a weak definition may be replaced by the linker; aliases for
+		 * class methods would not reach the global emitter */
+		if (get_entity_linkage(entity)
+		    & (IR_LINKAGE_WEAK | IR_LINKAGE_NO_CODEGEN))
+			continue;
+		if (get_entity_owner(entity) != get_glob_type())
+			continue;
+		unsigned hash = 0;
+		irg_walk_graph(irg, fingerprint_walker, NULL, &hash);
+		candidates[n_candidates++] = (candidate_t) { irg, hash, false };
+	}
+	del_pset(free_set);
+
+	bool changed = false;
+	for (size_t i = 0; i < n_candidates; ++i) {
+		if (candidates[i].merged)
+			continue;
+		ir_graph  *const irg    = candidates[i].irg;
+		ir_entity *const entity = get_irg_entity(irg);
+		for (size_t j = i + 1; j < n_candidates; ++j) {
+			if (candidates[j].merged
+			 || candidates[j].hash != candidates[i].hash)
+				continue;
+			ir_graph  *const other_irg = candidates[j].irg;
+			ir_entity *const other     = get_irg_entity(other_irg);
+			if (!method_types_compatible(get_entity_type(entity),
+			                             get_entity_type(other)))
+				continue;
+			if (!graphs_isomorphic(irg, other_irg))
+				continue;
+
+			DB((dbg, LEVEL_1, "  merging %+F into %+F\n", other, entity));
+			/* drop the duplicate body and let the symbol survive as an
+			 * alias; the base attributes are shared between method and
+			 * alias entities and stay valid */
+			free_ir_graph(other_irg);
+			other->kind              = IR_ENTITY_ALIAS;
+			other->attr.alias.aliased = entity;
+			candidates[j].merged = true;
+			changed = true;
+		}
+	}
+	free(candidates);
+
+	/* the callee sets computed by cgana() may still name merged
+	 * entities which no longer carry a graph */
+	if (changed)
+		free_irp_callee_info();
+}
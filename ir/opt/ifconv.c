@@ -10,11 +10,14 @@
  */
 #include "cdep_t.h"
 #include "debug.h"
+#include "execfreq.h"
 #include "ircons.h"
 #include "irgmod.h"
 #include "irgopt.h"
 #include "irgwalk.h"
+#include "irmemory_t.h"
 #include "irnode_t.h"
+#include "irnodeset.h"
 #include "iroptimize.h"
 #include "irtools.h"
 #include "pdeq.h"
@@ -22,6 +25,10 @@
 #include <assert.h>
 #include <stdbool.h>
 
+/** Cycles a mispredicted branch costs on a typical pipeline. Converting
+ * a diamond must beat the expected misprediction cost of its branch. */
+#define MISPREDICT_COST 12.0
+
 /**
  * Environment for if-conversion.
  */
@@ -264,6 +271,127 @@ static void prepare_path(ir_node *block, int i, const ir_node *dependency)
 	}
 }
 
+/**
+ * Returns true if executing @p load speculatively cannot fault: its
+ * address is a constant offset into an object that is certainly mapped,
+ * i.e. a global, thread local or frame entity. Sels are rejected, a
+ * variable array index may point outside the object.
+ *
+ * Failing that, a pointer a dominating check proved non-null is also
+ * accepted. The Confirm establishing the fact is returned in @p guard
+ * then; the load must never be hoisted above its block.
+ */
+static bool is_speculable_Load(const ir_node *load, const ir_node **guard)
+{
+	*guard = NULL;
+	if (get_Load_volatility(load) == volatility_is_volatile)
+		return false;
+
+	ir_node *addr = get_Load_ptr(load);
+	ir_node *base = addr;
+	while (is_Member(base)) {
+		ir_node *pred = get_Member_ptr(base);
+		/* like find_base_addr(): frame members are base addresses */
+		if (is_Proj(pred) && pred == get_irg_frame(get_irn_irg(pred)))
+			break;
+		base = pred;
+	}
+
+	ir_storage_class_class_t sc = get_base_sc(classify_pointer(addr, base));
+	if (sc == ir_sc_globalvar || sc == ir_sc_localvar
+	    || sc == ir_sc_argument || sc == ir_sc_tls)
+		return true;
+
+	/* Only the checked pointer itself qualifies, an offset may leave the
+	 * checked object. */
+	const ir_node *confirm;
+	if (addr == base && value_not_null(addr, &confirm) && confirm != NULL) {
+		*guard = confirm;
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * Returns true if memory state @p from is memory state @p to extended by
+ * a chain of Loads. Loads do not modify memory, so @p from subsumes
+ * @p to once all Loads of the chain are executed unconditionally.
+ */
+static bool mem_chain_reaches(const ir_node *from, const ir_node *to)
+{
+	while (from != to) {
+		if (!is_Proj(from))
+			return false;
+		ir_node *pred = get_Proj_pred(from);
+		if (!is_Load(pred))
+			return false;
+		from = get_Load_mem(pred);
+	}
+	return true;
+}
+
+/**
+ * Counts the nodes of the DAG rooted at @p node that lie in block
+ * @p side, i.e. the operations a conversion would execute speculatively.
+ */
+static unsigned count_speculated(ir_nodeset_t *set, ir_node *node,
+                                 const ir_node *side)
+{
+	if (get_nodes_block(node) != side || is_Phi(node))
+		return 0;
+	if (!ir_nodeset_insert(set, node))
+		return 0;
+
+	unsigned count = 1;
+	foreach_irn_in(node, k, pred) {
+		count += count_speculated(set, pred, side);
+	}
+	return count;
+}
+
+/**
+ * Estimates whether turning the diamond into Muxes pays off.
+ *
+ * Converting trades the expected misprediction cost of the branch for
+ * the latency of the Mux nodes plus the unconditional execution of both
+ * sides. The branch probability is estimated from the execution
+ * frequencies of the two sides; a heavily biased branch predicts well
+ * and is kept as a branch.
+ */
+static bool is_profitable(ir_node *block, int i, int j, unsigned n_mux)
+{
+	ir_node *pred_i = get_Block_cfgpred_block(block, i);
+	ir_node *pred_j = get_Block_cfgpred_block(block, j);
+	double   freq_i = get_block_execfreq(pred_i);
+	double   freq_j = get_block_execfreq(pred_j);
+	double   sum    = freq_i + freq_j;
+	double   p      = sum > 0.0 ? freq_i / sum : 0.5;
+
+	/* a two-sided branch mispredicts at least this often */
+	double mispredict = 2.0 * p * (1.0 - p);
+
+	/* work that ran only on the taken side so far, weighted with how
+	 * often the respective other side was taken before */
+	ir_nodeset_t speculated;
+	ir_nodeset_init(&speculated);
+	unsigned spec_i = 0;
+	unsigned spec_j = 0;
+	for (ir_node *phi = get_Block_phis(block); phi != NULL;
+	     phi = get_Phi_next(phi)) {
+		spec_i += count_speculated(&speculated, get_irn_n(phi, i), pred_i);
+		spec_j += count_speculated(&speculated, get_irn_n(phi, j), pred_j);
+	}
+	ir_nodeset_destroy(&speculated);
+
+	double cost = n_mux * ir_target.mux_latency
+	            + spec_i * (1.0 - p) + spec_j * p;
+
+	DB((dbg, LEVEL_2, "Profitability of %+F/%d/%d: cost %f, mispredict %f\n",
+	    block, i, j, cost, mispredict));
+	return cost <= mispredict * MISPREDICT_COST;
+}
+
 /**
  * Block walker: Search for diamonds and do the if conversion.
  */
@@ -308,6 +436,7 @@ restart:;
 				ir_node *phi       = get_Block_phis(block);
 				bool     supported = true;
 				bool     negated   = get_Proj_num(projx0) == pn_Cond_false;
+				unsigned n_mux     = 0;
 				for (ir_node *p = phi; p != NULL; p = get_Phi_next(p)) {
 					ir_node *mux_false;
 					ir_node *mux_true;
@@ -321,15 +450,28 @@ restart:;
 					if (mux_true == mux_false)
 						continue;
 					ir_mode *mode = get_irn_mode(mux_true);
-					if (mode == mode_M
-						|| !env->allow_ifconv(sel, mux_false, mux_true)) {
+					if (mode == mode_M) {
+						/* A memory Phi is convertible if one side merely
+						 * extends the other by a chain of Loads, which are
+						 * then executed speculatively. */
+						if (!mem_chain_reaches(mux_true, mux_false)
+						 && !mem_chain_reaches(mux_false, mux_true)) {
+							supported = false;
+							break;
+						}
+					} else if (!env->allow_ifconv(sel, mux_false, mux_true)) {
 						supported = false;
 						break;
+					} else {
+						++n_mux;
 					}
 				}
 				if (!supported)
 					continue;
 
+				if (!is_profitable(block, i, j, n_mux))
+					continue;
+
 				DB((dbg, LEVEL_1, "Found Cond %+F with proj %+F and %+F\n",
 					cond, projx0, projx1
 				));
@@ -349,13 +491,13 @@ restart:;
 					if (val_i == val_j) {
 						mux = val_i;
 						DB((dbg, LEVEL_2,  "Generating no Mux for %+F, because both values are equal\n", phi));
+					} else if (get_irn_mode(phi) == mode_M) {
+						/* All Loads of the chain execute now, so the longer
+						 * memory state subsumes the other side. */
+						mux = mem_chain_reaches(val_i, val_j) ? val_i : val_j;
+						DB((dbg, LEVEL_2, "Using memory state %+F for %+F\n", mux, phi));
 					} else {
 						ir_node *t, *f;
-
-						/* Something is very fishy if two predecessors of a PhiM point into
-						 * one block, but not at the same memory node
-						 */
-						assert(get_irn_mode(phi) != mode_M);
 						if (negated) {
 							t = val_j;
 							f = val_i;
@@ -431,6 +573,20 @@ static void collect_phis(ir_node *node, void *env)
 			 * Ignore control flow nodes (except Raise), these will be removed.
 			 */
 			if (!is_cfop(node) && !is_Raise(node)) {
+				/* Loads that provably cannot fault may be executed
+				 * speculatively and do not pin their block. A load
+				 * legitimized by a dominating check additionally pins
+				 * the block establishing the fact, so no conversion can
+				 * hoist it above the check it relies on. */
+				if (is_Load(node)) {
+					const ir_node *guard;
+					if (is_speculable_Load(node, &guard)) {
+						if (guard != NULL)
+							set_Block_mark(get_nodes_block(guard), 1);
+						return;
+					}
+				}
+
 				ir_node *block = get_nodes_block(node);
 
 				DB((dbg, LEVEL_2, "Node %+F in block %+F is unmovable\n", node, block));
@@ -462,6 +618,7 @@ void opt_if_conv_cb(ir_graph *irg, arch_allow_ifconv_func callback)
 
 	DB((dbg, LEVEL_1, "Running if-conversion on %+F\n", irg));
 
+	ir_estimate_execfreq(irg);
 	compute_cdep(irg);
 
 	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_MARK | IR_RESOURCE_PHI_LIST);
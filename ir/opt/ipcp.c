@@ -0,0 +1,255 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Interprocedural constant propagation.
+ *
+ * Propagates constants across call edges in both directions: a parameter
+ * that receives the same constant from every call site is replaced by
+ * that constant inside the callee, and the results of calls to functions
+ * that return the same constant on every path are folded in the callers.
+ * In contrast to proc_cloning() this modifies the functions in place and
+ * therefore needs no size heuristic, but requires that all call sites
+ * are known.
+ */
+#include "array.h"
+#include "debug.h"
+#include "ircons.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irmemory.h"
+#include "irnode_t.h"
+#include "iroptimize.h"
+#include "irprog_t.h"
+#include "pmap.h"
+#include "tv.h"
+#include "type_t.h"
+#include "xmalloc.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+/**
+ * Returns whether all calls of @p ent are visible to us, i.e. whether it
+ * is safe to change its parameters.
+ */
+static bool all_callers_known(ir_entity *const ent)
+{
+	if (get_method_additional_properties(get_entity_type(ent))
+	    & mtp_property_private)
+		return true;
+	return !entity_is_externally_visible(ent)
+	    && !(get_entity_usage(ent) & ir_usage_address_taken);
+}
+
+/**
+ * Walker: collects all Calls to functions with a known graph into the
+ * entity -> call list map.
+ */
+static void collect_calls(ir_node *const call, void *const env)
+{
+	pmap *const call_map = (pmap*)env;
+
+	if (!is_Call(call))
+		return;
+	ir_entity *const callee = get_Call_callee(call);
+	if (callee == NULL || get_entity_linktime_irg(callee) == NULL)
+		return;
+
+	ir_node **calls = pmap_get(ir_node*, call_map, callee);
+	if (calls == NULL)
+		calls = NEW_ARR_F(ir_node*, 0);
+	ARR_APP1(ir_node*, calls, call);
+	pmap_insert(call_map, callee, calls);
+}
+
+typedef struct replace_env_t {
+	ir_node *args;  /**< the Args node of the callee */
+	unsigned pos;   /**< parameter number to replace */
+	ir_node *value; /**< the Const all callers pass */
+	bool     changed;
+} replace_env_t;
+
+static void replace_param_proj(ir_node *const node, void *const env)
+{
+	replace_env_t *const renv = (replace_env_t*)env;
+	if (!is_Proj(node) || get_Proj_pred(node) != renv->args
+	    || get_Proj_num(node) != renv->pos
+	    || get_irn_mode(node) != get_irn_mode(renv->value))
+		return;
+	exchange(node, renv->value);
+	renv->changed = true;
+}
+
+/**
+ * Replaces the parameters of @p irg by constants where every call site
+ * passes the same one. Returns true if something was replaced.
+ */
+static bool propagate_params(ir_graph *const irg, ir_node **const calls)
+{
+	ir_entity *const ent  = get_irg_entity(irg);
+	ir_type   *const type = get_entity_type(ent);
+	if (is_method_variadic(type))
+		return false;
+
+	size_t const n_params = get_method_n_params(type);
+	size_t const n_calls  = ARR_LEN(calls);
+	for (size_t i = 0; i < n_calls; ++i) {
+		if (get_Call_n_params(calls[i]) != (int)n_params)
+			return false;
+	}
+
+	bool changed = false;
+	for (size_t p = 0; p < n_params; ++p) {
+		ir_tarval *tv = NULL;
+		for (size_t i = 0; i < n_calls; ++i) {
+			ir_node *const arg = get_Call_param(calls[i], p);
+			if (!is_Const(arg)) {
+				tv = NULL;
+				break;
+			}
+			ir_tarval *const arg_tv = get_Const_tarval(arg);
+			if (tv == NULL) {
+				tv = arg_tv;
+			} else if (tv != arg_tv) {
+				tv = NULL;
+				break;
+			}
+		}
+		if (tv == NULL)
+			continue;
+
+		replace_env_t renv = {
+			.args  = get_irg_args(irg),
+			.pos   = p,
+			.value = new_r_Const(irg, tv),
+		};
+		irg_walk_graph(irg, NULL, replace_param_proj, &renv);
+		if (renv.changed) {
+			DB((dbg, LEVEL_1, "%+F: parameter %u is always %+F\n", irg,
+			    (unsigned)p, renv.value));
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+/**
+ * Returns the constant that @p irg returns as result @p idx on every
+ * Return, or NULL if the result is not that simple.
+ */
+static ir_tarval *get_const_return(ir_graph *const irg, unsigned const idx)
+{
+	ir_node *const end_block = get_irg_end_block(irg);
+	ir_tarval     *tv        = NULL;
+	for (int i = 0, n = get_Block_n_cfgpreds(end_block); i < n; ++i) {
+		ir_node *const pred = get_Block_cfgpred(end_block, i);
+		if (!is_Return(pred))
+			return NULL;
+		if ((unsigned)get_Return_n_ress(pred) <= idx)
+			return NULL;
+		ir_node *const res = get_Return_res(pred, idx);
+		if (!is_Const(res))
+			return NULL;
+		ir_tarval *const res_tv = get_Const_tarval(res);
+		if (tv == NULL) {
+			tv = res_tv;
+		} else if (tv != res_tv) {
+			return NULL;
+		}
+	}
+	return tv;
+}
+
+/**
+ * Walker: folds the results of Calls to functions which return the same
+ * constant on every path.
+ */
+static void fold_call_results(ir_node *const node, void *const env)
+{
+	bool *const changed = (bool*)env;
+
+	if (!is_Proj(node))
+		return;
+	ir_node *const res_tuple = get_Proj_pred(node);
+	if (!is_Proj(res_tuple) || get_Proj_num(res_tuple) != pn_Call_T_result)
+		return;
+	ir_node *const call = get_Proj_pred(res_tuple);
+	if (!is_Call(call))
+		return;
+	ir_entity *const callee = get_Call_callee(call);
+	if (callee == NULL)
+		return;
+	/* a weak definition may be replaced at link time */
+	if (get_entity_linkage(callee) & IR_LINKAGE_WEAK)
+		return;
+	ir_graph *const callee_irg = get_entity_linktime_irg(callee);
+	if (callee_irg == NULL)
+		return;
+
+	ir_tarval *const tv = get_const_return(callee_irg, get_Proj_num(node));
+	if (tv == NULL || get_tarval_mode(tv) != get_irn_mode(node))
+		return;
+	ir_graph *const irg = get_irn_irg(node);
+	exchange(node, new_r_Const(irg, tv));
+	DB((dbg, LEVEL_1, "%+F: folded result of call to %+F\n", irg, callee));
+	*changed = true;
+}
+
+void opt_ipcp(void)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.ipcp");
+	assure_irp_globals_entity_usage_computed();
+
+	bool *const modified = XMALLOCNZ(bool, get_irp_n_irgs());
+
+	/* Iterate to a fixpoint instead of ordering the callgraph by SCCs:
+	 * replacing a parameter may turn arguments or returns of other calls
+	 * into constants, which the next round picks up. Each round must
+	 * replace at least one node, so termination is assured. */
+	bool changed;
+	do {
+		changed = false;
+
+		pmap *const call_map = pmap_create();
+		all_irg_walk(collect_calls, NULL, call_map);
+
+		size_t i;
+		ir_graph *irg;
+		foreach_irp_irg(i, irg) {
+			ir_node **const calls
+				= pmap_get(ir_node*, call_map, get_irg_entity(irg));
+			if (calls == NULL || !all_callers_known(get_irg_entity(irg)))
+				continue;
+			if (propagate_params(irg, calls)) {
+				modified[i] = true;
+				changed     = true;
+			}
+		}
+		foreach_pmap(call_map, entry) {
+			ir_node **calls = (ir_node**)entry->value;
+			DEL_ARR_F(calls);
+		}
+		pmap_destroy(call_map);
+
+		foreach_irp_irg(i, irg) {
+			bool folded = false;
+			irg_walk_graph(irg, NULL, fold_call_results, &folded);
+			if (folded) {
+				modified[i] = true;
+				changed     = true;
+			}
+		}
+	} while (changed);
+
+	size_t i;
+	ir_graph *irg;
+	foreach_irp_irg(i, irg) {
+		if (modified[i])
+			confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_CONTROL_FLOW);
+	}
+	free(modified);
+}
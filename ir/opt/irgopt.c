@@ -11,18 +11,25 @@
  */
 #include "irgopt.h"
 
+#include "array.h"
 #include "constbits.h"
+#include "firm_threads.h"
 #include "ircons.h"
 #include "iredges_t.h"
 #include "irflag_t.h"
 #include "irgmod.h"
 #include "irgraph_t.h"
 #include "irgwalk.h"
+#include "irloop_t.h"
 #include "irnode_t.h"
 #include "iropt_t.h"
 #include "iroptimize.h"
+#include "irprog_t.h"
 #include "irtools.h"
 #include "pdeq.h"
+#include "statev_t.h"
+#include "util.h"
+#include "xmalloc.h"
 #include <assert.h>
 
 /**
@@ -151,19 +158,41 @@ static void opt_walker(ir_node *n, deq_t *waitq)
 	} while (optimized != last);
 }
 
-void optimize_graph_df(ir_graph *irg)
+/**
+ * qsort comparator grouping worklist entries by opcode, with the node
+ * index as deterministic tie breaker.
+ */
+static int cmp_node_opcode(const void *a, const void *b)
 {
-	ir_graph_properties_t props = IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES;
-	if (get_opt_global_cse()) {
+	const ir_node *n1 = *(const ir_node *const *)a;
+	const ir_node *n2 = *(const ir_node *const *)b;
+	unsigned const c1 = get_irn_opcode(n1);
+	unsigned const c2 = get_irn_opcode(n2);
+	if (c1 != c2)
+		return QSORT_CMP(c1, c2);
+	return QSORT_CMP(get_irn_idx(n1), get_irn_idx(n2));
+}
+
+/**
+ * Common setup for the data flow fixpoint: prepare the graph, reserve the
+ * link resource and initialize the wait queue. The caller seeds the queue
+ * and runs optimize_df_run() afterwards.
+ *
+ * @param irg               the graph
+ * @param waitq             the wait queue to initialize
+ * @param kill_unreachable  whether unreachable code elimination shall run
+ */
+static void optimize_df_begin(ir_graph *irg, deq_t *waitq,
+                              bool kill_unreachable)
+{
+	if (get_opt_global_cse())
 		set_irg_pinned(irg, op_pin_state_floats);
-		props |= IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE | IR_GRAPH_PROPERTY_CONSISTENT_POSTDOMINANCE;
-	}
 
 	/* enable unreachable code elimination,
 	 * not that currently disabling algebraic simplifications disables all
 	 * transform_node_XXX() functions and therefore unreachable code
 	 * elimination. */
-	if (get_opt_algebraic_simplification()) {
+	if (kill_unreachable && get_opt_algebraic_simplification()) {
 		assert(!irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_OPTIMIZE_UNREACHABLE_CODE));
 		add_irg_constraints(irg, IR_GRAPH_CONSTRAINT_OPTIMIZE_UNREACHABLE_CODE);
 	}
@@ -174,20 +203,42 @@ void optimize_graph_df(ir_graph *irg)
 
 	constbits_analyze(irg);
 
-	deq_t waitq;
-	deq_init(&waitq);
-	irg_walk_graph(irg, NULL, enqueue_node_init, &waitq);
+	deq_init(waitq);
+}
+
+/**
+ * Run the local optimizations to a fixpoint on a seeded wait queue and
+ * release everything acquired by optimize_df_begin().
+ */
+static void optimize_df_run(ir_graph *irg, deq_t *waitq)
+{
+	ir_graph_properties_t props = IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES;
+	if (get_opt_global_cse()) {
+		props |= IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE | IR_GRAPH_PROPERTY_CONSISTENT_POSTDOMINANCE;
+	}
 
 	/* any optimized nodes are stored in the wait queue,
 	 * so if it's not empty, the graph has been changed */
-	while (!deq_empty(&waitq)) {
+	ir_node **batch = NEW_ARR_F(ir_node*, 0);
+	while (!deq_empty(waitq)) {
 		assure_irg_properties(irg, props);
 
 		/* finish the wait queue */
-		while (!deq_empty(&waitq)) {
-			ir_node *n = deq_pop_pointer_left(ir_node, &waitq);
-			set_irn_link(n, NULL);
-			opt_walker(n, &waitq);
+		while (!deq_empty(waitq)) {
+			/* Drain the queue into a batch and group it by opcode: all
+			 * nodes of one op dispatch through the same transform and
+			 * equivalent callbacks, so running them back-to-back keeps
+			 * those targets hot and predictable. */
+			ARR_SHRINKLEN(batch, 0);
+			do {
+				ir_node *n = deq_pop_pointer_left(ir_node, waitq);
+				set_irn_link(n, NULL);
+				ARR_APP1(ir_node*, batch, n);
+			} while (!deq_empty(waitq));
+			QSORT_ARR(batch, cmp_node_opcode);
+
+			for (size_t i = 0, len = ARR_LEN(batch); i < len; ++i)
+				opt_walker(batch[i], waitq);
 		}
 		if (irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_OPTIMIZE_UNREACHABLE_CODE)) {
 			/* Calculate dominance so we can kill unreachable code
@@ -195,10 +246,11 @@ void optimize_graph_df(ir_graph *irg)
 			 * (phase coupling) */
 			compute_doms(irg);
 			assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
-			irg_block_walk_graph(irg, NULL, find_unreachable_blocks, &waitq);
+			irg_block_walk_graph(irg, NULL, find_unreachable_blocks, waitq);
 		}
 	}
-	deq_free(&waitq);
+	DEL_ARR_F(batch);
+	deq_free(waitq);
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
 
 	constbits_clear(irg);
@@ -207,7 +259,7 @@ void optimize_graph_df(ir_graph *irg)
 	                            | IR_GRAPH_PROPERTY_MANY_RETURNS
 	                            | IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES);
 
-	if (get_opt_algebraic_simplification()) {
+	if (irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_OPTIMIZE_UNREACHABLE_CODE)) {
 		/* Unreachable code elimination was enabled. */
 		clear_irg_constraints(irg, IR_GRAPH_CONSTRAINT_OPTIMIZE_UNREACHABLE_CODE);
 		add_irg_properties(irg, IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
@@ -219,6 +271,169 @@ void optimize_graph_df(ir_graph *irg)
 	remove_End_Bads_and_doublets(end);
 }
 
+void optimize_graph_df(ir_graph *irg)
+{
+	deq_t waitq;
+	optimize_df_begin(irg, &waitq, true);
+	irg_walk_graph(irg, NULL, enqueue_node_init, &waitq);
+	optimize_df_run(irg, &waitq);
+}
+
+void optimize_blocks(ir_graph *irg, ir_node *const *blocks, size_t n_blocks)
+{
+	deq_t waitq;
+	/* Unreachable code elimination needs whole-graph dominance and block
+	 * walks each round; leave it to full runs so the cost here stays
+	 * proportional to the listed blocks and their fan-out. */
+	optimize_df_begin(irg, &waitq, false);
+
+	assure_edges(irg);
+	for (size_t i = 0; i < n_blocks; ++i) {
+		ir_node *const block = blocks[i];
+		assert(is_Block(block));
+		enqueue_node(block, &waitq);
+		foreach_out_edge(block, edge) {
+			ir_node *const node = get_edge_src_irn(edge);
+			enqueue_node(node, &waitq);
+		}
+	}
+
+	/* changed nodes enqueue their users, so the optimization follows the
+	 * dataflow fan-out of the seeded blocks by itself */
+	optimize_df_run(irg, &waitq);
+}
+
+int irg_has_loops(ir_graph *irg)
+{
+	assure_loopinfo(irg);
+	/* The outermost loop represents the whole graph; real loops show up as
+	 * loop children of it. */
+	ir_loop *const loop = get_irg_loop(irg);
+	for (size_t i = 0, n = get_loop_n_elements(loop); i < n; ++i) {
+		if (*get_loop_element(loop, i).kind == k_ir_loop)
+			return 1;
+	}
+	return 0;
+}
+
+static void find_memory_op(ir_node *node, void *env)
+{
+	bool *const found = (bool*)env;
+	if (is_Load(node) || is_Store(node) || is_CopyB(node))
+		*found = true;
+}
+
+int irg_has_memory_ops(ir_graph *irg)
+{
+	bool found = false;
+	irg_walk_graph(irg, find_memory_op, NULL, &found);
+	return found;
+}
+
+/** Work distribution state shared by all pass driver workers. */
+typedef struct pass_driver_env_t {
+	irg_pass_t const *passes;   /**< passes to run on every graph */
+	size_t            n_passes; /**< number of entries in passes */
+	size_t            next;     /**< index of the next unclaimed graph */
+	firm_mutex_t      lock;     /**< protects next */
+} pass_driver_env_t;
+
+/**
+ * Claim the next unprocessed graph, or return NULL if all graphs have
+ * been handed out.
+ */
+static ir_graph *pass_driver_claim_irg(pass_driver_env_t *env)
+{
+	ir_graph *irg = NULL;
+	firm_mutex_lock(&env->lock);
+	if (env->next < get_irp_n_irgs())
+		irg = get_irp_irg(env->next++);
+	firm_mutex_unlock(&env->lock);
+	return irg;
+}
+
+/**
+ * Worker loop: repeatedly grab a graph and run the whole pass list on it
+ * while its nodes are still warm in the cache.
+ */
+static int pass_driver_worker(void *data)
+{
+	pass_driver_env_t *env = (pass_driver_env_t *)data;
+	for (ir_graph *irg; (irg = pass_driver_claim_irg(env)) != NULL;) {
+		for (size_t p = 0; p < env->n_passes; ++p) {
+			irg_pass_t const *const pass = &env->passes[p];
+			if (pass->guard != NULL && !pass->guard(irg)) {
+				if (pass->name != NULL) {
+					stat_ev_ctx_push_fmt("irg_pass", "%s", pass->name);
+					stat_ev("irg_pass_skipped");
+					stat_ev_ctx_pop("irg_pass");
+				}
+				continue;
+			}
+			if (pass->name != NULL) {
+				unsigned const idx_before = get_irg_last_idx(irg);
+				stat_ev_ctx_push_fmt("irg_pass", "%s", pass->name);
+				stat_ev_tim_push();
+				pass->run(irg);
+				stat_ev_tim_pop("irg_pass_time");
+				stat_ev_int("irg_pass_new_nodes",
+				            get_irg_last_idx(irg) - idx_before);
+				stat_ev_ctx_pop("irg_pass");
+			} else {
+				pass->run(irg);
+			}
+		}
+	}
+	return 0;
+}
+
+void run_irg_pass_list(irg_pass_t const *passes, size_t n_passes,
+                       unsigned n_threads)
+{
+	pass_driver_env_t env = { passes, n_passes, 0, 0 };
+	/* The claim path always locks, so the mutex must be valid even when
+	 * running inline. */
+	firm_mutex_init(&env.lock);
+
+	size_t const n_irgs = get_irp_n_irgs();
+	if (n_threads > n_irgs)
+		n_threads = (unsigned)n_irgs;
+
+#if FIRM_HAS_THREADS
+	if (n_threads > 1) {
+		firm_thread_t *workers = XMALLOCN(firm_thread_t, n_threads);
+		unsigned       started = 0;
+		for (unsigned t = 0; t < n_threads; ++t) {
+			if (!firm_thread_create(&workers[t], pass_driver_worker, &env))
+				break;
+			++started;
+		}
+		/* If no worker could be spawned, fall back to running inline. */
+		if (started == 0)
+			pass_driver_worker(&env);
+		for (unsigned t = 0; t < started; ++t)
+			firm_thread_join(workers[t]);
+		free(workers);
+		firm_mutex_destroy(&env.lock);
+		return;
+	}
+#else
+	(void)n_threads;
+#endif
+	pass_driver_worker(&env);
+	firm_mutex_destroy(&env.lock);
+}
+
+void run_irg_passes(irg_pass_func const *passes, size_t n_passes,
+                    unsigned n_threads)
+{
+	irg_pass_t *list = XMALLOCNZ(irg_pass_t, n_passes);
+	for (size_t p = 0; p < n_passes; ++p)
+		list[p].run = passes[p];
+	run_irg_pass_list(list, n_passes, n_threads);
+	free(list);
+}
+
 void local_opts_const_code(void)
 {
 	ir_graph *irg = get_const_code_irg();
@@ -19,6 +19,7 @@
 #include "hashptr.h"
 #include "irarch.h"
 #include "ircons_t.h"
+#include "irconsconfirm.h"
 #include "iredges_t.h"
 #include "irflag_t.h"
 #include "irgmod.h"
@@ -51,6 +52,34 @@ int ir_imprecise_float_transforms_allowed(void)
 	return imprecise_float_transforms_allowed;
 }
 
+void ir_allow_imprecise_float_transforms_irg(ir_graph *irg, int enable)
+{
+	irg->imprecise_float_transforms = enable;
+}
+
+int ir_imprecise_float_transforms_allowed_irg(const ir_graph *irg)
+{
+	return imprecise_float_transforms_allowed
+	    || irg->imprecise_float_transforms;
+}
+
+/**
+ * Dense dispatch tables for the per-opcode optimization hooks tested in
+ * the hot paths below.  Ops without an own hook point at keep_node(), so
+ * the drivers perform one predictable indexed call per node instead of a
+ * NULL test and branch.  Built by ir_register_opt_node_ops().
+ */
+static equivalent_node_func equivalent_node_table[iro_last + 1];
+static equivalent_node_func equivalent_node_proj_table[iro_last + 1];
+static transform_node_func  transform_node_table[iro_last + 1];
+static transform_node_func  transform_node_proj_table[iro_last + 1];
+
+/** Identity hook for ops without an own optimization. */
+static ir_node *keep_node(ir_node *n)
+{
+	return n;
+}
+
 /** Returns true if using an Add, Eor or Or instead of @p node would produce
  * the same result. */
 static bool is_Or_Eor_Add(const ir_node *node)
@@ -147,12 +176,53 @@ void set_value_of_func(value_of_func func)
 		value_of_ptr = default_value_of;
 }
 
-int value_not_null(const ir_node *n, const ir_node **confirm)
+/**
+ * Checks if "n <relation> C" together with "C <bound_vs_null> 0" proves
+ * that n is not null.
+ */
+static bool relation_proves_non_null(ir_relation relation,
+                                     ir_relation bound_vs_null)
+{
+	switch (relation) {
+	case ir_relation_equal: /* n == C && C != 0 ==> n != 0 */
+		return bound_vs_null != ir_relation_equal;
+	case ir_relation_less_greater: /* n != C /\ C == 0 ==> n != 0 */
+		return bound_vs_null == ir_relation_equal;
+	case ir_relation_less: /* n <  C /\ C <= 0 ==> n != 0 */
+		return bound_vs_null == ir_relation_less
+		    || bound_vs_null == ir_relation_equal;
+	case ir_relation_less_equal: /* n <= C /\ C <  0 ==> n != 0 */
+		return bound_vs_null == ir_relation_less;
+	case ir_relation_greater_equal: /* n >= C /\ C >  0 ==> n != 0 */
+		return bound_vs_null == ir_relation_greater;
+	case ir_relation_greater: /* n >  C /\ C >= 0 ==> n != 0 */
+		return bound_vs_null == ir_relation_greater
+		    || bound_vs_null == ir_relation_equal;
+	default:
+		return false;
+	}
+}
+
+/**
+ * Compares the bound @p bound to null and checks with
+ * relation_proves_non_null() whether the related value is not null.
+ */
+static bool bound_proves_non_null(ir_relation relation, const ir_node *bound)
 {
-	if (confirm)
-		*confirm = NULL;
+	if (!is_Const(bound))
+		return false;
+	ir_tarval *tv   = get_Const_tarval(bound);
+	ir_mode   *mode = get_tarval_mode(tv);
+	ir_tarval *null = get_mode_null(mode);
+	return relation_proves_non_null(relation, tarval_cmp(tv, null));
+}
 
-	/* walk confirm sequence and look for matching confirms */
+/**
+ * Skip the node kinds that cannot turn a non-null value into null:
+ * Minus, Sel and Member.
+ */
+static const ir_node *skip_null_preserving_ops(const ir_node *n)
+{
 	for (;;) {
 		/* -x != 0  =>  x != 0 */
 		if (is_Minus(n)) {
@@ -170,52 +240,27 @@ int value_not_null(const ir_node *n, const ir_node **confirm)
 			n = get_Member_ptr(n);
 			continue;
 		}
+		return n;
+	}
+}
 
-		if (!is_Confirm(n))
-			break;
+int value_not_null(const ir_node *n, const ir_node **confirm)
+{
+	if (confirm)
+		*confirm = NULL;
 
-		ir_node *bound = get_Confirm_bound(n);
-		if (!is_Const(bound)) {
-			n = get_Confirm_value(n);
-			continue;
-		}
-		ir_tarval  *tv       = get_Const_tarval(bound);
-		ir_mode    *mode     = get_irn_mode(n);
-		ir_tarval  *null     = get_mode_null(mode);
-		ir_relation relation = tarval_cmp(tv, null);
+	/* walk confirm sequence and look for matching confirms */
+	for (;;) {
+		n = skip_null_preserving_ops(n);
 
-		switch (get_Confirm_relation(n)) {
-		case ir_relation_equal: /* n == C && C != 0 ==> n != 0 */
-			if (relation != ir_relation_equal)
-				goto confirmed;
-			break;
-		case ir_relation_less_greater: /* n != C /\ C == 0 ==> n != 0 */
-			if (relation == ir_relation_equal)
-				goto confirmed;
-			break;
-		case ir_relation_less: /* n <  C /\ C <= 0 ==> n != 0 */
-			if (relation == ir_relation_less || relation == ir_relation_equal)
-				goto confirmed;
-			break;
-		case ir_relation_less_equal: /* n <= C /\ C <  0 ==> n != 0 */
-			if (relation == ir_relation_less)
-				goto confirmed;
-			break;
-		case ir_relation_greater_equal: /* n >= C /\ C >  0 ==> n != 0 */
-			if (relation == ir_relation_greater)
-				goto confirmed;
-			break;
-		case ir_relation_greater: /* n >  C /\ C >= 0 ==> n != 0 */
-			if (relation == ir_relation_greater
-			    || relation == ir_relation_equal) {
-confirmed:
-				if (confirm)
-					*confirm = n;
-				return true;
-			}
-			break;
-		default:
+		if (!is_Confirm(n))
 			break;
+
+		if (bound_proves_non_null(get_Confirm_relation(n),
+		                          get_Confirm_bound(n))) {
+			if (confirm)
+				*confirm = n;
+			return true;
 		}
 		n = get_Confirm_value(n);
 	}
@@ -246,6 +291,22 @@ confirmed:
 	return false;
 }
 
+/**
+ * Checks whether a recorded value fact proves @p n to be not null in
+ * @p block, see construct_value_facts(). The fact table is the
+ * side-table counterpart of graph-resident Confirms, so this complements
+ * value_not_null() for queries with a block context.
+ */
+static bool value_fact_not_null(const ir_node *n, const ir_node *block)
+{
+	n = skip_null_preserving_ops(n);
+	ir_node    *bound;
+	ir_relation relation = ir_get_value_fact(n, block, &bound);
+	if (relation == ir_relation_true)
+		return false;
+	return bound_proves_non_null(relation, bound);
+}
+
 /**
  * Return the value of a Constant.
  */
@@ -381,8 +442,10 @@ static ir_tarval *computed_value_Mul(const ir_node *n)
 	if (ta != tarval_unknown && tb != tarval_unknown)
 		return tarval_mul(ta, tb);
 
-	/* a * 0 != 0 if a == NaN or a == Inf */
-	if (!mode_is_float(mode)) {
+	/* a * 0 != 0 if a == NaN or a == Inf, unless the graph assumes
+	 * neither occurs */
+	if (!mode_is_float(mode)
+	    || ir_imprecise_float_transforms_allowed_irg(get_irn_irg(n))) {
 		/* a*0 = 0 or 0*b = 0 */
 		if (tarval_is_null(ta))
 			return ta;
@@ -1104,7 +1167,7 @@ static ir_node *equivalent_node_Add(ir_node *n)
 		n = equivalent_node_neutral_element(n, neutral);
 		if (n != oldn)
 			return n;
-		if (!ir_imprecise_float_transforms_allowed())
+		if (!ir_imprecise_float_transforms_allowed_irg(get_irn_irg(n)))
 			return n;
 	}
 
@@ -1587,9 +1650,10 @@ static ir_node *equivalent_node_CopyB(ir_node *copyb)
  */
 static ir_node *equivalent_node_Proj(ir_node *proj)
 {
-	const ir_node *n = get_Proj_pred(proj);
-	if (n->op->ops.equivalent_node_Proj)
-		return n->op->ops.equivalent_node_Proj(proj);
+	const ir_node *n   = get_Proj_pred(proj);
+	unsigned const iro = get_irn_opcode_(n);
+	if (iro <= iro_last)
+		return equivalent_node_proj_table[iro](proj);
 	return proj;
 }
 
@@ -1760,8 +1824,10 @@ static ir_node *equivalent_node_Confirm(ir_node *n)
  */
 ir_node *equivalent_node(ir_node *n)
 {
-	if (n->op->ops.equivalent_node)
-		return n->op->ops.equivalent_node(n);
+	unsigned const iro = get_irn_opcode_(n);
+	if (iro <= iro_last)
+		return equivalent_node_table[iro](n);
+	/* dynamically registered (backend) ops do not have these hooks */
 	return n;
 }
 
@@ -3106,7 +3172,8 @@ static ir_node *transform_node_Add(ir_node *n)
 	HANDLE_BINOP_CHOICE(tarval_add, a, b, c, mode);
 
 	/* these optimizations are imprecise for floating-point ops */
-	if (mode_is_float(mode) && !ir_imprecise_float_transforms_allowed())
+	if (mode_is_float(mode)
+	    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(n)))
 		return n;
 
 	if (mode_is_num(mode)) {
@@ -3344,7 +3411,8 @@ static ir_node *transform_node_Sub(ir_node *n)
 	HANDLE_BINOP_CHOICE(tarval_sub, a, b, c, mode);
 
 	/* these optimizations are imprecise for floating-point ops */
-	if (mode_is_float(mode) && !ir_imprecise_float_transforms_allowed())
+	if (mode_is_float(mode)
+	    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(n)))
 		return n;
 
 	if (is_Const(b) && !mode_is_reference(get_irn_mode(b))) {
@@ -3973,7 +4041,8 @@ static ir_node *transform_node_Div(ir_node *n)
 			   not using strict rules. */
 			if (tarval_is_constant(tv)
 			    && (tarval_ieee754_get_exact()
-				    || ir_imprecise_float_transforms_allowed())) {
+				    || ir_imprecise_float_transforms_allowed_irg(
+			           get_irn_irg(n)))) {
 				ir_node  *block = get_nodes_block(n);
 				ir_graph *irg   = get_irn_irg(block);
 				ir_node  *c     = new_r_Const(irg, tv);
@@ -4788,7 +4857,9 @@ static ir_node *transform_node_Proj_Load(ir_node *proj)
 		const ir_node *addr = get_Load_ptr(load);
 		const ir_node *confirm;
 
-		if (value_not_null(addr, &confirm)) {
+		/* Loads are pinned, so a fact valid in their block stays valid. */
+		if (value_not_null(addr, &confirm)
+		    || value_fact_not_null(addr, get_nodes_block(load))) {
 			if (get_Proj_num(proj) == pn_Load_X_except) {
 				ir_graph *irg = get_irn_irg(proj);
 				return new_r_Bad(irg, mode_X);
@@ -4813,7 +4884,9 @@ static ir_node *transform_node_Proj_Store(ir_node *proj)
 		const ir_node *addr = get_Store_ptr(store);
 		const ir_node *confirm;
 
-		if (value_not_null(addr, &confirm)) {
+		/* Stores are pinned, so a fact valid in their block stays valid. */
+		if (value_not_null(addr, &confirm)
+		    || value_fact_not_null(addr, get_nodes_block(store))) {
 			if (get_Proj_num(proj) == pn_Store_X_except) {
 				ir_graph *irg = get_irn_irg(proj);
 				return new_r_Bad(irg, mode_X);
@@ -5767,10 +5840,10 @@ reduced_tv:
  */
 static ir_node *transform_node_Proj(ir_node *proj)
 {
-	ir_node *n = get_Proj_pred(proj);
-
-	if (n->op->ops.transform_node_Proj)
-		return n->op->ops.transform_node_Proj(proj);
+	ir_node *n   = get_Proj_pred(proj);
+	unsigned const iro = get_irn_opcode_(n);
+	if (iro <= iro_last)
+		return transform_node_proj_table[iro](proj);
 	return proj;
 }
 
@@ -7641,8 +7714,8 @@ restart:;
 	if (get_opt_algebraic_simplification() ||
 		(iro == iro_Cond) ||
 		(iro == iro_Proj)) {    /* Flags tested local. */
-		if (n->op->ops.transform_node != NULL) {
-			n = n->op->ops.transform_node(n);
+		if (iro <= iro_last) {
+			n = transform_node_table[iro](n);
 			if (n != old_n)
 				goto restart;
 		}
@@ -7735,6 +7808,19 @@ void ir_register_opt_node_ops(void)
 	set_op_transform_node_proj(op_Load,    transform_node_Proj_Load);
 	set_op_transform_node_proj(op_Mod,     transform_node_Proj_Mod);
 	set_op_transform_node_proj(op_Store,   transform_node_Proj_Store);
+
+	/* Build the dense dispatch tables from the hooks registered above. */
+	for (unsigned iro = 0; iro <= iro_last; ++iro) {
+		ir_op_ops const *const ops = &ir_get_opcode(iro)->ops;
+		equivalent_node_table[iro]
+			= ops->equivalent_node      != NULL ? ops->equivalent_node      : keep_node;
+		equivalent_node_proj_table[iro]
+			= ops->equivalent_node_Proj != NULL ? ops->equivalent_node_Proj : keep_node;
+		transform_node_table[iro]
+			= ops->transform_node       != NULL ? ops->transform_node       : keep_node;
+		transform_node_proj_table[iro]
+			= ops->transform_node_Proj  != NULL ? ops->transform_node_Proj  : keep_node;
+	}
 }
 
 /** The size of the hash table used, should estimate the number of nodes
@@ -7814,13 +7900,16 @@ unsigned ir_node_hash(const ir_node *node)
 void new_identities(ir_graph *irg)
 {
 	del_identities(irg);
-	irg->value_table = new_pset(identities_cmp, N_IR_NODES);
+	irg->value_table = XMALLOC(ir_identityset_t);
+	ir_identityset_init(irg->value_table, identities_cmp, N_IR_NODES);
 }
 
 void del_identities(ir_graph *irg)
 {
-	if (irg->value_table != NULL)
-		del_pset(irg->value_table);
+	if (irg->value_table != NULL) {
+		ir_identityset_destroy(irg->value_table);
+		free(irg->value_table);
+	}
 }
 
 static int cmp_node_nr(const void *a, const void *b)
@@ -7874,15 +7963,15 @@ void ir_normalize_node(ir_node *n)
 
 ir_node *identify_remember(ir_node *n)
 {
-	ir_graph *irg         = get_irn_irg(n);
-	pset     *value_table = irg->value_table;
+	ir_graph         *irg         = get_irn_irg(n);
+	ir_identityset_t *value_table = irg->value_table;
 
 	if (value_table == NULL)
 		return n;
 
 	ir_normalize_node(n);
-	/* lookup or insert in hash table with given hash key. */
-	ir_node *nn = (ir_node *)pset_insert(value_table, n, ir_node_hash(n));
+	/* lookup or insert in hash table */
+	ir_node *nn = ir_identityset_insert(value_table, n);
 
 	/* nn is reachable again */
 	if (nn != n)
@@ -7922,7 +8011,9 @@ void add_identities(ir_node *node)
 
 void visit_all_identities(ir_graph *irg, irg_walk_func visit, void *env)
 {
-	foreach_pset(irg->value_table, ir_node, node) {
+	ir_identityset_iterator_t iter;
+	ir_identityset_iterator_init(&iter, irg->value_table);
+	for (ir_node *node; (node = ir_identityset_iterator_next(&iter)) != NULL;) {
 		visit(node, env);
 	}
 }
@@ -12,6 +12,7 @@
 #include "dbginfo_t.h"
 #include "debug.h"
 #include "entity_t.h"
+#include "hashptr.h"
 #include "ircons_t.h"
 #include "iredges_t.h"
 #include "irflag_t.h"
@@ -610,6 +611,156 @@ static bool try_update_ptr_CopyB(track_load_env_t *env, ir_node *copyb)
 	return true;
 }
 
+/* Maximum number of memory Phis find_forwarded_value() looks through. */
+#define MAX_PHI_FORWARD_DEPTH 3
+/* Bounds a single path walk of find_forwarded_value(). */
+#define MAX_FORWARD_STEPS 256
+
+/** The result of tracking a value through memory Phis. */
+typedef struct phi_forward_t {
+	ir_node *value;  /**< the previous value seen on every path */
+	ir_mode *mode;   /**< mode of the previous access */
+	long     offset; /**< offset of the previous access */
+} phi_forward_t;
+
+/**
+ * Walks the memory chain starting at @p start without modifying anything
+ * and checks whether the value the current Load would read is available.
+ * On a memory Phi all predecessor paths are followed; they must all
+ * provide the very same previous value. Returns false if the value could
+ * be clobbered on the path or paths disagree; a value found on an
+ * earlier path must be confirmed by every later one via @p found.
+ */
+static bool find_forwarded_value(track_load_env_t *env, ir_node *start,
+                                 int depth, phi_forward_t *found)
+{
+	ir_node *const load      = env->load;
+	ir_type *const load_type = get_Load_type(load);
+	ir_mode *const load_mode = get_Load_mode(load);
+	unsigned const load_size = get_mode_size_bytes(load_mode);
+
+	ir_node *node = start;
+	for (int steps = 0;; ++steps) {
+		/* a loop brought us back to where we started */
+		if (node == load)
+			return false;
+		/* several paths may legitimately visit the same nodes, so the
+		 * usual visited marks cannot break cycles here; give up after a
+		 * bounded number of steps instead (covers degenerate memory
+		 * cycles in unreachable code) */
+		if (steps >= MAX_FORWARD_STEPS)
+			return false;
+
+		if (is_Store(node)) {
+			if (!on_regular_path(load, node))
+				return false;
+			ir_node       *const value = get_Store_value(node);
+			ir_mode       *const mode  = get_irn_mode(value);
+			base_offset_t        prev_bo;
+			get_base_and_offset(get_Store_ptr(node), &prev_bo);
+			if (is_contained_in(load_mode, &env->base_offset, mode,
+			                    &prev_bo)) {
+				/* all paths must provide the identical value */
+				if (found->value == NULL) {
+					found->value  = value;
+					found->mode   = mode;
+					found->offset = prev_bo.offset;
+					return true;
+				}
+				return found->value == value && found->mode == mode
+				    && found->offset == prev_bo.offset;
+			}
+			/* check if we can pass through this store */
+			ir_alias_relation const rel = get_alias_relation(
+				get_Store_ptr(node), get_Store_type(node),
+				get_mode_size_bytes(mode),
+				env->ptr, load_type, load_size);
+			if (rel != ir_no_alias)
+				return false;
+			node = skip_Proj(get_Store_mem(node));
+		} else if (is_Load(node)) {
+			if (!on_regular_path(load, node))
+				return false;
+			ldst_info_t   *const info       = (ldst_info_t*)get_irn_link(node);
+			ir_node       *const prev_value = info->projs[pn_Load_res];
+			ir_mode       *const mode       = get_Load_mode(node);
+			base_offset_t        prev_bo;
+			get_base_and_offset(get_Load_ptr(node), &prev_bo);
+			if (prev_value != NULL
+			    && is_contained_in(load_mode, &env->base_offset, mode,
+			                       &prev_bo)) {
+				if (found->value == NULL) {
+					found->value  = prev_value;
+					found->mode   = mode;
+					found->offset = prev_bo.offset;
+					return true;
+				}
+				return found->value == prev_value && found->mode == mode
+				    && found->offset == prev_bo.offset;
+			}
+			/* we can skip any load */
+			node = skip_Proj(get_Load_mem(node));
+		} else if (is_CopyB(node)) {
+			/* passing through is fine as long as our address is not
+			 * written; tracking into the CopyB source would modify the
+			 * environment and is left to the single-path walk */
+			ir_alias_relation const rel = get_alias_relation(
+				get_CopyB_dst(node), get_CopyB_type(node),
+				get_type_size(get_CopyB_type(node)),
+				env->ptr, load_type, load_size);
+			if (rel != ir_no_alias)
+				return false;
+			node = skip_Proj(get_CopyB_mem(node));
+		} else if (is_irn_const_memory(node)) {
+			node = skip_Proj(get_memop_mem(node));
+		} else if (is_Phi(node)) {
+			if (depth <= 0)
+				return false;
+			foreach_irn_in(node, i, pred) {
+				if (!find_forwarded_value(env, skip_Proj(pred), depth - 1,
+				                          found))
+					return false;
+			}
+			/* an empty Phi cannot happen, so found is filled in */
+			return true;
+		} else {
+			/* be conservative about any other node and assume aliasing
+			 * that changes the loaded value */
+			return false;
+		}
+	}
+}
+
+/**
+ * The single-path walk ended at a memory Phi. If every joined path
+ * provides the same previous value for the address, the Load is
+ * replaced by it. This catches the common pattern of a Store in a
+ * dominator whose value survives both arms of a branch.
+ */
+static changes_t try_load_through_phi(track_load_env_t *env, ir_node *phi)
+{
+	phi_forward_t found = { NULL, NULL, 0 };
+	foreach_irn_in(phi, i, pred) {
+		if (!find_forwarded_value(env, skip_Proj(pred),
+		                          MAX_PHI_FORWARD_DEPTH - 1, &found))
+			return NO_CHANGES;
+	}
+	if (found.value == NULL)
+		return NO_CHANGES;
+
+	/* the value is identical on all paths, so it dominates the Phi block
+	 * and therefore the Load */
+	ir_node *const load  = env->load;
+	ir_node *const block = get_nodes_block(load);
+	ir_node *const new_value
+		= transform_previous_value(get_Load_mode(load),
+		                           env->base_offset.offset, found.mode,
+		                           found.offset, found.value, block, load);
+	DB((dbg, LEVEL_1, "  forwarding %+F over %+F to %+F\n", found.value,
+	    phi, load));
+	return replace_load(load, new_value);
+}
+
 /* Note on terminology:
  * In the following functions, two types are associated with each Load
  * and Store: load_type/store_type are the types of the actual
@@ -719,6 +870,9 @@ static changes_t follow_load_mem_chain(track_load_env_t *env, ir_node *start)
 			if ((res & ~NODES_CREATED) != NO_CHANGES)
 				break;
 		}
+	} else if (is_Phi(node)) {
+		/* try to look through the memory merge */
+		res |= try_load_through_phi(env, node);
 	}
 	return res;
 }
@@ -0,0 +1,343 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Loop-invariant code motion for memory operations.
+ *
+ * place_code() already hoists pure computations out of loops, but never
+ * Loads: they are serialized by the memory chain. This pass promotes
+ * Loads from loop-invariant addresses into the loop preheader when the
+ * alias analysis proves that no operation inside the loop can modify the
+ * loaded memory and the Load is executed on every path through the loop.
+ */
+#include "array.h"
+#include "debug.h"
+#include "ircons.h"
+#include "irdom.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irloop_t.h"
+#include "irmemory.h"
+#include "irnode_t.h"
+#include "iroptimize.h"
+#include "type_t.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+typedef struct loop_env_t {
+	ir_loop  *loop;
+	ir_node  *header;    /**< block dominating all loop blocks */
+	ir_node  *preheader; /**< single block jumping into the header */
+	int       entry_pos; /**< position of the entry edge in the header */
+	ir_node **loads;     /**< all Loads inside the loop */
+	ir_node **stores;    /**< all Stores inside the loop */
+	ir_node **exits;     /**< in-loop blocks with a successor outside */
+	bool      unsafe;    /**< loop contains an unanalyzable memory write */
+	bool      changed;
+} loop_env_t;
+
+static bool is_inner_loop(ir_loop *const outer_loop, ir_loop *inner_loop)
+{
+	ir_loop *old_inner_loop;
+	do {
+		old_inner_loop = inner_loop;
+		inner_loop = get_loop_outer_loop(inner_loop);
+	} while (inner_loop != old_inner_loop && inner_loop != outer_loop);
+	return inner_loop != old_inner_loop;
+}
+
+static bool block_is_inside_loop(ir_node *const block, ir_loop *const loop)
+{
+	ir_loop *const block_loop = get_irn_loop(block);
+	if (block_loop == NULL)
+		return false;
+	return block_loop == loop || is_inner_loop(loop, block_loop);
+}
+
+static bool block_dominates_loop(ir_node *const block, ir_loop *const loop)
+{
+	size_t const n_elements = get_loop_n_elements(loop);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_node) {
+			assert(is_Block(element.node));
+			if (!block_dominates(block, element.node))
+				return false;
+		} else if (*element.kind == k_ir_loop) {
+			if (!block_dominates_loop(block, element.son))
+				return false;
+		}
+	}
+	return true;
+}
+
+/** Returns the block that dominates all blocks in the loop or NULL. */
+static ir_node *get_loop_header(ir_loop *const loop)
+{
+	ir_node *header = NULL;
+	size_t const n_elements = get_loop_n_elements(loop);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_node) {
+			header = element.node;
+			break;
+		}
+	}
+	if (header == NULL)
+		return NULL;
+
+	ir_node *idom = get_Block_idom(header);
+	while (idom && block_is_inside_loop(idom, loop)) {
+		header = idom;
+		idom = get_Block_idom(header);
+	}
+
+	return block_dominates_loop(header, loop) ? header : NULL;
+}
+
+/**
+ * Returns the preheader of the loop, i.e. the only block outside the loop
+ * jumping unconditionally into the header, or NULL if there is none.
+ * Code placed there is executed iff the loop is entered.
+ */
+static ir_node *get_preheader(ir_node *const header, ir_loop *const loop,
+                              int *const entry_pos)
+{
+	int entry = -1;
+	for (int i = 0, n = get_Block_n_cfgpreds(header); i < n; ++i) {
+		ir_node *const pred_block
+			= get_nodes_block(get_Block_cfgpred(header, i));
+		if (block_is_inside_loop(pred_block, loop))
+			continue;
+		if (entry >= 0)
+			return NULL;
+		entry = i;
+	}
+	if (entry < 0)
+		return NULL;
+	ir_node *const cfgpred = get_Block_cfgpred(header, entry);
+	if (!is_Jmp(cfgpred))
+		return NULL;
+	*entry_pos = entry;
+	return get_nodes_block(cfgpred);
+}
+
+/** Returns whether a Call is known not to write memory. */
+static bool call_writes_no_memory(ir_node *const call)
+{
+	mtp_additional_properties props
+		= get_method_additional_properties(get_Call_type(call));
+	ir_node *const ptr = get_Call_ptr(call);
+	if (is_Address(ptr))
+		props |= get_entity_additional_properties(get_Address_entity(ptr));
+	return (props & (mtp_property_no_write | mtp_property_pure)) != 0;
+}
+
+/**
+ * Collects the memory operations and exit blocks of one loop block.
+ */
+static void collect_block(loop_env_t *const env, ir_node *const block)
+{
+	foreach_out_edge(block, edge) {
+		ir_node *const node = get_edge_src_irn(edge);
+		if (is_Block(node) || get_nodes_block(node) != block)
+			continue;
+
+		if (get_irn_mode(node) == mode_X) {
+			/* remember blocks from which the loop can be left */
+			foreach_out_edge(node, user_edge) {
+				ir_node *const user = get_edge_src_irn(user_edge);
+				if (is_Block(user)
+				    && !block_is_inside_loop(user, env->loop)) {
+					ARR_APP1(ir_node*, env->exits, block);
+					break;
+				}
+			}
+		}
+
+		if (is_Load(node)) {
+			ARR_APP1(ir_node*, env->loads, node);
+		} else if (is_Store(node)) {
+			ARR_APP1(ir_node*, env->stores, node);
+		} else if (is_Call(node)) {
+			if (!call_writes_no_memory(node))
+				env->unsafe = true;
+		} else if (is_Div(node) || is_Mod(node) || is_Sync(node)
+		           || is_Phi(node) || is_Return(node)) {
+			/* these only read or route memory */
+		} else {
+			/* everything else with a memory input may modify memory */
+			foreach_irn_in(node, i, pred) {
+				if (get_irn_mode(pred) == mode_M) {
+					env->unsafe = true;
+					break;
+				}
+			}
+		}
+	}
+}
+
+static void collect_loop(loop_env_t *const env, ir_loop *const loop)
+{
+	size_t const n_elements = get_loop_n_elements(loop);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_node)
+			collect_block(env, element.node);
+		else if (*element.kind == k_ir_loop)
+			collect_loop(env, element.son);
+	}
+}
+
+/**
+ * Tries to move one Load into the preheader. Returns true if it did.
+ */
+static bool hoist_load(loop_env_t *const env, ir_node *const load)
+{
+	if (get_Load_volatility(load) != volatility_non_volatile
+	    || ir_throws_exception(load))
+		return false;
+
+	/* the address must be computed outside the loop */
+	ir_node *const ptr = get_Load_ptr(load);
+	if (block_is_inside_loop(get_nodes_block(ptr), env->loop))
+		return false;
+
+	/* hoisting must not introduce a memory access that the original
+	 * program never executed: the Load has to be reached on every path
+	 * through the loop, i.e. its block dominates all loop exits */
+	ir_node *const block = get_nodes_block(load);
+	for (size_t i = 0, n = ARR_LEN(env->exits); i < n; ++i) {
+		if (!block_dominates(block, env->exits[i]))
+			return false;
+	}
+
+	/* no Store in the loop may alias the loaded memory */
+	ir_type *const type = get_Load_type(load);
+	unsigned const size = get_mode_size_bytes(get_Load_mode(load));
+	for (size_t i = 0, n = ARR_LEN(env->stores); i < n; ++i) {
+		ir_node *const store = env->stores[i];
+		unsigned const store_size
+			= get_mode_size_bytes(get_irn_mode(get_Store_value(store)));
+		if (get_alias_relation(ptr, type, size, get_Store_ptr(store),
+		                       get_Store_type(store), store_size)
+		    != ir_no_alias)
+			return false;
+	}
+
+	/* find the memory state valid at the loop entry */
+	ir_node *const mem = get_Load_mem(load);
+	ir_node *phi = NULL;
+	ir_node *entry_mem;
+	if (!block_is_inside_loop(get_nodes_block(mem), env->loop)) {
+		entry_mem = mem;
+	} else if (is_Phi(mem) && get_nodes_block(mem) == env->header) {
+		phi       = mem;
+		entry_mem = get_Phi_pred(phi, env->entry_pos);
+	} else {
+		return false;
+	}
+
+	ir_node *res_proj = NULL;
+	ir_node *mem_proj = NULL;
+	foreach_out_edge(load, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (!is_Proj(proj))
+			return false;
+		if (get_irn_mode(proj) == mode_M)
+			mem_proj = proj;
+		else
+			res_proj = proj;
+	}
+	if (res_proj == NULL)
+		return false;
+
+	ir_cons_flags flags = cons_none;
+	if (get_Load_unaligned(load) == align_non_aligned)
+		flags |= cons_unaligned;
+	ir_node *const new_load
+		= new_rd_Load(get_irn_dbg_info(load), env->preheader, entry_mem,
+		              ptr, get_Load_mode(load), type, flags);
+	ir_node *const new_mem = new_r_Proj(new_load, mode_M, pn_Load_M);
+	ir_node *const new_res
+		= new_r_Proj(new_load, get_Load_mode(load), pn_Load_res);
+
+	/* serialize the new Load on the entry edge and take the old one out
+	 * of the in-loop memory chain */
+	if (phi != NULL) {
+		set_Phi_pred(phi, env->entry_pos, new_mem);
+		if (mem_proj != NULL)
+			exchange(mem_proj, phi);
+	} else if (mem_proj != NULL) {
+		exchange(mem_proj, new_mem);
+	}
+	exchange(res_proj, new_res);
+
+	DB((dbg, LEVEL_1, "hoisted %+F into %+F\n", new_load, env->preheader));
+	return true;
+}
+
+static bool optimize_loop(ir_loop *const loop, bool const container)
+{
+	bool changed = false;
+	/* inner loops first: their hoisted Loads land in blocks of the outer
+	 * loop and get another chance to move further out */
+	size_t const n_elements = get_loop_n_elements(loop);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_loop)
+			changed |= optimize_loop(element.son, false);
+	}
+	if (container)
+		return changed;
+
+	loop_env_t env = {
+		.loop   = loop,
+		.loads  = NEW_ARR_F(ir_node*, 0),
+		.stores = NEW_ARR_F(ir_node*, 0),
+		.exits  = NEW_ARR_F(ir_node*, 0),
+	};
+	env.header = get_loop_header(loop);
+	if (env.header != NULL)
+		env.preheader = get_preheader(env.header, loop, &env.entry_pos);
+	if (env.preheader != NULL) {
+		collect_loop(&env, loop);
+		if (!env.unsafe) {
+			/* iterate: a hoisted Load may unblock one whose memory input
+			 * only now becomes the header Phi or loop-invariant */
+			bool progress;
+			do {
+				progress = false;
+				for (size_t i = 0, n = ARR_LEN(env.loads); i < n; ++i) {
+					if (env.loads[i] == NULL)
+						continue;
+					if (hoist_load(&env, env.loads[i])) {
+						env.loads[i] = NULL;
+						progress     = true;
+						env.changed  = true;
+					}
+				}
+			} while (progress);
+		}
+	}
+	DEL_ARR_F(env.exits);
+	DEL_ARR_F(env.stores);
+	DEL_ARR_F(env.loads);
+	return changed | env.changed;
+}
+
+void opt_licm(ir_graph *const irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.licm");
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
+	                      | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
+	                      | IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+	                      | IR_GRAPH_PROPERTY_NO_BADS);
+	bool const changed = optimize_loop(get_irg_loop(irg), true);
+	confirm_irg_properties(irg, changed ? IR_GRAPH_PROPERTIES_CONTROL_FLOW
+	                                    : IR_GRAPH_PROPERTIES_ALL);
+}
@@ -2314,6 +2314,8 @@ static void loop_optimization(ir_graph *const irg, loop_op_t const loop_op)
 	/* Reset stats for this procedure */
 	reset_stats();
 
+	unsigned const change_nr_before = irg->change_nr;
+
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_PHI_LIST);
 	collect_phiprojs_and_start_block_nodes(irg);
 
@@ -2353,7 +2355,11 @@ static void loop_optimization(ir_graph *const irg, loop_op_t const loop_op)
 	DEL_ARR_F(loops);
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_PHI_LIST);
 
-	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
+	/* Keep all analysis info (especially the loop tree) alive when no loop
+	 * was actually transformed, so follow-up loop passes can reuse it. */
+	confirm_irg_properties(irg, irg->change_nr == change_nr_before
+	                       ? IR_GRAPH_PROPERTIES_ALL
+	                       : IR_GRAPH_PROPERTIES_NONE);
 }
 
 void do_loop_unrolling(ir_graph *const irg)
@@ -2371,6 +2377,19 @@ void do_loop_peeling(ir_graph *const irg)
 	loop_optimization(irg, loop_op_peeling);
 }
 
+void optimize_loop_nests(ir_graph *const irg)
+{
+	/* Run the loop passes back to back. Each pass confirms all analysis
+	 * info when it did not transform the graph, so the loop tree and
+	 * dominance info computed by the first pass are reused by the
+	 * following ones instead of being rebuilt per pass. The passes
+	 * themselves already work on the loop nests inner-to-outer. */
+	do_loop_inversion(irg);
+	do_loop_unrolling(irg);
+	opt_osr(irg, osr_flag_default | osr_flag_keep_reg_pressure);
+	place_code(irg);
+}
+
 void firm_init_loop_opt(void)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.opt.loop");
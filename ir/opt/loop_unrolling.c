@@ -5,11 +5,13 @@
 
 /**
  * @file
- * @brief   loop unrolling using LCSSA form
+ * @brief   loop unrolling and peeling using LCSSA form
  * @author  Elias Aebi
  */
 #include "lcssa_t.h"
+#include "execfreq.h"
 #include "irtools.h"
+#include "scalar_evolution.h"
 #include "xmalloc.h"
 #include "debug.h"
 #include <assert.h>
@@ -128,11 +130,12 @@ static void rewire_successor_block(ir_node *const block, int n)
 	}
 }
 
-static void rewire_node(ir_node *const node, ir_node *const header)
+static void rewire_node(ir_node *const node, ir_node *const header, bool const peel)
 {
 	ir_node *const new_node = get_irn_link(node);
 	assert(new_node);
-	assert(get_irn_arity(node) == get_irn_arity(new_node));
+	assert(get_irn_arity(node) == get_irn_arity(new_node)
+	       || (peel && is_Phi(node) && get_nodes_block(node) == header));
 
 	// rewire the successors outside the loop
 	unsigned const n_outs = get_irn_n_outs(node);
@@ -150,6 +153,62 @@ static void rewire_node(ir_node *const node, ir_node *const header)
 	// loop header block
 	if (node == header) {
 		assert(is_Block(node));
+		if (peel) {
+			int const arity = get_irn_arity(node);
+			int n_back = 0;
+			for (int i = 0; i < arity; ++i) {
+				if (get_irn_link(get_irn_n(node, i)) != NULL)
+					++n_back;
+			}
+			int const n_entry = arity - n_back;
+			ir_node **const entry_in = ALLOCAN(ir_node *, n_entry);
+			ir_node **const back_in  = ALLOCAN(ir_node *, 2 * n_back);
+
+			// rewire the header phis first, while the header still has
+			// its original predecessor list to classify the positions
+			unsigned const header_n_outs = get_irn_n_outs(node);
+			for (unsigned o = 0; o < header_n_outs; ++o) {
+				ir_node *const phi = get_irn_out(node, o);
+				if (!is_Phi(phi) || get_nodes_block(phi) != node)
+					continue;
+				ir_node *const new_phi = get_irn_link(phi);
+				int e = 0, b = 0;
+				for (int i = 0; i < arity; ++i) {
+					ir_node *const value = get_irn_n(phi, i);
+					ir_node *const copy  = get_irn_link(value);
+					if (get_irn_link(get_irn_n(node, i)) == NULL) {
+						// the peeled copy sees the unchanged entry values
+						entry_in[e++] = value;
+					} else {
+						// the loop continues with the values computed by
+						// the peeled iteration
+						back_in[b] = value;
+						back_in[n_back + b] = copy != NULL ? copy : value;
+						++b;
+					}
+				}
+				set_irn_in(new_phi, n_entry, entry_in);
+				set_irn_in(phi, 2 * n_back, back_in);
+			}
+
+			// the copy takes over the entry edges and thus runs at most
+			// once; its back edges lead into the original header
+			int e = 0, b = 0;
+			for (int i = 0; i < arity; ++i) {
+				ir_node *const pred     = get_irn_n(node, i);
+				ir_node *const new_pred = get_irn_link(pred);
+				if (new_pred == NULL) {
+					entry_in[e++] = pred;
+				} else {
+					back_in[b] = pred;
+					back_in[n_back + b] = new_pred;
+					++b;
+				}
+			}
+			set_irn_in(new_node, n_entry, entry_in);
+			set_irn_in(node, 2 * n_back, back_in);
+			return;
+		}
 		int const arity = get_irn_arity(node);
 		int new_arity = 0;
 		for (int i = 0; i < arity; ++i) {
@@ -176,6 +235,15 @@ static void rewire_node(ir_node *const node, ir_node *const header)
 
 	// phi node inside loop header
 	if (is_Phi(node) && get_nodes_block(node) == header) {
+		if (peel) {
+			// already rewired together with the header block; the copy is
+			// no longer part of a loop, so drop a copied loop phi flag
+			if (get_Phi_loop(new_node)) {
+				remove_keep_alive(new_node);
+				set_Phi_loop(new_node, false);
+			}
+			return;
+		}
 		int const arity = get_irn_arity(node);
 		assert(arity == get_irn_arity(header));
 		int new_arity = 0;
@@ -225,16 +293,16 @@ static void duplicate_block(ir_node *const block)
 	}
 }
 
-static void rewire_block(ir_node *const block, ir_node *const header)
+static void rewire_block(ir_node *const block, ir_node *const header, bool const peel)
 {
-	rewire_node(block, header);
+	rewire_node(block, header, peel);
 	unsigned const n_outs = get_irn_n_outs(block);
 	for (unsigned i = 0; i < n_outs; ++i) {
 		ir_node *const node = get_irn_out(block, i);
 		assert(!is_Block(node));
 		if (get_nodes_block(node) != block)
 			continue;
-		rewire_node(node, header);
+		rewire_node(node, header, peel);
 	}
 }
 
@@ -260,21 +328,13 @@ static unsigned find_optimal_factor(unsigned long number, unsigned max) {
 	return 0;
 }
 
-/**
- * walk trivial phis (with only one input) until another node is found
- */
-static ir_node* skip_trivial_phis(ir_node *start) {
-	if (is_Phi(start) && get_Phi_n_preds(start) == 1) {
-		return skip_trivial_phis(get_Phi_pred(start, 0));
-	}
-	return start;
-}
-
 /**
  * Analyzes loop and decides whether it should be unrolled or not and chooses a suitable unroll factor.
  *
  * Currently only loops featuring a counter variable with constant start, step and limit known at compile time
- * are considered for unrolling.
+ * are considered for unrolling. The induction variable and trip count
+ * recognition is shared with the other loop passes via the scalar
+ * evolution analysis.
  * Tries to find a divisor of the number of loop iterations which is smaller than the maximum unroll factor
  * and is a power of two. In this case, additional optimizations are possible.
  *
@@ -285,128 +345,53 @@ static ir_node* skip_trivial_phis(ir_node *start) {
  */
 static unsigned find_suitable_factor(ir_node *const header, unsigned max, bool *fully_unroll) {
 	unsigned const DONT_UNROLL = 0;
-	unsigned const n_outs = get_irn_n_outs(header);
-	unsigned factor = 1;
-	for (unsigned i = 0; i < n_outs; ++i) {
-		ir_node *const node = get_irn_out(header, i);
-		assert(!is_Block(node));
-		if (get_nodes_block(node) != header)
-			continue;
-
-		if (is_Cmp(node)) {
-
-			ir_relation cmp_rel = get_Cmp_relation(node);
-			if (cmp_rel == ir_relation_less_greater || cmp_rel == ir_relation_equal || cmp_rel & ir_relation_unordered) {
-				return DONT_UNROLL;
-			}
-
-			ir_tarval *tv_init = NULL;
-			ir_tarval *tv_step = NULL;
-			ir_tarval *tv_limit = NULL;
-
-			ir_node *header_phi;
-			ir_node *cmp_right = get_Cmp_right(node);
-			if (is_Const(cmp_right) && mode_is_int(get_irn_mode(cmp_right))) {
-				if (!is_Phi(get_Cmp_left(node))) {
-					return DONT_UNROLL;
-				}
-				// found Cmp(?, const)
-				header_phi = get_Cmp_left(node);
-				tv_limit = get_Const_tarval(get_Cmp_right(node));
-			} else {
-				return DONT_UNROLL;
-			}
-			int phi_preds = get_Phi_n_preds(header_phi);
-			ir_node *cnt_add = NULL;
-			for (int j = 0; j < phi_preds; j++) {
-				ir_node *phi_pred = get_Phi_pred(header_phi, j);
-				if (is_Const(phi_pred) && mode_is_int(get_irn_mode(cmp_right))) {
-					// found constant init for (possible) counter
-					ir_tarval *const_tv = get_Const_tarval(phi_pred);
-					if (tv_init == NULL || tarval_cmp(tv_init, const_tv) == ir_relation_equal) {
-						tv_init = const_tv;
-						continue;
-					}
-				}
-				phi_pred = skip_trivial_phis(phi_pred);
-				// is_binop() would find more cases, but we currently can only optimize further if we have an Add here
-				if (is_Add(phi_pred) && cnt_add == NULL) {
-					cnt_add = phi_pred;
-					ir_node *left = get_binop_left(phi_pred);
-					ir_node *right = get_binop_right(phi_pred);
-					if (is_Const(right) && is_Phi(left)) {
-						// found Add(phi, const)
-
-						bool found_constant_step = false;
-						// LCSSA construction builds additional phi nodes
-						do {
-							if (left == header_phi) {
-								found_constant_step = true;
-								tv_step = get_Const_tarval(right);
-								break;
-							}
-							left = get_Phi_pred(left, 0);
-
-						} while (is_Phi(left) && (get_Phi_n_preds(left) == 1 || left == header_phi));
-
-						if (found_constant_step) {
-							continue;
-						}
-					}
-					return DONT_UNROLL;
-				}
-				// multiple uses of the same loop counter increment/decrement
-				if (phi_pred == cnt_add) {
-					continue;
-				} else {
-					return DONT_UNROLL;
-				}
-			}
-
-			assert(tv_limit != NULL && tv_init != NULL && tv_step != NULL);
-
-			// normalize: use less or less_equal as relation
-			if (cmp_rel & ir_relation_greater) {
-				ir_tarval *tmp = tv_init;
-				tv_init = tv_limit;
-				tv_limit = tmp;
-				tv_step = tarval_neg(tv_step);
-				cmp_rel = get_inversed_relation(cmp_rel);
-			}
-
-			ir_tarval *tv_interval = tarval_sub(tv_limit, tv_init);
-			if (tarval_is_negative(tv_interval) || tarval_is_negative(tv_step)) {
-				return DONT_UNROLL;
-			}
-
-			ir_tarval *tv_one = new_tarval_from_long(1, get_tarval_mode(tv_interval));
-			// normalize: use less_equal as relation
-			if (!(cmp_rel & ir_relation_equal)) {
-				// interval -= 1
-				tarval_sub(tv_interval, tv_one);
-			}
+	scev_loop_info_t const *const info
+		= scev_get_loop_info(get_irn_loop(header), header);
+	if (info->trip_count < 0) {
+		return DONT_UNROLL;
+	}
+	long const loop_count = info->trip_count;
+	DB((dbg, LEVEL_3, "\tloop count: %ld\n", loop_count));
+	unsigned const factor = find_optimal_factor((unsigned long) loop_count, max);
+	if (factor == (unsigned long) loop_count) {
+		*fully_unroll = true;
+	}
+	return factor;
+}
 
-			assert(!tarval_is_null(tv_step));
-			// calculate loop iterations; add one iteration to count the first iteration
-			ir_tarval *tv_loop_count = (tarval_add(tarval_div(tv_interval, tv_step), tv_one));
-			long loop_count = get_tarval_long(tv_loop_count);
-			if (loop_count <= 0) {
-				return DONT_UNROLL;
-			}
+static size_t count_nodes(ir_loop *const loop);
 
-#ifdef DEBUG_libfirm
-			long limit = get_tarval_long(tv_limit);
-			long step = get_tarval_long(tv_step);
-			long init = get_tarval_long(tv_init);
-			DB((dbg, LEVEL_3 , "\tinit: %ld, step: %ld, limit: %ld, loop count: %ld\n", init, step, limit, loop_count));
-#endif
-			factor = find_optimal_factor((unsigned long) loop_count, max);
-			if (factor == (unsigned long) loop_count) {
-				*fully_unroll = true;
-			}
-			break;
-		}
+/**
+ * Chooses an unroll factor for a counted loop whose trip count is not
+ * known at compile time. Every duplicated body keeps its own exit check,
+ * so the loop can still stop after any copy and no separate remainder
+ * loop is needed for correctness; the duplicated checks take the place
+ * of a remainder loop and become well predictable. Duplication is only
+ * worth it for hot loops and is budgeted against the graph size.
+ */
+static unsigned find_runtime_factor(ir_loop *const loop, ir_node *const header, unsigned max) {
+	scev_loop_info_t const *const info
+		= scev_get_loop_info(get_irn_loop(header), header);
+	// only loops with a recognized counter are likely to run long enough
+	if (info->counter == NULL || info->trip_count >= 0) {
+		return 0;
+	}
+	ir_graph *const irg = get_irn_irg(header);
+	double const entry_freq = get_block_execfreq(get_irg_start_block(irg));
+	if (get_block_execfreq(header) < 4.0 * entry_freq) {
+		return 0;
+	}
+	// do not grow the graph by more than a fraction of its current size
+	size_t const size   = count_nodes(loop);
+	size_t const budget = get_irg_last_idx(irg) / 4;
+	unsigned factor = 1;
+	while (factor * 2 <= max && size * (factor * 2 - 1) <= budget) {
+		factor *= 2;
+	}
+	if (factor < 2) {
+		return 0;
 	}
+	DB((dbg, LEVEL_3, "\truntime unroll factor %u for %+F\n", factor, loop));
 	return factor;
 }
 
@@ -547,7 +532,7 @@ static void rewire_fully_unrolled(ir_loop *const loop, ir_node *header) {
 
 static unsigned n_loops_unrolled = 0;
 
-static bool unroll_loop(ir_loop *const loop, unsigned factor)
+static bool unroll_loop(ir_loop *const loop, unsigned max_factor)
 {
 	ir_node *const header = get_loop_header(loop);
 	if (header == NULL) {
@@ -558,7 +543,10 @@ static bool unroll_loop(ir_loop *const loop, unsigned factor)
 	DB((dbg, LEVEL_4, "\tidentified loop header %+F\n", header));
 
 	bool fully_unroll = false;
-	factor = find_suitable_factor(header, factor, &fully_unroll);
+	unsigned factor = find_suitable_factor(header, max_factor, &fully_unroll);
+	if (factor < 1) {
+		factor = find_runtime_factor(loop, header, max_factor);
+	}
 	if (factor < 1 || (factor == 1 && !fully_unroll)) {
 		return false;
 	}
@@ -594,7 +582,7 @@ static bool unroll_loop(ir_loop *const loop, unsigned factor)
 			loop_element const element = get_loop_element(loop, i);
 			if (*element.kind == k_ir_node) {
 				assert(is_Block(element.node));
-				rewire_block(element.node, header);
+				rewire_block(element.node, header, false);
 			}
 		}
 
@@ -663,11 +651,138 @@ void unroll_loops(ir_graph *const irg, unsigned factor, unsigned maxsize)
 	do {
 		reanalyze = false;
 		assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+		/* block frequencies budget the runtime unrolling */
+		ir_estimate_execfreq(irg);
 		ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+		unsigned const n_unrolled_before = n_loops_unrolled;
 		duplicate_innermost_loops(get_irg_loop(irg), factor, maxsize, true);
-		free_loop_information(irg);
+		/* the cache dies with the loop tree */
+		scev_free_info();
 		ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
-		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
+		/* only throw the loop tree away when a loop was actually unrolled */
+		if (n_loops_unrolled > n_unrolled_before) {
+			free_loop_information(irg);
+			clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
+		}
 	} while (reanalyze);
 	DB((dbg, LEVEL_1, "%+F: %d loops unrolled\n", irg, n_loops_unrolled));
 }
+
+/**
+ * Returns true if the loop is left through a conditional jump in its
+ * header, i.e. the loop is head controlled and runs its exit test before
+ * the first iteration.
+ */
+static bool header_exits_loop(ir_loop *const loop, ir_node *const header)
+{
+	unsigned const n_outs = get_irn_n_outs(header);
+	for (unsigned i = 0; i < n_outs; ++i) {
+		ir_node *const proj = get_irn_out(header, i);
+		if (!is_Proj(proj) || get_irn_mode(proj) != mode_X)
+			continue;
+		unsigned const n_proj_outs = get_irn_n_outs(proj);
+		for (unsigned j = 0; j < n_proj_outs; ++j) {
+			ir_node *const succ = get_irn_out(proj, j);
+			if (is_Block(succ) && !block_is_inside_loop(succ, loop))
+				return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Peel off the first iteration of the loop: a copy of the body is placed
+ * on the entry edges and runs at most once before control enters the
+ * original loop. The copied exit test sees the unchanged entry values,
+ * so constant arguments and dominating Confirms fold it away, and the
+ * remaining loop behaves like a foot-controlled one behind the copy.
+ */
+static void peel_loop(ir_loop *const loop, ir_node *const header)
+{
+	DB((dbg, LEVEL_2, "peel %+F\n", loop));
+
+	pset_new_init(&loop_blocks);
+	irg_walk_graph(get_irn_irg(header), firm_clear_link, NULL, NULL);
+	size_t const n_elements = get_loop_n_elements(loop);
+
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_node) {
+			assert(is_Block(element.node));
+			pset_new_insert(&loop_blocks, element.node);
+		}
+	}
+
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_node) {
+			assert(is_Block(element.node));
+			duplicate_block(element.node);
+		}
+	}
+
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_node) {
+			assert(is_Block(element.node));
+			rewire_block(element.node, header, true);
+		}
+	}
+	pset_new_destroy(&loop_blocks);
+}
+
+static unsigned n_loops_peeled = 0;
+
+static void peel_innermost_loops(ir_loop *const loop, unsigned const maxsize, bool const container)
+{
+	bool innermost = true;
+	size_t const n_elements = get_loop_n_elements(loop);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_loop) {
+			peel_innermost_loops(element.son, maxsize, false);
+			innermost = false;
+		}
+	}
+	if (!innermost || container)
+		return;
+
+	ir_node *const header = get_loop_header(loop);
+	if (header == NULL) {
+		DB((dbg, LEVEL_3, "\tunable to identify loop header for %+F, skip\n", loop));
+		return;
+	}
+	// foot controlled and endless loops gain nothing from peeling
+	if (!header_exits_loop(loop, header)) {
+		DB((dbg, LEVEL_3, "\tno exit test in the header of %+F, skip\n", loop));
+		return;
+	}
+	if (count_nodes(loop) > maxsize) {
+		DB((dbg, LEVEL_3, "\ttoo many nodes in %+F, skip\n", loop));
+		return;
+	}
+	peel_loop(loop, header);
+	++n_loops_peeled;
+}
+
+void peel_loops(ir_graph *const irg, unsigned const maxsize)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.loop-peeling");
+	n_loops_peeled = 0;
+	assure_lcssa(irg);
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS
+	                      | IR_GRAPH_PROPERTY_NO_BADS
+	                      | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
+	                      | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+	peel_innermost_loops(get_irg_loop(irg), maxsize, true);
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+	if (n_loops_peeled > 0) {
+		free_loop_information(irg);
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
+		/* fold the peeled exit tests: on the entry path their arguments
+		 * are often constant or covered by a dominating Confirm */
+		local_optimize_graph(irg);
+	}
+	DB((dbg, LEVEL_1, "%+F: %d loops peeled\n", irg, n_loops_peeled));
+}
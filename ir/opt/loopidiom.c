@@ -0,0 +1,390 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Recognize byte-set loops and replace them by memset calls.
+ *
+ * Matches counted loops whose body consists of a single byte store with a
+ * loop-invariant value to consecutive addresses, in the two canonical
+ * shapes frontends produce:
+ *
+ *   while (i != n) { p[i] = c; ++i; }     (condition block + body block)
+ *   do { p[i] = c; ++i; } while (i != n); (single block)
+ *
+ * Such loops are rewritten to a call of the compilerlib memset, which the
+ * runtime implements with wide/vectorized stores.
+ */
+#include "array.h"
+#include "ircons.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irloop_t.h"
+#include "irmode_t.h"
+#include "irnode_t.h"
+#include "iroptimize.h"
+#include "panic.h"
+#include "tv.h"
+#include "util.h"
+
+/** A recognized byte-set loop. */
+typedef struct idiom_env_t {
+	ir_loop *loop;      /**< the loop under inspection */
+	ir_node *store;     /**< the single byte Store */
+	ir_node *store_m;   /**< Proj M of the store */
+	ir_node *mem_phi;   /**< memory Phi in the header */
+	ir_node *counter;   /**< counter Phi in the header */
+	ir_node *next;      /**< counter increment */
+	ir_node *conv;      /**< optional Conv between counter and address */
+	ir_node *addr;      /**< address Add */
+	ir_node *base;      /**< invariant base address */
+	ir_node *value;     /**< invariant store value */
+	ir_node *limit;     /**< invariant iteration count */
+	ir_node *cmp;       /**< exit comparison */
+	ir_node *cond;      /**< exit Cond */
+	ir_node *exit_proj; /**< Proj X leaving the loop */
+	ir_node *stay_proj; /**< Proj X staying in the loop */
+	bool     valid;     /**< set to false when an alien node is found */
+} idiom_env_t;
+
+static bool changed;
+
+static bool block_in_loop(ir_loop const *const loop, ir_node const *const block)
+{
+	return get_irn_loop(block) == loop;
+}
+
+/** Returns true if @p node is defined outside of @p loop. */
+static bool is_invariant(ir_loop const *const loop, ir_node const *const node)
+{
+	return !block_in_loop(loop, get_nodes_block(node));
+}
+
+/**
+ * Check a Conv between counter and address computation. The rewrite models
+ * the loop as writing @p limit consecutive bytes, which matches the
+ * original addressing when the conversion does not change the counter
+ * value for the executed iterations: same width, or zero extension.
+ */
+static bool conv_is_harmless(ir_node const *const conv)
+{
+	ir_mode *const from = get_irn_mode(get_Conv_op(conv));
+	ir_mode *const to   = get_irn_mode(conv);
+	if (get_mode_size_bits(from) == get_mode_size_bits(to))
+		return true;
+	return !mode_is_signed(from)
+	    && get_mode_size_bits(from) < get_mode_size_bits(to);
+}
+
+/**
+ * Walker: reject any node inside the loop that is not part of the
+ * recognized pattern and reject pattern values leaking out of the loop.
+ */
+static void check_loop_node(ir_node *const node, void *const data)
+{
+	idiom_env_t *const env = (idiom_env_t*)data;
+	if (!env->valid || is_Block(node))
+		return;
+	if (!block_in_loop(env->loop, get_nodes_block(node)))
+		return;
+
+	/* memory state and control flow must belong to the pattern */
+	if (node == env->store || node == env->mem_phi || node == env->cond
+	 || node == env->exit_proj || node == env->stay_proj
+	 || node == env->store_m || is_Jmp(node))
+		return;
+	ir_mode *const mode = get_irn_mode(node);
+	if (mode == mode_M || mode == mode_X || mode == mode_T) {
+		env->valid = false;
+		return;
+	}
+
+	/* everything else becomes dead; it must not be observable outside */
+	foreach_out_edge(node, edge) {
+		ir_node *const user = get_edge_src_irn(edge);
+		if (is_Block(user))
+			continue;
+		if (!block_in_loop(env->loop, get_nodes_block(user))) {
+			env->valid = false;
+			return;
+		}
+	}
+}
+
+/**
+ * Build the memset method type (void*, int, size_t) -> void*.
+ */
+static ir_type *get_memset_methodtype(void)
+{
+	ir_mode *const offset_mode = get_reference_offset_mode(mode_P);
+	ir_mode *const size_mode   = find_unsigned_mode(offset_mode);
+	ir_type *const tp = new_type_method(3, 1, false, cc_cdecl_set,
+	                                    mtp_no_property);
+	set_method_param_type(tp, 0, get_type_for_mode(mode_P));
+	set_method_param_type(tp, 1, get_type_for_mode(mode_Is));
+	set_method_param_type(tp, 2, get_type_for_mode(size_mode));
+	set_method_res_type(tp, 0, get_type_for_mode(mode_P));
+	return tp;
+}
+
+/**
+ * Replace the recognized loop by a memset call in the preheader and force
+ * the loop exit. The dead loop body is left for the usual control flow
+ * cleanup.
+ */
+static void rewrite_to_memset(idiom_env_t *const env, int const entry_pos)
+{
+	ir_node  *const header = get_nodes_block(env->mem_phi);
+	ir_node  *const pre    = get_Block_cfgpred_block(header, entry_pos);
+	ir_graph *const irg    = get_irn_irg(header);
+	dbg_info *const dbgi   = get_irn_dbg_info(env->store);
+
+	/* trip count: the counter runs from 0 to limit */
+	ir_mode *const limit_mode  = get_irn_mode(env->limit);
+	ir_mode *const u_mode      = mode_is_signed(limit_mode)
+	                           ? find_unsigned_mode(limit_mode) : limit_mode;
+	ir_mode *const offset_mode = get_reference_offset_mode(mode_P);
+	ir_mode *const size_mode   = find_unsigned_mode(offset_mode);
+	ir_node *count = env->limit;
+	if (u_mode != limit_mode)
+		count = new_rd_Conv(dbgi, pre, count, u_mode);
+	if (u_mode != size_mode)
+		count = new_rd_Conv(dbgi, pre, count, size_mode);
+
+	ir_node *const value   = new_rd_Conv(dbgi, pre, env->value, mode_Is);
+	ir_type *const mtp     = get_memset_methodtype();
+	ir_entity *const ent   = create_compilerlib_entity("memset", mtp);
+	ir_node *const callee  = new_r_Address(irg, ent);
+	ir_node *const mem_in  = get_Phi_pred(env->mem_phi, entry_pos);
+	ir_node *const in[]    = { env->base, value, count };
+	ir_node *const call    = new_rd_Call(dbgi, pre, mem_in, callee,
+	                                     ARRAY_SIZE(in), in, mtp);
+	ir_node *const call_m  = new_r_Proj(call, mode_M, pn_Call_M);
+	set_Phi_pred(env->mem_phi, entry_pos, call_m);
+
+	/* route memory users of the store to the Phi: the remaining single
+	 * store execution of the do-while shape only re-writes a byte the
+	 * memset has set already and turns into a dead store */
+	foreach_out_edge_safe(env->store_m, edge) {
+		ir_node *const user = get_edge_src_irn(edge);
+		if (user != env->mem_phi)
+			set_irn_n(user, get_edge_src_pos(edge), env->mem_phi);
+	}
+
+	/* force the exit edge; control flow optimization removes the rest */
+	unsigned const exit_pn = get_Proj_num(env->exit_proj);
+	ir_tarval *const tv = exit_pn == pn_Cond_true ? tarval_b_true
+	                                              : tarval_b_false;
+	set_irn_n(env->cond, 0, new_r_Const(irg, tv));
+
+	changed = true;
+}
+
+/**
+ * Try to recognize a byte-set loop around the given Store and rewrite it.
+ */
+static void try_rewrite_store_loop(ir_node *const store)
+{
+	ir_node *const block = get_nodes_block(store);
+	ir_loop *const loop  = get_irn_loop(block);
+	if (loop == NULL || loop == get_irg_loop(get_irn_irg(store)))
+		return;
+	if (get_loop_n_elements(loop) > 2)
+		return;
+
+	idiom_env_t env = { .loop = loop, .store = store, .valid = true };
+
+	/* a single non-volatile byte store of an invariant value */
+	if (get_Store_volatility(store) != volatility_non_volatile)
+		return;
+	env.value = get_Store_value(store);
+	if (get_mode_size_bits(get_irn_mode(env.value)) != 8
+	 || !is_invariant(loop, env.value))
+		return;
+
+	/* address: invariant base plus counter */
+	env.addr = get_Store_ptr(store);
+	if (!is_Add(env.addr) || !block_in_loop(loop, get_nodes_block(env.addr)))
+		return;
+	env.base = get_Add_left(env.addr);
+	ir_node *idx = get_Add_right(env.addr);
+	if (!mode_is_reference(get_irn_mode(env.base))) {
+		ir_node *const t = env.base;
+		env.base = idx;
+		idx      = t;
+	}
+	if (!mode_is_reference(get_irn_mode(env.base))
+	 || !is_invariant(loop, env.base))
+		return;
+	if (is_Conv(idx)) {
+		if (!conv_is_harmless(idx))
+			return;
+		env.conv = idx;
+		idx      = get_Conv_op(idx);
+	}
+	env.counter = idx;
+
+	/* counter: Phi(0, counter + 1) in the loop header */
+	if (!is_Phi(env.counter) || get_Phi_n_preds(env.counter) != 2
+	 || !block_in_loop(loop, get_nodes_block(env.counter)))
+		return;
+	ir_node *const header = get_nodes_block(env.counter);
+	if (get_Block_n_cfgpreds(header) != 2)
+		return;
+	int entry_pos = -1;
+	for (int i = 0; i < 2; ++i) {
+		if (!block_in_loop(loop, get_Block_cfgpred_block(header, i)))
+			entry_pos = i;
+	}
+	if (entry_pos < 0)
+		return;
+	int const back_pos = 1 - entry_pos;
+	ir_node *const start = get_Phi_pred(env.counter, entry_pos);
+	env.next = get_Phi_pred(env.counter, back_pos);
+	if (!is_Const(start) || !tarval_is_null(get_Const_tarval(start)))
+		return;
+	if (!is_Add(env.next))
+		return;
+	ir_node *const step = get_Add_right(env.next);
+	if (get_Add_left(env.next) != env.counter || !is_Const(step)
+	 || !tarval_is_one(get_Const_tarval(step)))
+		return;
+
+	/* memory: Phi(entry, store) in the header */
+	env.mem_phi = get_Store_mem(store);
+	if (!is_Phi(env.mem_phi) || get_nodes_block(env.mem_phi) != header)
+		return;
+	env.store_m = NULL;
+	foreach_out_edge(store, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (is_Proj(proj) && get_irn_mode(proj) == mode_M)
+			env.store_m = proj;
+	}
+	if (env.store_m == NULL
+	 || get_Phi_pred(env.mem_phi, back_pos) != env.store_m)
+		return;
+
+	/* exit condition: counter (or its increment) compared to an
+	 * invariant limit */
+	ir_node *cmp = NULL;
+	foreach_out_edge(env.next, edge) {
+		ir_node *const user = get_edge_src_irn(edge);
+		if (is_Cmp(user))
+			cmp = user;
+	}
+	bool cmp_on_next = cmp != NULL;
+	if (!cmp_on_next) {
+		foreach_out_edge(env.counter, edge) {
+			ir_node *const user = get_edge_src_irn(edge);
+			if (is_Cmp(user))
+				cmp = user;
+		}
+	}
+	if (cmp == NULL || !block_in_loop(loop, get_nodes_block(cmp)))
+		return;
+	env.cmp = cmp;
+	/* the counter may sit on either side of the (normalized) Cmp */
+	ir_node *const cmp_val = cmp_on_next ? env.next : env.counter;
+	ir_relation rel = get_Cmp_relation(cmp);
+	if (get_Cmp_left(cmp) == cmp_val) {
+		env.limit = get_Cmp_right(cmp);
+	} else if (get_Cmp_right(cmp) == cmp_val) {
+		env.limit = get_Cmp_left(cmp);
+		rel       = get_inversed_relation(rel);
+	} else {
+		return;
+	}
+	if (!is_invariant(loop, env.limit))
+		return;
+
+	/* The rewrite assumes the loop writes exactly limit bytes. This holds
+	 * when the counter is tested before the store (while shape, on the
+	 * counter itself) or when the incremented counter is tested for
+	 * equality after the store (do-while shape). A less-than after the
+	 * store would run once for a zero limit and is rejected. */
+	ir_mode *const counter_mode = get_irn_mode(env.counter);
+	bool const is_while_shape = get_nodes_block(cmp) == header
+	                         && block != header;
+	if (is_while_shape) {
+		if (cmp_on_next)
+			return;
+		if (rel != ir_relation_less_greater
+		 && !(rel == ir_relation_less && !mode_is_signed(counter_mode)))
+			return;
+	} else {
+		if (!cmp_on_next || rel != ir_relation_less_greater)
+			return;
+	}
+
+	/* the Cmp must drive the loop exit */
+	ir_node *cond = NULL;
+	foreach_out_edge(cmp, edge) {
+		ir_node *const user = get_edge_src_irn(edge);
+		if (cond != NULL || !is_Cond(user)) {
+			cond = NULL;
+			break;
+		}
+		cond = user;
+	}
+	if (cond == NULL)
+		return;
+	env.cond = cond;
+	foreach_out_edge(cond, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		assert(is_Proj(proj));
+		ir_node *succ = NULL;
+		foreach_out_edge(proj, proj_edge) {
+			succ = get_edge_src_irn(proj_edge);
+		}
+		if (succ == NULL || !is_Block(succ))
+			return;
+		if (block_in_loop(loop, succ)) {
+			env.stay_proj = proj;
+		} else {
+			env.exit_proj = proj;
+		}
+	}
+	if (env.exit_proj == NULL || env.stay_proj == NULL)
+		return;
+	/* both accepted relations describe staying in the loop */
+	if (get_Proj_num(env.exit_proj) != pn_Cond_false)
+		return;
+
+	/* no other side effects or live-out values in the loop */
+	irg_walk_graph(get_irn_irg(store), check_loop_node, NULL, &env);
+	if (!env.valid)
+		return;
+
+	rewrite_to_memset(&env, entry_pos);
+}
+
+/** Walker: collect all Store nodes; they are inspected after the walk
+ * because the pattern check walks the graph itself. */
+static void collect_stores(ir_node *const node, void *const data)
+{
+	ir_node ***const stores = (ir_node***)data;
+	if (is_Store(node))
+		ARR_APP1(ir_node*, *stores, node);
+}
+
+void opt_loop_idiom(ir_graph *const irg)
+{
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+	                         | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
+	                         | IR_GRAPH_PROPERTY_NO_BADS);
+
+	changed = false;
+	ir_node **stores = NEW_ARR_F(ir_node*, 0);
+	irg_walk_graph(irg, NULL, collect_stores, &stores);
+	for (size_t i = 0, n = ARR_LEN(stores); i < n; ++i) {
+		try_rewrite_store_loop(stores[i]);
+	}
+	DEL_ARR_F(stores);
+
+	confirm_irg_properties(irg, changed ? IR_GRAPH_PROPERTIES_NONE
+	                                    : IR_GRAPH_PROPERTIES_ALL);
+}
@@ -0,0 +1,401 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Merge adjacent Load/Store operations into wider accesses.
+ *
+ * Unrolled copy and initialization loops leave behind chains of small
+ * stores to consecutive addresses.  This pass recognizes such chains and
+ * replaces them by single accesses of up to register width, using the
+ * existing integer modes.  Merged accesses are marked unaligned, so the
+ * pass is only a win on targets where misaligned accesses are cheap.
+ */
+#include "array.h"
+#include "debug.h"
+#include "ircons.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irmemory.h"
+#include "irmode_t.h"
+#include "irnode_t.h"
+#include "irnodeset.h"
+#include "iroptimize.h"
+#include "panic.h"
+#include "tv.h"
+#include "type_t.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+/** maximum size of a merged access in bytes */
+#define MAX_MERGE_BYTES 8
+
+typedef enum access_kind_t {
+	ACCESS_BAD,  /**< store cannot take part in a merged run */
+	ACCESS_SET,  /**< store of a constant */
+	ACCESS_COPY, /**< store of a value loaded in the same block */
+} access_kind_t;
+
+typedef struct access_t {
+	ir_node *store;
+	ir_node *load;       /**< for copies the Load feeding the Store */
+	ir_node *base;       /**< base address of the store */
+	long     offset;     /**< store offset in bytes relative to base */
+	ir_node *src_base;   /**< for copies the base address of the load */
+	long     src_offset;
+	unsigned size;       /**< access size in bytes */
+} access_t;
+
+typedef struct merge_env_t {
+	ir_node    **stores; /**< all Store nodes of the graph */
+	ir_nodeset_t merged; /**< stores already replaced by a wider access */
+	bool         changed;
+} merge_env_t;
+
+/**
+ * Decomposes an address into a base node and a constant byte offset.
+ * A simplified version of the decomposition done in ldstopt.
+ */
+static ir_node *get_base_and_offset(ir_node *ptr, long *offset)
+{
+	long     off  = 0;
+	ir_mode *mode = get_irn_mode(ptr);
+	for (;;) {
+		if (is_Add(ptr)) {
+			ir_node *right = get_Add_right(ptr);
+			if (get_irn_mode(get_Add_left(ptr)) != mode || !is_Const(right))
+				break;
+			off += get_Const_long(right);
+			ptr  = get_Add_left(ptr);
+		} else if (is_Sub(ptr)) {
+			ir_node *right = get_Sub_right(ptr);
+			if (!is_Const(right))
+				break;
+			off -= get_Const_long(right);
+			ptr  = get_Sub_left(ptr);
+		} else if (is_Member(ptr)) {
+			ir_entity *entity = get_Member_entity(ptr);
+			if (get_type_state(get_entity_owner(entity)) != layout_fixed)
+				break;
+			off += get_entity_offset(entity);
+			ptr  = get_Member_ptr(ptr);
+		} else {
+			break;
+		}
+	}
+	*offset = off;
+	return ptr;
+}
+
+/**
+ * Checks whether @p store can take part in a merged run and fills in the
+ * access description.
+ */
+static access_kind_t classify_store(ir_node *store, access_t *access)
+{
+	if (get_Store_volatility(store) != volatility_non_volatile
+	    || ir_throws_exception(store))
+		return ACCESS_BAD;
+	ir_node *value = get_Store_value(store);
+	ir_mode *mode  = get_irn_mode(value);
+	if (!mode_is_int(mode))
+		return ACCESS_BAD;
+	unsigned size = get_mode_size_bytes(mode);
+	if (size != 1 && size != 2 && size != 4)
+		return ACCESS_BAD;
+
+	access->store  = store;
+	access->load   = NULL;
+	access->base   = get_base_and_offset(get_Store_ptr(store), &access->offset);
+	access->size   = size;
+	if (is_Const(value))
+		return ACCESS_SET;
+
+	if (!is_Proj(value) || get_irn_n_edges(value) != 1)
+		return ACCESS_BAD;
+	ir_node *load = get_Proj_pred(value);
+	if (!is_Load(load) || get_Load_volatility(load) != volatility_non_volatile
+	    || ir_throws_exception(load) || get_Load_mode(load) != mode
+	    || get_nodes_block(load) != get_nodes_block(store)
+	    || get_irn_n_edges(load) != 2)
+		return ACCESS_BAD;
+	/* the load must be private to this store: its memory result is the
+	 * store's memory input */
+	ir_node *store_mem = get_Store_mem(store);
+	if (!is_Proj(store_mem) || get_Proj_pred(store_mem) != load
+	    || get_irn_n_edges(store_mem) != 1)
+		return ACCESS_BAD;
+
+	access->load     = load;
+	access->src_base = get_base_and_offset(get_Load_ptr(load),
+	                                       &access->src_offset);
+	return ACCESS_COPY;
+}
+
+/**
+ * Walks one step down the memory chain of @p cur. Returns true and fills
+ * in @p next if the only user of the store's memory result is another
+ * access of the same kind.
+ */
+static bool chain_next(const access_t *cur, access_kind_t kind,
+                       access_t *next)
+{
+	ir_node *store = cur->store;
+	if (get_irn_n_edges(store) != 1)
+		return false;
+	ir_node *proj = get_edge_src_irn(get_irn_out_edge_first(store));
+	if (!is_Proj(proj) || get_irn_mode(proj) != mode_M
+	    || get_irn_n_edges(proj) != 1)
+		return false;
+	ir_node *user = get_edge_src_irn(get_irn_out_edge_first(proj));
+
+	ir_node *next_store;
+	if (kind == ACCESS_COPY) {
+		/* copy chains alternate: ... -> Store -> Load -> Store -> ... */
+		if (!is_Load(user) || get_Load_mem(user) != proj)
+			return false;
+		ir_node *res = NULL;
+		foreach_out_edge(user, edge) {
+			ir_node *load_proj = get_edge_src_irn(edge);
+			ir_mode *proj_mode = get_irn_mode(load_proj);
+			if (proj_mode != mode_M && proj_mode != mode_X)
+				res = load_proj;
+		}
+		if (res == NULL || get_irn_n_edges(res) != 1)
+			return false;
+		next_store = get_edge_src_irn(get_irn_out_edge_first(res));
+		if (!is_Store(next_store) || get_Store_value(next_store) != res)
+			return false;
+	} else {
+		if (!is_Store(user) || get_Store_mem(user) != proj)
+			return false;
+		next_store = user;
+	}
+	if (classify_store(next_store, next) != kind)
+		return false;
+	return kind != ACCESS_COPY || next->load == user;
+}
+
+/**
+ * Checks whether two chain-consecutive accesses describe the same kind of
+ * run: same block, same bases, same size and for copies the same distance
+ * between source and destination.
+ */
+static bool accesses_compatible(const access_t *prev, const access_t *next)
+{
+	if (get_nodes_block(next->store) != get_nodes_block(prev->store)
+	    || next->base != prev->base || next->size != prev->size)
+		return false;
+	if (prev->load != NULL) {
+		if (next->src_base != prev->src_base
+		    || next->src_offset - prev->src_offset
+		       != next->offset - prev->offset)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * Checks whether @p access is the head of its chain, i.e. whether it is
+ * not preceded in the memory chain by a mergeable adjacent access. Chains
+ * are only processed starting at their head.
+ */
+static bool is_chain_head(const access_t *access, access_kind_t kind)
+{
+	ir_node *mem = kind == ACCESS_COPY ? get_Load_mem(access->load)
+	                                   : get_Store_mem(access->store);
+	if (!is_Proj(mem) || get_irn_mode(mem) != mode_M)
+		return true;
+	ir_node *pred = get_Proj_pred(mem);
+	if (!is_Store(pred))
+		return true;
+	access_t prev;
+	if (classify_store(pred, &prev) != kind)
+		return true;
+	access_t next;
+	if (!chain_next(&prev, kind, &next) || next.store != access->store)
+		return true;
+	long delta = next.offset - prev.offset;
+	if (delta != (long)prev.size && delta != -(long)prev.size)
+		return true;
+	return !accesses_compatible(&prev, &next);
+}
+
+static ir_node *get_store_mem_proj(ir_node *store)
+{
+	foreach_out_edge(store, edge) {
+		ir_node *proj = get_edge_src_irn(edge);
+		if (is_Proj(proj) && get_irn_mode(proj) == mode_M)
+			return proj;
+	}
+	return NULL;
+}
+
+static ir_mode *get_merge_mode(unsigned bytes)
+{
+	switch (bytes) {
+	case 2: return mode_Hu;
+	case 4: return mode_Iu;
+	case 8: return mode_Lu;
+	}
+	panic("invalid merged access size");
+}
+
+/**
+ * Tries to replace the @p n_members chain-consecutive accesses starting at
+ * run[i] by a single wide access. All graph checks are performed before
+ * any node is built, so a failed attempt leaves the graph untouched.
+ */
+static bool merge_group(merge_env_t *env, access_t *run, size_t i,
+                        unsigned n_members, access_kind_t kind, long dir)
+{
+	access_t *first = &run[i];
+	access_t *last  = &run[i + n_members - 1];
+	access_t *low   = dir > 0 ? first : last;
+	unsigned  total = n_members * first->size;
+	ir_node  *tail_proj = get_store_mem_proj(last->store);
+	if (tail_proj == NULL)
+		return false;
+
+	ir_node  *block   = get_nodes_block(first->store);
+	ir_graph *irg     = get_irn_irg(block);
+	ir_mode  *mode    = get_merge_mode(total);
+	dbg_info *dbgi    = get_irn_dbg_info(low->store);
+	ir_node  *dst_ptr = get_Store_ptr(low->store);
+
+	ir_node *new_store;
+	if (kind == ACCESS_SET) {
+		/* merging constants is only possible if the written pattern is one
+		 * repeated byte: that is invariant under the target's byte order */
+		ir_tarval    *head_tv = get_Const_tarval(get_Store_value(first->store));
+		unsigned char byte    = get_tarval_sub_bits(head_tv, 0);
+		for (unsigned j = 0; j < n_members; ++j) {
+			ir_tarval *tv = get_Const_tarval(get_Store_value(run[i+j].store));
+			for (unsigned o = 0; o < first->size; ++o) {
+				if (get_tarval_sub_bits(tv, o) != byte)
+					return false;
+			}
+		}
+		uint64_t bits = 0;
+		for (unsigned o = 0; o < total; ++o)
+			bits = (bits << 8) | byte;
+		ir_node *value  = new_r_Const(irg, new_tarval_from_long((long)bits,
+		                                                        mode));
+		ir_node *in_mem = get_Store_mem(first->store);
+		new_store = new_rd_Store(dbgi, block, in_mem, dst_ptr, value,
+		                         get_unknown_type(), cons_unaligned);
+	} else {
+		/* the merged load reads all bytes before any is written, so the
+		 * whole source and destination ranges must be independent */
+		ir_node *src_ptr = get_Load_ptr(low->load);
+		if (get_alias_relation(src_ptr, get_unknown_type(), total,
+		                       dst_ptr, get_unknown_type(), total)
+		    != ir_no_alias)
+			return false;
+		ir_node *in_mem = get_Load_mem(first->load);
+		ir_node *load   = new_rd_Load(get_irn_dbg_info(low->load), block,
+		                              in_mem, src_ptr, mode,
+		                              get_unknown_type(), cons_unaligned);
+		ir_node *load_mem = new_r_Proj(load, mode_M, pn_Load_M);
+		ir_node *load_res = new_r_Proj(load, mode, pn_Load_res);
+		new_store = new_rd_Store(dbgi, block, load_mem, dst_ptr, load_res,
+		                         get_unknown_type(), cons_unaligned);
+	}
+	exchange(tail_proj, new_r_Proj(new_store, mode_M, pn_Store_M));
+	for (unsigned j = 0; j < n_members; ++j)
+		ir_nodeset_insert(&env->merged, run[i+j].store);
+
+	DB((dbg, LEVEL_1, "merged %u %s accesses into %+F\n", n_members,
+	    kind == ACCESS_SET ? "set" : "copy", new_store));
+	env->changed = true;
+	return true;
+}
+
+/**
+ * Splits a run of adjacent accesses into power-of-two sized groups of at
+ * most MAX_MERGE_BYTES and merges each group.
+ */
+static void merge_run(merge_env_t *env, access_t *run, access_kind_t kind,
+                      long dir)
+{
+	size_t n = ARR_LEN(run);
+	for (size_t i = 0; i < n;) {
+		unsigned max = 1;
+		for (unsigned k = 2;
+		     k * run[0].size <= MAX_MERGE_BYTES && i + k <= n; k *= 2)
+			max = k;
+		unsigned k;
+		for (k = max; k >= 2; k /= 2) {
+			if (merge_group(env, run, i, k, kind, dir))
+				break;
+		}
+		i += k >= 2 ? k : 1;
+	}
+}
+
+static void handle_chain(merge_env_t *env, ir_node *store)
+{
+	if (ir_nodeset_contains(&env->merged, store))
+		return;
+	access_t head;
+	access_kind_t kind = classify_store(store, &head);
+	if (kind == ACCESS_BAD)
+		return;
+	if (!is_chain_head(&head, kind))
+		return; /* handled when starting at the chain head */
+
+	/* collect the longest run of adjacent accesses following the head;
+	 * the address must advance by the access size in one fixed direction */
+	access_t *run = NEW_ARR_F(access_t, 1);
+	run[0] = head;
+	long dir = 0;
+	for (access_t cur = head;;) {
+		access_t next;
+		if (!chain_next(&cur, kind, &next)
+		    || !accesses_compatible(&cur, &next))
+			break;
+		long delta = next.offset - cur.offset;
+		if (dir == 0) {
+			if (delta != (long)head.size && delta != -(long)head.size)
+				break;
+			dir = delta;
+		} else if (delta != dir) {
+			break;
+		}
+		ARR_APP1(access_t, run, next);
+		cur = next;
+	}
+	if (ARR_LEN(run) > 1)
+		merge_run(env, run, kind, dir);
+	DEL_ARR_F(run);
+}
+
+static void collect_stores(ir_node *node, void *data)
+{
+	merge_env_t *env = (merge_env_t*)data;
+	if (is_Store(node))
+		ARR_APP1(ir_node*, env->stores, node);
+}
+
+void opt_merge_mem(ir_graph *irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.mergemem");
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
+
+	merge_env_t env = { .stores = NEW_ARR_F(ir_node*, 0), .changed = false };
+	ir_nodeset_init(&env.merged);
+	/* collect first: merging modifies the memory chains being walked */
+	irg_walk_graph(irg, NULL, collect_stores, &env);
+	for (size_t i = 0, n = ARR_LEN(env.stores); i < n; ++i)
+		handle_chain(&env, env.stores[i]);
+	DEL_ARR_F(env.stores);
+	ir_nodeset_destroy(&env.merged);
+
+	confirm_irg_properties(irg, env.changed
+	                       ? IR_GRAPH_PROPERTIES_CONTROL_FLOW
+	                       : IR_GRAPH_PROPERTIES_ALL);
+}
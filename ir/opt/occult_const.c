@@ -18,7 +18,6 @@
 #include "irgopt.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
-#include "irnodemap.h"
 #include "iropt_t.h"
 #include "iroptimize.h"
 #include "tv.h"
@@ -26,11 +25,6 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 
-typedef struct env_t {
-	bool       changed;
-	ir_nodemap dca;
-} env_t;
-
 static void occult_const_opt_walker(ir_node *node, void *data)
 {
 	/* Ignore already const nodes */
@@ -41,14 +35,14 @@ static void occult_const_opt_walker(ir_node *node, void *data)
 	if (!mode_is_data(get_irn_mode(node)))
 		return;
 
-	env_t   *env = (env_t*)data;
-	bitinfo *vrp = get_bitinfo(node);
-	if (vrp == NULL) {
+	bool    *changed = (bool*)data;
+	bitinfo *vrp     = get_bitinfo(node);
+	if (vrp == NULL || vrp->dc == NULL) {
 		DB((dbg, LEVEL_4, "No VRP info: %+F\n", node));
 		return;
 	}
 
-	ir_tarval *dc                      = ir_nodemap_get(ir_tarval, &env->dca, node);
+	ir_tarval *dc                      = vrp->dc;
 	ir_tarval *not_const_bits          = tarval_eor(vrp->o, vrp->z);
 	ir_tarval *relevant_not_const_bits = tarval_and(dc, not_const_bits);
 	if (!tarval_is_null(relevant_not_const_bits)) {
@@ -63,12 +57,7 @@ static void occult_const_opt_walker(ir_node *node, void *data)
 	DB((dbg, LEVEL_2, "Occult Const found: %+F -> %+F dc=%T, z=%T, o=%T\n",
 	    node, cnst, dc, vrp->z, vrp->o));
 	exchange(node, cnst);
-	env->changed = true;
-}
-
-static void fill_nodemap(ir_node *node, void *data) {
-	ir_nodemap *map = data;
-	ir_nodemap_insert_fast(map, node, get_irn_link(node));
+	*changed = true;
 }
 
 void occult_consts(ir_graph *irg)
@@ -76,21 +65,12 @@ void occult_consts(ir_graph *irg)
 	FIRM_DBG_REGISTER(dbg, "firm.opt.occults");
 
 	constbits_analyze(irg);
-
-	env_t env;
-	memset(&env, 0, sizeof(env));
-
-	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
 	dca_analyze(irg);
-	ir_nodemap_init(&env.dca, irg);
-	irg_walk_graph(irg, fill_nodemap, 0, &env.dca);
-	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
-
-	irg_walk_graph(irg, occult_const_opt_walker, 0, &env);
 
-	ir_nodemap_destroy(&env.dca);
+	bool changed = false;
+	irg_walk_graph(irg, occult_const_opt_walker, 0, &changed);
 
 	constbits_clear(irg);
 	confirm_irg_properties(irg,
-	                       env.changed ? IR_GRAPH_PROPERTIES_NONE : IR_GRAPH_PROPERTIES_ALL);
+	                       changed ? IR_GRAPH_PROPERTIES_NONE : IR_GRAPH_PROPERTIES_ALL);
 }
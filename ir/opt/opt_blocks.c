@@ -13,6 +13,7 @@
  */
 #include "array.h"
 #include "debug.h"
+#include "hashptr.h"
 #include "ircons.h"
 #include "irgmod.h"
 #include "irgraph_t.h"
@@ -611,6 +612,67 @@ static void propagate(environment_t *env)
 	}
 }
 
+/**
+ * Compute a structural signature for a block: the multiset of opcode keys
+ * on its initial wait queue, i.e. its control flow root and all live-out
+ * roots. Congruent blocks always have equal signatures, because the
+ * refinement compares exactly these nodes by their opcode keys.
+ *
+ * @param bl   the block
+ * @param env  the environment
+ */
+static unsigned block_signature(block_t *bl, environment_t *env)
+{
+	unsigned sig = 0;
+
+	list_for_each_entry(node_t, node, &bl->nodes, node_list) {
+		sig += hash_ptr(opcode(node, env)) * 9;
+	}
+	return sig;
+}
+
+/**
+ * Split all partitions by the block signatures before the refinement
+ * starts. Blocks with different signatures can never be melded, so this
+ * keeps them from entering the expensive pairwise refinement together,
+ * which matters on machine-generated code with hundreds of similar
+ * blocks per meet block.
+ *
+ * @param env  the environment
+ */
+static void pre_partition_by_signature(environment_t *env)
+{
+	list_for_each_entry_safe(partition_t, part, next, &env->partitions, part_list) {
+		listmap_t       map;
+		listmap_entry_t *iter;
+
+		if (part->n_blocks < 2)
+			continue;
+
+		/* Let map be an empty mapping from signatures to (local) list of blocks. */
+		listmap_init(&map);
+		list_for_each_entry_safe(block_t, bl, next_bl, &part->blocks, block_list) {
+			void            *id    = INT_TO_PTR(block_signature(bl, env));
+			listmap_entry_t *entry = listmap_find(&map, id);
+
+			bl->next    = entry->list;
+			entry->list = bl;
+		}
+
+		/* for all sets S except one in the range of map do */
+		for (iter = map.values; iter != NULL; iter = iter->next) {
+			if (iter->next == NULL) {
+				/* this is the last entry, ignore */
+				break;
+			}
+
+			/* Add SPLIT( X, S ) to P. */
+			split(part, iter->list, env);
+		}
+		listmap_term(&map);
+	}
+}
+
 /**
  * Map a block to the phi[block->input] live-trough.
  */
@@ -1211,6 +1273,10 @@ void shape_blocks(ir_graph *irg)
 	partition_for_end_block(get_irg_end_block(irg), &env);
 #endif
 
+	/* split by cheap signatures first, so only real candidates enter the
+	 * expensive refinement */
+	pre_partition_by_signature(&env);
+
 	propagate_live_troughs(&env);
 	while (! list_empty(&env.partitions))
 		propagate(&env);
@@ -30,11 +30,13 @@
 #include "iropt_t.h"
 #include "iroptimize.h"
 #include "irouts_t.h"
+#include "irprofile.h"
 #include "irprog_t.h"
 #include "irtools.h"
 #include "list.h"
 #include "opt_init.h"
-#include "pmap.h"
+#include "opt_inline.h"
+#include "pmap_new.h"
 #include "pqueue.h"
 #include "xmalloc.h"
 #include <assert.h>
@@ -146,6 +148,8 @@ static void find_addr(ir_node *node, void *env)
 	}
 }
 
+static bool graph_inlinable(ir_graph *called_graph);
+
 /**
  * Check if we can inline a given call.
  * Currently, we cannot inline two cases:
@@ -218,10 +222,7 @@ static bool can_inline(ir_node *call, ir_graph *called_graph)
 		}
 	}
 
-	bool res = true;
-	irg_walk_graph(called_graph, find_addr, NULL, &res);
-
-	return res;
+	return graph_inlinable(called_graph);
 }
 
 /**
@@ -310,7 +311,7 @@ static void copy_parameter_entities(ir_node *call, ir_graph *called_graph)
 }
 
 /* Inlines a method at the given call site. */
-static bool inline_method(ir_node *const call, ir_graph *called_graph)
+bool inline_method(ir_node *const call, ir_graph *called_graph)
 {
 	/* we cannot inline some types of calls */
 	if (!can_inline(call, called_graph))
@@ -648,6 +649,8 @@ typedef struct {
 	unsigned  n_callers_orig;    /**< for statistics */
 	unsigned  got_inline:1;      /**< Set, if at least one call inside this graph was inlined. */
 	unsigned  recursive:1;       /**< Set, if this function is self recursive. */
+	unsigned  inlinable_checked:1; /**< Set, if the inlinable flag is valid. */
+	unsigned  inlinable:1;       /**< Cached verdict of graph_inlinable(). */
 } inline_irg_env;
 
 /**
@@ -667,9 +670,43 @@ static inline_irg_env *alloc_inline_irg_env(void)
 	env->n_callers_orig    = 0;
 	env->got_inline        = 0;
 	env->recursive         = 0;
+	env->inlinable_checked = 0;
+	env->inlinable         = 0;
 	return env;
 }
 
+/**
+ * Checks the inlining conditions that depend on the callee graph alone:
+ * taking the address of a block or of a value parameter and the use of
+ * alloca prevent inlining regardless of the call site (see find_addr()).
+ *
+ * The walk is linear in the callee size and the same callee is queried
+ * once per call site, so the verdict is cached in its inline environment.
+ * Inlining into the callee cannot invalidate it: graphs containing one of
+ * the offending constructs are never inlined themselves, so none of them
+ * can appear through inlining.
+ */
+/** Set while inline_functions() keeps inline environments in the irg links;
+ * only then may graph_inlinable() use its cache. */
+static bool inline_irg_envs_valid;
+
+static bool graph_inlinable(ir_graph *called_graph)
+{
+	inline_irg_env *env = inline_irg_envs_valid
+		? (inline_irg_env*)get_irg_link(called_graph) : NULL;
+	if (env != NULL && env->inlinable_checked)
+		return env->inlinable;
+
+	bool res = true;
+	irg_walk_graph(called_graph, find_addr, NULL, &res);
+
+	if (env != NULL) {
+		env->inlinable_checked = 1;
+		env->inlinable         = res;
+	}
+	return res;
+}
+
 typedef struct walker_env {
 	inline_irg_env *x;              /**< the inline environment */
 	bool            ignore_callers; /**< if set, do change callers data */
@@ -955,11 +992,32 @@ static int calc_inline_benefice(call_entry *entry, ir_graph *callee)
 	if (callee_env->n_call_nodes == 0)
 		weight += 400;
 
-	/** it's important to inline inner loops first */
-	if (entry->loop_depth > 30)
-		weight += 30 * 1024;
-	else
-		weight += entry->loop_depth * 1024;
+	/* it's important to inline hot call sites first: prefer measured block
+	 * execution counts and fall back to the loop depth as static estimate.
+	 * Blocks created by earlier inlining have no counts and use the
+	 * fallback, too. */
+	bool have_hotness = false;
+	if (ir_profile_has_data()) {
+		uint32_t const entry_count = ir_profile_get_block_execcount(
+				get_irg_start_block(current_ir_graph));
+		uint32_t const block_count = ir_profile_get_block_execcount(
+				get_nodes_block(call));
+		if (entry_count > 0 && block_count > 0) {
+			/* executions of the call per caller invocation, on the same
+			 * scale and with the same cap as the loop depth estimate */
+			uint32_t hotness = block_count / entry_count;
+			if (hotness > 30)
+				hotness = 30;
+			weight += hotness * 1024;
+			have_hotness = true;
+		}
+	}
+	if (!have_hotness) {
+		if (entry->loop_depth > 30)
+			weight += 30 * 1024;
+		else
+			weight += entry->loop_depth * 1024;
+	}
 
 	/*
 	 * All arguments constant is probably a good sign, give an extra bonus
@@ -1064,7 +1122,7 @@ static void maybe_push_call(pqueue_t *pqueue, call_entry *call,
  *                 map containing copied of recursive graphs
  */
 static void inline_into(ir_graph *irg, unsigned maxsize,
-                        int inline_threshold, pmap *copied_graphs)
+                        int inline_threshold, pmap_new_t *copied_graphs)
 {
 	inline_irg_env *env = (inline_irg_env*)get_irg_link(irg);
 	if (env->n_call_nodes == 0)
@@ -1102,7 +1160,7 @@ static void inline_into(ir_graph *irg, unsigned maxsize,
 			continue;
 		}
 
-		ir_graph *calleee = pmap_get(ir_graph, copied_graphs, callee);
+		ir_graph *calleee = pmap_new_get(ir_graph, copied_graphs, callee);
 		if (calleee != NULL) {
 			int benefice = curr_call->benefice;
 			/*
@@ -1167,7 +1225,7 @@ static void inline_into(ir_graph *irg, unsigned maxsize,
 			 */
 			set_irg_entity(copy, get_irg_entity(callee));
 
-			pmap_insert(copied_graphs, callee, copy);
+			pmap_new_insert(copied_graphs, callee, copy);
 			callee = copy;
 
 			/* we have only one caller: the original graph */
@@ -1245,12 +1303,14 @@ void inline_functions(unsigned maxsize, int inline_threshold,
 	ir_graph **irgs = create_irg_list();
 
 	/* a map for the copied graphs, used to inline recursive calls */
-	pmap *copied_graphs = pmap_create();
+	pmap_new_t copied_graphs;
+	pmap_new_init(&copied_graphs);
 
 	/* extend all irgs by a temporary data structure for inlining. */
 	size_t n_irgs = get_irp_n_irgs();
 	for (size_t i = 0; i < n_irgs; ++i)
 		set_irg_link(irgs[i], alloc_inline_irg_env());
+	inline_irg_envs_valid = true;
 
 	/* Precompute information in temporary data structure. */
 	wenv_t wenv;
@@ -1268,7 +1328,7 @@ void inline_functions(unsigned maxsize, int inline_threshold,
 	/* -- and now inline. -- */
 	for (size_t i = 0; i < n_irgs; ++i) {
 		ir_graph *irg = irgs[i];
-		inline_into(irg, maxsize, inline_threshold, copied_graphs);
+		inline_into(irg, maxsize, inline_threshold, &copied_graphs);
 	}
 
 	for (size_t i = 0; i < n_irgs; ++i) {
@@ -1288,15 +1348,18 @@ void inline_functions(unsigned maxsize, int inline_threshold,
 	}
 
 	/* kill the copied graphs: we don't need them anymore */
-	foreach_pmap(copied_graphs, pm_entry) {
-		ir_graph *copy = (ir_graph*)pm_entry->value;
+	pmap_new_iterator_t iter;
+	pmap_new_entry_t    pm_entry;
+	foreach_pmap_new(&copied_graphs, pm_entry, iter) {
+		ir_graph *copy = (ir_graph*)pm_entry.data;
 
 		/* reset the entity, otherwise it will be deleted in the next step ... */
 		set_irg_entity(copy, NULL);
 		free_ir_graph(copy);
 	}
-	pmap_destroy(copied_graphs);
+	pmap_new_destroy(&copied_graphs);
 
+	inline_irg_envs_valid = false;
 	free(irgs);
 
 	obstack_free(&temp_obst, NULL);
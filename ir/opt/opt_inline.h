@@ -0,0 +1,28 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Procedure inlining, internal interface.
+ * @author  Michael Beck, Goetz Lindenmaier
+ */
+#ifndef FIRM_OPT_OPT_INLINE_H
+#define FIRM_OPT_OPT_INLINE_H
+
+#include "firm_types.h"
+#include <stdbool.h>
+
+/**
+ * Inlines @p called_graph at the call site @p call.
+ *
+ * The caller must have Phi lists and start block nodes collected
+ * (collect_phiprojs_and_start_block_nodes()) and IR_RESOURCE_IRN_LINK
+ * reserved on the callee. Out edges of the caller are deactivated.
+ *
+ * @return true if the call was inlined
+ */
+bool inline_method(ir_node *call, ir_graph *called_graph);
+
+#endif
@@ -1229,7 +1229,9 @@ void remove_phi_cycles(ir_graph *irg)
 	DEL_ARR_F(env.stack);
 	obstack_free(&env.obst, NULL);
 
-	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_CONTROL_FLOW);
+	confirm_irg_properties(irg, env.replaced == 0
+	                       ? IR_GRAPH_PROPERTIES_ALL
+	                       : IR_GRAPH_PROPERTIES_CONTROL_FLOW);
 }
 
 /**
@@ -1354,5 +1356,7 @@ void opt_osr(ir_graph *irg, unsigned flags)
 	DEL_ARR_F(env.stack);
 	obstack_free(&env.obst, NULL);
 
-	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
+	confirm_irg_properties(irg, env.replaced == 0
+	                       ? IR_GRAPH_PROPERTIES_ALL
+	                       : IR_GRAPH_PROPERTIES_NONE);
 }
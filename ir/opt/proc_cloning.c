@@ -30,6 +30,7 @@
 #include "irprog_t.h"
 #include "irtools.h"
 #include "panic.h"
+#include "pset.h"
 #include "set.h"
 #include "tv.h"
 
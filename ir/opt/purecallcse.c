@@ -0,0 +1,202 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Common subexpression elimination for calls of pure functions.
+ *
+ * The result of a pure function depends solely on its arguments, so two
+ * calls of the same function with identical arguments compute the same
+ * values no matter how far apart they are.  The regular CSE only merges
+ * such calls once funccall.c managed to detach them from the memory
+ * chain and let them float, which requires the termination proof.  This
+ * pass value-numbers pure calls graph-wide and, whenever one call
+ * dominates an equivalent one, reroutes the dominated call's results to
+ * the dominating call and takes it out of the memory chain.  The dead
+ * call is left for dead node elimination.
+ */
+#include "array.h"
+#include "debug.h"
+#include "hashptr.h"
+#include "ircons.h"
+#include "irdom.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "iroptimize.h"
+#include "pset.h"
+#include "type_t.h"
+#include <stdbool.h>
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+typedef struct cse_env_t {
+	ir_node **calls;   /**< all candidate pure calls of the graph */
+	bool      changed;
+} cse_env_t;
+
+/**
+ * Checks whether a call is a candidate: a direct call of a pure function
+ * whose values we can reroute freely.
+ */
+static bool is_pure_call(const ir_node *call)
+{
+	ir_entity *const callee = get_Call_callee(call);
+	if (callee == NULL)
+		return false;
+
+	ir_type *const type = get_Call_type(call);
+	mtp_additional_properties prop = get_method_additional_properties(type);
+	prop |= get_entity_additional_properties(callee);
+	if (!(prop & mtp_property_pure))
+		return false;
+
+	/* Aggregate parameters and results are passed through memory with
+	 * known addresses; such calls cannot be rerouted. */
+	for (size_t i = 0, n_params = get_method_n_params(type); i < n_params;
+	     ++i) {
+		if (is_aggregate_type(get_method_param_type(type, i)))
+			return false;
+	}
+	for (size_t i = 0, n_ress = get_method_n_ress(type); i < n_ress; ++i) {
+		if (is_aggregate_type(get_method_res_type(type, i)))
+			return false;
+	}
+	return true;
+}
+
+/** Checks whether a call still has exceptional control flow Projs. */
+static bool call_has_exception_flow(const ir_node *call)
+{
+	foreach_out_edge(call, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (!is_Proj(proj))
+			continue;
+		unsigned const num = get_Proj_num(proj);
+		if (num == pn_Call_X_regular || num == pn_Call_X_except)
+			return true;
+	}
+	return false;
+}
+
+static void collect_pure_calls(ir_node *node, void *data)
+{
+	cse_env_t *const env = (cse_env_t*)data;
+	if (is_Call(node) && is_pure_call(node))
+		ARR_APP1(ir_node*, env->calls, node);
+}
+
+/** Hash over the fields call_cmp() compares. */
+static unsigned hash_call(const ir_node *call)
+{
+	unsigned hash = hash_ptr(get_Call_ptr(call))
+	              ^ hash_ptr(get_Call_type(call));
+	for (int i = 0, n = get_Call_n_params(call); i < n; ++i)
+		hash = hash * 31u + hash_ptr(get_Call_param(call, i));
+	return hash;
+}
+
+/** pset compare function: 0 iff both calls compute the same values. */
+static int call_cmp(const void *p0, const void *p1)
+{
+	ir_node const *const c0 = (ir_node const*)p0;
+	ir_node const *const c1 = (ir_node const*)p1;
+	if (get_Call_ptr(c0) != get_Call_ptr(c1)
+	 || get_Call_type(c0) != get_Call_type(c1))
+		return 1;
+	int const n_params = get_Call_n_params(c0);
+	if (n_params != get_Call_n_params(c1))
+		return 1;
+	for (int i = 0; i < n_params; ++i) {
+		if (get_Call_param(c0, i) != get_Call_param(c1, i))
+			return 1;
+	}
+	return 0;
+}
+
+/** Returns the result tuple Proj of a call, creating it if necessary. */
+static ir_node *get_result_tuple(ir_node *call)
+{
+	foreach_out_edge(call, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (is_Proj(proj) && get_Proj_num(proj) == pn_Call_T_result)
+			return proj;
+	}
+	return new_r_Proj(call, mode_T, pn_Call_T_result);
+}
+
+/**
+ * Reroutes all values of @p dup to @p keep and takes @p dup out of the
+ * memory chain.  The calls are equivalent and @p keep's block dominates
+ * @p dup's block, so @p keep's result is available wherever @p dup's
+ * was used.
+ */
+static void merge_call(ir_node *dup, ir_node *keep)
+{
+	DB((dbg, LEVEL_1, "replacing %+F by dominating %+F\n", dup, keep));
+	foreach_out_edge_safe(dup, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (!is_Proj(proj))
+			continue;
+		switch (get_Proj_num(proj)) {
+		case pn_Call_M:
+			/* A pure call leaves memory untouched. */
+			exchange(proj, get_Call_mem(dup));
+			break;
+		case pn_Call_T_result:
+			exchange(proj, get_result_tuple(keep));
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+void opt_pure_call_cse(ir_graph *irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.purecallcse");
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+	                         | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+
+	cse_env_t env = { .calls = NEW_ARR_F(ir_node*, 0), .changed = false };
+	irg_walk_graph(irg, NULL, collect_pure_calls, &env);
+
+	pset *const values = new_pset(call_cmp, 32);
+	for (size_t i = 0, n = ARR_LEN(env.calls); i < n; ++i) {
+		ir_node *const call = env.calls[i];
+		if (call_has_exception_flow(call))
+			continue;
+
+		unsigned const hash = hash_call(call);
+		ir_node *const rep  = (ir_node*)pset_insert(values, call, hash);
+		if (rep == call)
+			continue;
+
+		ir_node *const call_block = get_nodes_block(call);
+		ir_node *const rep_block  = get_nodes_block(rep);
+		if (block_dominates(rep_block, call_block)) {
+			merge_call(call, rep);
+			env.changed = true;
+		} else if (block_dominates(call_block, rep_block)) {
+			/* The new call dominates the representative: merge the other
+			 * way around and let the new call represent the class. */
+			pset_remove(values, rep, hash);
+			pset_insert(values, call, hash);
+			merge_call(rep, call);
+			env.changed = true;
+		}
+		/* Calls in incomparable blocks are left alone; moving the
+		 * surviving call up to a common dominator would execute it
+		 * speculatively, which needs a termination proof. */
+	}
+	del_pset(values);
+	DEL_ARR_F(env.calls);
+
+	confirm_irg_properties(irg, env.changed
+	                       ? IR_GRAPH_PROPERTIES_CONTROL_FLOW
+	                       : IR_GRAPH_PROPERTIES_ALL);
+}
@@ -8,8 +8,10 @@
  * @brief   Reassociation
  * @author  Michael Beck
  */
+#include "pset.h"
 #include "reassoc_t.h"
 
+#include "array.h"
 #include "debug.h"
 #include "ircons_t.h"
 #include "iredges_t.h"
@@ -22,6 +24,7 @@
 #include "irloop.h"
 #include "irmode_t.h"
 #include "irnode_t.h"
+#include "irnodemap.h"
 #include "iropt_dbg.h"
 #include "iropt_t.h"
 #include "iroptimize.h"
@@ -29,6 +32,7 @@
 #include "opt_init.h"
 #include "panic.h"
 #include "pdeq.h"
+#include "target_t.h"
 #include "unionfind.h"
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
@@ -289,7 +293,8 @@ static void do_reassociation(deq_t *const wq)
 			ir_mode *mode = get_irn_mode(n);
 
 			/* reassociating floatingpoint ops is imprecise */
-			if (mode_is_float(mode) && !ir_imprecise_float_transforms_allowed())
+			if (mode_is_float(mode)
+			    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(n)))
 				break;
 
 			if (op->ops.reassociate) {
@@ -446,6 +451,59 @@ transform:;
 	return 1;
 }
 
+/**
+ * Move a constant out of a Shl whose shift amount the target can fold as an
+ * address mode index scale:
+ *
+ *   (a + C1) << C2  ==>  (a << C2) + (C1 << C2)
+ *
+ * This exposes the shifted value as a scaled index and lets move_consts_up()
+ * carry the constant further towards the root, so address computations
+ * collapse into a single base + index*scale + offset form in the backend.
+ * Without scaled-index addressing the transformation merely trades one Add
+ * for another, hence the target query.
+ */
+static int move_const_out_of_shl(ir_node **node)
+{
+	unsigned const scale_limit = ir_target.am_scale_limit;
+	if (scale_limit == 0)
+		return 0;
+
+	ir_node *n     = *node;
+	ir_node *shl_r = get_Shl_right(n);
+	if (!is_Const(shl_r))
+		return 0;
+	ir_tarval *tv_shift = get_Const_tarval(shl_r);
+	if (!tarval_is_long(tv_shift))
+		return 0;
+	long const shift = get_tarval_long(tv_shift);
+	if (shift < 0 || (unsigned long)shift > scale_limit)
+		return 0;
+
+	ir_node *shl_l = get_Shl_left(n);
+	if (!is_Add(shl_l) || get_irn_n_edges(shl_l) > 1)
+		return 0;
+	ir_node *add_r = get_Add_right(shl_l);
+	if (!is_Const(add_r))
+		return 0;
+	ir_mode *mode = get_irn_mode(n);
+	if (get_mode_arithmetic(mode) != irma_twos_complement)
+		return 0;
+
+	dbg_info  *dbgi    = get_irn_dbg_info(n);
+	ir_node   *blk     = get_nodes_block(n);
+	ir_node   *add_l   = get_Add_left(shl_l);
+	ir_node   *new_shl = new_rd_Shl(dbgi, blk, add_l, shl_r);
+	ir_tarval *tv_c    = tarval_shl(get_Const_tarval(add_r), tv_shift);
+	ir_graph  *irg     = get_irn_irg(n);
+	ir_node   *cnst    = new_r_Const(irg, tv_c);
+	ir_node   *irn     = new_rd_Add(dbgi, blk, new_shl, cnst);
+
+	exchange(n, irn);
+	*node = irn;
+	return 1;
+}
+
 /**
  * Move Constants towards the root.
  */
@@ -551,7 +609,8 @@ static void reverse_rules(ir_node *node, void *env)
 	(void)env;
 	/* reassociating floatingpoint ops is imprecise */
 	ir_mode *mode = get_irn_mode(node);
-	if (mode_is_float(mode) && !ir_imprecise_float_transforms_allowed())
+	if (mode_is_float(mode)
+	    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(node)))
 		return;
 
 	bool res;
@@ -566,6 +625,9 @@ static void reverse_rules(ir_node *node, void *env)
 		if (is_Add(node) || is_Sub(node)) {
 			res = reverse_rule_distributive(&node);
 		}
+		if (is_Shl(node)) {
+			res = move_const_out_of_shl(&node);
+		}
 	} while (res);
 }
 
@@ -2042,7 +2104,8 @@ static void do_chaining(ir_graph *irg)
 		do {
 			/* reassociating floatingpoint ops is imprecise */
 			ir_mode *mode = get_irn_mode(n);
-			if (mode_is_float(mode) && !ir_imprecise_float_transforms_allowed())
+			if (mode_is_float(mode)
+			    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(n)))
 				break;
 
 			res      = walk_chains(n);
@@ -2064,6 +2127,182 @@ static void do_chaining(ir_graph *irg)
 	deq_free(&wq);
 }
 
+typedef struct balance_env_t {
+	ir_nodemap depth; /**< memoized dependency depths, entry = depth + 1 */
+} balance_env_t;
+
+/**
+ * Returns true if @p op builds associative chains we may rebalance.
+ */
+static bool is_balanceable_op(const ir_op *op)
+{
+	return op == op_Add || op == op_Mul || op == op_And || op == op_Or
+	    || op == op_Eor;
+}
+
+/**
+ * Collects the leaves of the associative tree rooted at @p node. The
+ * tree extends over all nodes with the same opcode, mode and block that
+ * are used only inside the tree; everything else becomes a leaf.
+ */
+static void collect_tree_leaves(ir_node *node, ir_op *op, ir_mode *mode,
+                                ir_node *block, ir_node ***leaves)
+{
+	foreach_irn_in(node, i, pred) {
+		if (get_irn_op(pred) == op && get_irn_mode(pred) == mode
+		    && get_nodes_block(pred) == block && only_one_user(pred)) {
+			collect_tree_leaves(pred, op, mode, block, leaves);
+		} else {
+			ARR_APP1(ir_node*, *leaves, pred);
+		}
+	}
+}
+
+/**
+ * The dependency depth of a node: the length of the longest chain of
+ * operations inside @p block that must execute before the node's value
+ * is available. Values from earlier blocks and Phis are available when
+ * the block starts and count as zero.
+ */
+static unsigned get_expr_depth(balance_env_t *env, ir_node *node,
+                               const ir_node *block)
+{
+	if (get_nodes_block(node) != block || is_Phi(node))
+		return 0;
+
+	void *entry = ir_nodemap_get(void, &env->depth, node);
+	if (entry != NULL)
+		return (unsigned)((uintptr_t)entry - 1);
+
+	unsigned depth = 0;
+	foreach_irn_in(node, i, pred) {
+		unsigned pred_depth = get_expr_depth(env, pred, block);
+		depth = MAX(depth, pred_depth + 1);
+	}
+	ir_nodemap_insert(&env->depth, node, (void*)(uintptr_t)(depth + 1));
+	return depth;
+}
+
+/**
+ * Post-walker: rebuild whole associative trees as balanced trees.
+ *
+ * A chain a .OP. b .OP. c .OP. d serializes execution: each operation
+ * waits for the previous one. Rebuilding the tree by combining the two
+ * operands of least dependency depth first minimizes the height of the
+ * result, so independent subtrees can execute in parallel. Real
+ * constants are folded into a single leaf up front, which also hoists
+ * constant subtrees that the local rules left deep in the tree.
+ *
+ * Address chains (reference mode) are left in their skewed form: the
+ * backends fold base + index*scale + offset shapes into addressing
+ * modes, see move_const_out_of_shl().
+ */
+static void balance_tree(ir_node *node, void *data)
+{
+	ir_op *op = get_irn_op(node);
+	if (!is_balanceable_op(op))
+		return;
+
+	ir_mode *mode = get_irn_mode(node);
+	/* reassociating floatingpoint ops is imprecise */
+	if (mode_is_float(mode)
+	    && !ir_imprecise_float_transforms_allowed_irg(get_irn_irg(node)))
+		return;
+	if (mode_is_reference(mode))
+		return;
+
+	/* only handle tree roots; the tree of an equal user contains us */
+	ir_node *block = get_nodes_block(node);
+	if (only_one_user(node)) {
+		ir_node *user = get_first_user(node);
+		if (get_irn_op(user) == op && get_irn_mode(user) == mode
+		    && get_nodes_block(user) == block)
+			return;
+	}
+
+	balance_env_t *env    = (balance_env_t*)data;
+	ir_node      **leaves = NEW_ARR_F(ir_node*, 0);
+	collect_tree_leaves(node, op, mode, block, &leaves);
+
+	/* a chain over up to three leaves is already of minimal height */
+	size_t n = ARR_LEN(leaves);
+	if (n < 4) {
+		DEL_ARR_F(leaves);
+		return;
+	}
+
+	/* move real constants to the front ... */
+	size_t n_consts = 0;
+	for (size_t i = 0; i < n; ++i) {
+		if (is_Const(leaves[i])) {
+			ir_node *t          = leaves[n_consts];
+			leaves[n_consts++]  = leaves[i];
+			leaves[i]           = t;
+		}
+	}
+	dbg_info *dbgi = get_irn_dbg_info(node);
+	/* ... and fold them into a single leaf */
+	while (n_consts > 1) {
+		ir_node *in[] = { leaves[0], leaves[1] };
+		leaves[0]     = create_node(dbgi, block, op, mode, ARRAY_SIZE(in), in);
+		leaves[1]     = leaves[--n];
+		--n_consts;
+	}
+
+	/* combine the two operands of least depth first */
+	unsigned *depth = ALLOCAN(unsigned, n);
+	for (size_t i = 0; i < n; ++i)
+		depth[i] = get_expr_depth(env, leaves[i], block);
+
+	while (n > 1) {
+		size_t min0 = 0;
+		size_t min1 = 1;
+		if (depth[min1] < depth[min0]) {
+			min0 = 1;
+			min1 = 0;
+		}
+		for (size_t i = 2; i < n; ++i) {
+			if (depth[i] < depth[min0]) {
+				min1 = min0;
+				min0 = i;
+			} else if (depth[i] < depth[min1]) {
+				min1 = i;
+			}
+		}
+
+		ir_node *in[] = { leaves[min0], leaves[min1] };
+		leaves[min0]  = create_node(dbgi, block, op, mode, ARRAY_SIZE(in), in);
+		depth[min0]   = MAX(depth[min0], depth[min1]) + 1;
+		leaves[min1]  = leaves[--n];
+		depth[min1]   = depth[n];
+	}
+
+	ir_node *res = leaves[0];
+	DEL_ARR_F(leaves);
+	if (res == node)
+		return;
+
+	DBG((dbg, LEVEL_4, "balanced tree at %+F into %+F\n", node, res));
+	exchange(node, res);
+}
+
+/**
+ * Applies tree balancing to a given irg.
+ */
+static void do_balancing(ir_graph *irg)
+{
+	/* The earlier phases exchange nodes without removing the dead
+	 * originals, whose edges inflate the user counts. Rebuild the edge
+	 * information so only live users are counted. */
+	edges_deactivate(irg);
+	edges_activate(irg);
+
+	balance_env_t env;
+	ir_nodemap_init(&env.depth, irg);
+	irg_walk_graph(irg, NULL, balance_tree, &env);
+	ir_nodemap_destroy(&env.depth);
+}
+
 /*
  * do the reassociation
  */
@@ -2108,6 +2347,9 @@ void optimize_reassociation(ir_graph *irg)
 	/* reverse those rules that do not result in collapsed constants */
 	irg_walk_graph(irg, NULL, reverse_rules, NULL);
 
+	DBG((dbg, LEVEL_5, "tree balancing start...\n"));
+	do_balancing(irg);
+
 	deq_free(&wq);
 
 	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_CONTROL_FLOW);
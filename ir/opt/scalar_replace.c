@@ -18,6 +18,7 @@
 #include "irgmod.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "irnodedata.h"
 #include "iroptimize.h"
 #include "irouts_t.h"
 #include "opt_init.h"
@@ -31,14 +32,18 @@
 #include <stdbool.h>
 #include <string.h>
 
+/** Value numbers of the leaf Members. They live in a side array because
+ * the link field already chains the leaf Members of each entity. */
+static ir_nodedata vnums;
+
 static unsigned get_vnum(const ir_node *node)
 {
-	return (unsigned)PTR_TO_INT(get_irn_link(node));
+	return *ir_nodedata_get(unsigned, &vnums, node);
 }
 
 static void set_vnum(ir_node *node, unsigned vnum)
 {
-	set_irn_link(node, INT_TO_PTR(vnum));
+	*ir_nodedata_get(unsigned, &vnums, node) = vnum;
 }
 
 /**
@@ -414,7 +419,7 @@ static unsigned allocate_value_numbers(pset *members, ir_entity *ent,
 				else
 					DB((dbg, SET_LEVEL_2, "[%ld]", get_tarval_long(key->path[i].tv)));
 			}
-			DB((dbg, SET_LEVEL_2, " = %u (%s)\n", PTR_TO_INT(get_irn_link(member)), get_mode_name((*modes)[key->vnum])));
+			DB((dbg, SET_LEVEL_2, " = %u (%s)\n", get_vnum(member), get_mode_name((*modes)[key->vnum])));
 #endif /* DEBUG_libfirm */
 		}
 		free(key);
@@ -566,7 +571,7 @@ void scalar_replacement_opt(ir_graph *irg)
 	                         | IR_GRAPH_PROPERTY_CONSISTENT_OUTS
 	                         | IR_GRAPH_PROPERTY_NO_TUPLES);
 
-	/* we use the link field to store the VNUM */
+	/* the link field chains the leaf Members of each entity */
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
 	irp_reserve_resources(irp, IRP_RESOURCE_ENTITY_LINK);
 
@@ -575,6 +580,8 @@ void scalar_replacement_opt(ir_graph *irg)
 	if (find_possible_replacements(irg)) {
 		DB((dbg, SET_LEVEL_1, "Scalar Replacement: %+F\n", irg));
 
+		ir_nodedata_init(&vnums, irg, sizeof(unsigned));
+
 		/* Insert in set the scalar replacements. */
 		ir_node  *irg_frame = get_irg_frame(irg);
 		unsigned  nvals     = 0;
@@ -633,6 +640,7 @@ void scalar_replacement_opt(ir_graph *irg)
 		del_pset(sels);
 		del_set(set_ent);
 		DEL_ARR_F(modes);
+		ir_nodedata_destroy(&vnums);
 	}
 
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
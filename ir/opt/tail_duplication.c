@@ -0,0 +1,465 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Tail-duplication of small join blocks on hot paths.
+ *
+ * Control flow joins are a barrier for the local optimizations and the
+ * scheduler: values merged in a Phi cannot be combined with the
+ * operations of either predecessor.  This pass peels the hottest
+ * predecessor off a small join block by placing a copy of the block's
+ * contents behind that predecessor, which lengthens the straight-line
+ * trace on the frequent path and exposes the copied nodes to folding
+ * with their now unique operands.  Block frequencies computed by
+ * ir_estimate_execfreq() decide where the code growth pays off.
+ */
+#include "array.h"
+#include "debug.h"
+#include "execfreq.h"
+#include "ircons.h"
+#include "irdom.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "iroptimize.h"
+#include "util.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+/** Maximum number of data nodes a join block may contain to be
+ * duplicated. */
+#define MAX_DUP_NODES 16
+
+/** Predecessors running less often than this are never worth the code
+ * growth. */
+#define MIN_EXECFREQ 0.125
+
+typedef struct dup_env_t {
+	ir_node      *block;      /**< the join block being duplicated */
+	ir_node      *copy_block; /**< the copy behind the peeled predecessor */
+	int           pos;        /**< predecessor position peeled off */
+	ir_visited_t  visited_nr;
+} dup_env_t;
+
+typedef struct candidate_t {
+	ir_node *block;   /**< the join block */
+	int      n_nodes; /**< number of data nodes in the block */
+} candidate_t;
+
+static void add_pred(ir_node *node, ir_node *x)
+{
+	int        const n   = get_irn_arity(node);
+	ir_node  **const ins = ALLOCAN(ir_node*, n + 1);
+	foreach_irn_in(node, i, pred) {
+		ins[i] = pred;
+	}
+	ins[n] = x;
+	set_irn_in(node, n + 1, ins);
+}
+
+static ir_node *ssa_second_def;
+static ir_node *ssa_second_def_block;
+
+static ir_node *search_def_and_create_phis(ir_node *block, ir_mode *mode,
+                                           bool first)
+{
+	assert(is_Block(block));
+
+	/* the other defs can't be marked for cases where a user of the original
+	 * value is in the same block as the alternative definition.
+	 * In this case we mustn't use the alternative definition.
+	 * So we keep a flag that indicated whether we walked at least 1 block
+	 * away and may use the alternative definition */
+	if (block == ssa_second_def_block && !first)
+		return ssa_second_def;
+
+	/* already processed this block? */
+	if (irn_visited(block)) {
+		ir_node *value = (ir_node*)get_irn_link(block);
+		return value;
+	}
+
+	ir_graph *irg = get_irn_irg(block);
+	assert(block != get_irg_start_block(irg));
+
+	/* a Block with only 1 predecessor needs no Phi */
+	int n_cfgpreds = get_Block_n_cfgpreds(block);
+	if (n_cfgpreds == 1) {
+		ir_node *pred_block = get_Block_cfgpred_block(block, 0);
+		ir_node *value;
+		if (pred_block == NULL) {
+			value = new_r_Bad(irg, mode);
+		} else {
+			value = search_def_and_create_phis(pred_block, mode, false);
+		}
+		set_irn_link(block, value);
+		mark_irn_visited(block);
+		return value;
+	}
+
+	/* create a new Phi */
+	ir_node **in    = ALLOCAN(ir_node*, n_cfgpreds);
+	ir_node  *dummy = new_r_Dummy(irg, mode);
+	for (int i = 0; i < n_cfgpreds; ++i) {
+		in[i] = dummy;
+	}
+
+	/* we might have created a potential endless loop, and need a PhiLoop */
+	ir_node *phi = mode == mode_M ? new_r_Phi_loop(block, n_cfgpreds, in)
+	                              : new_r_Phi(block, n_cfgpreds, in, mode);
+	set_irn_link(block, phi);
+	mark_irn_visited(block);
+
+	/* set Phi predecessors */
+	for (int i = 0; i < n_cfgpreds; ++i) {
+		ir_node *pred_block = get_Block_cfgpred_block(block, i);
+		ir_node *pred_val;
+		if (pred_block == NULL) {
+			pred_val = new_r_Bad(irg, mode);
+		} else {
+			pred_val = search_def_and_create_phis(pred_block, mode, false);
+		}
+		set_irn_n(phi, i, pred_val);
+	}
+
+	return phi;
+}
+
+/**
+ * Given the original value and its copy this function reconstructs
+ * SSA-form for all users of the original value (the users are determined
+ * through the out-edges of the value).  Uses the irn_visited flags.
+ * Works without using the dominance tree.
+ */
+static void construct_ssa(ir_node *orig_block, ir_node *orig_val,
+                          ir_node *second_block, ir_node *second_val)
+{
+	/* no need to do anything */
+	if (orig_val == second_val && !(is_Phi(orig_val) && get_Phi_loop(orig_val)))
+		return;
+
+	ir_graph *irg = get_irn_irg(orig_val);
+	inc_irg_visited(irg);
+
+	ir_mode *mode = get_irn_mode(orig_val);
+	set_irn_link(orig_block, orig_val);
+	mark_irn_visited(orig_block);
+
+	if (orig_val == second_val) {
+		/* In the loop-phi case setting a 2nd def is wrong */
+		ssa_second_def_block = NULL;
+	} else {
+		ssa_second_def_block = second_block;
+		ssa_second_def       = second_val;
+	}
+
+	/* Only fix the users of the first, i.e. the original node */
+	foreach_out_edge_safe(orig_val, edge) {
+		ir_node *user = get_edge_src_irn(edge);
+		/* ignore keeps */
+		if (is_End(user))
+			continue;
+
+		int      j          = get_edge_src_pos(edge);
+		ir_node *user_block = get_nodes_block(user);
+		ir_node *newval;
+		if (is_Phi(user)) {
+			ir_node *pred_block = get_Block_cfgpred_block(user_block, j);
+			if (pred_block == NULL) {
+				newval = new_r_Bad(irg, mode);
+			} else {
+				newval = search_def_and_create_phis(pred_block, mode, true);
+			}
+		} else {
+			newval = search_def_and_create_phis(user_block, mode, true);
+		}
+
+		/* don't fix newly created Phis from the SSA construction */
+		if (newval != user) {
+			set_irn_n(user, j, newval);
+			if (is_Phi(user) && get_irn_mode(user) == mode_M
+			    && !get_Phi_loop(user)) {
+				set_Phi_loop(user, true);
+				keep_alive(user);
+				keep_alive(user_block);
+			}
+		}
+	}
+}
+
+/**
+ * Copies @p node from the join block into the copy block.  Phis are
+ * evaluated to their operand along the peeled predecessor, all other
+ * nodes are copied with their in-block operands mapped recursively.
+ */
+static ir_node *copy_and_fix_node(const dup_env_t *env, ir_node *node)
+{
+	ir_node *copy;
+	if (is_Phi(node)) {
+		copy = get_Phi_pred(node, env->pos);
+		/* we might have to evaluate a Phi-cascade */
+		if (get_irn_visited(copy) >= env->visited_nr)
+			copy = (ir_node*)get_irn_link(copy);
+	} else {
+		copy = exact_copy(node);
+		set_nodes_block(copy, env->copy_block);
+		assert(get_irn_mode(copy) != mode_X);
+
+		foreach_irn_in(copy, i, pred) {
+			if (get_nodes_block(pred) != env->block)
+				continue;
+
+			ir_node *new_pred;
+			if (get_irn_visited(pred) >= env->visited_nr) {
+				new_pred = (ir_node*)get_irn_link(pred);
+			} else {
+				new_pred = copy_and_fix_node(env, pred);
+			}
+			set_irn_n(copy, i, new_pred);
+		}
+	}
+
+	set_irn_link(node, copy);
+	set_irn_visited(node, env->visited_nr);
+	return copy;
+}
+
+/**
+ * Reconstructs SSA-form for the users of all copied data nodes.
+ */
+static void fix_copied_ssa(const dup_env_t *env)
+{
+	ir_node *block = env->block;
+
+	/* fix data-flow (and reconstruct SSA if needed) */
+	foreach_out_edge(block, edge) {
+		ir_node *node = get_edge_src_irn(edge);
+		if (is_End(node) || get_irn_mode(node) == mode_X)
+			continue;
+
+		ir_node *copy_node = (ir_node*)get_irn_link(node);
+		DB((dbg, LEVEL_2, ">> Fixing users of %+F (copy %+F)\n", node,
+		    copy_node));
+		construct_ssa(block, node, env->copy_block, copy_node);
+	}
+
+	/* make sure copied PhiM nodes are kept alive if old nodes were */
+	ir_graph *irg = get_irn_irg(block);
+	ir_node  *end = get_irg_end(irg);
+	for (int i = 0, arity = get_End_n_keepalives(end); i < arity; ++i) {
+		ir_node *keep = get_End_keepalive(end, i);
+		if (get_irn_visited(keep) < env->visited_nr || is_Block(keep))
+			continue;
+		ir_node *copy = get_irn_link(keep);
+		/* exact copy does not reproduce the keep alive edges */
+		if (is_Phi(copy) && get_Phi_loop(copy))
+			add_End_keepalive(end, copy);
+	}
+}
+
+/**
+ * Checks whether @p block is a join block worth duplicating and selects
+ * the predecessor to peel off.
+ *
+ * @param n_nodes  is set to the number of data nodes in the block
+ * @return the predecessor position to peel, or -1
+ */
+static int find_dup_candidate(ir_node *block, int *n_nodes)
+{
+	ir_graph *irg = get_irn_irg(block);
+	if (block == get_irg_start_block(irg) || block == get_irg_end_block(irg))
+		return -1;
+	if (get_Block_n_cfgpreds(block) < 2)
+		return -1;
+	/* restrict ourselves to blocks falling through to a single successor;
+	 * conditional jumps are jumpthreading's domain */
+	if (get_irn_n_edges_kind(block, EDGE_KIND_BLOCK) != 1)
+		return -1;
+
+	const ir_edge_t *succ_edge  = get_block_succ_first(block);
+	ir_node         *succ       = get_edge_src_irn(succ_edge);
+	ir_node         *terminator = get_Block_cfgpred(succ,
+	                                                get_edge_src_pos(succ_edge));
+	if (succ == block || (!is_Jmp(terminator) && !is_Return(terminator)))
+		return -1;
+
+	/* only duplicate small blocks */
+	int count = 0;
+	foreach_out_edge(block, edge) {
+		ir_node *node = get_edge_src_irn(edge);
+		if (is_End(node) || is_Phi(node) || get_irn_mode(node) == mode_X)
+			continue;
+		if (++count > MAX_DUP_NODES)
+			return -1;
+	}
+	*n_nodes = count;
+
+	/* peel the hottest predecessor, but only if it carries at least half
+	 * of the block's executions */
+	int    best      = -1;
+	double best_freq = MIN_EXECFREQ;
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+		if (!is_Jmp(get_Block_cfgpred(block, i)))
+			continue;
+		ir_node *pred_block = get_Block_cfgpred_block(block, i);
+		/* peeling a back edge is loop peeling, not tail duplication */
+		if (pred_block == NULL || block_dominates(block, pred_block))
+			continue;
+		double freq = get_block_execfreq(pred_block);
+		if (freq > best_freq) {
+			best_freq = freq;
+			best      = i;
+		}
+	}
+	if (best < 0 || 2.0 * best_freq < get_block_execfreq(block))
+		return -1;
+	return best;
+}
+
+/**
+ * Peels predecessor @p pos off the join block @p block by duplicating
+ * the block's contents behind that predecessor.
+ */
+static void peel_pred(ir_node *block, int pos)
+{
+	ir_graph *irg = get_irn_irg(block);
+	inc_irg_visited(irg);
+
+	dup_env_t env;
+	env.block      = block;
+	env.pos        = pos;
+	env.visited_nr = get_irg_visited(irg);
+
+	ir_node *in[] = { get_Block_cfgpred(block, pos) };
+	env.copy_block = new_r_Block(irg, ARRAY_SIZE(in), in);
+
+	const ir_edge_t *succ_edge  = get_block_succ_first(block);
+	ir_node         *succ       = get_edge_src_irn(succ_edge);
+	int              succ_pos   = get_edge_src_pos(succ_edge);
+	ir_node         *terminator = get_Block_cfgpred(succ, succ_pos);
+
+	DB((dbg, LEVEL_1, "> Peeling pred %d off join block %+F (copy %+F)\n",
+	    pos, block, env.copy_block));
+
+	/* copy the data nodes before SSA reconstruction bumps the visited
+	 * counter */
+	foreach_out_edge(block, edge) {
+		ir_node *node = get_edge_src_irn(edge);
+		if (is_End(node)) {
+			/* edge is a Keep edge. If the end block is unreachable via normal
+			 * control flow, we must maintain end's reachability with Keeps. */
+			keep_alive(env.copy_block);
+			continue;
+		}
+		/* the terminator is rebuilt separately */
+		if (get_irn_mode(node) == mode_X)
+			continue;
+		/* already copied as the operand of an earlier node? */
+		if (get_irn_visited(node) >= env.visited_nr)
+			continue;
+		copy_and_fix_node(&env, node);
+	}
+
+	/* rebuild the terminator in the copy */
+	ir_node *term_copy;
+	if (is_Jmp(terminator)) {
+		term_copy = new_r_Jmp(env.copy_block);
+	} else {
+		assert(is_Return(terminator));
+		term_copy = exact_copy(terminator);
+		set_nodes_block(term_copy, env.copy_block);
+		foreach_irn_in(term_copy, i, pred) {
+			if (get_nodes_block(pred) == block)
+				set_irn_n(term_copy, i, (ir_node*)get_irn_link(pred));
+		}
+	}
+
+	/* the successor gains the copy as an additional predecessor; its Phis
+	 * receive the copied values along the new edge */
+	add_pred(succ, term_copy);
+	foreach_out_edge_safe(succ, edge) {
+		ir_node *phi = get_edge_src_irn(edge);
+		if (!is_Phi(phi))
+			continue;
+		ir_node *val = get_irn_n(phi, succ_pos);
+		if (get_nodes_block(val) == block
+		    && get_irn_visited(val) >= env.visited_nr)
+			val = (ir_node*)get_irn_link(val);
+		add_pred(phi, val);
+	}
+
+	fix_copied_ssa(&env);
+
+	/* the peeled predecessor now jumps into the copy; remove the edge
+	 * towards the join block and shorten its Phis */
+	foreach_out_edge_safe(block, edge) {
+		ir_node *node = get_edge_src_irn(edge);
+		if (is_Phi(node)) {
+			ir_node *bad = new_r_Bad(irg, get_irn_mode(node));
+			set_Phi_pred(node, pos, bad);
+		}
+	}
+	set_Block_cfgpred(block, pos, new_r_Bad(irg, mode_X));
+}
+
+static void collect_candidates(ir_node *block, void *data)
+{
+	candidate_t **candidates = (candidate_t**)data;
+	int           n_nodes;
+	if (find_dup_candidate(block, &n_nodes) < 0)
+		return;
+	candidate_t cand = { .block = block, .n_nodes = n_nodes };
+	ARR_APP1(candidate_t, *candidates, cand);
+}
+
+void opt_tail_duplication(ir_graph *irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.tail-duplication");
+
+	assure_irg_properties(irg,
+		IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE
+		| IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+		| IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES
+		| IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+
+	/* block frequencies decide which predecessor is worth peeling */
+	ir_estimate_execfreq(irg);
+
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_IRN_VISITED);
+
+	candidate_t *candidates = NEW_ARR_F(candidate_t, 0);
+	irg_block_walk_graph(irg, collect_candidates, NULL, &candidates);
+
+	/* bound the overall code growth */
+	int  budget  = (int)get_irg_last_idx(irg) / 8 + MAX_DUP_NODES;
+	bool changed = false;
+	for (size_t i = 0, n = ARR_LEN(candidates); i < n; ++i) {
+		candidate_t *cand = &candidates[i];
+		if (cand->n_nodes > budget)
+			continue;
+		/* earlier peels may have changed the surroundings, re-check */
+		int n_nodes;
+		int pos = find_dup_candidate(cand->block, &n_nodes);
+		if (pos < 0)
+			continue;
+		peel_pred(cand->block, pos);
+		budget -= n_nodes;
+		changed = true;
+	}
+	DEL_ARR_F(candidates);
+
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_IRN_VISITED);
+
+	if (changed) {
+		/* we tend to produce a lot of duplicated keep edges, remove them */
+		remove_End_Bads_and_doublets(get_irg_end(irg));
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
+	} else {
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+	}
+}
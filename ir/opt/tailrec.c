@@ -15,6 +15,7 @@
 #include "ircons_t.h"
 #include "irflag.h"
 #include "irgmod.h"
+#include "irgopt.h"
 #include "irgraph_t.h"
 #include "irgwalk.h"
 #include "irhooks.h"
@@ -22,6 +23,7 @@
 #include "iroptimize.h"
 #include "irouts_t.h"
 #include "irprog_t.h"
+#include "opt_inline.h"
 #include "panic.h"
 #include "scalar_replace.h"
 #include "util.h"
@@ -581,13 +583,226 @@ static unsigned find_tail_rec_possibilities(tr_env *env, ir_graph *irg)
 	return n_tail_calls;
 }
 
+/**
+ * Normalize recursive calls whose aggregate result is returned through a
+ * hidden out-pointer, as created by the compound lowering in lower_calls.c:
+ *
+ *    call self(&tmp, ...); CopyB(ret_ptr, &tmp); return;
+ *
+ * When tmp is a frame temporary used for nothing else and ret_ptr is our
+ * own out-parameter, the recursion can write into the final destination
+ * directly and the CopyB goes away. The result is a plain tail call that
+ * the regular detection handles.
+ *
+ * Requires consistent out information; returns true if the graph changed
+ * (which leaves the outs of the dead temporary stale).
+ */
+static bool normalize_sret_returns(ir_graph *irg)
+{
+	bool       changed   = false;
+	ir_node   *end_block = get_irg_end_block(irg);
+	ir_node   *frame     = get_irg_frame(irg);
+	ir_type   *frame_tp  = get_irg_frame_type(irg);
+	ir_type   *mtp       = get_entity_type(get_irg_entity(irg));
+
+	/* Without compound-return lowering there are no sret out-pointers. */
+	size_t n_hidden = get_method_n_compound_ret_params(mtp);
+	if (!(get_method_calling_convention(mtp) & cc_compound_ret)
+	    || n_hidden == 0)
+		return false;
+
+	for (int i = get_Block_n_cfgpreds(end_block); i-- > 0; ) {
+		ir_node *ret = get_Block_cfgpred(end_block, i);
+		if (!is_Return(ret))
+			continue;
+
+		ir_node *copyb = get_Return_mem(ret);
+		if (!is_CopyB(copyb)
+		    || get_CopyB_volatility(copyb) == volatility_is_volatile)
+			continue;
+		ir_node *callproj = get_CopyB_mem(copyb);
+		if (!is_Proj(callproj))
+			continue;
+		ir_node *call = get_Proj_pred(callproj);
+		if (!is_Call(call))
+			continue;
+		ir_node *block = get_nodes_block(ret);
+		if (get_nodes_block(call) != block || get_nodes_block(copyb) != block)
+			continue;
+		ir_entity *callee = get_Call_callee(call);
+		if (callee == NULL || get_entity_linktime_irg(callee) != irg
+		    || get_Call_type(call) != mtp)
+			continue;
+
+		/* the copied temporary must be a frame entity of ours */
+		ir_node *src = get_CopyB_src(copyb);
+		if (!is_Member(src) || get_Member_ptr(src) != frame)
+			continue;
+		ir_entity *tmp = get_Member_entity(src);
+		if (get_entity_owner(tmp) != frame_tp
+		    || get_CopyB_type(copyb) != get_entity_type(tmp))
+			continue;
+
+		/* the destination must be one of our own hidden compound-return
+		 * pointers: only the sret pointer targets a fresh result
+		 * temporary nothing can read before the outermost call returns.
+		 * An ordinary pointer argument may alias memory the recursion
+		 * reads, so rerouting it would reorder those reads. */
+		ir_node *dst = get_CopyB_dst(copyb);
+		if (!is_Proj(dst) || get_Proj_num(dst) >= n_hidden)
+			continue;
+		ir_node *args = get_Proj_pred(dst);
+		if (!is_Proj(args) || !is_Start(get_Proj_pred(args))
+		    || get_Proj_num(args) != pn_Start_T_args)
+			continue;
+
+		/* tmp may only be passed to the call and copied out afterwards */
+		bool ok        = true;
+		int  param_pos = -1;
+		foreach_irn_out_r(src, k, user) {
+			if (user != call && user != copyb) {
+				ok = false;
+				break;
+			}
+		}
+		if (!ok || get_CopyB_dst(copyb) == src)
+			continue;
+		foreach_irn_out_r(frame, k, member) {
+			if (member != src && is_Member(member)
+			    && get_Member_entity(member) == tmp) {
+				ok = false;
+				break;
+			}
+		}
+		for (int p = 0, n = get_Call_n_params(call); p < n; ++p) {
+			if (get_Call_param(call, p) == src) {
+				if (param_pos >= 0) {
+					ok = false;
+					break;
+				}
+				param_pos = p;
+			}
+		}
+		/* nothing else may touch the memory between call and return */
+		foreach_irn_out_r(callproj, k, user) {
+			if (user != copyb) {
+				ok = false;
+				break;
+			}
+		}
+		foreach_irn_out_r(copyb, k, user) {
+			if (user != ret) {
+				ok = false;
+				break;
+			}
+		}
+		if (!ok || param_pos < 0)
+			continue;
+		/* our sret pointer must go into the callee's matching hidden
+		 * slot, otherwise the callee would not treat it as one */
+		if (get_Proj_num(dst) != (unsigned)param_pos)
+			continue;
+
+		DB((dbg, LEVEL_2, "  rerouting out-pointer of %+F through %+F\n",
+		    call, dst));
+		set_Call_param(call, param_pos, dst);
+		set_Return_mem(ret, callproj);
+		changed = true;
+	}
+	return changed;
+}
+
+/**
+ * Check if @p irg contains a `return target(...)` style tail call.
+ */
+static bool has_tail_call_to(ir_graph *irg, const ir_entity *target)
+{
+	ir_node *end_block = get_irg_end_block(irg);
+	for (int i = get_Block_n_cfgpreds(end_block); i-- > 0; ) {
+		ir_node *ret = get_Block_cfgpred(end_block, i);
+		if (!is_Return(ret))
+			continue;
+		ir_node *call = skip_Proj(get_Return_mem(ret));
+		if (is_Call(call) && get_Call_callee(call) == target)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Turn mutual tail recursion between two functions into direct recursion:
+ * if a Return is fed by a call to another graph which itself contains a
+ * tail call back to us, inline the partner at that site. The copied tail
+ * call then targets this graph directly and is picked up by the regular
+ * detection once the control flow is cleaned up.
+ *
+ * @return true if at least one partner was inlined
+ */
+static bool convert_mutual_recursion(ir_graph *irg)
+{
+	const ir_entity *entity    = get_irg_entity(irg);
+	ir_node         *end_block = get_irg_end_block(irg);
+	bool             changed   = false;
+
+	for (int i = get_Block_n_cfgpreds(end_block); i-- > 0; ) {
+		ir_node *ret = get_Block_cfgpred(end_block, i);
+		if (!is_Return(ret))
+			continue;
+		ir_node *call = skip_Proj(get_Return_mem(ret));
+		if (!is_Call(call))
+			continue;
+		if (get_nodes_block(call) != get_nodes_block(ret))
+			continue;
+		ir_entity *callee = get_Call_callee(call);
+		if (callee == NULL || callee == entity)
+			continue;
+		ir_graph *callee_irg = get_entity_linktime_irg(callee);
+		if (callee_irg == NULL || callee_irg == irg)
+			continue;
+		if (!has_tail_call_to(callee_irg, entity))
+			continue;
+
+		DB((dbg, LEVEL_2,
+		    "  inlining mutual recursion partner %+F into %s\n",
+		    callee_irg, get_entity_ld_name(get_irg_entity(irg))));
+		/* every inline invalidates the collected Phi lists */
+		collect_phiprojs_and_start_block_nodes(irg);
+		ir_reserve_resources(callee_irg, IR_RESOURCE_IRN_LINK);
+		bool did_inline = inline_method(call, callee_irg);
+		ir_free_resources(callee_irg, IR_RESOURCE_IRN_LINK);
+		if (did_inline)
+			changed = true;
+	}
+	return changed;
+}
+
 void opt_tail_rec_irg(ir_graph *irg)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.opt.tailrec");
+
+	/* break mutual recursion first, so the direct recursion created by it
+	 * is found below */
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_PHI_LIST);
+	bool inlined = convert_mutual_recursion(irg);
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_PHI_LIST);
+	if (inlined) {
+		/* fold the inlined control flow so the copied tail call ends up
+		 * in the same block as our Return */
+		optimize_graph_df(irg);
+		optimize_cf(irg);
+	}
+
 	assure_irg_properties(irg,
 		IR_GRAPH_PROPERTY_MANY_RETURNS
 		| IR_GRAPH_PROPERTY_NO_BADS
 		| IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
+
+	if (normalize_sret_returns(irg)) {
+		/* the rerouting leaves stale out information behind (the dead
+		 * frame temporary still lists its former users) */
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
+		assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
+	}
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
 
 	tr_env   env;
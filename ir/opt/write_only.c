@@ -0,0 +1,203 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Removal of write-only entities and the stores to them.
+ *
+ * The entity usage analysis tracks for every global and frame entity
+ * whether it is read, written or has its address taken. An entity that is
+ * only ever written cannot influence the observable behaviour of the
+ * program, so the Stores and CopyBs writing it can be removed and the
+ * entity itself can be dropped from its segment or frame.
+ */
+#include "array.h"
+#include "debug.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irmemory.h"
+#include "irnode_t.h"
+#include "iroptimize.h"
+#include "irprog_t.h"
+#include "type_t.h"
+#include "typerep.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+/**
+ * Returns true if the usage flags allow removing all writes to the entity.
+ * Reads obviously forbid it; a taken address may leak into code we cannot
+ * see and a reinterpreting access makes the analysis unreliable.
+ */
+static bool is_write_only_candidate(ir_entity const *const entity)
+{
+	if (get_entity_kind(entity) != IR_ENTITY_NORMAL
+	 || is_parameter_entity(entity))
+		return false;
+	if (entity_is_externally_visible(entity)
+	 || (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN))
+		return false;
+	if (get_entity_volatility(entity) == volatility_is_volatile)
+		return false;
+	ir_entity_usage const usage = get_entity_usage(entity);
+	return (usage & (ir_usage_address_taken | ir_usage_read
+	               | ir_usage_reinterpret_cast)) == 0;
+}
+
+/** Marks all write-only members of @p segment by setting their link. */
+static void mark_candidates(ir_type *const segment)
+{
+	for (size_t i = 0, n = get_compound_n_members(segment); i < n; ++i) {
+		ir_entity *const entity = get_compound_member(segment, i);
+		set_entity_link(entity,
+		                is_write_only_candidate(entity) ? entity : NULL);
+	}
+}
+
+/**
+ * Returns the entity an address computation ultimately accesses, or NULL.
+ * Mirrors the chains the entity usage analysis follows, so for a marked
+ * entity this finds every access there is.
+ */
+static ir_entity *find_accessed_entity(ir_node *ptr)
+{
+	for (;;) {
+		if (is_Address(ptr))
+			return get_Address_entity(ptr);
+		if (is_Member(ptr)) {
+			ir_node *const pred = get_Member_ptr(ptr);
+			if (pred == get_irg_frame(get_irn_irg(ptr)))
+				return get_Member_entity(ptr);
+			ptr = pred;
+		} else if (is_Sel(ptr)) {
+			ptr = get_Sel_ptr(ptr);
+		} else if (is_Add(ptr)) {
+			ir_node *const left = get_Add_left(ptr);
+			ptr = mode_is_reference(get_irn_mode(left))
+			    ? left : get_Add_right(ptr);
+		} else if (is_Sub(ptr)) {
+			ptr = get_Sub_left(ptr);
+		} else if (is_Id(ptr)) {
+			ptr = get_Id_pred(ptr);
+		} else {
+			return NULL;
+		}
+	}
+}
+
+/**
+ * Walker: collect Stores and CopyBs writing marked entities. Volatile or
+ * throwing writes must stay; they unmark the entity so it is kept, but do
+ * not invalidate the removal of its plain writes: those are unobservable
+ * for a never-read entity either way.
+ */
+static void collect_writes(ir_node *const node, void *const data)
+{
+	ir_node    ***const writes = (ir_node***)data;
+	ir_node      *ptr;
+	bool          is_volatile;
+	if (is_Store(node)) {
+		ptr         = get_Store_ptr(node);
+		is_volatile = get_Store_volatility(node) != volatility_non_volatile;
+	} else if (is_CopyB(node)) {
+		ptr         = get_CopyB_dst(node);
+		is_volatile = get_CopyB_volatility(node) != volatility_non_volatile;
+	} else {
+		return;
+	}
+
+	ir_entity *const entity = find_accessed_entity(ptr);
+	if (entity == NULL || get_entity_link(entity) == NULL)
+		return;
+	if (is_volatile || ir_throws_exception(node)) {
+		DB((dbg, LEVEL_1, "keeping %+F due to %+F\n", entity, node));
+		set_entity_link(entity, NULL);
+		return;
+	}
+	ARR_APP1(ir_node*, *writes, node);
+}
+
+/** Removes a collected Store or CopyB by routing memory around it. */
+static void remove_write(ir_node *const node)
+{
+	DB((dbg, LEVEL_1, "removing write %+F\n", node));
+	if (is_Store(node)) {
+		ir_node *const mem = get_Store_mem(node);
+		foreach_out_edge_safe(node, edge) {
+			ir_node *const proj = get_edge_src_irn(edge);
+			assert(is_Proj(proj) && get_Proj_num(proj) == pn_Store_M);
+			exchange(proj, mem);
+		}
+		kill_node(node);
+	} else {
+		exchange(node, get_CopyB_mem(node));
+	}
+}
+
+/** Frees all still marked members of @p segment. Returns true if any. */
+static bool free_marked_entities(ir_type *const segment)
+{
+	bool freed = false;
+	for (size_t i = get_compound_n_members(segment); i-- > 0;) {
+		ir_entity *const entity = get_compound_member(segment, i);
+		if (get_entity_link(entity) == NULL)
+			continue;
+		DB((dbg, LEVEL_1, "removing write-only entity %+F\n", entity));
+		free_entity(entity);
+		freed = true;
+	}
+	return freed;
+}
+
+void remove_write_only_entities(void)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.writeonly");
+
+	assure_irp_globals_entity_usage_computed();
+	irp_reserve_resources(irp, IRP_RESOURCE_ENTITY_LINK);
+
+	ir_type *const glob = get_segment_type(IR_SEGMENT_GLOBAL);
+	ir_type *const tls  = get_segment_type(IR_SEGMENT_THREAD_LOCAL);
+	mark_candidates(glob);
+	mark_candidates(tls);
+
+	/* an alias keeps its target alive no matter what its usage says */
+	for (ir_segment_t s = IR_SEGMENT_FIRST; s <= IR_SEGMENT_LAST; ++s) {
+		ir_type *const segment = get_segment_type(s);
+		for (size_t i = 0, n = get_compound_n_members(segment); i < n; ++i) {
+			ir_entity *const entity = get_compound_member(segment, i);
+			if (get_entity_kind(entity) == IR_ENTITY_ALIAS)
+				set_entity_link(get_entity_alias(entity), NULL);
+		}
+	}
+
+	foreach_irp_irg(i, irg) {
+		assure_irg_entity_usage_computed(irg);
+		ir_type *const frame_type = get_irg_frame_type(irg);
+		mark_candidates(frame_type);
+
+		assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
+		ir_node **writes = NEW_ARR_F(ir_node*, 0);
+		irg_walk_graph(irg, NULL, collect_writes, &writes);
+
+		size_t const n_writes = ARR_LEN(writes);
+		for (size_t w = 0; w < n_writes; ++w) {
+			remove_write(writes[w]);
+		}
+		DEL_ARR_F(writes);
+
+		if (free_marked_entities(frame_type))
+			set_type_state(frame_type, layout_undefined);
+
+		confirm_irg_properties(irg, n_writes == 0
+			? IR_GRAPH_PROPERTIES_ALL : IR_GRAPH_PROPERTIES_NONE);
+	}
+
+	free_marked_entities(glob);
+	free_marked_entities(tls);
+	irp_free_resources(irp, IRP_RESOURCE_ENTITY_LINK);
+}
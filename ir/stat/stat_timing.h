@@ -23,7 +23,7 @@ typedef unsigned long long timing_ticks_t;
  */
 static inline timing_ticks_t timing_ticks(void)
 {
-#if defined(__i386__) || defined(_M_IX86) || defined(_M_X64)
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
 	unsigned h;
 	unsigned l;
 	__asm__ volatile("rdtsc" : "=a" (l), "=d" (h));
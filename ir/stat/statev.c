@@ -11,7 +11,9 @@
  */
 #include "statev_t.h"
 
+#include "firm_threads.h"
 #include "irprintf.h"
+#include "obst.h"
 #include "stat_timing.h"
 #include "util.h"
 #include <assert.h>
@@ -30,6 +32,266 @@ static int            stat_ev_timer_sp;
 static timing_ticks_t stat_ev_timer_elapsed[MAX_TIMER];
 static timing_ticks_t stat_ev_timer_start[MAX_TIMER];
 
+/** Value encodings of a ring-buffer record. */
+enum record_type {
+	RECORD_NONE, /**< event without a value */
+	RECORD_INT,
+	RECORD_DBL,
+	RECORD_ULL,
+	RECORD_STR,  /**< context push with a formatted value */
+};
+
+/**
+ * A fixed-size binary record of the ring-buffer backend. Keys are stored
+ * as pointers: emitters pass string literals which live until the dump.
+ * Formatted context values are copied onto the owning buffer's obstack.
+ */
+typedef struct stat_ev_record_t {
+	const char *key;
+	char        ev;   /**< event char as in the text format (E/P/O) */
+	char        type; /**< one of enum record_type */
+	union {
+		int                i;
+		double             dbl;
+		unsigned long long ull;
+		const char        *str;
+	} value;
+} stat_ev_record_t;
+
+typedef struct stat_ev_ring_t stat_ev_ring_t;
+struct stat_ev_ring_t {
+	stat_ev_ring_t    *next;    /**< list of all buffers, for the dump */
+	struct obstack     obst;    /**< holds copied context strings */
+	size_t             head;    /**< index of the next record to write */
+	size_t             count;   /**< number of valid records */
+	unsigned long long dropped; /**< records overwritten after a wrap */
+	stat_ev_record_t   records[];
+};
+
+/** Records per buffer; non-zero switches emission to the ring backend. */
+static size_t          ring_size;
+static stat_ev_ring_t *ring_list;
+static firm_mutex_t    ring_list_lock;
+
+#if FIRM_HAS_THREADS
+static _Thread_local stat_ev_ring_t *ring_buf;
+#else
+static stat_ev_ring_t *ring_buf;
+#endif
+
+/** Returns the calling thread's ring buffer, creating it lazily. */
+static stat_ev_ring_t *get_ring_buf(void)
+{
+	stat_ev_ring_t *ring = ring_buf;
+	if (ring == NULL) {
+		ring = calloc(1, sizeof(*ring)
+		              + ring_size * sizeof(ring->records[0]));
+		obstack_init(&ring->obst);
+		firm_mutex_lock(&ring_list_lock);
+		ring->next = ring_list;
+		ring_list  = ring;
+		firm_mutex_unlock(&ring_list_lock);
+		ring_buf = ring;
+	}
+	return ring;
+}
+
+/** Reserves the next record, overwriting the oldest one when full. */
+static stat_ev_record_t *ring_reserve(char ev, const char *key)
+{
+	stat_ev_ring_t   *ring   = get_ring_buf();
+	stat_ev_record_t *record = &ring->records[ring->head];
+	ring->head = (ring->head + 1) % ring_size;
+	if (ring->count < ring_size) {
+		++ring->count;
+	} else {
+		++ring->dropped;
+	}
+	record->ev  = ev;
+	record->key = key;
+	return record;
+}
+
+/** Named counters per block; counter sites are few and known. */
+#define MAX_COUNTERS 64
+
+typedef struct stat_ev_cnt_block_t stat_ev_cnt_block_t;
+struct stat_ev_cnt_block_t {
+	stat_ev_cnt_block_t *next;       /**< list of all blocks */
+	size_t               n_counters;
+	const char          *keys[MAX_COUNTERS];
+	unsigned long long   values[MAX_COUNTERS];
+};
+
+static FILE                *snap_file;
+static firm_thread_t        snap_thread;
+static bool                 snap_thread_running;
+static bool                 snap_stop;
+static unsigned             snap_interval_ms;
+static unsigned long long   snap_seq;
+static firm_mutex_t         snap_lock;
+static stat_ev_cnt_block_t *cnt_list;
+static firm_mutex_t         cnt_list_lock;
+static int                  counters_enabled;
+
+#if FIRM_HAS_THREADS
+static _Thread_local stat_ev_cnt_block_t *cnt_block;
+#else
+static stat_ev_cnt_block_t *cnt_block;
+#endif
+
+/** Returns the calling thread's counter block, creating it lazily. */
+static stat_ev_cnt_block_t *get_cnt_block(void)
+{
+	stat_ev_cnt_block_t *block = cnt_block;
+	if (block == NULL) {
+		block = calloc(1, sizeof(*block));
+		firm_mutex_lock(&cnt_list_lock);
+		block->next = cnt_list;
+		cnt_list    = block;
+		firm_mutex_unlock(&cnt_list_lock);
+		cnt_block = block;
+	}
+	return block;
+}
+
+void (stat_ev_counter_add)(const char *name, unsigned long long delta)
+{
+	if (!counters_enabled)
+		return;
+
+	/* Counter sites pass string literals, so within one thread the
+	 * pointer identifies the counter. */
+	stat_ev_cnt_block_t *block = get_cnt_block();
+	for (size_t i = 0; i < block->n_counters; ++i) {
+		if (block->keys[i] == name) {
+			block->values[i] += delta;
+			return;
+		}
+	}
+	assert(block->n_counters < MAX_COUNTERS);
+	block->keys[block->n_counters]     = name;
+	block->values[block->n_counters++] = delta;
+}
+
+/**
+ * Sums all per-thread counters and appends one snapshot to the output.
+ * Emitter threads keep running meanwhile: their blocks are only appended
+ * to under the list lock, and the sums may miss increments that race
+ * with the read. The final snapshot written by stat_ev_snapshot_end()
+ * is exact because it runs after the emitters have terminated.
+ */
+static void write_snapshot(void)
+{
+	const char        *keys[MAX_COUNTERS];
+	unsigned long long sums[MAX_COUNTERS];
+	size_t             n_keys = 0;
+
+	firm_mutex_lock(&cnt_list_lock);
+	for (const stat_ev_cnt_block_t *block = cnt_list; block != NULL;
+	     block = block->next) {
+		for (size_t i = 0; i < block->n_counters; ++i) {
+			/* the same literal in different compilation units may
+			 * have different addresses, so merge by content here */
+			size_t j;
+			for (j = 0; j < n_keys; ++j) {
+				if (streq(keys[j], block->keys[i]))
+					break;
+			}
+			if (j == n_keys) {
+				assert(n_keys < MAX_COUNTERS);
+				keys[n_keys]   = block->keys[i];
+				sums[n_keys++] = 0;
+			}
+			sums[j] += block->values[i];
+		}
+	}
+	firm_mutex_unlock(&cnt_list_lock);
+
+	fprintf(snap_file, "P;statev_snapshot;%llu\n", snap_seq++);
+	for (size_t j = 0; j < n_keys; ++j) {
+		fprintf(snap_file, "E;%s;%llu\n", keys[j], sums[j]);
+	}
+	fputs("O;statev_snapshot\n", snap_file);
+	fflush(snap_file);
+}
+
+static bool snapshot_should_stop(void)
+{
+	firm_mutex_lock(&snap_lock);
+	bool const stop = snap_stop;
+	firm_mutex_unlock(&snap_lock);
+	return stop;
+}
+
+static int snapshot_thread(void *arg)
+{
+	(void)arg;
+	for (;;) {
+		/* sleep in small slices so shutdown stays responsive */
+		for (unsigned slept = 0; slept < snap_interval_ms; slept += 10) {
+			if (snapshot_should_stop())
+				return 0;
+			firm_thread_sleep(10);
+		}
+		if (snapshot_should_stop())
+			return 0;
+		write_snapshot();
+	}
+}
+
+void stat_ev_snapshot_begin(const char *prefix, unsigned interval_ms)
+{
+	assert(snap_file == NULL);
+	char buf[512];
+	snprintf(buf, sizeof(buf), "%s.ev", prefix);
+	snap_file = fopen(buf, "wt");
+	if (snap_file == NULL) {
+		fprintf(stderr, "Warning: Couldn't create statev output '%s'\n", buf);
+		return;
+	}
+
+	firm_mutex_init(&cnt_list_lock);
+	firm_mutex_init(&snap_lock);
+	snap_stop        = false;
+	snap_seq         = 0;
+	snap_interval_ms = interval_ms;
+	counters_enabled = 1;
+	/* without thread support only the final snapshot is written */
+	if (interval_ms != 0) {
+		snap_thread_running
+			= firm_thread_create(&snap_thread, snapshot_thread, NULL);
+	}
+}
+
+void stat_ev_snapshot_end(void)
+{
+	if (snap_file == NULL)
+		return;
+
+	if (snap_thread_running) {
+		firm_mutex_lock(&snap_lock);
+		snap_stop = true;
+		firm_mutex_unlock(&snap_lock);
+		firm_thread_join(snap_thread);
+		snap_thread_running = false;
+	}
+	write_snapshot();
+	fclose(snap_file);
+	snap_file        = NULL;
+	counters_enabled = 0;
+
+	for (stat_ev_cnt_block_t *block = cnt_list, *next; block != NULL;
+	     block = next) {
+		next = block->next;
+		free(block);
+	}
+	cnt_list  = NULL;
+	cnt_block = NULL;
+	firm_mutex_destroy(&snap_lock);
+	firm_mutex_destroy(&cnt_list_lock);
+}
+
 static regex_t  regex;
 static regex_t *filter;
 
@@ -102,6 +364,15 @@ void stat_ev_tim_pop(const char *name)
 
 void do_stat_ev_ctx_push_vfmt(const char *key, const char *fmt, va_list ap)
 {
+	if (ring_size != 0) {
+		stat_ev_record_t *record = ring_reserve('P', key);
+		stat_ev_ring_t   *ring   = ring_buf;
+		ir_obst_vprintf(&ring->obst, fmt, ap);
+		obstack_1grow(&ring->obst, '\0');
+		record->type      = RECORD_STR;
+		record->value.str = obstack_finish(&ring->obst);
+		return;
+	}
 	stat_ev_tim_push();
 	stat_ev_vprintf('P', key, fmt, ap);
 	stat_ev_tim_pop(NULL);
@@ -125,6 +396,11 @@ void (stat_ev_ctx_push_str)(const char *key, const char *str)
 
 void do_stat_ev_ctx_pop(const char *key)
 {
+	if (ring_size != 0) {
+		stat_ev_record_t *record = ring_reserve('O', key);
+		record->type = RECORD_NONE;
+		return;
+	}
 	stat_ev_tim_push();
 	stat_ev_printf('O', key, NULL);
 	stat_ev_tim_pop(NULL);
@@ -137,6 +413,12 @@ void (stat_ev_ctx_pop)(const char *key)
 
 void do_stat_ev_dbl(const char *name, double value)
 {
+	if (ring_size != 0) {
+		stat_ev_record_t *record = ring_reserve('E', name);
+		record->type      = RECORD_DBL;
+		record->value.dbl = value;
+		return;
+	}
 	stat_ev_tim_push();
 	stat_ev_printf('E', name, "%g", value);
 	stat_ev_tim_pop(NULL);
@@ -149,6 +431,12 @@ void (stat_ev_dbl)(const char *name, double value)
 
 void do_stat_ev_int(const char *name, int value)
 {
+	if (ring_size != 0) {
+		stat_ev_record_t *record = ring_reserve('E', name);
+		record->type    = RECORD_INT;
+		record->value.i = value;
+		return;
+	}
 	stat_ev_tim_push();
 	stat_ev_printf('E', name, "%d", value);
 	stat_ev_tim_pop(NULL);
@@ -161,6 +449,12 @@ void (stat_ev_int)(const char *name, int value)
 
 void do_stat_ev_ull(const char *name, unsigned long long value)
 {
+	if (ring_size != 0) {
+		stat_ev_record_t *record = ring_reserve('E', name);
+		record->type      = RECORD_ULL;
+		record->value.ull = value;
+		return;
+	}
 	stat_ev_tim_push();
 	stat_ev_printf('E', name, "%llu", value);
 	stat_ev_tim_pop(NULL);
@@ -173,6 +467,11 @@ void (stat_ev_ull)(const char *name, unsigned long long value)
 
 void do_stat_ev(const char *name)
 {
+	if (ring_size != 0) {
+		stat_ev_record_t *record = ring_reserve('E', name);
+		record->type = RECORD_NONE;
+		return;
+	}
 	stat_ev_tim_push();
 	stat_ev_printf('E', name, "0.0");
 	stat_ev_tim_pop(NULL);
@@ -219,3 +518,76 @@ void stat_ev_end(void)
 		filter = NULL;
 	}
 }
+
+void stat_ev_ring_begin(size_t n_records)
+{
+	assert(ring_size == 0);
+	assert(n_records > 0);
+	firm_mutex_init(&ring_list_lock);
+	ring_size       = n_records;
+	stat_ev_enabled = 1;
+}
+
+/** Writes one record in the text .ev format. */
+static void ring_print_record(FILE *file, const stat_ev_record_t *record)
+{
+	putc(record->ev, file);
+	putc(';', file);
+	fputs(record->key, file);
+	switch ((enum record_type)record->type) {
+	case RECORD_NONE:                                               break;
+	case RECORD_INT: fprintf(file, ";%d",   record->value.i);       break;
+	case RECORD_DBL: fprintf(file, ";%g",   record->value.dbl);     break;
+	case RECORD_ULL: fprintf(file, ";%llu", record->value.ull);     break;
+	case RECORD_STR: fprintf(file, ";%s",   record->value.str);     break;
+	}
+	putc('\n', file);
+}
+
+void stat_ev_ring_dump(const char *prefix)
+{
+	if (ring_size == 0)
+		return;
+
+	char buf[512];
+	snprintf(buf, sizeof(buf), "%s.ev", prefix);
+	FILE *file = fopen(buf, "wt");
+	if (file == NULL) {
+		fprintf(stderr, "Warning: Couldn't create statev output '%s'\n", buf);
+		return;
+	}
+
+	firm_mutex_lock(&ring_list_lock);
+	for (const stat_ev_ring_t *ring = ring_list; ring != NULL;
+	     ring = ring->next) {
+		/* oldest surviving record first */
+		size_t const first = (ring->head + ring_size - ring->count)
+		                   % ring_size;
+		for (size_t i = 0; i < ring->count; ++i) {
+			size_t const pos = (first + i) % ring_size;
+			ring_print_record(file, &ring->records[pos]);
+		}
+		fprintf(file, "E;statev_dropped;%llu\n", ring->dropped);
+	}
+	firm_mutex_unlock(&ring_list_lock);
+	fclose(file);
+}
+
+void stat_ev_ring_end(void)
+{
+	if (ring_size == 0)
+		return;
+
+	firm_mutex_lock(&ring_list_lock);
+	for (stat_ev_ring_t *ring = ring_list, *next; ring != NULL; ring = next) {
+		next = ring->next;
+		obstack_free(&ring->obst, NULL);
+		free(ring);
+	}
+	ring_list = NULL;
+	firm_mutex_unlock(&ring_list_lock);
+	firm_mutex_destroy(&ring_list_lock);
+	ring_buf        = NULL;
+	ring_size       = 0;
+	stat_ev_enabled = stat_ev_file != NULL;
+}
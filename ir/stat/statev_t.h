@@ -21,6 +21,7 @@
 #define stat_ev_int(name, val)                   ((void)0)
 #define stat_ev_ull(name, val)                   ((void)0)
 #define stat_ev(name)                            ((void)0)
+#define stat_ev_counter_add(name, delta)         ((void)0)
 
 #define stat_ev_cnt_decl(var)                    ((void)0)
 #define stat_ev_cnt_inc(var)                     ((void)0)
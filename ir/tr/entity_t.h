@@ -259,6 +259,8 @@ static inline void _set_entity_ident(ir_entity *ent, ident *id)
 {
 	assert(ent->firm_tag == k_entity);
 	ent->name = id;
+	if (ent->owner != NULL && is_compound_type(ent->owner))
+		ir_invalidate_compound_member_index(ent->owner);
 }
 
 static inline ir_type *_get_entity_owner(const ir_entity *ent)
@@ -365,6 +367,8 @@ static inline void _set_entity_offset(ir_entity *ent, int offset)
 {
 	assert(is_entity_compound_member(ent));
 	ent->attr.compound_member.offset = offset;
+	if (ent->owner != NULL && is_compound_type(ent->owner))
+		ir_invalidate_compound_offset_index(ent->owner);
 }
 
 static inline unsigned _get_entity_bitfield_offset(const ir_entity *ent)
@@ -8,6 +8,7 @@
  * @brief   Utility routines for inheritance representation
  * @author  Goetz Lindenmaier
  */
+#include "hashptr.h"
 #include "irflag.h"
 #include "irgraph_t.h"
 #include "irgwalk.h"
@@ -33,12 +33,14 @@
 #include "bitfiddle.h"
 #include "dbginfo.h"
 #include "entity_t.h"
+#include "hashptr.h"
 #include "ircons.h"
 #include "irhooks.h"
 #include "irnode_t.h"
 #include "irprog_t.h"
 #include "irprog_t.h"
 #include "panic.h"
+#include "pset.h"
 #include "tv_t.h"
 #include "util.h"
 #include "xmalloc.h"
@@ -89,11 +91,18 @@ void ir_init_type(ir_prog *irp)
 	irp->dummy_owner = new_type_struct(new_id_from_str("$dummy_owner$"));
 }
 
+/** Set of canonical representatives handed out by ir_type_intern(). */
+static pset *interned_types;
+
 void ir_finish_type(ir_prog *irp)
 {
-	/** nothing to do. (The code, unknown types are in the global type list
-	 * and freed there */
+	/* The code and unknown types are in the global type list and freed
+	 * there; the interned types as well, only the set goes away here. */
 	(void)irp;
+	if (interned_types != NULL) {
+		del_pset(interned_types);
+		interned_types = NULL;
+	}
 }
 
 ir_visited_t firm_type_visited;
@@ -185,6 +194,86 @@ void free_type(ir_type *tp)
 	free(tp);
 }
 
+/**
+ * Structural hash over the fields ir_type_intern() compares. Component
+ * types and modes hash by identity.
+ */
+static unsigned intern_type_hash(ir_type const *const type)
+{
+	unsigned hash = hash_ptr(type->mode) ^ ((unsigned)type->opcode << 7);
+	switch (type->opcode) {
+	case tpo_pointer:
+		return hash ^ hash_ptr(type->attr.pointer.points_to);
+	case tpo_primitive:
+		return hash;
+	case tpo_method: {
+		method_attr const *const m = &type->attr.method;
+		hash ^= (unsigned)m->variadic * 9u
+		      ^ m->irg_calling_conv * 31u
+		      ^ (unsigned)m->properties * 2003u
+		      ^ (unsigned)m->n_compound_ret_params * 257u;
+		for (size_t i = 0; i < m->n_params; ++i)
+			hash = hash * 17u + hash_ptr(m->params[i]);
+		for (size_t i = 0; i < m->n_res; ++i)
+			hash = hash * 17u + hash_ptr(m->res_type[i]);
+		return hash;
+	}
+	default:
+		panic("cannot intern %+F", type);
+	}
+}
+
+/** pset compare function: 0 iff both types are structurally identical. */
+static int intern_type_cmp(void const *const p0, void const *const p1)
+{
+	ir_type const *const t0 = (ir_type const*)p0;
+	ir_type const *const t1 = (ir_type const*)p1;
+	if (t0->opcode != t1->opcode || t0->mode != t1->mode
+	 || t0->flags != t1->flags || t0->size != t1->size
+	 || t0->align != t1->align)
+		return 1;
+	switch (t0->opcode) {
+	case tpo_pointer:
+		return t0->attr.pointer.points_to != t1->attr.pointer.points_to;
+	case tpo_primitive:
+		return 0;
+	case tpo_method: {
+		method_attr const *const m0 = &t0->attr.method;
+		method_attr const *const m1 = &t1->attr.method;
+		if (m0->n_params != m1->n_params || m0->n_res != m1->n_res
+		 || m0->variadic != m1->variadic
+		 || m0->irg_calling_conv != m1->irg_calling_conv
+		 || m0->properties != m1->properties
+		 || m0->n_compound_ret_params != m1->n_compound_ret_params)
+			return 1;
+		for (size_t i = 0; i < m0->n_params; ++i) {
+			if (m0->params[i] != m1->params[i])
+				return 1;
+		}
+		for (size_t i = 0; i < m0->n_res; ++i) {
+			if (m0->res_type[i] != m1->res_type[i])
+				return 1;
+		}
+		return 0;
+	}
+	default:
+		return 1;
+	}
+}
+
+ir_type *ir_type_intern(ir_type *type)
+{
+	assert(is_Pointer_type(type) || is_Primitive_type(type)
+	    || is_Method_type(type));
+	if (interned_types == NULL)
+		interned_types = new_pset(intern_type_cmp, 64);
+	ir_type *const res
+		= (ir_type*)pset_insert(interned_types, type, intern_type_hash(type));
+	if (res != type)
+		free_type(type);
+	return res;
+}
+
 void *(get_type_link)(const ir_type *tp)
 {
 	return get_type_link_(tp);
@@ -314,13 +403,37 @@ void (set_type_dbg_info)(ir_type *tp, type_dbg_info *db)
 
 static void compound_init(ir_type *const type, ident *const name)
 {
-	type->flags                |= tf_compound;
-	type->name                  = name;
-	type->attr.compound.members = NEW_ARR_F(ir_entity*, 0);
+	type->flags                           |= tf_compound;
+	type->name                             = name;
+	type->attr.compound.members            = NEW_ARR_F(ir_entity*, 0);
+	type->attr.compound.member_map         = NULL;
+	type->attr.compound.members_by_offset  = NULL;
+}
+
+void ir_invalidate_compound_member_index(ir_type *type)
+{
+	assert(is_compound_type(type));
+	compound_attr *const attr = &type->attr.compound;
+	if (attr->member_map != NULL) {
+		pmap_destroy(attr->member_map);
+		attr->member_map = NULL;
+	}
+	ir_invalidate_compound_offset_index(type);
+}
+
+void ir_invalidate_compound_offset_index(ir_type *type)
+{
+	assert(is_compound_type(type));
+	compound_attr *const attr = &type->attr.compound;
+	if (attr->members_by_offset != NULL) {
+		DEL_ARR_F(attr->members_by_offset);
+		attr->members_by_offset = NULL;
+	}
 }
 
 void free_compound_attrs(ir_type *type)
 {
+	ir_invalidate_compound_member_index(type);
 	DEL_ARR_F(type->attr.compound.members);
 }
 
@@ -528,6 +641,7 @@ ir_type *new_type_method(size_t const n_param, size_t const n_res, int const is_
 	res->attr.method.variadic         = is_variadic ? (int)n_param : -1;
 	res->attr.method.irg_calling_conv = cc_mask;
 	res->attr.method.properties       = property_mask;
+	res->attr.method.n_compound_ret_params = 0;
 	set_type_alignment(res, 1);
 	hook_new_type(res);
 	return res;
@@ -554,6 +668,7 @@ ir_type *clone_type_method(ir_type *const tp, int const variadic_index, mtp_addi
 	res->attr.method.variadic         = variadic_index;
 	res->attr.method.properties       = property_mask;
 	res->attr.method.irg_calling_conv = tp->attr.method.irg_calling_conv;
+	res->attr.method.n_compound_ret_params = tp->attr.method.n_compound_ret_params;
 	set_type_alignment(res, get_type_alignment(tp));
 	hook_new_type(res);
 	return res;
@@ -640,6 +755,19 @@ unsigned get_method_n_regparams(ir_type *method)
 	return cc & ~cc_bits;
 }
 
+size_t get_method_n_compound_ret_params(const ir_type *method)
+{
+	assert(is_Method_type(method));
+	return method->attr.method.n_compound_ret_params;
+}
+
+void set_method_n_compound_ret_params(ir_type *method, size_t n_hidden)
+{
+	assert(is_Method_type(method));
+	assert(n_hidden <= get_method_n_params(method));
+	method->attr.method.n_compound_ret_params = n_hidden;
+}
+
 int (is_Method_type)(const ir_type *method)
 {
 	return is_method_type_(method);
@@ -800,6 +928,79 @@ size_t get_compound_member_index(ir_type const *const type,
 	return INVALID_MEMBER_INDEX;
 }
 
+/** Minimum number of members before a hash index pays off. */
+#define MEMBER_INDEX_THRESHOLD 32
+
+ir_entity *get_compound_member_by_name(ir_type const *const type,
+                                       ident *const name)
+{
+	assert(is_compound_type(type));
+	compound_attr *const attr = &((ir_type*)type)->attr.compound;
+	size_t         const n    = get_compound_n_members(type);
+	if (n < MEMBER_INDEX_THRESHOLD) {
+		for (size_t i = 0; i < n; ++i) {
+			ir_entity *member = get_compound_member(type, i);
+			if (get_entity_ident(member) == name)
+				return member;
+		}
+		return NULL;
+	}
+	if (attr->member_map == NULL) {
+		pmap *const map = pmap_create_ex(n);
+		for (size_t i = 0; i < n; ++i) {
+			ir_entity *member = get_compound_member(type, i);
+			ident     *id     = get_entity_ident(member);
+			/* on duplicate names keep the first, like the linear scan */
+			if (pmap_get(ir_entity, map, id) == NULL)
+				pmap_insert(map, id, member);
+		}
+		attr->member_map = map;
+	}
+	return pmap_get(ir_entity, attr->member_map, name);
+}
+
+/** QSORT callback ordering entities by ascending offset. */
+static int cmp_member_offset(const void *p0, const void *p1)
+{
+	ir_entity const *const e0 = *(ir_entity const *const*)p0;
+	ir_entity const *const e1 = *(ir_entity const *const*)p1;
+	return QSORT_CMP(get_entity_offset(e0), get_entity_offset(e1));
+}
+
+ir_entity *get_compound_member_at_offset(ir_type const *const type,
+                                         int const offset)
+{
+	assert(is_compound_type(type));
+	compound_attr *const attr = &((ir_type*)type)->attr.compound;
+	if (attr->members_by_offset == NULL) {
+		size_t const n      = get_compound_n_members(type);
+		ir_entity  **sorted = NEW_ARR_F(ir_entity*, 0);
+		for (size_t i = 0; i < n; ++i) {
+			ir_entity *member = get_compound_member(type, i);
+			if (get_entity_offset(member) != INVALID_OFFSET)
+				ARR_APP1(ir_entity*, sorted, member);
+		}
+		QSORT_ARR(sorted, cmp_member_offset);
+		attr->members_by_offset = sorted;
+	}
+
+	ir_entity **const sorted = attr->members_by_offset;
+	size_t            lo     = 0;
+	size_t            hi     = ARR_LEN(sorted);
+	while (lo < hi) {
+		size_t const mid        = lo + (hi - lo) / 2;
+		int    const mid_offset = get_entity_offset(sorted[mid]);
+		if (mid_offset < offset) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	if (lo < ARR_LEN(sorted) && get_entity_offset(sorted[lo]) == offset)
+		return sorted[lo];
+	return NULL;
+}
+
 int is_compound_type(const ir_type *tp)
 {
 	assert(tp->kind == k_type);
@@ -822,6 +1023,7 @@ const char *get_compound_name(const ir_type *tp)
 void remove_compound_member(ir_type *type, ir_entity *member)
 {
 	assert(is_compound_type(type));
+	ir_invalidate_compound_member_index(type);
 	for (size_t i = 0, n = ARR_LEN(type->attr.compound.members); i < n; ++i) {
 		if (get_compound_member(type, i) != member)
 			continue;
@@ -841,6 +1043,7 @@ void remove_compound_member(ir_type *type, ir_entity *member)
 void add_compound_member(ir_type *type, ir_entity *entity)
 {
 	assert(is_compound_type(type));
+	ir_invalidate_compound_member_index(type);
 	/* try to detect double-add */
 	ARR_APP1(ir_entity *, type->attr.compound.members, entity);
 	/* Add segment members to globals map. */
@@ -944,6 +1147,62 @@ void default_layout_compound_type(ir_type *type)
 	set_type_state(type, layout_fixed);
 }
 
+/**
+ * Checks whether default_layout_compound_type() can lay out @p type:
+ * it must not contain bitfield members (their layout is frontend
+ * specific) and all member types except a trailing flexible array must
+ * already have a fixed layout.
+ */
+static bool can_layout_compound(const ir_type *type)
+{
+	for (size_t i = 0, n = get_compound_n_members(type); i < n; ++i) {
+		ir_entity *entity      = get_compound_member(type, i);
+		ir_type   *entity_type = get_entity_type(entity);
+		if (is_Method_type(entity_type))
+			continue;
+		/* rules out pseudo compounds like the unknown entity's owner */
+		if (get_entity_kind(entity) != IR_ENTITY_COMPOUND_MEMBER)
+			return false;
+		if (get_entity_bitfield_size(entity) > 0)
+			return false;
+		if (i + 1 == n && is_Array_type(entity_type)
+		    && get_array_size(entity_type) == 0)
+			continue;
+		if (get_type_state(entity_type) != layout_fixed)
+			return false;
+	}
+	return true;
+}
+
+static void compute_layout_walker(ir_type *const type, ir_entity *const entity,
+                                  void *const env)
+{
+	(void)env;
+	if (entity != NULL)
+		return;
+	if (get_type_state(type) == layout_fixed)
+		return;
+	/* Only plain compounds get the default layout; segments and frame
+	 * types are laid out by the backend and all other types lay
+	 * themselves out on creation. */
+	if (!is_compound_type(type) || is_segment_type(type)
+	    || is_frame_type(type))
+		return;
+	if (!can_layout_compound(type))
+		return;
+	default_layout_compound_type(type);
+}
+
+void ir_compute_all_type_layouts(void)
+{
+	/* The type walker calls back in post order, so member types are
+	 * handled before the compounds containing them: one walk is a
+	 * topological pass over the whole type graph and the visited marks
+	 * ensure every type is laid out exactly once however often it is
+	 * shared. */
+	type_walk(NULL, compute_layout_walker, NULL);
+}
+
 void ir_print_type(char *buffer, size_t buffer_size, const ir_type *type)
 {
 	type_dbg_info *tdbgi = get_type_dbg_info(type);
@@ -16,6 +16,7 @@
 
 #include "array.h"
 #include "firm_common.h"
+#include "pmap.h"
 #include "typerep.h"
 
 #define get_master_type_visited()         get_master_type_visited_()
@@ -51,6 +52,10 @@
 /** Compound type attributes. */
 typedef struct {
 	ir_entity **members;
+	pmap       *member_map;        /**< lazily built ident -> member index,
+	                                    see get_compound_member_by_name() */
+	ir_entity **members_by_offset; /**< lazily built array sorted by offset,
+	                                    see get_compound_member_at_offset() */
 } compound_attr;
 
 /** Class type attributes. */
@@ -70,6 +75,9 @@ typedef struct {
                                                      Values >= 0 represent the index of the first variadic parameter. */
 	mtp_additional_properties properties;       /**< Set of additional method properties. */
 	unsigned                  irg_calling_conv; /**< A set of calling convention flags. */
+	size_t                    n_compound_ret_params; /**< Number of leading hidden pointer
+	                                                      parameters returning compound results,
+	                                                      recorded by the compound lowering. */
 } method_attr;
 
 /** Array type attributes. */
@@ -145,6 +153,14 @@ void free_method_attrs(ir_type *method);
 
 void add_compound_member(ir_type *compound, ir_entity *entity);
 
+/** Drops the lazily built member lookup indices of @p compound.
+ * Must be called whenever member names change. */
+void ir_invalidate_compound_member_index(ir_type *compound);
+
+/** Drops the lazily built by-offset member index of @p compound.
+ * Must be called whenever a member offset changes. */
+void ir_invalidate_compound_offset_index(ir_type *compound);
+
 /** Initialize the type module. */
 void ir_init_type(ir_prog *irp);
 
@@ -14,6 +14,7 @@
  * - execute the pre function before recursion
  * - execute the post function after recursion
  */
+#include "array.h"
 #include "entity_t.h"
 #include "ircons.h"
 #include "irgraph_t.h"
@@ -239,6 +240,83 @@ void type_walk_irg(ir_graph *irg, type_walk_func *pre, type_walk_func *post,
 	irp_free_resources(irp, IRP_RESOURCE_TYPE_VISITED);
 }
 
+void type_walk_entity(ir_entity *entity, type_walk_func *pre,
+                      type_walk_func *post, void *env)
+{
+	irp_reserve_resources(irp, IRP_RESOURCE_TYPE_VISITED);
+	inc_master_type_visited();
+	do_type_walk(NULL, entity, pre, post, env);
+	irp_free_resources(irp, IRP_RESOURCE_TYPE_VISITED);
+}
+
+/** A snapshot of a type walk: the visited types and entities in flat
+ * arrays, in discovery order. */
+struct type_snapshot_t {
+	ir_type   **types;    /**< flexible array of the visited types */
+	ir_entity **entities; /**< flexible array of the visited entities */
+};
+
+static void snapshot_collect(ir_type *type, ir_entity *entity, void *env)
+{
+	type_snapshot_t *snapshot = (type_snapshot_t*)env;
+	if (entity != NULL)
+		ARR_APP1(ir_entity*, snapshot->entities, entity);
+	else
+		ARR_APP1(ir_type*, snapshot->types, type);
+}
+
+static type_snapshot_t *new_type_snapshot(void)
+{
+	type_snapshot_t *snapshot = XMALLOC(type_snapshot_t);
+	snapshot->types    = NEW_ARR_F(ir_type*, 0);
+	snapshot->entities = NEW_ARR_F(ir_entity*, 0);
+	return snapshot;
+}
+
+type_snapshot_t *create_type_snapshot(void)
+{
+	type_snapshot_t *snapshot = new_type_snapshot();
+	type_walk(snapshot_collect, NULL, snapshot);
+	return snapshot;
+}
+
+type_snapshot_t *create_type_snapshot_irg(ir_graph *irg)
+{
+	type_snapshot_t *snapshot = new_type_snapshot();
+	type_walk_irg(irg, snapshot_collect, NULL, snapshot);
+	return snapshot;
+}
+
+size_t get_type_snapshot_n_types(const type_snapshot_t *snapshot)
+{
+	return ARR_LEN(snapshot->types);
+}
+
+ir_type *get_type_snapshot_type(const type_snapshot_t *snapshot, size_t pos)
+{
+	assert(pos < ARR_LEN(snapshot->types));
+	return snapshot->types[pos];
+}
+
+size_t get_type_snapshot_n_entities(const type_snapshot_t *snapshot)
+{
+	return ARR_LEN(snapshot->entities);
+}
+
+ir_entity *get_type_snapshot_entity(const type_snapshot_t *snapshot,
+                                    size_t pos)
+{
+	assert(pos < ARR_LEN(snapshot->entities));
+	return snapshot->entities[pos];
+}
+
+void free_type_snapshot(type_snapshot_t *snapshot)
+{
+	DEL_ARR_F(snapshot->entities);
+	DEL_ARR_F(snapshot->types);
+	xfree(snapshot);
+}
+
 static void type_walk_s2s_2(ir_type *const tp, type_walk_func *pre,
                             type_walk_func *post, void *env)
 {
@@ -15,6 +15,7 @@
 #include "strcalc.h"
 #include "xmalloc.h"
 #include <assert.h>
+#include <fenv.h>
 #include <float.h>
 #include <inttypes.h>
 #include <limits.h>
@@ -389,8 +390,127 @@ static void _fadd(const fp_value *a, const fp_value *b, fp_value *result)
 	fc_exact &= normalize(result, sticky);
 }
 
+/** The binary operations with a hardware fast path. */
+typedef enum hw_fold_op_t {
+	HW_FOLD_ADD,
+	HW_FOLD_SUB,
+	HW_FOLD_MUL,
+	HW_FOLD_DIV,
+} hw_fold_op_t;
+
+static bool desc_matches(const float_descriptor_t *desc,
+                         unsigned exponent_size, unsigned mantissa_size)
+{
+	return desc->exponent_size == exponent_size
+	    && desc->mantissa_size == mantissa_size
+	    && !desc->explicit_one;
+}
+
+/** The packed value bytes are in little endian order, see strcalc. */
+static uint64_t bytes_to_uint(const unsigned char *bytes, unsigned n_bytes)
+{
+	uint64_t res = 0;
+	for (unsigned i = 0; i < n_bytes; ++i)
+		res |= (uint64_t)bytes[i] << (i * CHAR_BIT);
+	return res;
+}
+
+static void uint_to_bytes(uint64_t value, unsigned char *bytes,
+                          unsigned n_bytes)
+{
+	for (unsigned i = 0; i < n_bytes; ++i)
+		bytes[i] = (unsigned char)(value >> (i * CHAR_BIT));
+}
+
+/**
+ * Tries to fold the operation with the host FPU. This only fires when
+ * the values are IEEE754 binary32/binary64 and we round to nearest, so
+ * the host result is the one IEEE754 prescribes regardless of the
+ * build machine. Cases where hosts may legitimately differ - NaN
+ * payload propagation and subnormal handling (flush-to-zero hosts) -
+ * stay in the software implementation, as does the x86 extended
+ * precision format.
+ *
+ * @return  true if the result was computed, false to use the software path
+ */
+static bool try_hw_fold(hw_fold_op_t op, const fp_value *a, const fp_value *b,
+                        fp_value *result)
+{
+	/* The host FPU rounds to nearest, ties to even. */
+	if (rounding_mode != FC_TONEAREST)
+		return false;
+	if (a->clss == FC_NAN || b->clss == FC_NAN
+	 || a->clss == FC_SUBNORMAL || b->clss == FC_SUBNORMAL
+	 /* the software path also flags operations on infinities and zeros
+	  * as inexact (division by zero, zero plus zero); keep its behavior
+	  * exactly */
+	 || a->clss == FC_INF || b->clss == FC_INF
+	 || a->clss == FC_ZERO || b->clss == FC_ZERO)
+		return false;
+	const float_descriptor_t *desc = &a->desc;
+	if (b->desc.exponent_size != desc->exponent_size
+	 || b->desc.mantissa_size != desc->mantissa_size)
+		return false;
+	bool const is_double = desc_matches(desc, 11, 52);
+	if (!is_double && !desc_matches(desc, 8, 23))
+		return false;
+	/* An embedder may have changed the host rounding mode. */
+	if (fegetround() != FE_TONEAREST)
+		return false;
+
+	float_descriptor_t const res_desc = *desc; /* result may alias a */
+	unsigned char bytes[8];
+	feclearexcept(FE_ALL_EXCEPT);
+	if (is_double) {
+		union { double d; uint64_t u; } x, y, r;
+		fc_val_to_bytes(a, bytes);
+		x.u = bytes_to_uint(bytes, 8);
+		fc_val_to_bytes(b, bytes);
+		y.u = bytes_to_uint(bytes, 8);
+		/* volatile keeps the operation between the fenv calls */
+		volatile double rv;
+		switch (op) {
+		case HW_FOLD_ADD: rv = x.d + y.d; break;
+		case HW_FOLD_SUB: rv = x.d - y.d; break;
+		case HW_FOLD_MUL: rv = x.d * y.d; break;
+		case HW_FOLD_DIV: rv = x.d / y.d; break;
+		}
+		r.d = rv;
+		if (isnan(r.d))
+			return false;
+		uint_to_bytes(r.u, bytes, 8);
+	} else {
+		union { float f; uint32_t u; } x, y, r;
+		fc_val_to_bytes(a, bytes);
+		x.u = (uint32_t)bytes_to_uint(bytes, 4);
+		fc_val_to_bytes(b, bytes);
+		y.u = (uint32_t)bytes_to_uint(bytes, 4);
+		volatile float rv;
+		switch (op) {
+		case HW_FOLD_ADD: rv = x.f + y.f; break;
+		case HW_FOLD_SUB: rv = x.f - y.f; break;
+		case HW_FOLD_MUL: rv = x.f * y.f; break;
+		case HW_FOLD_DIV: rv = x.f / y.f; break;
+		}
+		r.f = rv;
+		if (isnan(r.f))
+			return false;
+		uint_to_bytes(r.u, bytes, 4);
+	}
+	int const excepts = fetestexcept(FE_INVALID | FE_UNDERFLOW | FE_INEXACT);
+	if (excepts & (FE_INVALID | FE_UNDERFLOW))
+		return false;
+
+	fc_val_from_bytes(result, bytes, &res_desc);
+	fc_exact = (excepts & FE_INEXACT) == 0;
+	return true;
+}
+
 void fc_mul(const fp_value *a, const fp_value *b, fp_value *result)
 {
+	if (try_hw_fold(HW_FOLD_MUL, a, b, result))
+		return;
+
 	fc_exact = true;
 	if (handle_NAN(a, b, result))
 		return;
@@ -468,6 +588,9 @@ void fc_mul(const fp_value *a, const fp_value *b, fp_value *result)
 
 void fc_div(const fp_value *a, const fp_value *b, fp_value *result)
 {
+	if (try_hw_fold(HW_FOLD_DIV, a, b, result))
+		return;
+
 	fc_exact = true;
 	if (handle_NAN(a, b, result))
 		return;
@@ -1082,6 +1205,9 @@ void init_fltcalc(unsigned precision)
 /* definition of interface functions */
 void fc_add(const fp_value *a, const fp_value *b, fp_value *result)
 {
+	if (try_hw_fold(HW_FOLD_ADD, a, b, result))
+		return;
+
 	fc_exact = true;
 	if (handle_NAN(a, b, result))
 		return;
@@ -1095,6 +1221,9 @@ void fc_add(const fp_value *a, const fp_value *b, fp_value *result)
 
 void fc_sub(const fp_value *a, const fp_value *b, fp_value *result)
 {
+	if (try_hw_fold(HW_FOLD_SUB, a, b, result))
+		return;
+
 	fc_exact = true;
 	if (handle_NAN(a, b, result))
 		return;
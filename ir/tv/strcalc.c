@@ -50,6 +50,32 @@ static sc_word min_digit(unsigned x)
 	return SC_MASK - max_digit(x);
 }
 
+/** Reads @p n words (n <= 8) as one little-endian 64bit chunk. The
+ * shift/or form compiles down to a plain load on little-endian hosts. */
+static inline uint64_t sc_read_chunk(const sc_word *p, unsigned n)
+{
+	uint64_t value = 0;
+	for (unsigned i = 0; i < n; ++i)
+		value |= (uint64_t)p[i] << (i * SC_BITS);
+	return value;
+}
+
+/** Writes @p value as @p n (n <= 8) little-endian words. */
+static inline void sc_write_chunk(sc_word *p, unsigned n, uint64_t value)
+{
+	for (unsigned i = 0; i < n; ++i)
+		p[i] = (sc_word)(value >> (i * SC_BITS));
+}
+
+/** Returns the number of words up to and including the highest non-zero
+ * one, looking at the @p len least significant words of @p value. */
+static unsigned sc_significant_words(const sc_word *value, unsigned len)
+{
+	while (len > 0 && value[len - 1] == 0)
+		--len;
+	return len;
+}
+
 void sc_not(const sc_word *val, sc_word *buffer)
 {
 	for (unsigned counter = 0; counter<calc_buffer_size; counter++)
@@ -106,8 +132,18 @@ void sc_neg(const sc_word *val, sc_word *buffer)
 
 void sc_add(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 {
-	sc_word carry = 0;
-	for (unsigned counter = 0; counter < calc_buffer_size; ++counter) {
+	/* 64bit chunks at a time instead of single-word carry chains */
+	unsigned carry   = 0;
+	unsigned counter = 0;
+	for (; counter + 8 <= calc_buffer_size; counter += 8) {
+		uint64_t const a   = sc_read_chunk(val1 + counter, 8);
+		uint64_t const b   = sc_read_chunk(val2 + counter, 8);
+		uint64_t const sum = a + b;
+		uint64_t const out = sum + carry;
+		sc_write_chunk(buffer + counter, 8, out);
+		carry = (sum < a) | (out < sum);
+	}
+	for (; counter < calc_buffer_size; ++counter) {
 		unsigned const sum = val1[counter] + val2[counter] + carry;
 		buffer[counter] = SC_RESULT(sum);
 		carry           = SC_CARRY(sum);
@@ -116,11 +152,22 @@ void sc_add(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 
 void sc_sub(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 {
-	/* intermediate buffer to hold -val2 */
-	sc_word *temp_buffer = ALLOCAN(sc_word, calc_buffer_size);
-
-	sc_neg(val2, temp_buffer);
-	sc_add(val1, temp_buffer, buffer);
+	/* subtract directly with a borrow chain, 64bit chunks at a time */
+	unsigned borrow  = 0;
+	unsigned counter = 0;
+	for (; counter + 8 <= calc_buffer_size; counter += 8) {
+		uint64_t const a    = sc_read_chunk(val1 + counter, 8);
+		uint64_t const b    = sc_read_chunk(val2 + counter, 8);
+		uint64_t const diff = a - b;
+		uint64_t const out  = diff - borrow;
+		sc_write_chunk(buffer + counter, 8, out);
+		borrow = (a < b) | (diff < (uint64_t)borrow);
+	}
+	for (; counter < calc_buffer_size; ++counter) {
+		unsigned const diff = val1[counter] - val2[counter] - borrow;
+		buffer[counter] = SC_RESULT(diff);
+		borrow          = SC_CARRY(diff) & 1;
+	}
 }
 
 void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
@@ -143,6 +190,35 @@ void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 		sign = !sign;
 	}
 
+	/* Fast path: operands fitting into 64 bits each (the common case
+	 * for 32 and 64 bit modes) need just four 32x32->64 partial
+	 * products instead of the word-wise schoolbook loop below. */
+	unsigned const words1 = sc_significant_words(val1, max_value_size);
+	unsigned const words2 = sc_significant_words(val2, max_value_size);
+	if (words1 <= 8 && words2 <= 8 && calc_buffer_size >= 16) {
+		uint64_t const a   = sc_read_chunk(val1, 8);
+		uint64_t const b   = sc_read_chunk(val2, 8);
+		uint64_t const a0  = (uint32_t)a;
+		uint64_t const a1  = a >> 32;
+		uint64_t const b0  = (uint32_t)b;
+		uint64_t const b1  = b >> 32;
+		uint64_t const p00 = a0 * b0;
+		/* none of these sums can overflow:
+		 * (2^32-1)^2 + 2*(2^32-1) = 2^64-1 */
+		uint64_t const mid1 = a1 * b0 + (p00 >> 32);
+		uint64_t const mid2 = a0 * b1 + (uint32_t)mid1;
+		uint64_t const hi   = a1 * b1 + (mid1 >> 32) + (mid2 >> 32);
+		uint64_t const lo   = (mid2 << 32) | (uint32_t)p00;
+		sc_write_chunk(temp_buffer,     8, lo);
+		sc_write_chunk(temp_buffer + 8, 8, hi);
+
+		if (sign)
+			sc_neg(temp_buffer, buffer);
+		else
+			memcpy(buffer, temp_buffer, calc_buffer_size);
+		return;
+	}
+
 	for (unsigned c_outer = 0; c_outer < max_value_size; c_outer++) {
 		sc_word outer = val2[c_outer];
 		if (outer == 0)
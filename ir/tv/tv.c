@@ -21,6 +21,7 @@
 #include "bitfiddle.h"
 #include "entity_t.h"
 #include "firm_common.h"
+#include "firm_threads.h"
 #include "fltcalc.h"
 #include "hashptr.h"
 #include "hashptr.h"
@@ -42,8 +43,19 @@
  * constant target values */
 #define N_CONSTANTS 2048
 
-/** A set containing all existing tarvals. */
-static struct set *tarvals = NULL;
+/** Number of interning table shards; must be a power of two. Sharding by
+ * hash keeps concurrent optimizer threads out of each other's way while
+ * preserving pointer identity of interned tarvals. */
+#define N_TARVAL_SHARDS 16
+
+/** One shard of the tarval interning table. */
+typedef struct tarval_shard_t {
+	struct set   *set;  /**< tarvals whose hash maps to this shard */
+	firm_mutex_t  lock; /**< protects set */
+} tarval_shard_t;
+
+/** The sharded set containing all existing tarvals. */
+static tarval_shard_t tarval_shards[N_TARVAL_SHARDS];
 
 static unsigned sc_value_length;
 static unsigned fp_value_size;
@@ -70,9 +82,16 @@ static int cmp_tv(const void *p1, const void *p2, size_t n)
 
 static ir_tarval *identify_tarval(ir_tarval const *const tv)
 {
-	unsigned hash = hash_tv(tv);
-	return set_insert(ir_tarval, tarvals, tv, sizeof(ir_tarval) + tv->length,
-	                  hash);
+	unsigned        const hash  = hash_tv(tv);
+	/* The set uses the low hash bits for its buckets, so pick the shard
+	 * from the high bits. */
+	tarval_shard_t *const shard
+		= &tarval_shards[(hash >> 16) % N_TARVAL_SHARDS];
+	firm_mutex_lock(&shard->lock);
+	ir_tarval *const res = set_insert(ir_tarval, shard->set, tv,
+	                                  sizeof(ir_tarval) + tv->length, hash);
+	firm_mutex_unlock(&shard->lock);
+	return res;
 }
 
 static ir_tarval *get_fp_tarval(const fp_value *value, ir_mode *mode)
@@ -1331,7 +1350,10 @@ void init_tarval_1(void)
 {
 	/* initialize the sets holding the tarvals with a comparison function and
 	 * an initial size, which is the expected number of constants */
-	tarvals = new_set(cmp_tv, N_CONSTANTS);
+	for (unsigned i = 0; i < N_TARVAL_SHARDS; ++i) {
+		tarval_shards[i].set = new_set(cmp_tv, N_CONSTANTS / N_TARVAL_SHARDS);
+		firm_mutex_init(&tarval_shards[i].lock);
+	}
 	/* calls init_strcalc() with needed size */
 	init_fltcalc(128);
 
@@ -1359,7 +1381,11 @@ void init_tarval_2(void)
 void finish_tarval(void)
 {
 	finish_strcalc();
-	del_set(tarvals); tarvals = NULL;
+	for (unsigned i = 0; i < N_TARVAL_SHARDS; ++i) {
+		del_set(tarval_shards[i].set);
+		tarval_shards[i].set = NULL;
+		firm_mutex_destroy(&tarval_shards[i].lock);
+	}
 }
 
 bool tarval_in_range(ir_tarval const *const min, ir_tarval const *const val, ir_tarval const *const max)
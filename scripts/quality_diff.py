@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Diff two code quality reports produced by the quality bench driver.
+
+The driver compiles an .ir corpus through be_main with statev enabled
+and leaves a .ev file. This script aggregates the per-function quality
+events of two such files - instruction/block counts at emission, spill,
+reload and remat counts, copy minimization costs and constraint copies
+- and prints the per-function and total deltas:
+
+    quality_diff.py before.ev after.ev
+"""
+import argparse
+import sys
+from collections import defaultdict
+
+# Event keys that describe generated code quality. Everything else in
+# the .ev file (timings, intermediate sizes) is ignored.
+METRICS = (
+    "bemain_insns_finish",
+    "bemain_blocks_finish",
+    "spill_spills",
+    "spill_reloads",
+    "spill_remats",
+    "spill_spilled_phis",
+    "co_init_costs",
+    "co_after_costs",
+    "ra_precol_copies",
+    "ra_multi_precol_copies",
+    "ra_constrained_livethrough_copies",
+)
+
+
+def parse_ev(filename):
+    """Returns {function: {metric: value}} summed over all contexts."""
+    functions = defaultdict(lambda: defaultdict(float))
+    context = {}
+    with open(filename) as f:
+        for line in f:
+            parts = line.rstrip("\n").split(";")
+            if parts[0] == "P" and len(parts) >= 3:
+                value = parts[2]
+                if parts[1] == "bemain_irg":
+                    # strip the per-run node number: "name[12345]" -> "name"
+                    value = value.split("[", 1)[0]
+                context[parts[1]] = value
+            elif parts[0] == "O" and len(parts) >= 2:
+                context.pop(parts[1], None)
+            elif parts[0] == "E" and len(parts) >= 3:
+                key = parts[1]
+                if key not in METRICS:
+                    continue
+                function = context.get("bemain_irg")
+                if function is None:
+                    continue
+                try:
+                    value = float(parts[2])
+                except ValueError:
+                    continue
+                functions[function][key] += value
+    return functions
+
+
+def fmt_delta(before, after):
+    delta = after - before
+    if before != 0:
+        return "%+g (%+.1f%%)" % (delta, 100.0 * delta / before)
+    return "%+g" % delta
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("before", help="statev report of the baseline build")
+    parser.add_argument("after", help="statev report of the changed build")
+    parser.add_argument("-a", "--all", action="store_true",
+                        help="also list functions without changes")
+    args = parser.parse_args()
+
+    before = parse_ev(args.before)
+    after = parse_ev(args.after)
+
+    all_functions = sorted(set(before) | set(after))
+    n_changed = 0
+    for function in all_functions:
+        b = before.get(function, {})
+        a = after.get(function, {})
+        changed = {m for m in METRICS if b.get(m, 0) != a.get(m, 0)}
+        if not changed and not args.all:
+            continue
+        if function not in before:
+            print("%s: only in %s" % (function, args.after))
+            continue
+        if function not in after:
+            print("%s: only in %s" % (function, args.before))
+            continue
+        n_changed += bool(changed)
+        print("%s:" % function)
+        for metric in METRICS:
+            bv, av = b.get(metric, 0), a.get(metric, 0)
+            if bv == 0 and av == 0:
+                continue
+            mark = "" if bv == av else "  " + fmt_delta(bv, av)
+            print("  %-36s %10g -> %10g%s" % (metric, bv, av, mark))
+
+    print()
+    print("total (%d functions, %d changed):" % (len(all_functions), n_changed))
+    for metric in METRICS:
+        bv = sum(f.get(metric, 0) for f in before.values())
+        av = sum(f.get(metric, 0) for f in after.values())
+        if bv == 0 and av == 0:
+            continue
+        mark = "" if bv == av else "  " + fmt_delta(bv, av)
+        print("  %-36s %10g -> %10g%s" % (metric, bv, av, mark))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -21,23 +21,25 @@ static profile_counter_t *counters = NULL;
 
 /**
  * Write counter values to profiling output file.
- * We define our output format to be a sequence of 32-bit unsigned integer
- * values stored in little endian format.
+ * Counters are ULEB128 encoded, so blocks which were executed rarely (or
+ * not at all) take a single byte instead of four.
  */
-void write_little_endian(unsigned *counter, unsigned len, FILE *f)
+void write_uleb128(unsigned *counter, unsigned len, FILE *f)
 {
 	unsigned i;
 
 	for (i = 0; i < len; ++i) {
-		unsigned      v = counter[i];
-		unsigned char bytes[4];
+		unsigned v = counter[i];
 
-		bytes[0] = ((v >>  0) & 0xff);
-		bytes[1] = ((v >>  8) & 0xff);
-		bytes[2] = ((v >> 16) & 0xff);
-		bytes[3] = ((v >> 24) & 0xff);
-
-		fwrite(bytes, 1, 4, f);
+		for (;;) {
+			unsigned char byte = v & 0x7f;
+			v >>= 7;
+			if (v != 0)
+				byte |= 0x80;
+			fputc(byte, f);
+			if (v == 0)
+				break;
+		}
 	}
 }
 
@@ -50,8 +52,8 @@ static void write_profiles(void)
 		if (f == NULL) {
 			perror("Warning: couldn't open file for writing profiling data");
 		} else {
-			fputs("firmprof", f);
-			write_little_endian(counter->counters, counter->len, f);
+			fputs("firmprf2", f);
+			write_uleb128(counter->counters, counter->len, f);
 			fclose(f);
 		}
 		free(counter);
@@ -0,0 +1,124 @@
+#include "pmap_new.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+static char keys[4096];
+static char values[4096];
+
+static void test_basic(void)
+{
+	pmap_new_t map;
+	pmap_new_init(&map);
+	assert(pmap_new_size(&map) == 0);
+	assert(pmap_new_get(char, &map, &keys[0]) == NULL);
+
+	pmap_new_insert(&map, &keys[0], &values[0]);
+	assert(pmap_new_size(&map) == 1);
+	assert(pmap_new_get(char, &map, &keys[0]) == &values[0]);
+	assert(pmap_new_get(char, &map, &keys[1]) == NULL);
+
+	/* inserting an existing key overwrites the mapping */
+	pmap_new_insert(&map, &keys[0], &values[1]);
+	assert(pmap_new_size(&map) == 1);
+	assert(pmap_new_get(char, &map, &keys[0]) == &values[1]);
+
+	pmap_new_remove(&map, &keys[0]);
+	assert(pmap_new_size(&map) == 0);
+	assert(pmap_new_get(char, &map, &keys[0]) == NULL);
+	/* removing an absent key is a no-op */
+	pmap_new_remove(&map, &keys[0]);
+	assert(pmap_new_size(&map) == 0);
+
+	pmap_new_destroy(&map);
+}
+
+static void test_grow(void)
+{
+	pmap_new_t map;
+	pmap_new_init(&map);
+
+	for (size_t i = 0; i < sizeof(keys); ++i) {
+		pmap_new_insert(&map, &keys[i], &values[i]);
+		assert(pmap_new_size(&map) == i + 1);
+	}
+	/* every mapping must survive the rehashes */
+	for (size_t i = 0; i < sizeof(keys); ++i)
+		assert(pmap_new_get(char, &map, &keys[i]) == &values[i]);
+
+	/* remove every other key, the rest must stay reachable across the
+	 * deleted slots */
+	for (size_t i = 0; i < sizeof(keys); i += 2)
+		pmap_new_remove(&map, &keys[i]);
+	assert(pmap_new_size(&map) == sizeof(keys) / 2);
+	for (size_t i = 0; i < sizeof(keys); ++i) {
+		char *const expected = i % 2 == 0 ? NULL : &values[i];
+		assert(pmap_new_get(char, &map, &keys[i]) == expected);
+	}
+
+	/* re-inserting must reuse the deleted slots */
+	for (size_t i = 0; i < sizeof(keys); i += 2)
+		pmap_new_insert(&map, &keys[i], &values[i]);
+	assert(pmap_new_size(&map) == sizeof(keys));
+	for (size_t i = 0; i < sizeof(keys); ++i)
+		assert(pmap_new_get(char, &map, &keys[i]) == &values[i]);
+
+	pmap_new_destroy(&map);
+}
+
+static void test_iterator(void)
+{
+	pmap_new_t map;
+	pmap_new_init_size(&map, 64);
+
+	for (size_t i = 0; i < 64; ++i)
+		pmap_new_insert(&map, &keys[i], &values[i]);
+
+	bool                seen[64] = { false };
+	pmap_new_iterator_t iter;
+	pmap_new_entry_t    entry;
+	size_t              n = 0;
+	foreach_pmap_new(&map, entry, iter) {
+		size_t const i = (size_t)((char const *)entry.key - keys);
+		assert(i < 64);
+		assert(!seen[i]);
+		assert(entry.data == &values[i]);
+		seen[i] = true;
+		++n;
+	}
+	assert(n == 64);
+
+	pmap_new_destroy(&map);
+}
+
+static void test_remove_iterator(void)
+{
+	pmap_new_t map;
+	pmap_new_init(&map);
+
+	for (size_t i = 0; i < 64; ++i)
+		pmap_new_insert(&map, &keys[i], &values[i]);
+
+	pmap_new_iterator_t iter;
+	pmap_new_entry_t    entry;
+	foreach_pmap_new(&map, entry, iter) {
+		if (((char const *)entry.key - keys) % 2 == 0)
+			pmap_new_remove_iterator(&map, &iter);
+	}
+	assert(pmap_new_size(&map) == 32);
+	for (size_t i = 0; i < 64; ++i) {
+		char *const expected = i % 2 == 0 ? NULL : &values[i];
+		assert(pmap_new_get(char, &map, &keys[i]) == expected);
+	}
+
+	pmap_new_destroy(&map);
+}
+
+int main(void)
+{
+	test_basic();
+	test_grow();
+	test_iterator();
+	test_remove_iterator();
+	return 0;
+}
@@ -54,6 +54,29 @@ int main(void)
 	assert(rbitset_prev(field1, 3, false) == 2);
 	assert(rbitset_prev(field1, 1, false) == 0);
 
+	rbitset_clear_all(field1, 66);
+	assert(rbitset_next_clear_range(field1, 0, 66, 1) == 0);
+	assert(rbitset_next_clear_range(field1, 0, 66, 66) == 0);
+	assert(rbitset_next_clear_range(field1, 0, 66, 67) == (size_t)-1);
+	assert(rbitset_next_clear_range(field1, 63, 66, 4) == (size_t)-1);
+	rbitset_set(field1, 3);
+	rbitset_set(field1, 6);
+	/* holes narrower than the requested width are skipped */
+	assert(rbitset_next_clear_range(field1, 0, 66, 3) == 0);
+	assert(rbitset_next_clear_range(field1, 0, 66, 4) == 7);
+	assert(rbitset_next_clear_range(field1, 1, 66, 3) == 7);
+	rbitset_set_range(field1, 7, 30, true);
+	rbitset_set_range(field1, 34, 40, true);
+	/* the run 30..33 straddles the 32 bit word boundary */
+	assert(rbitset_next_clear_range(field1, 0, 66, 4) == 30);
+	assert(rbitset_next_clear_range(field1, 30, 66, 4) == 30);
+	assert(rbitset_next_clear_range(field1, 0, 66, 5) == 40);
+	/* the run must fit completely below last */
+	assert(rbitset_next_clear_range(field1, 0, 34, 4) == 30);
+	assert(rbitset_next_clear_range(field1, 0, 33, 4) == (size_t)-1);
+	assert(rbitset_next_clear_range(field1, 40, 66, 26) == 40);
+	assert(rbitset_next_clear_range(field1, 40, 66, 27) == (size_t)-1);
+
 	unsigned *null = (unsigned*)0;
 	rbitset_flip_all(null, 0);
 	rbitset_set_all(null, 0);